@@ -296,6 +296,29 @@ int asn1_types_get_item_by_index(const uint8_t *d, size_t dlen, int tag,
 int asn1_check(int expr);
 
 
+/*
+ * ASN1_WRITER encodes a structure in one pass into a growable buffer. The
+ * header of a constructed type is written by asn1_writer_begin with room for a
+ * 2-octet length, asn1_writer_end patches the length and moves the content only
+ * when the length needs another size. The usual _to_der functions write into
+ * the writer with (&w->p, &w->len) after asn1_writer_reserve of the exact length
+ * returned by the same functions with a NULL output.
+ */
+typedef struct {
+	uint8_t *buf;
+	size_t maxlen;
+	uint8_t *p; // == buf + len
+	size_t len;
+} ASN1_WRITER;
+
+int asn1_writer_init(ASN1_WRITER *w, size_t maxlen);
+int asn1_writer_reserve(ASN1_WRITER *w, size_t len);
+int asn1_writer_begin(ASN1_WRITER *w, int tag, size_t *pos);
+int asn1_writer_end(ASN1_WRITER *w, size_t pos);
+void asn1_writer_reset(ASN1_WRITER *w);
+void asn1_writer_cleanup(ASN1_WRITER *w);
+
+
 #if __cplusplus
 }
 #endif
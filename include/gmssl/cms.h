@@ -22,6 +22,8 @@ References:
 #include <string.h>
 #include <stdint.h>
 #include <sys/types.h>
+#include <gmssl/sm3.h>
+#include <gmssl/sm4.h>
 #include <gmssl/x509.h>
 
 
@@ -476,6 +478,12 @@ int cms_sign(
 	const CMS_CERTS_AND_KEY *signers, size_t signers_cnt,
 	int content_type, const uint8_t *content, size_t content_len,
 	const uint8_t *crls, size_t crls_len);
+// one pass version of cms_sign, append the ContentInfo to w
+int cms_sign_to_writer(
+	const CMS_CERTS_AND_KEY *signers, size_t signers_cnt,
+	int content_type, const uint8_t *content, size_t content_len,
+	const uint8_t *crls, size_t crls_len,
+	ASN1_WRITER *w);
 
 int cms_verify(
 	const uint8_t *cms, size_t cms_len,
@@ -532,6 +540,100 @@ int cms_set_key_agreement_info(
 	const uint8_t *user_cert, size_t user_cert_len,
 	const uint8_t *user_id, size_t user_id_len);
 
+/*
+Streaming SignedData and EnvelopedData (content type data only)
+
+The encoders output indefinite-length BER, the content is split into OCTET STRING
+chunks of CMS_STREAM_CHUNK_SIZE bytes, so neither the content nor its length is
+needed in advance. The digest of a streamed or detached content is SM3 over the
+content octets as in RFC 5652. The decoders also accept the DER output of
+cms_sign and cms_envelop, for a definite-length ContentInfo with content the
+digest is over the whole encoded ContentInfo as in cms_signed_data_sign_to_der.
+
+The init and finish of the encoders return the output length with out == NULL.
+The update functions output at most CMS_STREAM_UPDATE_MAX_OUTLEN(inlen) bytes,
+the finish of the decoders at most SM4_BLOCK_SIZE bytes. The decoders keep the
+BER headers, the RecipientInfos and the certificates and SignerInfos in a buffer
+of CMS_STREAM_BUF_SIZE bytes.
+*/
+#define CMS_STREAM_CHUNK_SIZE	4096
+#define CMS_STREAM_BUF_SIZE	32768
+#define CMS_STREAM_UPDATE_MAX_OUTLEN(inlen) \
+	((inlen) + CMS_STREAM_CHUNK_SIZE + SM4_BLOCK_SIZE + ((inlen)/CMS_STREAM_CHUNK_SIZE + 2) * 4)
+
+typedef struct {
+	int state;
+	int octets_constructed;
+	int octets_indefinite;
+	size_t octets_left;
+	size_t chunk_left;
+	uint8_t buf[CMS_STREAM_BUF_SIZE];
+	size_t buflen;
+} CMS_STREAM_READER;
+
+typedef struct {
+	SM3_CTX sm3_ctx;
+	const CMS_CERTS_AND_KEY *signers;
+	size_t signers_cnt;
+	int detached;
+	uint8_t chunk[CMS_STREAM_CHUNK_SIZE];
+	size_t chunk_len;
+} CMS_SIGN_CTX;
+
+int cms_sign_init(CMS_SIGN_CTX *ctx, const CMS_CERTS_AND_KEY *signers, size_t signers_cnt,
+	int detached, uint8_t *out, size_t *outlen);
+int cms_sign_update(CMS_SIGN_CTX *ctx, const uint8_t *in, size_t inlen, uint8_t *out, size_t *outlen);
+int cms_sign_finish(CMS_SIGN_CTX *ctx, uint8_t *out, size_t *outlen);
+
+// certs and signer_infos point into reader.buf after cms_verify_finish
+typedef struct {
+	SM3_CTX sm3_ctx;
+	CMS_STREAM_READER reader;
+	int detached;
+	int raw_digest;
+	int content_eocs;
+	int end_eocs;
+	const uint8_t *certs;
+	size_t certs_len;
+	const uint8_t *signer_infos;
+	size_t signer_infos_len;
+} CMS_VERIFY_CTX;
+
+int cms_verify_init(CMS_VERIFY_CTX *ctx);
+int cms_verify_update(CMS_VERIFY_CTX *ctx, const uint8_t *in, size_t inlen, uint8_t *out, size_t *outlen); // out can be NULL
+int cms_verify_detached_update(CMS_VERIFY_CTX *ctx, const uint8_t *data, size_t datalen); // after the SignedData prefix
+int cms_verify_finish(CMS_VERIFY_CTX *ctx);
+
+typedef struct {
+	SM4_CBC_CTX cbc_ctx;
+	uint8_t chunk[CMS_STREAM_CHUNK_SIZE];
+	size_t chunk_len;
+} CMS_ENVELOP_CTX;
+
+int cms_envelop_init(CMS_ENVELOP_CTX *ctx,
+	const uint8_t *rcpt_certs, size_t rcpt_certs_len,
+	int enc_algor, const uint8_t *key, size_t keylen, const uint8_t *iv, size_t ivlen,
+	uint8_t *out, size_t *outlen);
+int cms_envelop_update(CMS_ENVELOP_CTX *ctx, const uint8_t *in, size_t inlen, uint8_t *out, size_t *outlen);
+int cms_envelop_finish(CMS_ENVELOP_CTX *ctx, uint8_t *out, size_t *outlen);
+
+typedef struct {
+	SM4_CBC_CTX cbc_ctx;
+	CMS_STREAM_READER reader;
+	const SM2_KEY *rcpt_key;
+	const uint8_t *rcpt_issuer;
+	size_t rcpt_issuer_len;
+	const uint8_t *rcpt_serial;
+	size_t rcpt_serial_len;
+	int enced_content_info_indefinite;
+	int end_eocs;
+} CMS_DEENVELOP_CTX;
+
+int cms_deenvelop_init(CMS_DEENVELOP_CTX *ctx,
+	const SM2_KEY *rcpt_key, const uint8_t *rcpt_cert, size_t rcpt_cert_len);
+int cms_deenvelop_update(CMS_DEENVELOP_CTX *ctx, const uint8_t *in, size_t inlen, uint8_t *out, size_t *outlen);
+int cms_deenvelop_finish(CMS_DEENVELOP_CTX *ctx, uint8_t *out, size_t *outlen);
+
 #define PEM_CMS "CMS"
 int cms_to_pem(const uint8_t *cms, size_t cms_len, FILE *fp);
 int cms_from_pem(uint8_t *cms, size_t *cms_len, size_t maxlen, FILE *fp);
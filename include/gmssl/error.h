@@ -30,19 +30,56 @@ extern "C" {
 
 
 
-#define DEBUG 1
+/*
+ * Every error_print() records (file, line, function, code) in a ring owned by
+ * the calling thread, without locks or I/O. The oldest entries are overwritten
+ * when more than GMSSL_ERROR_QUEUE_SIZE errors are not cleared.
+ *
+ * The library also prints the errors to stderr when built with
+ * ENABLE_ERROR_STDERR (default ON) and gmssl_error_set_stderr() is not
+ * called with 0, so do the TLS handshake status lines. With
+ * ENABLE_ERROR_STDERR=OFF neither is written, only the socket, SDF/SKF and
+ * OpenCL wrappers and the debug print functions still use stdout/stderr.
+ */
+enum {
+	GMSSL_ERR_UNSPECIFIED	= 0,
+	GMSSL_ERR_DECODE	= 1, // malformed or oversized input
+	GMSSL_ERR_VERIFY	= 2, // signature, MAC or padding check failure
+};
+
+#define GMSSL_ERROR_QUEUE_SIZE	32
+
+typedef struct {
+	const char *file;
+	const char *func;
+	int line;
+	int code;
+} GMSSL_ERROR;
+
+void gmssl_error_push(const char *file, int line, const char *func, int code);
+void gmssl_error_push_msg(const char *file, int line, const char *func, int code, const char *fmt, ...);
+int gmssl_error_get(GMSSL_ERROR *err); // oldest error, return 0 if the queue is empty
+int gmssl_error_peek_last(GMSSL_ERROR *err);
+void gmssl_error_clear(void);
+int gmssl_error_print(FILE *fp); // print and clear the queue of the calling thread
+const char *gmssl_error_code_name(int code);
+void gmssl_error_set_stderr(int enable);
+int gmssl_error_stderr_enabled(void);
 
 #define warning_print() \
-	do { if (DEBUG) fprintf(stderr, "%s:%d:%s():\n",__FILE__, __LINE__, __FUNCTION__); } while (0)
+	do { if (gmssl_error_stderr_enabled()) fprintf(stderr, "%s:%d:%s():\n",__FILE__, __LINE__, __FUNCTION__); } while (0)
 
 #define error_print() \
-	do { if (DEBUG) fprintf(stderr, "%s:%d:%s():\n",__FILE__, __LINE__, __FUNCTION__); } while (0)
+	gmssl_error_push(__FILE__, __LINE__, __FUNCTION__, GMSSL_ERR_UNSPECIFIED)
+
+#define error_print_code(code) \
+	gmssl_error_push(__FILE__, __LINE__, __FUNCTION__, (code))
 
 #define error_print_msg(fmt, ...) \
-	do { if (DEBUG) fprintf(stderr, "%s:%d:%s(): " fmt, __FILE__, __LINE__, __FUNCTION__, __VA_ARGS__); } while (0)
+	gmssl_error_push_msg(__FILE__, __LINE__, __FUNCTION__, GMSSL_ERR_UNSPECIFIED, fmt, __VA_ARGS__)
 
 #define error_puts(str) \
-            do { if (DEBUG) fprintf(stderr, "%s: %d: %s: %s\n", __FILE__, __LINE__, __FUNCTION__, str); } while (0)
+	gmssl_error_push_msg(__FILE__, __LINE__, __FUNCTION__, GMSSL_ERR_UNSPECIFIED, "%s\n", str)
 
 
 void print_der(const uint8_t *in, size_t inlen);
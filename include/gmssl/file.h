@@ -22,6 +22,53 @@ extern "C" {
 int file_size(FILE *fp, size_t *size);
 int file_read_all(const char *file, uint8_t **out, size_t *outlen);
 
+/*
+ * FILE_MAP is a read-only view of a whole file, mapped into memory when the
+ * platform supports it, or read into a malloc-ed buffer otherwise.
+ */
+typedef struct {
+	uint8_t *data;
+	size_t datalen;
+	int mapped;
+} FILE_MAP;
+
+int file_map(FILE_MAP *map, const char *file);
+void file_unmap(FILE_MAP *map);
+
+
+/*
+ * FILE_READER returns the input in blocks of at most FILE_IO_BLOCK_SIZE bytes.
+ * A regular file is mapped into memory and the blocks point into the mapping,
+ * other inputs (pipes, terminals) are read into page aligned buffers. With
+ * ENABLE_PTHREAD a thread reads the next buffer while the caller processes the
+ * current one. A block is valid until the next file_reader_read.
+ */
+#define FILE_IO_BLOCK_SIZE	(1024 * 1024)
+
+typedef struct {
+	FILE *fp;
+	int fd;
+	uint8_t *map;
+	size_t map_size;
+	size_t offset;
+	uint8_t *bufs[2];
+	size_t buf_lens[2];
+	int buf_ready[2]; // 1 filled, -1 read error
+	int cur; // buffer returned to the caller, -1 for none
+	int eof;
+	void *thread; // reader thread, lock and cond with ENABLE_PTHREAD, the layout does not depend on it
+	int thread_started;
+	int stop;
+} FILE_READER;
+
+int file_reader_init(FILE_READER *reader, FILE *fp);
+// return 1 with a block, 0 at the end of input, -1 on error
+int file_reader_read(FILE_READER *reader, const uint8_t **data, size_t *datalen);
+void file_reader_cleanup(FILE_READER *reader);
+
+// write to the file descriptor of fp, bypassing the stdio buffer
+int file_write(FILE *fp, const uint8_t *data, size_t datalen);
+
 
 #ifdef __cplusplus
 }
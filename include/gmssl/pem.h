@@ -26,6 +26,41 @@ extern "C" {
 int pem_read(FILE *fp, const char *name, uint8_t *out, size_t *outlen, size_t maxlen);
 int pem_write(FILE *fp, const char *name, const uint8_t *in, size_t inlen);
 
+// streaming PEM for objects not kept in memory, e.g. the streaming CMS
+typedef struct {
+	BASE64_CTX base64_ctx;
+	FILE *fp;
+	const char *name;
+	int end;
+} PEM_CTX;
+
+int pem_write_init(PEM_CTX *ctx, FILE *fp, const char *name);
+int pem_write_update(PEM_CTX *ctx, const uint8_t *in, size_t inlen);
+int pem_write_finish(PEM_CTX *ctx);
+int pem_read_init(PEM_CTX *ctx, FILE *fp, const char *name);
+int pem_read_update(PEM_CTX *ctx, uint8_t *out, size_t *outlen, size_t maxlen); // return 0 after the END line
+
+/*
+ * PEM_ITER walks the PEM objects of a bundle in memory, e.g. a mapped CA file.
+ * Text outside the BEGIN/END lines is skipped. The returned name and DER point
+ * into the iterator and are valid until the next pem_iter_next.
+ */
+#define PEM_MAX_NAME_SIZE	64
+
+typedef struct {
+	const uint8_t *data;
+	size_t datalen;
+	size_t offset;
+	uint8_t *der;
+	size_t der_maxlen;
+	char name[PEM_MAX_NAME_SIZE];
+} PEM_ITER;
+
+int pem_iter_init(PEM_ITER *iter, const uint8_t *data, size_t datalen);
+// return 1 with an object, 0 when no more objects, -1 on error
+int pem_iter_next(PEM_ITER *iter, const char **name, const uint8_t **der, size_t *derlen);
+void pem_iter_cleanup(PEM_ITER *iter);
+
 
 #ifdef __cplusplus
 }
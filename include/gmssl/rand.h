@@ -21,8 +21,17 @@ extern "C" {
 
 #define RAND_BYTES_MAX_SIZE	(256)
 
+/*
+ * With ENABLE_RAND_DRBG every thread has its own SM4 CTR_DRBG seeded from
+ * rand_os_bytes, rand_bytes accepts any length and makes no system call
+ * until the next reseed. The DRBG is reseeded by request count and time, and
+ * instantiated again in the child after fork().
+ */
 int rand_bytes(uint8_t *buf, size_t buflen);
 
+// entropy of the operating system, no more than RAND_BYTES_MAX_SIZE bytes per call
+int rand_os_bytes(uint8_t *buf, size_t buflen);
+
 
 #ifdef __cplusplus
 }
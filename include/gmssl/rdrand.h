@@ -22,7 +22,7 @@ extern "C" {
 
 int rdrand_bytes(uint8_t *buf, size_t buflen);
 
-#ifdef INTEL_RDSEED
+#ifdef ENABLE_INTEL_RDSEED
 int rdseed_bytes(uint8_t *buf, size_t buflen);
 #endif
 
@@ -88,6 +88,60 @@ int sdf_close_device(SDF_DEVICE *dev);
 void sdf_unload_library(void);
 
 
+/*
+ * SDF_SESSION_POOL keeps num_sessions sessions of a device open, each with the
+ * access right of the private key key_index, so that concurrent callers neither
+ * serialize on one session nor open a session per request. A thread takes the
+ * session it used last when that session is free, otherwise any free session,
+ * and waits only when all the sessions are busy.
+ *
+ * sdf_pool_submit queues a request to num_workers threads and returns at once,
+ * so up to min(num_workers, num_sessions) requests are in flight on the device.
+ * sdf_pool_wait blocks until the request is completed and returns its status.
+ * Without ENABLE_PTHREAD num_workers is ignored and sdf_pool_submit runs the
+ * request before returning.
+ */
+#define SDF_POOL_MAX_SESSIONS	64
+#define SDF_POOL_MAX_WORKERS	64
+#define SDF_POOL_QUEUE_SIZE	256
+
+enum {
+	SDF_POOL_SIGN		= 1,
+	SDF_POOL_DECRYPT	= 2,
+};
+
+typedef struct {
+	int type;
+	const uint8_t *in; // SM3 digest to sign, or DER SM2 ciphertext
+	size_t inlen;
+	uint8_t *out; // SM2_MAX_SIGNATURE_SIZE or SM2_MAX_PLAINTEXT_SIZE bytes
+	size_t outlen;
+	int status; // 0 pending, 1 done, -1 failed
+} SDF_POOL_REQUEST;
+
+typedef struct {
+	uint64_t requests; // completed requests, including failed ones
+	uint64_t errors;
+	uint64_t affinity_hits; // requests served by the last session of the thread
+	uint64_t session_waits; // requests that found all the sessions busy
+	size_t busy_sessions;
+	size_t max_busy_sessions;
+	size_t queued;
+} SDF_POOL_STATS;
+
+// opaque, the layout depends on ENABLE_PTHREAD
+typedef struct SDF_SESSION_POOL SDF_SESSION_POOL;
+
+SDF_SESSION_POOL *sdf_pool_new(SDF_DEVICE *dev, int key_index, const char *pass,
+	size_t num_sessions, size_t num_workers);
+int sdf_pool_sign(SDF_SESSION_POOL *pool, const uint8_t dgst[32], uint8_t *sig, size_t *siglen);
+int sdf_pool_decrypt(SDF_SESSION_POOL *pool, const uint8_t *in, size_t inlen, uint8_t *out, size_t *outlen);
+int sdf_pool_submit(SDF_SESSION_POOL *pool, SDF_POOL_REQUEST *req);
+int sdf_pool_wait(SDF_SESSION_POOL *pool, SDF_POOL_REQUEST *req);
+void sdf_pool_get_stats(SDF_SESSION_POOL *pool, SDF_POOL_STATS *stats);
+void sdf_pool_free(SDF_SESSION_POOL *pool);
+
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,65 @@
+/*
+ *  Copyright 2014-2024 The GmSSL Project. All Rights Reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the License); you may
+ *  not use this file except in compliance with the License.
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+
+#ifndef GMSSL_SM3_DRBG_H
+#define GMSSL_SM3_DRBG_H
+
+
+#include <time.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <gmssl/sm3.h>
+
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+/*
+ * SM3 Hash_DRBG (GM/T 0105-2021, NIST SP 800-90A Hash_DRBG with SM3)
+ *
+ * The seed length of SM3 is 440 bits, so every Hashgen block is a single SM3
+ * compression. sm3_drbg_generate fails after SM3_DRBG_RESEED_INTERVAL requests
+ * until sm3_drbg_reseed is called, the caller should also reseed when
+ * sm3_drbg_need_reseed reports a state older than SM3_DRBG_RESEED_TIME seconds.
+ */
+#define SM3_DRBG_SEED_SIZE		55
+#define SM3_DRBG_MIN_ENTROPY_SIZE	32
+#define SM3_DRBG_MAX_INPUT_SIZE		(1 << 16)
+#define SM3_DRBG_MAX_REQUEST_SIZE	(1 << 16) // 2^19 bits
+#define SM3_DRBG_RESEED_INTERVAL	(1 << 20)
+#define SM3_DRBG_RESEED_TIME		600
+
+typedef struct {
+	uint8_t V[SM3_DRBG_SEED_SIZE];
+	uint8_t C[SM3_DRBG_SEED_SIZE];
+	uint32_t reseed_counter;
+	time_t last_reseed_time;
+} SM3_DRBG;
+
+int sm3_drbg_init(SM3_DRBG *drbg,
+	const uint8_t *entropy, size_t entropy_len,
+	const uint8_t *nonce, size_t nonce_len,
+	const uint8_t *personalstr, size_t personalstr_len);
+int sm3_drbg_reseed(SM3_DRBG *drbg,
+	const uint8_t *entropy, size_t entropy_len,
+	const uint8_t *additional, size_t additional_len);
+int sm3_drbg_need_reseed(const SM3_DRBG *drbg);
+int sm3_drbg_generate(SM3_DRBG *drbg,
+	const uint8_t *additional, size_t additional_len,
+	uint8_t *out, size_t outlen);
+void sm3_drbg_cleanup(SM3_DRBG *drbg);
+
+
+#ifdef __cplusplus
+}
+#endif
+#endif
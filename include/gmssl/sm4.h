@@ -64,6 +64,50 @@ int sm4_cbc_decrypt_update(SM4_CBC_CTX *ctx, const uint8_t *in, size_t inlen, ui
 int sm4_cbc_decrypt_finish(SM4_CBC_CTX *ctx, uint8_t *out, size_t *outlen);
 
 
+/*
+ * 8-lane SM4 with per-lane keys, rk[i][j] is the i-th round key of lane j,
+ * `sm4_x8_encrypt` encrypts in[j] with the key of lane j.
+ */
+#define SM4_X8_LANES		8
+
+typedef struct {
+	uint32_t rk[SM4_NUM_ROUNDS][SM4_X8_LANES];
+} SM4_X8_KEY;
+
+// only lanes with bit j of `lanes` set are loaded from `key[j]`
+void sm4_x8_set_key(SM4_X8_KEY *x8_key, unsigned int lanes, const SM4_KEY *key[SM4_X8_LANES]);
+void sm4_x8_set_encrypt_key(SM4_X8_KEY *x8_key, const uint8_t raw_key[SM4_X8_LANES][SM4_KEY_SIZE]);
+void sm4_x8_set_decrypt_key(SM4_X8_KEY *x8_key, const uint8_t raw_key[SM4_X8_LANES][SM4_KEY_SIZE]);
+void sm4_x8_encrypt(const SM4_X8_KEY *x8_key,
+	const uint8_t in[SM4_X8_LANES][SM4_BLOCK_SIZE], uint8_t out[SM4_X8_LANES][SM4_BLOCK_SIZE]);
+
+/*
+ * Multi-key ECB, `in` and `out` are `nkeys` groups of `nblocks` blocks,
+ * the i-th group is encrypted (decrypted) with `raw_keys[i]`.
+ * The key schedules are expanded and used 8 keys at a time.
+ */
+void sm4_multi_key_encrypt_blocks(const uint8_t (*raw_keys)[SM4_KEY_SIZE], size_t nkeys,
+	const uint8_t *in, size_t nblocks, uint8_t *out);
+void sm4_multi_key_decrypt_blocks(const uint8_t (*raw_keys)[SM4_KEY_SIZE], size_t nkeys,
+	const uint8_t *in, size_t nblocks, uint8_t *out);
+
+/*
+ * Encrypt many independent CBC streams, the streams are scheduled on the
+ * SM4_X8_KEY lanes and advanced in lockstep, one block per lane per step.
+ * `iv` of each job is updated to the last ciphertext block as
+ * `sm4_cbc_encrypt_blocks` does.
+ */
+typedef struct {
+	const SM4_KEY *key;
+	uint8_t iv[SM4_BLOCK_SIZE];
+	const uint8_t *in;
+	size_t nblocks;
+	uint8_t *out;
+} SM4_CBC_JOB;
+
+void sm4_cbc_encrypt_jobs(SM4_CBC_JOB *jobs, size_t njobs);
+
+
 void sm4_ctr_encrypt(const SM4_KEY *key, uint8_t ctr[SM4_BLOCK_SIZE],
 	const uint8_t *in, size_t inlen, uint8_t *out);
 void sm4_ctr32_encrypt(const SM4_KEY *key, uint8_t ctr[SM4_BLOCK_SIZE],
@@ -83,6 +127,20 @@ int sm4_ctr32_encrypt_init(SM4_CTR_CTX *ctx, const uint8_t key[SM4_KEY_SIZE], co
 int sm4_ctr32_encrypt_update(SM4_CTR_CTX *ctx, const uint8_t *in, size_t inlen, uint8_t *out, size_t *outlen);
 int sm4_ctr32_encrypt_finish(SM4_CTR_CTX *ctx, uint8_t *out, size_t *outlen);
 
+#ifdef ENABLE_PTHREAD
+/*
+ * The `_threads` updates split the whole blocks (data units of XTS) of the input
+ * into at most `nthreads` ranges, each range is processed by a thread with its
+ * own counter or tweak. The output is the same as the single threaded update.
+ */
+#define SM4_MAX_THREADS		64
+
+int sm4_ctr_encrypt_update_threads(SM4_CTR_CTX *ctx,
+	const uint8_t *in, size_t inlen, uint8_t *out, size_t *outlen, int nthreads);
+int sm4_ctr32_encrypt_update_threads(SM4_CTR_CTX *ctx,
+	const uint8_t *in, size_t inlen, uint8_t *out, size_t *outlen, int nthreads);
+#endif
+
 
 #define NIST_SP800_GCM_MAX_IV_SIZE	(((uint64_t)1 << (64-3)) - 1) // 2305843009213693951
 #define SM4_GCM_MAX_IV_SIZE		64
@@ -135,6 +193,13 @@ int sm4_gcm_decrypt_update(SM4_GCM_CTX *ctx,
 	const uint8_t *in, size_t inlen, uint8_t *out, size_t *outlen);
 int sm4_gcm_decrypt_finish(SM4_GCM_CTX *ctx,
 	uint8_t *out, size_t *outlen);
+#ifdef ENABLE_PTHREAD
+// only the CTR encryption is threaded, GHASH is still sequential
+int sm4_gcm_encrypt_update_threads(SM4_GCM_CTX *ctx,
+	const uint8_t *in, size_t inlen, uint8_t *out, size_t *outlen, int nthreads);
+int sm4_gcm_decrypt_update_threads(SM4_GCM_CTX *ctx,
+	const uint8_t *in, size_t inlen, uint8_t *out, size_t *outlen, int nthreads);
+#endif
 
 
 #ifdef ENABLE_SM4_ECB
@@ -155,6 +220,12 @@ int sm4_ecb_decrypt_init(SM4_ECB_CTX *ctx, const uint8_t key[SM4_BLOCK_SIZE]);
 int sm4_ecb_decrypt_update(SM4_ECB_CTX *ctx,
 	const uint8_t *in, size_t inlen, uint8_t *out, size_t *outlen);
 int sm4_ecb_decrypt_finish(SM4_ECB_CTX *ctx, uint8_t *out, size_t *outlen);
+#ifdef ENABLE_PTHREAD
+int sm4_ecb_encrypt_update_threads(SM4_ECB_CTX *ctx,
+	const uint8_t *in, size_t inlen, uint8_t *out, size_t *outlen, int nthreads);
+int sm4_ecb_decrypt_update_threads(SM4_ECB_CTX *ctx,
+	const uint8_t *in, size_t inlen, uint8_t *out, size_t *outlen, int nthreads);
+#endif
 #endif // ENABLE_SM4_ECB
 
 
@@ -230,6 +301,40 @@ int sm4_ccm_encrypt(const SM4_KEY *sm4_key, const uint8_t *iv, size_t ivlen,
 int sm4_ccm_decrypt(const SM4_KEY *sm4_key, const uint8_t *iv, size_t ivlen,
 	const uint8_t *aad, size_t aadlen, const uint8_t *in, size_t inlen,
 	const uint8_t *tag, size_t taglen, uint8_t *out);
+
+// CCM needs the plaintext length in B0, so `inlen` must be given to init
+typedef struct {
+	SM4_KEY sm4_key;
+	uint8_t ctr[SM4_BLOCK_SIZE];
+	uint8_t S0[SM4_BLOCK_SIZE]; // E(K, CTR_0)
+	uint8_t mac[SM4_BLOCK_SIZE]; // CBC-MAC state
+	size_t maclen;
+	size_t ctrlen; // 15 - ivlen
+	size_t taglen;
+	size_t inlen;
+	size_t encedlen;
+	uint8_t block[SM4_BLOCK_SIZE];
+	size_t block_nbytes;
+	uint8_t tag[SM4_CCM_MAX_TAG_SIZE]; // decrypt only
+	size_t tag_nbytes;
+} SM4_CCM_CTX;
+
+// `key` can be NULL to keep the key schedule of the previous init
+int sm4_ccm_encrypt_init(SM4_CCM_CTX *ctx,
+	const uint8_t *key, size_t keylen, const uint8_t *iv, size_t ivlen,
+	const uint8_t *aad, size_t aadlen, size_t inlen, size_t taglen);
+int sm4_ccm_encrypt_update(SM4_CCM_CTX *ctx,
+	const uint8_t *in, size_t inlen, uint8_t *out, size_t *outlen);
+int sm4_ccm_encrypt_finish(SM4_CCM_CTX *ctx,
+	uint8_t *out, size_t *outlen);
+// input of decrypt_update is the ciphertext (`inlen` bytes of init) followed by the tag
+int sm4_ccm_decrypt_init(SM4_CCM_CTX *ctx,
+	const uint8_t *key, size_t keylen, const uint8_t *iv, size_t ivlen,
+	const uint8_t *aad, size_t aadlen, size_t inlen, size_t taglen);
+int sm4_ccm_decrypt_update(SM4_CCM_CTX *ctx,
+	const uint8_t *in, size_t inlen, uint8_t *out, size_t *outlen);
+int sm4_ccm_decrypt_finish(SM4_CCM_CTX *ctx,
+	uint8_t *out, size_t *outlen);
 #endif // ENABLE_SM4_CCM
 
 
@@ -256,6 +361,12 @@ int sm4_xts_encrypt_finish(SM4_XTS_CTX *ctx, uint8_t *out, size_t *outlen);
 int sm4_xts_decrypt_init(SM4_XTS_CTX *ctx, const uint8_t key[32], const uint8_t iv[16], size_t data_unit_size);
 int sm4_xts_decrypt_update(SM4_XTS_CTX *ctx, const uint8_t *in, size_t inlen, uint8_t *out, size_t *outlen);
 int sm4_xts_decrypt_finish(SM4_XTS_CTX *ctx, uint8_t *out, size_t *outlen);
+#ifdef ENABLE_PTHREAD
+int sm4_xts_encrypt_update_threads(SM4_XTS_CTX *ctx,
+	const uint8_t *in, size_t inlen, uint8_t *out, size_t *outlen, int nthreads);
+int sm4_xts_decrypt_update_threads(SM4_XTS_CTX *ctx,
+	const uint8_t *in, size_t inlen, uint8_t *out, size_t *outlen, int nthreads);
+#endif
 #endif // ENABLE_SM4_XTS
 
 
@@ -0,0 +1,63 @@
+/*
+ *  Copyright 2014-2024 The GmSSL Project. All Rights Reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the License); you may
+ *  not use this file except in compliance with the License.
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+
+#ifndef GMSSL_SM4_DRBG_H
+#define GMSSL_SM4_DRBG_H
+
+
+#include <time.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <gmssl/sm4.h>
+
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+/*
+ * SM4 CTR_DRBG with derivation function (GM/T 0105-2021, NIST SP 800-90A)
+ *
+ * The output is the SM4-CTR keystream, so the generation runs at the speed of
+ * sm4_ctr_encrypt_blocks. The reseed limits are the same as SM3 Hash_DRBG.
+ */
+#define SM4_DRBG_SEED_SIZE		(SM4_KEY_SIZE + SM4_BLOCK_SIZE)
+#define SM4_DRBG_MIN_ENTROPY_SIZE	32
+#define SM4_DRBG_MAX_INPUT_SIZE		(1 << 16)
+#define SM4_DRBG_MAX_REQUEST_SIZE	(1 << 16) // 2^19 bits
+#define SM4_DRBG_RESEED_INTERVAL	(1 << 20)
+#define SM4_DRBG_RESEED_TIME		600
+
+typedef struct {
+	SM4_KEY sm4_key;
+	uint8_t V[SM4_BLOCK_SIZE];
+	uint32_t reseed_counter;
+	time_t last_reseed_time;
+} SM4_DRBG;
+
+int sm4_drbg_init(SM4_DRBG *drbg,
+	const uint8_t *entropy, size_t entropy_len,
+	const uint8_t *nonce, size_t nonce_len,
+	const uint8_t *personalstr, size_t personalstr_len);
+int sm4_drbg_reseed(SM4_DRBG *drbg,
+	const uint8_t *entropy, size_t entropy_len,
+	const uint8_t *additional, size_t additional_len);
+int sm4_drbg_need_reseed(const SM4_DRBG *drbg);
+int sm4_drbg_generate(SM4_DRBG *drbg,
+	const uint8_t *additional, size_t additional_len,
+	uint8_t *out, size_t outlen);
+void sm4_drbg_cleanup(SM4_DRBG *drbg);
+
+
+#ifdef __cplusplus
+}
+#endif
+#endif
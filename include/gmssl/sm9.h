@@ -77,6 +77,21 @@ typedef struct {
 int sm9_sign_master_key_generate(SM9_SIGN_MASTER_KEY *master);
 int sm9_sign_master_key_extract_key(SM9_SIGN_MASTER_KEY *master, const char *id, size_t idlen, SM9_SIGN_KEY *key);
 
+/*
+ * Batch extraction for a KGC issuing many keys, keys[i] is extracted for ids[i].
+ * Every SM9_EXTRACT_BATCH_SIZE ids share one modn_inv, the whole call fails if
+ * any H1(ID_i) + ks == 0 (the master key should be re-generated).
+ */
+#define SM9_EXTRACT_BATCH_SIZE	64
+#define SM9_EXTRACT_MAX_THREADS	64
+
+int sm9_sign_master_key_extract_keys(const SM9_SIGN_MASTER_KEY *master,
+	const char **ids, const size_t *idlens, size_t n, SM9_SIGN_KEY *keys);
+#ifdef ENABLE_PTHREAD
+int sm9_sign_master_key_extract_keys_threads(const SM9_SIGN_MASTER_KEY *master,
+	const char **ids, const size_t *idlens, size_t n, SM9_SIGN_KEY *keys, int nthreads);
+#endif
+
 // algorthm,parameters = sm9,sm9sign
 #define SM9_SIGN_MASTER_KEY_MAX_SIZE 171
 int sm9_sign_master_key_to_der(const SM9_SIGN_MASTER_KEY *msk, uint8_t **out, size_t *outlen);
@@ -135,6 +150,39 @@ int sm9_verify_update(SM9_SIGN_CTX *ctx, const uint8_t *data, size_t datalen);
 int sm9_verify_finish(SM9_SIGN_CTX *ctx, const uint8_t *sig, size_t siglen,
 	const SM9_SIGN_MASTER_KEY *mpk, const char *id, size_t idlen);
 
+/*
+ * Prepared master public key for signing and verifying many messages under
+ * one KGC, g = e(P1, Ppubs) is computed once and g^r uses a fixed-base table.
+ */
+typedef struct {
+	SM9_Z256_TWIST_POINT Ppubs;
+	sm9_z256_fp12_t g;
+	SM9_Z256_FP12_POW_TABLE g_table;
+} SM9_SIGN_MASTER_KEY_PREP;
+
+int sm9_sign_master_public_key_prepare(SM9_SIGN_MASTER_KEY_PREP *prep, const SM9_SIGN_MASTER_KEY *mpk);
+int sm9_do_sign_prepared(const SM9_SIGN_KEY *key, const SM9_SIGN_MASTER_KEY_PREP *prep,
+	const SM3_CTX *sm3_ctx, SM9_SIGNATURE *sig);
+int sm9_do_verify_prepared(const SM9_SIGN_MASTER_KEY_PREP *prep, const char *id, size_t idlen,
+	const SM3_CTX *sm3_ctx, const SM9_SIGNATURE *sig);
+int sm9_sign_finish_prepared(SM9_SIGN_CTX *ctx, const SM9_SIGN_KEY *key, const SM9_SIGN_MASTER_KEY_PREP *prep,
+	uint8_t *sig, size_t *siglen);
+int sm9_verify_finish_prepared(SM9_SIGN_CTX *ctx, const uint8_t *sig, size_t siglen,
+	const SM9_SIGN_MASTER_KEY_PREP *prep, const char *id, size_t idlen);
+
+typedef struct {
+	const char *id;
+	size_t idlen;
+	const uint8_t *msg;
+	size_t msglen;
+	const uint8_t *sig;
+	size_t siglen;
+	int ret; // 1 valid, 0 invalid, -1 malformed
+} SM9_VERIFY_JOB;
+
+// return 1 if all signatures are valid, 0 if any is not, each result is set in jobs[i].ret
+int sm9_verify_many(const SM9_SIGN_MASTER_KEY *mpk, SM9_VERIFY_JOB *jobs, size_t njobs);
+
 
 
 /*
@@ -162,6 +210,12 @@ typedef struct {
 
 int sm9_enc_master_key_generate(SM9_ENC_MASTER_KEY *master);
 int sm9_enc_master_key_extract_key(SM9_ENC_MASTER_KEY *master, const char *id, size_t idlen, SM9_ENC_KEY *key);
+int sm9_enc_master_key_extract_keys(const SM9_ENC_MASTER_KEY *master,
+	const char **ids, const size_t *idlens, size_t n, SM9_ENC_KEY *keys);
+#ifdef ENABLE_PTHREAD
+int sm9_enc_master_key_extract_keys_threads(const SM9_ENC_MASTER_KEY *master,
+	const char **ids, const size_t *idlens, size_t n, SM9_ENC_KEY *keys, int nthreads);
+#endif
 
 // algorithm,parameters = sm9,sm9encrypt
 #define SM9_ENC_MASTER_KEY_MAX_SIZE 105
@@ -222,6 +276,42 @@ int sm9_encrypt(const SM9_ENC_MASTER_KEY *mpk, const char *id, size_t idlen,
 int sm9_decrypt(const SM9_ENC_KEY *key, const char *id, size_t idlen,
 	const uint8_t *in, size_t inlen, uint8_t *out, size_t *outlen);
 
+/*
+ * Prepared master public key for encrypting to many recipients under one KGC,
+ * g = e(Ppube, P2) is computed once and g^r uses a fixed-base table.
+ */
+typedef struct {
+	SM9_Z256_POINT Ppube;
+	sm9_z256_fp12_t g;
+	SM9_Z256_FP12_POW_TABLE g_table;
+} SM9_ENC_MASTER_KEY_PREP;
+
+int sm9_enc_master_public_key_prepare(SM9_ENC_MASTER_KEY_PREP *prep, const SM9_ENC_MASTER_KEY *mpk);
+int sm9_kem_encrypt_prepared(const SM9_ENC_MASTER_KEY_PREP *prep, const char *id, size_t idlen,
+	size_t klen, uint8_t *kbuf, SM9_Z256_POINT *C);
+int sm9_do_encrypt_prepared(const SM9_ENC_MASTER_KEY_PREP *prep, const char *id, size_t idlen,
+	const uint8_t *in, size_t inlen, SM9_Z256_POINT *C1, uint8_t *c2, uint8_t c3[SM3_HMAC_SIZE]);
+int sm9_encrypt_prepared(const SM9_ENC_MASTER_KEY_PREP *prep, const char *id, size_t idlen,
+	const uint8_t *in, size_t inlen, uint8_t *out, size_t *outlen);
+
+/*
+ * Prepared private key for decrypting many messages, the Miller loop lines of
+ * de are computed once and e(C, de) only needs the Fp12 arithmetic.
+ */
+typedef struct {
+	SM9_ENC_KEY key;
+	SM9_Z256_PAIRING_PREP de_prep;
+} SM9_ENC_KEY_PREP;
+
+int sm9_enc_key_prepare(SM9_ENC_KEY_PREP *prep, const SM9_ENC_KEY *key);
+void sm9_enc_key_prep_cleanup(SM9_ENC_KEY_PREP *prep);
+int sm9_kem_decrypt_prepared(const SM9_ENC_KEY_PREP *key, const char *id, size_t idlen, const SM9_Z256_POINT *C,
+	size_t klen, uint8_t *kbuf);
+int sm9_do_decrypt_prepared(const SM9_ENC_KEY_PREP *key, const char *id, size_t idlen,
+	const SM9_Z256_POINT *C1, const uint8_t *c2, size_t c2len, const uint8_t c3[SM3_HMAC_SIZE], uint8_t *out);
+int sm9_decrypt_prepared(const SM9_ENC_KEY_PREP *key, const char *id, size_t idlen,
+	const uint8_t *in, size_t inlen, uint8_t *out, size_t *outlen);
+
 
 // SM9 Key Exchange (To be continued)
 #define SM9_EXCH_MASTER_KEY SM9_ENC_MASTER_KEY
@@ -60,6 +60,13 @@ void sm9_z256_modp_mont_sqr(sm9_z256_t r, const sm9_z256_t a);
 void sm9_z256_modp_mont_pow(sm9_z256_t r, const sm9_z256_t a, const sm9_z256_t e);
 void sm9_z256_modp_mont_inv(sm9_z256_t r, const sm9_z256_t a);
 
+#ifdef ENABLE_SM9_AMD64
+// mont_mul/mont_sqr use MULX/ADX when supported, chosen once when the library is loaded.
+// sm9_z256_modp_set_adx(0) selects the generic C, call it before any other thread uses SM9
+int  sm9_z256_cpu_supports_adx(void);
+int  sm9_z256_modp_set_adx(int enable);
+#endif
+
 const uint64_t *sm9_z256_order(void);
 
 void sm9_z256_modn_add(sm9_z256_t r, const sm9_z256_t a, const sm9_z256_t b);
@@ -158,6 +165,21 @@ void sm9_z256_fp12_frobenius2(sm9_z256_fp12_t r, const sm9_z256_fp12_t x);
 void sm9_z256_fp12_frobenius3(sm9_z256_fp12_t r, const sm9_z256_fp12_t x);
 void sm9_z256_fp12_frobenius6(sm9_z256_fp12_t r, const sm9_z256_fp12_t x);
 
+// GT arithmetic, `a` must be in the cyclotomic subgroup (such as a pairing output)
+void sm9_z256_fp12_cyclotomic_sqr(sm9_z256_fp12_t r, const sm9_z256_fp12_t a);
+void sm9_z256_fp12_compressed_sqr(sm9_z256_fp12_t r, const sm9_z256_fp12_t a);
+void sm9_z256_fp12_decompress(sm9_z256_fp12_t r, const sm9_z256_fp12_t a);
+void sm9_z256_fp12_cyclotomic_sqr_n(sm9_z256_fp12_t r, const sm9_z256_fp12_t a, int n);
+void sm9_z256_fp12_cyclotomic_pow(sm9_z256_fp12_t r, const sm9_z256_fp12_t a, const sm9_z256_t k);
+
+// fixed-base table of a in GT (the cyclotomic subgroup), such as a pairing output
+typedef struct {
+	sm9_z256_fp12_t T[4][16]; // T[i][j] = a^((j + 1) * 2^(64 * i))
+} SM9_Z256_FP12_POW_TABLE;
+
+void sm9_z256_fp12_pow_table_init(SM9_Z256_FP12_POW_TABLE *table, const sm9_z256_fp12_t a);
+void sm9_z256_fp12_pow_with_table(sm9_z256_fp12_t r, const SM9_Z256_FP12_POW_TABLE *table, const sm9_z256_t k);
+
 
 // E(F_p): y^2 = x^3 + 5
 
@@ -222,6 +244,13 @@ void sm9_z256_twist_point_add_full(SM9_Z256_TWIST_POINT *R, const SM9_Z256_TWIST
 void sm9_z256_twist_point_mul(SM9_Z256_TWIST_POINT *R, const sm9_z256_t k, const SM9_Z256_TWIST_POINT *P);
 void sm9_z256_twist_point_mul_generator(SM9_Z256_TWIST_POINT *R, const sm9_z256_t k);
 
+typedef struct {
+	sm9_z256_fp2_t X;
+	sm9_z256_fp2_t Y;
+} SM9_Z256_TWIST_AFFINE_POINT;
+
+void sm9_z256_twist_point_add_affine(SM9_Z256_TWIST_POINT *R, const SM9_Z256_TWIST_POINT *P, const SM9_Z256_TWIST_AFFINE_POINT *Q);
+
 
 void sm9_z256_point_to_affine(SM9_Z256_AFFINE_POINT *Q, const SM9_Z256_POINT *P);
 void sm9_z256_eval_g_tangent(SM9_Z256_TWIST_POINT *R, sm9_z256_fp2_t lw[3],
@@ -240,6 +269,24 @@ void sm9_z256_final_exponent_hard_part(sm9_z256_fp12_t r, const sm9_z256_fp12_t
 void sm9_z256_final_exponent(sm9_z256_fp12_t r, const sm9_z256_fp12_t f);
 void sm9_z256_pairing(sm9_z256_fp12_t r, const SM9_Z256_TWIST_POINT *Q, const SM9_Z256_POINT *P);
 
+// Miller loop lines of a fixed G2 point, 65 doublings, 10 additions and 2 Frobenius additions
+#define SM9_Z256_PAIRING_LINES	77
+
+typedef struct {
+	sm9_z256_fp2_t lw[SM9_Z256_PAIRING_LINES][3];
+} SM9_Z256_PAIRING_PREP;
+
+void sm9_z256_pairing_prepare(SM9_Z256_PAIRING_PREP *prep, const SM9_Z256_TWIST_POINT *Q);
+void sm9_z256_pairing_prepared(sm9_z256_fp12_t r, const SM9_Z256_PAIRING_PREP *prep, const SM9_Z256_POINT *P);
+
+typedef struct {
+	const SM9_Z256_TWIST_POINT *Q;
+	const SM9_Z256_POINT *P;
+} SM9_Z256_PAIRING_PAIR;
+
+// r = e(Q_0, P_0) * ... * e(Q_{n-1}, P_{n-1}) with one final exponentiation
+void sm9_z256_pairing_product(sm9_z256_fp12_t r, const SM9_Z256_PAIRING_PAIR *pairs, size_t n);
+
 
 #ifdef  __cplusplus
 }
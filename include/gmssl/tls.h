@@ -20,6 +20,7 @@
 #include <gmssl/digest.h>
 #include <gmssl/block_cipher.h>
 #include <gmssl/socket.h>
+#include <gmssl/x509_store.h>
 
 
 #ifdef __cplusplus
@@ -678,6 +679,8 @@ typedef struct {
 	size_t cipher_suites_cnt;
 	uint8_t *cacerts;
 	size_t cacertslen;
+	const X509_TRUST_STORE *trust_store; // not owned, might be shared by other ctxs
+	X509_VERIFY_CACHE *verify_cache; // not owned, only used with the trust_store
 	uint8_t *certs;
 	size_t certslen;
 	SM2_KEY signkey;
@@ -690,6 +693,9 @@ typedef struct {
 int tls_ctx_init(TLS_CTX *ctx, int protocol, int is_client);
 int tls_ctx_set_cipher_suites(TLS_CTX *ctx, const int *cipher_suites, size_t cipher_suites_cnt);
 int tls_ctx_set_ca_certificates(TLS_CTX *ctx, const char *cacertsfile, int depth);
+int tls_ctx_set_trust_store(TLS_CTX *ctx, const X509_TRUST_STORE *store, int depth);
+// call after tls_ctx_set_trust_store, a cache shared by connections of different threads requires ENABLE_PTHREAD
+int tls_ctx_set_verify_cache(TLS_CTX *ctx, X509_VERIFY_CACHE *cache);
 int tls_ctx_set_certificate_and_key(TLS_CTX *ctx, const char *chainfile,
 	const char *keyfile, const char *keypass);
 int tls_ctx_set_tlcp_server_certificate_and_keys(TLS_CTX *ctx, const char *chainfile,
@@ -730,6 +736,8 @@ typedef struct {
 	size_t client_certs_len;
 	uint8_t ca_certs[2048];
 	size_t ca_certs_len;
+	const X509_TRUST_STORE *trust_store;
+	X509_VERIFY_CACHE *verify_cache;
 
 	SM2_KEY sign_key;
 	SM2_KEY kenc_key;
@@ -766,6 +774,9 @@ int tls_recv(TLS_CONNECT *conn, uint8_t *out, size_t outlen, size_t *recvlen);
 int tls_shutdown(TLS_CONNECT *conn);
 void tls_cleanup(TLS_CONNECT *conn);
 
+int tls_has_ca_certificates(const TLS_CONNECT *conn);
+int tls_certs_verify(const TLS_CONNECT *conn, const uint8_t *certs, size_t certslen, int certs_type, int depth);
+
 int tlcp_do_connect(TLS_CONNECT *conn);
 int tlcp_do_accept(TLS_CONNECT *conn);
 int tls12_do_connect(TLS_CONNECT *conn);
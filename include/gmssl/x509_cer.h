@@ -298,6 +298,33 @@ int x509_cert_sign_to_der(
 	const uint8_t *exts, size_t exts_len,
 	const SM2_KEY *sign_key, const char *signer_id, size_t signer_id_len,
 	uint8_t **out, size_t *outlen);
+// append the TBSCertificate to w, the caller signs the bytes from the old w->len
+int x509_tbs_cert_to_writer(
+	int version,
+	const uint8_t *serial, size_t serial_len,
+	int signature_algor,
+	const uint8_t *issuer, size_t issuer_len,
+	time_t not_before, time_t not_after,
+	const uint8_t *subject, size_t subject_len,
+	const SM2_KEY *subject_public_key,
+	const uint8_t *issuer_unique_id, size_t issuer_unique_id_len,
+	const uint8_t *subject_unique_id, size_t subject_unique_id_len,
+	const uint8_t *exts, size_t exts_len,
+	ASN1_WRITER *w);
+// one pass version of x509_cert_sign_to_der, append the certificate to w
+int x509_cert_sign_to_writer(
+	int version,
+	const uint8_t *serial, size_t serial_len,
+	int signature_algor,
+	const uint8_t *issuer, size_t issuer_len,
+	time_t not_before, time_t not_after,
+	const uint8_t *subject, size_t subject_len,
+	const SM2_KEY *subject_public_key,
+	const uint8_t *issuer_unique_id, size_t issuer_unique_id_len,
+	const uint8_t *subject_unique_id, size_t subject_unique_id_len,
+	const uint8_t *exts, size_t exts_len,
+	const SM2_KEY *sign_key, const char *signer_id, size_t signer_id_len,
+	ASN1_WRITER *w);
 
 int x509_cert_to_der(const uint8_t *a, size_t alen, uint8_t **out, size_t *outlen);
 int x509_cert_from_der(const uint8_t **a, size_t *alen, const uint8_t **in, size_t *inlen);
@@ -349,6 +376,42 @@ int x509_cert_get_subject(const uint8_t *a, size_t alen, const uint8_t **subj, s
 int x509_cert_get_subject_public_key(const uint8_t *a, size_t alen, SM2_KEY *public_key);
 int x509_cert_get_exts(const uint8_t *a, size_t alen, const uint8_t **d, size_t *dlen);
 
+/*
+ * X509_CERT_VIEW is parsed once from a DER certificate, all the fields point into
+ * the certificate (which must be kept). Names, serial number and extensions are
+ * the value octets as returned by x509_cert_get_details. The validity and the
+ * SubjectPublicKeyInfo are kept as DER and only decoded by the _get_ functions.
+ */
+typedef struct {
+	const uint8_t *cert; size_t cert_len;
+	const uint8_t *tbs; size_t tbs_len; // DER of the signed TBSCertificate
+	int version;
+	const uint8_t *serial_number; size_t serial_number_len;
+	int inner_signature_algor;
+	const uint8_t *issuer; size_t issuer_len;
+	const uint8_t *validity; size_t validity_len; // DER
+	const uint8_t *subject; size_t subject_len;
+	const uint8_t *subject_public_key_info; size_t subject_public_key_info_len; // DER
+	const uint8_t *issuer_unique_id; size_t issuer_unique_id_len;
+	const uint8_t *subject_unique_id; size_t subject_unique_id_len;
+	const uint8_t *exts; size_t exts_len;
+	int signature_algor;
+	const uint8_t *signature; size_t signature_len;
+} X509_CERT_VIEW;
+
+int x509_cert_view_init(X509_CERT_VIEW *view, const uint8_t *cert, size_t certlen);
+int x509_cert_view_from_der(X509_CERT_VIEW *view, const uint8_t **in, size_t *inlen);
+int x509_cert_view_get_validity(const X509_CERT_VIEW *view, time_t *not_before, time_t *not_after);
+int x509_cert_view_get_subject_public_key(const X509_CERT_VIEW *view, SM2_KEY *public_key);
+int x509_cert_view_check(const X509_CERT_VIEW *view, int cert_type, int *path_len_constraint);
+int x509_cert_view_verify(const X509_CERT_VIEW *view, const SM2_KEY *public_key,
+	const char *signer_id, size_t signer_id_len);
+int x509_cert_view_verify_by_ca_view(const X509_CERT_VIEW *view, const X509_CERT_VIEW *ca,
+	const char *signer_id, size_t signer_id_len);
+int x509_certs_get_cert_view_by_issuer_and_serial_number(const uint8_t *d, size_t dlen,
+	const uint8_t *issuer, size_t issuer_len, const uint8_t *serial, size_t serial_len,
+	X509_CERT_VIEW *view);
+
 int x509_certs_to_pem(const uint8_t *d, size_t dlen, FILE *fp);
 int x509_certs_from_pem(uint8_t *d, size_t *dlen, size_t maxlen, FILE *fp);
 int x509_certs_get_count(const uint8_t *d, size_t dlen, size_t *cnt);
@@ -382,6 +445,18 @@ int x509_certs_print(FILE *fp, int fmt, int ind, const char *label, const uint8_
 
 int x509_cert_new_from_file(uint8_t **out, size_t *outlen, const char *file);
 int x509_certs_new_from_file(uint8_t **out, size_t *outlen, const char *file);
+int x509_cert_sign_new(uint8_t **cert, size_t *certlen,
+	int version,
+	const uint8_t *serial, size_t serial_len,
+	int signature_algor,
+	const uint8_t *issuer, size_t issuer_len,
+	time_t not_before, time_t not_after,
+	const uint8_t *subject, size_t subject_len,
+	const SM2_KEY *subject_public_key,
+	const uint8_t *issuer_unique_id, size_t issuer_unique_id_len,
+	const uint8_t *subject_unique_id, size_t subject_unique_id_len,
+	const uint8_t *exts, size_t exts_len,
+	const SM2_KEY *sign_key, const char *signer_id, size_t signer_id_len);
 
 
 #ifdef __cplusplus
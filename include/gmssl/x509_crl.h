@@ -16,6 +16,7 @@
 #include <time.h>
 #include <stdint.h>
 #include <gmssl/sm2.h>
+#include <gmssl/asn1.h>
 
 
 #ifdef __cplusplus
@@ -264,6 +265,14 @@ int x509_crl_sign_to_der(
 	const uint8_t *crl_exts, size_t crl_exts_len,
 	const SM2_KEY *sign_key, const char *signer_id, size_t signer_id_len,
 	uint8_t **out, size_t *outlen);
+int x509_crl_sign_to_writer(
+	int version, int sig_alg,
+	const uint8_t *issuer, size_t issuer_len,
+	time_t this_update, time_t next_update,
+	const uint8_t *revoked_certs, size_t revoked_certs_len,
+	const uint8_t *crl_exts, size_t crl_exts_len,
+	const SM2_KEY *sign_key, const char *signer_id, size_t signer_id_len,
+	ASN1_WRITER *w);
 int x509_crl_from_der_ex(
 	int *version,
 	int *inner_sig_alg,
@@ -299,10 +308,99 @@ int x509_crls_print(FILE *fp, int fmt, int ind, const char *label, const uint8_t
 
 int x509_crl_new_from_uri(uint8_t **crl, size_t *crl_len, const char *uri, size_t urilen);
 int x509_crl_new_from_cert(uint8_t **crl, size_t *crl_len, const uint8_t *cert, size_t certlen);
+int x509_crl_sign_new(uint8_t **crl, size_t *crl_len,
+	int version, int sig_alg,
+	const uint8_t *issuer, size_t issuer_len,
+	time_t this_update, time_t next_update,
+	const uint8_t *revoked_certs, size_t revoked_certs_len,
+	const uint8_t *crl_exts, size_t crl_exts_len,
+	const SM2_KEY *sign_key, const char *signer_id, size_t signer_id_len);
 int x509_cert_check_crl(const uint8_t *cert, size_t certlen, const uint8_t *cacert, size_t cacertlen,
 	const char *ca_signer_id, size_t ca_signer_id_len);
 
 
+/*
+ * X509_CRL_INDEX is built once from a (verified) CRL. The revoked serial numbers
+ * are kept in a sorted array of fixed size entries with a Bloom filter in front,
+ * lookups are O(log n) and most of the not revoked serials are rejected by the
+ * filter. The in-memory layout is also the cache file format (host byte order),
+ * so x509_crl_index_from_file maps the file without parsing the CRL again.
+ *
+ * The cache file is not signed, only its layout is checked when it is mapped.
+ * It must be written by a trusted process into a directory other users can not
+ * write, anyone who can replace it can hide a revoked certificate. The SM3 of
+ * the CRL in the header lets the owner compare the cache with the CRL it has.
+ *
+ * x509_crl_index_check_time returns 0 if nextUpdate of the CRL is not after now.
+ */
+#define X509_CRL_INDEX_MAX_SERIAL_SIZE	22
+#define X509_CRL_INDEX_MAX_ISSUER_SIZE	256
+#define X509_CRL_INDEX_VERSION		1
+
+typedef struct {
+	uint8_t serial[X509_CRL_INDEX_MAX_SERIAL_SIZE]; // right aligned
+	uint8_t serial_len;
+	int8_t reason; // -1 if no reasonCode
+	int64_t revoke_date;
+} X509_CRL_INDEX_ENTRY;
+
+typedef struct {
+	uint8_t magic[8];
+	uint32_t version;
+	uint32_t byte_order;
+	uint32_t header_size;
+	uint32_t entry_size;
+	uint64_t entries_cnt;
+	uint64_t bloom_size; // bytes, power of 2
+	int64_t this_update;
+	int64_t next_update; // -1 if absent
+	uint8_t crl_digest[32]; // SM3 of the CRL DER
+	uint32_t issuer_len;
+	uint8_t issuer[X509_CRL_INDEX_MAX_ISSUER_SIZE];
+	uint8_t reserved[4];
+} X509_CRL_INDEX_HEADER;
+
+typedef struct {
+	const X509_CRL_INDEX_HEADER *header;
+	const X509_CRL_INDEX_ENTRY *entries;
+	size_t entries_cnt;
+	const uint8_t *bloom;
+	size_t bloom_size;
+	uint8_t *buf;
+	size_t buflen;
+	int mapped;
+} X509_CRL_INDEX;
+
+int x509_crl_index_build(X509_CRL_INDEX *index, const uint8_t *crl, size_t crl_len);
+int x509_crl_index_to_file(const X509_CRL_INDEX *index, const char *file);
+int x509_crl_index_from_file(X509_CRL_INDEX *index, const char *file);
+int x509_crl_index_get_issuer(const X509_CRL_INDEX *index, const uint8_t **issuer, size_t *issuer_len);
+int x509_crl_index_find_revoked_cert_by_serial_number(const X509_CRL_INDEX *index,
+	const uint8_t *serial, size_t serial_len, time_t *revoke_date, int *reason);
+int x509_crl_index_check_time(const X509_CRL_INDEX *index, time_t now);
+void x509_crl_index_cleanup(X509_CRL_INDEX *index);
+
+/*
+ * X509_CRL_INDEX_SLOT holds the current index of a CRL issuer. A refresh builds
+ * the new index before it replaces the current one, so lookups always see
+ * either the old or the new CRL. The cache file is then rewritten by rename,
+ * x509_crl_index_slot_refresh returns 0 if only this write failed.
+ * A cache whose nextUpdate has passed is not loaded by x509_crl_index_slot_init,
+ * and lookups fail once nextUpdate passes until the slot is refreshed.
+ */
+typedef struct {
+	X509_CRL_INDEX *index;
+	void *lock; // pthread_rwlock_t with ENABLE_PTHREAD, the layout does not depend on it
+} X509_CRL_INDEX_SLOT;
+
+int x509_crl_index_slot_init(X509_CRL_INDEX_SLOT *slot, const char *cache_file);
+int x509_crl_index_slot_refresh(X509_CRL_INDEX_SLOT *slot, const uint8_t *crl, size_t crl_len,
+	const char *cache_file);
+int x509_crl_index_slot_find_revoked_cert_by_serial_number(X509_CRL_INDEX_SLOT *slot,
+	const uint8_t *serial, size_t serial_len, time_t *revoke_date, int *reason);
+void x509_crl_index_slot_cleanup(X509_CRL_INDEX_SLOT *slot);
+
+
 #ifdef  __cplusplus
 }
 #endif
@@ -0,0 +1,94 @@
+/*
+ *  Copyright 2014-2024 The GmSSL Project. All Rights Reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the License); you may
+ *  not use this file except in compliance with the License.
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+
+
+#ifndef GMSSL_X509_ISSUE_H
+#define GMSSL_X509_ISSUE_H
+
+
+#include <time.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <gmssl/sm2.h>
+#include <gmssl/x509_cer.h>
+#include <gmssl/x509_req.h>
+
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+/*
+ * Batch issuance of certificates from CSRs by one CA. X509_ISSUE_CTX is set up
+ * once with the CA certificate and private key, the validity and the extensions
+ * shared by all the certificates, and is read-only afterwards. Every worker
+ * copies the prepared SM2_SIGN_CTX (Z value and the fast private key) and
+ * signs with its own precomputed k values. The SubjectKeyIdentifier, if
+ * required, is computed from the public key of each CSR.
+ */
+enum {
+	X509_ISSUE_OK = 0,
+	X509_ISSUE_PARSE_ERROR,
+	X509_ISSUE_BAD_SIGNATURE,
+	X509_ISSUE_ERROR,
+};
+
+#define X509_ISSUE_STATUS_CNT		(X509_ISSUE_ERROR + 1)
+#define X509_ISSUE_MAX_THREADS		64
+#define X509_ISSUE_MIN_SERIAL_SIZE	8 // 63 or more random bits
+#define X509_ISSUE_MAX_SERIAL_SIZE	20
+#define X509_ISSUE_MAX_EXTS_SIZE	4096
+
+typedef struct {
+	SM2_SIGN_CTX sign_ctx; // num_pre_comp is 0, never used directly
+	char req_id[SM2_MAX_ID_LENGTH + 1];
+	size_t req_id_len;
+	uint8_t *issuer;
+	size_t issuer_len;
+	time_t not_before;
+	time_t not_after;
+	uint8_t *exts;
+	size_t exts_len;
+	int gen_subject_key_id;
+	size_t serial_len;
+} X509_ISSUE_CTX;
+
+int x509_issue_ctx_init(X509_ISSUE_CTX *ctx,
+	const uint8_t *cacert, size_t cacertlen,
+	const SM2_KEY *sign_key, const char *signer_id, size_t signer_id_len,
+	const char *req_id, size_t req_id_len,
+	time_t not_before, time_t not_after,
+	const uint8_t *exts, size_t exts_len, int gen_subject_key_id,
+	size_t serial_len);
+void x509_issue_ctx_cleanup(X509_ISSUE_CTX *ctx);
+
+typedef struct {
+	const uint8_t *req;
+	size_t reqlen;
+	uint8_t *cert; // malloc-ed, freed by x509_issue_items_cleanup
+	size_t certlen;
+	int status;
+} X509_ISSUE_ITEM;
+
+const char *x509_issue_status_name(int status);
+
+// return 1 when all the items got a status, not when all the certificates are issued
+int x509_certs_issue(const X509_ISSUE_CTX *ctx, X509_ISSUE_ITEM *items, size_t items_cnt);
+#ifdef ENABLE_PTHREAD
+int x509_certs_issue_threads(const X509_ISSUE_CTX *ctx, X509_ISSUE_ITEM *items, size_t items_cnt, int nthreads);
+#endif
+void x509_issue_items_cleanup(X509_ISSUE_ITEM *items, size_t items_cnt);
+
+
+#ifdef __cplusplus
+}
+#endif
+#endif
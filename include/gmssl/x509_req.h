@@ -56,6 +56,14 @@ int x509_req_sign_to_der(
 	int signature_algor,
 	const SM2_KEY *sign_key, const char *signer_id, size_t signer_id_len,
 	uint8_t **out, size_t *outlen);
+int x509_req_sign_to_writer(
+	int version,
+	const uint8_t *subject, size_t subject_len,
+	const SM2_KEY *subject_public_key,
+	const uint8_t *attrs, size_t attrs_len,
+	int signature_algor,
+	const SM2_KEY *sign_key, const char *signer_id, size_t signer_id_len,
+	ASN1_WRITER *w);
 int x509_req_verify(const uint8_t *req, size_t reqlen,
 	const char *signer_id, size_t signer_id_len);
 int x509_req_get_details(const uint8_t *req, size_t reqlen,
@@ -73,6 +81,13 @@ int x509_req_print(FILE *fp, int fmt, int ind, const char *label, const uint8_t
 
 int x509_req_new_from_pem(uint8_t **req, size_t *reqlen, FILE *fp);
 int x509_req_new_from_file(uint8_t **req, size_t *reqlen, const char *file);
+int x509_req_sign_new(uint8_t **req, size_t *reqlen,
+	int version,
+	const uint8_t *subject, size_t subject_len,
+	const SM2_KEY *subject_public_key,
+	const uint8_t *attrs, size_t attrs_len,
+	int signature_algor,
+	const SM2_KEY *sign_key, const char *signer_id, size_t signer_id_len);
 
 
 #ifdef __cplusplus
@@ -0,0 +1,163 @@
+/*
+ *  Copyright 2014-2024 The GmSSL Project. All Rights Reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the License); you may
+ *  not use this file except in compliance with the License.
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+
+
+#ifndef GMSSL_X509_STORE_H
+#define GMSSL_X509_STORE_H
+
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <gmssl/sm2.h>
+#include <gmssl/x509_cer.h>
+#include <gmssl/x509_crl.h>
+
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+/*
+ * X509_TRUST_STORE is built once from a set of CA certificates and is read-only
+ * after x509_trust_store_init, so one store can be shared by many threads and
+ * TLS_CTXs. Certificates are indexed by the subject, the SubjectKeyIdentifier and
+ * the issuer and serial number. Each anchor keeps the parsed certificate and a
+ * SM2_VERIFY_CTX prepared with SM2_DEFAULT_ID, which is copied for every verify.
+ */
+typedef struct {
+	X509_CERT_VIEW view;
+	const uint8_t *subject_key_id;
+	size_t subject_key_id_len;
+	SM2_KEY public_key;
+	SM2_VERIFY_CTX verify_ctx;
+} X509_TRUST_ANCHOR;
+
+typedef struct {
+	uint8_t *certs;
+	size_t certs_len;
+	X509_TRUST_ANCHOR *anchors;
+	size_t anchors_cnt;
+	uint64_t generation; // random, changes with every built store
+	size_t index_mask;
+	// open addressing tables of anchor index + 1, 0 for empty slot
+	size_t *subject_index;
+	size_t *subject_key_id_index;
+	size_t *issuer_and_serial_number_index;
+} X509_TRUST_STORE;
+
+int x509_trust_store_init(X509_TRUST_STORE *store, const uint8_t *certs, size_t certslen);
+int x509_trust_store_init_from_file(X509_TRUST_STORE *store, const char *file); // PEM
+void x509_trust_store_cleanup(X509_TRUST_STORE *store);
+
+int x509_trust_store_get_by_subject(const X509_TRUST_STORE *store,
+	const uint8_t *subject, size_t subject_len, const X509_TRUST_ANCHOR **anchor);
+int x509_trust_store_get_by_subject_key_id(const X509_TRUST_STORE *store,
+	const uint8_t *keyid, size_t keyid_len, const X509_TRUST_ANCHOR **anchor);
+int x509_trust_store_get_by_issuer_and_serial_number(const X509_TRUST_STORE *store,
+	const uint8_t *issuer, size_t issuer_len, const uint8_t *serial, size_t serial_len,
+	const X509_TRUST_ANCHOR **anchor);
+int x509_trust_store_get_issuer(const X509_TRUST_STORE *store,
+	const X509_CERT_VIEW *cert, const X509_TRUST_ANCHOR **anchor);
+
+int x509_trust_anchor_verify(const X509_TRUST_ANCHOR *anchor, const X509_CERT_VIEW *cert,
+	const char *signer_id, size_t signer_id_len);
+
+int x509_certs_verify_by_trust_store(const uint8_t *certs, size_t certslen, int certs_type,
+	const X509_TRUST_STORE *store, int depth, int *verify_result);
+int x509_certs_verify_tlcp_by_trust_store(const uint8_t *certs, size_t certslen, int certs_type,
+	const X509_TRUST_STORE *store, int depth, int *verify_result);
+
+
+/*
+ * X509_VERIFY_CACHE is an opt-in cache of chain verify results. The key is the
+ * SM3 of the chain DER, the trust store generation and the verify options, an
+ * entry lives until the TTL or the earliest notAfter of the chain. Call
+ * x509_verify_cache_invalidate when CRLs are updated, a new trust store has a
+ * new generation and never hits the old entries. The cache is only locked with
+ * ENABLE_PTHREAD, without it a cache must not be used by more than one thread.
+ */
+#define X509_VERIFY_CACHE_WAYS	4
+
+typedef struct {
+	uint8_t key[32];
+	uint64_t generation;
+	time_t expires;
+	int result;
+} X509_VERIFY_CACHE_ENTRY;
+
+typedef struct {
+	X509_VERIFY_CACHE_ENTRY *entries; // (sets_mask + 1) sets of X509_VERIFY_CACHE_WAYS
+	size_t sets_mask;
+	time_t ttl;
+	uint64_t generation;
+	uint64_t hits;
+	uint64_t misses;
+	uint64_t evictions;
+	void *lock; // pthread_mutex_t with ENABLE_PTHREAD, the layout does not depend on it
+} X509_VERIFY_CACHE;
+
+int x509_verify_cache_init(X509_VERIFY_CACHE *cache, size_t max_entries, time_t ttl);
+void x509_verify_cache_invalidate(X509_VERIFY_CACHE *cache);
+void x509_verify_cache_get_stats(X509_VERIFY_CACHE *cache, uint64_t *hits, uint64_t *misses,
+	uint64_t *evictions);
+void x509_verify_cache_cleanup(X509_VERIFY_CACHE *cache);
+
+int x509_certs_verify_by_trust_store_cached(const uint8_t *certs, size_t certslen, int certs_type,
+	const X509_TRUST_STORE *store, int depth, X509_VERIFY_CACHE *cache, int *verify_result);
+int x509_certs_verify_tlcp_by_trust_store_cached(const uint8_t *certs, size_t certslen, int certs_type,
+	const X509_TRUST_STORE *store, int depth, X509_VERIFY_CACHE *cache, int *verify_result);
+
+
+/*
+ * Bulk verification of issued certificates, e.g. the audit of a CA archive. Each
+ * certificate is checked against its issuer in the trust store (signature,
+ * validity at verify_time and the CRL index of the issuer, if any). The items
+ * are grouped by issuer before the verification, so every prepared verify
+ * context is used for a run of certificates. The return value is 1 when all
+ * the items got a status, not when all the certificates are valid.
+ */
+enum {
+	X509_BULK_VERIFY_OK = 0,
+	X509_BULK_VERIFY_PARSE_ERROR,
+	X509_BULK_VERIFY_UNKNOWN_ISSUER,
+	X509_BULK_VERIFY_BAD_SIGNATURE,
+	X509_BULK_VERIFY_NOT_YET_VALID,
+	X509_BULK_VERIFY_EXPIRED,
+	X509_BULK_VERIFY_REVOKED,
+};
+
+#define X509_BULK_VERIFY_STATUS_CNT	(X509_BULK_VERIFY_REVOKED + 1)
+#define X509_BULK_VERIFY_MAX_THREADS	64
+
+typedef struct {
+	const uint8_t *cert;
+	size_t certlen;
+	int status;
+	time_t revoke_date; // -1 if not revoked
+	int revoke_reason; // -1 if not revoked or no reasonCode
+} X509_BULK_VERIFY_ITEM;
+
+const char *x509_bulk_verify_status_name(int status);
+
+int x509_certs_bulk_verify(const X509_TRUST_STORE *store,
+	const X509_CRL_INDEX *crl_indexes, size_t crl_indexes_cnt, time_t verify_time,
+	X509_BULK_VERIFY_ITEM *items, size_t items_cnt);
+#ifdef ENABLE_PTHREAD
+int x509_certs_bulk_verify_threads(const X509_TRUST_STORE *store,
+	const X509_CRL_INDEX *crl_indexes, size_t crl_indexes_cnt, time_t verify_time,
+	X509_BULK_VERIFY_ITEM *items, size_t items_cnt, int nthreads);
+#endif
+
+
+#ifdef __cplusplus
+}
+#endif
+#endif
@@ -51,6 +51,9 @@ typedef struct ZUC_MAC_CTX_st {
 	size_t buflen;
 } ZUC_MAC_CTX;
 
+// MAC of a 32-bit message word M with the 64-bit keystream window K0||K1
+ZUC_UINT32 zuc_eia_word(ZUC_UINT32 K0, ZUC_UINT32 K1, ZUC_UINT32 M);
+
 void zuc_mac_init(ZUC_MAC_CTX *ctx, const uint8_t key[ZUC_KEY_SIZE], const uint8_t iv[ZUC_IV_SIZE]);
 void zuc_mac_update(ZUC_MAC_CTX *ctx, const uint8_t *data, size_t len);
 void zuc_mac_finish(ZUC_MAC_CTX *ctx, const uint8_t *data, size_t nbits, uint8_t mac[ZUC_MAC_SIZE]);
@@ -64,6 +67,56 @@ ZUC_UINT32 zuc_eia_generate_mac(const ZUC_UINT32 *data, size_t nbits,
 	const uint8_t key[ZUC_KEY_SIZE], ZUC_UINT32 count, ZUC_UINT5 bearer,
 	ZUC_BIT direction);
 
+// EEA3 and EIA3 in one pass, return the EIA3 MAC of the plaintext (`in` when encrypt, `out` when decrypt)
+ZUC_UINT32 zuc_eea_eia_encrypt(const ZUC_UINT32 *in, ZUC_UINT32 *out, size_t nbits,
+	const uint8_t eea_key[ZUC_KEY_SIZE], const uint8_t eia_key[ZUC_KEY_SIZE],
+	ZUC_UINT32 count, ZUC_UINT5 bearer, ZUC_BIT direction);
+ZUC_UINT32 zuc_eea_eia_decrypt(const ZUC_UINT32 *in, ZUC_UINT32 *out, size_t nbits,
+	const uint8_t eea_key[ZUC_KEY_SIZE], const uint8_t eia_key[ZUC_KEY_SIZE],
+	ZUC_UINT32 count, ZUC_UINT5 bearer, ZUC_BIT direction);
+
+
+/*
+ * 8-lane ZUC, each lane is an independent ZUC state.
+ * LFSR[i][j] is the i-th LFSR cell of lane j, keystream words are output
+ * as words[i][j] for the i-th word of lane j.
+ */
+#define ZUC_X8_LANES	8
+
+typedef struct {
+	ZUC_UINT31 LFSR[16][ZUC_X8_LANES];
+	ZUC_UINT32 R1[ZUC_X8_LANES];
+	ZUC_UINT32 R2[ZUC_X8_LANES];
+} ZUC_X8_STATE;
+
+// only lanes with bit j of `lanes` set are initialized, `key[j]` and `iv[j]` of other lanes are not used
+void zuc_x8_init(ZUC_X8_STATE *state, unsigned int lanes,
+	const uint8_t *key[ZUC_X8_LANES], const uint8_t *iv[ZUC_X8_LANES]);
+void zuc_x8_generate_keystream(ZUC_X8_STATE *state, size_t nwords, ZUC_UINT32 (*words)[ZUC_X8_LANES]);
+
+
+/*
+ * Batch EEA3/EIA3 over many bearers, jobs of mixed types and lengths are
+ * scheduled on the ZUC_X8_STATE lanes, a new job is loaded into a lane as
+ * soon as the previous one is finished.
+ */
+#define ZUC_JOB_EEA3	1
+#define ZUC_JOB_EIA3	2
+
+typedef struct {
+	int type;
+	const uint8_t *key;
+	ZUC_UINT32 count;
+	ZUC_UINT5 bearer;
+	ZUC_BIT direction;
+	const ZUC_UINT32 *in;
+	size_t nbits;
+	ZUC_UINT32 *out; // ZUC_EEA_ENCRYPT_NWORDS(nbits) words of EEA3 output
+	ZUC_UINT32 mac; // EIA3 output
+} ZUC_JOB;
+
+int zuc_process_jobs(ZUC_JOB *jobs, size_t njobs);
+
 
 # define ZUC256_KEY_SIZE	32
 # define ZUC256_IV_SIZE		23
@@ -1944,3 +1944,115 @@ int asn1_length_le(size_t len1, size_t len2)
 	}
 	return 1;
 }
+
+// 0x82 and 2 octets, enough for most certificates and CMS messages
+#define ASN1_WRITER_LENGTH_SIZE	3
+
+int asn1_writer_init(ASN1_WRITER *w, size_t maxlen)
+{
+	if (!w) {
+		error_print();
+		return -1;
+	}
+	if (maxlen < 256) {
+		maxlen = 256;
+	}
+	if (!(w->buf = (uint8_t *)malloc(maxlen))) {
+		error_print();
+		return -1;
+	}
+	w->maxlen = maxlen;
+	w->p = w->buf;
+	w->len = 0;
+	return 1;
+}
+
+int asn1_writer_reserve(ASN1_WRITER *w, size_t len)
+{
+	size_t maxlen;
+	uint8_t *buf;
+
+	// a writer not initialized by asn1_writer_init never grows
+	if (!w || !w->buf || !w->maxlen) {
+		error_print();
+		return -1;
+	}
+	if (w->maxlen - w->len >= len) {
+		return 1;
+	}
+	maxlen = w->maxlen;
+	while (maxlen - w->len < len) {
+		if (maxlen > INT_MAX) {
+			error_print();
+			return -1;
+		}
+		maxlen *= 2;
+	}
+	if (!(buf = (uint8_t *)realloc(w->buf, maxlen))) {
+		error_print();
+		return -1;
+	}
+	w->buf = buf;
+	w->maxlen = maxlen;
+	w->p = w->buf + w->len;
+	return 1;
+}
+
+int asn1_writer_begin(ASN1_WRITER *w, int tag, size_t *pos)
+{
+	if (asn1_writer_reserve(w, 1 + ASN1_WRITER_LENGTH_SIZE) != 1) {
+		error_print();
+		return -1;
+	}
+	*(w->p) = (uint8_t)tag;
+	w->p += 1 + ASN1_WRITER_LENGTH_SIZE;
+	w->len += 1 + ASN1_WRITER_LENGTH_SIZE;
+	*pos = w->len;
+	return 1;
+}
+
+int asn1_writer_end(ASN1_WRITER *w, size_t pos)
+{
+	uint8_t header[8];
+	uint8_t *p = header;
+	size_t header_len = 0;
+	size_t dlen;
+
+	if (pos < ASN1_WRITER_LENGTH_SIZE || pos > w->len) {
+		error_print();
+		return -1;
+	}
+	dlen = w->len - pos;
+	if (asn1_length_to_der(dlen, &p, &header_len) != 1) {
+		error_print();
+		return -1;
+	}
+	if (header_len != ASN1_WRITER_LENGTH_SIZE) {
+		if (header_len > ASN1_WRITER_LENGTH_SIZE
+			&& asn1_writer_reserve(w, header_len - ASN1_WRITER_LENGTH_SIZE) != 1) {
+			error_print();
+			return -1;
+		}
+		memmove(w->buf + pos - ASN1_WRITER_LENGTH_SIZE + header_len, w->buf + pos, dlen);
+		w->len = w->len - ASN1_WRITER_LENGTH_SIZE + header_len;
+		w->p = w->buf + w->len;
+	}
+	memcpy(w->buf + pos - ASN1_WRITER_LENGTH_SIZE, header, header_len);
+	return 1;
+}
+
+void asn1_writer_reset(ASN1_WRITER *w)
+{
+	w->p = w->buf;
+	w->len = 0;
+}
+
+void asn1_writer_cleanup(ASN1_WRITER *w)
+{
+	if (w) {
+		if (w->buf) {
+			free(w->buf);
+		}
+		memset(w, 0, sizeof(*w));
+	}
+}
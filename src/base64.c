@@ -15,6 +15,11 @@
 #include <assert.h>
 #include <gmssl/base64.h>
 #include <gmssl/error.h>
+#if defined(ENABLE_BASE64_AVX2)
+#include <immintrin.h>
+#elif defined(ENABLE_BASE64_NEON)
+#include <arm_neon.h>
+#endif
 
 static unsigned char conv_ascii2bin(unsigned char a);
 #define conv_bin2ascii(a)       (data_bin2ascii[(a)&0x3f])
@@ -77,6 +82,227 @@ static unsigned char conv_ascii2bin(unsigned char a)
     return data_ascii2bin[a];
 }
 
+/*
+ * Full line kernels. A 64 char line is decoded only when all the chars are in
+ * the alphabet, lines with padding, whitespace or errors are left to the
+ * generic code.
+ */
+static const unsigned char data_ascii2bin_strict[128] = {
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x3E, 0xFF, 0xFF, 0xFF, 0x3F,
+    0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x3A, 0x3B,
+    0x3C, 0x3D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06,
+    0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E,
+    0x0F, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16,
+    0x17, 0x18, 0x19, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x1A, 0x1B, 0x1C, 0x1D, 0x1E, 0x1F, 0x20,
+    0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28,
+    0x29, 0x2A, 0x2B, 0x2C, 0x2D, 0x2E, 0x2F, 0x30,
+    0x31, 0x32, 0x33, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+};
+
+#if defined(ENABLE_BASE64_AVX2)
+
+// 24 bytes to 32 chars, bytes 0..11 in the low lane and 12..23 in the high lane
+static inline __m256i base64_encode_avx2(const uint8_t in[24])
+{
+    const __m256i shuf = _mm256_setr_epi8(
+        1, 0, 2, 1, 4, 3, 5, 4, 7, 6, 8, 7, 10, 9, 11, 10,
+        5, 4, 6, 5, 8, 7, 9, 8, 11, 10, 12, 11, 14, 13, 15, 14);
+    const __m256i shift_lut = _mm256_setr_epi8(
+        'a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+        '0' - 52, '0' - 52, '0' - 52, '+' - 62, '/' - 63, 'A', 0, 0,
+        'a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+        '0' - 52, '0' - 52, '0' - 52, '+' - 62, '/' - 63, 'A', 0, 0);
+    __m256i v, t0, t1, idx, r;
+
+    v = _mm256_inserti128_si256(
+        _mm256_castsi128_si256(_mm_loadu_si128((const __m128i *)in)),
+        _mm_loadu_si128((const __m128i *)(in + 8)), 1);
+    v = _mm256_shuffle_epi8(v, shuf);
+
+    // split every 3 bytes into four 6-bit indexes
+    t0 = _mm256_and_si256(v, _mm256_set1_epi32(0x0fc0fc00));
+    t0 = _mm256_mulhi_epu16(t0, _mm256_set1_epi32(0x04000040));
+    t1 = _mm256_and_si256(v, _mm256_set1_epi32(0x003f03f0));
+    t1 = _mm256_mullo_epi16(t1, _mm256_set1_epi32(0x01000010));
+    idx = _mm256_or_si256(t0, t1);
+
+    // 0..25 => 13, 26..51 => 0, 52..63 => 1..12
+    r = _mm256_subs_epu8(idx, _mm256_set1_epi8(51));
+    r = _mm256_or_si256(r, _mm256_and_si256(
+        _mm256_cmpgt_epi8(_mm256_set1_epi8(26), idx), _mm256_set1_epi8(13)));
+    return _mm256_add_epi8(idx, _mm256_shuffle_epi8(shift_lut, r));
+}
+
+// 32 chars to 24 bytes, return 0 if any char is not in the alphabet
+static inline int base64_decode_avx2(uint8_t out[24], const uint8_t in[32])
+{
+    const __m256i lut_lo = _mm256_setr_epi8(
+        0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+        0x11, 0x11, 0x13, 0x1A, 0x1B, 0x1B, 0x1B, 0x1A,
+        0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+        0x11, 0x11, 0x13, 0x1A, 0x1B, 0x1B, 0x1B, 0x1A);
+    const __m256i lut_hi = _mm256_setr_epi8(
+        0x10, 0x10, 0x01, 0x02, 0x04, 0x08, 0x04, 0x08,
+        0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+        0x10, 0x10, 0x01, 0x02, 0x04, 0x08, 0x04, 0x08,
+        0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10);
+    const __m256i lut_roll = _mm256_setr_epi8(
+        0, 16, 19, 4, -65, -65, -71, -71, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 16, 19, 4, -65, -65, -71, -71, 0, 0, 0, 0, 0, 0, 0, 0);
+    const __m256i mask_0f = _mm256_set1_epi8(0x0f);
+    const __m256i slash = _mm256_set1_epi8(0x2f);
+    const __m256i pack = _mm256_setr_epi8(
+        2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1,
+        2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1);
+    __m256i v, hi, lo, roll;
+
+    v = _mm256_loadu_si256((const __m256i *)in);
+    hi = _mm256_and_si256(_mm256_srli_epi32(v, 4), mask_0f);
+    lo = _mm256_and_si256(v, mask_0f);
+    if (!_mm256_testz_si256(_mm256_shuffle_epi8(lut_lo, lo), _mm256_shuffle_epi8(lut_hi, hi))) {
+        return 0;
+    }
+
+    roll = _mm256_shuffle_epi8(lut_roll, _mm256_add_epi8(_mm256_cmpeq_epi8(v, slash), hi));
+    v = _mm256_add_epi8(v, roll);
+    v = _mm256_maddubs_epi16(v, _mm256_set1_epi32(0x01400140));
+    v = _mm256_madd_epi16(v, _mm256_set1_epi32(0x00011000));
+    v = _mm256_shuffle_epi8(v, pack);
+    v = _mm256_permutevar8x32_epi32(v, _mm256_setr_epi32(0, 1, 2, 4, 5, 6, 7, 7));
+
+    _mm_storeu_si128((__m128i *)out, _mm256_castsi256_si128(v));
+    _mm_storel_epi64((__m128i *)(out + 16), _mm256_extracti128_si256(v, 1));
+    return 1;
+}
+
+static void base64_encode_48(unsigned char out[64], const unsigned char in[48])
+{
+    _mm256_storeu_si256((__m256i *)out, base64_encode_avx2(in));
+    _mm256_storeu_si256((__m256i *)(out + 32), base64_encode_avx2(in + 24));
+}
+
+static int base64_decode_64(unsigned char out[48], const unsigned char in[64])
+{
+    if (base64_decode_avx2(out, in) != 1
+        || base64_decode_avx2(out + 24, in + 32) != 1) {
+        return 0;
+    }
+    return 1;
+}
+
+#elif defined(ENABLE_BASE64_NEON)
+
+static void base64_encode_48(unsigned char out[64], const unsigned char in[48])
+{
+    const uint8x16_t mask = vdupq_n_u8(0x3f);
+    uint8x16x4_t tbl;
+    uint8x16x3_t v;
+    uint8x16x4_t r;
+
+    tbl.val[0] = vld1q_u8(data_bin2ascii);
+    tbl.val[1] = vld1q_u8(data_bin2ascii + 16);
+    tbl.val[2] = vld1q_u8(data_bin2ascii + 32);
+    tbl.val[3] = vld1q_u8(data_bin2ascii + 48);
+
+    v = vld3q_u8(in);
+    r.val[0] = vshrq_n_u8(v.val[0], 2);
+    r.val[1] = vandq_u8(vorrq_u8(vshlq_n_u8(v.val[0], 4), vshrq_n_u8(v.val[1], 4)), mask);
+    r.val[2] = vandq_u8(vorrq_u8(vshlq_n_u8(v.val[1], 2), vshrq_n_u8(v.val[2], 6)), mask);
+    r.val[3] = vandq_u8(v.val[2], mask);
+
+    r.val[0] = vqtbl4q_u8(tbl, r.val[0]);
+    r.val[1] = vqtbl4q_u8(tbl, r.val[1]);
+    r.val[2] = vqtbl4q_u8(tbl, r.val[2]);
+    r.val[3] = vqtbl4q_u8(tbl, r.val[3]);
+    vst4q_u8(out, r);
+}
+
+static int base64_decode_64(unsigned char out[48], const unsigned char in[64])
+{
+    const uint8x16_t offset = vdupq_n_u8(64);
+    uint8x16x4_t tbl_lo, tbl_hi;
+    uint8x16x4_t v;
+    uint8x16x3_t r;
+    uint8x16_t err = vdupq_n_u8(0);
+    int i;
+
+    tbl_lo.val[0] = vld1q_u8(data_ascii2bin_strict);
+    tbl_lo.val[1] = vld1q_u8(data_ascii2bin_strict + 16);
+    tbl_lo.val[2] = vld1q_u8(data_ascii2bin_strict + 32);
+    tbl_lo.val[3] = vld1q_u8(data_ascii2bin_strict + 48);
+    tbl_hi.val[0] = vld1q_u8(data_ascii2bin_strict + 64);
+    tbl_hi.val[1] = vld1q_u8(data_ascii2bin_strict + 80);
+    tbl_hi.val[2] = vld1q_u8(data_ascii2bin_strict + 96);
+    tbl_hi.val[3] = vld1q_u8(data_ascii2bin_strict + 112);
+
+    v = vld4q_u8(in);
+    for (i = 0; i < 4; i++) {
+        uint8x16_t x = v.val[i];
+        // chars >= 0x80 are out of both tables and caught by the high bit of x
+        v.val[i] = vqtbx4q_u8(vqtbl4q_u8(tbl_lo, x), tbl_hi, vsubq_u8(x, offset));
+        err = vorrq_u8(err, vorrq_u8(v.val[i], x));
+    }
+    if (vmaxvq_u8(err) & 0x80) {
+        return 0;
+    }
+
+    r.val[0] = vorrq_u8(vshlq_n_u8(v.val[0], 2), vshrq_n_u8(v.val[1], 4));
+    r.val[1] = vorrq_u8(vshlq_n_u8(v.val[1], 4), vshrq_n_u8(v.val[2], 2));
+    r.val[2] = vorrq_u8(vshlq_n_u8(v.val[2], 6), v.val[3]);
+    vst3q_u8(out, r);
+    return 1;
+}
+
+#else
+
+static void base64_encode_48(unsigned char out[64], const unsigned char in[48])
+{
+    unsigned long l;
+    int i;
+
+    for (i = 0; i < 16; i++) {
+        l = (((unsigned long)in[0]) << 16L) |
+            (((unsigned long)in[1]) << 8L) | in[2];
+        out[0] = conv_bin2ascii(l >> 18L);
+        out[1] = conv_bin2ascii(l >> 12L);
+        out[2] = conv_bin2ascii(l >> 6L);
+        out[3] = conv_bin2ascii(l);
+        in += 3;
+        out += 4;
+    }
+}
+
+static int base64_decode_64(unsigned char out[48], const unsigned char in[64])
+{
+    unsigned char v[64];
+    unsigned char err = 0;
+    int i;
+
+    for (i = 0; i < 64; i++) {
+        v[i] = data_ascii2bin_strict[in[i] & 0x7f];
+        err |= v[i] | (in[i] & 0x80);
+    }
+    if (err & 0x80) {
+        return 0;
+    }
+    for (i = 0; i < 64; i += 4) {
+        out[0] = (unsigned char)((v[i] << 2) | (v[i + 1] >> 4));
+        out[1] = (unsigned char)((v[i + 1] << 4) | (v[i + 2] >> 2));
+        out[2] = (unsigned char)((v[i + 2] << 6) | v[i + 3]);
+        out += 3;
+    }
+    return 1;
+}
+
+#endif
+
 
 int base64_ctx_num(BASE64_CTX *ctx)
 {
@@ -156,6 +382,14 @@ int base64_encode_block(unsigned char *t, const unsigned char *f, int dlen)
     int i, ret = 0;
     unsigned long l;
 
+    while (dlen >= 48) {
+        base64_encode_48(t, f);
+        t += 64;
+        f += 48;
+        dlen -= 48;
+        ret += 64;
+    }
+
     for (i = dlen; i > 0; i -= 3) {
         if (i >= 3) {
             l = (((unsigned long)f[0]) << 16L) |
@@ -232,6 +466,14 @@ int base64_decode_update(BASE64_CTX *ctx, const uint8_t *in, int inl, uint8_t *o
     }
 
     for (i = 0; i < inl; i++) {
+        // whole line of alphabet chars, no need to go through the buffer
+        if (n == 0 && eof == 0 && inl - i >= 64 && base64_decode_64(out, in) == 1) {
+            in += 64;
+            out += 48;
+            ret += 48;
+            i += 63;
+            continue;
+        }
         tmp = *(in++);
         v = conv_ascii2bin(tmp);
         if (v == B64_ERROR) {
@@ -341,6 +583,13 @@ int base64_decode_block(unsigned char *t, const unsigned char *f, int n)
     if (n % 4 != 0)
         return (-1);
 
+    while (n >= 64 && base64_decode_64(t, f) == 1) {
+        t += 48;
+        f += 64;
+        n -= 64;
+        ret += 48;
+    }
+
     for (i = 0; i < n; i += 4) {
         a = conv_ascii2bin(*(f++));
         b = conv_ascii2bin(*(f++));
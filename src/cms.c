@@ -24,6 +24,7 @@
 #include <gmssl/x509_ext.h>
 #include <gmssl/x509_crl.h>
 #include <gmssl/rand.h>
+#include <gmssl/mem.h>
 #include <gmssl/pem.h>
 #include <gmssl/cms.h>
 
@@ -752,12 +753,17 @@ int cms_signer_info_sign_to_der(
 	uint8_t sig[SM2_MAX_SIGNATURE_SIZE];
 	size_t siglen = SM2_signature_typical_size;
 
-	sm3_update(&ctx, authed_attrs, authed_attrs_len);
-	sm3_finish(&ctx, dgst);
+	// the signature has a fixed length, the length only pass does not sign
+	if (out && *out) {
+		sm3_update(&ctx, authed_attrs, authed_attrs_len);
+		sm3_finish(&ctx, dgst);
 
-	if (sm2_sign_fixlen(sign_key, dgst, siglen, sig) != 1) {
-		error_print();
-		return -1;
+		if (sm2_sign_fixlen(sign_key, dgst, siglen, sig) != 1) {
+			error_print();
+			return -1;
+		}
+	} else {
+		memset(sig, 0, siglen);
 	}
 	if (cms_signer_info_to_der(CMS_version_v1,
 		issuer, issuer_len, serial_number, serial_number_len,
@@ -784,6 +790,7 @@ int cms_signer_info_verify_from_der(
 	int signature_algor;
 	const uint8_t *sig;
 	size_t siglen;
+	X509_CERT_VIEW view;
 	SM2_KEY public_key;
 	SM3_CTX sm3_ctx = *ctx;
 	uint8_t dgst[32];
@@ -801,12 +808,14 @@ int cms_signer_info_verify_from_der(
 		error_print();
 		return -1;
 	}
-	if (x509_certs_get_cert_by_issuer_and_serial_number(certs, certslen,
-			*issuer, *issuer_len, *serial, *serial_len, cert, certlen) != 1
-		|| x509_cert_get_subject_public_key(*cert, *certlen, &public_key) != 1) {
+	if (x509_certs_get_cert_view_by_issuer_and_serial_number(certs, certslen,
+			*issuer, *issuer_len, *serial, *serial_len, &view) != 1
+		|| x509_cert_view_get_subject_public_key(&view, &public_key) != 1) {
 		error_print();
 		return -1;
 	}
+	*cert = view.cert;
+	*certlen = view.cert_len;
 
 	sm3_update(&sm3_ctx, *authed_attrs, *authed_attrs_len);
 	sm3_finish(&sm3_ctx, dgst);
@@ -1099,7 +1108,7 @@ int cms_signed_data_sign_to_der(
 				&issuer, &issuer_len, &serial, &serial_len) != 1
 			|| cms_signer_infos_add_signer_info(
 				signer_infos, &signer_infos_len, sizeof(signer_infos),
-				&sm3_ctx, signers->sign_key,
+				&sm3_ctx, signers[i].sign_key,
 				issuer, issuer_len, serial, serial_len,
 				NULL, 0, NULL, 0) != 1) {
 			error_print();
@@ -1519,27 +1528,20 @@ int cms_enveloped_data_encrypt_to_der(
 	size_t len = 0;
 
 	while (rcpt_certs_len) {
-		const uint8_t *cert;
-		size_t certlen;
+		X509_CERT_VIEW view;
 		SM2_KEY public_key;
-		const uint8_t *issuer;
-		size_t issuer_len;
-		const uint8_t *serial;
-		size_t serial_len;
 
-		if (asn1_any_from_der(&cert, &certlen, &rcpt_certs, &rcpt_certs_len) != 1
-			|| x509_cert_get_issuer_and_serial_number(cert, certlen,
-				&issuer, &issuer_len, &serial, &serial_len) != 1
-			|| x509_cert_get_subject_public_key(cert, certlen, &public_key) != 1) {
+		if (x509_cert_view_from_der(&view, &rcpt_certs, &rcpt_certs_len) != 1
+			|| x509_cert_view_get_subject_public_key(&view, &public_key) != 1) {
 			error_print();
 			return -1;
 		}
 		if (cms_recipient_info_encrypt_to_der(&public_key,
-				issuer, issuer_len, serial, serial_len,
+				view.issuer, view.issuer_len, view.serial_number, view.serial_number_len,
 				key, keylen, NULL, &len) != 1
 			|| asn1_length_le(len, sizeof(rcpt_infos)) != 1
 			|| cms_recipient_info_encrypt_to_der(&public_key,
-				issuer, issuer_len, serial, serial_len,
+				view.issuer, view.issuer_len, view.serial_number, view.serial_number_len,
 				key, keylen, &p, &rcpt_infos_len) != 1) {
 			error_print();
 			return -1;
@@ -1766,20 +1768,17 @@ int cms_signed_and_enveloped_data_encipher_to_der(
 
 	p = rcpt_infos;
 	while (rcpt_certs_len) {
-		const uint8_t *cert;
-		size_t certlen;
+		X509_CERT_VIEW view;
 		SM2_KEY public_key;
 
-		if (asn1_any_from_der(&cert, &certlen, &rcpt_certs, &rcpt_certs_len) != 1
-			|| x509_cert_get_issuer_and_serial_number(cert, certlen,
-				&issuer, &issuer_len, &serial, &serial_len) != 1
-			|| x509_cert_get_subject_public_key(cert, certlen, &public_key) != 1
+		if (x509_cert_view_from_der(&view, &rcpt_certs, &rcpt_certs_len) != 1
+			|| x509_cert_view_get_subject_public_key(&view, &public_key) != 1
 			|| cms_recipient_info_encrypt_to_der(&public_key,
-				issuer, issuer_len, serial, serial_len,
+				view.issuer, view.issuer_len, view.serial_number, view.serial_number_len,
 				key, keylen, NULL, &len) != 1
 			|| asn1_length_le(len, sizeof(rcpt_infos)) != 1
 			|| cms_recipient_info_encrypt_to_der(&public_key,
-				issuer, issuer_len, serial, serial_len,
+				view.issuer, view.issuer_len, view.serial_number, view.serial_number_len,
 				key, keylen, &p, &rcpt_infos_len) != 1) {
 			error_print();
 			return -1;
@@ -2129,40 +2128,122 @@ int cms_decrypt(const uint8_t *cms, size_t cmslen,
 	return 1;
 }
 
-int cms_sign(uint8_t *cms, size_t *cmslen,
+int cms_sign_to_writer(
 	const CMS_CERTS_AND_KEY *signers, size_t signers_cnt,
 	int content_type, const uint8_t *content, size_t content_len,
-	const uint8_t *crls, size_t crls_len)
+	const uint8_t *crls, size_t crls_len,
+	ASN1_WRITER *w)
 {
-	int oid = OID_cms_signed_data;
+	int digest_algors[] = { OID_sm3 };
+	size_t digest_algors_cnt = sizeof(digest_algors)/sizeof(int);
+	size_t content_info_pos, explicit_pos, signed_data_pos, certs_pos, signer_infos_pos;
+	size_t content_offset;
 	size_t len = 0;
+	SM3_CTX sm3_ctx;
+	const uint8_t *issuer;
+	size_t issuer_len;
+	const uint8_t *serial;
+	size_t serial_len;
+	size_t i;
 
-	if (cms_signed_data_sign_to_der(
-		signers, signers_cnt,
-		content_type, content, content_len,
-		crls, crls_len,
-		NULL, &len) != 1) {
+	if (asn1_writer_begin(w, ASN1_TAG_SEQUENCE, &content_info_pos) != 1
+		|| cms_content_type_to_der(OID_cms_signed_data, NULL, &len) != 1
+		|| asn1_writer_reserve(w, len) != 1
+		|| cms_content_type_to_der(OID_cms_signed_data, &w->p, &w->len) != 1
+		|| asn1_writer_begin(w, ASN1_TAG_EXPLICIT(0), &explicit_pos) != 1
+		|| asn1_writer_begin(w, ASN1_TAG_SEQUENCE, &signed_data_pos) != 1) {
 		error_print();
 		return -1;
 	}
-	*cmslen = 0;
-	if (!cms) {
-		uint8_t data[1];
-		if (cms_content_info_to_der(oid, data, len, NULL, cmslen) != 1) {
+	len = 0;
+	if (asn1_int_to_der(CMS_version_v1, NULL, &len) != 1
+		|| cms_digest_algors_to_der(digest_algors, digest_algors_cnt, NULL, &len) != 1
+		|| cms_content_info_to_der(content_type, content, content_len, NULL, &len) != 1
+		|| asn1_writer_reserve(w, len) != 1
+		|| asn1_int_to_der(CMS_version_v1, &w->p, &w->len) != 1
+		|| cms_digest_algors_to_der(digest_algors, digest_algors_cnt, &w->p, &w->len) != 1) {
+		error_print();
+		return -1;
+	}
+
+	// the digest is over the encoded encapsulated ContentInfo
+	content_offset = w->len;
+	if (cms_content_info_to_der(content_type, content, content_len, &w->p, &w->len) != 1) {
+		error_print();
+		return -1;
+	}
+	sm3_init(&sm3_ctx);
+	sm3_update(&sm3_ctx, w->buf + content_offset, w->len - content_offset);
+
+	if (asn1_writer_begin(w, ASN1_TAG_EXPLICIT(0), &certs_pos) != 1) {
+		error_print();
+		return -1;
+	}
+	for (i = 0; i < signers_cnt; i++) {
+		if (asn1_writer_reserve(w, signers[i].certs_len) != 1
+			|| asn1_data_to_der(signers[i].certs, signers[i].certs_len, &w->p, &w->len) != 1) {
 			error_print();
 			return -1;
 		}
-		return 1;
 	}
-	if (cms_content_info_header_to_der(oid, len, &cms, cmslen) != 1
-		|| cms_signed_data_sign_to_der(
-			signers, signers_cnt,
-			content_type, content, content_len,
-			crls, crls_len,
-			&cms, cmslen) != 1) {
+	len = 0;
+	if (asn1_writer_end(w, certs_pos) != 1
+		|| asn1_implicit_set_to_der(1, crls, crls_len, NULL, &len) < 0
+		|| asn1_writer_reserve(w, len) != 1
+		|| asn1_implicit_set_to_der(1, crls, crls_len, &w->p, &w->len) < 0
+		|| asn1_writer_begin(w, ASN1_TAG_SET, &signer_infos_pos) != 1) {
+		error_print();
+		return -1;
+	}
+	for (i = 0; i < signers_cnt; i++) {
+		len = 0;
+		if (x509_cert_get_issuer_and_serial_number(
+				signers[i].certs, signers[i].certs_len,
+				&issuer, &issuer_len, &serial, &serial_len) != 1
+			|| cms_signer_info_sign_to_der(&sm3_ctx, signers[i].sign_key,
+				issuer, issuer_len, serial, serial_len,
+				NULL, 0, NULL, 0, NULL, &len) != 1
+			|| asn1_writer_reserve(w, len) != 1
+			|| cms_signer_info_sign_to_der(&sm3_ctx, signers[i].sign_key,
+				issuer, issuer_len, serial, serial_len,
+				NULL, 0, NULL, 0, &w->p, &w->len) != 1) {
+			error_print();
+			return -1;
+		}
+	}
+	if (asn1_writer_end(w, signer_infos_pos) != 1
+		|| asn1_writer_end(w, signed_data_pos) != 1
+		|| asn1_writer_end(w, explicit_pos) != 1
+		|| asn1_writer_end(w, content_info_pos) != 1) {
+		error_print();
+		return -1;
+	}
+	return 1;
+}
+
+int cms_sign(uint8_t *cms, size_t *cmslen,
+	const CMS_CERTS_AND_KEY *signers, size_t signers_cnt,
+	int content_type, const uint8_t *content, size_t content_len,
+	const uint8_t *crls, size_t crls_len)
+{
+	ASN1_WRITER w;
+
+	if (asn1_writer_init(&w, 0) != 1) {
+		error_print();
+		return -1;
+	}
+	if (cms_sign_to_writer(signers, signers_cnt,
+		content_type, content, content_len,
+		crls, crls_len, &w) != 1) {
+		asn1_writer_cleanup(&w);
 		error_print();
 		return -1;
 	}
+	if (cms) {
+		memcpy(cms, w.buf, w.len);
+	}
+	*cmslen = w.len;
+	asn1_writer_cleanup(&w);
 	return 1;
 }
 
@@ -2265,6 +2346,7 @@ int cms_deenvelop(const uint8_t *cms, size_t cmslen,
 	size_t issuer_len;
 	const uint8_t *serial;
 	size_t serial_len;
+	X509_CERT_VIEW view;
 	SM2_KEY public_key;
 
 	if (cms_content_info_from_der(&cms_type, &cms_content, &cms_content_len, &cms, &cmslen) != 1
@@ -2275,13 +2357,15 @@ int cms_deenvelop(const uint8_t *cms, size_t cmslen,
 		return -1;
 	}
 
-	if (x509_cert_get_issuer_and_serial_number(rcpt_cert, rcpt_cert_len,
-			&issuer, &issuer_len, &serial, &serial_len) != 1
-		|| x509_cert_get_subject_public_key(rcpt_cert, rcpt_cert_len,
-			&public_key) != 1) {
+	if (x509_cert_view_init(&view, rcpt_cert, rcpt_cert_len) != 1
+		|| x509_cert_view_get_subject_public_key(&view, &public_key) != 1) {
 		error_print();
 		return -1;
 	}
+	issuer = view.issuer;
+	issuer_len = view.issuer_len;
+	serial = view.serial_number;
+	serial_len = view.serial_number_len;
 	if (memcmp(&public_key, rcpt_key, sizeof(SM2_POINT)) != 0) {
 		error_print();
 		return -1;
@@ -2366,6 +2450,7 @@ int cms_deenvelop_and_verify(const uint8_t *cms, size_t cmslen,
 	size_t rcpt_issuer_len;
 	const uint8_t *rcpt_serial;
 	size_t rcpt_serial_len;
+	X509_CERT_VIEW view;
 	SM2_KEY public_key;
 	int cms_type;
 	const uint8_t *cms_content;
@@ -2379,14 +2464,15 @@ int cms_deenvelop_and_verify(const uint8_t *cms, size_t cmslen,
 		return -1;
 	}
 
-	if (x509_cert_get_issuer_and_serial_number(rcpt_cert, rcpt_cert_len,
-			&rcpt_issuer, &rcpt_issuer_len,
-			&rcpt_serial, &rcpt_serial_len) != 1
-		|| x509_cert_get_subject_public_key(rcpt_cert, rcpt_cert_len,
-			&public_key) != 1) {
+	if (x509_cert_view_init(&view, rcpt_cert, rcpt_cert_len) != 1
+		|| x509_cert_view_get_subject_public_key(&view, &public_key) != 1) {
 		error_print();
 		return -1;
 	}
+	rcpt_issuer = view.issuer;
+	rcpt_issuer_len = view.issuer_len;
+	rcpt_serial = view.serial_number;
+	rcpt_serial_len = view.serial_number_len;
 	if (memcmp(&public_key, rcpt_key, sizeof(SM2_POINT)) != 0) {
 		error_print();
 		return -1;
@@ -2445,6 +2531,1107 @@ int cms_set_key_agreement_info(
 	return 1;
 }
 
+/*
+Streaming SignedData and EnvelopedData
+
+The decoders parse the BER headers and the small elements (RecipientInfos,
+certificates, SignerInfos) from the reader buffer, the content OCTET STRING
+chunks are passed through without buffering.
+*/
+
+enum {
+	CMS_STREAM_PREFIX = 0,
+	CMS_STREAM_CHUNK_HEADER,
+	CMS_STREAM_CHUNK,
+	CMS_STREAM_TRAILER,
+	CMS_STREAM_DONE,
+};
+
+static int cms_ber_indefinite_header_to_der(int tag, uint8_t **out, size_t *outlen)
+{
+	if (out && *out) {
+		*(*out)++ = (uint8_t)tag;
+		*(*out)++ = 0x80;
+	}
+	(*outlen) += 2;
+	return 1;
+}
+
+static int cms_ber_end_of_contents_to_der(size_t cnt, uint8_t **out, size_t *outlen)
+{
+	if (out && *out) {
+		memset(*out, 0, cnt * 2);
+		(*out) += cnt * 2;
+	}
+	(*outlen) += cnt * 2;
+	return 1;
+}
+
+// return 0 if more input is needed
+static int cms_ber_any_header_from_der(int *tag, size_t *len, int *indefinite, size_t *hdrlen,
+	const uint8_t *in, size_t inlen)
+{
+	size_t nbytes;
+	size_t i;
+
+	if (inlen < 2) {
+		return 0;
+	}
+	if ((in[0] & 0x1f) == 0x1f) {
+		error_print();
+		return -1;
+	}
+	*tag = in[0];
+
+	if (in[1] < 0x80) {
+		*len = in[1];
+		*indefinite = 0;
+		*hdrlen = 2;
+		return 1;
+	}
+	if (in[1] == 0x80) {
+		if (!(in[0] & ASN1_TAG_CONSTRUCTED)) {
+			error_print();
+			return -1;
+		}
+		*len = 0;
+		*indefinite = 1;
+		*hdrlen = 2;
+		return 1;
+	}
+	nbytes = in[1] & 0x7f;
+	if (nbytes > sizeof(size_t)) {
+		error_print();
+		return -1;
+	}
+	if (inlen < 2 + nbytes) {
+		return 0;
+	}
+	*len = 0;
+	for (i = 0; i < nbytes; i++) {
+		*len = (*len << 8) | in[2 + i];
+	}
+	*indefinite = 0;
+	*hdrlen = 2 + nbytes;
+	return 1;
+}
+
+static int cms_ber_header_from_der(int tag, size_t *len, int *indefinite,
+	const uint8_t **in, size_t *inlen)
+{
+	int ret;
+	int t;
+	size_t hdrlen;
+
+	if ((ret = cms_ber_any_header_from_der(&t, len, indefinite, &hdrlen, *in, *inlen)) != 1) {
+		if (ret < 0) error_print();
+		return ret;
+	}
+	if (t != tag) {
+		error_print();
+		return -1;
+	}
+	*in += hdrlen;
+	*inlen -= hdrlen;
+	return 1;
+}
+
+// check that the next TLV is definite-length and complete before parsed by the DER functions
+static int cms_ber_tlv_is_complete(const uint8_t *in, size_t inlen)
+{
+	int ret;
+	int tag;
+	size_t len;
+	int indefinite;
+	size_t hdrlen;
+
+	if ((ret = cms_ber_any_header_from_der(&tag, &len, &indefinite, &hdrlen, in, inlen)) != 1) {
+		if (ret < 0) error_print();
+		return ret;
+	}
+	if (indefinite) {
+		error_print();
+		return -1;
+	}
+	if (len > inlen - hdrlen) {
+		return 0;
+	}
+	return 1;
+}
+
+static int cms_ber_end_of_contents_from_der(size_t cnt, const uint8_t **in, size_t *inlen)
+{
+	size_t i;
+
+	for (i = 0; i < cnt; i++) {
+		if (*inlen < 2) {
+			return 0;
+		}
+		if ((*in)[0] || (*in)[1]) {
+			error_print();
+			return -1;
+		}
+		(*in) += 2;
+		(*inlen) -= 2;
+	}
+	return 1;
+}
+
+static void cms_stream_reader_set_octets(CMS_STREAM_READER *reader, int constructed, int indefinite, size_t len)
+{
+	reader->octets_constructed = constructed;
+	reader->octets_indefinite = indefinite;
+
+	if (!constructed) {
+		reader->chunk_left = len;
+		reader->state = len ? CMS_STREAM_CHUNK : CMS_STREAM_TRAILER;
+	} else if (indefinite) {
+		reader->state = CMS_STREAM_CHUNK_HEADER;
+	} else {
+		reader->octets_left = len;
+		reader->state = len ? CMS_STREAM_CHUNK_HEADER : CMS_STREAM_TRAILER;
+	}
+}
+
+static void cms_stream_reader_chunk_done(CMS_STREAM_READER *reader)
+{
+	if (!reader->octets_constructed
+		|| (!reader->octets_indefinite && !reader->octets_left)) {
+		reader->state = CMS_STREAM_TRAILER;
+	} else {
+		reader->state = CMS_STREAM_CHUNK_HEADER;
+	}
+}
+
+// nested constructed chunks are not supported
+static int cms_stream_chunk_header_from_der(CMS_STREAM_READER *reader,
+	const uint8_t *in, size_t inlen, size_t *used)
+{
+	int ret;
+	int tag;
+	size_t len;
+	int indefinite;
+	size_t hdrlen;
+
+	if ((ret = cms_ber_any_header_from_der(&tag, &len, &indefinite, &hdrlen, in, inlen)) != 1) {
+		if (ret < 0) error_print();
+		return ret;
+	}
+	*used = hdrlen;
+
+	if (reader->octets_indefinite && tag == 0 && len == 0) {
+		reader->state = CMS_STREAM_TRAILER;
+		return 1;
+	}
+	if (tag != ASN1_TAG_OCTET_STRING) {
+		error_print();
+		return -1;
+	}
+	if (!reader->octets_indefinite) {
+		if (hdrlen > reader->octets_left || len > reader->octets_left - hdrlen) {
+			error_print();
+			return -1;
+		}
+		reader->octets_left -= hdrlen + len;
+	}
+	reader->chunk_left = len;
+	reader->state = CMS_STREAM_CHUNK;
+	if (!len) {
+		cms_stream_reader_chunk_done(reader);
+	}
+	return 1;
+}
+
+typedef int (*CMS_STREAM_PARSE_FUNC)(void *ctx, const uint8_t *in, size_t inlen, int final, size_t *used);
+typedef int (*CMS_STREAM_CONTENT_FUNC)(void *ctx, const uint8_t *in, size_t inlen, int is_header,
+	uint8_t **out, size_t *outlen);
+
+static int cms_stream_read(CMS_STREAM_READER *reader, void *ctx,
+	CMS_STREAM_PARSE_FUNC parse_prefix, CMS_STREAM_CONTENT_FUNC content, CMS_STREAM_PARSE_FUNC parse_trailer,
+	const uint8_t *in, size_t inlen, uint8_t *out, size_t *outlen)
+{
+	int state;
+	size_t len;
+	size_t used;
+	int ret;
+
+	*outlen = 0;
+
+	while (inlen) {
+		if (reader->state == CMS_STREAM_CHUNK) {
+			len = inlen < reader->chunk_left ? inlen : reader->chunk_left;
+			if (content(ctx, in, len, 0, out ? &out : NULL, outlen) != 1) {
+				error_print();
+				return -1;
+			}
+			in += len;
+			inlen -= len;
+			reader->chunk_left -= len;
+			if (!reader->chunk_left) {
+				cms_stream_reader_chunk_done(reader);
+			}
+			continue;
+		}
+		if (reader->state == CMS_STREAM_DONE) {
+			error_print();
+			return -1;
+		}
+
+		len = CMS_STREAM_BUF_SIZE - reader->buflen;
+		if (len > inlen) {
+			len = inlen;
+		}
+		memcpy(reader->buf + reader->buflen, in, len);
+		reader->buflen += len;
+
+		state = reader->state;
+		switch (state) {
+		case CMS_STREAM_PREFIX:
+			ret = parse_prefix(ctx, reader->buf, reader->buflen, 0, &used);
+			break;
+		case CMS_STREAM_CHUNK_HEADER:
+			ret = cms_stream_chunk_header_from_der(reader, reader->buf, reader->buflen, &used);
+			break;
+		default:
+			ret = parse_trailer(ctx, reader->buf, reader->buflen, 0, &used);
+		}
+		if (ret < 0) {
+			error_print();
+			return -1;
+		}
+		if (ret == 0) {
+			if (reader->buflen == CMS_STREAM_BUF_SIZE) {
+				error_print();
+				return -1;
+			}
+			in += len;
+			inlen -= len;
+			continue;
+		}
+
+		// the bytes behind `used` all come from this input, hand them back
+		if (reader->buflen - used > len) {
+			error_print();
+			return -1;
+		}
+		len -= reader->buflen - used;
+		in += len;
+		inlen -= len;
+
+		if (state == CMS_STREAM_CHUNK_HEADER
+			&& content(ctx, reader->buf, used, 1, NULL, outlen) != 1) {
+			error_print();
+			return -1;
+		}
+		reader->buflen = (reader->state == CMS_STREAM_DONE) ? used : 0;
+	}
+	return 1;
+}
+
+static int cms_stream_read_finish(CMS_STREAM_READER *reader, void *ctx, CMS_STREAM_PARSE_FUNC parse_trailer)
+{
+	size_t used;
+
+	if (reader->state == CMS_STREAM_TRAILER) {
+		if (parse_trailer(ctx, reader->buf, reader->buflen, 1, &used) != 1
+			|| used != reader->buflen) {
+			error_print();
+			return -1;
+		}
+	}
+	if (reader->state != CMS_STREAM_DONE) {
+		error_print();
+		return -1;
+	}
+	return 1;
+}
+
+static int cms_stream_chunks_update(uint8_t *chunk, size_t *chunk_len,
+	const uint8_t *in, size_t inlen, uint8_t **out, size_t *outlen)
+{
+	size_t len;
+
+	while (inlen) {
+		if (!(*chunk_len) && inlen >= CMS_STREAM_CHUNK_SIZE) {
+			if (asn1_octet_string_to_der(in, CMS_STREAM_CHUNK_SIZE, out, outlen) != 1) {
+				error_print();
+				return -1;
+			}
+			in += CMS_STREAM_CHUNK_SIZE;
+			inlen -= CMS_STREAM_CHUNK_SIZE;
+			continue;
+		}
+		len = CMS_STREAM_CHUNK_SIZE - *chunk_len;
+		if (len > inlen) {
+			len = inlen;
+		}
+		memcpy(chunk + *chunk_len, in, len);
+		*chunk_len += len;
+		in += len;
+		inlen -= len;
+
+		if (*chunk_len == CMS_STREAM_CHUNK_SIZE) {
+			if (asn1_octet_string_to_der(chunk, CMS_STREAM_CHUNK_SIZE, out, outlen) != 1) {
+				error_print();
+				return -1;
+			}
+			*chunk_len = 0;
+		}
+	}
+	return 1;
+}
+
+static int cms_sign_prefix_to_der(int detached, uint8_t **out, size_t *outlen)
+{
+	int digest_algors[] = { OID_sm3 };
+	size_t digest_algors_cnt = sizeof(digest_algors)/sizeof(int);
+	size_t len = 0;
+
+	if (cms_ber_indefinite_header_to_der(ASN1_TAG_SEQUENCE, out, outlen) != 1
+		|| cms_content_type_to_der(OID_cms_signed_data, out, outlen) != 1
+		|| cms_ber_indefinite_header_to_der(ASN1_TAG_EXPLICIT(0), out, outlen) != 1
+		|| cms_ber_indefinite_header_to_der(ASN1_TAG_SEQUENCE, out, outlen) != 1
+		|| asn1_int_to_der(CMS_version_v1, out, outlen) != 1
+		|| cms_digest_algors_to_der(digest_algors, digest_algors_cnt, out, outlen) != 1) {
+		error_print();
+		return -1;
+	}
+	if (detached) {
+		if (cms_content_type_to_der(OID_cms_data, NULL, &len) != 1
+			|| asn1_sequence_header_to_der(len, out, outlen) != 1
+			|| cms_content_type_to_der(OID_cms_data, out, outlen) != 1) {
+			error_print();
+			return -1;
+		}
+	} else {
+		if (cms_ber_indefinite_header_to_der(ASN1_TAG_SEQUENCE, out, outlen) != 1
+			|| cms_content_type_to_der(OID_cms_data, out, outlen) != 1
+			|| cms_ber_indefinite_header_to_der(ASN1_TAG_EXPLICIT(0), out, outlen) != 1
+			|| cms_ber_indefinite_header_to_der(ASN1_TAG_CONSTRUCTED|ASN1_TAG_OCTET_STRING, out, outlen) != 1) {
+			error_print();
+			return -1;
+		}
+	}
+	return 1;
+}
+
+// the signatures are of fixed length, so the length is known before signing
+static int cms_signer_infos_sign_to_der(const SM3_CTX *sm3_ctx,
+	const CMS_CERTS_AND_KEY *signers, size_t signers_cnt,
+	uint8_t **out, size_t *outlen)
+{
+	uint8_t sig[SM2_signature_typical_size];
+	const uint8_t *issuer;
+	size_t issuer_len;
+	const uint8_t *serial;
+	size_t serial_len;
+	size_t len = 0;
+	size_t i;
+
+	memset(sig, 0, sizeof(sig));
+	for (i = 0; i < signers_cnt; i++) {
+		if (x509_cert_get_issuer_and_serial_number(
+				signers[i].certs, signers[i].certs_len,
+				&issuer, &issuer_len, &serial, &serial_len) != 1
+			|| cms_signer_info_to_der(CMS_version_v1,
+				issuer, issuer_len, serial, serial_len,
+				OID_sm3, NULL, 0,
+				OID_sm2sign_with_sm3, sig, sizeof(sig),
+				NULL, 0, NULL, &len) != 1) {
+			error_print();
+			return -1;
+		}
+	}
+	if (asn1_set_header_to_der(len, out, outlen) != 1) {
+		error_print();
+		return -1;
+	}
+	if (!out || !(*out)) {
+		*outlen += len;
+		return 1;
+	}
+	for (i = 0; i < signers_cnt; i++) {
+		if (x509_cert_get_issuer_and_serial_number(
+				signers[i].certs, signers[i].certs_len,
+				&issuer, &issuer_len, &serial, &serial_len) != 1
+			|| cms_signer_info_sign_to_der(sm3_ctx, signers[i].sign_key,
+				issuer, issuer_len, serial, serial_len,
+				NULL, 0, NULL, 0, out, outlen) != 1) {
+			error_print();
+			return -1;
+		}
+	}
+	return 1;
+}
+
+int cms_sign_init(CMS_SIGN_CTX *ctx, const CMS_CERTS_AND_KEY *signers, size_t signers_cnt,
+	int detached, uint8_t *out, size_t *outlen)
+{
+	if (!ctx || !signers || !signers_cnt || !outlen) {
+		error_print();
+		return -1;
+	}
+	*outlen = 0;
+	if (!out) {
+		return cms_sign_prefix_to_der(detached, NULL, outlen);
+	}
+
+	memset(ctx, 0, sizeof(CMS_SIGN_CTX));
+	sm3_init(&ctx->sm3_ctx);
+	ctx->signers = signers;
+	ctx->signers_cnt = signers_cnt;
+	ctx->detached = detached;
+
+	if (cms_sign_prefix_to_der(detached, &out, outlen) != 1) {
+		error_print();
+		return -1;
+	}
+	return 1;
+}
+
+int cms_sign_update(CMS_SIGN_CTX *ctx, const uint8_t *in, size_t inlen, uint8_t *out, size_t *outlen)
+{
+	if (!ctx || (!in && inlen) || !outlen) {
+		error_print();
+		return -1;
+	}
+	*outlen = 0;
+
+	sm3_update(&ctx->sm3_ctx, in, inlen);
+
+	if (ctx->detached) {
+		return 1;
+	}
+	if (cms_stream_chunks_update(ctx->chunk, &ctx->chunk_len, in, inlen, &out, outlen) != 1) {
+		error_print();
+		return -1;
+	}
+	return 1;
+}
+
+int cms_sign_finish(CMS_SIGN_CTX *ctx, uint8_t *out, size_t *outlen)
+{
+	uint8_t **pout = out ? &out : NULL;
+
+	if (!ctx || !outlen) {
+		error_print();
+		return -1;
+	}
+	*outlen = 0;
+
+	if (!ctx->detached) {
+		// last chunk, then the end of the OCTET STRING, [0] and ContentInfo
+		if ((ctx->chunk_len
+				&& asn1_octet_string_to_der(ctx->chunk, ctx->chunk_len, pout, outlen) != 1)
+			|| cms_ber_end_of_contents_to_der(3, pout, outlen) != 1) {
+			error_print();
+			return -1;
+		}
+	}
+	// end of the SignedData, [0] and ContentInfo
+	if (cms_implicit_signers_certs_to_der(0, ctx->signers, ctx->signers_cnt, pout, outlen) != 1
+		|| cms_signer_infos_sign_to_der(&ctx->sm3_ctx, ctx->signers, ctx->signers_cnt, pout, outlen) != 1
+		|| cms_ber_end_of_contents_to_der(3, pout, outlen) != 1) {
+		error_print();
+		return -1;
+	}
+	return 1;
+}
+
+static int cms_verify_prefix_from_der(void *vctx, const uint8_t *in, size_t inlen, int final, size_t *used)
+{
+	CMS_VERIFY_CTX *ctx = (CMS_VERIFY_CTX *)vctx;
+	const uint8_t *p = in;
+	size_t len = inlen;
+	int end_eocs = 0;
+	int oid;
+	int version;
+	int digest_algors[4];
+	size_t digest_algors_cnt;
+	const uint8_t *content_info;
+	const uint8_t *content_info_value;
+	size_t content_info_len;
+	int content_info_indefinite;
+	int explicit_indefinite = 0;
+	int detached = 0;
+	int tag = 0;
+	size_t vlen = 0;
+	int indefinite = 0;
+	size_t hdrlen;
+	int ret;
+
+	if ((ret = cms_ber_header_from_der(ASN1_TAG_SEQUENCE, &vlen, &indefinite, &p, &len)) != 1) goto end;
+	end_eocs += indefinite;
+	if ((ret = cms_ber_tlv_is_complete(p, len)) != 1) goto end;
+	if (cms_content_type_from_der(&oid, &p, &len) != 1
+		|| oid != OID_cms_signed_data) {
+		ret = -1;
+		goto end;
+	}
+	if ((ret = cms_ber_header_from_der(ASN1_TAG_EXPLICIT(0), &vlen, &indefinite, &p, &len)) != 1) goto end;
+	end_eocs += indefinite;
+	if ((ret = cms_ber_header_from_der(ASN1_TAG_SEQUENCE, &vlen, &indefinite, &p, &len)) != 1) goto end;
+	end_eocs += indefinite;
+	if ((ret = cms_ber_tlv_is_complete(p, len)) != 1) goto end;
+	if (asn1_int_from_der(&version, &p, &len) != 1
+		|| version != CMS_version_v1) {
+		ret = -1;
+		goto end;
+	}
+	if ((ret = cms_ber_tlv_is_complete(p, len)) != 1) goto end;
+	if (cms_digest_algors_from_der(digest_algors, &digest_algors_cnt,
+			sizeof(digest_algors)/sizeof(int), &p, &len) != 1
+		|| digest_algors_cnt != 1
+		|| digest_algors[0] != OID_sm3) {
+		ret = -1;
+		goto end;
+	}
+
+	content_info = p;
+	if ((ret = cms_ber_header_from_der(ASN1_TAG_SEQUENCE,
+		&content_info_len, &content_info_indefinite, &p, &len)) != 1) goto end;
+	content_info_value = p;
+	if ((ret = cms_ber_tlv_is_complete(p, len)) != 1) goto end;
+	if (cms_content_type_from_der(&oid, &p, &len) != 1
+		|| oid != OID_cms_data) {
+		ret = -1;
+		goto end;
+	}
+	if (content_info_indefinite) {
+		if (len < 2) {
+			ret = 0;
+			goto end;
+		}
+		if (p[0] == 0 && p[1] == 0) {
+			p += 2;
+			len -= 2;
+			detached = 1;
+		}
+	} else if ((size_t)(p - content_info_value) == content_info_len) {
+		detached = 1;
+	}
+	if (!detached) {
+		if ((ret = cms_ber_header_from_der(ASN1_TAG_EXPLICIT(0), &vlen, &explicit_indefinite, &p, &len)) != 1) goto end;
+		if ((ret = cms_ber_any_header_from_der(&tag, &vlen, &indefinite, &hdrlen, p, len)) != 1) goto end;
+		if (tag != ASN1_TAG_OCTET_STRING
+			&& tag != (ASN1_TAG_CONSTRUCTED|ASN1_TAG_OCTET_STRING)) {
+			ret = -1;
+			goto end;
+		}
+		p += hdrlen;
+		len -= hdrlen;
+	}
+
+	ctx->detached = detached;
+	ctx->raw_digest = !detached && !content_info_indefinite;
+	ctx->content_eocs = detached ? 0 : explicit_indefinite + content_info_indefinite;
+	ctx->end_eocs = end_eocs;
+	if (ctx->raw_digest) {
+		sm3_update(&ctx->sm3_ctx, content_info, p - content_info);
+	}
+	if (detached) {
+		ctx->reader.state = CMS_STREAM_TRAILER;
+	} else {
+		cms_stream_reader_set_octets(&ctx->reader, tag & ASN1_TAG_CONSTRUCTED, indefinite, vlen);
+	}
+	*used = p - in;
+	ret = 1;
+end:
+	if (ret < 0) error_print();
+	return ret;
+}
+
+static int cms_verify_content(void *vctx, const uint8_t *in, size_t inlen, int is_header,
+	uint8_t **out, size_t *outlen)
+{
+	CMS_VERIFY_CTX *ctx = (CMS_VERIFY_CTX *)vctx;
+
+	if (is_header) {
+		if (ctx->raw_digest) {
+			sm3_update(&ctx->sm3_ctx, in, inlen);
+		}
+		return 1;
+	}
+	sm3_update(&ctx->sm3_ctx, in, inlen);
+	if (out) {
+		memcpy(*out, in, inlen);
+		*out += inlen;
+		*outlen += inlen;
+	}
+	return 1;
+}
+
+static int cms_verify_trailer_from_der(void *vctx, const uint8_t *in, size_t inlen, int final, size_t *used)
+{
+	CMS_VERIFY_CTX *ctx = (CMS_VERIFY_CTX *)vctx;
+	const uint8_t *p = in;
+	size_t len = inlen;
+	const uint8_t *certs = NULL;
+	size_t certs_len = 0;
+	const uint8_t *crls;
+	size_t crls_len;
+	const uint8_t *signer_infos;
+	size_t signer_infos_len;
+	int ret;
+
+	if ((ret = cms_ber_end_of_contents_from_der(ctx->content_eocs, &p, &len)) != 1) goto end;
+	if ((ret = cms_ber_tlv_is_complete(p, len)) != 1) goto end;
+	if (p[0] == ASN1_TAG_EXPLICIT(0)) {
+		if (asn1_implicit_set_from_der(0, &certs, &certs_len, &p, &len) != 1) {
+			ret = -1;
+			goto end;
+		}
+		if ((ret = cms_ber_tlv_is_complete(p, len)) != 1) goto end;
+	}
+	if (p[0] == ASN1_TAG_EXPLICIT(1)) {
+		if (asn1_implicit_set_from_der(1, &crls, &crls_len, &p, &len) != 1) {
+			ret = -1;
+			goto end;
+		}
+		if ((ret = cms_ber_tlv_is_complete(p, len)) != 1) goto end;
+	}
+	if (cms_signer_infos_from_der(&signer_infos, &signer_infos_len, &p, &len) != 1) {
+		ret = -1;
+		goto end;
+	}
+	if ((ret = cms_ber_end_of_contents_from_der(ctx->end_eocs, &p, &len)) != 1) goto end;
+
+	ctx->certs = certs;
+	ctx->certs_len = certs_len;
+	ctx->signer_infos = signer_infos;
+	ctx->signer_infos_len = signer_infos_len;
+	ctx->reader.state = CMS_STREAM_DONE;
+	*used = p - in;
+	ret = 1;
+end:
+	if (ret < 0) error_print();
+	return ret;
+}
+
+int cms_verify_init(CMS_VERIFY_CTX *ctx)
+{
+	if (!ctx) {
+		error_print();
+		return -1;
+	}
+	memset(ctx, 0, sizeof(CMS_VERIFY_CTX));
+	sm3_init(&ctx->sm3_ctx);
+	return 1;
+}
+
+int cms_verify_update(CMS_VERIFY_CTX *ctx, const uint8_t *in, size_t inlen, uint8_t *out, size_t *outlen)
+{
+	if (!ctx || (!in && inlen) || !outlen) {
+		error_print();
+		return -1;
+	}
+	if (cms_stream_read(&ctx->reader, ctx,
+		cms_verify_prefix_from_der, cms_verify_content, cms_verify_trailer_from_der,
+		in, inlen, out, outlen) != 1) {
+		error_print();
+		return -1;
+	}
+	return 1;
+}
+
+int cms_verify_detached_update(CMS_VERIFY_CTX *ctx, const uint8_t *data, size_t datalen)
+{
+	if (!ctx || (!data && datalen)) {
+		error_print();
+		return -1;
+	}
+	if (ctx->reader.state == CMS_STREAM_PREFIX || !ctx->detached) {
+		error_print();
+		return -1;
+	}
+	sm3_update(&ctx->sm3_ctx, data, datalen);
+	return 1;
+}
+
+int cms_verify_finish(CMS_VERIFY_CTX *ctx)
+{
+	const uint8_t *signer_infos;
+	size_t signer_infos_len;
+
+	if (!ctx) {
+		error_print();
+		return -1;
+	}
+	if (cms_stream_read_finish(&ctx->reader, ctx, cms_verify_trailer_from_der) != 1) {
+		error_print();
+		return -1;
+	}
+
+	signer_infos = ctx->signer_infos;
+	signer_infos_len = ctx->signer_infos_len;
+	while (signer_infos_len) {
+		const uint8_t *cert;
+		size_t certlen;
+		const uint8_t *issuer;
+		size_t issuer_len;
+		const uint8_t *serial;
+		size_t serial_len;
+		const uint8_t *authed_attrs;
+		size_t authed_attrs_len;
+		const uint8_t *unauthed_attrs;
+		size_t unauthed_attrs_len;
+
+		if (cms_signer_info_verify_from_der(
+			&ctx->sm3_ctx, ctx->certs, ctx->certs_len,
+			&cert, &certlen,
+			&issuer, &issuer_len,
+			&serial, &serial_len,
+			&authed_attrs, &authed_attrs_len,
+			&unauthed_attrs, &unauthed_attrs_len,
+			&signer_infos, &signer_infos_len) != 1) {
+			error_print();
+			return -1;
+		}
+	}
+	return 1;
+}
+
+static int cms_recipient_infos_encrypt_to_der(
+	const uint8_t *rcpt_certs, size_t rcpt_certs_len,
+	const uint8_t *key, size_t keylen,
+	uint8_t **out, size_t *outlen)
+{
+	while (rcpt_certs_len) {
+		X509_CERT_VIEW view;
+		SM2_KEY public_key;
+
+		if (x509_cert_view_from_der(&view, &rcpt_certs, &rcpt_certs_len) != 1
+			|| x509_cert_view_get_subject_public_key(&view, &public_key) != 1
+			|| cms_recipient_info_encrypt_to_der(&public_key,
+				view.issuer, view.issuer_len, view.serial_number, view.serial_number_len,
+				key, keylen, out, outlen) != 1) {
+			error_print();
+			return -1;
+		}
+	}
+	return 1;
+}
+
+int cms_envelop_init(CMS_ENVELOP_CTX *ctx,
+	const uint8_t *rcpt_certs, size_t rcpt_certs_len,
+	int enc_algor, const uint8_t *key, size_t keylen, const uint8_t *iv, size_t ivlen,
+	uint8_t *out, size_t *outlen)
+{
+	uint8_t **pout = out ? &out : NULL;
+	size_t rcpt_infos_len = 0;
+
+	if (!ctx || !rcpt_certs || !rcpt_certs_len || !key || !iv || !outlen) {
+		error_print();
+		return -1;
+	}
+	if (enc_algor != OID_sm4_cbc || keylen != SM4_KEY_SIZE || ivlen != SM4_BLOCK_SIZE) {
+		error_print();
+		return -1;
+	}
+	*outlen = 0;
+
+	// RecipientInfos and the EncryptedContentInfo header, the encryptedContent is [0] IMPLICIT constructed
+	if (cms_recipient_infos_encrypt_to_der(rcpt_certs, rcpt_certs_len, key, keylen, NULL, &rcpt_infos_len) != 1
+		|| cms_ber_indefinite_header_to_der(ASN1_TAG_SEQUENCE, pout, outlen) != 1
+		|| cms_content_type_to_der(OID_cms_enveloped_data, pout, outlen) != 1
+		|| cms_ber_indefinite_header_to_der(ASN1_TAG_EXPLICIT(0), pout, outlen) != 1
+		|| cms_ber_indefinite_header_to_der(ASN1_TAG_SEQUENCE, pout, outlen) != 1
+		|| asn1_int_to_der(CMS_version_v1, pout, outlen) != 1
+		|| asn1_set_header_to_der(rcpt_infos_len, pout, outlen) != 1
+		|| cms_recipient_infos_encrypt_to_der(rcpt_certs, rcpt_certs_len, key, keylen, pout, outlen) != 1
+		|| cms_ber_indefinite_header_to_der(ASN1_TAG_SEQUENCE, pout, outlen) != 1
+		|| cms_content_type_to_der(OID_cms_data, pout, outlen) != 1
+		|| x509_encryption_algor_to_der(enc_algor, iv, ivlen, pout, outlen) != 1
+		|| cms_ber_indefinite_header_to_der(ASN1_TAG_EXPLICIT(0), pout, outlen) != 1) {
+		error_print();
+		return -1;
+	}
+	if (out) {
+		memset(ctx, 0, sizeof(CMS_ENVELOP_CTX));
+		if (sm4_cbc_encrypt_init(&ctx->cbc_ctx, key, iv) != 1) {
+			error_print();
+			return -1;
+		}
+	}
+	return 1;
+}
+
+int cms_envelop_update(CMS_ENVELOP_CTX *ctx, const uint8_t *in, size_t inlen, uint8_t *out, size_t *outlen)
+{
+	uint8_t buf[CMS_STREAM_CHUNK_SIZE + SM4_BLOCK_SIZE];
+	size_t buflen;
+	size_t len;
+
+	if (!ctx || (!in && inlen) || !out || !outlen) {
+		error_print();
+		return -1;
+	}
+	*outlen = 0;
+
+	while (inlen) {
+		len = inlen < CMS_STREAM_CHUNK_SIZE ? inlen : CMS_STREAM_CHUNK_SIZE;
+		if (sm4_cbc_encrypt_update(&ctx->cbc_ctx, in, len, buf, &buflen) != 1
+			|| cms_stream_chunks_update(ctx->chunk, &ctx->chunk_len, buf, buflen, &out, outlen) != 1) {
+			error_print();
+			return -1;
+		}
+		in += len;
+		inlen -= len;
+	}
+	return 1;
+}
+
+int cms_envelop_finish(CMS_ENVELOP_CTX *ctx, uint8_t *out, size_t *outlen)
+{
+	uint8_t block[SM4_BLOCK_SIZE];
+	size_t len;
+
+	if (!ctx || !outlen) {
+		error_print();
+		return -1;
+	}
+	*outlen = 0;
+
+	// end of the encryptedContent, EncryptedContentInfo, EnvelopedData, [0] and ContentInfo
+	if (!out) {
+		// sm4_cbc_encrypt_finish always outputs the padding block
+		len = ctx->chunk_len + SM4_BLOCK_SIZE;
+		if (len >= CMS_STREAM_CHUNK_SIZE) {
+			asn1_octet_string_header_to_der(CMS_STREAM_CHUNK_SIZE, NULL, outlen);
+			*outlen += CMS_STREAM_CHUNK_SIZE;
+			len -= CMS_STREAM_CHUNK_SIZE;
+		}
+		if (len) {
+			asn1_octet_string_header_to_der(len, NULL, outlen);
+			*outlen += len;
+		}
+		cms_ber_end_of_contents_to_der(5, NULL, outlen);
+		return 1;
+	}
+	if (sm4_cbc_encrypt_finish(&ctx->cbc_ctx, block, &len) != 1
+		|| cms_stream_chunks_update(ctx->chunk, &ctx->chunk_len, block, len, &out, outlen) != 1
+		|| (ctx->chunk_len
+			&& asn1_octet_string_to_der(ctx->chunk, ctx->chunk_len, &out, outlen) != 1)
+		|| cms_ber_end_of_contents_to_der(5, &out, outlen) != 1) {
+		error_print();
+		return -1;
+	}
+	gmssl_secure_clear(&ctx->cbc_ctx, sizeof(SM4_CBC_CTX));
+	return 1;
+}
+
+static int cms_deenvelop_prefix_from_der(void *vctx, const uint8_t *in, size_t inlen, int final, size_t *used)
+{
+	CMS_DEENVELOP_CTX *ctx = (CMS_DEENVELOP_CTX *)vctx;
+	const uint8_t *p = in;
+	size_t len = inlen;
+	int end_eocs = 0;
+	int oid;
+	int version;
+	const uint8_t *rcpt_infos;
+	size_t rcpt_infos_len;
+	int enced_content_info_indefinite;
+	int enc_algor;
+	const uint8_t *iv;
+	size_t ivlen;
+	int tag;
+	size_t vlen;
+	int indefinite;
+	size_t hdrlen;
+	uint8_t key[32];
+	size_t keylen;
+	int ret;
+
+	if ((ret = cms_ber_header_from_der(ASN1_TAG_SEQUENCE, &vlen, &indefinite, &p, &len)) != 1) goto end;
+	end_eocs += indefinite;
+	if ((ret = cms_ber_tlv_is_complete(p, len)) != 1) goto end;
+	if (cms_content_type_from_der(&oid, &p, &len) != 1
+		|| oid != OID_cms_enveloped_data) {
+		ret = -1;
+		goto end;
+	}
+	if ((ret = cms_ber_header_from_der(ASN1_TAG_EXPLICIT(0), &vlen, &indefinite, &p, &len)) != 1) goto end;
+	end_eocs += indefinite;
+	if ((ret = cms_ber_header_from_der(ASN1_TAG_SEQUENCE, &vlen, &indefinite, &p, &len)) != 1) goto end;
+	end_eocs += indefinite;
+	if ((ret = cms_ber_tlv_is_complete(p, len)) != 1) goto end;
+	if (asn1_int_from_der(&version, &p, &len) != 1
+		|| version != CMS_version_v1) {
+		ret = -1;
+		goto end;
+	}
+	if ((ret = cms_ber_tlv_is_complete(p, len)) != 1) goto end;
+	if (cms_recipient_infos_from_der(&rcpt_infos, &rcpt_infos_len, &p, &len) != 1) {
+		ret = -1;
+		goto end;
+	}
+	if ((ret = cms_ber_header_from_der(ASN1_TAG_SEQUENCE,
+		&vlen, &enced_content_info_indefinite, &p, &len)) != 1) goto end;
+	if ((ret = cms_ber_tlv_is_complete(p, len)) != 1) goto end;
+	if (cms_content_type_from_der(&oid, &p, &len) != 1
+		|| oid != OID_cms_data) {
+		ret = -1;
+		goto end;
+	}
+	if ((ret = cms_ber_tlv_is_complete(p, len)) != 1) goto end;
+	if (x509_encryption_algor_from_der(&enc_algor, &iv, &ivlen, &p, &len) != 1
+		|| enc_algor != OID_sm4_cbc
+		|| ivlen != SM4_BLOCK_SIZE) {
+		ret = -1;
+		goto end;
+	}
+	if ((ret = cms_ber_any_header_from_der(&tag, &vlen, &indefinite, &hdrlen, p, len)) != 1) goto end;
+	if (tag != ASN1_TAG_IMPLICIT(0) && tag != ASN1_TAG_EXPLICIT(0)) {
+		ret = -1;
+		goto end;
+	}
+	p += hdrlen;
+	len -= hdrlen;
+
+	// the whole prefix is in the buffer, decrypt the content encryption key only once
+	ret = 0;
+	while (rcpt_infos_len) {
+		if ((ret = cms_recipient_info_decrypt_from_der(ctx->rcpt_key,
+			ctx->rcpt_issuer, ctx->rcpt_issuer_len,
+			ctx->rcpt_serial, ctx->rcpt_serial_len,
+			key, &keylen, sizeof(key),
+			&rcpt_infos, &rcpt_infos_len)) < 0) {
+			goto end;
+		} else if (ret) {
+			break;
+		}
+	}
+	if (!ret || keylen != SM4_KEY_SIZE) {
+		gmssl_secure_clear(key, sizeof(key));
+		ret = -1;
+		goto end;
+	}
+	if (sm4_cbc_decrypt_init(&ctx->cbc_ctx, key, iv) != 1) {
+		gmssl_secure_clear(key, sizeof(key));
+		ret = -1;
+		goto end;
+	}
+	gmssl_secure_clear(key, sizeof(key));
+
+	ctx->enced_content_info_indefinite = enced_content_info_indefinite;
+	ctx->end_eocs = end_eocs;
+	cms_stream_reader_set_octets(&ctx->reader, tag & ASN1_TAG_CONSTRUCTED, indefinite, vlen);
+	*used = p - in;
+	ret = 1;
+end:
+	if (ret < 0) error_print();
+	return ret;
+}
+
+static int cms_deenvelop_content(void *vctx, const uint8_t *in, size_t inlen, int is_header,
+	uint8_t **out, size_t *outlen)
+{
+	CMS_DEENVELOP_CTX *ctx = (CMS_DEENVELOP_CTX *)vctx;
+	size_t len;
+
+	if (is_header) {
+		return 1;
+	}
+	if (!out) {
+		error_print();
+		return -1;
+	}
+	if (sm4_cbc_decrypt_update(&ctx->cbc_ctx, in, inlen, *out, &len) != 1) {
+		error_print();
+		return -1;
+	}
+	*out += len;
+	*outlen += len;
+	return 1;
+}
+
+static int cms_deenvelop_trailer_from_der(void *vctx, const uint8_t *in, size_t inlen, int final, size_t *used)
+{
+	CMS_DEENVELOP_CTX *ctx = (CMS_DEENVELOP_CTX *)vctx;
+	const uint8_t *p = in;
+	size_t len = inlen;
+	const uint8_t *shared_info;
+	size_t shared_info_len;
+	int index;
+	int ret;
+
+	// sharedInfo1 [1] and sharedInfo2 [2] are skipped
+	for (index = 1; index <= 2; index++) {
+		if (!len) {
+			if (final) {
+				break;
+			}
+			ret = 0;
+			goto end;
+		}
+		if (p[0] != ASN1_TAG_IMPLICIT(index)) {
+			continue;
+		}
+		if ((ret = cms_ber_tlv_is_complete(p, len)) != 1) goto end;
+		if (asn1_implicit_octet_string_from_der(index, &shared_info, &shared_info_len, &p, &len) != 1) {
+			ret = -1;
+			goto end;
+		}
+	}
+	if ((ret = cms_ber_end_of_contents_from_der(
+		ctx->enced_content_info_indefinite + ctx->end_eocs, &p, &len)) != 1) goto end;
+
+	ctx->reader.state = CMS_STREAM_DONE;
+	*used = p - in;
+	ret = 1;
+end:
+	if (ret < 0) error_print();
+	return ret;
+}
+
+int cms_deenvelop_init(CMS_DEENVELOP_CTX *ctx,
+	const SM2_KEY *rcpt_key, const uint8_t *rcpt_cert, size_t rcpt_cert_len)
+{
+	if (!ctx || !rcpt_key || !rcpt_cert || !rcpt_cert_len) {
+		error_print();
+		return -1;
+	}
+	memset(ctx, 0, sizeof(CMS_DEENVELOP_CTX));
+	if (x509_cert_get_issuer_and_serial_number(rcpt_cert, rcpt_cert_len,
+		&ctx->rcpt_issuer, &ctx->rcpt_issuer_len,
+		&ctx->rcpt_serial, &ctx->rcpt_serial_len) != 1) {
+		error_print();
+		return -1;
+	}
+	ctx->rcpt_key = rcpt_key;
+	return 1;
+}
+
+int cms_deenvelop_update(CMS_DEENVELOP_CTX *ctx, const uint8_t *in, size_t inlen, uint8_t *out, size_t *outlen)
+{
+	if (!ctx || (!in && inlen) || !out || !outlen) {
+		error_print();
+		return -1;
+	}
+	if (cms_stream_read(&ctx->reader, ctx,
+		cms_deenvelop_prefix_from_der, cms_deenvelop_content, cms_deenvelop_trailer_from_der,
+		in, inlen, out, outlen) != 1) {
+		error_print();
+		return -1;
+	}
+	return 1;
+}
+
+int cms_deenvelop_finish(CMS_DEENVELOP_CTX *ctx, uint8_t *out, size_t *outlen)
+{
+	if (!ctx || !out || !outlen) {
+		error_print();
+		return -1;
+	}
+	if (cms_stream_read_finish(&ctx->reader, ctx, cms_deenvelop_trailer_from_der) != 1
+		|| sm4_cbc_decrypt_finish(&ctx->cbc_ctx, out, outlen) != 1) {
+		error_print();
+		return -1;
+	}
+	gmssl_secure_clear(&ctx->cbc_ctx, sizeof(SM4_CBC_CTX));
+	return 1;
+}
+
 int cms_to_pem(const uint8_t *cms, size_t cms_len, FILE *fp)
 {
 	if (pem_write(fp, PEM_CMS, cms, cms_len) != 1) {
@@ -0,0 +1,158 @@
+/*
+ *  Copyright 2014-2024 The GmSSL Project. All Rights Reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the License); you may
+ *  not use this file except in compliance with the License.
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+
+#include <stdio.h>
+#include <stdarg.h>
+#include <string.h>
+#include <gmssl/error.h>
+
+
+#ifdef WIN32
+#define ERROR_THREAD_LOCAL	__declspec(thread)
+#else
+#define ERROR_THREAD_LOCAL	__thread
+#endif
+
+// errors[(head + i) % GMSSL_ERROR_QUEUE_SIZE] for i in [0, num)
+typedef struct {
+	GMSSL_ERROR errors[GMSSL_ERROR_QUEUE_SIZE];
+	unsigned int head;
+	unsigned int num;
+} ERROR_QUEUE;
+
+static ERROR_THREAD_LOCAL ERROR_QUEUE error_queue;
+
+#ifdef ENABLE_ERROR_STDERR
+static volatile int error_stderr = 1;
+#endif
+
+
+static void error_queue_push(const char *file, int line, const char *func, int code)
+{
+	ERROR_QUEUE *queue = &error_queue;
+	GMSSL_ERROR *err;
+
+	if (queue->num < GMSSL_ERROR_QUEUE_SIZE) {
+		err = &queue->errors[(queue->head + queue->num) % GMSSL_ERROR_QUEUE_SIZE];
+		queue->num++;
+	} else {
+		err = &queue->errors[queue->head];
+		queue->head = (queue->head + 1) % GMSSL_ERROR_QUEUE_SIZE;
+	}
+	err->file = file;
+	err->func = func;
+	err->line = line;
+	err->code = code;
+}
+
+void gmssl_error_push(const char *file, int line, const char *func, int code)
+{
+	error_queue_push(file, line, func, code);
+#ifdef ENABLE_ERROR_STDERR
+	if (error_stderr) {
+		fprintf(stderr, "%s:%d:%s():\n", file, line, func);
+	}
+#endif
+}
+
+// the message is only formatted when printed, the queue keeps the code
+void gmssl_error_push_msg(const char *file, int line, const char *func, int code, const char *fmt, ...)
+{
+#ifdef ENABLE_ERROR_STDERR
+	va_list args;
+#endif
+
+	error_queue_push(file, line, func, code);
+#ifdef ENABLE_ERROR_STDERR
+	if (error_stderr) {
+		fprintf(stderr, "%s:%d:%s(): ", file, line, func);
+		va_start(args, fmt);
+		vfprintf(stderr, fmt, args);
+		va_end(args);
+	}
+#else
+	(void)fmt;
+#endif
+}
+
+int gmssl_error_get(GMSSL_ERROR *err)
+{
+	ERROR_QUEUE *queue = &error_queue;
+
+	if (!queue->num) {
+		return 0;
+	}
+	if (err) {
+		*err = queue->errors[queue->head];
+	}
+	queue->head = (queue->head + 1) % GMSSL_ERROR_QUEUE_SIZE;
+	queue->num--;
+	return 1;
+}
+
+int gmssl_error_peek_last(GMSSL_ERROR *err)
+{
+	ERROR_QUEUE *queue = &error_queue;
+
+	if (!queue->num) {
+		return 0;
+	}
+	if (err) {
+		*err = queue->errors[(queue->head + queue->num - 1) % GMSSL_ERROR_QUEUE_SIZE];
+	}
+	return 1;
+}
+
+void gmssl_error_clear(void)
+{
+	error_queue.head = 0;
+	error_queue.num = 0;
+}
+
+const char *gmssl_error_code_name(int code)
+{
+	switch (code) {
+	case GMSSL_ERR_UNSPECIFIED: return "error";
+	case GMSSL_ERR_DECODE: return "decode error";
+	case GMSSL_ERR_VERIFY: return "verification failure";
+	}
+	return "unknown error";
+}
+
+int gmssl_error_print(FILE *fp)
+{
+	GMSSL_ERROR err;
+
+	if (!fp) {
+		return -1;
+	}
+	while (gmssl_error_get(&err) == 1) {
+		fprintf(fp, "%s:%d:%s(): %s\n", err.file, err.line, err.func, gmssl_error_code_name(err.code));
+	}
+	return 1;
+}
+
+void gmssl_error_set_stderr(int enable)
+{
+#ifdef ENABLE_ERROR_STDERR
+	error_stderr = enable ? 1 : 0;
+#else
+	(void)enable;
+#endif
+}
+
+int gmssl_error_stderr_enabled(void)
+{
+#ifdef ENABLE_ERROR_STDERR
+	return error_stderr;
+#else
+	return 0;
+#endif
+}
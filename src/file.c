@@ -13,7 +13,17 @@
 #include <string.h>
 #include <stdlib.h>
 #include <sys/stat.h>
+#ifndef WIN32
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#endif
+#include <gmssl/mem.h>
+#include <gmssl/file.h>
 #include <gmssl/error.h>
+#ifdef ENABLE_PTHREAD
+#include <pthread.h>
+#endif
 
 
 int file_size(FILE *fp, size_t *size)
@@ -61,3 +71,363 @@ end:
 	return ret;
 }
 
+int file_map(FILE_MAP *map, const char *file)
+{
+	if (!map || !file) {
+		error_print();
+		return -1;
+	}
+	memset(map, 0, sizeof(*map));
+
+#ifndef WIN32
+	{
+		int fd;
+		struct stat st;
+		void *p;
+
+		if ((fd = open(file, O_RDONLY)) < 0) {
+			error_print();
+			return -1;
+		}
+		if (fstat(fd, &st) < 0) {
+			close(fd);
+			error_print();
+			return -1;
+		}
+		if (S_ISREG(st.st_mode) && st.st_size == 0) {
+			close(fd);
+			return 1;
+		}
+		if (S_ISREG(st.st_mode)
+			&& (p = mmap(NULL, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, fd, 0)) != MAP_FAILED) {
+#ifdef MADV_SEQUENTIAL
+			madvise(p, (size_t)st.st_size, MADV_SEQUENTIAL);
+#endif
+			close(fd);
+			map->data = (uint8_t *)p;
+			map->datalen = (size_t)st.st_size;
+			map->mapped = 1;
+			return 1;
+		}
+		close(fd);
+	}
+#endif
+	if (file_read_all(file, &map->data, &map->datalen) != 1) {
+		error_print();
+		return -1;
+	}
+	return 1;
+}
+
+void file_unmap(FILE_MAP *map)
+{
+	if (!map) {
+		return;
+	}
+#ifndef WIN32
+	if (map->mapped) {
+		munmap(map->data, map->datalen);
+		memset(map, 0, sizeof(*map));
+		return;
+	}
+#endif
+	if (map->data) {
+		free(map->data);
+	}
+	memset(map, 0, sizeof(*map));
+}
+
+
+static int file_reader_fill(FILE_READER *reader, uint8_t *buf, size_t *len)
+{
+	size_t n = 0;
+
+#ifdef WIN32
+	n = fread(buf, 1, FILE_IO_BLOCK_SIZE, reader->fp);
+	if (ferror(reader->fp)) {
+		error_print();
+		return -1;
+	}
+#else
+	// a short block is only returned at the end of input
+	while (n < FILE_IO_BLOCK_SIZE) {
+		ssize_t r = read(reader->fd, buf + n, FILE_IO_BLOCK_SIZE - n);
+		if (r < 0) {
+			if (errno == EINTR) {
+				continue;
+			}
+			error_print();
+			return -1;
+		}
+		if (r == 0) {
+			break;
+		}
+		n += (size_t)r;
+	}
+#endif
+	*len = n;
+	return 1;
+}
+
+#ifdef ENABLE_PTHREAD
+typedef struct {
+	pthread_t thread;
+	pthread_mutex_t lock;
+	pthread_cond_t cond;
+} FILE_READER_THREAD;
+
+// fill bufs[0], bufs[1], bufs[0], ... as soon as the caller releases them
+static void *file_reader_routine(void *arg)
+{
+	FILE_READER *reader = (FILE_READER *)arg;
+	FILE_READER_THREAD *t = (FILE_READER_THREAD *)reader->thread;
+	int i = 0;
+	int ret;
+	size_t len = 0;
+
+	// only the blocking read can be cancelled, never with the lock held
+	pthread_setcancelstate(PTHREAD_CANCEL_DISABLE, NULL);
+	for (;;) {
+		pthread_mutex_lock(&t->lock);
+		while (reader->buf_ready[i] && !reader->stop) {
+			pthread_cond_wait(&t->cond, &t->lock);
+		}
+		if (reader->stop) {
+			pthread_mutex_unlock(&t->lock);
+			break;
+		}
+		pthread_mutex_unlock(&t->lock);
+
+		pthread_setcancelstate(PTHREAD_CANCEL_ENABLE, NULL);
+		ret = file_reader_fill(reader, reader->bufs[i], &len);
+		pthread_setcancelstate(PTHREAD_CANCEL_DISABLE, NULL);
+
+		pthread_mutex_lock(&t->lock);
+		reader->buf_lens[i] = len;
+		reader->buf_ready[i] = (ret == 1) ? 1 : -1;
+		pthread_cond_signal(&t->cond);
+		pthread_mutex_unlock(&t->lock);
+
+		if (ret != 1 || len < FILE_IO_BLOCK_SIZE) {
+			break;
+		}
+		i ^= 1;
+	}
+	return NULL;
+}
+#endif
+
+int file_reader_init(FILE_READER *reader, FILE *fp)
+{
+	int nbufs = 1;
+	int i;
+
+	if (!reader || !fp) {
+		error_print();
+		return -1;
+	}
+	memset(reader, 0, sizeof(*reader));
+	reader->fp = fp;
+	reader->cur = -1;
+
+#ifdef WIN32
+	reader->fd = _fileno(fp);
+#else
+	reader->fd = fileno(fp);
+	{
+		struct stat st;
+		off_t pos;
+
+		// files with st_size 0 (e.g. in /proc) are read as streams
+		if (fstat(reader->fd, &st) == 0 && S_ISREG(st.st_mode) && st.st_size > 0
+			&& (pos = lseek(reader->fd, 0, SEEK_CUR)) >= 0 && pos <= st.st_size) {
+			void *map = mmap(NULL, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, reader->fd, 0);
+			if (map != MAP_FAILED) {
+#ifdef MADV_SEQUENTIAL
+				madvise(map, (size_t)st.st_size, MADV_SEQUENTIAL);
+#endif
+				reader->map = (uint8_t *)map;
+				reader->map_size = (size_t)st.st_size;
+				reader->offset = (size_t)pos;
+				return 1;
+			}
+		}
+	}
+#endif
+
+#ifdef ENABLE_PTHREAD
+	nbufs = 2;
+#endif
+	for (i = 0; i < nbufs; i++) {
+#ifdef WIN32
+		reader->bufs[i] = (uint8_t *)malloc(FILE_IO_BLOCK_SIZE);
+#else
+		void *p = NULL;
+		if (posix_memalign(&p, 4096, FILE_IO_BLOCK_SIZE) != 0) {
+			p = NULL;
+		}
+		reader->bufs[i] = (uint8_t *)p;
+#endif
+		if (!reader->bufs[i]) {
+			file_reader_cleanup(reader);
+			error_print();
+			return -1;
+		}
+	}
+#ifdef ENABLE_PTHREAD
+	if (!(reader->thread = malloc(sizeof(FILE_READER_THREAD)))) {
+		file_reader_cleanup(reader);
+		error_print();
+		return -1;
+	}
+	pthread_mutex_init(&((FILE_READER_THREAD *)reader->thread)->lock, NULL);
+	pthread_cond_init(&((FILE_READER_THREAD *)reader->thread)->cond, NULL);
+#endif
+	return 1;
+}
+
+int file_reader_read(FILE_READER *reader, const uint8_t **data, size_t *datalen)
+{
+#ifdef ENABLE_PTHREAD
+	FILE_READER_THREAD *t;
+#endif
+	int ret;
+	size_t len;
+
+	if (!reader || !data || !datalen) {
+		error_print();
+		return -1;
+	}
+	if (reader->eof) {
+		return 0;
+	}
+
+	if (reader->map) {
+		len = reader->map_size - reader->offset;
+		if (!len) {
+			reader->eof = 1;
+			return 0;
+		}
+		if (len > FILE_IO_BLOCK_SIZE) {
+			len = FILE_IO_BLOCK_SIZE;
+		}
+		*data = reader->map + reader->offset;
+		*datalen = len;
+		reader->offset += len;
+		return 1;
+	}
+
+#ifdef ENABLE_PTHREAD
+	t = (FILE_READER_THREAD *)reader->thread;
+	if (!reader->thread_started) {
+		if (pthread_create(&t->thread, NULL, file_reader_routine, reader) != 0) {
+			error_print();
+			return -1;
+		}
+		reader->thread_started = 1;
+	}
+	pthread_mutex_lock(&t->lock);
+	if (reader->cur >= 0) {
+		// the caller is done with the previous block
+		reader->buf_ready[reader->cur] = 0;
+		pthread_cond_signal(&t->cond);
+		reader->cur ^= 1;
+	} else {
+		reader->cur = 0;
+	}
+	while (!reader->buf_ready[reader->cur]) {
+		pthread_cond_wait(&t->cond, &t->lock);
+	}
+	ret = reader->buf_ready[reader->cur];
+	len = reader->buf_lens[reader->cur];
+	pthread_mutex_unlock(&t->lock);
+#else
+	reader->cur = 0;
+	ret = file_reader_fill(reader, reader->bufs[0], &len);
+#endif
+	if (ret != 1) {
+		error_print();
+		return -1;
+	}
+	if (len < FILE_IO_BLOCK_SIZE) {
+		reader->eof = 1;
+		if (!len) {
+			return 0;
+		}
+	}
+	*data = reader->bufs[reader->cur];
+	*datalen = len;
+	return 1;
+}
+
+void file_reader_cleanup(FILE_READER *reader)
+{
+	int i;
+
+	if (!reader) {
+		return;
+	}
+#ifndef WIN32
+	if (reader->map) {
+		munmap(reader->map, reader->map_size);
+		memset(reader, 0, sizeof(*reader));
+		return;
+	}
+#endif
+#ifdef ENABLE_PTHREAD
+	if (reader->thread) {
+		FILE_READER_THREAD *t = (FILE_READER_THREAD *)reader->thread;
+
+		if (reader->thread_started) {
+			pthread_mutex_lock(&t->lock);
+			reader->stop = 1;
+			pthread_cond_broadcast(&t->cond);
+			pthread_mutex_unlock(&t->lock);
+			// interrupt a read still blocked on a pipe
+			pthread_cancel(t->thread);
+			pthread_join(t->thread, NULL);
+		}
+		pthread_cond_destroy(&t->cond);
+		pthread_mutex_destroy(&t->lock);
+		free(t);
+	}
+#endif
+	for (i = 0; i < 2; i++) {
+		if (reader->bufs[i]) {
+			gmssl_secure_clear(reader->bufs[i], FILE_IO_BLOCK_SIZE);
+			free(reader->bufs[i]);
+		}
+	}
+	memset(reader, 0, sizeof(*reader));
+}
+
+int file_write(FILE *fp, const uint8_t *data, size_t datalen)
+{
+#ifdef WIN32
+	if (fwrite(data, 1, datalen, fp) != datalen) {
+		error_print();
+		return -1;
+	}
+#else
+	int fd = fileno(fp);
+
+	// keep the order of anything written with stdio before
+	if (fflush(fp) != 0) {
+		error_print();
+		return -1;
+	}
+	while (datalen) {
+		ssize_t n = write(fd, data, datalen);
+		if (n < 0) {
+			if (errno == EINTR) {
+				continue;
+			}
+			error_print();
+			return -1;
+		}
+		data += n;
+		datalen -= (size_t)n;
+	}
+#endif
+	return 1;
+}
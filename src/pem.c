@@ -13,6 +13,7 @@
 #include <stdlib.h>
 #include <limits.h>
 #include <gmssl/pem.h>
+#include <gmssl/mem.h>
 #include <gmssl/error.h>
 
 
@@ -125,3 +126,288 @@ int pem_read(FILE *fp, const char *name, uint8_t *data, size_t *datalen, size_t
 	*datalen += len;
 	return 1;
 }
+
+int pem_write_init(PEM_CTX *ctx, FILE *fp, const char *name)
+{
+	if (!ctx || !fp || !name) {
+		error_print();
+		return -1;
+	}
+	ctx->fp = fp;
+	ctx->name = name;
+	ctx->end = 0;
+	base64_encode_init(&ctx->base64_ctx);
+	if (fprintf(fp, "-----BEGIN %s-----\n", name) < 0) {
+		error_print();
+		return -1;
+	}
+	return 1;
+}
+
+int pem_write_update(PEM_CTX *ctx, const uint8_t *in, size_t inlen)
+{
+	uint8_t out[BASE64_ENCODE_LENGTH(3072)];
+	int len, outlen;
+
+	while (inlen) {
+		len = inlen < 3072 ? (int)inlen : 3072;
+		base64_encode_update(&ctx->base64_ctx, in, len, out, &outlen);
+		if (fwrite(out, 1, outlen, ctx->fp) != (size_t)outlen) {
+			error_print();
+			return -1;
+		}
+		in += len;
+		inlen -= len;
+	}
+	return 1;
+}
+
+int pem_write_finish(PEM_CTX *ctx)
+{
+	uint8_t out[168];
+	int outlen;
+
+	base64_encode_finish(&ctx->base64_ctx, out, &outlen);
+	if (fwrite(out, 1, outlen, ctx->fp) != (size_t)outlen
+		|| fprintf(ctx->fp, "-----END %s-----\n", ctx->name) < 0) {
+		error_print();
+		return -1;
+	}
+	return 1;
+}
+
+int pem_read_init(PEM_CTX *ctx, FILE *fp, const char *name)
+{
+	char line[80];
+	char begin_line[80];
+
+	if (!ctx || !fp || !name) {
+		error_print();
+		return -1;
+	}
+	snprintf(begin_line, sizeof(begin_line), "-----BEGIN %s-----", name);
+
+	if (!fgets(line, sizeof(line), fp)) {
+		if (feof(fp)) {
+			return 0;
+		} else {
+			error_print();
+			return -1;
+		}
+	}
+	remove_newline(line);
+	if (strcmp(line, begin_line) != 0) {
+		error_print();
+		return -1;
+	}
+	ctx->fp = fp;
+	ctx->name = name;
+	ctx->end = 0;
+	base64_decode_init(&ctx->base64_ctx);
+	return 1;
+}
+
+int pem_read_update(PEM_CTX *ctx, uint8_t *out, size_t *outlen, size_t maxlen)
+{
+	char line[80];
+	char end_line[80];
+	int len;
+
+	if (!ctx || !out || !outlen) {
+		error_print();
+		return -1;
+	}
+	*outlen = 0;
+	if (ctx->end) {
+		return 0;
+	}
+	if (maxlen < sizeof(line)) {
+		error_print();
+		return -1;
+	}
+	snprintf(end_line, sizeof(end_line), "-----END %s-----", ctx->name);
+
+	// every line decodes to less than sizeof(line) bytes
+	while (maxlen - *outlen >= sizeof(line)) {
+		if (!fgets(line, sizeof(line), ctx->fp)) {
+			error_print();
+			return -1;
+		}
+		remove_newline(line);
+
+		if (strcmp(line, end_line) == 0) {
+			if (base64_decode_finish(&ctx->base64_ctx, out, &len) < 0) {
+				error_print();
+				return -1;
+			}
+			*outlen += len;
+			ctx->end = 1;
+			break;
+		}
+		if (base64_decode_update(&ctx->base64_ctx, (uint8_t *)line, (int)strlen(line), out, &len) < 0) {
+			error_print();
+			return -1;
+		}
+		out += len;
+		*outlen += len;
+	}
+	return *outlen ? 1 : 0;
+}
+
+static const uint8_t *pem_find(const uint8_t *d, size_t dlen, const char *s, size_t slen)
+{
+	const uint8_t *end = d + dlen;
+
+	while ((size_t)(end - d) >= slen) {
+		if (!(d = memchr(d, s[0], (end - d) - slen + 1))) {
+			return NULL;
+		}
+		if (memcmp(d, s, slen) == 0) {
+			return d;
+		}
+		d++;
+	}
+	return NULL;
+}
+
+// offset of the next line, skip "\n" or "\r\n"
+static size_t pem_skip_newline(const uint8_t *d, size_t dlen, size_t offset)
+{
+	if (offset < dlen && d[offset] == '\r') {
+		offset++;
+	}
+	if (offset < dlen && d[offset] == '\n') {
+		offset++;
+	}
+	return offset;
+}
+
+int pem_iter_init(PEM_ITER *iter, const uint8_t *data, size_t datalen)
+{
+	if (!iter || (!data && datalen)) {
+		error_print();
+		return -1;
+	}
+	memset(iter, 0, sizeof(*iter));
+	iter->data = data;
+	iter->datalen = datalen;
+	return 1;
+}
+
+int pem_iter_next(PEM_ITER *iter, const char **name, const uint8_t **der, size_t *derlen)
+{
+	const char begin_prefix[] = "-----BEGIN ";
+	const char dashes[] = "-----";
+	const uint8_t *d;
+	size_t dlen;
+	const uint8_t *begin;
+	const uint8_t *label;
+	const uint8_t *label_end;
+	const uint8_t *body;
+	const uint8_t *end;
+	char end_line[sizeof("\n-----END -----") + PEM_MAX_NAME_SIZE];
+	size_t end_line_len;
+	size_t bodylen;
+	size_t maxlen;
+	size_t len = 0;
+	BASE64_CTX ctx;
+	int outlen;
+
+	if (!iter || !name || !der || !derlen) {
+		error_print();
+		return -1;
+	}
+	d = iter->data + iter->offset;
+	dlen = iter->datalen - iter->offset;
+
+	// BEGIN line, must be at the start of a line
+	for (;;) {
+		if (!(begin = pem_find(d, dlen, begin_prefix, sizeof(begin_prefix) - 1))) {
+			iter->offset = iter->datalen;
+			return 0;
+		}
+		if (begin == iter->data || begin[-1] == '\n') {
+			break;
+		}
+		dlen -= (begin + 1) - d;
+		d = begin + 1;
+	}
+	label = begin + sizeof(begin_prefix) - 1;
+	dlen -= label - d;
+	if (!(label_end = pem_find(label, dlen, dashes, sizeof(dashes) - 1))
+		|| label_end == label
+		|| (size_t)(label_end - label) >= sizeof(iter->name)
+		|| memchr(label, '\n', label_end - label)) {
+		error_print();
+		return -1;
+	}
+	memcpy(iter->name, label, label_end - label);
+	iter->name[label_end - label] = 0;
+	body = label_end + sizeof(dashes) - 1;
+	if (body >= iter->data + iter->datalen || (*body != '\r' && *body != '\n')) {
+		error_print();
+		return -1;
+	}
+	body = iter->data + pem_skip_newline(iter->data, iter->datalen, body - iter->data);
+
+	// END line with the same label
+	end_line_len = (size_t)snprintf(end_line, sizeof(end_line), "\n-----END %s-----", iter->name);
+	if (!(end = pem_find(body - 1, (iter->data + iter->datalen) - (body - 1), end_line, end_line_len))) {
+		error_print();
+		return -1;
+	}
+	bodylen = end - body + 1;
+
+	maxlen = (bodylen / 4) * 3 + 3;
+	if (maxlen > iter->der_maxlen) {
+		uint8_t *p;
+		if (!(p = (uint8_t *)malloc(maxlen))) {
+			error_print();
+			return -1;
+		}
+		if (iter->der) {
+			gmssl_secure_clear(iter->der, iter->der_maxlen);
+			free(iter->der);
+		}
+		iter->der = p;
+		iter->der_maxlen = maxlen;
+	}
+
+	base64_decode_init(&ctx);
+	while (bodylen) {
+		int inlen = bodylen < INT_MAX / 2 ? (int)bodylen : INT_MAX / 2;
+		if (base64_decode_update(&ctx, body, inlen, iter->der + len, &outlen) < 0) {
+			error_print();
+			return -1;
+		}
+		len += outlen;
+		body += inlen;
+		bodylen -= inlen;
+	}
+	if (base64_decode_finish(&ctx, iter->der + len, &outlen) != 1) {
+		error_print();
+		return -1;
+	}
+	len += outlen;
+	if (!len) {
+		error_print();
+		return -1;
+	}
+
+	iter->offset = pem_skip_newline(iter->data, iter->datalen, (end + end_line_len) - iter->data);
+	*name = iter->name;
+	*der = iter->der;
+	*derlen = len;
+	return 1;
+}
+
+void pem_iter_cleanup(PEM_ITER *iter)
+{
+	if (iter) {
+		if (iter->der) {
+			gmssl_secure_clear(iter->der, iter->der_maxlen);
+			free(iter->der);
+		}
+		memset(iter, 0, sizeof(*iter));
+	}
+}
@@ -16,7 +16,7 @@
 
 #define RAND_MAX_BUF_SIZE 4096
 
-int rand_bytes(uint8_t *buf, size_t len)
+int rand_os_bytes(uint8_t *buf, size_t len)
 {
 	FILE *fp;
 	if (!buf) {
@@ -16,12 +16,11 @@
 #include <Security/Security.h> // clang -framework Security
 
 
-int rand_bytes(uint8_t *buf, size_t len)
+int rand_os_bytes(uint8_t *buf, size_t len)
 {
 	int errCode;
 	if ((errCode = SecRandomCopyBytes(kSecRandomDefault, len, buf)) != errSecSuccess) {
-		error_print();
-		fprintf(stderr, "%s:%d: SecRandomCopyBytes() return OSStatus = %d\n", __FILE__, __LINE__, errCode);
+		error_print_msg("SecRandomCopyBytes() return OSStatus = %d\n", (int)errCode);
 		/*
 		CFStringRef errStr;
 		errStr = SecCopyErrorMessageString(errCode, NULL);
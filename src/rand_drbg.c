@@ -0,0 +1,248 @@
+/*
+ *  Copyright 2014-2024 The GmSSL Project. All Rights Reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the License); you may
+ *  not use this file except in compliance with the License.
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+
+#include <time.h>
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+#include <gmssl/rand.h>
+#include <gmssl/sm4_drbg.h>
+#include <gmssl/mem.h>
+#include <gmssl/error.h>
+#ifdef ENABLE_INTEL_RDRAND
+#include <gmssl/rdrand.h>
+#endif
+#if defined(ENABLE_RAND_DRBG) && !defined(WIN32)
+#include <pthread.h>
+#endif
+
+
+#ifdef ENABLE_RAND_DRBG
+
+#ifdef WIN32
+#define RAND_THREAD_LOCAL	__declspec(thread)
+#else
+#define RAND_THREAD_LOCAL	__thread
+#endif
+
+#define RAND_ENTROPY_SIZE	48
+#define RAND_HW_INPUT_SIZE	32
+#define RAND_BUF_SIZE		1024
+
+// small requests are served from buf, the bytes are wiped once returned
+typedef struct {
+	SM4_DRBG drbg;
+	unsigned int fork_count;
+	int seeded;
+	uint8_t buf[RAND_BUF_SIZE];
+	size_t buf_len; // unused bytes at the end of buf
+} RAND_STATE;
+
+static RAND_THREAD_LOCAL RAND_STATE rand_state;
+
+// only changed in the child of fork(), where the forking thread is the only thread
+static volatile unsigned int rand_fork_count = 0;
+
+#ifndef WIN32
+// the destructor wipes the state of a thread when it exits
+static pthread_key_t rand_state_key;
+static int rand_state_key_created = 0;
+
+static void rand_atfork_child(void)
+{
+	rand_fork_count++;
+}
+
+static void rand_state_free(void *p)
+{
+	RAND_STATE *state = (RAND_STATE *)p;
+
+	sm4_drbg_cleanup(&state->drbg);
+	gmssl_secure_clear(state, sizeof(RAND_STATE));
+}
+
+__attribute__((constructor))
+static void rand_init(void)
+{
+	pthread_atfork(NULL, NULL, rand_atfork_child);
+	if (pthread_key_create(&rand_state_key, rand_state_free) == 0) {
+		rand_state_key_created = 1;
+	}
+}
+#endif
+
+// RDSEED/RDRAND output is only mixed in as additional input, never the only source
+static size_t rand_hw_bytes(uint8_t buf[RAND_HW_INPUT_SIZE])
+{
+#ifdef ENABLE_INTEL_RDSEED
+	if (rdseed_bytes(buf, RAND_HW_INPUT_SIZE) == 1) {
+		return RAND_HW_INPUT_SIZE;
+	}
+#endif
+#ifdef ENABLE_INTEL_RDRAND
+	if (rdrand_bytes(buf, RAND_HW_INPUT_SIZE) == 1) {
+		return RAND_HW_INPUT_SIZE;
+	}
+#endif
+	(void)buf;
+	return 0;
+}
+
+static int rand_state_seed(RAND_STATE *state)
+{
+	static const char personalstr[] = "GmSSL rand_bytes";
+	uint8_t entropy[RAND_ENTROPY_SIZE];
+	uint8_t hw[RAND_HW_INPUT_SIZE];
+	size_t hwlen;
+	struct {
+		time_t t;
+		clock_t c;
+		const void *p;
+		unsigned int fork_count;
+		uint8_t hw[RAND_HW_INPUT_SIZE];
+	} nonce;
+	int ret = -1;
+
+	if (rand_os_bytes(entropy, sizeof(entropy)) != 1) {
+		error_print();
+		return -1;
+	}
+	hwlen = rand_hw_bytes(hw);
+
+	if (!state->seeded || state->fork_count != rand_fork_count) {
+		// the thread address tells apart threads seeded in the same clock tick
+		memset(&nonce, 0, sizeof(nonce));
+		nonce.t = time(NULL);
+		nonce.c = clock();
+		nonce.p = state;
+		nonce.fork_count = rand_fork_count;
+		memcpy(nonce.hw, hw, hwlen);
+
+		if (sm4_drbg_init(&state->drbg, entropy, sizeof(entropy),
+			(uint8_t *)&nonce, sizeof(nonce),
+			(const uint8_t *)personalstr, sizeof(personalstr) - 1) != 1) {
+			error_print();
+			goto end;
+		}
+		state->fork_count = rand_fork_count;
+		state->seeded = 1;
+#ifndef WIN32
+		if (rand_state_key_created) {
+			pthread_setspecific(rand_state_key, state);
+		}
+#endif
+	} else {
+		if (sm4_drbg_reseed(&state->drbg, entropy, sizeof(entropy), hw, hwlen) != 1) {
+			error_print();
+			goto end;
+		}
+	}
+	ret = 1;
+end:
+	if (ret != 1) {
+		sm4_drbg_cleanup(&state->drbg);
+		state->seeded = 0;
+	}
+	// never return output generated before the reseed or by the parent process
+	gmssl_secure_clear(state->buf, sizeof(state->buf));
+	state->buf_len = 0;
+	gmssl_secure_clear(entropy, sizeof(entropy));
+	gmssl_secure_clear(hw, sizeof(hw));
+	gmssl_secure_clear(&nonce, sizeof(nonce));
+	return ret;
+}
+
+int rand_bytes(uint8_t *buf, size_t len)
+{
+	RAND_STATE *state = &rand_state;
+
+	if (!buf) {
+		error_print();
+		return -1;
+	}
+	if (!len) {
+		error_print();
+		return -1;
+	}
+
+	while (len) {
+		size_t n;
+
+		if (!state->seeded || state->fork_count != rand_fork_count) {
+			if (rand_state_seed(state) != 1) {
+				error_print();
+				return -1;
+			}
+		}
+
+		if (len >= RAND_BUF_SIZE) {
+			n = len < SM4_DRBG_MAX_REQUEST_SIZE ? len : SM4_DRBG_MAX_REQUEST_SIZE;
+			if (sm4_drbg_need_reseed(&state->drbg)
+				&& rand_state_seed(state) != 1) {
+				error_print();
+				return -1;
+			}
+			if (sm4_drbg_generate(&state->drbg, NULL, 0, buf, n) != 1) {
+				error_print();
+				return -1;
+			}
+		} else {
+			uint8_t *p;
+
+			if (!state->buf_len) {
+				if (sm4_drbg_need_reseed(&state->drbg)
+					&& rand_state_seed(state) != 1) {
+					error_print();
+					return -1;
+				}
+				if (sm4_drbg_generate(&state->drbg, NULL, 0, state->buf, RAND_BUF_SIZE) != 1) {
+					error_print();
+					return -1;
+				}
+				state->buf_len = RAND_BUF_SIZE;
+			}
+			n = len < state->buf_len ? len : state->buf_len;
+			p = state->buf + RAND_BUF_SIZE - state->buf_len;
+			memcpy(buf, p, n);
+			gmssl_secure_clear(p, n);
+			state->buf_len -= n;
+		}
+		buf += n;
+		len -= n;
+	}
+	return 1;
+}
+
+#else
+
+int rand_bytes(uint8_t *buf, size_t len)
+{
+	if (!buf) {
+		error_print();
+		return -1;
+	}
+	if (!len) {
+		error_print();
+		return -1;
+	}
+	while (len) {
+		size_t n = len < RAND_BYTES_MAX_SIZE ? len : RAND_BYTES_MAX_SIZE;
+
+		if (rand_os_bytes(buf, n) != 1) {
+			error_print();
+			return -1;
+		}
+		buf += n;
+		len -= n;
+	}
+	return 1;
+}
+
+#endif
@@ -23,7 +23,7 @@
 
 #define RAND_MAX_BUF_SIZE 256 // requirement of getentropy()
 
-int rand_bytes(uint8_t *buf, size_t len)
+int rand_os_bytes(uint8_t *buf, size_t len)
 {
 	if (!buf) {
 		error_print();
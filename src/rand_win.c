@@ -13,10 +13,11 @@
 #include <limits.h>
 #include <windows.h>
 #include <wincrypt.h>
+#include <gmssl/rand.h>
 #include <gmssl/error.h>
 
 
-int rand_bytes(uint8_t *buf, size_t len)
+int rand_os_bytes(uint8_t *buf, size_t len)
 {
 	HCRYPTPROV hCryptProv;
 	int ret = -1;
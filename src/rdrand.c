@@ -32,7 +32,7 @@ int rdrand_bytes(uint8_t *buf, size_t buflen)
 	return 1;
 }
 
-#ifdef INTEL_RDSEED
+#ifdef ENABLE_INTEL_RDSEED
 int rdseed_bytes(uint8_t *buf, size_t buflen)
 {
 	unsigned long long val;
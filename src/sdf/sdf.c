@@ -918,7 +918,7 @@ int sdf_sign_reset(SDF_SIGN_CTX *ctx)
 	return 1;
 }
 
-int sdf_release_key(SDF_PRIVATE_KEY *key)
+int sdf_release_private_key(SDF_PRIVATE_KEY *key)
 {
 	if (SDF_ReleasePrivateKeyAccessRight(key->session, key->index) != SDR_OK) {
 		error_print();
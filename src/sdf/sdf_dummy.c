@@ -0,0 +1,387 @@
+/*
+ *  Copyright 2014-2024 The GmSSL Project. All Rights Reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the License); you may
+ *  not use this file except in compliance with the License.
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+/*
+ * Software stand-in of an SDF cipher card, for testing without a device.
+ *
+ * Keys 1 to SDF_DUMMY_MAX_KEY_INDEX hold an SM2 signing key and an SM2
+ * encryption key generated when the device is first opened, any non-empty
+ * password gives the access right. The environment variable SDF_DUMMY_LATENCY
+ * (microseconds) is added to every private key operation to emulate the round
+ * trip to the card. Like a real card a session serves one request at a time,
+ * a request on a session that is already busy fails with SDR_COMMFAIL.
+ *
+ * The functions of this library must not call each other through the SDF_
+ * symbols, which are also exported by libgmssl.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#ifdef WIN32
+#include <windows.h>
+#else
+#include <unistd.h>
+#endif
+#include <gmssl/sm2.h>
+#include <gmssl/sm3.h>
+#include <gmssl/rand.h>
+#include "sdf.h"
+
+
+#define SDF_DUMMY_MAX_KEY_INDEX		4
+#define SDF_DUMMY_SESSION_MAGIC		0x53444653
+
+typedef struct {
+	unsigned int magic;
+	volatile int busy;
+	unsigned int access_rights; // bit i for key index i
+	SM3_CTX sm3_ctx;
+} SDF_DUMMY_SESSION;
+
+static char *dummy_device_handle = "hDeviceHandle";
+static int dummy_keys_generated = 0;
+static SM2_KEY dummy_sign_keys[SDF_DUMMY_MAX_KEY_INDEX + 1];
+static SM2_KEY dummy_enc_keys[SDF_DUMMY_MAX_KEY_INDEX + 1];
+static unsigned long dummy_latency = 0;
+
+#if defined(__GNUC__) || defined(__clang__)
+#define dummy_session_lock(s)	(__sync_lock_test_and_set(&(s)->busy, 1) == 0)
+#define dummy_session_unlock(s)	__sync_lock_release(&(s)->busy)
+#else
+#define dummy_session_lock(s)	((s)->busy ? 0 : ((s)->busy = 1))
+#define dummy_session_unlock(s)	((s)->busy = 0)
+#endif
+
+
+static void dummy_sleep(void)
+{
+	if (dummy_latency) {
+#ifdef WIN32
+		Sleep((DWORD)((dummy_latency + 999) / 1000));
+#else
+		usleep((useconds_t)dummy_latency);
+#endif
+	}
+}
+
+static SDF_DUMMY_SESSION *dummy_session(void *hSessionHandle)
+{
+	SDF_DUMMY_SESSION *session = hSessionHandle;
+	if (!session || session->magic != SDF_DUMMY_SESSION_MAGIC) {
+		return NULL;
+	}
+	return session;
+}
+
+static void dummy_point_to_ecc_public_key(const SM2_KEY *key, ECCrefPublicKey *ref)
+{
+	SM2_POINT point;
+
+	sm2_z256_point_to_bytes(&key->public_key, (uint8_t *)&point);
+	memset(ref, 0, sizeof(ECCrefPublicKey));
+	ref->bits = 256;
+	memcpy(ref->x + ECCref_MAX_LEN - 32, point.x, 32);
+	memcpy(ref->y + ECCref_MAX_LEN - 32, point.y, 32);
+}
+
+int SDF_OpenDevice(
+	void **phDeviceHandle)
+{
+	const char *latency;
+	int i;
+
+	if (!phDeviceHandle) {
+		return SDR_INARGERR;
+	}
+	if (!dummy_keys_generated) {
+		for (i = 1; i <= SDF_DUMMY_MAX_KEY_INDEX; i++) {
+			if (sm2_key_generate(&dummy_sign_keys[i]) != 1
+				|| sm2_key_generate(&dummy_enc_keys[i]) != 1) {
+				return SDR_HARDFAIL;
+			}
+		}
+		dummy_keys_generated = 1;
+	}
+	if ((latency = getenv("SDF_DUMMY_LATENCY")) != NULL) {
+		dummy_latency = strtoul(latency, NULL, 10);
+	}
+	*phDeviceHandle = dummy_device_handle;
+	return SDR_OK;
+}
+
+int SDF_CloseDevice(
+	void *hDeviceHandle)
+{
+	return SDR_OK;
+}
+
+int SDF_OpenSession(
+	void *hDeviceHandle,
+	void **phSessionHandle)
+{
+	SDF_DUMMY_SESSION *session;
+
+	if (hDeviceHandle != dummy_device_handle || !phSessionHandle) {
+		return SDR_INARGERR;
+	}
+	if (!(session = calloc(1, sizeof(SDF_DUMMY_SESSION)))) {
+		return SDR_NOBUFFER;
+	}
+	session->magic = SDF_DUMMY_SESSION_MAGIC;
+	*phSessionHandle = session;
+	return SDR_OK;
+}
+
+int SDF_CloseSession(
+	void *hSessionHandle)
+{
+	SDF_DUMMY_SESSION *session;
+
+	if (!(session = dummy_session(hSessionHandle))) {
+		return SDR_INARGERR;
+	}
+	memset(session, 0, sizeof(SDF_DUMMY_SESSION));
+	free(session);
+	return SDR_OK;
+}
+
+int SDF_GetDeviceInfo(
+	void *hSessionHandle,
+	DEVICEINFO *pstDeviceInfo)
+{
+	if (!dummy_session(hSessionHandle) || !pstDeviceInfo) {
+		return SDR_INARGERR;
+	}
+	memset(pstDeviceInfo, 0, sizeof(DEVICEINFO));
+	memcpy(pstDeviceInfo->IssuerName, "GmSSL Project", strlen("GmSSL Project"));
+	memcpy(pstDeviceInfo->DeviceName, "SDF Dummy", strlen("SDF Dummy"));
+	memcpy(pstDeviceInfo->DeviceSerial, "2024010100100001", 16);
+	pstDeviceInfo->DeviceVersion = 1;
+	pstDeviceInfo->StandardVersion = 1;
+	pstDeviceInfo->AsymAlgAbility[0] = SGD_SM2_1 | SGD_SM2_3;
+	pstDeviceInfo->AsymAlgAbility[1] = 256;
+	pstDeviceInfo->HashAlgAbility = SGD_SM3;
+	pstDeviceInfo->BufferSize = 1024 * 1024;
+	return SDR_OK;
+}
+
+int SDF_GenerateRandom(
+	void *hSessionHandle,
+	unsigned int uiLength,
+	unsigned char *pucRandom)
+{
+	if (!dummy_session(hSessionHandle) || !pucRandom) {
+		return SDR_INARGERR;
+	}
+	if (uiLength && rand_bytes(pucRandom, uiLength) != 1) {
+		return SDR_RANDERR;
+	}
+	return SDR_OK;
+}
+
+int SDF_GetPrivateKeyAccessRight(
+	void *hSessionHandle,
+	unsigned int uiKeyIndex,
+	unsigned char *pucPassword,
+	unsigned int uiPwdLength)
+{
+	SDF_DUMMY_SESSION *session;
+
+	if (!(session = dummy_session(hSessionHandle))) {
+		return SDR_INARGERR;
+	}
+	if (uiKeyIndex < 1 || uiKeyIndex > SDF_DUMMY_MAX_KEY_INDEX) {
+		return SDR_KEYNOTEXIST;
+	}
+	if (!pucPassword || !uiPwdLength) {
+		return SDR_PARDENY;
+	}
+	session->access_rights |= 1u << uiKeyIndex;
+	return SDR_OK;
+}
+
+int SDF_ReleasePrivateKeyAccessRight(
+	void *hSessionHandle,
+	unsigned int uiKeyIndex)
+{
+	SDF_DUMMY_SESSION *session;
+
+	if (!(session = dummy_session(hSessionHandle))) {
+		return SDR_INARGERR;
+	}
+	if (uiKeyIndex < 1 || uiKeyIndex > SDF_DUMMY_MAX_KEY_INDEX) {
+		return SDR_KEYNOTEXIST;
+	}
+	session->access_rights &= ~(1u << uiKeyIndex);
+	return SDR_OK;
+}
+
+int SDF_ExportSignPublicKey_ECC(
+	void *hSessionHandle,
+	unsigned int uiKeyIndex,
+	ECCrefPublicKey *pucPublicKey)
+{
+	if (!dummy_session(hSessionHandle) || !pucPublicKey) {
+		return SDR_INARGERR;
+	}
+	if (uiKeyIndex < 1 || uiKeyIndex > SDF_DUMMY_MAX_KEY_INDEX) {
+		return SDR_KEYNOTEXIST;
+	}
+	dummy_point_to_ecc_public_key(&dummy_sign_keys[uiKeyIndex], pucPublicKey);
+	return SDR_OK;
+}
+
+int SDF_ExportEncPublicKey_ECC(
+	void *hSessionHandle,
+	unsigned int uiKeyIndex,
+	ECCrefPublicKey *pucPublicKey)
+{
+	if (!dummy_session(hSessionHandle) || !pucPublicKey) {
+		return SDR_INARGERR;
+	}
+	if (uiKeyIndex < 1 || uiKeyIndex > SDF_DUMMY_MAX_KEY_INDEX) {
+		return SDR_KEYNOTEXIST;
+	}
+	dummy_point_to_ecc_public_key(&dummy_enc_keys[uiKeyIndex], pucPublicKey);
+	return SDR_OK;
+}
+
+int SDF_InternalSign_ECC(
+	void *hSessionHandle,
+	unsigned int uiISKIndex,
+	unsigned char *pucData,
+	unsigned int uiDataLength,
+	ECCSignature *pucSignature)
+{
+	SDF_DUMMY_SESSION *session;
+	SM2_SIGNATURE sig;
+	int ret = SDR_OK;
+
+	if (!(session = dummy_session(hSessionHandle)) || !pucData || !pucSignature) {
+		return SDR_INARGERR;
+	}
+	if (uiISKIndex < 1 || uiISKIndex > SDF_DUMMY_MAX_KEY_INDEX) {
+		return SDR_KEYNOTEXIST;
+	}
+	if (!(session->access_rights & (1u << uiISKIndex))) {
+		return SDR_PRKRERR;
+	}
+	if (uiDataLength != SM3_DIGEST_SIZE) {
+		return SDR_INARGERR;
+	}
+	if (!dummy_session_lock(session)) {
+		return SDR_COMMFAIL;
+	}
+
+	dummy_sleep();
+	if (sm2_do_sign(&dummy_sign_keys[uiISKIndex], pucData, &sig) != 1) {
+		ret = SDR_SIGNERR;
+	} else {
+		memset(pucSignature, 0, sizeof(ECCSignature));
+		memcpy(pucSignature->r + ECCref_MAX_LEN - 32, sig.r, 32);
+		memcpy(pucSignature->s + ECCref_MAX_LEN - 32, sig.s, 32);
+	}
+
+	dummy_session_unlock(session);
+	return ret;
+}
+
+int SDF_InternalDecrypt_ECC(
+	void *hSessionHandle,
+	unsigned int uiISKIndex,
+	unsigned int uiAlgID,
+	ECCCipher *pucEncData,
+	unsigned char *pucData,
+	unsigned int *puiDataLength)
+{
+	SDF_DUMMY_SESSION *session;
+	SM2_CIPHERTEXT ciphertext;
+	size_t len;
+	int ret = SDR_OK;
+
+	if (!(session = dummy_session(hSessionHandle)) || !pucEncData || !pucData || !puiDataLength) {
+		return SDR_INARGERR;
+	}
+	if (uiISKIndex < 1 || uiISKIndex > SDF_DUMMY_MAX_KEY_INDEX) {
+		return SDR_KEYNOTEXIST;
+	}
+	if (!(session->access_rights & (1u << uiISKIndex))) {
+		return SDR_PRKRERR;
+	}
+	if (uiAlgID != SGD_SM2_3 || pucEncData->L < 1 || pucEncData->L > SM2_MAX_PLAINTEXT_SIZE) {
+		return SDR_INARGERR;
+	}
+	if (!dummy_session_lock(session)) {
+		return SDR_COMMFAIL;
+	}
+
+	memcpy(ciphertext.point.x, pucEncData->x + ECCref_MAX_LEN - 32, 32);
+	memcpy(ciphertext.point.y, pucEncData->y + ECCref_MAX_LEN - 32, 32);
+	memcpy(ciphertext.hash, pucEncData->M, 32);
+	memcpy(ciphertext.ciphertext, pucEncData->C, pucEncData->L);
+	ciphertext.ciphertext_size = pucEncData->L;
+
+	dummy_sleep();
+	if (sm2_do_decrypt(&dummy_enc_keys[uiISKIndex], &ciphertext, pucData, &len) != 1) {
+		ret = SDR_SKOPERR;
+	} else {
+		*puiDataLength = (unsigned int)len;
+	}
+
+	dummy_session_unlock(session);
+	return ret;
+}
+
+int SDF_HashInit(
+	void *hSessionHandle,
+	unsigned int uiAlgID,
+	ECCrefPublicKey *pucPublicKey,
+	unsigned char *pucID,
+	unsigned int uiIDLength)
+{
+	SDF_DUMMY_SESSION *session;
+
+	if (!(session = dummy_session(hSessionHandle))) {
+		return SDR_INARGERR;
+	}
+	if (uiAlgID != SGD_SM3 || pucPublicKey) {
+		return SDR_ALGNOTSUPPORT;
+	}
+	sm3_init(&session->sm3_ctx);
+	return SDR_OK;
+}
+
+int SDF_HashUpdate(
+	void *hSessionHandle,
+	unsigned char *pucData,
+	unsigned int uiDataLength)
+{
+	SDF_DUMMY_SESSION *session;
+
+	if (!(session = dummy_session(hSessionHandle)) || (!pucData && uiDataLength)) {
+		return SDR_INARGERR;
+	}
+	sm3_update(&session->sm3_ctx, pucData, uiDataLength);
+	return SDR_OK;
+}
+
+int SDF_HashFinal(void *hSessionHandle,
+	unsigned char *pucHash,
+	unsigned int *puiHashLength)
+{
+	SDF_DUMMY_SESSION *session;
+
+	if (!(session = dummy_session(hSessionHandle)) || !pucHash || !puiHashLength) {
+		return SDR_INARGERR;
+	}
+	sm3_finish(&session->sm3_ctx, pucHash);
+	*puiHashLength = SM3_DIGEST_SIZE;
+	return SDR_OK;
+}
@@ -0,0 +1,365 @@
+/*
+ *  Copyright 2014-2024 The GmSSL Project. All Rights Reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the License); you may
+ *  not use this file except in compliance with the License.
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+#include <gmssl/sdf.h>
+#include <gmssl/error.h>
+#ifdef ENABLE_PTHREAD
+#include <pthread.h>
+#endif
+
+
+struct SDF_SESSION_POOL {
+	SDF_PRIVATE_KEY keys[SDF_POOL_MAX_SESSIONS]; // one session for each
+	int busy[SDF_POOL_MAX_SESSIONS];
+	size_t num_sessions;
+	size_t num_workers;
+	SDF_POOL_STATS stats;
+#ifdef ENABLE_PTHREAD
+	pthread_mutex_t lock;
+	pthread_cond_t session_cond;
+	pthread_cond_t queue_cond;
+	pthread_cond_t done_cond;
+	SDF_POOL_REQUEST *queue[SDF_POOL_QUEUE_SIZE];
+	size_t queue_head;
+	size_t queue_num;
+	pthread_t workers[SDF_POOL_MAX_WORKERS];
+	int stop;
+#endif
+};
+
+#ifdef ENABLE_PTHREAD
+
+#ifdef WIN32
+#define SDF_POOL_THREAD_LOCAL	__declspec(thread)
+#else
+#define SDF_POOL_THREAD_LOCAL	__thread
+#endif
+
+// the session used last by this thread
+static SDF_POOL_THREAD_LOCAL const SDF_SESSION_POOL *sdf_pool_last_pool = NULL;
+static SDF_POOL_THREAD_LOCAL size_t sdf_pool_last_index = 0;
+
+#define sdf_pool_lock(pool)	pthread_mutex_lock(&(pool)->lock)
+#define sdf_pool_unlock(pool)	pthread_mutex_unlock(&(pool)->lock)
+#else
+#define sdf_pool_lock(pool)
+#define sdf_pool_unlock(pool)
+#endif
+
+
+static int sdf_pool_acquire(SDF_SESSION_POOL *pool, size_t *index)
+{
+	size_t i;
+	int waited = 0;
+
+	sdf_pool_lock(pool);
+	for (;;) {
+#ifdef ENABLE_PTHREAD
+		if (sdf_pool_last_pool == pool
+			&& sdf_pool_last_index < pool->num_sessions
+			&& !pool->busy[sdf_pool_last_index]) {
+			i = sdf_pool_last_index;
+			pool->stats.affinity_hits++;
+			break;
+		}
+#endif
+		for (i = 0; i < pool->num_sessions; i++) {
+			if (!pool->busy[i]) {
+				break;
+			}
+		}
+		if (i < pool->num_sessions) {
+			break;
+		}
+		if (!waited) {
+			pool->stats.session_waits++;
+			waited = 1;
+		}
+#ifdef ENABLE_PTHREAD
+		pthread_cond_wait(&pool->session_cond, &pool->lock);
+#else
+		// only a reentrant call finds all the sessions busy
+		error_print();
+		return -1;
+#endif
+	}
+	pool->busy[i] = 1;
+	pool->stats.busy_sessions++;
+	if (pool->stats.busy_sessions > pool->stats.max_busy_sessions) {
+		pool->stats.max_busy_sessions = pool->stats.busy_sessions;
+	}
+	sdf_pool_unlock(pool);
+
+#ifdef ENABLE_PTHREAD
+	sdf_pool_last_pool = pool;
+	sdf_pool_last_index = i;
+#endif
+	*index = i;
+	return 1;
+}
+
+static void sdf_pool_release(SDF_SESSION_POOL *pool, size_t index, int ret)
+{
+	sdf_pool_lock(pool);
+	pool->busy[index] = 0;
+	pool->stats.busy_sessions--;
+	pool->stats.requests++;
+	if (ret != 1) {
+		pool->stats.errors++;
+	}
+#ifdef ENABLE_PTHREAD
+	pthread_cond_signal(&pool->session_cond);
+#endif
+	sdf_pool_unlock(pool);
+}
+
+int sdf_pool_sign(SDF_SESSION_POOL *pool, const uint8_t dgst[32], uint8_t *sig, size_t *siglen)
+{
+	size_t i;
+	int ret;
+
+	if (!pool || !dgst || !sig || !siglen) {
+		error_print();
+		return -1;
+	}
+	if (sdf_pool_acquire(pool, &i) != 1) {
+		error_print();
+		return -1;
+	}
+	if ((ret = sdf_sign(&pool->keys[i], dgst, sig, siglen)) != 1) {
+		error_print();
+	}
+	sdf_pool_release(pool, i, ret);
+	return ret;
+}
+
+int sdf_pool_decrypt(SDF_SESSION_POOL *pool, const uint8_t *in, size_t inlen, uint8_t *out, size_t *outlen)
+{
+	size_t i;
+	int ret;
+
+	if (!pool || !in || !out || !outlen) {
+		error_print();
+		return -1;
+	}
+	if (sdf_pool_acquire(pool, &i) != 1) {
+		error_print();
+		return -1;
+	}
+	if ((ret = sdf_decrypt(&pool->keys[i], in, inlen, out, outlen)) != 1) {
+		error_print();
+	}
+	sdf_pool_release(pool, i, ret);
+	return ret;
+}
+
+static int sdf_pool_run(SDF_SESSION_POOL *pool, SDF_POOL_REQUEST *req)
+{
+	switch (req->type) {
+	case SDF_POOL_SIGN:
+		if (req->inlen != 32) {
+			error_print();
+			return -1;
+		}
+		return sdf_pool_sign(pool, req->in, req->out, &req->outlen);
+	case SDF_POOL_DECRYPT:
+		return sdf_pool_decrypt(pool, req->in, req->inlen, req->out, &req->outlen);
+	}
+	error_print();
+	return -1;
+}
+
+#ifdef ENABLE_PTHREAD
+static void *sdf_pool_worker(void *arg)
+{
+	SDF_SESSION_POOL *pool = (SDF_SESSION_POOL *)arg;
+	SDF_POOL_REQUEST *req;
+	int ret;
+
+	for (;;) {
+		pthread_mutex_lock(&pool->lock);
+		while (!pool->queue_num && !pool->stop) {
+			pthread_cond_wait(&pool->queue_cond, &pool->lock);
+		}
+		// the queued requests are completed before the workers exit
+		if (!pool->queue_num) {
+			pthread_mutex_unlock(&pool->lock);
+			break;
+		}
+		req = pool->queue[pool->queue_head];
+		pool->queue_head = (pool->queue_head + 1) % SDF_POOL_QUEUE_SIZE;
+		pool->queue_num--;
+		pthread_cond_broadcast(&pool->queue_cond);
+		pthread_mutex_unlock(&pool->lock);
+
+		ret = sdf_pool_run(pool, req);
+
+		pthread_mutex_lock(&pool->lock);
+		req->status = (ret == 1) ? 1 : -1;
+		pthread_cond_broadcast(&pool->done_cond);
+		pthread_mutex_unlock(&pool->lock);
+	}
+	return NULL;
+}
+
+static void sdf_pool_stop_workers(SDF_SESSION_POOL *pool, size_t num_workers)
+{
+	size_t i;
+
+	pthread_mutex_lock(&pool->lock);
+	pool->stop = 1;
+	pthread_cond_broadcast(&pool->queue_cond);
+	pthread_mutex_unlock(&pool->lock);
+
+	for (i = 0; i < num_workers; i++) {
+		pthread_join(pool->workers[i], NULL);
+	}
+}
+#endif
+
+int sdf_pool_submit(SDF_SESSION_POOL *pool, SDF_POOL_REQUEST *req)
+{
+	if (!pool || !req || !req->in || !req->out) {
+		error_print();
+		return -1;
+	}
+	req->status = 0;
+
+#ifdef ENABLE_PTHREAD
+	if (pool->num_workers) {
+		pthread_mutex_lock(&pool->lock);
+		while (pool->queue_num == SDF_POOL_QUEUE_SIZE) {
+			pthread_cond_wait(&pool->queue_cond, &pool->lock);
+		}
+		pool->queue[(pool->queue_head + pool->queue_num) % SDF_POOL_QUEUE_SIZE] = req;
+		pool->queue_num++;
+		pthread_cond_broadcast(&pool->queue_cond);
+		pthread_mutex_unlock(&pool->lock);
+		return 1;
+	}
+#endif
+	req->status = (sdf_pool_run(pool, req) == 1) ? 1 : -1;
+	return 1;
+}
+
+int sdf_pool_wait(SDF_SESSION_POOL *pool, SDF_POOL_REQUEST *req)
+{
+	int status;
+
+	if (!pool || !req) {
+		error_print();
+		return -1;
+	}
+	sdf_pool_lock(pool);
+#ifdef ENABLE_PTHREAD
+	while (!req->status) {
+		pthread_cond_wait(&pool->done_cond, &pool->lock);
+	}
+#endif
+	status = req->status;
+	sdf_pool_unlock(pool);
+
+	if (status != 1) {
+		error_print();
+		return -1;
+	}
+	return 1;
+}
+
+void sdf_pool_get_stats(SDF_SESSION_POOL *pool, SDF_POOL_STATS *stats)
+{
+	sdf_pool_lock(pool);
+	*stats = pool->stats;
+#ifdef ENABLE_PTHREAD
+	stats->queued = pool->queue_num;
+#endif
+	sdf_pool_unlock(pool);
+}
+
+SDF_SESSION_POOL *sdf_pool_new(SDF_DEVICE *dev, int key_index, const char *pass,
+	size_t num_sessions, size_t num_workers)
+{
+	SDF_SESSION_POOL *pool;
+	size_t i;
+
+	if (!dev || !pass) {
+		error_print();
+		return NULL;
+	}
+	if (!num_sessions || num_sessions > SDF_POOL_MAX_SESSIONS
+		|| num_workers > SDF_POOL_MAX_WORKERS) {
+		error_print();
+		return NULL;
+	}
+	if (!(pool = (SDF_SESSION_POOL *)calloc(1, sizeof(SDF_SESSION_POOL)))) {
+		error_print();
+		return NULL;
+	}
+
+	for (i = 0; i < num_sessions; i++) {
+		if (sdf_load_private_key(dev, &pool->keys[i], key_index, pass) != 1) {
+			error_print();
+			goto err;
+		}
+		pool->num_sessions++;
+	}
+
+#ifdef ENABLE_PTHREAD
+	pthread_mutex_init(&pool->lock, NULL);
+	pthread_cond_init(&pool->session_cond, NULL);
+	pthread_cond_init(&pool->queue_cond, NULL);
+	pthread_cond_init(&pool->done_cond, NULL);
+
+	for (i = 0; i < num_workers; i++) {
+		if (pthread_create(&pool->workers[i], NULL, sdf_pool_worker, pool) != 0) {
+			sdf_pool_stop_workers(pool, i);
+			pthread_mutex_destroy(&pool->lock);
+			pthread_cond_destroy(&pool->session_cond);
+			pthread_cond_destroy(&pool->queue_cond);
+			pthread_cond_destroy(&pool->done_cond);
+			error_print();
+			goto err;
+		}
+	}
+	pool->num_workers = num_workers;
+#endif
+	return pool;
+
+err:
+	for (i = 0; i < pool->num_sessions; i++) {
+		(void)sdf_release_private_key(&pool->keys[i]);
+	}
+	free(pool);
+	return NULL;
+}
+
+void sdf_pool_free(SDF_SESSION_POOL *pool)
+{
+	size_t i;
+
+	if (!pool) {
+		return;
+	}
+#ifdef ENABLE_PTHREAD
+	sdf_pool_stop_workers(pool, pool->num_workers);
+	pthread_mutex_destroy(&pool->lock);
+	pthread_cond_destroy(&pool->session_cond);
+	pthread_cond_destroy(&pool->queue_cond);
+	pthread_cond_destroy(&pool->done_cond);
+#endif
+	for (i = 0; i < pool->num_sessions; i++) {
+		(void)sdf_release_private_key(&pool->keys[i]);
+	}
+	memset(pool, 0, sizeof(SDF_SESSION_POOL));
+	free(pool);
+}
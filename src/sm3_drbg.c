@@ -0,0 +1,234 @@
+/*
+ *  Copyright 2014-2024 The GmSSL Project. All Rights Reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the License); you may
+ *  not use this file except in compliance with the License.
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+
+#include <string.h>
+#include <stdlib.h>
+#include <gmssl/sm3.h>
+#include <gmssl/sm3_drbg.h>
+#include <gmssl/mem.h>
+#include <gmssl/endian.h>
+#include <gmssl/error.h>
+
+
+#define SM3_DRBG_SEED_BITS	(SM3_DRBG_SEED_SIZE * 8)
+
+// V = (V + a) mod 2^seedlen, a is big-endian and not longer than V
+static void sm3_drbg_add(uint8_t V[SM3_DRBG_SEED_SIZE], const uint8_t *a, size_t alen)
+{
+	unsigned int carry = 0;
+	int i = SM3_DRBG_SEED_SIZE - 1;
+	int j = (int)alen - 1;
+
+	for (; j >= 0; i--, j--) {
+		carry += V[i] + a[j];
+		V[i] = (uint8_t)carry;
+		carry >>= 8;
+	}
+	for (; carry && i >= 0; i--) {
+		carry += V[i];
+		V[i] = (uint8_t)carry;
+		carry >>= 8;
+	}
+}
+
+// Hash(V) with V of seedlen bits is exactly one padded SM3 block
+static void sm3_drbg_hash_seed(const uint8_t V[SM3_DRBG_SEED_SIZE], uint8_t dgst[SM3_DIGEST_SIZE])
+{
+	uint32_t digest[8] = {
+		0x7380166F, 0x4914B2B9, 0x172442D7, 0xDA8A0600,
+		0xA96F30BC, 0x163138AA, 0xE38DEE4D, 0xB0FB0E4E,
+	};
+	uint8_t block[SM3_BLOCK_SIZE] = {0};
+	int i;
+
+	memcpy(block, V, SM3_DRBG_SEED_SIZE);
+	block[SM3_DRBG_SEED_SIZE] = 0x80;
+	PUTU32(block + 60, SM3_DRBG_SEED_BITS);
+	sm3_compress_blocks(digest, block, 1);
+
+	for (i = 0; i < 8; i++) {
+		PUTU32(dgst + i*4, digest[i]);
+	}
+	gmssl_secure_clear(block, sizeof(block));
+}
+
+// out = Hash_df(prefix || in1 || in2 || in3, seedlen), prefix is omitted when < 0
+static void sm3_drbg_hash_df(int prefix,
+	const uint8_t *in1, size_t in1len,
+	const uint8_t *in2, size_t in2len,
+	const uint8_t *in3, size_t in3len,
+	uint8_t out[SM3_DRBG_SEED_SIZE])
+{
+	SM3_CTX sm3_ctx;
+	uint8_t buf[5];
+	uint8_t dgst[SM3_DIGEST_SIZE * 2];
+	uint8_t counter;
+
+	PUTU32(buf + 1, SM3_DRBG_SEED_BITS);
+
+	for (counter = 1; counter <= 2; counter++) {
+		buf[0] = counter;
+		sm3_init(&sm3_ctx);
+		sm3_update(&sm3_ctx, buf, sizeof(buf));
+		if (prefix >= 0) {
+			uint8_t b = (uint8_t)prefix;
+			sm3_update(&sm3_ctx, &b, 1);
+		}
+		if (in1len) sm3_update(&sm3_ctx, in1, in1len);
+		if (in2len) sm3_update(&sm3_ctx, in2, in2len);
+		if (in3len) sm3_update(&sm3_ctx, in3, in3len);
+		sm3_finish(&sm3_ctx, dgst + SM3_DIGEST_SIZE * (counter - 1));
+	}
+	memcpy(out, dgst, SM3_DRBG_SEED_SIZE);
+
+	gmssl_secure_clear(&sm3_ctx, sizeof(sm3_ctx));
+	gmssl_secure_clear(dgst, sizeof(dgst));
+}
+
+int sm3_drbg_init(SM3_DRBG *drbg,
+	const uint8_t *entropy, size_t entropy_len,
+	const uint8_t *nonce, size_t nonce_len,
+	const uint8_t *personalstr, size_t personalstr_len)
+{
+	if (!drbg || !entropy || (!nonce && nonce_len) || (!personalstr && personalstr_len)) {
+		error_print();
+		return -1;
+	}
+	if (entropy_len < SM3_DRBG_MIN_ENTROPY_SIZE || entropy_len > SM3_DRBG_MAX_INPUT_SIZE
+		|| nonce_len > SM3_DRBG_MAX_INPUT_SIZE
+		|| personalstr_len > SM3_DRBG_MAX_INPUT_SIZE) {
+		error_print();
+		return -1;
+	}
+
+	// V = Hash_df(entropy || nonce || personalstr), C = Hash_df(0x00 || V)
+	sm3_drbg_hash_df(-1, entropy, entropy_len, nonce, nonce_len, personalstr, personalstr_len, drbg->V);
+	sm3_drbg_hash_df(0x00, drbg->V, SM3_DRBG_SEED_SIZE, NULL, 0, NULL, 0, drbg->C);
+	drbg->reseed_counter = 1;
+	drbg->last_reseed_time = time(NULL);
+	return 1;
+}
+
+int sm3_drbg_reseed(SM3_DRBG *drbg,
+	const uint8_t *entropy, size_t entropy_len,
+	const uint8_t *additional, size_t additional_len)
+{
+	uint8_t V[SM3_DRBG_SEED_SIZE];
+
+	if (!drbg || !entropy || (!additional && additional_len)) {
+		error_print();
+		return -1;
+	}
+	if (entropy_len < SM3_DRBG_MIN_ENTROPY_SIZE || entropy_len > SM3_DRBG_MAX_INPUT_SIZE
+		|| additional_len > SM3_DRBG_MAX_INPUT_SIZE) {
+		error_print();
+		return -1;
+	}
+
+	// V = Hash_df(0x01 || V || entropy || additional), C = Hash_df(0x00 || V)
+	sm3_drbg_hash_df(0x01, drbg->V, SM3_DRBG_SEED_SIZE, entropy, entropy_len, additional, additional_len, V);
+	memcpy(drbg->V, V, SM3_DRBG_SEED_SIZE);
+	sm3_drbg_hash_df(0x00, drbg->V, SM3_DRBG_SEED_SIZE, NULL, 0, NULL, 0, drbg->C);
+	drbg->reseed_counter = 1;
+	drbg->last_reseed_time = time(NULL);
+
+	gmssl_secure_clear(V, sizeof(V));
+	return 1;
+}
+
+int sm3_drbg_need_reseed(const SM3_DRBG *drbg)
+{
+	time_t now;
+
+	if (drbg->reseed_counter > SM3_DRBG_RESEED_INTERVAL) {
+		return 1;
+	}
+	now = time(NULL);
+	if (now - drbg->last_reseed_time > SM3_DRBG_RESEED_TIME || now < drbg->last_reseed_time) {
+		return 1;
+	}
+	return 0;
+}
+
+int sm3_drbg_generate(SM3_DRBG *drbg,
+	const uint8_t *additional, size_t additional_len,
+	uint8_t *out, size_t outlen)
+{
+	SM3_CTX sm3_ctx;
+	uint8_t prefix;
+	uint8_t data[SM3_DRBG_SEED_SIZE];
+	uint8_t dgst[SM3_DIGEST_SIZE];
+	uint8_t counter[4];
+	const uint8_t one = 1;
+
+	if (!drbg || (!additional && additional_len) || (!out && outlen)) {
+		error_print();
+		return -1;
+	}
+	if (additional_len > SM3_DRBG_MAX_INPUT_SIZE || outlen > SM3_DRBG_MAX_REQUEST_SIZE) {
+		error_print();
+		return -1;
+	}
+	if (drbg->reseed_counter > SM3_DRBG_RESEED_INTERVAL) {
+		error_print();
+		return -1;
+	}
+
+	// V = V + Hash(0x02 || V || additional)
+	if (additional_len) {
+		prefix = 0x02;
+		sm3_init(&sm3_ctx);
+		sm3_update(&sm3_ctx, &prefix, 1);
+		sm3_update(&sm3_ctx, drbg->V, SM3_DRBG_SEED_SIZE);
+		sm3_update(&sm3_ctx, additional, additional_len);
+		sm3_finish(&sm3_ctx, dgst);
+		sm3_drbg_add(drbg->V, dgst, SM3_DIGEST_SIZE);
+	}
+
+	// Hashgen: Hash(V) || Hash(V + 1) || ...
+	memcpy(data, drbg->V, SM3_DRBG_SEED_SIZE);
+	while (outlen) {
+		size_t len = outlen < SM3_DIGEST_SIZE ? outlen : SM3_DIGEST_SIZE;
+
+		if (len == SM3_DIGEST_SIZE) {
+			sm3_drbg_hash_seed(data, out);
+		} else {
+			sm3_drbg_hash_seed(data, dgst);
+			memcpy(out, dgst, len);
+		}
+		sm3_drbg_add(data, &one, 1);
+		out += len;
+		outlen -= len;
+	}
+
+	// V = V + Hash(0x03 || V) + C + reseed_counter
+	prefix = 0x03;
+	sm3_init(&sm3_ctx);
+	sm3_update(&sm3_ctx, &prefix, 1);
+	sm3_update(&sm3_ctx, drbg->V, SM3_DRBG_SEED_SIZE);
+	sm3_finish(&sm3_ctx, dgst);
+	sm3_drbg_add(drbg->V, dgst, SM3_DIGEST_SIZE);
+	sm3_drbg_add(drbg->V, drbg->C, SM3_DRBG_SEED_SIZE);
+	PUTU32(counter, drbg->reseed_counter);
+	sm3_drbg_add(drbg->V, counter, sizeof(counter));
+	drbg->reseed_counter++;
+
+	gmssl_secure_clear(&sm3_ctx, sizeof(sm3_ctx));
+	gmssl_secure_clear(data, sizeof(data));
+	gmssl_secure_clear(dgst, sizeof(dgst));
+	return 1;
+}
+
+void sm3_drbg_cleanup(SM3_DRBG *drbg)
+{
+	if (drbg) {
+		gmssl_secure_clear(drbg, sizeof(SM3_DRBG));
+	}
+}
@@ -353,6 +353,180 @@ void sm4_encrypt_blocks(const SM4_KEY *key, const uint8_t *in, size_t nblocks, u
 	}
 }
 
+// same as ROUND, with a different round key in each lane
+#define ROUND_X8(i, x0, x1, x2, x3, x4)					\
+	t0 = _mm256_loadu_si256((const __m256i *)x8_key->rk[i]);	\
+	t1 = _mm256_xor_si256(x1, x2);					\
+	t2 = _mm256_xor_si256(x3, t0);					\
+	x4 = _mm256_xor_si256(t1, t2);					\
+	t0 = _mm256_and_si256(x4, vindex_mask);				\
+	t0 = _mm256_i32gather_epi32((int *)SM4_T, t0, 4);		\
+	t0 = _mm256_rotl_epi32(t0, 8);					\
+	x4 = _mm256_srli_epi32(x4, 8);					\
+	x0 = _mm256_xor_si256(x0, t0);					\
+	t0 = _mm256_and_si256(x4, vindex_mask);				\
+	t0 = _mm256_i32gather_epi32((int *)SM4_T, t0, 4);		\
+	t0 = _mm256_rotl_epi32(t0, 16);					\
+	x4 = _mm256_srli_epi32(x4, 8);					\
+	x0 = _mm256_xor_si256(x0, t0);					\
+	t0 = _mm256_and_si256(x4, vindex_mask);				\
+	t0 = _mm256_i32gather_epi32((int *)SM4_T, t0, 4);		\
+	t0 = _mm256_rotl_epi32(t0, 24);					\
+	x4 = _mm256_srli_epi32(x4, 8);					\
+	x0 = _mm256_xor_si256(x0, t0);					\
+	t1 = _mm256_i32gather_epi32((int *)SM4_T, x4, 4);		\
+	x4 = _mm256_xor_si256(x0, t1)
+
+void sm4_x8_encrypt(const SM4_X8_KEY *x8_key,
+	const uint8_t in[SM4_X8_LANES][16], uint8_t out[SM4_X8_LANES][16])
+{
+	__m256i x0, x1, x2, x3, x4;
+	__m256i t0, t1, t2, t3;
+
+	__m256i vindex_4i = _mm256_setr_epi32(0,4,8,12,16,20,24,28);
+	__m256i vindex_mask = _mm256_set1_epi32(0xff);
+	__m256i vindex_read = _mm256_setr_epi32(0,8,16,24,1,9,17,25);
+	__m256i vindex_swap = _mm256_setr_epi8(
+		3,2,1,0,7,6,5,4,11,10,9,8,15,14,13,12,
+		3,2,1,0,7,6,5,4,11,10,9,8,15,14,13,12
+	);
+
+	GET_BLKS(x0, x1, x2, x3, in[0]);
+
+	ROUND_X8( 0, x0, x1, x2, x3, x4);
+	ROUND_X8( 1, x1, x2, x3, x4, x0);
+	ROUND_X8( 2, x2, x3, x4, x0, x1);
+	ROUND_X8( 3, x3, x4, x0, x1, x2);
+	ROUND_X8( 4, x4, x0, x1, x2, x3);
+	ROUND_X8( 5, x0, x1, x2, x3, x4);
+	ROUND_X8( 6, x1, x2, x3, x4, x0);
+	ROUND_X8( 7, x2, x3, x4, x0, x1);
+	ROUND_X8( 8, x3, x4, x0, x1, x2);
+	ROUND_X8( 9, x4, x0, x1, x2, x3);
+	ROUND_X8(10, x0, x1, x2, x3, x4);
+	ROUND_X8(11, x1, x2, x3, x4, x0);
+	ROUND_X8(12, x2, x3, x4, x0, x1);
+	ROUND_X8(13, x3, x4, x0, x1, x2);
+	ROUND_X8(14, x4, x0, x1, x2, x3);
+	ROUND_X8(15, x0, x1, x2, x3, x4);
+	ROUND_X8(16, x1, x2, x3, x4, x0);
+	ROUND_X8(17, x2, x3, x4, x0, x1);
+	ROUND_X8(18, x3, x4, x0, x1, x2);
+	ROUND_X8(19, x4, x0, x1, x2, x3);
+	ROUND_X8(20, x0, x1, x2, x3, x4);
+	ROUND_X8(21, x1, x2, x3, x4, x0);
+	ROUND_X8(22, x2, x3, x4, x0, x1);
+	ROUND_X8(23, x3, x4, x0, x1, x2);
+	ROUND_X8(24, x4, x0, x1, x2, x3);
+	ROUND_X8(25, x0, x1, x2, x3, x4);
+	ROUND_X8(26, x1, x2, x3, x4, x0);
+	ROUND_X8(27, x2, x3, x4, x0, x1);
+	ROUND_X8(28, x3, x4, x0, x1, x2);
+	ROUND_X8(29, x4, x0, x1, x2, x3);
+	ROUND_X8(30, x0, x1, x2, x3, x4);
+	ROUND_X8(31, x1, x2, x3, x4, x0);
+
+	PUT_BLKS(out[0], x0, x4, x3, x2);
+}
+
+
+// S widen to 32-bit for _mm256_i32gather_epi32
+static const int S32_T[256] = {
+	0xd6,0x90,0xe9,0xfe,0xcc,0xe1,0x3d,0xb7,
+	0x16,0xb6,0x14,0xc2,0x28,0xfb,0x2c,0x05,
+	0x2b,0x67,0x9a,0x76,0x2a,0xbe,0x04,0xc3,
+	0xaa,0x44,0x13,0x26,0x49,0x86,0x06,0x99,
+	0x9c,0x42,0x50,0xf4,0x91,0xef,0x98,0x7a,
+	0x33,0x54,0x0b,0x43,0xed,0xcf,0xac,0x62,
+	0xe4,0xb3,0x1c,0xa9,0xc9,0x08,0xe8,0x95,
+	0x80,0xdf,0x94,0xfa,0x75,0x8f,0x3f,0xa6,
+	0x47,0x07,0xa7,0xfc,0xf3,0x73,0x17,0xba,
+	0x83,0x59,0x3c,0x19,0xe6,0x85,0x4f,0xa8,
+	0x68,0x6b,0x81,0xb2,0x71,0x64,0xda,0x8b,
+	0xf8,0xeb,0x0f,0x4b,0x70,0x56,0x9d,0x35,
+	0x1e,0x24,0x0e,0x5e,0x63,0x58,0xd1,0xa2,
+	0x25,0x22,0x7c,0x3b,0x01,0x21,0x78,0x87,
+	0xd4,0x00,0x46,0x57,0x9f,0xd3,0x27,0x52,
+	0x4c,0x36,0x02,0xe7,0xa0,0xc4,0xc8,0x9e,
+	0xea,0xbf,0x8a,0xd2,0x40,0xc7,0x38,0xb5,
+	0xa3,0xf7,0xf2,0xce,0xf9,0x61,0x15,0xa1,
+	0xe0,0xae,0x5d,0xa4,0x9b,0x34,0x1a,0x55,
+	0xad,0x93,0x32,0x30,0xf5,0x8c,0xb1,0xe3,
+	0x1d,0xf6,0xe2,0x2e,0x82,0x66,0xca,0x60,
+	0xc0,0x29,0x23,0xab,0x0d,0x53,0x4e,0x6f,
+	0xd5,0xdb,0x37,0x45,0xde,0xfd,0x8e,0x2f,
+	0x03,0xff,0x6a,0x72,0x6d,0x6c,0x5b,0x51,
+	0x8d,0x1b,0xaf,0x92,0xbb,0xdd,0xbc,0x7f,
+	0x11,0xd9,0x5c,0x41,0x1f,0x10,0x5a,0xd8,
+	0x0a,0xc1,0x31,0x88,0xa5,0xcd,0x7b,0xbd,
+	0x2d,0x74,0xd0,0x12,0xb8,0xe5,0xb4,0xb0,
+	0x89,0x69,0x97,0x4a,0x0c,0x96,0x77,0x7e,
+	0x65,0xb9,0xf1,0x09,0xc5,0x6e,0xc6,0x84,
+	0x18,0xf0,0x7d,0xec,0x3a,0xdc,0x4d,0x20,
+	0x79,0xee,0x5f,0x3e,0xd7,0xcb,0x39,0x48,
+};
+
+static void sm4_x8_set_key_schedule(SM4_X8_KEY *x8_key, const uint8_t raw_key[SM4_X8_LANES][16], int decrypt)
+{
+	__m256i x0, x1, x2, x3, x4;
+	__m256i t0, t1, t2, t3;
+
+	__m256i vindex_4i = _mm256_setr_epi32(0,4,8,12,16,20,24,28);
+	__m256i vindex_mask = _mm256_set1_epi32(0xff);
+	__m256i vindex_swap = _mm256_setr_epi8(
+		3,2,1,0,7,6,5,4,11,10,9,8,15,14,13,12,
+		3,2,1,0,7,6,5,4,11,10,9,8,15,14,13,12
+	);
+	int i;
+
+	GET_BLKS(x0, x1, x2, x3, raw_key[0]);
+	x0 = _mm256_xor_si256(x0, _mm256_set1_epi32((int)FK[0]));
+	x1 = _mm256_xor_si256(x1, _mm256_set1_epi32((int)FK[1]));
+	x2 = _mm256_xor_si256(x2, _mm256_set1_epi32((int)FK[2]));
+	x3 = _mm256_xor_si256(x3, _mm256_set1_epi32((int)FK[3]));
+
+	for (i = 0; i < 32; i++) {
+
+		// X4 = X1 ^ X2 ^ X3 ^ CK[i]
+		t0 = _mm256_xor_si256(x1, x2);
+		t1 = _mm256_xor_si256(x3, _mm256_set1_epi32((int)CK[i]));
+		t0 = _mm256_xor_si256(t0, t1);
+
+		// X4 = S32(X4)
+		t1 = _mm256_i32gather_epi32(S32_T, _mm256_and_si256(t0, vindex_mask), 4);
+		t0 = _mm256_srli_epi32(t0, 8);
+		t2 = _mm256_i32gather_epi32(S32_T, _mm256_and_si256(t0, vindex_mask), 4);
+		t1 = _mm256_or_si256(t1, _mm256_slli_epi32(t2, 8));
+		t0 = _mm256_srli_epi32(t0, 8);
+		t2 = _mm256_i32gather_epi32(S32_T, _mm256_and_si256(t0, vindex_mask), 4);
+		t1 = _mm256_or_si256(t1, _mm256_slli_epi32(t2, 16));
+		t0 = _mm256_srli_epi32(t0, 8);
+		t2 = _mm256_i32gather_epi32(S32_T, t0, 4);
+		t1 = _mm256_or_si256(t1, _mm256_slli_epi32(t2, 24));
+
+		// X4 = X0 ^ L32_(X4)
+		t2 = _mm256_xor_si256(_mm256_rotl_epi32(t1, 13), _mm256_rotl_epi32(t1, 23));
+		x4 = _mm256_xor_si256(x0, _mm256_xor_si256(t1, t2));
+
+		_mm256_storeu_si256((__m256i *)x8_key->rk[decrypt ? 31 - i : i], x4);
+
+		x0 = x1;
+		x1 = x2;
+		x2 = x3;
+		x3 = x4;
+	}
+}
+
+void sm4_x8_set_encrypt_key(SM4_X8_KEY *x8_key, const uint8_t raw_key[SM4_X8_LANES][16])
+{
+	sm4_x8_set_key_schedule(x8_key, raw_key, 0);
+}
+
+void sm4_x8_set_decrypt_key(SM4_X8_KEY *x8_key, const uint8_t raw_key[SM4_X8_LANES][16])
+{
+	sm4_x8_set_key_schedule(x8_key, raw_key, 1);
+}
+
 void sm4_cbc_encrypt_blocks(const SM4_KEY *key, uint8_t iv[16],
 	const uint8_t *in, size_t nblocks, uint8_t *out)
 {
@@ -10,10 +10,13 @@
 
 #include <gmssl/sm4.h>
 #include <gmssl/mem.h>
-#include <gmssl/sm4_cbc_mac.h>
 #include <gmssl/error.h>
 
 
+// number of counter blocks encrypted by one sm4_encrypt_blocks() call
+#define SM4_CCM_CTR_BLOCKS 8
+
+
 static void length_to_bytes(size_t len, size_t nbytes, uint8_t *out)
 {
 	uint8_t *p = out + nbytes - 1;
@@ -32,35 +35,38 @@ static void ctr_n_incr(uint8_t a[16], size_t n)
 	}
 }
 
-// TODO: add test vectors for counter overflow
-static void sm4_ctr_n_encrypt(const SM4_KEY *key, uint8_t ctr[16], size_t n, const uint8_t *in, size_t inlen, uint8_t *out)
+static void sm4_ccm_mac_update(SM4_CCM_CTX *ctx, const uint8_t *data, size_t datalen)
 {
-	uint8_t block[16];
-	size_t len;
+	while (datalen) {
+		size_t left = 16 - ctx->maclen;
+		size_t len = datalen < left ? datalen : left;
+		gmssl_memxor(ctx->mac + ctx->maclen, ctx->mac + ctx->maclen, data, len);
+		ctx->maclen += len;
+		if (ctx->maclen >= 16) {
+			sm4_encrypt(&ctx->sm4_key, ctx->mac, ctx->mac);
+			ctx->maclen = 0;
+		}
+		data += len;
+		datalen -= len;
+	}
+}
 
-	while (inlen) {
-		len = inlen < 16 ? inlen : 16;
-		sm4_encrypt(key, ctr, block);
-		gmssl_memxor(out, in, block, len);
-		ctr_n_incr(ctr, n);
-		in += len;
-		out += len;
-		inlen -= len;
+static void sm4_ccm_mac_pad(SM4_CCM_CTX *ctx)
+{
+	if (ctx->maclen) {
+		sm4_encrypt(&ctx->sm4_key, ctx->mac, ctx->mac);
+		ctx->maclen = 0;
 	}
 }
 
-int sm4_ccm_encrypt(const SM4_KEY *sm4_key, const uint8_t *iv, size_t ivlen,
-	const uint8_t *aad, size_t aadlen, const uint8_t *in, size_t inlen,
-	uint8_t *out, size_t taglen, uint8_t *tag)
+// B0, AAD and CTR_0, the key schedule must be set
+static int sm4_ccm_start(SM4_CCM_CTX *ctx, const uint8_t *iv, size_t ivlen,
+	const uint8_t *aad, size_t aadlen, size_t inlen, size_t taglen)
 {
-	SM4_CBC_MAC_CTX mac_ctx;
-	const uint8_t zeros[16] = {0};
 	uint8_t block[16] = {0};
-	uint8_t ctr[16] = {0};
-	uint8_t mac[16];
 	size_t inlen_size;
 
-	if (ivlen < 7 || ivlen > 13) {
+	if (ivlen < SM4_CCM_MIN_IV_SIZE || ivlen > SM4_CCM_MAX_IV_SIZE) {
 		error_print();
 		return -1;
 	}
@@ -68,7 +74,7 @@ int sm4_ccm_encrypt(const SM4_KEY *sm4_key, const uint8_t *iv, size_t ivlen,
 		error_print();
 		return -1;
 	}
-	if (taglen < 4 || taglen > 16 || taglen & 1) {
+	if (taglen < SM4_CCM_MIN_TAG_SIZE || taglen > SM4_CCM_MAX_TAG_SIZE || taglen & 1) {
 		error_print();
 		return -1;
 	}
@@ -79,16 +85,21 @@ int sm4_ccm_encrypt(const SM4_KEY *sm4_key, const uint8_t *iv, size_t ivlen,
 		return -1;
 	}
 
-	// sm4_cbc_mac_init with SM4_KEY
-	memset(&mac_ctx, 0, sizeof(mac_ctx));
-	mac_ctx.key = *sm4_key;
+	memset(ctx->mac, 0, sizeof(ctx->mac));
+	ctx->maclen = 0;
+	ctx->ctrlen = inlen_size;
+	ctx->taglen = taglen;
+	ctx->inlen = inlen;
+	ctx->encedlen = 0;
+	ctx->block_nbytes = 0;
+	ctx->tag_nbytes = 0;
 
 	block[0] |= ((aadlen > 0) & 0x1) << 6;
 	block[0] |= (((taglen - 2)/2) & 0x7) << 3;
 	block[0] |= (inlen_size - 1) & 0x7;
 	memcpy(block + 1, iv, ivlen);
 	length_to_bytes(inlen, inlen_size, block + 1 + ivlen);
-	sm4_cbc_mac_update(&mac_ctx, block, 16);
+	sm4_ccm_mac_update(ctx, block, 16);
 
 	if (aad && aadlen) {
 		size_t alen;
@@ -107,30 +118,100 @@ int sm4_ccm_encrypt(const SM4_KEY *sm4_key, const uint8_t *iv, size_t ivlen,
 			length_to_bytes(aadlen, 8, block + 2);
 			alen = 10;
 		}
-		sm4_cbc_mac_update(&mac_ctx, block, alen);
-		sm4_cbc_mac_update(&mac_ctx, aad, aadlen);
-		if (alen + aadlen % 16) {
-			sm4_cbc_mac_update(&mac_ctx, zeros, 16 - (alen + aadlen)%16);
+		sm4_ccm_mac_update(ctx, block, alen);
+		sm4_ccm_mac_update(ctx, aad, aadlen);
+		sm4_ccm_mac_pad(ctx);
+	}
+
+	memset(ctx->ctr, 0, 16);
+	ctx->ctr[0] = (inlen_size - 1) & 0x7;
+	memcpy(ctx->ctr + 1, iv, ivlen);
+	sm4_encrypt(&ctx->sm4_key, ctx->ctr, ctx->S0);
+	ctx->ctr[15] = 1;
+
+	return 1;
+}
+
+/*
+ * CTR and CBC-MAC of full blocks in one pass over the data. For each chunk of up
+ * to SM4_CCM_CTR_BLOCKS blocks the counter blocks are encrypted first by the
+ * (4x/8x on SIMD builds) sm4_encrypt_blocks(), then the serial CBC-MAC runs over
+ * the plaintext of the chunk while it is XORed with the key stream.
+ */
+static void sm4_ccm_crypt_blocks(SM4_CCM_CTX *ctx, const uint8_t *in, size_t nblocks, uint8_t *out, int enc)
+{
+	uint8_t ctrs[16 * SM4_CCM_CTR_BLOCKS];
+	uint8_t stream[16 * SM4_CCM_CTR_BLOCKS];
+	size_t i;
+
+	while (nblocks) {
+		size_t n = nblocks < SM4_CCM_CTR_BLOCKS ? nblocks : SM4_CCM_CTR_BLOCKS;
+
+		for (i = 0; i < n; i++) {
+			memcpy(ctrs + 16 * i, ctx->ctr, 16);
+			ctr_n_incr(ctx->ctr, ctx->ctrlen);
+		}
+		sm4_encrypt_blocks(&ctx->sm4_key, ctrs, n, stream);
+
+		for (i = 0; i < n; i++) {
+			if (enc) {
+				gmssl_memxor(ctx->mac, ctx->mac, in, 16);
+				gmssl_memxor(out, in, stream + 16 * i, 16);
+			} else {
+				gmssl_memxor(out, in, stream + 16 * i, 16);
+				gmssl_memxor(ctx->mac, ctx->mac, out, 16);
+			}
+			sm4_encrypt(&ctx->sm4_key, ctx->mac, ctx->mac);
+			in += 16;
+			out += 16;
 		}
+		nblocks -= n;
 	}
 
-	ctr[0] = 0;
-	ctr[0] |= (inlen_size - 1) & 0x7;
-	memcpy(ctr + 1, iv, ivlen);
-	memset(ctr + 1 + ivlen, 0, 15 - ivlen);
-	sm4_encrypt(sm4_key, ctr, block);
+	gmssl_secure_clear(stream, sizeof(stream));
+}
 
-	ctr[15] = 1;
-	sm4_ctr_n_encrypt(sm4_key, ctr, 15 - ivlen, in, inlen, out);
+// last partial block and the final MAC, `mac` = T xor E(K, CTR_0)
+static void sm4_ccm_crypt_final(SM4_CCM_CTX *ctx, const uint8_t *in, size_t inlen, uint8_t *out, int enc,
+	uint8_t mac[16])
+{
+	uint8_t block[16];
 
-	sm4_cbc_mac_update(&mac_ctx, in, inlen);
-	if (inlen % 16) {
-		sm4_cbc_mac_update(&mac_ctx, zeros, 16 - inlen % 16);
+	if (inlen) {
+		sm4_encrypt(&ctx->sm4_key, ctx->ctr, block);
+		if (enc) {
+			sm4_ccm_mac_update(ctx, in, inlen);
+			gmssl_memxor(out, in, block, inlen);
+		} else {
+			gmssl_memxor(out, in, block, inlen);
+			sm4_ccm_mac_update(ctx, out, inlen);
+		}
+		sm4_ccm_mac_pad(ctx);
 	}
-	sm4_cbc_mac_finish(&mac_ctx, mac);
-	gmssl_memxor(tag, mac, block, taglen);
+	gmssl_memxor(mac, ctx->mac, ctx->S0, 16);
 
-	gmssl_secure_clear(&mac_ctx, sizeof(mac_ctx));
+	gmssl_secure_clear(block, sizeof(block));
+}
+
+int sm4_ccm_encrypt(const SM4_KEY *sm4_key, const uint8_t *iv, size_t ivlen,
+	const uint8_t *aad, size_t aadlen, const uint8_t *in, size_t inlen,
+	uint8_t *out, size_t taglen, uint8_t *tag)
+{
+	SM4_CCM_CTX ctx;
+	uint8_t mac[16];
+	size_t len = inlen - inlen % 16;
+
+	ctx.sm4_key = *sm4_key;
+	if (sm4_ccm_start(&ctx, iv, ivlen, aad, aadlen, inlen, taglen) != 1) {
+		gmssl_secure_clear(&ctx, sizeof(ctx));
+		error_print();
+		return -1;
+	}
+	sm4_ccm_crypt_blocks(&ctx, in, len / 16, out, 1);
+	sm4_ccm_crypt_final(&ctx, in + len, inlen - len, out + len, 1, mac);
+	memcpy(tag, mac, taglen);
+
+	gmssl_secure_clear(&ctx, sizeof(ctx));
 	return 1;
 }
 
@@ -138,90 +219,206 @@ int sm4_ccm_decrypt(const SM4_KEY *sm4_key, const uint8_t *iv, size_t ivlen,
 	const uint8_t *aad, size_t aadlen, const uint8_t *in, size_t inlen,
 	const uint8_t *tag, size_t taglen, uint8_t *out)
 {
-	SM4_CBC_MAC_CTX mac_ctx;
-	const uint8_t zeros[16] = {0};
-	uint8_t block[16] = {0};
-	uint8_t ctr[16] = {0};
+	SM4_CCM_CTX ctx;
 	uint8_t mac[16];
-	size_t inlen_size;
+	size_t len = inlen - inlen % 16;
 
-	if (ivlen < 7 || ivlen > 13) {
+	ctx.sm4_key = *sm4_key;
+	if (sm4_ccm_start(&ctx, iv, ivlen, aad, aadlen, inlen, taglen) != 1) {
+		gmssl_secure_clear(&ctx, sizeof(ctx));
 		error_print();
 		return -1;
 	}
-	if (!aad && aadlen) {
+	sm4_ccm_crypt_blocks(&ctx, in, len / 16, out, 0);
+	sm4_ccm_crypt_final(&ctx, in + len, inlen - len, out + len, 0, mac);
+
+	gmssl_secure_clear(&ctx, sizeof(ctx));
+	if (gmssl_secure_memcmp(mac, tag, taglen) != 0) {
+		error_print();
+		return -1;
+	}
+	return 1;
+}
+
+int sm4_ccm_encrypt_init(SM4_CCM_CTX *ctx,
+	const uint8_t *key, size_t keylen, const uint8_t *iv, size_t ivlen,
+	const uint8_t *aad, size_t aadlen, size_t inlen, size_t taglen)
+{
+	if (!ctx || !iv) {
 		error_print();
 		return -1;
 	}
-	if (taglen < 4 || taglen > 16 || taglen & 1) {
+	if (key) {
+		if (keylen != SM4_KEY_SIZE) {
+			error_print();
+			return -1;
+		}
+		sm4_set_encrypt_key(&ctx->sm4_key, key);
+	}
+	if (sm4_ccm_start(ctx, iv, ivlen, aad, aadlen, inlen, taglen) != 1) {
 		error_print();
 		return -1;
 	}
+	return 1;
+}
 
-	inlen_size = 15 - ivlen;
-	if (inlen_size < 8 && inlen >= (size_t)(1 << (inlen_size * 8))) {
+static int sm4_ccm_update(SM4_CCM_CTX *ctx,
+	const uint8_t *in, size_t inlen, uint8_t *out, size_t *outlen, int enc)
+{
+	size_t nblocks;
+	size_t len;
+
+	if (ctx->block_nbytes >= SM4_BLOCK_SIZE) {
 		error_print();
 		return -1;
 	}
+	if (inlen > ctx->inlen - ctx->encedlen) {
+		error_print();
+		return -1;
+	}
+	ctx->encedlen += inlen;
 
-	// sm4_cbc_mac_init with SM4_KEY
-	memset(&mac_ctx, 0, sizeof(mac_ctx));
-	mac_ctx.key = *sm4_key;
+	*outlen = 0;
+	if (ctx->block_nbytes) {
+		size_t left = SM4_BLOCK_SIZE - ctx->block_nbytes;
+		if (inlen < left) {
+			memcpy(ctx->block + ctx->block_nbytes, in, inlen);
+			ctx->block_nbytes += inlen;
+			return 1;
+		}
+		memcpy(ctx->block + ctx->block_nbytes, in, left);
+		sm4_ccm_crypt_blocks(ctx, ctx->block, 1, out, enc);
+		in += left;
+		inlen -= left;
+		out += SM4_BLOCK_SIZE;
+		*outlen += SM4_BLOCK_SIZE;
+	}
+	if (inlen >= SM4_BLOCK_SIZE) {
+		nblocks = inlen / SM4_BLOCK_SIZE;
+		len = nblocks * SM4_BLOCK_SIZE;
+		sm4_ccm_crypt_blocks(ctx, in, nblocks, out, enc);
+		in += len;
+		inlen -= len;
+		*outlen += len;
+	}
+	if (inlen) {
+		memcpy(ctx->block, in, inlen);
+	}
+	ctx->block_nbytes = inlen;
+	return 1;
+}
 
-	block[0] |= ((aadlen > 0) & 0x1) << 6;
-	block[0] |= (((taglen - 2)/2) & 0x7) << 3;
-	block[0] |= (inlen_size - 1) & 0x7;
-	memcpy(block + 1, iv, ivlen);
-	length_to_bytes(inlen, inlen_size, block + 1 + ivlen);
-	sm4_cbc_mac_update(&mac_ctx, block, 16);
+int sm4_ccm_encrypt_update(SM4_CCM_CTX *ctx,
+	const uint8_t *in, size_t inlen, uint8_t *out, size_t *outlen)
+{
+	if (!ctx || !in || !outlen) {
+		error_print();
+		return -1;
+	}
+	if (!out) {
+		*outlen = 16 * ((inlen + 15)/16);
+		return 1;
+	}
+	if (sm4_ccm_update(ctx, in, inlen, out, outlen, 1) != 1) {
+		error_print();
+		return -1;
+	}
+	return 1;
+}
 
-	if (aad && aadlen) {
-		size_t alen;
+int sm4_ccm_encrypt_finish(SM4_CCM_CTX *ctx, uint8_t *out, size_t *outlen)
+{
+	uint8_t mac[16];
 
-		if (aadlen < ((1<<16) - (1<<8))) {
-			length_to_bytes(aadlen, 2, block);
-			alen = 2;
-		} else if ((uint64_t)aadlen < ((uint64_t)1<<32)) {
-			block[0] = 0xff;
-			block[1] = 0xfe;
-			length_to_bytes(aadlen, 4, block + 2);
-			alen = 6;
-		} else {
-			block[0] = 0xff;
-			block[1] = 0xff;
-			length_to_bytes(aadlen, 8, block + 2);
-			alen = 10;
-		}
-		sm4_cbc_mac_update(&mac_ctx, block, alen);
-		sm4_cbc_mac_update(&mac_ctx, aad, aadlen);
-		if (alen + aadlen % 16) {
-			sm4_cbc_mac_update(&mac_ctx, zeros, 16 - (alen + aadlen)%16);
-		}
+	if (!ctx || !outlen) {
+		error_print();
+		return -1;
+	}
+	if (!out) {
+		*outlen = SM4_BLOCK_SIZE + SM4_CCM_MAX_TAG_SIZE;
+		return 1;
+	}
+	if (ctx->encedlen != ctx->inlen) {
+		error_print();
+		return -1;
 	}
+	sm4_ccm_crypt_final(ctx, ctx->block, ctx->block_nbytes, out, 1, mac);
+	memcpy(out + ctx->block_nbytes, mac, ctx->taglen);
+	*outlen = ctx->block_nbytes + ctx->taglen;
+
+	memset(ctx->block, 0, SM4_BLOCK_SIZE);
+	ctx->block_nbytes = 0;
+	return 1;
+}
+
+int sm4_ccm_decrypt_init(SM4_CCM_CTX *ctx,
+	const uint8_t *key, size_t keylen, const uint8_t *iv, size_t ivlen,
+	const uint8_t *aad, size_t aadlen, size_t inlen, size_t taglen)
+{
+	return sm4_ccm_encrypt_init(ctx, key, keylen, iv, ivlen, aad, aadlen, inlen, taglen);
+}
+
+int sm4_ccm_decrypt_update(SM4_CCM_CTX *ctx,
+	const uint8_t *in, size_t inlen, uint8_t *out, size_t *outlen)
+{
+	size_t len;
 
-	ctr[0] = 0;
-	ctr[0] |= (inlen_size - 1) & 0x7;
-	memcpy(ctr + 1, iv, ivlen);
-	memset(ctr + 1 + ivlen, 0, 15 - ivlen);
-	sm4_encrypt(sm4_key, ctr, block);
+	if (!ctx || !in || !outlen) {
+		error_print();
+		return -1;
+	}
+	if (!out) {
+		*outlen = 16 * ((inlen + 15)/16);
+		return 1;
+	}
 
-	ctr[15] = 1;
-	sm4_ctr_n_encrypt(sm4_key, ctr, 15 - ivlen, in, inlen, out);
+	// ciphertext part
+	len = ctx->inlen - ctx->encedlen;
+	if (len > inlen) {
+		len = inlen;
+	}
+	if (sm4_ccm_update(ctx, in, len, out, outlen, 0) != 1) {
+		error_print();
+		return -1;
+	}
+	in += len;
+	inlen -= len;
 
-	sm4_cbc_mac_update(&mac_ctx, out, inlen); // diff from encrypt
-	if (inlen % 16) {
-		sm4_cbc_mac_update(&mac_ctx, zeros, 16 - inlen % 16);
+	// tag part
+	if (inlen > ctx->taglen - ctx->tag_nbytes) {
+		error_print();
+		return -1;
 	}
-	sm4_cbc_mac_finish(&mac_ctx, mac);
+	memcpy(ctx->tag + ctx->tag_nbytes, in, inlen);
+	ctx->tag_nbytes += inlen;
+	return 1;
+}
+
+int sm4_ccm_decrypt_finish(SM4_CCM_CTX *ctx, uint8_t *out, size_t *outlen)
+{
+	uint8_t mac[16];
 
-	// diff from encrypt
-	gmssl_memxor(mac, mac, block, taglen);
-	if (memcmp(mac, tag, taglen) != 0) {
+	if (!ctx || !outlen) {
+		error_print();
+		return -1;
+	}
+	if (!out) {
+		*outlen = SM4_BLOCK_SIZE;
+		return 1;
+	}
+	if (ctx->encedlen != ctx->inlen || ctx->tag_nbytes != ctx->taglen) {
+		error_print();
+		return -1;
+	}
+	sm4_ccm_crypt_final(ctx, ctx->block, ctx->block_nbytes, out, 0, mac);
+	if (gmssl_secure_memcmp(mac, ctx->tag, ctx->taglen) != 0) {
+		gmssl_secure_clear(out, ctx->block_nbytes);
 		error_print();
-		gmssl_secure_clear(&mac_ctx, sizeof(mac_ctx));
 		return -1;
 	}
+	*outlen = ctx->block_nbytes;
 
-	gmssl_secure_clear(&mac_ctx, sizeof(mac_ctx));
+	memset(ctx->block, 0, SM4_BLOCK_SIZE);
+	ctx->block_nbytes = 0;
 	return 1;
 }
@@ -11,6 +11,9 @@
 #include <gmssl/sm4.h>
 #include <gmssl/mem.h>
 #include <gmssl/error.h>
+#ifdef ENABLE_PTHREAD
+#include <pthread.h>
+#endif
 
 
 void sm4_ctr_encrypt(const SM4_KEY *key, uint8_t ctr[16], const uint8_t *in, size_t inlen, uint8_t *out)
@@ -214,3 +217,155 @@ int sm4_ctr32_encrypt_finish(SM4_CTR_CTX *ctx, uint8_t *out, size_t *outlen)
 	*outlen = ctx->block_nbytes;
 	return 1;
 }
+
+
+#ifdef ENABLE_PTHREAD
+// fewer blocks per thread are not worth the thread creation
+#define SM4_CTR_THREAD_MIN_BLOCKS	1024
+
+typedef struct {
+	const SM4_KEY *key;
+	uint8_t ctr[16];
+	int ctr32;
+	const uint8_t *in;
+	size_t nblocks;
+	uint8_t *out;
+} SM4_CTR_TASK;
+
+// big-endian add of n, only the last 32 bits for ctr32
+static void ctr_add(uint8_t ctr[16], size_t n, int ctr32)
+{
+	uint64_t carry = n;
+	int last = ctr32 ? 12 : 0;
+	int i;
+
+	for (i = 15; i >= last && carry; i--) {
+		carry += ctr[i];
+		ctr[i] = (uint8_t)carry;
+		carry >>= 8;
+	}
+}
+
+static void *sm4_ctr_routine(void *arg)
+{
+	SM4_CTR_TASK *task = (SM4_CTR_TASK *)arg;
+
+	if (task->ctr32) {
+		sm4_ctr32_encrypt_blocks(task->key, task->ctr, task->in, task->nblocks, task->out);
+	} else {
+		sm4_ctr_encrypt_blocks(task->key, task->ctr, task->in, task->nblocks, task->out);
+	}
+	return NULL;
+}
+
+static void sm4_ctr_encrypt_blocks_threads(const SM4_KEY *key, uint8_t ctr[16], int ctr32,
+	const uint8_t *in, size_t nblocks, uint8_t *out, int nthreads)
+{
+	SM4_CTR_TASK tasks[SM4_MAX_THREADS];
+	pthread_t threads[SM4_MAX_THREADS];
+	size_t per_thread, offset = 0;
+	int i, started = 0;
+
+	if (nthreads > SM4_MAX_THREADS) {
+		nthreads = SM4_MAX_THREADS;
+	}
+	if ((size_t)nthreads > nblocks / SM4_CTR_THREAD_MIN_BLOCKS) {
+		nthreads = (int)(nblocks / SM4_CTR_THREAD_MIN_BLOCKS);
+	}
+	if (nthreads < 1) {
+		nthreads = 1;
+	}
+	per_thread = (nblocks + nthreads - 1) / nthreads;
+
+	for (i = 0; i < nthreads; i++) {
+		size_t len = nblocks - offset < per_thread ? nblocks - offset : per_thread;
+
+		tasks[i].key = key;
+		memcpy(tasks[i].ctr, ctr, 16);
+		ctr_add(tasks[i].ctr, offset, ctr32);
+		tasks[i].ctr32 = ctr32;
+		tasks[i].in = in + offset * SM4_BLOCK_SIZE;
+		tasks[i].nblocks = len;
+		tasks[i].out = out + offset * SM4_BLOCK_SIZE;
+		offset += len;
+	}
+
+	for (i = 1; i < nthreads; i++) {
+		if (pthread_create(&threads[i], NULL, sm4_ctr_routine, &tasks[i]) != 0) {
+			break;
+		}
+		started = i;
+	}
+	// the ranges without a thread are done by the calling thread
+	for (i = started + 1; i < nthreads; i++) {
+		sm4_ctr_routine(&tasks[i]);
+	}
+	sm4_ctr_routine(&tasks[0]);
+	for (i = 1; i <= started; i++) {
+		pthread_join(threads[i], NULL);
+	}
+
+	ctr_add(ctr, nblocks, ctr32);
+	gmssl_secure_clear(tasks, sizeof(tasks));
+}
+
+static int sm4_ctr_update_threads(SM4_CTR_CTX *ctx, int ctr32,
+	const uint8_t *in, size_t inlen, uint8_t *out, size_t *outlen, int nthreads)
+{
+	size_t nblocks;
+	size_t len;
+
+	if (!ctx || !in || !outlen) {
+		error_print();
+		return -1;
+	}
+	if (!out) {
+		*outlen = 16 * ((inlen + 15)/16);
+		return 1;
+	}
+	if (ctx->block_nbytes >= SM4_BLOCK_SIZE) {
+		error_print();
+		return -1;
+	}
+	*outlen = 0;
+	if (ctx->block_nbytes) {
+		len = SM4_BLOCK_SIZE - ctx->block_nbytes;
+		if (len > inlen) {
+			len = inlen;
+		}
+		if ((ctr32 ? sm4_ctr32_encrypt_update(ctx, in, len, out, outlen)
+			: sm4_ctr_encrypt_update(ctx, in, len, out, outlen)) != 1) {
+			error_print();
+			return -1;
+		}
+		in += len;
+		inlen -= len;
+		out += *outlen;
+	}
+	if (inlen >= SM4_BLOCK_SIZE) {
+		nblocks = inlen / SM4_BLOCK_SIZE;
+		len = nblocks * SM4_BLOCK_SIZE;
+		sm4_ctr_encrypt_blocks_threads(&ctx->sm4_key, ctx->ctr, ctr32, in, nblocks, out, nthreads);
+		in += len;
+		inlen -= len;
+		*outlen += len;
+	}
+	if (inlen) {
+		memcpy(ctx->block, in, inlen);
+		ctx->block_nbytes = inlen;
+	}
+	return 1;
+}
+
+int sm4_ctr_encrypt_update_threads(SM4_CTR_CTX *ctx,
+	const uint8_t *in, size_t inlen, uint8_t *out, size_t *outlen, int nthreads)
+{
+	return sm4_ctr_update_threads(ctx, 0, in, inlen, out, outlen, nthreads);
+}
+
+int sm4_ctr32_encrypt_update_threads(SM4_CTR_CTX *ctx,
+	const uint8_t *in, size_t inlen, uint8_t *out, size_t *outlen, int nthreads)
+{
+	return sm4_ctr_update_threads(ctx, 1, in, inlen, out, outlen, nthreads);
+}
+#endif
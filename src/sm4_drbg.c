@@ -0,0 +1,250 @@
+/*
+ *  Copyright 2014-2024 The GmSSL Project. All Rights Reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the License); you may
+ *  not use this file except in compliance with the License.
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+
+#include <string.h>
+#include <stdlib.h>
+#include <gmssl/sm4.h>
+#include <gmssl/sm4_drbg.h>
+#include <gmssl/mem.h>
+#include <gmssl/endian.h>
+#include <gmssl/error.h>
+
+
+static void sm4_drbg_incr(uint8_t V[SM4_BLOCK_SIZE])
+{
+	int i;
+	for (i = SM4_BLOCK_SIZE - 1; i >= 0; i--) {
+		V[i]++;
+		if (V[i]) break;
+	}
+}
+
+static void sm4_drbg_decr(uint8_t V[SM4_BLOCK_SIZE])
+{
+	int i;
+	for (i = SM4_BLOCK_SIZE - 1; i >= 0; i--) {
+		V[i]--;
+		if (V[i] != 0xff) break;
+	}
+}
+
+typedef struct {
+	SM4_KEY sm4_key;
+	uint8_t chain[SM4_BLOCK_SIZE];
+	uint8_t block[SM4_BLOCK_SIZE];
+	size_t num;
+} SM4_DRBG_BCC_CTX;
+
+static void sm4_drbg_bcc_update(SM4_DRBG_BCC_CTX *ctx, const uint8_t *data, size_t datalen)
+{
+	while (datalen) {
+		size_t len = SM4_BLOCK_SIZE - ctx->num;
+		if (len > datalen) {
+			len = datalen;
+		}
+		memcpy(ctx->block + ctx->num, data, len);
+		ctx->num += len;
+		data += len;
+		datalen -= len;
+
+		if (ctx->num == SM4_BLOCK_SIZE) {
+			memxor(ctx->chain, ctx->block, SM4_BLOCK_SIZE);
+			sm4_encrypt(&ctx->sm4_key, ctx->chain, ctx->chain);
+			ctx->num = 0;
+		}
+	}
+}
+
+// out = Block_Cipher_df(in1 || in2 || in3, seedlen)
+static void sm4_drbg_df(
+	const uint8_t *in1, size_t in1len,
+	const uint8_t *in2, size_t in2len,
+	const uint8_t *in3, size_t in3len,
+	uint8_t out[SM4_DRBG_SEED_SIZE])
+{
+	static const uint8_t df_key[SM4_KEY_SIZE] = {
+		0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07,
+		0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f,
+	};
+	const uint8_t zeros[SM4_BLOCK_SIZE] = {0};
+	const uint8_t pad = 0x80;
+	SM4_DRBG_BCC_CTX ctx;
+	SM4_KEY sm4_key;
+	uint8_t IV[SM4_BLOCK_SIZE] = {0};
+	uint8_t LN[8];
+	uint8_t temp[SM4_DRBG_SEED_SIZE];
+	size_t padlen;
+	uint32_t i;
+
+	PUTU32(LN, (uint32_t)(in1len + in2len + in3len));
+	PUTU32(LN + 4, SM4_DRBG_SEED_SIZE);
+	// S = L || N || input || 0x80 || 0^*, IV || S is a multiple of the block size
+	padlen = (SM4_BLOCK_SIZE - (sizeof(LN) + in1len + in2len + in3len + 1) % SM4_BLOCK_SIZE) % SM4_BLOCK_SIZE;
+
+	sm4_set_encrypt_key(&ctx.sm4_key, df_key);
+	for (i = 0; i < SM4_DRBG_SEED_SIZE / SM4_BLOCK_SIZE; i++) {
+		memset(ctx.chain, 0, SM4_BLOCK_SIZE);
+		ctx.num = 0;
+		PUTU32(IV, i);
+		sm4_drbg_bcc_update(&ctx, IV, sizeof(IV));
+		sm4_drbg_bcc_update(&ctx, LN, sizeof(LN));
+		if (in1len) sm4_drbg_bcc_update(&ctx, in1, in1len);
+		if (in2len) sm4_drbg_bcc_update(&ctx, in2, in2len);
+		if (in3len) sm4_drbg_bcc_update(&ctx, in3, in3len);
+		sm4_drbg_bcc_update(&ctx, &pad, 1);
+		sm4_drbg_bcc_update(&ctx, zeros, padlen);
+		memcpy(temp + SM4_BLOCK_SIZE * i, ctx.chain, SM4_BLOCK_SIZE);
+	}
+
+	// K = leftmost(temp, keylen), X = the next block, output E(K, X), E(K, E(K, X)), ...
+	sm4_set_encrypt_key(&sm4_key, temp);
+	sm4_encrypt(&sm4_key, temp + SM4_KEY_SIZE, out);
+	for (i = 1; i < SM4_DRBG_SEED_SIZE / SM4_BLOCK_SIZE; i++) {
+		sm4_encrypt(&sm4_key, out + SM4_BLOCK_SIZE * (i - 1), out + SM4_BLOCK_SIZE * i);
+	}
+
+	gmssl_secure_clear(&ctx, sizeof(ctx));
+	gmssl_secure_clear(&sm4_key, sizeof(sm4_key));
+	gmssl_secure_clear(temp, sizeof(temp));
+}
+
+// (Key, V) = CTR_DRBG_Update(provided_data, Key, V)
+static void sm4_drbg_update(SM4_DRBG *drbg, const uint8_t provided_data[SM4_DRBG_SEED_SIZE])
+{
+	uint8_t temp[SM4_DRBG_SEED_SIZE];
+
+	memset(temp, 0, sizeof(temp));
+	sm4_drbg_incr(drbg->V);
+	sm4_ctr_encrypt_blocks(&drbg->sm4_key, drbg->V, temp, SM4_DRBG_SEED_SIZE / SM4_BLOCK_SIZE, temp);
+	if (provided_data) {
+		memxor(temp, provided_data, SM4_DRBG_SEED_SIZE);
+	}
+	sm4_set_encrypt_key(&drbg->sm4_key, temp);
+	memcpy(drbg->V, temp + SM4_KEY_SIZE, SM4_BLOCK_SIZE);
+
+	gmssl_secure_clear(temp, sizeof(temp));
+}
+
+int sm4_drbg_init(SM4_DRBG *drbg,
+	const uint8_t *entropy, size_t entropy_len,
+	const uint8_t *nonce, size_t nonce_len,
+	const uint8_t *personalstr, size_t personalstr_len)
+{
+	const uint8_t zeros[SM4_KEY_SIZE] = {0};
+	uint8_t seed_material[SM4_DRBG_SEED_SIZE];
+
+	if (!drbg || !entropy || (!nonce && nonce_len) || (!personalstr && personalstr_len)) {
+		error_print();
+		return -1;
+	}
+	if (entropy_len < SM4_DRBG_MIN_ENTROPY_SIZE || entropy_len > SM4_DRBG_MAX_INPUT_SIZE
+		|| nonce_len > SM4_DRBG_MAX_INPUT_SIZE
+		|| personalstr_len > SM4_DRBG_MAX_INPUT_SIZE) {
+		error_print();
+		return -1;
+	}
+
+	sm4_drbg_df(entropy, entropy_len, nonce, nonce_len, personalstr, personalstr_len, seed_material);
+	sm4_set_encrypt_key(&drbg->sm4_key, zeros);
+	memset(drbg->V, 0, SM4_BLOCK_SIZE);
+	sm4_drbg_update(drbg, seed_material);
+	drbg->reseed_counter = 1;
+	drbg->last_reseed_time = time(NULL);
+
+	gmssl_secure_clear(seed_material, sizeof(seed_material));
+	return 1;
+}
+
+int sm4_drbg_reseed(SM4_DRBG *drbg,
+	const uint8_t *entropy, size_t entropy_len,
+	const uint8_t *additional, size_t additional_len)
+{
+	uint8_t seed_material[SM4_DRBG_SEED_SIZE];
+
+	if (!drbg || !entropy || (!additional && additional_len)) {
+		error_print();
+		return -1;
+	}
+	if (entropy_len < SM4_DRBG_MIN_ENTROPY_SIZE || entropy_len > SM4_DRBG_MAX_INPUT_SIZE
+		|| additional_len > SM4_DRBG_MAX_INPUT_SIZE) {
+		error_print();
+		return -1;
+	}
+
+	sm4_drbg_df(entropy, entropy_len, additional, additional_len, NULL, 0, seed_material);
+	sm4_drbg_update(drbg, seed_material);
+	drbg->reseed_counter = 1;
+	drbg->last_reseed_time = time(NULL);
+
+	gmssl_secure_clear(seed_material, sizeof(seed_material));
+	return 1;
+}
+
+int sm4_drbg_need_reseed(const SM4_DRBG *drbg)
+{
+	time_t now;
+
+	if (drbg->reseed_counter > SM4_DRBG_RESEED_INTERVAL) {
+		return 1;
+	}
+	now = time(NULL);
+	if (now - drbg->last_reseed_time > SM4_DRBG_RESEED_TIME || now < drbg->last_reseed_time) {
+		return 1;
+	}
+	return 0;
+}
+
+int sm4_drbg_generate(SM4_DRBG *drbg,
+	const uint8_t *additional, size_t additional_len,
+	uint8_t *out, size_t outlen)
+{
+	uint8_t additional_input[SM4_DRBG_SEED_SIZE];
+	uint8_t ctr[SM4_BLOCK_SIZE];
+
+	if (!drbg || (!additional && additional_len) || (!out && outlen)) {
+		error_print();
+		return -1;
+	}
+	if (additional_len > SM4_DRBG_MAX_INPUT_SIZE || outlen > SM4_DRBG_MAX_REQUEST_SIZE) {
+		error_print();
+		return -1;
+	}
+	if (drbg->reseed_counter > SM4_DRBG_RESEED_INTERVAL) {
+		error_print();
+		return -1;
+	}
+
+	if (additional_len) {
+		sm4_drbg_df(additional, additional_len, NULL, 0, NULL, 0, additional_input);
+		sm4_drbg_update(drbg, additional_input);
+	}
+
+	// the keystream of counters V + 1, V + 2, ..., V is left at the last counter
+	memcpy(ctr, drbg->V, SM4_BLOCK_SIZE);
+	sm4_drbg_incr(ctr);
+	memset(out, 0, outlen);
+	sm4_ctr_encrypt(&drbg->sm4_key, ctr, out, outlen, out);
+	sm4_drbg_decr(ctr);
+	memcpy(drbg->V, ctr, SM4_BLOCK_SIZE);
+
+	sm4_drbg_update(drbg, additional_len ? additional_input : NULL);
+	drbg->reseed_counter++;
+
+	gmssl_secure_clear(additional_input, sizeof(additional_input));
+	gmssl_secure_clear(ctr, sizeof(ctr));
+	return 1;
+}
+
+void sm4_drbg_cleanup(SM4_DRBG *drbg)
+{
+	if (drbg) {
+		gmssl_secure_clear(drbg, sizeof(SM4_DRBG));
+	}
+}
@@ -11,6 +11,9 @@
 #include <gmssl/sm4.h>
 #include <gmssl/mem.h>
 #include <gmssl/error.h>
+#ifdef ENABLE_PTHREAD
+#include <pthread.h>
+#endif
 
 
 int sm4_ecb_encrypt_init(SM4_ECB_CTX *ctx, const uint8_t key[SM4_BLOCK_SIZE])
@@ -126,3 +129,123 @@ int sm4_ecb_decrypt_finish(SM4_ECB_CTX *ctx, uint8_t *out, size_t *outlen)
 	}
 	return 1;
 }
+
+
+#ifdef ENABLE_PTHREAD
+#define SM4_ECB_THREAD_MIN_BLOCKS	1024
+
+typedef struct {
+	const SM4_KEY *key;
+	const uint8_t *in;
+	size_t nblocks;
+	uint8_t *out;
+} SM4_ECB_TASK;
+
+static void *sm4_ecb_routine(void *arg)
+{
+	SM4_ECB_TASK *task = (SM4_ECB_TASK *)arg;
+	sm4_encrypt_blocks(task->key, task->in, task->nblocks, task->out);
+	return NULL;
+}
+
+static void sm4_encrypt_blocks_threads(const SM4_KEY *key,
+	const uint8_t *in, size_t nblocks, uint8_t *out, int nthreads)
+{
+	SM4_ECB_TASK tasks[SM4_MAX_THREADS];
+	pthread_t threads[SM4_MAX_THREADS];
+	size_t per_thread, offset = 0;
+	int i, started = 0;
+
+	if (nthreads > SM4_MAX_THREADS) {
+		nthreads = SM4_MAX_THREADS;
+	}
+	if ((size_t)nthreads > nblocks / SM4_ECB_THREAD_MIN_BLOCKS) {
+		nthreads = (int)(nblocks / SM4_ECB_THREAD_MIN_BLOCKS);
+	}
+	if (nthreads < 1) {
+		nthreads = 1;
+	}
+	per_thread = (nblocks + nthreads - 1) / nthreads;
+
+	for (i = 0; i < nthreads; i++) {
+		size_t len = nblocks - offset < per_thread ? nblocks - offset : per_thread;
+
+		tasks[i].key = key;
+		tasks[i].in = in + offset * SM4_BLOCK_SIZE;
+		tasks[i].nblocks = len;
+		tasks[i].out = out + offset * SM4_BLOCK_SIZE;
+		offset += len;
+	}
+
+	for (i = 1; i < nthreads; i++) {
+		if (pthread_create(&threads[i], NULL, sm4_ecb_routine, &tasks[i]) != 0) {
+			break;
+		}
+		started = i;
+	}
+	for (i = started + 1; i < nthreads; i++) {
+		sm4_ecb_routine(&tasks[i]);
+	}
+	sm4_ecb_routine(&tasks[0]);
+	for (i = 1; i <= started; i++) {
+		pthread_join(threads[i], NULL);
+	}
+}
+
+int sm4_ecb_encrypt_update_threads(SM4_ECB_CTX *ctx,
+	const uint8_t *in, size_t inlen, uint8_t *out, size_t *outlen, int nthreads)
+{
+	size_t nblocks;
+	size_t len;
+
+	if (!ctx || !in || !outlen) {
+		error_print();
+		return -1;
+	}
+	if (!out) {
+		*outlen = 16 * ((inlen + 15)/16);
+		return 1;
+	}
+	if (ctx->block_nbytes >= SM4_BLOCK_SIZE) {
+		error_print();
+		return -1;
+	}
+	*outlen = 0;
+	if (ctx->block_nbytes) {
+		len = SM4_BLOCK_SIZE - ctx->block_nbytes;
+		if (len > inlen) {
+			len = inlen;
+		}
+		if (sm4_ecb_encrypt_update(ctx, in, len, out, outlen) != 1) {
+			error_print();
+			return -1;
+		}
+		in += len;
+		inlen -= len;
+		out += *outlen;
+	}
+	if (inlen >= SM4_BLOCK_SIZE) {
+		nblocks = inlen / SM4_BLOCK_SIZE;
+		len = nblocks * SM4_BLOCK_SIZE;
+		sm4_encrypt_blocks_threads(&ctx->sm4_key, in, nblocks, out, nthreads);
+		in += len;
+		inlen -= len;
+		*outlen += len;
+	}
+	if (inlen) {
+		memcpy(ctx->block, in, inlen);
+		ctx->block_nbytes = inlen;
+	}
+	return 1;
+}
+
+int sm4_ecb_decrypt_update_threads(SM4_ECB_CTX *ctx,
+	const uint8_t *in, size_t inlen, uint8_t *out, size_t *outlen, int nthreads)
+{
+	if (sm4_ecb_encrypt_update_threads(ctx, in, inlen, out, outlen, nthreads) != 1) {
+		error_print();
+		return -1;
+	}
+	return 1;
+}
+#endif
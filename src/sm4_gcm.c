@@ -168,7 +168,19 @@ int sm4_gcm_encrypt_init(SM4_GCM_CTX *ctx,
 	return 1;
 }
 
-int sm4_gcm_encrypt_update(SM4_GCM_CTX *ctx, const uint8_t *in, size_t inlen, uint8_t *out, size_t *outlen)
+static int sm4_gcm_ctr32_update(SM4_GCM_CTX *ctx,
+	const uint8_t *in, size_t inlen, uint8_t *out, size_t *outlen, int nthreads)
+{
+#ifdef ENABLE_PTHREAD
+	if (nthreads > 1) {
+		return sm4_ctr32_encrypt_update_threads(&ctx->enc_ctx, in, inlen, out, outlen, nthreads);
+	}
+#endif
+	return sm4_ctr32_encrypt_update(&ctx->enc_ctx, in, inlen, out, outlen);
+}
+
+static int gcm_encrypt_update(SM4_GCM_CTX *ctx,
+	const uint8_t *in, size_t inlen, uint8_t *out, size_t *outlen, int nthreads)
 {
 	if (!ctx || !in || !outlen) {
 		error_print();
@@ -187,7 +199,7 @@ int sm4_gcm_encrypt_update(SM4_GCM_CTX *ctx, const uint8_t *in, size_t inlen, ui
 		return 1;
 	}
 
-	if (sm4_ctr32_encrypt_update(&ctx->enc_ctx, in, inlen, out, outlen) != 1) {
+	if (sm4_gcm_ctr32_update(ctx, in, inlen, out, outlen, nthreads) != 1) {
 		error_print();
 		return -1;
 	}
@@ -198,6 +210,19 @@ int sm4_gcm_encrypt_update(SM4_GCM_CTX *ctx, const uint8_t *in, size_t inlen, ui
 	return 1;
 }
 
+int sm4_gcm_encrypt_update(SM4_GCM_CTX *ctx, const uint8_t *in, size_t inlen, uint8_t *out, size_t *outlen)
+{
+	return gcm_encrypt_update(ctx, in, inlen, out, outlen, 1);
+}
+
+#ifdef ENABLE_PTHREAD
+int sm4_gcm_encrypt_update_threads(SM4_GCM_CTX *ctx,
+	const uint8_t *in, size_t inlen, uint8_t *out, size_t *outlen, int nthreads)
+{
+	return gcm_encrypt_update(ctx, in, inlen, out, outlen, nthreads);
+}
+#endif
+
 int sm4_gcm_encrypt_finish(SM4_GCM_CTX *ctx, uint8_t *out, size_t *outlen)
 {
 	uint8_t mac[16];
@@ -231,7 +256,8 @@ int sm4_gcm_decrypt_init(SM4_GCM_CTX *ctx,
 	return sm4_gcm_encrypt_init(ctx, key, keylen, iv, ivlen, aad, aadlen, taglen);
 }
 
-int sm4_gcm_decrypt_update(SM4_GCM_CTX *ctx, const uint8_t *in, size_t inlen, uint8_t *out, size_t *outlen)
+static int gcm_decrypt_update(SM4_GCM_CTX *ctx,
+	const uint8_t *in, size_t inlen, uint8_t *out, size_t *outlen, int nthreads)
 {
 	size_t len;
 
@@ -262,6 +288,7 @@ int sm4_gcm_decrypt_update(SM4_GCM_CTX *ctx, const uint8_t *in, size_t inlen, ui
 		if (inlen <= len) {
 			memcpy(ctx->mac + ctx->maclen, in, inlen);
 			ctx->maclen += inlen;
+			*outlen = 0;
 			return 1;
 		} else {
 			memcpy(ctx->mac + ctx->maclen, in, len);
@@ -292,7 +319,7 @@ int sm4_gcm_decrypt_update(SM4_GCM_CTX *ctx, const uint8_t *in, size_t inlen, ui
 
 		inlen -= ctx->taglen;
 		ghash_update(&ctx->mac_ctx, in, inlen);
-		if (sm4_ctr32_encrypt_update(&ctx->enc_ctx, in, inlen, out, &len) != 1) {
+		if (sm4_gcm_ctr32_update(ctx, in, inlen, out, &len, nthreads) != 1) {
 			error_print();
 			return -1;
 		}
@@ -304,6 +331,19 @@ int sm4_gcm_decrypt_update(SM4_GCM_CTX *ctx, const uint8_t *in, size_t inlen, ui
 	return 1;
 }
 
+int sm4_gcm_decrypt_update(SM4_GCM_CTX *ctx, const uint8_t *in, size_t inlen, uint8_t *out, size_t *outlen)
+{
+	return gcm_decrypt_update(ctx, in, inlen, out, outlen, 1);
+}
+
+#ifdef ENABLE_PTHREAD
+int sm4_gcm_decrypt_update_threads(SM4_GCM_CTX *ctx,
+	const uint8_t *in, size_t inlen, uint8_t *out, size_t *outlen, int nthreads)
+{
+	return gcm_decrypt_update(ctx, in, inlen, out, outlen, nthreads);
+}
+#endif
+
 int sm4_gcm_decrypt_finish(SM4_GCM_CTX *ctx, uint8_t *out, size_t *outlen)
 {
 	uint8_t mac[GHASH_SIZE];
@@ -0,0 +1,256 @@
+/*
+ *  Copyright 2014-2024 The GmSSL Project. All Rights Reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the License); you may
+ *  not use this file except in compliance with the License.
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+
+#include <string.h>
+#include <gmssl/sm4.h>
+#include <gmssl/mem.h>
+
+
+void sm4_x8_set_key(SM4_X8_KEY *x8_key, unsigned int lanes, const SM4_KEY *key[SM4_X8_LANES])
+{
+	int i, j;
+
+	for (j = 0; j < SM4_X8_LANES; j++) {
+		if (!(lanes & (1 << j))) {
+			continue;
+		}
+		for (i = 0; i < SM4_NUM_ROUNDS; i++) {
+			x8_key->rk[i][j] = key[j]->rk[i];
+		}
+	}
+}
+
+// sm4_avx2.c has its own sm4_x8_encrypt and key schedule,
+// the CBC streams and multi-key blocks are only interleaved with it
+#ifndef ENABLE_SM4_AVX2
+static void sm4_x8_set_key_schedule(SM4_X8_KEY *x8_key, const uint8_t raw_key[SM4_X8_LANES][SM4_KEY_SIZE], int decrypt)
+{
+	SM4_KEY key;
+	int i, j;
+
+	for (j = 0; j < SM4_X8_LANES; j++) {
+		if (decrypt) {
+			sm4_set_decrypt_key(&key, raw_key[j]);
+		} else {
+			sm4_set_encrypt_key(&key, raw_key[j]);
+		}
+		for (i = 0; i < SM4_NUM_ROUNDS; i++) {
+			x8_key->rk[i][j] = key.rk[i];
+		}
+	}
+	gmssl_secure_clear(&key, sizeof(key));
+}
+
+void sm4_x8_set_encrypt_key(SM4_X8_KEY *x8_key, const uint8_t raw_key[SM4_X8_LANES][SM4_KEY_SIZE])
+{
+	sm4_x8_set_key_schedule(x8_key, raw_key, 0);
+}
+
+void sm4_x8_set_decrypt_key(SM4_X8_KEY *x8_key, const uint8_t raw_key[SM4_X8_LANES][SM4_KEY_SIZE])
+{
+	sm4_x8_set_key_schedule(x8_key, raw_key, 1);
+}
+
+void sm4_x8_encrypt(const SM4_X8_KEY *x8_key,
+	const uint8_t in[SM4_X8_LANES][SM4_BLOCK_SIZE], uint8_t out[SM4_X8_LANES][SM4_BLOCK_SIZE])
+{
+	SM4_KEY key;
+	int i, j;
+
+	for (j = 0; j < SM4_X8_LANES; j++) {
+		for (i = 0; i < SM4_NUM_ROUNDS; i++) {
+			key.rk[i] = x8_key->rk[i][j];
+		}
+		sm4_encrypt(&key, in[j], out[j]);
+	}
+	gmssl_secure_clear(&key, sizeof(key));
+}
+
+// the portable sm4_x8_encrypt is not faster than the serial CBC of sm4.c
+void sm4_cbc_encrypt_jobs(SM4_CBC_JOB *jobs, size_t njobs)
+{
+	size_t i;
+
+	for (i = 0; i < njobs; i++) {
+		sm4_cbc_encrypt_blocks(jobs[i].key, jobs[i].iv, jobs[i].in, jobs[i].nblocks, jobs[i].out);
+	}
+}
+
+static void sm4_multi_key_blocks(const uint8_t (*raw_keys)[SM4_KEY_SIZE], size_t nkeys,
+	const uint8_t *in, size_t nblocks, uint8_t *out, int decrypt)
+{
+	SM4_KEY key;
+	size_t i;
+
+	for (i = 0; i < nkeys; i++) {
+		if (decrypt) {
+			sm4_set_decrypt_key(&key, raw_keys[i]);
+		} else {
+			sm4_set_encrypt_key(&key, raw_keys[i]);
+		}
+		sm4_encrypt_blocks(&key, in, nblocks, out);
+		in += nblocks * 16;
+		out += nblocks * 16;
+	}
+	gmssl_secure_clear(&key, sizeof(key));
+}
+
+#else
+
+static void sm4_multi_key_blocks(const uint8_t (*raw_keys)[SM4_KEY_SIZE], size_t nkeys,
+	const uint8_t *in, size_t nblocks, uint8_t *out, int decrypt)
+{
+	SM4_X8_KEY x8_key;
+	uint8_t keys[SM4_X8_LANES][SM4_KEY_SIZE];
+	uint8_t blocks[SM4_X8_LANES][SM4_BLOCK_SIZE];
+	const uint8_t (*pkeys)[SM4_KEY_SIZE];
+	size_t i, n, k;
+	size_t j;
+
+	for (i = 0; i < nkeys; i += n) {
+		n = nkeys - i;
+		if (n >= SM4_X8_LANES) {
+			n = SM4_X8_LANES;
+			pkeys = raw_keys + i;
+		} else {
+			// unused lanes are expanded from zero keys
+			memset(keys, 0, sizeof(keys));
+			memcpy(keys, raw_keys + i, n * SM4_KEY_SIZE);
+			pkeys = keys;
+		}
+
+		if (decrypt) {
+			sm4_x8_set_decrypt_key(&x8_key, pkeys);
+		} else {
+			sm4_x8_set_encrypt_key(&x8_key, pkeys);
+		}
+
+		// one block per key, the 8 blocks are already contiguous
+		if (nblocks == 1 && n == SM4_X8_LANES) {
+			sm4_x8_encrypt(&x8_key, (const uint8_t (*)[SM4_BLOCK_SIZE])(in + i * 16),
+				(uint8_t (*)[SM4_BLOCK_SIZE])(out + i * 16));
+			continue;
+		}
+
+		for (k = 0; k < nblocks; k++) {
+			for (j = 0; j < n; j++) {
+				memcpy(blocks[j], in + ((i + j) * nblocks + k) * 16, 16);
+			}
+			sm4_x8_encrypt(&x8_key, blocks, blocks);
+			for (j = 0; j < n; j++) {
+				memcpy(out + ((i + j) * nblocks + k) * 16, blocks[j], 16);
+			}
+		}
+	}
+
+	gmssl_secure_clear(&x8_key, sizeof(x8_key));
+	gmssl_secure_clear(keys, sizeof(keys));
+	gmssl_secure_clear(blocks, sizeof(blocks));
+}
+
+void sm4_cbc_encrypt_jobs(SM4_CBC_JOB *jobs, size_t njobs)
+{
+	SM4_X8_KEY x8_key;
+	const SM4_KEY *keys[SM4_X8_LANES];
+	SM4_CBC_JOB *lane[SM4_X8_LANES] = { NULL };
+	size_t done[SM4_X8_LANES];
+	uint8_t blocks[SM4_X8_LANES][SM4_BLOCK_SIZE];
+	size_t next = 0;
+	int j;
+
+	// lanes never used run with zero keys, retired lanes keep the keys of their
+	// last job, the output of both is discarded and cleared at the end
+	memset(&x8_key, 0, sizeof(x8_key));
+	memset(blocks, 0, sizeof(blocks));
+
+	for (;;) {
+		unsigned int lanes = 0;
+		unsigned int nactive = 0;
+		size_t nsteps = (size_t)-1;
+		size_t k;
+		int last = -1;
+
+		for (j = 0; j < SM4_X8_LANES; j++) {
+			if (!lane[j]) {
+				while (next < njobs && jobs[next].nblocks == 0) {
+					next++;
+				}
+				if (next >= njobs) {
+					continue;
+				}
+				lane[j] = &jobs[next++];
+				keys[j] = lane[j]->key;
+				done[j] = 0;
+				lanes |= 1 << j;
+			}
+			if (nsteps > lane[j]->nblocks - done[j]) {
+				nsteps = lane[j]->nblocks - done[j];
+			}
+			nactive++;
+			last = j;
+		}
+		if (!nactive) {
+			break;
+		}
+
+		// the last stream is finished without the other lanes
+		if (nactive == 1 && next >= njobs) {
+			SM4_CBC_JOB *job = lane[last];
+			sm4_cbc_encrypt_blocks(job->key, job->iv,
+				job->in + done[last] * 16, job->nblocks - done[last],
+				job->out + done[last] * 16);
+			break;
+		}
+
+		if (lanes) {
+			sm4_x8_set_key(&x8_key, lanes, keys);
+		}
+
+		for (k = 0; k < nsteps; k++) {
+			for (j = 0; j < SM4_X8_LANES; j++) {
+				if (lane[j]) {
+					gmssl_memxor(blocks[j], lane[j]->in + done[j] * 16, lane[j]->iv, 16);
+				}
+			}
+
+			sm4_x8_encrypt(&x8_key, blocks, blocks);
+
+			for (j = 0; j < SM4_X8_LANES; j++) {
+				if (lane[j]) {
+					memcpy(lane[j]->out + done[j] * 16, blocks[j], 16);
+					memcpy(lane[j]->iv, blocks[j], 16);
+					done[j]++;
+				}
+			}
+		}
+
+		for (j = 0; j < SM4_X8_LANES; j++) {
+			if (lane[j] && done[j] == lane[j]->nblocks) {
+				lane[j] = NULL;
+			}
+		}
+	}
+
+	gmssl_secure_clear(&x8_key, sizeof(x8_key));
+	gmssl_secure_clear(blocks, sizeof(blocks));
+}
+#endif
+
+void sm4_multi_key_encrypt_blocks(const uint8_t (*raw_keys)[SM4_KEY_SIZE], size_t nkeys,
+	const uint8_t *in, size_t nblocks, uint8_t *out)
+{
+	sm4_multi_key_blocks(raw_keys, nkeys, in, nblocks, out, 0);
+}
+
+void sm4_multi_key_decrypt_blocks(const uint8_t (*raw_keys)[SM4_KEY_SIZE], size_t nkeys,
+	const uint8_t *in, size_t nblocks, uint8_t *out)
+{
+	sm4_multi_key_blocks(raw_keys, nkeys, in, nblocks, out, 1);
+}
@@ -12,6 +12,9 @@
 #include <gmssl/mem.h>
 #include <gmssl/gf128.h>
 #include <gmssl/error.h>
+#ifdef ENABLE_PTHREAD
+#include <pthread.h>
+#endif
 
 
 int sm4_xts_encrypt(const SM4_KEY *key1, const SM4_KEY *key2, const uint8_t tweak[16],
@@ -262,7 +265,6 @@ int sm4_xts_decrypt_update(SM4_XTS_CTX *ctx,
 	}
 	*outlen = 0;
 	if (ctx->block_nbytes) {
-		error_print();
 		left = DATA_UNIT_SIZE - ctx->block_nbytes;
 		if (inlen < left) {
 			memcpy(ctx->block + ctx->block_nbytes, in, inlen);
@@ -316,3 +318,183 @@ int sm4_xts_decrypt_finish(SM4_XTS_CTX *ctx, uint8_t *out, size_t *outlen)
 	*outlen = 0;
 	return 1;
 }
+
+
+#ifdef ENABLE_PTHREAD
+#define SM4_XTS_THREAD_MIN_BYTES	(1024 * 16)
+
+typedef struct {
+	const SM4_KEY *key1;
+	const SM4_KEY *key2;
+	uint8_t tweak[16];
+	int enc;
+	const uint8_t *in;
+	size_t nunits;
+	size_t unit_size;
+	uint8_t *out;
+	int ret;
+} SM4_XTS_TASK;
+
+// little-endian add as tweak_incr
+static void tweak_add(uint8_t a[16], size_t n)
+{
+	uint64_t carry = n;
+	int i;
+
+	for (i = 0; i < 16 && carry; i++) {
+		carry += a[i];
+		a[i] = (uint8_t)carry;
+		carry >>= 8;
+	}
+}
+
+static void *sm4_xts_routine(void *arg)
+{
+	SM4_XTS_TASK *task = (SM4_XTS_TASK *)arg;
+	size_t i;
+
+	for (i = 0; i < task->nunits; i++) {
+		if ((task->enc ? sm4_xts_encrypt(task->key1, task->key2, task->tweak, task->in, task->unit_size, task->out)
+			: sm4_xts_decrypt(task->key1, task->key2, task->tweak, task->in, task->unit_size, task->out)) != 1) {
+			task->ret = -1;
+			return NULL;
+		}
+		tweak_incr(task->tweak);
+		task->in += task->unit_size;
+		task->out += task->unit_size;
+	}
+	task->ret = 1;
+	return NULL;
+}
+
+static int sm4_xts_units_threads(SM4_XTS_CTX *ctx, int enc,
+	const uint8_t *in, size_t nunits, uint8_t *out, int nthreads)
+{
+	SM4_XTS_TASK tasks[SM4_MAX_THREADS];
+	pthread_t threads[SM4_MAX_THREADS];
+	size_t unit_size = ctx->data_unit_size;
+	size_t per_thread, offset = 0;
+	int ret = 1;
+	int i, started = 0;
+
+	if (nthreads > SM4_MAX_THREADS) {
+		nthreads = SM4_MAX_THREADS;
+	}
+	if ((size_t)nthreads > nunits * unit_size / SM4_XTS_THREAD_MIN_BYTES) {
+		nthreads = (int)(nunits * unit_size / SM4_XTS_THREAD_MIN_BYTES);
+	}
+	if ((size_t)nthreads > nunits) {
+		nthreads = (int)nunits;
+	}
+	if (nthreads < 1) {
+		nthreads = 1;
+	}
+	per_thread = (nunits + nthreads - 1) / nthreads;
+
+	for (i = 0; i < nthreads; i++) {
+		size_t len = nunits - offset < per_thread ? nunits - offset : per_thread;
+
+		tasks[i].key1 = &ctx->key1;
+		tasks[i].key2 = &ctx->key2;
+		memcpy(tasks[i].tweak, ctx->tweak, 16);
+		tweak_add(tasks[i].tweak, offset);
+		tasks[i].enc = enc;
+		tasks[i].in = in + offset * unit_size;
+		tasks[i].nunits = len;
+		tasks[i].unit_size = unit_size;
+		tasks[i].out = out + offset * unit_size;
+		tasks[i].ret = -1;
+		offset += len;
+	}
+
+	for (i = 1; i < nthreads; i++) {
+		if (pthread_create(&threads[i], NULL, sm4_xts_routine, &tasks[i]) != 0) {
+			break;
+		}
+		started = i;
+	}
+	for (i = started + 1; i < nthreads; i++) {
+		sm4_xts_routine(&tasks[i]);
+	}
+	sm4_xts_routine(&tasks[0]);
+	for (i = 1; i <= started; i++) {
+		pthread_join(threads[i], NULL);
+	}
+
+	for (i = 0; i < nthreads; i++) {
+		if (tasks[i].ret != 1) {
+			ret = -1;
+		}
+	}
+	tweak_add(ctx->tweak, nunits);
+	if (ret != 1) {
+		error_print();
+	}
+	return ret;
+}
+
+static int sm4_xts_update_threads(SM4_XTS_CTX *ctx, int enc,
+	const uint8_t *in, size_t inlen, uint8_t *out, size_t *outlen, int nthreads)
+{
+	size_t DATA_UNIT_SIZE;
+	size_t nunits;
+	size_t len;
+
+	if (!ctx || !in || !outlen) {
+		error_print();
+		return -1;
+	}
+	DATA_UNIT_SIZE = ctx->data_unit_size;
+	if (!out) {
+		*outlen = DATA_UNIT_SIZE * ((ctx->block_nbytes + inlen) / DATA_UNIT_SIZE);
+		return 1;
+	}
+	if (ctx->block_nbytes >= DATA_UNIT_SIZE) {
+		error_print();
+		return -1;
+	}
+	*outlen = 0;
+	if (ctx->block_nbytes) {
+		len = DATA_UNIT_SIZE - ctx->block_nbytes;
+		if (len > inlen) {
+			len = inlen;
+		}
+		if ((enc ? sm4_xts_encrypt_update(ctx, in, len, out, outlen)
+			: sm4_xts_decrypt_update(ctx, in, len, out, outlen)) != 1) {
+			error_print();
+			return -1;
+		}
+		in += len;
+		inlen -= len;
+		out += *outlen;
+	}
+	if (inlen >= DATA_UNIT_SIZE) {
+		nunits = inlen / DATA_UNIT_SIZE;
+		len = nunits * DATA_UNIT_SIZE;
+		if (sm4_xts_units_threads(ctx, enc, in, nunits, out, nthreads) != 1) {
+			error_print();
+			return -1;
+		}
+		in += len;
+		inlen -= len;
+		*outlen += len;
+	}
+	if (inlen) {
+		memcpy(ctx->block, in, inlen);
+		ctx->block_nbytes = inlen;
+	}
+	return 1;
+}
+
+int sm4_xts_encrypt_update_threads(SM4_XTS_CTX *ctx,
+	const uint8_t *in, size_t inlen, uint8_t *out, size_t *outlen, int nthreads)
+{
+	return sm4_xts_update_threads(ctx, 1, in, inlen, out, outlen, nthreads);
+}
+
+int sm4_xts_decrypt_update_threads(SM4_XTS_CTX *ctx,
+	const uint8_t *in, size_t inlen, uint8_t *out, size_t *outlen, int nthreads)
+{
+	return sm4_xts_update_threads(ctx, 0, in, inlen, out, outlen, nthreads);
+}
+#endif
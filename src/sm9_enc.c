@@ -19,19 +19,28 @@
 #include <gmssl/error.h>
 
 
-int sm9_kem_encrypt(const SM9_ENC_MASTER_KEY *mpk, const char *id, size_t idlen,
-	size_t klen, uint8_t *kbuf, SM9_Z256_POINT *C)
+// one of `mpk` and `prep` is used, g = e(Ppube, P2) is taken from `prep` if given
+static int sm9_kem_encrypt_ex(const SM9_ENC_MASTER_KEY *mpk, const SM9_ENC_MASTER_KEY_PREP *prep,
+	const char *id, size_t idlen, size_t klen, uint8_t *kbuf, SM9_Z256_POINT *C)
 {
+	const SM9_Z256_POINT *Ppube = prep ? &prep->Ppube : &mpk->Ppube;
 	sm9_z256_t r;
+	sm9_z256_fp12_t g;
 	sm9_z256_fp12_t w;
+	SM9_Z256_POINT Q;
 	uint8_t wbuf[32 * 12];
 	uint8_t cbuf[65];
 	SM3_KDF_CTX kdf_ctx;
 
 	// A1: Q = H1(ID||hid,N) * P1 + Ppube
 	sm9_z256_hash1(r, id, idlen, SM9_HID_ENC);
-	sm9_z256_point_mul(C, r, sm9_z256_generator());
-	sm9_z256_point_add(C, C, &mpk->Ppube);
+	sm9_z256_point_mul_generator(&Q, r);
+	sm9_z256_point_add(&Q, &Q, Ppube);
+
+	// A4: g = e(Ppube, P2)
+	if (!prep) {
+		sm9_z256_pairing(g, sm9_z256_twist_generator(), Ppube);
+	}
 
 	do {
 		// A2: rand r in [1, N-1]
@@ -41,14 +50,15 @@ int sm9_kem_encrypt(const SM9_ENC_MASTER_KEY *mpk, const char *id, size_t idlen,
 		}
 
 		// A3: C1 = r * Q
-		sm9_z256_point_mul(C, r, C);
+		sm9_z256_point_mul(C, r, &Q);
 		sm9_z256_point_to_uncompressed_octets(C, cbuf);
 
-		// A4: g = e(Ppube, P2)
-		sm9_z256_pairing(w, sm9_z256_twist_generator(), &mpk->Ppube);
-
 		// A5: w = g^r
-		sm9_z256_fp12_pow(w, w, r);
+		if (prep) {
+			sm9_z256_fp12_pow_with_table(w, &prep->g_table, r);
+		} else {
+			sm9_z256_fp12_cyclotomic_pow(w, g, r);
+		}
 		sm9_z256_fp12_to_bytes(w, wbuf);
 
 		// A6: K = KDF(C || w || ID_B, klen), if K == 0, goto A2
@@ -69,8 +79,33 @@ int sm9_kem_encrypt(const SM9_ENC_MASTER_KEY *mpk, const char *id, size_t idlen,
 	return 1;
 }
 
-int sm9_kem_decrypt(const SM9_ENC_KEY *key, const char *id, size_t idlen, const SM9_Z256_POINT *C,
-	size_t klen, uint8_t *kbuf)
+int sm9_kem_encrypt(const SM9_ENC_MASTER_KEY *mpk, const char *id, size_t idlen,
+	size_t klen, uint8_t *kbuf, SM9_Z256_POINT *C)
+{
+	return sm9_kem_encrypt_ex(mpk, NULL, id, idlen, klen, kbuf, C);
+}
+
+int sm9_kem_encrypt_prepared(const SM9_ENC_MASTER_KEY_PREP *prep, const char *id, size_t idlen,
+	size_t klen, uint8_t *kbuf, SM9_Z256_POINT *C)
+{
+	return sm9_kem_encrypt_ex(NULL, prep, id, idlen, klen, kbuf, C);
+}
+
+int sm9_enc_master_public_key_prepare(SM9_ENC_MASTER_KEY_PREP *prep, const SM9_ENC_MASTER_KEY *mpk)
+{
+	if (!prep || !mpk) {
+		error_print();
+		return -1;
+	}
+	prep->Ppube = mpk->Ppube;
+	sm9_z256_pairing(prep->g, sm9_z256_twist_generator(), &mpk->Ppube);
+	sm9_z256_fp12_pow_table_init(&prep->g_table, prep->g);
+	return 1;
+}
+
+// w = e(C, de) uses the prepared lines of de if `de_prep` is given
+static int sm9_kem_decrypt_ex(const SM9_ENC_KEY *key, const SM9_Z256_PAIRING_PREP *de_prep,
+	const char *id, size_t idlen, const SM9_Z256_POINT *C, size_t klen, uint8_t *kbuf)
 {
 	sm9_z256_fp12_t w;
 	uint8_t wbuf[32 * 12];
@@ -81,7 +116,11 @@ int sm9_kem_decrypt(const SM9_ENC_KEY *key, const char *id, size_t idlen, const
 	sm9_z256_point_to_uncompressed_octets(C, cbuf);
 
 	// B2: w = e(C, de);
-	sm9_z256_pairing(w, &key->de, C);
+	if (de_prep) {
+		sm9_z256_pairing_prepared(w, de_prep, C);
+	} else {
+		sm9_z256_pairing(w, &key->de, C);
+	}
 	sm9_z256_fp12_to_bytes(w, wbuf);
 
 	// B3: K = KDF(C || w || ID, klen)
@@ -104,14 +143,44 @@ int sm9_kem_decrypt(const SM9_ENC_KEY *key, const char *id, size_t idlen, const
 	return 1;
 }
 
-int sm9_do_encrypt(const SM9_ENC_MASTER_KEY *mpk, const char *id, size_t idlen,
-	const uint8_t *in, size_t inlen,
+int sm9_kem_decrypt(const SM9_ENC_KEY *key, const char *id, size_t idlen, const SM9_Z256_POINT *C,
+	size_t klen, uint8_t *kbuf)
+{
+	return sm9_kem_decrypt_ex(key, NULL, id, idlen, C, klen, kbuf);
+}
+
+int sm9_kem_decrypt_prepared(const SM9_ENC_KEY_PREP *key, const char *id, size_t idlen, const SM9_Z256_POINT *C,
+	size_t klen, uint8_t *kbuf)
+{
+	return sm9_kem_decrypt_ex(NULL, &key->de_prep, id, idlen, C, klen, kbuf);
+}
+
+int sm9_enc_key_prepare(SM9_ENC_KEY_PREP *prep, const SM9_ENC_KEY *key)
+{
+	if (!prep || !key) {
+		error_print();
+		return -1;
+	}
+	prep->key = *key;
+	sm9_z256_pairing_prepare(&prep->de_prep, &key->de);
+	return 1;
+}
+
+void sm9_enc_key_prep_cleanup(SM9_ENC_KEY_PREP *prep)
+{
+	if (prep) {
+		gmssl_secure_clear(prep, sizeof(SM9_ENC_KEY_PREP));
+	}
+}
+
+static int sm9_do_encrypt_ex(const SM9_ENC_MASTER_KEY *mpk, const SM9_ENC_MASTER_KEY_PREP *prep,
+	const char *id, size_t idlen, const uint8_t *in, size_t inlen,
 	SM9_Z256_POINT *C1, uint8_t *c2, uint8_t c3[SM3_HMAC_SIZE])
 {
 	SM3_HMAC_CTX hmac_ctx;
 	uint8_t K[SM9_MAX_PLAINTEXT_SIZE + 32];
 
-	if (sm9_kem_encrypt(mpk, id, idlen, sizeof(K), K, C1) != 1) {
+	if (sm9_kem_encrypt_ex(mpk, prep, id, idlen, sizeof(K), K, C1) != 1) {
 		error_print();
 		return -1;
 	}
@@ -125,7 +194,22 @@ int sm9_do_encrypt(const SM9_ENC_MASTER_KEY *mpk, const char *id, size_t idlen,
 	return 1;
 }
 
-int sm9_do_decrypt(const SM9_ENC_KEY *key, const char *id, size_t idlen,
+int sm9_do_encrypt(const SM9_ENC_MASTER_KEY *mpk, const char *id, size_t idlen,
+	const uint8_t *in, size_t inlen,
+	SM9_Z256_POINT *C1, uint8_t *c2, uint8_t c3[SM3_HMAC_SIZE])
+{
+	return sm9_do_encrypt_ex(mpk, NULL, id, idlen, in, inlen, C1, c2, c3);
+}
+
+int sm9_do_encrypt_prepared(const SM9_ENC_MASTER_KEY_PREP *prep, const char *id, size_t idlen,
+	const uint8_t *in, size_t inlen,
+	SM9_Z256_POINT *C1, uint8_t *c2, uint8_t c3[SM3_HMAC_SIZE])
+{
+	return sm9_do_encrypt_ex(NULL, prep, id, idlen, in, inlen, C1, c2, c3);
+}
+
+static int sm9_do_decrypt_ex(const SM9_ENC_KEY *key, const SM9_Z256_PAIRING_PREP *de_prep,
+	const char *id, size_t idlen,
 	const SM9_Z256_POINT *C1, const uint8_t *c2, size_t c2len, const uint8_t c3[SM3_HMAC_SIZE],
 	uint8_t *out)
 {
@@ -138,7 +222,7 @@ int sm9_do_decrypt(const SM9_ENC_KEY *key, const char *id, size_t idlen,
 		return -1;
 	}
 
-	if (sm9_kem_decrypt(key, id, idlen, C1, sizeof(k), k) != 1) {
+	if (sm9_kem_decrypt_ex(key, de_prep, id, idlen, C1, sizeof(k), k) != 1) {
 		error_print();
 		return -1;
 	}
@@ -156,6 +240,20 @@ int sm9_do_decrypt(const SM9_ENC_KEY *key, const char *id, size_t idlen,
 	return 1;
 }
 
+int sm9_do_decrypt(const SM9_ENC_KEY *key, const char *id, size_t idlen,
+	const SM9_Z256_POINT *C1, const uint8_t *c2, size_t c2len, const uint8_t c3[SM3_HMAC_SIZE],
+	uint8_t *out)
+{
+	return sm9_do_decrypt_ex(key, NULL, id, idlen, C1, c2, c2len, c3, out);
+}
+
+int sm9_do_decrypt_prepared(const SM9_ENC_KEY_PREP *key, const char *id, size_t idlen,
+	const SM9_Z256_POINT *C1, const uint8_t *c2, size_t c2len, const uint8_t c3[SM3_HMAC_SIZE],
+	uint8_t *out)
+{
+	return sm9_do_decrypt_ex(NULL, &key->de_prep, id, idlen, C1, c2, c2len, c3, out);
+}
+
 #define SM9_ENC_TYPE_XOR	0
 #define SM9_ENC_TYPE_ECB	1
 #define SM9_ENC_TYPE_CBC	2
@@ -238,8 +336,8 @@ int sm9_ciphertext_from_der(SM9_Z256_POINT *C1, const uint8_t **c2, size_t *c2le
 	return 1;
 }
 
-int sm9_encrypt(const SM9_ENC_MASTER_KEY *mpk, const char *id, size_t idlen,
-	const uint8_t *in, size_t inlen, uint8_t *out, size_t *outlen)
+static int sm9_encrypt_ex(const SM9_ENC_MASTER_KEY *mpk, const SM9_ENC_MASTER_KEY_PREP *prep,
+	const char *id, size_t idlen, const uint8_t *in, size_t inlen, uint8_t *out, size_t *outlen)
 {
 	SM9_Z256_POINT C1;
 	uint8_t c2[SM9_MAX_PLAINTEXT_SIZE];
@@ -250,7 +348,7 @@ int sm9_encrypt(const SM9_ENC_MASTER_KEY *mpk, const char *id, size_t idlen,
 		return -1;
 	}
 
-	if (sm9_do_encrypt(mpk, id, idlen, in, inlen, &C1, c2, c3) != 1) {
+	if (sm9_do_encrypt_ex(mpk, prep, id, idlen, in, inlen, &C1, c2, c3) != 1) {
 		error_print();
 		return -1;
 	}
@@ -262,7 +360,20 @@ int sm9_encrypt(const SM9_ENC_MASTER_KEY *mpk, const char *id, size_t idlen,
 	return 1;
 }
 
-int sm9_decrypt(const SM9_ENC_KEY *key, const char *id, size_t idlen,
+int sm9_encrypt(const SM9_ENC_MASTER_KEY *mpk, const char *id, size_t idlen,
+	const uint8_t *in, size_t inlen, uint8_t *out, size_t *outlen)
+{
+	return sm9_encrypt_ex(mpk, NULL, id, idlen, in, inlen, out, outlen);
+}
+
+int sm9_encrypt_prepared(const SM9_ENC_MASTER_KEY_PREP *prep, const char *id, size_t idlen,
+	const uint8_t *in, size_t inlen, uint8_t *out, size_t *outlen)
+{
+	return sm9_encrypt_ex(NULL, prep, id, idlen, in, inlen, out, outlen);
+}
+
+static int sm9_decrypt_ex(const SM9_ENC_KEY *key, const SM9_Z256_PAIRING_PREP *de_prep,
+	const char *id, size_t idlen,
 	const uint8_t *in, size_t inlen, uint8_t *out, size_t *outlen)
 {
 	SM9_Z256_POINT C1;
@@ -279,9 +390,21 @@ int sm9_decrypt(const SM9_ENC_KEY *key, const char *id, size_t idlen,
 	if (!out) {
 		return 1;
 	}
-	if (sm9_do_decrypt(key, id, idlen, &C1, c2, c2len, c3, out) != 1) {
+	if (sm9_do_decrypt_ex(key, de_prep, id, idlen, &C1, c2, c2len, c3, out) != 1) {
 		error_print();
 		return -1;
 	}
 	return 1;
 }
+
+int sm9_decrypt(const SM9_ENC_KEY *key, const char *id, size_t idlen,
+	const uint8_t *in, size_t inlen, uint8_t *out, size_t *outlen)
+{
+	return sm9_decrypt_ex(key, NULL, id, idlen, in, inlen, out, outlen);
+}
+
+int sm9_decrypt_prepared(const SM9_ENC_KEY_PREP *key, const char *id, size_t idlen,
+	const uint8_t *in, size_t inlen, uint8_t *out, size_t *outlen)
+{
+	return sm9_decrypt_ex(NULL, &key->de_prep, id, idlen, in, inlen, out, outlen);
+}
@@ -76,8 +76,8 @@ int sm9_exch_step_1B(const SM9_EXCH_MASTER_KEY *mpk, const char *idA, size_t idA
 		}
 		sm9_z256_pairing(G1, &key->de, RA);
 		sm9_z256_pairing(G2, sm9_z256_twist_generator(), &mpk->Ppube);
-		sm9_z256_fp12_pow(G2, G2, rB);
-		sm9_z256_fp12_pow(G3, G1, rB);
+		sm9_z256_fp12_cyclotomic_pow(G2, G2, rB);
+		sm9_z256_fp12_cyclotomic_pow(G3, G1, rB);
 
 		sm9_z256_point_to_uncompressed_octets(RA, ta);
 		sm9_z256_point_to_uncompressed_octets(RB, tb);
@@ -131,9 +131,9 @@ int sm9_exch_step_2A(const SM9_EXCH_MASTER_KEY *mpk, const char *idA, size_t idA
 			return -1;
 		}
 		sm9_z256_pairing(G1, sm9_z256_twist_generator(), &mpk->Ppube);
-		sm9_z256_fp12_pow(G1, G1, rA);
+		sm9_z256_fp12_cyclotomic_pow(G1, G1, rA);
 		sm9_z256_pairing(G2, &key->de, RB);
-		sm9_z256_fp12_pow(G3, G2, rA);
+		sm9_z256_fp12_cyclotomic_pow(G3, G2, rA);
 
 		sm9_z256_point_to_uncompressed_octets(RA, ta);
 		sm9_z256_point_to_uncompressed_octets(RB, tb);
@@ -20,6 +20,9 @@
 #include <gmssl/asn1.h>
 #include <gmssl/pkcs8.h>
 #include <gmssl/error.h>
+#ifdef ENABLE_PTHREAD
+#include <pthread.h>
+#endif
 
 
 // generate h1 in [1, n-1]
@@ -453,6 +456,232 @@ int sm9_exch_master_key_extract_key(SM9_EXCH_MASTER_KEY *msk, const char *id, si
 	return 1;
 }
 
+// t[i] = k * (H1(ID_i || hid, N) + k)^-1, the n inversions share one modn_inv (Montgomery's trick)
+static int sm9_extract_scalars(const sm9_z256_t k, uint8_t hid,
+	const char **ids, const size_t *idlens, size_t n, sm9_z256_t *t)
+{
+	int ret = -1;
+	sm9_z256_t acc[SM9_EXTRACT_BATCH_SIZE];
+	sm9_z256_t inv;
+	sm9_z256_t ti_inv;
+	size_t i;
+
+	if (!n || n > SM9_EXTRACT_BATCH_SIZE) {
+		error_print();
+		return -1;
+	}
+
+	// acc[i] = t[0] * ... * t[i]
+	for (i = 0; i < n; i++) {
+		sm9_z256_hash1(t[i], ids[i], idlens[i], hid);
+		sm9_z256_modn_add(t[i], t[i], k);
+		if (sm9_z256_is_zero(t[i])) {
+			error_print();
+			goto end;
+		}
+		if (i == 0) {
+			sm9_z256_copy(acc[0], t[0]);
+		} else {
+			sm9_z256_modn_mul(acc[i], acc[i - 1], t[i]);
+		}
+	}
+
+	sm9_z256_modn_inv(inv, acc[n - 1]);
+
+	// inv = (t[0] * ... * t[i])^-1 at the start of each step
+	for (i = n - 1; i > 0; i--) {
+		sm9_z256_modn_mul(ti_inv, inv, acc[i - 1]);
+		sm9_z256_modn_mul(inv, inv, t[i]);
+		sm9_z256_modn_mul(t[i], ti_inv, k);
+	}
+	sm9_z256_modn_mul(t[0], inv, k);
+	ret = 1;
+
+end:
+	gmssl_secure_clear(acc, sizeof(acc));
+	gmssl_secure_clear(inv, sizeof(inv));
+	gmssl_secure_clear(ti_inv, sizeof(ti_inv));
+	return ret;
+}
+
+int sm9_sign_master_key_extract_keys(const SM9_SIGN_MASTER_KEY *msk,
+	const char **ids, const size_t *idlens, size_t n, SM9_SIGN_KEY *keys)
+{
+	sm9_z256_t t[SM9_EXTRACT_BATCH_SIZE];
+	size_t i, len;
+
+	while (n) {
+		len = n < SM9_EXTRACT_BATCH_SIZE ? n : SM9_EXTRACT_BATCH_SIZE;
+
+		if (sm9_extract_scalars(msk->ks, SM9_HID_SIGN, ids, idlens, len, t) != 1) {
+			gmssl_secure_clear(t, sizeof(t));
+			error_print();
+			return -1;
+		}
+		// ds = t * P1
+		for (i = 0; i < len; i++) {
+			sm9_z256_point_mul_generator(&keys[i].ds, t[i]);
+			keys[i].Ppubs = msk->Ppubs;
+		}
+
+		ids += len;
+		idlens += len;
+		keys += len;
+		n -= len;
+	}
+
+	gmssl_secure_clear(t, sizeof(t));
+	return 1;
+}
+
+int sm9_enc_master_key_extract_keys(const SM9_ENC_MASTER_KEY *msk,
+	const char **ids, const size_t *idlens, size_t n, SM9_ENC_KEY *keys)
+{
+	sm9_z256_t t[SM9_EXTRACT_BATCH_SIZE];
+	size_t i, len;
+
+	while (n) {
+		len = n < SM9_EXTRACT_BATCH_SIZE ? n : SM9_EXTRACT_BATCH_SIZE;
+
+		if (sm9_extract_scalars(msk->ke, SM9_HID_ENC, ids, idlens, len, t) != 1) {
+			gmssl_secure_clear(t, sizeof(t));
+			error_print();
+			return -1;
+		}
+		// de = t * P2
+		for (i = 0; i < len; i++) {
+			sm9_z256_twist_point_mul_generator(&keys[i].de, t[i]);
+			keys[i].Ppube = msk->Ppube;
+		}
+
+		ids += len;
+		idlens += len;
+		keys += len;
+		n -= len;
+	}
+
+	gmssl_secure_clear(t, sizeof(t));
+	return 1;
+}
+
+#ifdef ENABLE_PTHREAD
+typedef struct {
+	const SM9_SIGN_MASTER_KEY *sign_msk;
+	const SM9_ENC_MASTER_KEY *enc_msk;
+	const char **ids;
+	const size_t *idlens;
+	size_t n;
+	SM9_SIGN_KEY *sign_keys;
+	SM9_ENC_KEY *enc_keys;
+	int ret;
+} SM9_EXTRACT_TASK;
+
+static void *sm9_extract_keys_routine(void *arg)
+{
+	SM9_EXTRACT_TASK *task = (SM9_EXTRACT_TASK *)arg;
+
+	if (task->sign_msk) {
+		task->ret = sm9_sign_master_key_extract_keys(task->sign_msk,
+			task->ids, task->idlens, task->n, task->sign_keys);
+	} else {
+		task->ret = sm9_enc_master_key_extract_keys(task->enc_msk,
+			task->ids, task->idlens, task->n, task->enc_keys);
+	}
+	return NULL;
+}
+
+// split ids into nthreads contiguous ranges, the first range is done by the calling thread
+static int sm9_extract_keys_threads(const SM9_EXTRACT_TASK *all, int nthreads)
+{
+	SM9_EXTRACT_TASK tasks[SM9_EXTRACT_MAX_THREADS];
+	pthread_t threads[SM9_EXTRACT_MAX_THREADS];
+	size_t per_thread, offset = 0;
+	int ret = 1;
+	int i, started = 0;
+
+	if (nthreads < 1) {
+		nthreads = 1;
+	}
+	if (nthreads > SM9_EXTRACT_MAX_THREADS) {
+		nthreads = SM9_EXTRACT_MAX_THREADS;
+	}
+	if ((size_t)nthreads > all->n) {
+		nthreads = all->n ? (int)all->n : 1;
+	}
+	per_thread = (all->n + nthreads - 1) / nthreads;
+
+	for (i = 0; i < nthreads; i++) {
+		size_t len = all->n - offset < per_thread ? all->n - offset : per_thread;
+
+		tasks[i] = *all;
+		tasks[i].ids += offset;
+		tasks[i].idlens += offset;
+		tasks[i].n = len;
+		if (tasks[i].sign_keys) tasks[i].sign_keys += offset;
+		if (tasks[i].enc_keys) tasks[i].enc_keys += offset;
+		tasks[i].ret = len ? -1 : 1;
+		offset += len;
+	}
+
+	for (i = 1; i < nthreads; i++) {
+		if (tasks[i].n && pthread_create(&threads[i], NULL, sm9_extract_keys_routine, &tasks[i]) != 0) {
+			error_print();
+			ret = -1;
+			break;
+		}
+		started = i;
+	}
+	if (tasks[0].n) {
+		sm9_extract_keys_routine(&tasks[0]);
+	}
+	for (i = 1; i <= started; i++) {
+		if (tasks[i].n) {
+			pthread_join(threads[i], NULL);
+		}
+	}
+
+	for (i = 0; i < nthreads; i++) {
+		if (tasks[i].ret != 1) {
+			ret = -1;
+		}
+	}
+	if (ret != 1) {
+		error_print();
+	}
+	return ret;
+}
+
+int sm9_sign_master_key_extract_keys_threads(const SM9_SIGN_MASTER_KEY *msk,
+	const char **ids, const size_t *idlens, size_t n, SM9_SIGN_KEY *keys, int nthreads)
+{
+	SM9_EXTRACT_TASK task;
+
+	memset(&task, 0, sizeof(task));
+	task.sign_msk = msk;
+	task.ids = ids;
+	task.idlens = idlens;
+	task.n = n;
+	task.sign_keys = keys;
+
+	return sm9_extract_keys_threads(&task, nthreads);
+}
+
+int sm9_enc_master_key_extract_keys_threads(const SM9_ENC_MASTER_KEY *msk,
+	const char **ids, const size_t *idlens, size_t n, SM9_ENC_KEY *keys, int nthreads)
+{
+	SM9_EXTRACT_TASK task;
+
+	memset(&task, 0, sizeof(task));
+	task.enc_msk = msk;
+	task.ids = ids;
+	task.idlens = idlens;
+	task.n = n;
+	task.enc_keys = keys;
+
+	return sm9_extract_keys_threads(&task, nthreads);
+}
+#endif
+
 
 #define OID_SM9	oid_sm_algors,302
 static uint32_t oid_sm9[] = { OID_SM9 };
@@ -89,13 +89,21 @@ int sm9_sign_update(SM9_SIGN_CTX *ctx, const uint8_t *data, size_t datalen)
 	return 1;
 }
 
-int sm9_sign_finish(SM9_SIGN_CTX *ctx, const SM9_SIGN_KEY *key, uint8_t *sig, size_t *siglen)
+static int sm9_sign_finish_ex(SM9_SIGN_CTX *ctx, const SM9_SIGN_KEY *key,
+	const SM9_SIGN_MASTER_KEY_PREP *prep, uint8_t *sig, size_t *siglen)
 {
 	SM9_SIGNATURE signature;
 
-	if (sm9_do_sign(key, &ctx->sm3_ctx, &signature) != 1) {
-		error_print();
-		return -1;
+	if (prep) {
+		if (sm9_do_sign_prepared(key, prep, &ctx->sm3_ctx, &signature) != 1) {
+			error_print();
+			return -1;
+		}
+	} else {
+		if (sm9_do_sign(key, &ctx->sm3_ctx, &signature) != 1) {
+			error_print();
+			return -1;
+		}
 	}
 	*siglen = 0;
 	if (sm9_signature_to_der(&signature, &sig, siglen) != 1) {
@@ -105,19 +113,47 @@ int sm9_sign_finish(SM9_SIGN_CTX *ctx, const SM9_SIGN_KEY *key, uint8_t *sig, si
 	return 1;
 }
 
-int sm9_do_sign(const SM9_SIGN_KEY *key, const SM3_CTX *sm3_ctx, SM9_SIGNATURE *sig)
+int sm9_sign_finish(SM9_SIGN_CTX *ctx, const SM9_SIGN_KEY *key, uint8_t *sig, size_t *siglen)
+{
+	return sm9_sign_finish_ex(ctx, key, NULL, sig, siglen);
+}
+
+int sm9_sign_finish_prepared(SM9_SIGN_CTX *ctx, const SM9_SIGN_KEY *key,
+	const SM9_SIGN_MASTER_KEY_PREP *prep, uint8_t *sig, size_t *siglen)
+{
+	return sm9_sign_finish_ex(ctx, key, prep, sig, siglen);
+}
+
+int sm9_sign_master_public_key_prepare(SM9_SIGN_MASTER_KEY_PREP *prep, const SM9_SIGN_MASTER_KEY *mpk)
+{
+	if (!prep || !mpk) {
+		error_print();
+		return -1;
+	}
+	prep->Ppubs = mpk->Ppubs;
+	sm9_z256_pairing(prep->g, &mpk->Ppubs, sm9_z256_generator());
+	sm9_z256_fp12_pow_table_init(&prep->g_table, prep->g);
+	return 1;
+}
+
+// g = e(P1, Ppubs) is taken from `prep` if given, else computed from `key->Ppubs`
+static int sm9_do_sign_ex(const SM9_SIGN_KEY *key, const SM9_SIGN_MASTER_KEY_PREP *prep,
+	const SM3_CTX *sm3_ctx, SM9_SIGNATURE *sig)
 {
 	sm9_z256_t r;
 	sm9_z256_fp12_t g;
+	sm9_z256_fp12_t w;
 	uint8_t wbuf[32 * 12];
-	SM3_CTX ctx = *sm3_ctx;
+	SM3_CTX ctx;
 	SM3_CTX tmp_ctx;
 	uint8_t ct1[4] = {0,0,0,1};
 	uint8_t ct2[4] = {0,0,0,2};
 	uint8_t Ha[64];
 
 	// A1: g = e(P1, Ppubs)
-	sm9_z256_pairing(g, &key->Ppubs, sm9_z256_generator());
+	if (!prep) {
+		sm9_z256_pairing(g, &key->Ppubs, sm9_z256_generator());
+	}
 
 	do {
 		// A2: rand r in [1, N-1]
@@ -130,10 +166,15 @@ int sm9_do_sign(const SM9_SIGN_KEY *key, const SM3_CTX *sm3_ctx, SM9_SIGNATURE *
 		//sm9_z256_from_hex(r, "00033C8616B06704813203DFD00965022ED15975C662337AED648835DC4B1CBE");
 
 		// A3: w = g^r
-		sm9_z256_fp12_pow(g, g, r);
-		sm9_z256_fp12_to_bytes(g, wbuf);
+		if (prep) {
+			sm9_z256_fp12_pow_with_table(w, &prep->g_table, r);
+		} else {
+			sm9_z256_fp12_cyclotomic_pow(w, g, r);
+		}
+		sm9_z256_fp12_to_bytes(w, wbuf);
 
 		// A4: h = H2(M || w, N)
+		ctx = *sm3_ctx;
 		sm3_update(&ctx, wbuf, sizeof(wbuf));
 		tmp_ctx = ctx;
 		sm3_update(&ctx, ct1, sizeof(ct1));
@@ -151,7 +192,7 @@ int sm9_do_sign(const SM9_SIGN_KEY *key, const SM3_CTX *sm3_ctx, SM9_SIGNATURE *
 	sm9_z256_point_mul(&sig->S, r, &key->ds);
 
 	gmssl_secure_clear(&r, sizeof(r));
-	gmssl_secure_clear(&g, sizeof(g));
+	gmssl_secure_clear(&w, sizeof(w));
 	gmssl_secure_clear(wbuf, sizeof(wbuf));
 	gmssl_secure_clear(&tmp_ctx, sizeof(tmp_ctx));
 	gmssl_secure_clear(Ha, sizeof(Ha));
@@ -159,6 +200,21 @@ int sm9_do_sign(const SM9_SIGN_KEY *key, const SM3_CTX *sm3_ctx, SM9_SIGNATURE *
 	return 1;
 }
 
+int sm9_do_sign(const SM9_SIGN_KEY *key, const SM3_CTX *sm3_ctx, SM9_SIGNATURE *sig)
+{
+	return sm9_do_sign_ex(key, NULL, sm3_ctx, sig);
+}
+
+int sm9_do_sign_prepared(const SM9_SIGN_KEY *key, const SM9_SIGN_MASTER_KEY_PREP *prep,
+	const SM3_CTX *sm3_ctx, SM9_SIGNATURE *sig)
+{
+	if (sm9_z256_twist_point_equ(&key->Ppubs, &prep->Ppubs) != 1) {
+		error_print();
+		return -1;
+	}
+	return sm9_do_sign_ex(key, prep, sm3_ctx, sig);
+}
+
 int sm9_verify_init(SM9_SIGN_CTX *ctx)
 {
 	const uint8_t prefix[1] = { SM9_HASH2_PREFIX };
@@ -173,8 +229,9 @@ int sm9_verify_update(SM9_SIGN_CTX *ctx, const uint8_t *data, size_t datalen)
 	return 1;
 }
 
-int sm9_verify_finish(SM9_SIGN_CTX *ctx, const uint8_t *sig, size_t siglen,
-	const SM9_SIGN_MASTER_KEY *mpk, const char *id, size_t idlen)
+static int sm9_verify_finish_ex(SM9_SIGN_CTX *ctx, const uint8_t *sig, size_t siglen,
+	const SM9_SIGN_MASTER_KEY *mpk, const SM9_SIGN_MASTER_KEY_PREP *prep,
+	const char *id, size_t idlen)
 {
 	int ret;
 	SM9_SIGNATURE signature;
@@ -185,19 +242,37 @@ int sm9_verify_finish(SM9_SIGN_CTX *ctx, const uint8_t *sig, size_t siglen,
 		return -1;
 	}
 
-	if ((ret = sm9_do_verify(mpk, id, idlen, &ctx->sm3_ctx, &signature)) < 0) {
+	if (prep) {
+		ret = sm9_do_verify_prepared(prep, id, idlen, &ctx->sm3_ctx, &signature);
+	} else {
+		ret = sm9_do_verify(mpk, id, idlen, &ctx->sm3_ctx, &signature);
+	}
+	if (ret < 0) {
 		error_print();
 		return -1;
 	}
 	return ret;
 }
 
-int sm9_do_verify(const SM9_SIGN_MASTER_KEY *mpk, const char *id, size_t idlen,
-	const SM3_CTX *sm3_ctx, const SM9_SIGNATURE *sig)
+int sm9_verify_finish(SM9_SIGN_CTX *ctx, const uint8_t *sig, size_t siglen,
+	const SM9_SIGN_MASTER_KEY *mpk, const char *id, size_t idlen)
+{
+	return sm9_verify_finish_ex(ctx, sig, siglen, mpk, NULL, id, idlen);
+}
+
+int sm9_verify_finish_prepared(SM9_SIGN_CTX *ctx, const uint8_t *sig, size_t siglen,
+	const SM9_SIGN_MASTER_KEY_PREP *prep, const char *id, size_t idlen)
 {
+	return sm9_verify_finish_ex(ctx, sig, siglen, NULL, prep, id, idlen);
+}
+
+// one of `mpk` and `prep` is used, g = e(P1, Ppubs) is taken from `prep` if given
+static int sm9_do_verify_ex(const SM9_SIGN_MASTER_KEY *mpk, const SM9_SIGN_MASTER_KEY_PREP *prep,
+	const char *id, size_t idlen, const SM3_CTX *sm3_ctx, const SM9_SIGNATURE *sig)
+{
+	const SM9_Z256_TWIST_POINT *Ppubs = prep ? &prep->Ppubs : &mpk->Ppubs;
 	sm9_z256_t h1;
 	sm9_z256_t h2;
-	sm9_z256_fp12_t g;
 	sm9_z256_fp12_t t;
 	sm9_z256_fp12_t u;
 	sm9_z256_fp12_t w;
@@ -210,27 +285,41 @@ int sm9_do_verify(const SM9_SIGN_MASTER_KEY *mpk, const char *id, size_t idlen,
 	uint8_t Ha[64];
 
 	// B1: check h in [1, N-1]
+	if (sm9_z256_is_zero(sig->h) || sm9_z256_cmp(sig->h, sm9_z256_order()) >= 0) {
+		return 0;
+	}
 
 	// B2: check S in G1
 
-	// B3: g = e(P1, Ppubs)
-	sm9_z256_pairing(g, &mpk->Ppubs, sm9_z256_generator());
-
-	// B4: t = g^h
-	sm9_z256_fp12_pow(t, g, sig->h);
-
 	// B5: h1 = H1(ID || hid, N)
 	sm9_z256_hash1(h1, id, idlen, SM9_HID_SIGN);
 
 	// B6: P = h1 * P2 + Ppubs
 	sm9_z256_twist_point_mul_generator(&P, h1);
-	sm9_z256_twist_point_add_full(&P, &P, &mpk->Ppubs);
-
-	// B7: u = e(S, P)
-	sm9_z256_pairing(u, &P, &sig->S);
-
-	// B8: w = u * t
-	sm9_z256_fp12_mul(w, u, t);
+	sm9_z256_twist_point_add_full(&P, &P, Ppubs);
+
+	if (prep) {
+		// B3: g = e(P1, Ppubs)
+		// B4: t = g^h
+		sm9_z256_fp12_pow_with_table(t, &prep->g_table, sig->h);
+
+		// B7: u = e(S, P)
+		sm9_z256_pairing(u, &P, &sig->S);
+
+		// B8: w = u * t
+		sm9_z256_fp12_mul(w, u, t);
+	} else {
+		// B3, B4, B7, B8: w = e(S, P) * e(P1, Ppubs)^h = e(S, P) * e(h * P1, Ppubs)
+		SM9_Z256_POINT hP1;
+		SM9_Z256_PAIRING_PAIR pairs[2];
+
+		sm9_z256_point_mul_generator(&hP1, sig->h);
+		pairs[0].Q = &P;
+		pairs[0].P = &sig->S;
+		pairs[1].Q = Ppubs;
+		pairs[1].P = &hP1;
+		sm9_z256_pairing_product(w, pairs, 2);
+	}
 	sm9_z256_fp12_to_bytes(w, wbuf);
 
 	// B9: h2 = H2(M || w, N), check h2 == h
@@ -247,3 +336,48 @@ int sm9_do_verify(const SM9_SIGN_MASTER_KEY *mpk, const char *id, size_t idlen,
 
 	return 1;
 }
+
+int sm9_do_verify(const SM9_SIGN_MASTER_KEY *mpk, const char *id, size_t idlen,
+	const SM3_CTX *sm3_ctx, const SM9_SIGNATURE *sig)
+{
+	return sm9_do_verify_ex(mpk, NULL, id, idlen, sm3_ctx, sig);
+}
+
+int sm9_do_verify_prepared(const SM9_SIGN_MASTER_KEY_PREP *prep, const char *id, size_t idlen,
+	const SM3_CTX *sm3_ctx, const SM9_SIGNATURE *sig)
+{
+	return sm9_do_verify_ex(NULL, prep, id, idlen, sm3_ctx, sig);
+}
+
+// e(S, P) of each signature is hashed with its own h, so only g = e(P1, Ppubs) and its table are shared
+int sm9_verify_many(const SM9_SIGN_MASTER_KEY *mpk, SM9_VERIFY_JOB *jobs, size_t njobs)
+{
+	SM9_SIGN_MASTER_KEY_PREP prep;
+	SM9_SIGN_CTX ctx;
+	int ret = 1;
+	size_t i;
+
+	if (!mpk || (!jobs && njobs)) {
+		error_print();
+		return -1;
+	}
+	if (!njobs) {
+		return 1;
+	}
+	if (sm9_sign_master_public_key_prepare(&prep, mpk) != 1) {
+		error_print();
+		return -1;
+	}
+
+	for (i = 0; i < njobs; i++) {
+		SM9_VERIFY_JOB *job = &jobs[i];
+
+		sm9_verify_init(&ctx);
+		sm9_verify_update(&ctx, job->msg, job->msglen);
+		job->ret = sm9_verify_finish_prepared(&ctx, job->sig, job->siglen, &prep, job->id, job->idlen);
+		if (job->ret != 1) {
+			ret = 0;
+		}
+	}
+	return ret;
+}
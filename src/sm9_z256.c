@@ -19,6 +19,9 @@
 #include <gmssl/error.h>
 #include <gmssl/endian.h>
 #include <gmssl/rand.h>
+#ifdef ENABLE_SM9_AMD64
+#include <cpuid.h>
+#endif
 
 
 #define SM9_Z256_HEX_SEP '\n'
@@ -32,7 +35,7 @@ const sm9_z256_t SM9_Z256_P = {
 	0xe56f9b27e351457d, 0x21f2934b1a7aeedb, 0xd603ab4ff58ec745, 0xb640000002a3a6f1
 };
 
-const uint64_t *sm9_256_prime(void) {
+const uint64_t *sm9_z256_prime(void) {
 	return &SM9_Z256_P[0];
 }
 
@@ -414,7 +417,7 @@ int sm9_z256_print(FILE *fp, int ind, int fmt, const char *label, const sm9_z256
 }
 
 
-#ifndef ENABLE_SM9_ARM64
+#if !defined(ENABLE_SM9_ARM64) && !defined(ENABLE_SM9_AMD64)
 void sm9_z256_modp_add(sm9_z256_t r, const sm9_z256_t a, const sm9_z256_t b)
 {
 	uint64_t c;
@@ -446,6 +449,13 @@ void sm9_z256_modp_dbl(sm9_z256_t r, const sm9_z256_t a)
 	sm9_z256_modp_add(r, a, a);
 }
 
+void sm9_z256_modp_neg(sm9_z256_t r, const sm9_z256_t a)
+{
+	(void)sm9_z256_sub(r, SM9_Z256_P, a);
+}
+#endif
+
+#ifndef ENABLE_SM9_ARM64
 void sm9_z256_modp_tri(sm9_z256_t r, const sm9_z256_t a)
 {
 	sm9_z256_t t;
@@ -471,11 +481,6 @@ void sm9_z256_modp_haf(sm9_z256_t r, const sm9_z256_t a)
 	r[2] = (r[2] >> 1) | ((r[3] & 1) << 63);
 	r[3] = (r[3] >> 1) | ((c & 1) << 63);
 }
-
-void sm9_z256_modp_neg(sm9_z256_t r, const sm9_z256_t a)
-{
-	(void)sm9_z256_sub(r, SM9_Z256_P, a);
-}
 #endif
 
 
@@ -653,7 +658,11 @@ static uint64_t sm9_z512_add(uint64_t r[8], const uint64_t a[8], const uint64_t
 
 // z = a*b
 // c = (z + (z * p' mod 2^256) * p)/2^256
+#ifdef ENABLE_SM9_AMD64
+static void sm9_z256_modp_mont_mul_generic(uint64_t r[4], const uint64_t a[4], const uint64_t b[4])
+#else
 void sm9_z256_modp_mont_mul(uint64_t r[4], const uint64_t a[4], const uint64_t b[4])
+#endif
 {
 	uint64_t z[8];
 	uint64_t t[8];
@@ -684,6 +693,59 @@ void sm9_z256_modp_mont_mul(uint64_t r[4], const uint64_t a[4], const uint64_t b
 #endif // ENABLE_SM9_ARM64
 
 
+#ifdef ENABLE_SM9_AMD64
+// src/sm9_z256_amd64.S, the MULX/ADCX/ADOX code needs BMI2 and ADX
+void sm9_z256_modp_mont_mul_adx(uint64_t r[4], const uint64_t a[4], const uint64_t b[4]);
+void sm9_z256_modp_mont_sqr_adx(uint64_t r[4], const uint64_t a[4]);
+
+// set by cpuid when the library is loaded, so the hot path only reads it
+static int sm9_z256_modp_adx = 0;
+
+int sm9_z256_cpu_supports_adx(void)
+{
+	unsigned int eax, ebx, ecx, edx;
+
+	if (__get_cpuid_max(0, NULL) < 7) {
+		return 0;
+	}
+	__cpuid_count(7, 0, eax, ebx, ecx, edx);
+
+	// CPUID.(EAX=7,ECX=0):EBX bit 8 BMI2, bit 19 ADX
+	return (ebx & (1 << 8)) && (ebx & (1 << 19)) ? 1 : 0;
+}
+
+int sm9_z256_modp_set_adx(int enable)
+{
+	sm9_z256_modp_adx = (enable && sm9_z256_cpu_supports_adx()) ? 1 : 0;
+	return sm9_z256_modp_adx;
+}
+
+__attribute__((constructor))
+static void sm9_z256_modp_adx_init(void)
+{
+	sm9_z256_modp_set_adx(1);
+}
+
+void sm9_z256_modp_mont_mul(uint64_t r[4], const uint64_t a[4], const uint64_t b[4])
+{
+	if (sm9_z256_modp_adx) {
+		sm9_z256_modp_mont_mul_adx(r, a, b);
+	} else {
+		sm9_z256_modp_mont_mul_generic(r, a, b);
+	}
+}
+
+void sm9_z256_modp_mont_sqr(sm9_z256_t r, const sm9_z256_t a)
+{
+	if (sm9_z256_modp_adx) {
+		sm9_z256_modp_mont_sqr_adx(r, a);
+	} else {
+		sm9_z256_modp_mont_mul_generic(r, a, a);
+	}
+}
+#endif
+
+
 #ifndef ENABLE_SM9_ARM64
 void sm9_z256_modp_to_mont(sm9_z256_t r, const sm9_z256_t a)
 {
@@ -695,11 +757,13 @@ void sm9_z256_modp_from_mont(sm9_z256_t r, const sm9_z256_t a)
 	sm9_z256_modp_mont_mul(r, a, SM9_Z256_ONE);
 }
 
+#ifndef ENABLE_SM9_AMD64
 void sm9_z256_modp_mont_sqr(sm9_z256_t r, const sm9_z256_t a)
 {
 	sm9_z256_modp_mont_mul(r, a, a);
 }
 #endif
+#endif
 
 void sm9_z256_modp_mont_pow(sm9_z256_t r, const sm9_z256_t a, const sm9_z256_t e)
 {
@@ -1760,6 +1824,268 @@ void sm9_z256_fp12_frobenius6(sm9_z256_fp12_t r, const sm9_z256_fp12_t x)
 	sm9_z256_fp4_copy(r[2], c);
 }
 
+/*
+ * Cyclotomic subgroup GT of order p^4 - p^2 + 1, i.e. pairing outputs after the
+ * easy part of the final exponentiation. With a = a0 + a1 * w + a2 * w^2 and
+ * conj() the p^2-Frobenius of Fp4 (v -> -v), Granger-Scott squaring is
+ *	a^2 = (3 * a0^2 - 2 * conj(a0)) + (3 * v * a2^2 + 2 * conj(a1)) * w
+ *		+ (3 * a1^2 - 2 * conj(a2)) * w^2
+ * Karabina compressed squaring only keeps a1, a2 and recovers a0 at the end.
+ */
+void sm9_z256_fp12_cyclotomic_sqr(sm9_z256_fp12_t r, const sm9_z256_fp12_t a)
+{
+	sm9_z256_fp4_t t0, t1, t2, t;
+
+	sm9_z256_fp4_sqr(t0, a[0]);
+	sm9_z256_fp4_sqr(t1, a[1]);
+	sm9_z256_fp4_sqr_v(t2, a[2]);
+
+	// r0 = 3 * (t0 - conj(a0)) + conj(a0)
+	sm9_z256_fp4_conjugate(t, a[0]);
+	sm9_z256_fp4_sub(t0, t0, t);
+	sm9_z256_fp4_add(r[0], t0, t0);
+	sm9_z256_fp4_add(r[0], r[0], t0);
+	sm9_z256_fp4_add(r[0], r[0], t);
+
+	// r2 = 3 * (t1 - conj(a2)) + conj(a2)
+	sm9_z256_fp4_conjugate(t, a[2]);
+	sm9_z256_fp4_sub(t1, t1, t);
+	sm9_z256_fp4_add(r[2], t1, t1);
+	sm9_z256_fp4_add(r[2], r[2], t1);
+	sm9_z256_fp4_add(r[2], r[2], t);
+
+	// r1 = 3 * (t2 + conj(a1)) - conj(a1)
+	sm9_z256_fp4_conjugate(t, a[1]);
+	sm9_z256_fp4_add(t2, t2, t);
+	sm9_z256_fp4_add(r[1], t2, t2);
+	sm9_z256_fp4_add(r[1], r[1], t2);
+	sm9_z256_fp4_sub(r[1], r[1], t);
+}
+
+// a = (g0 + g1 * v) + (g2 + g3 * v) * w + (g4 + g5 * v) * w^2, only (g2, g3, g4, g5) are used and updated
+void sm9_z256_fp12_compressed_sqr(sm9_z256_fp12_t r, const sm9_z256_fp12_t a)
+{
+	sm9_z256_fp4_t t1, t2;
+	sm9_z256_fp2_t t;
+
+	sm9_z256_fp4_sqr(t1, a[1]); // (g2^2 + u * g3^2) + 2 * g2 * g3 * v
+	sm9_z256_fp4_sqr(t2, a[2]); // (g4^2 + u * g5^2) + 2 * g4 * g5 * v
+
+	// h2 = 3 * u * (2 * g4 * g5) + 2 * g2
+	sm9_z256_fp2_a_mul_u(t2[1], t2[1]);
+	sm9_z256_fp2_add(t, t2[1], a[1][0]);
+	sm9_z256_fp2_tri(t, t);
+	sm9_z256_fp2_sub(t2[1], t, a[1][0]);
+
+	// h3 = 3 * (g4^2 + u * g5^2) - 2 * g3
+	sm9_z256_fp2_sub(t, t2[0], a[1][1]);
+	sm9_z256_fp2_tri(t, t);
+	sm9_z256_fp2_add(t2[0], t, a[1][1]);
+
+	// h4 = 3 * (g2^2 + u * g3^2) - 2 * g4
+	sm9_z256_fp2_sub(t, t1[0], a[2][0]);
+	sm9_z256_fp2_tri(t, t);
+	sm9_z256_fp2_add(t1[0], t, a[2][0]);
+
+	// h5 = 3 * (2 * g2 * g3) + 2 * g5
+	sm9_z256_fp2_add(t, t1[1], a[2][1]);
+	sm9_z256_fp2_tri(t, t);
+	sm9_z256_fp2_sub(t1[1], t, a[2][1]);
+
+	sm9_z256_fp2_copy(r[1][0], t2[1]);
+	sm9_z256_fp2_copy(r[1][1], t2[0]);
+	sm9_z256_fp2_copy(r[2][0], t1[0]);
+	sm9_z256_fp2_copy(r[2][1], t1[1]);
+}
+
+// recover (g0, g1) of a compressed element, costs one Fp inversion
+void sm9_z256_fp12_decompress(sm9_z256_fp12_t r, const sm9_z256_fp12_t a)
+{
+	const sm9_z256_t *g2 = a[1][0], *g3 = a[1][1], *g4 = a[2][0], *g5 = a[2][1];
+	sm9_z256_fp2_t g1, t0, t1;
+
+	if (!sm9_z256_fp2_is_zero(g2)) {
+		// g1 = (u * g5^2 + 3 * g4^2 - 2 * g3) / (4 * g2)
+		sm9_z256_fp2_sqr_u(t0, g5);
+		sm9_z256_fp2_sqr(t1, g4);
+		sm9_z256_fp2_tri(t1, t1);
+		sm9_z256_fp2_add(t0, t0, t1);
+		sm9_z256_fp2_dbl(t1, g3);
+		sm9_z256_fp2_sub(t0, t0, t1);
+		sm9_z256_fp2_dbl(t1, g2);
+		sm9_z256_fp2_dbl(t1, t1);
+		sm9_z256_fp2_div(g1, t0, t1);
+
+		// t0 = g2 * g5
+		sm9_z256_fp2_mul(t0, g2, g5);
+	} else {
+		// g1 = 2 * g4 * g5 / g3
+		sm9_z256_fp2_mul(t0, g4, g5);
+		sm9_z256_fp2_dbl(t0, t0);
+		sm9_z256_fp2_div(g1, t0, g3);
+
+		sm9_z256_fp2_set_zero(t0);
+	}
+
+	// g0 = u * (2 * g1^2 + g2 * g5 - 3 * g3 * g4) + 1
+	sm9_z256_fp2_sqr(t1, g1);
+	sm9_z256_fp2_dbl(t1, t1);
+	sm9_z256_fp2_add(t0, t0, t1);
+	sm9_z256_fp2_mul(t1, g3, g4);
+	sm9_z256_fp2_tri(t1, t1);
+	sm9_z256_fp2_sub(t0, t0, t1);
+	sm9_z256_fp2_a_mul_u(t0, t0);
+	sm9_z256_modp_add(t0[0], t0[0], SM9_Z256_MODP_MONT_ONE);
+
+	if (r != a) {
+		sm9_z256_fp4_copy(r[1], a[1]);
+		sm9_z256_fp4_copy(r[2], a[2]);
+	}
+	sm9_z256_fp2_copy(r[0][0], t0);
+	sm9_z256_fp2_copy(r[0][1], g1);
+}
+
+// compressed squaring saves 1/3 of a cyclotomic squaring, the decompression
+// (an Fp inversion) is about 17 cyclotomic squarings, only long runs are compressed
+#define SM9_Z256_COMPRESSED_SQR_MIN	56
+
+void sm9_z256_fp12_cyclotomic_sqr_n(sm9_z256_fp12_t r, const sm9_z256_fp12_t a, int n)
+{
+	int i;
+
+	if (n < SM9_Z256_COMPRESSED_SQR_MIN) {
+		sm9_z256_fp12_copy(r, a);
+		for (i = 0; i < n; i++) {
+			sm9_z256_fp12_cyclotomic_sqr(r, r);
+		}
+		return;
+	}
+
+	sm9_z256_fp12_compressed_sqr(r, a);
+	for (i = 1; i < n; i++) {
+		sm9_z256_fp12_compressed_sqr(r, r);
+	}
+	sm9_z256_fp12_decompress(r, r);
+}
+
+// signed window exponentiation in GT, a^-1 = conjugate(a), any k in [0, 2^256)
+void sm9_z256_fp12_cyclotomic_pow(sm9_z256_fp12_t r, const sm9_z256_fp12_t a, const sm9_z256_t k)
+{
+	sm9_z256_fp12_t T[16];
+	sm9_z256_fp12_t t;
+	sm9_z256_fp12_t c;
+	uint64_t window_size;
+	int nbits, n, tsize;
+	int t_is_one = 1;
+	int nsqr = 0;
+	int i;
+
+	for (nbits = 256; nbits > 0; nbits--) {
+		if ((k[(nbits - 1) / 64] >> ((nbits - 1) % 64)) & 1) {
+			break;
+		}
+	}
+	if (nbits == 0) {
+		sm9_z256_fp12_set_one(r);
+		return;
+	}
+
+	// the table costs 2^(w-1) - 1 multiplications
+	window_size = nbits > 128 ? 5 : (nbits > 32 ? 4 : (nbits > 8 ? 3 : 1));
+	tsize = 1 << (window_size - 1);
+	n = (int)((nbits + window_size) / window_size);
+
+	// T[i] = a^(i + 1)
+	sm9_z256_fp12_copy(T[0], a);
+	if (tsize > 1) {
+		sm9_z256_fp12_cyclotomic_sqr(T[1], a);
+	}
+	for (i = 2; i < tsize; i++) {
+		sm9_z256_fp12_mul(T[i], T[i - 1], a);
+	}
+
+	sm9_z256_fp12_set_one(t);
+
+	for (i = n - 1; i >= 0; i--) {
+		int booth = sm9_z256_get_booth(k, window_size, i);
+
+		if (!t_is_one) {
+			nsqr += (int)window_size;
+		}
+		if (booth == 0) {
+			continue;
+		}
+		sm9_z256_fp12_cyclotomic_sqr_n(t, t, nsqr);
+		nsqr = 0;
+		if (booth > 0) {
+			sm9_z256_fp12_mul(t, t, T[booth - 1]);
+		} else {
+			sm9_z256_fp12_frobenius6(c, T[-booth - 1]);
+			sm9_z256_fp12_mul(t, t, c);
+		}
+		t_is_one = 0;
+	}
+	sm9_z256_fp12_cyclotomic_sqr_n(r, t, nsqr);
+
+	gmssl_secure_clear(T, sizeof(T));
+	gmssl_secure_clear(t, sizeof(t));
+	gmssl_secure_clear(c, sizeof(c));
+}
+
+void sm9_z256_fp12_pow_table_init(SM9_Z256_FP12_POW_TABLE *table, const sm9_z256_fp12_t a)
+{
+	int i, j;
+
+	sm9_z256_fp12_copy(table->T[0][0], a);
+
+	for (i = 0; i < 4; i++) {
+		if (i > 0) {
+			sm9_z256_fp12_cyclotomic_sqr_n(table->T[i][0], table->T[i - 1][0], 64);
+		}
+		sm9_z256_fp12_cyclotomic_sqr(table->T[i][1], table->T[i][0]);
+		for (j = 2; j < 16; j++) {
+			sm9_z256_fp12_mul(table->T[i][j], table->T[i][j - 1], table->T[i][0]);
+		}
+	}
+}
+
+// k = k0 + k1 * 2^64 + k2 * 2^128 + k3 * 2^192, the four 64-bit parts are
+// Booth encoded and share the squarings, a^-1 = conjugate(a) in GT
+void sm9_z256_fp12_pow_with_table(sm9_z256_fp12_t r, const SM9_Z256_FP12_POW_TABLE *table, const sm9_z256_t k)
+{
+	uint64_t window_size = 5;
+	sm9_z256_fp12_t t;
+	sm9_z256_fp12_t c;
+	int t_is_one = 1;
+	int n = (int)((64 + window_size) / window_size);
+	int i, j;
+
+	sm9_z256_fp12_set_one(t);
+
+	for (j = n - 1; j >= 0; j--) {
+		if (!t_is_one) {
+			sm9_z256_fp12_cyclotomic_sqr_n(t, t, (int)window_size);
+		}
+		for (i = 0; i < 4; i++) {
+			const sm9_z256_t ki = { k[i], 0, 0, 0 };
+			int booth = sm9_z256_get_booth(ki, window_size, j);
+
+			if (booth > 0) {
+				sm9_z256_fp12_mul(t, t, table->T[i][booth - 1]);
+				t_is_one = 0;
+			} else if (booth < 0) {
+				sm9_z256_fp12_frobenius6(c, table->T[i][-booth - 1]);
+				sm9_z256_fp12_mul(t, t, c);
+				t_is_one = 0;
+			}
+		}
+	}
+
+	sm9_z256_fp12_copy(r, t);
+	gmssl_secure_clear(t, sizeof(t));
+	gmssl_secure_clear(c, sizeof(c));
+}
+
 int sm9_z256_point_from_hex(SM9_Z256_POINT *R, const char hex[64 * 2 + 1])
 {
 	if (sm9_z256_from_hex(R->X, hex) != 1) {
@@ -2271,7 +2597,7 @@ void sm9_z256_twist_point_dbl(SM9_Z256_TWIST_POINT *R, const SM9_Z256_TWIST_POIN
 	sm9_z256_fp2_copy(R->Z, Z3);
 }
 
-void sm9_z256_twist_point_add(SM9_Z256_TWIST_POINT *R, const SM9_Z256_TWIST_POINT *P, const SM9_Z256_TWIST_POINT *Q)
+void sm9_z256_twist_point_add_affine(SM9_Z256_TWIST_POINT *R, const SM9_Z256_TWIST_POINT *P, const SM9_Z256_TWIST_AFFINE_POINT *Q)
 {
 	const sm9_z256_t *X1 = P->X;
 	const sm9_z256_t *Y1 = P->Y;
@@ -2280,12 +2606,10 @@ void sm9_z256_twist_point_add(SM9_Z256_TWIST_POINT *R, const SM9_Z256_TWIST_POIN
 	const sm9_z256_t *y2 = Q->Y;
 	sm9_z256_fp2_t X3, Y3, Z3, T1, T2, T3, T4;
 
-	if (sm9_z256_twist_point_is_at_infinity(Q)) {
-		*R = *P;
-		return;
-	}
 	if (sm9_z256_twist_point_is_at_infinity(P)) {
-		*R = *Q;
+		sm9_z256_fp2_copy(R->X, Q->X);
+		sm9_z256_fp2_copy(R->Y, Q->Y);
+		sm9_z256_fp2_set_one(R->Z);
 		return;
 	}
 
@@ -2297,7 +2621,7 @@ void sm9_z256_twist_point_add(SM9_Z256_TWIST_POINT *R, const SM9_Z256_TWIST_POIN
 	sm9_z256_fp2_sub(T2, T2, Y1);
 	if (sm9_z256_fp2_is_zero(T1)) {
 		if (sm9_z256_fp2_is_zero(T2)) {
-			sm9_z256_twist_point_dbl(R, Q);
+			sm9_z256_twist_point_dbl(R, P);
 			return;
 		} else {
 			sm9_z256_twist_point_set_infinity(R);
@@ -2322,6 +2646,20 @@ void sm9_z256_twist_point_add(SM9_Z256_TWIST_POINT *R, const SM9_Z256_TWIST_POIN
 	sm9_z256_fp2_copy(R->Z, Z3);
 }
 
+// Q->Z is assumed to be 1
+void sm9_z256_twist_point_add(SM9_Z256_TWIST_POINT *R, const SM9_Z256_TWIST_POINT *P, const SM9_Z256_TWIST_POINT *Q)
+{
+	SM9_Z256_TWIST_AFFINE_POINT Q_;
+
+	if (sm9_z256_twist_point_is_at_infinity(Q)) {
+		*R = *P;
+		return;
+	}
+	sm9_z256_fp2_copy(Q_.X, Q->X);
+	sm9_z256_fp2_copy(Q_.Y, Q->Y);
+	sm9_z256_twist_point_add_affine(R, P, &Q_);
+}
+
 void sm9_z256_twist_point_sub(SM9_Z256_TWIST_POINT *R, const SM9_Z256_TWIST_POINT *P, const SM9_Z256_TWIST_POINT *Q)
 {
 	SM9_Z256_TWIST_POINT _T, *T = &_T;
@@ -2388,26 +2726,121 @@ void sm9_z256_twist_point_add_full(SM9_Z256_TWIST_POINT *R, const SM9_Z256_TWIST
 	sm9_z256_fp2_copy(R->Z, T7);
 }
 
-void sm9_z256_twist_point_mul(SM9_Z256_TWIST_POINT *R, const sm9_z256_t k, const SM9_Z256_TWIST_POINT *P)
+// r = table[idx - 1] or zero if idx == 0, all entries are read
+static void sm9_z256_table_select(uint64_t *r, const uint64_t *table, size_t nwords, int tsize, int idx)
 {
-	SM9_Z256_TWIST_POINT _Q, *Q = &_Q;
-	char kbits[256];
 	int i;
+	size_t j;
+
+	for (j = 0; j < nwords; j++) {
+		r[j] = 0;
+	}
+	for (i = 1; i <= tsize; i++) {
+		uint64_t mask = (uint64_t)0 - (uint64_t)(i == idx);
+		for (j = 0; j < nwords; j++) {
+			r[j] |= table[j] & mask;
+		}
+		table += nwords;
+	}
+}
+
+// y = -y if neg
+static void sm9_z256_fp2_cond_neg(sm9_z256_fp2_t y, int neg)
+{
+	uint64_t mask = (uint64_t)0 - (uint64_t)(neg != 0);
+	sm9_z256_fp2_t t;
+	int i, j;
+
+	sm9_z256_fp2_neg(t, y);
+	for (i = 0; i < 2; i++) {
+		for (j = 0; j < 4; j++) {
+			y[i][j] = (t[i][j] & mask) | (y[i][j] & ~mask);
+		}
+	}
+}
+
+// table lookups and negations do not depend on the Booth digits,
+// sm9_z256_twist_point_add_full still branches on the point at infinity
+void sm9_z256_twist_point_mul(SM9_Z256_TWIST_POINT *R, const sm9_z256_t k, const SM9_Z256_TWIST_POINT *P)
+{
+	uint64_t window_size = 5;
+	SM9_Z256_TWIST_POINT T[16];
+	SM9_Z256_TWIST_POINT Q;
+	int n = (int)((256 + window_size - 1)/window_size);
+	int i, j;
+
+	// T[i] = (i + 1) * P
+	T[0] = *P;
+
+	sm9_z256_twist_point_dbl(&T[2-1], &T[1-1]);
+	sm9_z256_twist_point_dbl(&T[4-1], &T[2-1]);
+	sm9_z256_twist_point_dbl(&T[8-1], &T[4-1]);
+	sm9_z256_twist_point_dbl(&T[16-1], &T[8-1]);
+	sm9_z256_twist_point_add_full(&T[3-1], &T[2-1], P);
+	sm9_z256_twist_point_dbl(&T[6-1], &T[3-1]);
+	sm9_z256_twist_point_dbl(&T[12-1], &T[6-1]);
+	sm9_z256_twist_point_add_full(&T[5-1], &T[3-1], &T[2-1]);
+	sm9_z256_twist_point_dbl(&T[10-1], &T[5-1]);
+	sm9_z256_twist_point_add_full(&T[7-1], &T[4-1], &T[3-1]);
+	sm9_z256_twist_point_dbl(&T[14-1], &T[7-1]);
+	sm9_z256_twist_point_add_full(&T[9-1], &T[4-1], &T[5-1]);
+	sm9_z256_twist_point_add_full(&T[11-1], &T[6-1], &T[5-1]);
+	sm9_z256_twist_point_add_full(&T[13-1], &T[7-1], &T[6-1]);
+	sm9_z256_twist_point_add_full(&T[15-1], &T[8-1], &T[7-1]);
+
+	sm9_z256_twist_point_set_infinity(R);
+
+	for (i = n - 1; i >= 0; i--) {
+		int booth = sm9_z256_get_booth(k, window_size, i);
+		int sign = booth >> (sizeof(int) * 8 - 1);
 
-	sm9_z256_to_bits(k, kbits);
-	sm9_z256_twist_point_set_infinity(Q);
-	for (i = 0; i < 256; i++) {
-		sm9_z256_twist_point_dbl(Q, Q);
-		if (kbits[i] == '1') {
-			sm9_z256_twist_point_add_full(Q, Q, P);
+		for (j = 0; j < (int)window_size; j++) {
+			sm9_z256_twist_point_dbl(R, R);
 		}
+
+		// Q = T[|booth| - 1] or the point at infinity (Z = 0)
+		sm9_z256_table_select((uint64_t *)&Q, (const uint64_t *)T,
+			sizeof(SM9_Z256_TWIST_POINT)/sizeof(uint64_t), 16, (booth ^ sign) - sign);
+		sm9_z256_fp2_cond_neg(Q.Y, sign);
+		sm9_z256_twist_point_add_full(R, R, &Q);
 	}
-	*R = *Q;
+
+	gmssl_secure_clear(T, sizeof(T));
+	gmssl_secure_clear(&Q, sizeof(Q));
 }
 
+extern const uint64_t sm9_z256_twist_pre_comp[52][16 * 4 * 4];
+static const SM9_Z256_TWIST_AFFINE_POINT (*g_twist_pre_comp)[16] = (const SM9_Z256_TWIST_AFFINE_POINT (*)[16])sm9_z256_twist_pre_comp;
+
 void sm9_z256_twist_point_mul_generator(SM9_Z256_TWIST_POINT *R, const sm9_z256_t k)
 {
-	sm9_z256_twist_point_mul(R, k, &SM9_Z256_MONT_P2);
+	uint64_t window_size = 5;
+	SM9_Z256_TWIST_AFFINE_POINT Q;
+	SM9_Z256_TWIST_POINT S;
+	int n = (int)((256 + window_size - 1)/window_size);
+	int i;
+
+	sm9_z256_twist_point_set_infinity(R);
+
+	for (i = n - 1; i >= 0; i--) {
+		int booth = sm9_z256_get_booth(k, window_size, i);
+		int sign = booth >> (sizeof(int) * 8 - 1);
+		uint64_t mask = (uint64_t)0 - (uint64_t)(booth != 0);
+		size_t j;
+
+		sm9_z256_table_select((uint64_t *)&Q, (const uint64_t *)g_twist_pre_comp[i],
+			sizeof(SM9_Z256_TWIST_AFFINE_POINT)/sizeof(uint64_t), 16, (booth ^ sign) - sign);
+		sm9_z256_fp2_cond_neg(Q.Y, sign);
+
+		// R = R + Q if booth != 0
+		sm9_z256_twist_point_add_affine(&S, R, &Q);
+		for (j = 0; j < sizeof(S)/sizeof(uint64_t); j++) {
+			((uint64_t *)R)[j] = (((uint64_t *)&S)[j] & mask) | (((uint64_t *)R)[j] & ~mask);
+		}
+	}
+
+	gmssl_secure_clear(&Q, sizeof(Q));
+	gmssl_secure_clear(&S, sizeof(S));
 }
 
 #if 0
@@ -2735,26 +3168,27 @@ void sm9_z256_final_exponent_hard_part(sm9_z256_fp12_t r, const sm9_z256_fp12_t
 	const sm9_z256_t nine = {9,0,0,0};
 	sm9_z256_fp12_t t0, t1, t2, t3;
 
-	sm9_z256_fp12_pow(t0, f, a3);
-	sm9_z256_fp12_inv(t0, t0);
+	// f is in the cyclotomic subgroup after the easy part
+	sm9_z256_fp12_cyclotomic_pow(t0, f, a3);
+	sm9_z256_fp12_frobenius6(t0, t0);
 	sm9_z256_fp12_frobenius(t1, t0);
 	sm9_z256_fp12_mul(t1, t0, t1);
 
 	sm9_z256_fp12_mul(t0, t0, t1);
 	sm9_z256_fp12_frobenius(t2, f);
 	sm9_z256_fp12_mul(t3, t2, f);
-	sm9_z256_fp12_pow(t3, t3, nine);
+	sm9_z256_fp12_cyclotomic_pow(t3, t3, nine);
 
 	sm9_z256_fp12_mul(t0, t0, t3);
-	sm9_z256_fp12_sqr(t3, f);
-	sm9_z256_fp12_sqr(t3, t3);
+	sm9_z256_fp12_cyclotomic_sqr(t3, f);
+	sm9_z256_fp12_cyclotomic_sqr(t3, t3);
 	sm9_z256_fp12_mul(t0, t0, t3);
-	sm9_z256_fp12_sqr(t2, t2);
+	sm9_z256_fp12_cyclotomic_sqr(t2, t2);
 	sm9_z256_fp12_mul(t2, t2, t1);
 	sm9_z256_fp12_frobenius2(t1, f);
 	sm9_z256_fp12_mul(t1, t1, t2);
 
-	sm9_z256_fp12_pow(t2, t1, a2);
+	sm9_z256_fp12_cyclotomic_pow(t2, t1, a2);
 	sm9_z256_fp12_mul(t0, t2, t0);
 	sm9_z256_fp12_frobenius3(t1, f);
 	sm9_z256_fp12_mul(t1, t1, t0);
@@ -2891,9 +3325,12 @@ void sm9_z256_fp12_line_mul(sm9_z256_fp12_t r, const sm9_z256_fp12_t a, const sm
 	sm9_z256_fp4_copy(r[2], r2);
 }
 
+// NAF of the R-ate loop count 6t + 2, '2' for -1
+static const char *sm9_z256_ate_loop_bits = "00100000000000000000000000000000000000010000101100020200101000020";
+
 void sm9_z256_pairing(sm9_z256_fp12_t r, const SM9_Z256_TWIST_POINT *Q, const SM9_Z256_POINT *P)
 {
-	const char *abits = "00100000000000000000000000000000000000010000101100020200101000020";
+	const char *abits = sm9_z256_ate_loop_bits;
 
 	SM9_Z256_TWIST_POINT T;
 	SM9_Z256_TWIST_POINT Q1;
@@ -2951,6 +3388,179 @@ void sm9_z256_pairing(sm9_z256_fp12_t r, const SM9_Z256_TWIST_POINT *Q, const SM
 	sm9_z256_final_exponent(r, r);
 }
 
+// the Miller loop of sm9_z256_pairing with the lines evaluated at P = (1, 1),
+// lw[1] and lw[2] are to be scaled by the x and y of the G1 point
+void sm9_z256_pairing_prepare(SM9_Z256_PAIRING_PREP *prep, const SM9_Z256_TWIST_POINT *Q)
+{
+	const char *abits = sm9_z256_ate_loop_bits;
+
+	SM9_Z256_TWIST_POINT T;
+	SM9_Z256_TWIST_POINT Q1;
+	SM9_Z256_TWIST_POINT Q2;
+	SM9_Z256_AFFINE_POINT P_;
+	sm9_z256_fp2_t pre[5];
+	size_t i, n = 0;
+
+	sm9_z256_copy(P_.X, SM9_Z256_MODP_MONT_ONE);
+	sm9_z256_copy(P_.Y, SM9_Z256_MODP_MONT_ONE);
+
+	sm9_z256_fp2_copy(T.X, Q->X);
+	sm9_z256_fp2_copy(T.Y, Q->Y);
+	sm9_z256_fp2_copy(T.Z, Q->Z);
+
+	sm9_z256_twist_point_neg(&Q1, Q);
+
+	sm9_z256_fp2_sqr(pre[0], Q->Y);
+	sm9_z256_fp2_mul(pre[4], Q->X, Q->Z);
+	sm9_z256_fp2_dbl(pre[4], pre[4]);
+	sm9_z256_fp2_sqr(pre[1], Q->Z);
+	sm9_z256_fp2_mul(pre[1], pre[1], Q->Z);
+	sm9_z256_fp2_dbl(pre[2], pre[1]);
+	sm9_z256_fp2_neg(pre[3], pre[2]);
+
+	for (i = 0; i < strlen(abits); i++) {
+		sm9_z256_eval_g_tangent(&T, prep->lw[n++], &T, &P_);
+
+		if (abits[i] == '1') {
+			sm9_z256_eval_g_line(&T, prep->lw[n++], pre, &T, Q, &P_);
+		} else if (abits[i] == '2') {
+			sm9_z256_eval_g_line(&T, prep->lw[n++], pre, &T, &Q1, &P_);
+		}
+	}
+
+	sm9_z256_twist_point_pi1(&Q1, Q);
+	sm9_z256_twist_point_neg_pi2(&Q2, Q);
+
+	sm9_z256_eval_g_line_no_pre(&T, prep->lw[n++], &T, &Q1, &P_);
+	sm9_z256_eval_g_line_no_pre(&T, prep->lw[n++], &T, &Q2, &P_);
+
+	assert(n == SM9_Z256_PAIRING_LINES);
+	gmssl_secure_clear(&T, sizeof(T));
+	gmssl_secure_clear(pre, sizeof(pre));
+}
+
+static void sm9_z256_fp12_prepared_line_mul(sm9_z256_fp12_t r, const sm9_z256_fp12_t a,
+	const sm9_z256_fp2_t lw[3], const SM9_Z256_AFFINE_POINT *P)
+{
+	sm9_z256_fp2_t l[3];
+
+	sm9_z256_fp2_copy(l[0], lw[0]);
+	sm9_z256_fp2_mul_fp(l[1], lw[1], P->X);
+	sm9_z256_fp2_mul_fp(l[2], lw[2], P->Y);
+	sm9_z256_fp12_line_mul(r, a, (const sm9_z256_fp2_t *)l);
+}
+
+void sm9_z256_pairing_prepared(sm9_z256_fp12_t r, const SM9_Z256_PAIRING_PREP *prep, const SM9_Z256_POINT *P)
+{
+	const char *abits = sm9_z256_ate_loop_bits;
+	SM9_Z256_AFFINE_POINT P_;
+	sm9_z256_fp12_t f;
+	size_t i, n = 0;
+
+	sm9_z256_point_to_affine(&P_, P);
+
+	sm9_z256_fp12_set_one(f);
+
+	for (i = 0; i < strlen(abits); i++) {
+		sm9_z256_fp12_sqr(f, f);
+		sm9_z256_fp12_prepared_line_mul(f, f, prep->lw[n++], &P_);
+
+		if (abits[i] != '0') {
+			sm9_z256_fp12_prepared_line_mul(f, f, prep->lw[n++], &P_);
+		}
+	}
+	sm9_z256_fp12_prepared_line_mul(f, f, prep->lw[n++], &P_);
+	sm9_z256_fp12_prepared_line_mul(f, f, prep->lw[n++], &P_);
+
+	sm9_z256_final_exponent(r, f);
+}
+
+#define SM9_Z256_MILLER_LOOP_LANES	4
+
+// f = f * prod(f_{Q_i}(P_i)) for up to SM9_Z256_MILLER_LOOP_LANES pairs, the Fp12 squarings are shared
+static void sm9_z256_miller_loop_product(sm9_z256_fp12_t f, const SM9_Z256_PAIRING_PAIR *pairs, size_t n)
+{
+	const char *abits = sm9_z256_ate_loop_bits;
+
+	SM9_Z256_TWIST_POINT T[SM9_Z256_MILLER_LOOP_LANES];
+	SM9_Z256_TWIST_POINT Q1[SM9_Z256_MILLER_LOOP_LANES];
+	SM9_Z256_TWIST_POINT Q2;
+	SM9_Z256_AFFINE_POINT P_[SM9_Z256_MILLER_LOOP_LANES];
+	sm9_z256_fp2_t pre[SM9_Z256_MILLER_LOOP_LANES][5];
+	sm9_z256_fp2_t lw[3];
+	sm9_z256_fp12_t g;
+	size_t i, j;
+
+	for (j = 0; j < n; j++) {
+		const SM9_Z256_TWIST_POINT *Q = pairs[j].Q;
+
+		T[j] = *Q;
+		sm9_z256_point_to_affine(&P_[j], pairs[j].P);
+		sm9_z256_twist_point_neg(&Q1[j], Q);
+
+		sm9_z256_fp2_sqr(pre[j][0], Q->Y);
+		sm9_z256_fp2_mul(pre[j][4], Q->X, Q->Z);
+		sm9_z256_fp2_dbl(pre[j][4], pre[j][4]);
+		sm9_z256_fp2_sqr(pre[j][1], Q->Z);
+		sm9_z256_fp2_mul(pre[j][1], pre[j][1], Q->Z);
+		sm9_z256_fp2_mul_fp(pre[j][2], pre[j][1], P_[j].Y);
+		sm9_z256_fp2_dbl(pre[j][2], pre[j][2]);
+		sm9_z256_fp2_mul_fp(pre[j][3], pre[j][1], P_[j].X);
+		sm9_z256_fp2_dbl(pre[j][3], pre[j][3]);
+		sm9_z256_fp2_neg(pre[j][3], pre[j][3]);
+	}
+
+	sm9_z256_fp12_set_one(g);
+
+	for (i = 0; i < strlen(abits); i++) {
+		sm9_z256_fp12_sqr(g, g);
+
+		for (j = 0; j < n; j++) {
+			sm9_z256_eval_g_tangent(&T[j], lw, &T[j], &P_[j]);
+			sm9_z256_fp12_line_mul(g, g, lw);
+
+			if (abits[i] == '1') {
+				sm9_z256_eval_g_line(&T[j], lw, pre[j], &T[j], pairs[j].Q, &P_[j]);
+				sm9_z256_fp12_line_mul(g, g, lw);
+			} else if (abits[i] == '2') {
+				sm9_z256_eval_g_line(&T[j], lw, pre[j], &T[j], &Q1[j], &P_[j]);
+				sm9_z256_fp12_line_mul(g, g, lw);
+			}
+		}
+	}
+
+	for (j = 0; j < n; j++) {
+		sm9_z256_twist_point_pi1(&Q1[j], pairs[j].Q);
+		sm9_z256_twist_point_neg_pi2(&Q2, pairs[j].Q);
+
+		sm9_z256_eval_g_line_no_pre(&T[j], lw, &T[j], &Q1[j], &P_[j]);
+		sm9_z256_fp12_line_mul(g, g, lw);
+
+		sm9_z256_eval_g_line_no_pre(&T[j], lw, &T[j], &Q2, &P_[j]);
+		sm9_z256_fp12_line_mul(g, g, lw);
+	}
+
+	sm9_z256_fp12_mul(f, f, g);
+}
+
+void sm9_z256_pairing_product(sm9_z256_fp12_t r, const SM9_Z256_PAIRING_PAIR *pairs, size_t n)
+{
+	sm9_z256_fp12_t f;
+	size_t i, len;
+
+	sm9_z256_fp12_set_one(f);
+
+	for (i = 0; i < n; i += len) {
+		len = n - i;
+		if (len > SM9_Z256_MILLER_LOOP_LANES) {
+			len = SM9_Z256_MILLER_LOOP_LANES;
+		}
+		sm9_z256_miller_loop_product(f, pairs + i, len);
+	}
+
+	sm9_z256_final_exponent(r, f);
+}
+
 void sm9_z256_modn_add(sm9_z256_t r, const sm9_z256_t a, const sm9_z256_t b)
 {
 	uint64_t c;
@@ -0,0 +1,3457 @@
+/*
+ *  Copyright 2014-2024 The GmSSL Project. All Rights Reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the License); you may
+ *  not use this file except in compliance with the License.
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+
+// T[i][j] = (j + 1) * 2^(5 * i) * P2 in affine, X and Y in Montgomery form
+
+#if defined(__GNUC__)
+__attribute((aligned(4096)))
+#elif defined(_MSC_VER)
+__declspec(align(4096))
+#endif
+
+const uint64_t sm9_z256_twist_pre_comp[52][16 * 4 * 4] = {
+	{
+	 0x260226a68ce2da8f, 0x7ee5645edbf6c06b, 0xf8f57c82b1495444, 0x61fcf018bc47c4d1,
+	 0xdb6db4822750a8a6, 0x84c6135a5121f134, 0x1874032f88791d41, 0x905112f2b85f3a37,
+	 0xc03f138f9171c24a, 0x92fbab45a15a3ca7, 0x2445561e2ff77cdb, 0x108495e0c0f62ece,
+	 0xf7b82dac4c89bfbb, 0x3706f3f6a49dc12f, 0x1e29de93d3eef769, 0x81e448c3c76a5d53,
+	 0x814e681a70c32949, 0x14c6a2bfb140479a, 0x95cc9ed999e0b315, 0x4372300772daace1,
+	 0xfb7eb8a0dcf3d8c2, 0xf03b823f276fcf4e, 0xf72e796b76822ac0, 0x50406b3e354177c4,
+	 0x9aedf94af5f34a70, 0xc073ddfd668e95d3, 0x4c5edf11042acc9a, 0x80a5ea228ff6ae1d,
+	 0x6b979082a9a03880, 0x0052ae25cd2ce885, 0x600df0a6126b4f55, 0x07e0d5a3f4373fac,
+	 0xedfd06d2ec68eb44, 0x669ab2a49646567c, 0x94b3ba8d638609dd, 0x9d50967a8c01677a,
+	 0xca225be55d140878, 0x1586c4331c659f63, 0xaa31b77e22b49b59, 0x42f0e62accc63dd3,
+	 0xac327b9ed843b2cd, 0x2bc00eea73cc2db2, 0xa96c47607fa0fd47, 0x895f20d4ff905ad1,
+	 0x695a425b3273c79e, 0x0d8c1038b510dd45, 0x8698c724d1a48767, 0x2d07046d33f2fd2a,
+	 0x9721c1af682c9b1b, 0x569a67a0efca89a3, 0xe48f94d3d095bde3, 0x13fdef912578d104,
+	 0xdd219d4807c8e15d, 0xa52c8e11d52d05a3, 0x1fa24dacd5b1d64f, 0x9ab16b2f5f170056,
+	 0x9cd4ce974e8cb09a, 0xc6037fb134ee7e0c, 0xbda5e99828535dd8, 0xb10337dba1b1b2ab,
+	 0x02491b9338419138, 0x98c91d4df2d9aab7, 0xe51345f24e258191, 0x15fbd27e3c81136a,
+	 0x6fec562730f4f660, 0x34d8179e51059d9f, 0x43d51964b5bf8a48, 0x49a13b6cdca51b8e,
+	 0xae8daa69a4a89872, 0x202cca7ee2d8df6d, 0x5d308bfd705ac938, 0x7f7786ddec6f5405,
+	 0xe71205ae0667d863, 0xffc50f456957595f, 0x96b6c42c5bd3a05c, 0x2017b791807be8f8,
+	 0x20e34e9bd85afee7, 0x37f0e7d8ee251a07, 0xdd018478c2abf040, 0x3b0fb93533ef9a9b,
+	 0xbf776996e0fa8cb8, 0x57b61e1b0bec625c, 0xee4f9041b32ea710, 0x7346c7be01c781b3,
+	 0xd7ec57ac55300d96, 0x7439b1dfedcaa8f3, 0x348bf67f26061d43, 0x28ce0cf83144e229,
+	 0xb711677b1b9c5dce, 0xdb0f4fb1afbec611, 0xd058d3ef7eaebced, 0x4c510cdd9d450de9,
+	 0xa4655113e7ccb0b9, 0xd1b01ed49fc1cb6e, 0x6d12f2f92f3d18de, 0x15739c38f53b0ffc,
+	 0x53d2c2acf0082426, 0x08847671a9670b3c, 0x9401a0d47ac45e24, 0x13d6f89bc9536677,
+	 0xde5cd41e903a302c, 0x5470222ef59b70b9, 0xe0ca4915d33cadc0, 0x428e39a44ebf9ecd,
+	 0x62428cd55d030c3e, 0x10e48596aa2154bd, 0x75f4e38795d2b8c7, 0xb4ab281ffae4ae5c,
+	 0x6a70ae8e34eff734, 0xa98fc38663888d30, 0xe54c2a035083a5e7, 0x3b9ff7c8bb467496,
+	 0x542546e637ac4682, 0x25ad2aa2b8b09243, 0xca327d0c4e4a52b3, 0x1991fade272535e9,
+	 0x27d2c01e845a0151, 0x8511758313f7b336, 0x011e689a9781ed30, 0x6e67a970a19b9a02,
+	 0x5897612984368fa9, 0xcdaf4bc6f1279e45, 0xfa6b7d872a666c16, 0x7d5bb92933974dee,
+	 0x9e2f86e0bcda833a, 0xd9c07ae0255bb3a8, 0x98e5c6a80b5f3bc9, 0x7f5188e66d076d28,
+	 0x97d81c1fb38fb3bf, 0x6ac1dd19ab8c4c8e, 0x11ee3a1653ff95c8, 0xa1292a33ac62fe23,
+	 0xfa9f28bfa7c0546a, 0x045cbe8c200bab12, 0x0d56301649c9a50c, 0x44d2e4db6f310b9d,
+	 0x4e546bfb379e2c9c, 0x6bcbdeeac59cb041, 0xfe1c5faa0b8d496f, 0x1c8e356633227a1f,
+	 0x899cdc6fcbd8b34c, 0x0c92e81ef5148852, 0x5345909a7b40215b, 0x00cd010cc5e9cfd3,
+	 0xbfe0b7086defbf8e, 0x495075de57e58c02, 0xad76c02f9751dc73, 0x5b62930130df0293,
+	 0x62016c6915a99cab, 0x911b2c032e0cdd7e, 0x0ec930180354b791, 0x434628f67d8c7b8d,
+	 0x67b5281f746d3d90, 0xeecdbd9a17d978b6, 0xdec74199551999e4, 0x9e92827352b66e53,
+	 0x457f61454f34a1b7, 0x2ecaec6d386b92d5, 0xe929c7d31be2a0ce, 0x55d287923317ff76,
+	 0x0b479bfcb3e8b41c, 0x8eb5d2d97500712e, 0x09aed2a4caf0d886, 0xb58f3182883cb283,
+	 0x8ac1fcfe643e2958, 0xd99dfb638325d87e, 0x8315128fd43ae18c, 0x55baa9fee2a22ef5,
+	 0xd447dcf0b18a5f32, 0xf81c2407a33c45e0, 0xc45d790a19474bbc, 0x6aa2ac00b7461ea7,
+	 0xe2b62bbf8f0f3622, 0x1a04464bcf1ee625, 0x9f467ef5b2626b11, 0x4ccab10fb72ec805,
+	 0xa305cbb340fdc391, 0x993c3aa3f8bc120b, 0x918d878d51341b24, 0x627083593b7d063a,
+	 0xfbb233beff3846a2, 0xff90d41da065420f, 0xcad409dd4299385f, 0x231c3c7198f4d246,
+	 0xc6d2ad58faaa2ba4, 0xb047b064064dfc9d, 0xf2bf4fbf659cea96, 0x668203b7b017b368,
+	 0xaab632adf9157b1c, 0x68bf0cda9592ce6d, 0x9b77eb7f180eedff, 0x048b673bdca41bbb,
+	 0xba5d5b6d38759136, 0x66a79dccea58b432, 0x954d1cf9a016ebce, 0x83a8b43ebfaa7eca,
+	 0x0fadb5c463a70bab, 0x4058e6cc9fca0289, 0xb16465654ad5554f, 0x6a39b677c8f626be,
+	 0x3e859fc8b14d8bf7, 0x1fb29572fa241766, 0xb225b5a4880670e8, 0x8f9c20be746cf430,
+	 0x5a23008bdec58073, 0x03b96837064f6bf8, 0x05a7050ad35f21b9, 0x8568707af666e74b,
+	 0xa8f4f5935254044e, 0x3bb01bd6b7850137, 0x488573198988b23a, 0x31e149e049443b82,
+	 0x4cc04496e3517429, 0x453468cd20963e9a, 0xa9e45ba899ebff1d, 0x8938b9050ec12fab,
+	 0x2d164f147c78f96d, 0xff0d1ee344658002, 0x7a03f4efbacd695d, 0x3788d4d103c265e1,
+	 0x09d781a4f7d82c4d, 0xb108f7f088100d55, 0x9c52524355fb88cd, 0x677fb96d079e5248,
+	 0x03f988117056acfe, 0x8ff8f58fe0796489, 0xea4f514720312a20, 0x89727c3bd5ac2085,
+	 0x883a3f2ccac3dfe7, 0x4e407d1af5c05fbd, 0x042c30b9823c59c8, 0xa4b121b5ea414f8d,
+	 0x9030e284f7c3794f, 0xcb17014fae811c32, 0x64a92921feab90e2, 0x5b425722a4f609a2,
+	 0xeb2bee7344328fda, 0xd4c5e2b015873574, 0x38f551e47e407746, 0x0a920ed66fa50106,
+	 0xd4c4cf27191dd9ed, 0x1a7d144ead7ccab3, 0xfc318deef992271d, 0x6fb8e29f60460969,
+	 0xe7218dd51f7ce21d, 0xf4e68b92fd3b5cc7, 0x15f5f02c375a0e25, 0x2156d4b38548b288,
+	 0xe964d9c5b7f47ba2, 0x97606490e04b9199, 0x2da3c296d799e319, 0x4a910bb920303cbc,
+	 0xab6b8410b89834a5, 0x772376db19e32a94, 0x99cd9f945f0e0126, 0x3009ecfba9b4a41c
+	},
+	{
+	 0x6e581b2cf2161075, 0x1fe4b16726a28f16, 0x51a20561cde15339, 0x3a869091a6ad7ea6,
+	 0x381d47d590233103, 0x7e80c0b61e1bbbfb, 0x32c4b14a6068371e, 0x1c075b96b9012d58,
+	 0x25cd56f05d9cdc1f, 0x3c66398c9a25d48a, 0x1bb449f912f94398, 0x6a532c16cf9e8f7f,
+	 0x0a41429716003c22, 0xd2ffa263533da1a4, 0xdad1be17895dded8, 0x3d367bdfcc840175,
+	 0x6ed2c733275c8944, 0xe23d4da97f1726e2, 0xd1a9c5eca8067b9d, 0x34e442ca9ee432d6,
+	 0x80605b05588c0494, 0xc0769951805ed101, 0x26d35a50b8eece11, 0x719a5f32968e3bde,
+	 0xa33e9782bf91819f, 0x37f94c493630b98d, 0x51229c8140159e68, 0x0067f659257a2a01,
+	 0xb194cb6fa65dca3c, 0x89e4a60a3bd8c20e, 0x9740b14469c2c6e3, 0x4eb3e763fb686cb1,
+	 0xfef3bc17cfa2e3a9, 0x3ba90a557437f894, 0xa7f42655351c5c18, 0x9e4c442f3a186cfd,
+	 0xedbcbe0bc577ed9c, 0xff263b89cdf4bb6f, 0x710ae80af968730e, 0x52ce71bbba66059e,
+	 0xde834ff1ad04d8bf, 0x03835114dacd6302, 0xc0bcfed631c66ff7, 0x1bf2aa8968ed9cb5,
+	 0x1bcace188a21e8ed, 0x6f704727b92c6660, 0x7069cee4f441cd48, 0x0b262ddafe4f6ccb,
+	 0x97d6ffd857ff6d5d, 0xa0f5fee637591854, 0x6ec6ca1e5749e61b, 0x8791c2149e96a1bc,
+	 0x38a63c4c9c4ce9fb, 0x39ffbf2c27be5e89, 0x96a543728f1b47ae, 0x26ddabe00a7e1e56,
+	 0xe56be7428cc35d21, 0x6a72b7fed695ffb0, 0x97b9576f640a2d75, 0x54d116bd8347bb22,
+	 0x3bfdbbd1e1c94d48, 0x29a58ed074783ab6, 0x3a513fc59cfa8905, 0x6fac9dc351e633f3,
+	 0x74262887d762ad89, 0x773f4186348683f6, 0x1dcc54f28d6ee95f, 0x0d0475448298a43b,
+	 0xc0238945c62d2c91, 0x05261ba545397373, 0x7432ae73a44e5c3d, 0x052ef1d55c82915b,
+	 0x01623b63e25bfb93, 0x58d92ddb498ad95e, 0xf14a72735a821423, 0x1d858937e204e98a,
+	 0x11156831b059f265, 0x57986c9fa0d51770, 0x49bc46195bf3763b, 0x2b33ec51c91ea3e7,
+	 0xa897b511ce7b1f8f, 0x560b460224dcfe5b, 0x85055131d9206216, 0x674a84d521ceed16,
+	 0x08c4c108850dacf3, 0x4b13c74f58d610ff, 0xfd35a34ef52d1e3e, 0x10844a6e82fa65b9,
+	 0x47dd2398b21c23a4, 0xefec05135e765c76, 0xad020273bd4ea1d4, 0x8d81bdc2c3195cf1,
+	 0xd832a32d008fd661, 0xfdfe5fa3d52845fc, 0x02f6e9cc936cd5e9, 0x093b367b05f470ce,
+	 0x6261ddabb5b9ef97, 0x745d9ef87804631a, 0xccd1745ec4d2b59a, 0x60e1e5c909364e62,
+	 0xab424fddcf86b7c9, 0x3eda2a0aeb1dcd05, 0x46c8dc15d0b370c4, 0x6fb8c46c83efbbd2,
+	 0xdb7313d0ec2ba800, 0x1d73f66d7060cb1d, 0xd13b411713a28f13, 0x10a41cf917215a31,
+	 0xd814ed50f36f6ba0, 0xbf700d6292dbe707, 0xd06525038bce8d32, 0x1d2f109ab8b9c707,
+	 0x923484a0ba24fcb8, 0xbefde60a7d1a9193, 0x57c36c023fd8c6d9, 0xb19366457832613e,
+	 0xad6e079436ed0281, 0x0878db2afe757d7a, 0xb5bf1685d0793320, 0x5b0c80eb4b7bd1f6,
+	 0xddfb38e88f3f0572, 0x5cb636a15ce25e05, 0xcad27714969a9306, 0x649258f4a5889805,
+	 0x32c7ba5b4d291e29, 0xa1d9579b1674ee5d, 0x689452cdd349c905, 0x67df9a358ff6a4af,
+	 0x18a7f21264b38c9d, 0x9fc36581b825f3d9, 0x32eec465d2a633b2, 0x8c67f80bd601ed74,
+	 0x1044b523f14c74e4, 0x2108ebc1e84cd210, 0x5e56a15ea796cd40, 0x76547c245a6a3356,
+	 0xa7550ee7633790ae, 0xf20203796fbb84a7, 0x3618d802ff0c1bb5, 0x8d4a091660414768,
+	 0xc168825f6e5ee493, 0x60b86cea403fdfd3, 0x038b84861ff0cd73, 0x3979e25ff72ec486,
+	 0xf719c1f7f6fd0fa3, 0x64a319feabbc8541, 0xf534b3320350874c, 0xae9c58390e781676,
+	 0x93d8bf9bcbd76181, 0x23e0903e4a52a17c, 0xbf027adc74cbd44b, 0x8b685dce9c6b492d,
+	 0xa282e1cc56359615, 0x1605360f061f9409, 0xe4ff84e6dd592ddb, 0xb1b59e13c88ccc52,
+	 0xa5c7f969c705a385, 0xf8e86a2b8131c3bc, 0x706256e1df2f009a, 0x383b8165cf7cd579,
+	 0xd179d00f588658fd, 0x52c2fed2b2c1cddd, 0xded70315654b7239, 0x6970ba2453b2a7dd,
+	 0xf160957779aad33f, 0xca041301a5e0c837, 0x2cfc63056d68d8f0, 0x24eb89d11afbc608,
+	 0x15e94a97686a7e8c, 0xb2f47323a9499f2b, 0xc487cf7ae133868f, 0x524804740a3a19d2,
+	 0x3e6063adad47b1e1, 0xe3a32ff7d14d9f62, 0x75a898b1e58463e5, 0x25c287653fb30588,
+	 0x307b257251c9ac1a, 0x326e72d7a0f736b7, 0x5463fea6aad2e187, 0xb1727cf0d49e5f31,
+	 0x2547c427cfce7110, 0x6ae36e01f18bf741, 0x83b53972598ca00f, 0x90acd9daa32e89c7,
+	 0x2455fd529526c664, 0xadf9be75acd5c936, 0x2a345efde685ccfb, 0x74878fa2e4d6e309,
+	 0x1e365dff0202491e, 0x4842e2c65b182c63, 0x827f026c568e46c4, 0x057d80e4811cfd1c,
+	 0xb250515f3963d44c, 0x8de0ced43525fd35, 0xa1e906329875bfcd, 0x7de9d8a31b17a77c,
+	 0x33534fc373584531, 0x8b0346b2d9729df5, 0x969d7eb747aa58f6, 0xae5e564ab5eedd51,
+	 0xb9874c2ee3c8908c, 0x863ad4ac01fd3a2b, 0x639dd91017001b6b, 0x83ca98c35aeae732,
+	 0x7e96cd3f35e05d1e, 0xf93389a6687218a1, 0x2206b324fd3f815e, 0x84129e0f6a208632,
+	 0x1960123d491ded4f, 0x956f6d965a67a082, 0x08624f0ec3fa6d7e, 0x60a03a831103d66d,
+	 0xba115a1eb8c6c77a, 0x31fbc3f7b4614b9d, 0x52e643d1e78143e4, 0x14b3f7dd662a0478,
+	 0x99ad5f9d1c39f00b, 0x0f708800c8ea8dc6, 0x3a096444bbdd4e6b, 0x3242c6f80e9466ac,
+	 0x87c6a26fbe8ac5ec, 0xd440831ef3f5136d, 0x28e3be328892dbaa, 0x868955a35b36baab,
+	 0xfe2bd59a00793c42, 0xdaa9cd53ee517789, 0xaf8ef329f862cdc0, 0xb12c0a39eeeccade,
+	 0x974dffa8d30af0cd, 0x322279d697ead527, 0x8b846f0a0deed36e, 0xb531d408c6fe1d92,
+	 0xd3827f14e463d378, 0xebba4f1bff9807b3, 0x998d9ae7736ca016, 0x973a6bb341bea217,
+	 0x8601dfbdce00956f, 0x1eb9997e3dfb5474, 0xcf0dfedb8b9f9894, 0x930b4d89edcb6830,
+	 0xe1299d6bdae25ece, 0x41a55d67d5bd57d6, 0xbf2c9147b196f9c9, 0x6e9a5071677ba074,
+	 0x0d2312656397ce51, 0x9ecb80a3008e7ecf, 0x42b11512572da917, 0x9973dd7af418436b,
+	 0xd0649f21aee4fba9, 0xa9eba738edec24cd, 0xaa384a77f4718785, 0x2ce0e267629b3060,
+	 0xe220e909d00320bf, 0x91c2a084948c5e64, 0xb0ae5e6785c5397e, 0x539fca31609e54f0
+	},
+	{
+	 0xd7f62fcc4e42aaa3, 0x09efbbf668890fef, 0xd3af66d67bae991c, 0x38cc384da68251f9,
+	 0xa81bd9e98902cd04, 0x9419b1a737d45fd0, 0x1f3f27969b1883df, 0xa228135636cd34ce,
+	 0x9af0ca1e6d9b4e85, 0x4eae8fcd1ec058d1, 0x1e972d60671a8bd7, 0x143573b789b9bb3d,
+	 0x25b72dec7fb4223e, 0xecb9d3e35cd54e39, 0xca4d55cb7d4c5e74, 0x50f5119a9a00d82c,
+	 0x70c6eb1f61696006, 0x97d5b74cf6485005, 0xdb66269aa7eff81b, 0x3c2aaa31b2b1e3e6,
+	 0x8518ca5676ce8462, 0x008d29e5fa0b2f62, 0x441f45a67dfab683, 0x0d04ca4d2729d487,
+	 0xc416a25841ce6872, 0x265a6bf334c68dda, 0xa46354702541d710, 0x8257ce329a0bd383,
+	 0x20ad044dc4d9119d, 0x4a13682db81cb137, 0x1fb3dfa9b0a042e6, 0x27d5f33026c24117,
+	 0x9fe44e9867b9f084, 0x9ee711fadbd849b6, 0x122b51933249c8fb, 0x413be4ff0715781c,
+	 0x527347c0b02b9a80, 0xdaecd289bfb285da, 0xd115e1a9833ad264, 0x0cf15d6151b28e2f,
+	 0x8764448bc2dcd745, 0x4eeb277cb7359212, 0xa765a3d746cdbd63, 0x2e4134807f248870,
+	 0x43752bfa5a25d994, 0xd8f3c1d6fbdc8582, 0x2df14d2e2ba35021, 0x32a3a3b0b67f7c6c,
+	 0x6045f681f4119da3, 0x654570a5a8449d07, 0xdf6b942a2310029a, 0x7a19a87aa42c0ebe,
+	 0x17245006fcccccaa, 0xa8a704c1b847a08a, 0xd204900cdd3a0d25, 0x906a391f30b27ba9,
+	 0x723c84d760bcf773, 0xf309ad7f3767f051, 0x125d0535aa52510a, 0x6236cad527547d5b,
+	 0xeb899ad13a88dc7e, 0x39545c1761a67cb9, 0xaeec3e35e8ac669e, 0x4ff31290dee9ca46,
+	 0x7af968041f39736c, 0x452a2d91334b5781, 0xf32c7beb4809c8bf, 0x137790352630f0a2,
+	 0x70f3e0dcd9b199e4, 0x86fe3d63b24a18dc, 0x12e1328ff629ef40, 0x9a0825b55ef45d10,
+	 0xc5b154d4cc84ca16, 0xa3ac23dca87554be, 0x560ef9fa2e453f3c, 0x61e99cf5de4f1818,
+	 0xf89901fe3ccabad8, 0x30f3967a68573c96, 0x939cfb6fd123cc76, 0x2a16fd1fa64f3802,
+	 0x7a155c7ea3edbe2a, 0x2a78773fe7125e63, 0x17ba60df2129779d, 0x1be3396a8bed029a,
+	 0xe77d96865b8b8013, 0x636c5491d36f8968, 0xc232679f93726f3f, 0xab538574ce897f71,
+	 0xc6ff17a976e2ce37, 0x2f5b88fcad681b94, 0x0488ab22f3d837f1, 0x1aa9ec38d5341a31,
+	 0x20c6929cae2ae225, 0xa64cf73a247e5a3f, 0xd107957457a30290, 0xa83da667e5756a6a,
+	 0x97bcb805c3dab759, 0x7cce50103d16f8a3, 0xfce762d8a7d46796, 0x294783f02e4027c3,
+	 0xf905c88bdd32ebb9, 0xb36d820b816d2990, 0x29fc1281a242eb06, 0x6f401a6311b2e9c2,
+	 0x59d93c975abb490c, 0xe4fee14eefadddd0, 0x7ff965d46ad4bbd0, 0x167e34b808540159,
+	 0xc182ae063055d198, 0x88e001bb9fc498ef, 0x62b5c8b2edcf13fd, 0x4c201759c0b68bb9,
+	 0x57f42e2444685be0, 0x33339eeffb550930, 0xea766c8baaff8bcc, 0x84b9521193a74b41,
+	 0xc86f4987b0def0ec, 0x77029e619b91f553, 0xd0e9a2b5b07001c6, 0xb59bff525785db3a,
+	 0x91446b341c8f75ae, 0x732561e7ab7addff, 0x923813ea5ddc13c3, 0x69bb6d7b10fe69df,
+	 0x7aa5ce5bea8506dc, 0x24b72c16173e4881, 0x3d7b8902a0b240b4, 0x9a0423b49f0b2308,
+	 0x3af264fe617ae70e, 0xf315a828e91bff52, 0x4750d2d189ba7a19, 0x895155bb8dc4dfb2,
+	 0xfdf3de0025a35501, 0x875e1adc03fc808c, 0x8d3d45e7a192caa8, 0x9810f5addfd6f2eb,
+	 0x977bdbe2f53d8409, 0x655bc5c9b44ec42c, 0xc293181cdb0ae58d, 0x549c84ca7a14c76d,
+	 0x5bc30da7c4ae8fb4, 0xc39d12197f8b1ede, 0x1f7898ae564040ca, 0xb5f616980bccbd4c,
+	 0x47c127a32fca6f7f, 0x807ab37987a06d87, 0xff671f13c41d6f61, 0x1aaa3d234bcbabdb,
+	 0xb6cecc94f23febe9, 0x07725ed3bdcea77b, 0x7a385d016c959059, 0x71280ccb5877a402,
+	 0x6d9d277d4a38a82b, 0x492c46b94fa29293, 0xa6008e01d9f6edaf, 0x19bb9da2dd2c0d37,
+	 0xbc5f049887fdb2ab, 0x985a0a2a2b0b0629, 0x13b4bd7bc1c3abaf, 0x6a3e06510d8ab6d6,
+	 0xca66cd50a09838e7, 0xadd516a051ee83e1, 0x46bd0b7119ff31b2, 0x69d84b78b1891342,
+	 0xb52e565a5ed77970, 0xcd75b83826455cc8, 0xef5527102df22480, 0x3a60a3771dfc00db,
+	 0xa43aa889e7932994, 0x4ede2d8343826d00, 0xee775a2d3b37f18e, 0x140ef2db49e435ad,
+	 0x23b43637d1df4ba9, 0x396a2115fd6c0789, 0x8f4443777d02c11e, 0x8c93392e94b3f8b3,
+	 0x88d941c10bb5dc3c, 0x32a94260e7a0f05d, 0x786a7a7f9615646d, 0x3b4fdc45a4fec3a6,
+	 0xf6411519950d6c8f, 0x87422f4a001c637e, 0xcbe5e94d8554f633, 0x8bcbf6bc8f030efd,
+	 0x3441296f83daa57b, 0x4ec9b7bddd9a6e15, 0xbcbeed42e3f4ce65, 0x7908386f0f16f88f,
+	 0xc3b565fe3ebde8ec, 0xf760ec863eef8c5f, 0x3a75722bedbc20a0, 0x99443e2fcc275962,
+	 0x40a6bcb7459e58e5, 0x07064a0ea47aded5, 0xcbbcc7d88f84599d, 0x6fb0fcab9ba3bc68,
+	 0x6a7cf60ba727d8c1, 0x4b8221274699b610, 0x2e04298ddc2bbbb7, 0x4f804262ac5bf572,
+	 0x400b2c15eee2c08f, 0x9692504f2f60b2fc, 0x35c1e509f044bded, 0x80f93fe669cdfcd9,
+	 0xfe5d074002da057d, 0xc470afad4ec1b865, 0x90c898d79bccc4a8, 0x3269112ede489690,
+	 0x8272dacc6e35ce1e, 0xb1c7368109e03468, 0x387b914b991cfa07, 0x3047394aba4d234e,
+	 0x994f5c795fdbc9ab, 0xd745e25170577fdc, 0xe0235f857dc7c45d, 0x7b5d6680709b0a3a,
+	 0x0bccd1d26fe5f16d, 0xd1aae873907020fd, 0x064e2680ca8f75e2, 0x0b339ca97f3cfd3e,
+	 0x8f4f5220cb914848, 0xa1983e69b6c97230, 0x4cc06b72477ad0e2, 0x0598c852c61cfb66,
+	 0xff26a91adf6fe355, 0xef32cd56c61eee49, 0x6526accc33be3203, 0x6a8497bd613add93,
+	 0xff05e9be7590f73f, 0x5219dae6fe9fb269, 0x7e60c8cb97ce0fb1, 0x4fdbdf78c0d6e9fe,
+	 0x4a474c227783cdb4, 0x87129d0260ce29f6, 0x976bd4a3be3804a7, 0x721bbbb3cf62bb49,
+	 0x293a1a32ae6dd17e, 0x9a6326916c719635, 0x71dd1339a22b68bb, 0x0916954c6340f935,
+	 0xf4a1bc13665f5416, 0xc00b92ef5f7ee5ed, 0x175f55508b582d61, 0x5762f7353a97e3da,
+	 0x0ad637b82cf8f96e, 0x4a15247d8406df4f, 0x1bb4bdd4a595fcd6, 0x79023b8bbc72269b,
+	 0xed0a15e4925ba039, 0x94c8a55ec86f895d, 0x25bd3cdbe2fed828, 0x7fe339499c0bab88,
+	 0xb9ce9139f61a290b, 0x79e41a7b94ccbeca, 0x1815c615468d4849, 0x96d3abf273d2c0c8
+	},
+	{
+	 0x0a8185d8d905473d, 0x802a228ec304467a, 0x32dd414e922af83a, 0x88733a5a8b32fb7a,
+	 0x8accd56bdc8e6d07, 0x3b66c73c38a7c64d, 0x7413c07ba5550e43, 0x54138dee6e352e9c,
+	 0xa7e56fd7ffe23375, 0x2ab0e9d57f0e968f, 0x86a94da9cb9dc979, 0x5bafc3c108ca0c1e,
+	 0xeb1bc3f1d1a9dd90, 0x315d962693d176cb, 0x10b3d35c2e3172e5, 0x8d913a4b788505cd,
+	 0xbce7c3ce5cd522a0, 0x4aa4db01b217a5a1, 0x8973dd313c644d01, 0xb56a8deeb8b8e7cc,
+	 0xe56376978dd21ca1, 0xe920e434b770a15c, 0xacb817cb45217ad1, 0x7ffe03ac774fa264,
+	 0xdaef70987bedeeea, 0x370238e540985f6f, 0xe48bae325c221df3, 0x6bbbfd3c7add0f89,
+	 0x195f22227804735d, 0x7896b2bcf42ab749, 0xfeaeb1eaf32bec8f, 0x6a9fd3a3af6484e0,
+	 0xbab45c66609794c0, 0x12b99e5ee747a00c, 0x0daa17819fb12f7e, 0x4e5be0fd24e31092,
+	 0xd783d75e9387e81e, 0x22f32921636ab179, 0xe426c45366c8e46b, 0x382799f3c988fc10,
+	 0x6348fea7b46e2ed1, 0x2c03ee005d09deca, 0x875c955a0cc48c6e, 0x08b2636cc89e491a,
+	 0xc70d40de94bb52c3, 0x4ee51aa2e292182a, 0x6d71fa62732a317e, 0x811ded62058ac077,
+	 0x2a7bdbf7d6d1224b, 0xa440360fd1f548cc, 0x072e091af0ed5bd5, 0x252accec9a93f878,
+	 0xe32af41da5b0a8b4, 0xc7d3707bac1f1920, 0x1b0ffa1a75133cef, 0x8c455e7d4d129e52,
+	 0xf920fffe4a4740e2, 0xf5707ccd4bfb348b, 0x9b3490987713c91e, 0x2064f8056069d14d,
+	 0x49ed2d8e751fe4ab, 0xf822cc6f22e30413, 0xd93bffbc297c25e4, 0x705f32147082d719,
+	 0x3cfc881f3249e018, 0x514969996853e523, 0xf3a41ef0c3fc1e75, 0x84f7995ad4aa5069,
+	 0x4a66617441a21ae7, 0xf6728a880929ec02, 0xd60d72d410044eb5, 0xa908d81eb32c29b5,
+	 0xc4ce15932207667b, 0xa86df4bec5bdad97, 0xfa5ea7bf878b27d2, 0x5a8743d87cf2c006,
+	 0xe99eb1b84cedeb7b, 0xb50976ea501abbc0, 0x979028a4033f85d0, 0x53f4918be27d02cf,
+	 0xe960dcbd74c1ee1f, 0x858be0d9a0d8ae80, 0x40cc62eac7c9fe1b, 0x11a4b102e48f1562,
+	 0xbd0d5effde389523, 0x50840f204ea2aa22, 0x2ae957531e1e5491, 0x745ee41ec93b6087,
+	 0x9ebae87a343cd08d, 0xe24452f9ff9d193e, 0x43f32b385b90fc99, 0xb2afa5204d437722,
+	 0xc3fdbee77163ace6, 0xa1e9e3bffdae75b0, 0xff75f91cdd62aa26, 0x50a14c2e878f824e,
+	 0x5955575360e7f749, 0x5934bcf35bb40e84, 0xb62c8cf28c745ee0, 0x4fc88b019b10484a,
+	 0xaef0fe739bf0e488, 0xef66d01d26b9eead, 0x1c7bcb1ede34bd83, 0x1a48ff12a02a6bba,
+	 0x6a555cb583561b6f, 0x59be5cfb9c543d3f, 0xfa86e3b7af583bfa, 0x66f40732a8f4f708,
+	 0xc8cbd834df6f47d9, 0xad08c2c6eb873eb2, 0xcec28d849018ff63, 0x38868c69cf06dc0a,
+	 0x480eeb7c4f5225c0, 0xb5763373f361f69c, 0x8032a47760bdeca4, 0x1c56d757452b04c1,
+	 0x193457fd306f3f5f, 0x6a393edad6aab324, 0x78f3a474c2f826a4, 0xa9df4672ac1bb0ec,
+	 0x5c23466007ef345f, 0xe8a4dd1595167a67, 0xa2d9a0b776cc84d6, 0x32a2d6986b306d36,
+	 0x113bffca3b7b8f8c, 0xd9531fedc0e2f67a, 0x978aa9cfdadeafe6, 0x77f0cc3a8372f5e4,
+	 0xac4268f584143945, 0xdf85913ed0a80de8, 0x2d1233aa6257c61f, 0x2c399c871d28a5d5,
+	 0x3a1846e9b874cb06, 0xd44103379b83075e, 0x89cbc93e00249298, 0x41d85401aa63d3df,
+	 0x6f0a6441813dcd02, 0x1b28d52b05669ee1, 0xd8f7e873fe63547c, 0x2a6d5dda01bce6e4,
+	 0x892413749c42c764, 0xb247f68bba3fee8c, 0x1ca2b30dec4860dd, 0x379999cf3971f169,
+	 0xb8e0c8da009be04f, 0x1ba1c0096d5f1f91, 0xe0c8b97377159925, 0x6f858b4f033b4d5e,
+	 0xfdba19f9fc625a35, 0x92865934ff87ac05, 0x30c40a4527b1314b, 0x5c01ea4eec878b88,
+	 0x7b23eec989aef4b5, 0xb9a9cadf4758821e, 0xcbc9d9889eea0123, 0x201b1bdc102f8585,
+	 0xa37c185abfc495aa, 0xd4c9ca93850c7a87, 0x9bf3314ba04bbab7, 0x6668b4c44eefc063,
+	 0x2303115328b88c20, 0x7e9c1e921a590ef9, 0xe6d2c77c9e6f52aa, 0x44ba02245ae101a7,
+	 0x6ce6445a4dc6c4c5, 0x3566bd14c64d8d1a, 0x3de59d78fc5f061f, 0x7a0783657e12b0db,
+	 0xc36bc9c76f535559, 0xf3ac13276d91f820, 0x1baa123704ebdc30, 0xaea0e3cf452ebcf0,
+	 0x8772c94eaf869241, 0xfacca218c003f70c, 0x907f32d850da3fa1, 0xb1a336d106f92d5d,
+	 0x7aaefaff2055692f, 0xa24bc9abc87b0d77, 0xd232c0c52cda721e, 0x8cc1dac483db0cec,
+	 0x63e7673a0aa10095, 0x7a2ee72860e0a7a8, 0x76637619247eeecc, 0x683b61dbf60f2293,
+	 0x9cfde7adcf767a04, 0x13f8c2adfad97022, 0x0b00504242856920, 0x7a66fa24c0e1ae81,
+	 0x4019f7cb18b9c245, 0xab2ec9f45022391a, 0xabb403fa8a0e6671, 0x157d06ebab7570b8,
+	 0x8229944b056bd618, 0x2f39e75b829ce379, 0xd8b120ec17aa8cad, 0x529e474380bc8579,
+	 0xb217e22c412d5708, 0xf76a94815868effb, 0xb5454188d7badeb2, 0x6263cb9d5fd611b4,
+	 0xece094d3de3a6af2, 0x65e5235d4b36dc62, 0x3d716b3b2e00e01f, 0x9df0c99e8755140f,
+	 0x8b810180d10b5446, 0x9f9c88b0eebe95fc, 0x7097339bf23efe46, 0x3c3bbf975096b105,
+	 0xeb1e356de272bb98, 0x1ed33c79e952d717, 0x7e3b6ad8ef1d0ff5, 0x2e25cc4f7eabb49c,
+	 0xa68359439ae7398a, 0x33f2c7289ca6d811, 0x5be49e2902db52a0, 0x20de3b6344443d4c,
+	 0x10e7cd66febc41fb, 0xca4dd2f0d039de55, 0x89de24fa860cb24c, 0x14fe303f833a230a,
+	 0x4ef0c444930e0176, 0xd3b06bc0f9996c36, 0x5d297d69fa8eb640, 0x16fe5fb14afb6b23,
+	 0xa3780ad25629eee0, 0x2bda890d16b16f68, 0xbdffd6ca2f315a4a, 0x1aa27e49fbdc4112,
+	 0x8cf1aa2ad4d6eaa2, 0xe495f009025f5a57, 0x0ffe9f6b9af16072, 0x937d3a158fabcb9d,
+	 0x0ff5f7859e9d6f0e, 0xe8c40b0b12586a19, 0x0c0fe82314b04bc3, 0x632cf5c751dea233,
+	 0xaf95e63f20ba3e3e, 0x9a9c2c09f542b8a9, 0x5971631e338049bd, 0x427f96e413cc31ff,
+	 0x5bead1291425b6d1, 0x528266a52e9ddca6, 0x7f4305686539bbe6, 0x404d660c72aa8fc6,
+	 0xc0eeee0e516b9f54, 0x7c81f959b54b9bcd, 0xc7fada03b9fae61c, 0x93f4d6d756b912a4,
+	 0x30733d83eca74db1, 0xaac98b893bdd8efe, 0xbaae3b650d1759e0, 0x19925f4e15a690c8,
+	 0x5542bc6d42a4c7d4, 0x1e1b9db4d6660148, 0x737009d38dcabcfa, 0x4eed42250524f3cd
+	},
+	{
+	 0xa6da1b3cfefd0144, 0xdc43ec8e9e861942, 0xa13acaa8c78372bf, 0xb13994478a672136,
+	 0xdd0ff7b33f0cd319, 0x383f286465521c8b, 0x18285bd3c4f2a845, 0x5759315059722d58,
+	 0xaa343b53be3a672f, 0xad3075b58c78a6ad, 0x8742e89e2ddde94f, 0x7557736e1becaa1e,
+	 0xc0f570d86f3805d5, 0x962c312bb78a7960, 0x685ccceeb7efa678, 0xb185deb619fcc785,
+	 0xaef87b457554451e, 0x3493bccd0c605554, 0x7dfe52244a6b8c9b, 0x668a3f45f0749aa3,
+	 0x53ca6d4e44db54ca, 0x14e3b23f82c0d732, 0x12e0c4f91affbfdf, 0x9ac14944a0975586,
+	 0xfa2d2f6b92e55d22, 0xa16af746a3c50ec5, 0xf0d551abf4e78ce4, 0x1676e9a9a9c0fae4,
+	 0x6670bca3c6af9125, 0x39b157b01cc77d49, 0x5d1df970b174302f, 0x4f2ceb2e3393d80e,
+	 0xe331c4e55c5ea407, 0x8a0620838447c5a5, 0xe4802dff59a8d05f, 0x574f552f9f993812,
+	 0x8cb7a6ea869784b2, 0xf46c37f1c5ed742f, 0xb07a839a1cfc2626, 0x2843620310ca242f,
+	 0x5c2e37b5ec563862, 0xcf14e128b50c3461, 0xf47dd8b1e06bad7c, 0x876218f7122a5c30,
+	 0xde2ffc8412b5f7b1, 0x215d00143f9c1950, 0xf204b4d8c0d49b76, 0x55cca3a6a8037101,
+	 0x79faf1376107fd49, 0xe7bab46bb9e84bc4, 0x46ce48b6e8558259, 0x518417791b032eea,
+	 0xa420edc48ee82afb, 0xcd1ce6ec42111a12, 0xb273cc25b39bd711, 0x45216291f5de833d,
+	 0x3026c34d3b5da7ff, 0x837ee4cd71bcacf8, 0x322736435d0efe5f, 0x254e036ded735ba1,
+	 0xef0262ae4388b80b, 0x7c3b4674e4487cef, 0xcb70e33d815fd130, 0x7ee13c4fd21e088f,
+	 0xf1039101682b76b7, 0x8344fd929cbeaab1, 0x084ecdc849f98c39, 0x3a1719e13a3474bd,
+	 0xabbb9a33638a8ea1, 0xbd7fa0e5ce1acb35, 0x960276c7d03a1e18, 0x9556aef2691c0fa0,
+	 0xdf14b38e0dcc9d03, 0xd4cf6212bacc0f6a, 0xc25948d4c58de18b, 0x2857f3af115b5b04,
+	 0x1793a8ffe4eaf70f, 0xa2d72d94c16ed12b, 0xbdcab4ed5bd9984a, 0x944c021062cb37fa,
+	 0x5382713618f4a3ca, 0x5822a44feed9a33e, 0xfce8a710ea5d1fa2, 0x6f20ecec97aa7501,
+	 0xe8d909c70cbd74b2, 0x1f8f7751dd55b4c5, 0xe80562f2a44836e9, 0x429c55e58739eee8,
+	 0xb21afb8b966815aa, 0xf6b3affbd51f64a7, 0x970ab52af46d1967, 0x10b33886da2a499a,
+	 0x1ea65c17a3ee7765, 0x37337e7a6f046be6, 0xe8ac36d39f3bde52, 0x5aa40ac02ae8b796,
+	 0xa897d770b341052a, 0xebaaebde72632375, 0x9bd6d4dc68d581d1, 0x8fe65b52abaf3331,
+	 0xd08ef2fbd830de1b, 0xf3c738c9dfbac1a3, 0x5bc3ad0636386418, 0x7666119ef7f75519,
+	 0x7a94dc457a33caad, 0xeb3956bc71199301, 0xb286a892ed23a8be, 0x37a2adb6d8cb44a5,
+	 0xae75a93937930fd1, 0xec09e6ec63350c23, 0x10a29e71c6da4e76, 0x35fa483de9c86107,
+	 0x282a838f47628910, 0x6076df08edfcb2f9, 0xe083c298a613a339, 0x6289c1e0add856f7,
+	 0xcb9e7f47a4386eb1, 0xd49334663e084352, 0xe86ece484caf07ec, 0x9c4902b1231a744b,
+	 0x842de5964da86027, 0x4a12ce46124b2f5d, 0xcece0c35bc67daeb, 0x21d416e53d520aa6,
+	 0x3ac10a73581d4e67, 0x1be4f7f17be0e169, 0x805c433f6c4b2622, 0x81c1889933f533f4,
+	 0x13b43ec56236fab1, 0x56be9dc4dd96e2c5, 0x60e555b76bb2c4e9, 0x7d2c2f3adacc7cf5,
+	 0xe6d13b227dc27eea, 0x009eb1ea1f912d4a, 0xcea2f7a0befc88d9, 0x756e657762cadfa9,
+	 0x2514ab6a9ad8e8fd, 0x1875ec248fa6e159, 0x25fa3dbb5cfde6ea, 0x1e45a1ccd9166918,
+	 0xa31108ed9b929074, 0x2b72f38a3bec5e30, 0xccf4176d23ebb5ad, 0x79f51fa0ce2e8d5d,
+	 0xc7560d0d68cf75f8, 0x83ef534cacd3f278, 0x4bf211eedbc600ba, 0x0de2c8645ca190cf,
+	 0x784efe59a6824f79, 0xc9f702f97f5c30a6, 0x858f617f481b8ea2, 0x3f14d5dc079a55ec,
+	 0x6c989a530ee91800, 0x6d3f52b6b394598d, 0xc6e21fdb33656f4b, 0xa909790071bc02cf,
+	 0xdba0cc99a8981dd9, 0x208825494bc3dda1, 0x037892e60899364a, 0x3dc232118bfd39e7,
+	 0xb901460cc474355a, 0xeb6fa1d7a13e18cb, 0xd1aff3c91f14399a, 0x4fb5b1d5a9b4ab26,
+	 0x2d95dd4ddb79c00c, 0xdc610bbf73c22398, 0xc994134adedfc138, 0x439aeec47ff00694,
+	 0x1650ce9b66042c63, 0x88765c18f0a90ec1, 0xd2bf3bc0dfb45024, 0xa7c20460785fcb88,
+	 0xf69e17dd08e3385f, 0x9e0d515f1dfb74e8, 0x657a387c54262eb8, 0x7deccb01ad7133e0,
+	 0x47e8cd593bc41b08, 0xc82f1f4a82be351c, 0x1b24ae3b34baf6e1, 0x1fc0f5835df17a18,
+	 0xbb407e7f76ff3b3f, 0x5c3119ee7f31d167, 0x12dc1bd64fe732bf, 0x4a5a5ab60b825e82,
+	 0x0ea6ba09d76ed0c0, 0xc772e37a3103f29b, 0x6a27b7d2409830e9, 0xa5d1dcbaac5e4512,
+	 0x1b98b42bd7b8b543, 0xa47e7d8c9afca053, 0x3462801250bb0ec2, 0x70db3c7e7d0291a3,
+	 0x1b6681488fedbff7, 0x49c7c203bfa07d0f, 0x9c9f60d944d9609a, 0x7140331c9526b378,
+	 0x93ea285f6220adff, 0x352b8f4a4ac35bff, 0xc762e119192c21a2, 0x504d4f2b77648cdb,
+	 0x3de922fa33f5bdd0, 0xeaa665befe7683b0, 0x4b4f71fc8103cf6c, 0x3e905175a6b21277,
+	 0xed36eb031c408836, 0x8e93dcdf9750b9ae, 0x04f4647adfae2110, 0xaf65bd819f59a6c3,
+	 0x76f219ec1f9b0a6b, 0xb57750bc9da3574b, 0x8b11dfc9c6e48023, 0x451492556c4eee76,
+	 0xfb9f6603ad62cd2f, 0x1b545eef8db80cb4, 0xadd3f77a42363493, 0x136de7e69c5b0d0a,
+	 0x51aa3d263bc2927e, 0x04e6672677b839f0, 0x8f69c80e4e5154a8, 0x326132efefe8f1e1,
+	 0xb2bb8d5fe7f1433c, 0x4c14411687805ec8, 0x99c8cd45197af0fd, 0x9c4caf30d205055e,
+	 0x7294e4656b7506b9, 0xb96833559b71c68a, 0xc9626a70a6199c28, 0x201f07350727392b,
+	 0x88c0db694efca0ac, 0x101df354fde57375, 0x50e0520af4edb7e6, 0x6284b305213b4917,
+	 0x5644e4e25eaa6d0a, 0xe221c368b73de3f2, 0x1ec7a0f25646e9a3, 0x8fc3ab5e1070d2c1,
+	 0x8ecab054f4e04934, 0x5c7aa8df88038f0a, 0x826418408cdac93d, 0x06b5b30a80acb59d,
+	 0xec125f481c823101, 0xe23baa55288b4178, 0xb63a66baf85af479, 0x8b6486184ebc7910,
+	 0xd522851d93014717, 0xfc172c0f9f1f77aa, 0x013c7dcebda25a67, 0x9e6ad4fda4c0884a,
+	 0x009541979c452220, 0xae7d98f54bf6f501, 0x8b0a5640bef64319, 0xab4feafc0bac2faf,
+	 0x530e6be87e8dfb61, 0x18906caa4f3a4557, 0xe07d0aae85232269, 0x6ad77ab5e97d8630
+	},
+	{
+	 0x9a72be25a26754f8, 0xbe675b026f0340dc, 0xf1904130a65f66ed, 0xa785a8756b2c3d79,
+	 0x4ec1821b223eb85e, 0x6ad662757334430d, 0x3500efe5544099ff, 0x738e1ccb585e07e9,
+	 0xf66880f5c1196227, 0x09faf3b4ceed0910, 0x0e8c16cc279bfaff, 0x8678a17ea175716d,
+	 0xaab9fe6e66a408e0, 0xd86a97b871189409, 0x614bcc502bcd2c8d, 0x752823e04d619800,
+	 0x9e7cd4bcd2ab5fd3, 0x6a763f8392a4a2b9, 0xbbc1d382275e641a, 0x77b28a9d63924a47,
+	 0x4f3533b97ace4755, 0x9cd4f6d9d4b18bea, 0x86de44bdf0915bca, 0x743612f1814eab52,
+	 0x3a90c49c89baec59, 0x10ff25526dcf42ec, 0x6a290a710456acc7, 0xb0e4315ef38008ef,
+	 0x80445bd3bb69529d, 0x05cff63ea0043021, 0x8cafac025ec02086, 0x5f76d9aad101b012,
+	 0x47fa3b6d6e867d5f, 0xffb5454156baa815, 0x65e9b4d3a1704e9c, 0x6ed41b53697f2772,
+	 0x0704008bc8c680f3, 0x34a7180794534574, 0xeaac73748a5492e6, 0x039f2297a3eb7c36,
+	 0x3c920e99c0e2af5d, 0xb0bfddada87057d4, 0x44e2798aa926fb22, 0x7526a21ffa424973,
+	 0x93b7d8c31d26c892, 0xe6f0b8da92c92c40, 0xaff9b7877c49ba7e, 0x9f3a436d23b644e9,
+	 0x5e1436f5cf8f72a0, 0x8522d0560482aa09, 0x73e21ea414544e78, 0x3d130adc38202fcf,
+	 0xece682faf01c3061, 0x51f5c45ff82e210c, 0xd7c97d0935da649d, 0x4ff59ae98936e1fc,
+	 0x04801eb2ff58d99e, 0x85667474deb50cf7, 0x084f9a6e7fdcf5de, 0xaa1d37332ac4e1e7,
+	 0x986c14da842e3382, 0x4b4f85a721ff2b82, 0x49c6b911377233b0, 0x81cfdfc174fd695c,
+	 0x9e4f590aaa4f9a43, 0x856a5f0f7d14a0e8, 0xafd46dd2c8fdb18f, 0x0275fda75260b073,
+	 0x90a0c0786140c109, 0x8d0ceb033fe0d309, 0x3ba08fd155a4cd27, 0x28baa875b145712d,
+	 0xf101174072568fcf, 0x6a4ab73f4917e037, 0x3008386e34b851fd, 0x811afbb4c4e11cf4,
+	 0xc94f6317b1ada38a, 0x26162f28f9052e52, 0x14118053443493ba, 0x5e0beae0ab803bff,
+	 0xf5bc14da3aa86afe, 0xf789ee1b24c496ea, 0xa268d26295a9a01a, 0x5c0aac3598e3cf9b,
+	 0x41f91c82dae93146, 0x1b5bc8a06258d7aa, 0x3115916bfde0399b, 0x31ccd5853162d235,
+	 0xc839a01ed8788506, 0x8cb832055755adae, 0xc13837c0d3497120, 0x2e9ea3919c118962,
+	 0x9c71338782487107, 0x1623fe2131168911, 0x215855cee68c5b5d, 0x3bf0c1142d6032d6,
+	 0x24dc9792e0016c84, 0x81c795507aa802cd, 0x6d1d04c4635d3810, 0x71696e340fe9e3e4,
+	 0x89e696863390ab48, 0x57836822c2af6637, 0x0998546ad2b22092, 0x9728a49990d58392,
+	 0xb70c4c3e4db1c9a7, 0x2476b08deab210c5, 0x7ff4bf330487de63, 0x26b7acc40179ed21,
+	 0x52c1743b66d83bb8, 0x466b3c72765d1484, 0xbc26ade3c6e3718e, 0x3b9c090ad64267f3,
+	 0x225e5b5f572bda7a, 0xbc398fef8aeb1c61, 0x914a395a48219026, 0x0b6b712632f7eca8,
+	 0xdb8b254549fb3b70, 0x6f6294f7e22ed357, 0x051c1d49f981924d, 0x4db01449773d0c90,
+	 0xac3e4aaeba047d3f, 0xe40910916bff8266, 0xb0bca1bdef16470d, 0xa54cbf23505469f6,
+	 0xfbab840278e59d6b, 0x15eb0e0ec6876f47, 0x32fd068f85da0a3d, 0x9e1788e9c6ec7c6e,
+	 0x281d4b36c43bc045, 0x07d8c9fe375c6d74, 0xf4e38ace974f4754, 0xac14dbc56ee32915,
+	 0xec6b848c86a39702, 0x1f11c5549438c650, 0xe272c48f644e78a8, 0x3a643241ce3e38c3,
+	 0x24a1f27f21668ce7, 0x8d0c0cdfa5071746, 0x14eb1ad7f501bf74, 0x36ee88dfcb9fb423,
+	 0x8d970691daa58d81, 0x8ecc09565d3d151e, 0xf772f27854feecdc, 0x7ab8ec94abadab3d,
+	 0x3f6f2e06d46b14cc, 0xd366d6fba0957227, 0xadb953bee6f75271, 0x7294a9edb9e141ac,
+	 0x383d86553ac138ed, 0xc64d7fbf3f0c0e43, 0x2164461723a836d0, 0x28ccc795f7f01069,
+	 0x330a201dd189069c, 0x34616c99d89476a9, 0x3bd9c0af0ab16e17, 0x72319d273d7585fd,
+	 0xd641394b63b6b30b, 0x22631f0f3684d167, 0xb2389b835c1e702b, 0x7d0929f077d14384,
+	 0x78a04d22a795bf87, 0x2a528538cafea222, 0x4308369ac4d64e52, 0x896184f756d2fd35,
+	 0xad66114278d81d68, 0x2a3254ede3df7ca1, 0x4f4a15cc2f7238df, 0x372a5d0c9acf95fc,
+	 0xfe0c90d4274b7015, 0x4c840388e185177d, 0x9dcc70200ab0f90b, 0x8cb62b2077cd8d95,
+	 0x17f4e92ed1143ee5, 0xde5236dec381fe0f, 0x433cd6daca714012, 0x9ae4783e7518284c,
+	 0xe556977d4333bc2f, 0x70018fb68d023454, 0xeddb1ad8e487d249, 0x5bad2679025a26c6,
+	 0xeb4fd5345115a624, 0x8b249aee200ac201, 0x5770899cc2187e8f, 0xa4c690603e31b399,
+	 0xae421cfbcd775386, 0xfc6d2e6df7a06047, 0xbd3f46af4d8bde7c, 0x1205410a06d9cb94,
+	 0xe0115f8599cae3fb, 0x0e3bdb2af7d8551d, 0x07f442db84ae2b08, 0x9058cb1bf8e9a490,
+	 0x9ea4942457e3da19, 0x6b0d0bbf365f0c76, 0x33f89cfdbfb06752, 0x4e377f01aa5ad571,
+	 0x98934bfcb4771ea2, 0x4d4e18b730b40835, 0x54c6bffd94905f65, 0x4d626187c690acd6,
+	 0x9b73c3fe64d4fed9, 0x3277749af869f9c9, 0x236a12c2bde115e4, 0x17ffd76f274dc628,
+	 0xbf1e885e3870dd5e, 0x4d256f2f21722fa5, 0xa963db66a3bc0c02, 0x5bc59b1d198efd7a,
+	 0x79e1b852108ded17, 0x7f7fb89c0f29ba9c, 0x3e95083b85023aaf, 0x8397be69c4c56c3f,
+	 0x735f64fa83fd1c92, 0x396437c5a39c5a47, 0x56a6359ab6de3e2b, 0x0b845b12eb7ddb3b,
+	 0x265c55db28d1df27, 0xe5d0feebf501e084, 0x1d44ecbf6920c0ca, 0xacf13df0686ab183,
+	 0xd96b14e6ff8a02e1, 0x9a2a685edfc9f197, 0xf155504fe1884a6e, 0x2727a8660d115d60,
+	 0x1d3f5a2791c894d2, 0x17d19c645e6b626f, 0xd004dba2849723c2, 0x7d18d76413168de4,
+	 0xe0e08abb274d2615, 0x0613c1f6199b86c9, 0xcb9e52dce4a99dbb, 0x77dcb1d8032127e6,
+	 0xe973cbed25c9b3b4, 0x26d772fb60986a63, 0xa0d4f9739a92f50a, 0x5811812e06173582,
+	 0x0f29022d3a0bfbb5, 0xc602e3b2ce8b8d45, 0x05c4cd943184129a, 0x9c53eaf4dbb1db40,
+	 0x378f4fd280464a4e, 0xa986eeb5aa8e0777, 0xf298ace7abd4b8c3, 0x30def6b167c3ce53,
+	 0x920d6346935c13fc, 0xc0eceab82fe78cee, 0x7703025b4cf46978, 0x19119667be147f79,
+	 0x83008ed8c7dd6c99, 0x23d7feaaafaa1837, 0x6b4b07340aabe482, 0xaecfe00d2f8bc902,
+	 0x24880b5428b8e2b2, 0x82dfd4616a1f9d92, 0x428ae0f2e66a15b4, 0xaa38a219cd278f25
+	},
+	{
+	 0x0e19790b35bde8da, 0x493a0379518f654a, 0xb6e5033598c4b699, 0x2143c5a1588ed2e4,
+	 0xd86e7c058dc1db05, 0xadf8d5db44e2e79b, 0xeb29cbda67d53be9, 0xaf2df9cea55080e0,
+	 0x7b0e7c32230fb4a4, 0x34d3ae72f24912ad, 0xc662de75f91af6d4, 0x525b854365f4854b,
+	 0xcd189f8b2bd9b29e, 0xaffc9e52cbe53066, 0x3c8b6c167c7e75d6, 0x9c5b3f28377a2d34,
+	 0x4b99b66bcf78ba7f, 0xcdeb443f007b7c99, 0x467e5a9dd83d5a4f, 0x4d7f8e55984884b8,
+	 0xeb9ba060985e2c2e, 0xbbcac57f04974a12, 0x4c6778b6465e57a8, 0x5dbbe9b43cc48950,
+	 0xa72761c35a0a73d5, 0x5335e2ab34dad6b8, 0xa8c6a95b1c7d90e5, 0x1c518780cf30f57d,
+	 0xe5f084de13177850, 0x0a609fc6fe5d4e13, 0x91402337bf810ce5, 0x52d49ad91df9e0a8,
+	 0x816cb9ea9d2689c6, 0xe2489cad0fcfddd4, 0x5bf35fa9eed9bf70, 0x349a2986279411aa,
+	 0x39c70846d334aeec, 0x4b62d9a6ed0777df, 0x81a33bec15b3fece, 0xab4bedb941e4389d,
+	 0xed234e9cc1d42ee1, 0x4da538595fe24c40, 0xe11fa4d8458848a6, 0x75f15ec2658b69ad,
+	 0xc959eb7940f19ba9, 0x09dd8610af34e25f, 0x34410e7f3d230c18, 0x85b8b8275abd455b,
+	 0x4ec5ae6de6e7e3f5, 0x579d6192cb5f4010, 0x762f8798b8c86c1e, 0x43f0d2bfdd7632d0,
+	 0xc5fb644bdf2354c6, 0xcdfd499ef173fbbc, 0xbcfe70472ea2973d, 0x6ac85071a7badcbc,
+	 0xe8e4bd6709e420f8, 0x27683ca35be109ad, 0x3441f6ec4dd878d5, 0x4e9fdca6652eef04,
+	 0xaf675938a99f7c75, 0x7691c8ef47d6d36e, 0x0d3ae60adc7fda33, 0x606bd3d09c3cdd6a,
+	 0x6b8ee729b8437bf9, 0x685320e912f49a8f, 0x34b93d6f0cfae31a, 0x8408075718390696,
+	 0x9caebc5b1a26db56, 0x8d4f744b72d080c9, 0x17edad323d153a6a, 0x2fd51538c23cfeab,
+	 0xe62ee9debb7faf8f, 0xd1767a2e15931a14, 0x39a07cd854c45fee, 0x440d2ee251d7fcd1,
+	 0x5fc47e52f1b07c41, 0x9629ac07574a50c2, 0x40c017179a98b0e6, 0x52ff637b78ffd5e0,
+	 0x7b137f91b9cc574f, 0xdd13e0e3acf3e408, 0x1c1580135b0fbf20, 0x73c5419911e095ba,
+	 0x6e3e16122e18fe44, 0x1728467158933e42, 0xfbf5d80ec0a7f9ba, 0x63619365ac829c53,
+	 0x79d8ccf1af0fb818, 0x413ee54da0f45208, 0x80a38d55a128ce62, 0x92f8bb6c5fa60de0,
+	 0x7f923ab7a2503a52, 0xa4d6a4c349cc9489, 0x26d4f540072e24cc, 0xa2f48f1392b29b81,
+	 0x9d941832b92c5022, 0x56357b63dd6b8960, 0x85d65e00bd0a7998, 0x509717505983d865,
+	 0x740d0dba0bc098cf, 0x3e894b126be8a11e, 0x3442f2fdb7c9fa8f, 0x10d79f17f76f76ca,
+	 0x6fab3ac53aa6a667, 0x6e47589a666e1503, 0x91ad58a80b674cd5, 0x3a51bceff9f15e32,
+	 0x86b08265803b05dd, 0x9cbc12e54d8ddc26, 0x4bde948c8d807bf3, 0xa4bb047df3c32ea9,
+	 0x36c27854acc7e596, 0x30483896e78c8e7d, 0x78df6ebb1b5e8c4d, 0x4614331a7b2326c2,
+	 0x30a696df3464d78c, 0x9b8502841c2d3955, 0xebf20c90b26b68f1, 0x5986a1bef3955d18,
+	 0x0d2ab1ecad957ed7, 0x86dda0018d74e29e, 0x142cf99854543e37, 0x0f05edf7a5d470de,
+	 0x4699632495b88f54, 0xe290fcf2d4601398, 0xaf06b4f2811022dd, 0x8ebe855f9de2d44f,
+	 0x88a181023e65815c, 0x86931d796ed90aa9, 0xfe463255b822c5fc, 0x0453f186ecabb479,
+	 0xd36fb495673019f7, 0x05cdfdb73bfd4605, 0xf14082b0f4ada12a, 0x965b52c861c0f834,
+	 0xd59b542eb7065086, 0xf337c655b5ade21f, 0x391d3d1ecdf85ca4, 0x3bd763fe6542deae,
+	 0x06ea217e0e4aaf22, 0xe9f5e6525a223b14, 0xb90c5c7ca688f166, 0x683da863cdfde45c,
+	 0xa22f1673b0725eb9, 0x86569787d90816ab, 0x26dee0ecfa21ba31, 0x531b1f066c289f12,
+	 0x3442d87d6e1837e7, 0x783df8d35615a4ca, 0xed069aa9ed2e4ba6, 0x0b09f5844f3e3f28,
+	 0x74b4502bab5c2dd8, 0x39330947ec13e478, 0x3e6b3a5348a959b6, 0x9f0307cb463d186c,
+	 0x886cbea23f48c3d7, 0xcc906834a2dbdd56, 0x9244d605943209d0, 0x8906184f30b743c7,
+	 0x3e9c277ec5895b27, 0xb2b9b01c3b904c44, 0xbfdde9254002f449, 0x4128eb5a559873bd,
+	 0x6a1c81202c27e7fc, 0xdba46efbe70f685d, 0x1e80b4b78ac606f1, 0x3c2c86f9f164bdfd,
+	 0x6a9db7bd3bc30baf, 0xd92654e75f84eba4, 0x5cd38c82e654214b, 0x6125627e7855914c,
+	 0x10ee598446008072, 0x9f8100b3bf210538, 0xd3c9d6ac17e19866, 0x7beab541d9ee573f,
+	 0xbb69d0668943970a, 0x5879e41352d649ff, 0x1f79a7ac94053496, 0x668e6e82d38bcc57,
+	 0xab7fb59f31a94e72, 0x82f3d58e4ea30625, 0xf349358747d1dc59, 0x3f5681f3e2672d0a,
+	 0xa51d46c9db50f942, 0x8ea18568955896e3, 0x5225686554c0c456, 0x33f35b9d0f135ae5,
+	 0x1192cef9222a1694, 0xa8b6f8714203669e, 0x36f778a0a84ce54e, 0x63415e8517686fa7,
+	 0x5ac18b192c4fb2fc, 0x51c1af2a8d62bb5d, 0x28e9fc361a219440, 0xac2a916fe984f79b,
+	 0x9233aeec42b5b4ed, 0x68b3b3873ce4b377, 0x07f4ba1bda4d73d2, 0xb114f210c9c9e1e5,
+	 0x9a71729f492442d0, 0xe4ec1b67cff05aab, 0xacda9a509425e579, 0x6842938d1f642dce,
+	 0x58834dbfa02abf4d, 0xe2aa432497cf496c, 0xf79d410a08919b95, 0x3aca5f50f109a255,
+	 0x55a756d5d6f87e7e, 0xaf5bd6428b887f29, 0x36d6eba1b8602131, 0x0b009d2f169305b1,
+	 0xad46e5bb8bbf99ea, 0x6809f47aa03a493d, 0x7f9bfc0732f541d7, 0x9e149b39a4477894,
+	 0x4f619033cc69d58a, 0xb61f5c397734b719, 0x222efcdd1e954b10, 0x6859db3975bcb776,
+	 0x109b279027706392, 0x485c6396c78856e8, 0x56f2ce5a08674a8d, 0x182ebd4b8f6d4ddd,
+	 0x9649a969fd22eb1c, 0x77811b46a47994c5, 0x139e42d9b051b3c7, 0x76a82c8e94707c44,
+	 0x1c61991e85e22047, 0xdc676e2a65f41d6e, 0x20efef7daee79fce, 0x79da85f0c2dbf30d,
+	 0xb5e5fbef5b01e4ae, 0x716b51e306f449af, 0x7f50fe5c7acb8d79, 0x9a96bba5ca5a1008,
+	 0x7eff912688d76af4, 0x48e4cd1cb19977d9, 0xb46bb69bd95b5469, 0x0463ddfd11dc6d71,
+	 0x41fee945b97783e8, 0xca4230467c64d181, 0x6c33812b7d5a38b7, 0x62a0f5e65d74e9a1,
+	 0xcfa62d70edcac994, 0x5e3ed19659a20c63, 0xe033360ad4695c29, 0x2f6c1bb8ca4dde68,
+	 0x65ab0976a57e83a0, 0xa9e980016d7f5e56, 0xd9a4207e3c120919, 0x0d8055dc7e4d1bb5,
+	 0xb63097e1ce913fd2, 0xfcf6d88a5b81371e, 0x44369ceaaf7d5212, 0x5a0d384f76f8cc1b
+	},
+	{
+	 0xd0f8479396d854ff, 0xa2a23a2a59f78ba0, 0x7c198a7b016c2705, 0x094ce233c42a41f9,
+	 0xd06e476c821e92ae, 0x950816b577b0403f, 0x68fd77a2af2da96c, 0x5a756edebd055bb5,
+	 0x99f45a2a951c8f68, 0xe73b0aabc3b57bb8, 0x97911df5e2333929, 0x2ccc6947d084d3c2,
+	 0xea9321f51b14358a, 0xd6bfafcc092bbe76, 0x7d44162205511e42, 0x941fed4f72101338,
+	 0x435da0d07788a345, 0x4bb51f6557997bc0, 0x3fa1d4550c7eb3d5, 0x4081acfd2029208f,
+	 0x61506095516952bc, 0x7b76e2d5cc94a64b, 0x81fc3a96c51de901, 0x27b46a119214755c,
+	 0xfc1c8ae5883b47e2, 0xed16b8db509fd3a8, 0x996b958d504ebf55, 0xa9203dcd8b1b20a5,
+	 0x2142174f14dad1e3, 0xcbcb73220fd8b344, 0xcd0ea5dc34250eb5, 0x18290671e96d4aa2,
+	 0x9432aa9a5838428a, 0x2f7b3b251f954017, 0xba01416e060614e4, 0x976229ea81a71f7e,
+	 0x9f7fbc3c96d83ba7, 0xb9ff9397905b5ca8, 0x36054b8fd70f0fd6, 0x5119ccaa94efe58c,
+	 0x8334f6b56e3595be, 0xa920ba17c567e3e0, 0xae22c0ebd0188891, 0x465089c4d17d4e16,
+	 0x22f694d463b96513, 0x8329a6d0c5d98232, 0x79d53724802f5554, 0xac7a50af6d3354c3,
+	 0xf3902869088be09e, 0x8d040891e7cb64a2, 0xb4d5a80e277d6b57, 0x03b60b63fd1d308b,
+	 0x081714353206e7e6, 0x9f1b3b45e9ba54ef, 0x8a45e7556dd4ef2a, 0xa4e17c0f71ead316,
+	 0x09eda40b5e8d9070, 0x965a811f2aa282f4, 0xbc936a346aedf9e6, 0x6764420175182ba0,
+	 0x3e9c426028f89bd8, 0xd6b69bc8cea6a3ff, 0x744ce423f8f43541, 0x89e68e892ad69c30,
+	 0xfa1c4f57f4af8efd, 0x2df353e405a4c189, 0xdd563e26bb0f509d, 0x5fe25e7ada07c71f,
+	 0xc8d4f8f702450107, 0xfc476c0f3ac8d378, 0x42d13e5f3e3f102b, 0x316b6dc041d3eab3,
+	 0xdce74c823c64c00c, 0xf68383c0342304fc, 0xfbaac52791aed07e, 0x3d0a13789065caee,
+	 0xef4612dd0938087b, 0x2eb89361b119b2dc, 0xa8b9726ee3c12542, 0xa831d9fb540400bf,
+	 0x03d573de0f6aa526, 0x158b390ad8418165, 0x131d6c04ba2e969e, 0x4dac54f9060a1b1c,
+	 0x8a58345d2389ff5d, 0xb1ba4ce9303b04ca, 0x28bc87212d7bb212, 0x8859e394bd51cae0,
+	 0x2e9603b418a30af1, 0xfed8e3388a24cb64, 0x42c5a2863d2ff272, 0x774938db6c771792,
+	 0xb609e4341fcae510, 0x9af4a780119f9177, 0x2ee27517e83709b2, 0x1ae3d5872c62fe90,
+	 0x667451a7808cb01f, 0x02d8b1d34b80221d, 0xd43f5fad694ff4a6, 0x06ab8b066c8273c9,
+	 0xfde50d5c49b41bde, 0xd963a46f422fde61, 0xecfaae0bf68634bc, 0x271e2c84d13a61df,
+	 0xe7d107ae956f7935, 0x12772ac09f072563, 0x478b6663e7edc0e4, 0x6f1250afd2c4c518,
+	 0x9f65a326399565b6, 0x6f61a25655437e21, 0x0fdcece18b8b69a5, 0xa098c4e6c73e4373,
+	 0x4fdd86594527e2db, 0xbc0c09d97b0bbc59, 0xb2516103c3173dc0, 0x74b1c78650298f4d,
+	 0x2cf283c2fcd7dd96, 0xf23b650acd12ab4a, 0x86c254a592e2cbb7, 0x364b5769a4b2bb60,
+	 0x9dd7d8c0a29cc45c, 0x9c688872f4da1dcd, 0xc90a49c6dee1d5e6, 0x046daf8ed69ae3bb,
+	 0x0813f617bf4e0034, 0xdb66780da9356634, 0xdfaca95b663f2e39, 0x74670aa9ee31dd14,
+	 0x4db4846a378bb5ac, 0x0ba9a24d78c35c75, 0x7ea50c9f0c55357f, 0x2fa472da9c07a1ef,
+	 0xbc010f1e6a359f3f, 0x7cbec20d42cee380, 0x531217166090309f, 0x5cc1d00f5f2d00e8,
+	 0x68df8db70b0001cc, 0xe7f9576586c423c9, 0xea07690d0a665bc1, 0x40b1081de53490e1,
+	 0x02bca0788b356e0f, 0x50a255365d5175dc, 0x0a6c8b2380f4bc1f, 0x4eb3e4afd0b366e2,
+	 0x62ac1454867a3a09, 0x05532287aa0bd720, 0x5c3eee30f6e5ab43, 0x4c66f2367993d865,
+	 0xfeeba799dcd76392, 0xfe1add715fac4db3, 0x380c6c0008c6d6dd, 0x54fd0519c69e140d,
+	 0x5d4a0be6ae2e0f99, 0xd0648147657a6e2a, 0x700ca9d018784609, 0x305894ff93b6da34,
+	 0x15130237191315e7, 0xec769b6cfcef86d8, 0x8e4148bcd7a60cb0, 0x37ffc520311af0ec,
+	 0xfbae72d9a9cf4e28, 0xb144442140f66743, 0xb48877c6f0aac9c4, 0x6f67c3c918d4371b,
+	 0xec5ab0fa50601a60, 0x254ca7faa6e88191, 0xcb8a9f7744aee4e2, 0x4d2e5bce3e912fbf,
+	 0x63d04ec093d52a66, 0x6ca33689dc2ceaae, 0x53dfda74f51c5041, 0x1af9bbb75f1b9df2,
+	 0x86ba98b6d00a89bb, 0x06a3dff335f4e94a, 0x53199a812ae4e924, 0x815e8c821ab94c25,
+	 0x05c9b57d2ee87eae, 0x6e9da80924116034, 0xf9facd9869798b1f, 0x714be77e0446cdfd,
+	 0xbadacb3493fb12db, 0xa3d0a315718a3b16, 0x4e3964042786a889, 0x17b15b65f0036922,
+	 0x8b2b4a7177657d17, 0x168fa27c7d948451, 0x094e00341e578baa, 0x17adc0bac5e5f62b,
+	 0xa5f84e839adb0ab0, 0x9b18c61be31a7770, 0xdf45615e191d4de6, 0xb099910a3f840d52,
+	 0x9c6ece43e530dbc1, 0x6ee3d7b31496aadc, 0x2c70a0da9699570b, 0x80db0aaf64f2e6bf,
+	 0xd473e82f69dbba5a, 0xaf2f155a165caaa0, 0x20b5f559b0b465bd, 0x262ea7d5659d5625,
+	 0x6b8bc0f625ca6a3e, 0xc299549c3cccc902, 0x6df5441abfebfb84, 0xb58b54d493cd9fbd,
+	 0x2627e47aaa2e8f30, 0x0d106272c861ae2d, 0xe9b8a14e09738d38, 0x1051506c3d587e3c,
+	 0x12ee15068eecb907, 0xc0b0b51cd148b0c1, 0x04841b387c9aab83, 0x6c92b5e9a3c0acbe,
+	 0xfc09c9a34bf4fef0, 0x4b0582f2e5b7ce53, 0x7517e77d2380134e, 0x51a27544e959b906,
+	 0x00e63817a2f9d74b, 0x00f790f730d6ab8b, 0xd14fae7916ce7484, 0xa1206e1aa9b1538b,
+	 0x19f6d9755f21ef90, 0xf99d212aad15e781, 0x286a88da1b3f996d, 0x9032900f21f28ebb,
+	 0x40111b708b814cc3, 0x32ebaa6c00bdab4d, 0x1b8e955766202685, 0x9cac4fee42c9376a,
+	 0xe7be0533011a63b1, 0x0603884ac8ad63c5, 0x00cf8af56b7e5d5d, 0x05b690bd1395a8f5,
+	 0xd6f4d36ca42c2bdf, 0x82998d49a209bafd, 0x026e6a855700902d, 0xb5cb7388d1096e55,
+	 0x87bb73752b4ed4cc, 0x227d57305c271c28, 0x4594dc351f96f295, 0x91bbdbaa3961079a,
+	 0x6d2372e9c249dfb8, 0x878a2309a092db30, 0x6698a393862b8038, 0xa2739e77c0b5fa88,
+	 0xbdf80796cad19067, 0xdffe6fed9f382dc0, 0xa195673b4b64c3bc, 0x8bb57a099e36ee62,
+	 0x97eaad5dc195ec29, 0x42fda81cd695d746, 0xe9ea94e37608061b, 0xa246589c8da71de1,
+	 0xf20e2fcde37e2621, 0xf1dd8ba23ac02fbf, 0x3b59410dedeb4b3c, 0x9ebe9270dcb91ff9
+	},
+	{
+	 0xac8c8478534e0963, 0xd06036470e0e691c, 0x2d3d975d5b0a8590, 0x73cc7bc8963f427e,
+	 0xd51456ce8b546f3e, 0xd719a60f0c3270a0, 0xd2fbfcf05fdeefd1, 0x41f664523fe0ccfe,
+	 0xc2fd7e6fc255700f, 0x616536334904539b, 0xa67f4bf20f3fbe0d, 0x2d7ada5a311a227c,
+	 0xe8a95c2beba07d84, 0x49d703384e061dc4, 0xf9e353d94ba6ca4e, 0x40965ae7a98587a5,
+	 0x0f7d97fd564f2f4d, 0xd842c693eaff9a80, 0xe6b9c3b489639d84, 0x6168e56c7806009a,
+	 0x079d61b124b71799, 0x87e1435d17abd743, 0x6a83ec5343635177, 0xa9c55b2bde73867b,
+	 0xecab76754179b6e3, 0xa0033d38b1300f8a, 0x57e865d4bcc70b44, 0x806f893a1b5a79ab,
+	 0x12f75416cf9184b3, 0x912b56054673a0a0, 0xc7f25f43fccf56ea, 0x9430516d4d5f9f67,
+	 0xd44962acd3871d13, 0xe3b98d2a0221e146, 0xf7296580e3b050bb, 0xa340a75bfbae4252,
+	 0xa02a811206cef72d, 0x0ba2824d263bc5d9, 0xb430b1a0be45cb2b, 0x3ec1a3b58b214025,
+	 0xd44676d15affb511, 0x725d7f09824d9a24, 0xba70e5ef8f001486, 0x82e570a6d403ec1d,
+	 0x981d7b7e53697200, 0x823f2a842b0af38e, 0xfda9cc1a45764e43, 0x0dd55e4832913cf2,
+	 0x41796beb7ad02e04, 0x4bfe966fca6a5fec, 0xde82c5367aed3f3f, 0xa4062b08df03353a,
+	 0x473d10e97a56c3cf, 0xb62f5ea17b6b9e82, 0xa2c61d50425cc7d9, 0x9992cc57ad325606,
+	 0xeb589f28adc5f966, 0x12a8117cf765947c, 0x00244155b0842eff, 0x1f3330e2c51619c6,
+	 0x13500bde1af075c2, 0xe518cdfa24a7e6df, 0x55ee2dbd4780ae3d, 0x8f796442f130d4ce,
+	 0x986d5f6e6cc5af41, 0x229aefe2c5ec0f47, 0x9ea0868d269c24fd, 0x9bf8c81b25595d52,
+	 0x74e35d856962dd6d, 0x28096d15a4dc68f2, 0x17ead7a754e37a50, 0x0194d56172bd0c05,
+	 0xc7e02674221395b5, 0xd9e650b36826df16, 0x9088f62413215e62, 0xa0bc3e90723a1cb8,
+	 0x1a0c5b3f431248d3, 0x69f4b70de2ae2182, 0x91d7a598d1a233ea, 0xa9e90a9d2710716c,
+	 0xb7e58cd727993869, 0x60910cf02de50371, 0x24100c75583b953c, 0x33925d05c9d5eeff,
+	 0x13e2494ee9c5f76a, 0x0be0f29cd25ce763, 0xa4ee4cec9b1cc722, 0x829175f1ab273142,
+	 0xe9a0a6cfc2c8accd, 0x2644c4d8cdef4221, 0xcc9c4ddca1003011, 0x2be1515b6641e475,
+	 0xbd0ebfb0c48800a9, 0x395e8ca79cdfe91a, 0x1cbafefe8300f354, 0x1ede1ed07e393e02,
+	 0x42a398b536c01fe8, 0x4cbea8039a573dca, 0xc9d9b82cad009e80, 0x3ff41b7cbf067ccd,
+	 0x6e87adea26fb4bf9, 0x91aff1012c192834, 0x445c75acc741b204, 0x548b4ee9f16caaf9,
+	 0xb960c5cb9af444e8, 0xe645d28f54d6499e, 0xbec92f6d80ff891b, 0xa93e3b4c9c78e7e0,
+	 0x961b98096af1e29f, 0xf96e27d979a0ddd4, 0x93e101a1bc0baaca, 0x0883bc55930a44d0,
+	 0x0e13e802360c85c2, 0x1f8715b8b0aef3e6, 0x367b76ad00fc9e76, 0x574469a494202ef8,
+	 0x3120e72487f72bce, 0x71b51610b3f30ff9, 0x29d2d4e98da1bd33, 0x282db58fe2d7ef06,
+	 0x88cf1ade7081d454, 0xd2729f2dcc84529c, 0x86a5757b6e02d4dd, 0x8587f01e96fadbf2,
+	 0xdc7fad436165acca, 0xa94fafd1ad14015e, 0x73f473a535fe3add, 0x1267b6e88223fb1c,
+	 0xd4987fcbd1d5f88e, 0x055f25e75036bff3, 0xdea804b1c40f68f5, 0x42056bf4b6ed9278,
+	 0xdb7bbb9727fb3abb, 0x28026b239a7742bf, 0xe90f26427247b0ec, 0x5dae2f23ddd279f4,
+	 0x42e3b85e3f0c5f2c, 0xf6660af6053caa6f, 0x0c3b9772a7d81bb9, 0x7a02906df50c7e29,
+	 0xa0bc472f52f57bbd, 0x3189e60765114b49, 0xc5e0090512d87b06, 0x4260c8d72f4e6a3c,
+	 0x4575ff04e7d01236, 0x39d9df45a77febef, 0x234d76fce93685aa, 0x81dc794b749ca89a,
+	 0x9da4cf5ebb6de522, 0x790df15a4b529b37, 0xcc61d089083ba051, 0x85bd2e04510f6afa,
+	 0x7a1bfa8ed7f6fbad, 0x6515c420ddd6cd68, 0xfa86410b0d97d8f5, 0x5bea909d8a5d755d,
+	 0xf058ab6cbc32faa1, 0x30e58ca04e4c2ea9, 0xabf345204a0e05be, 0x6cf67302d624c809,
+	 0x752164aa8d7bec0d, 0xdb93069c7529d7d5, 0x608cb0b9e8c33959, 0x595aab2c008832bb,
+	 0x943ebe7b18270f25, 0x2e7906fc6c4be34b, 0xf2e919e03b233cd8, 0x548168b760979957,
+	 0xeef694cd373cab44, 0x15f980deb54905aa, 0x136a12647f7869c9, 0x01fda34ba807bd3f,
+	 0xdb9d6554aad2933d, 0xb2d238f551515c98, 0x5e2ceb3822422653, 0x0b8595890cdbabf8,
+	 0x807f1ca2f36e231e, 0x73bc7524160a8e6b, 0x6c63e9eb3b1ed530, 0x2d8a2f519b30727c,
+	 0x09e98709d2d897c5, 0xd2e310fb08c69895, 0xa968a20d58dc2397, 0x0f23b7fdcbe4b79f,
+	 0xd07c7df6bbafece9, 0x2e11933919406d75, 0x1d4b33b2543516dd, 0x943ae8518ee39885,
+	 0xc31f6f909a0154ee, 0x295c951e11f3e42d, 0xe0708a0780af790b, 0x842bf975497f9cd3,
+	 0x8fd04fd2daf8de16, 0xc8db2c0e0b9bd748, 0x6f9eda81b327172e, 0x17fadd93bd589eb5,
+	 0xd8661e48a4407024, 0x2ca170e895719df8, 0xb62ba3679da37fbc, 0xb352efab602a4832,
+	 0x6f54ba2c3bfb0cf8, 0x3a17a942665367df, 0x0cd373a6c972d66c, 0x232f57f228d83b9f,
+	 0x6ad2812178a71ed5, 0xdea4c09db9c83434, 0x38243f07349280f6, 0xa1f3616eed0480da,
+	 0x23cfa762b71b0121, 0xd8470f51eb9c7ac7, 0x04227eedce8b1420, 0xaf943bef42dc5b82,
+	 0xe1b1f05a17d987b7, 0xd0dc04c005400b39, 0x62a3bf20dc4a8588, 0x567ac929dbfee4d8,
+	 0xb144629719a3e7e5, 0x6cb1c4fe40548237, 0x0576f3b61650c378, 0x3d328baaf63337aa,
+	 0x9bbb2fb8b82b4010, 0x742fbbac28899e0c, 0x4fa2785c76e95b7c, 0x226bf28ad50233bb,
+	 0x6db56c8cc9209c6f, 0x548e048bfbba7646, 0xd61866e9bc927c3e, 0x0389881f0dd5a9ff,
+	 0xce76d43d56f8da4a, 0x42fa3489dd58a7aa, 0x4dd3059686923f77, 0x1eefbe56f456d8fb,
+	 0xae58a95ec4ef12d7, 0xeef8c65e831e9c5c, 0x10439f9df2fc61a6, 0x8d1ec2e10b4d1a55,
+	 0xd0d5af3505aec883, 0xf82644f0a05cbb5e, 0x8f09132c7c1e48ee, 0x60097e7b187d9d48,
+	 0x0c77f5198180c4ec, 0x1759e9d6b949e419, 0xfe82af6969825f0c, 0x8c21d809d73dec43,
+	 0x97ea00fe8b62dda8, 0xd8aeed7d9e85df3e, 0xf694f81ad905868d, 0xb1bb64efeacf2c86,
+	 0xc984c998cf633c24, 0xf5d9c10cbdd619b1, 0x12d8d71ffc5da09c, 0x4abe08f39accbc28,
+	 0x2ec78a2cebba7c43, 0xc94c310adbeacf2b, 0x43b97b46158e299b, 0x9394306bd2117efd
+	},
+	{
+	 0xca30553b17dde0b3, 0xd99e04972b401370, 0xb09599a45ef01d82, 0x212d5a9372cdc03f,
+	 0x62dcc804851ab442, 0x61b87a5343a71fcc, 0xf7c9d87ef6e9f308, 0xa3d6b5dad7114a0c,
+	 0x7bf83712c1bde50c, 0xd9c251cff63b16f1, 0xe76f3ca75770c1a0, 0x1495b584210fafb3,
+	 0x0373f89333eff8d2, 0x18f3426f2fe06a1a, 0xbcf03674b132f0bc, 0x107bc3e80de95882,
+	 0x1ced72c7dc8d9f05, 0x627c9931cdc374f1, 0x0c6526340bb1bf2b, 0xb24358fd655607d9,
+	 0xa9192e0cd7e5715f, 0x4124b9dc9231d970, 0x17821cb5c888b69b, 0x342527cd4982d0ac,
+	 0xd45fb98bee49fc91, 0x38c4ebf7f2ea759d, 0xc9a02a96861dc7ac, 0xaa9a55f4a6d31fbb,
+	 0xf9c12e6c8527b6df, 0xb99b1805873c88aa, 0xc70786c7fb49f489, 0x09b0c98f06227a74,
+	 0x737301c1b3b54b1c, 0xe3023cf503addb61, 0x56df3f41273e027d, 0x819246dbb6cebcce,
+	 0x1c90fc5291e278b0, 0xe7804ade41277a07, 0x17d1468b7e659f87, 0x02a2a6b48a9dfabd,
+	 0x2c70e5fa88c2acc5, 0x0e9bf04ec0d26a30, 0x7df45bb4f485d7cc, 0x09534257073ec905,
+	 0x64713f2aac330007, 0xfc59a10e885c99a2, 0x9ca9c0a32c601f93, 0x99f9f8d433c1518b,
+	 0xccfcafc96c62b0c8, 0xc86aa1eda8a741e6, 0xf2be02329c755659, 0x5f12dc7195e867dd,
+	 0xed80152b9dd2c015, 0xffe7411793014829, 0xcc3585a86fe753d8, 0x41774e1374312336,
+	 0x55d4b9c0ef6d6355, 0x1ffda7beed8f7ba4, 0x95b2e8a78548a7e6, 0x41d1c93664bfba3a,
+	 0xfdd349ba14f1002a, 0xdad7f6a28f92c6df, 0x26ed7ead0fc79d0a, 0x9975e969f08b2360,
+	 0xf881461372b98548, 0xd5a4004f3f1c23aa, 0x00366e1bee086a9c, 0x5b46ccdd94e20e80,
+	 0xacf76908af36754a, 0xca705e461041ce61, 0x3ea627c15aadd958, 0xa623be5923b918ac,
+	 0x3d23937499a99af3, 0x3b8934cbf3ca68a7, 0xeb9b5b6738a43de1, 0x9971a1147880f165,
+	 0x205c2a903d9b8a55, 0xd843f891d824e26e, 0x62db25d83ad4e034, 0x4f0c49fa2273b1e7,
+	 0xd1d23f6ef58e8181, 0x36f6e538ea16f4c2, 0x2595b617bb270cc1, 0x5e2ea3784bdfc08f,
+	 0x720010729e4942b1, 0xa265ce5ea0c3f289, 0xdf87fc1fbf02e68c, 0x5c5e97249054a92f,
+	 0x329293957e8c7da5, 0xe964821f3ec98adb, 0xa252febade603297, 0x0a0b32dbcc93b986,
+	 0x4b3765f53e2f2fb8, 0xd69004543ddd8441, 0x0fc60b7e39e7ad4e, 0x31cf3a4eeacb9d93,
+	 0x737516b17f71cf82, 0x28d2d8cebfdfc9c8, 0xcb64ef3dc0b41dc9, 0x48394048c9c9d974,
+	 0x6f91265e37b10db7, 0xae5a2bd4f3f3a315, 0xd07fff0382440bfa, 0x394e109198d4c024,
+	 0x5edb3258c5233ba4, 0x8760f688fd40d0c0, 0xa7dd35a4a1baa56d, 0xafe8befe579aef24,
+	 0x430af9802cd50bd2, 0xb1e9fe46aa7f3a18, 0xc81ce9d91a35f08a, 0x2fee972a24d7d238,
+	 0x6e64f050aa51a7e1, 0x6448161cd7a6ba5a, 0xa08327a11c39a574, 0x56d3ae21fa110ad3,
+	 0x598e48584f4fc8c5, 0xf05d75a880312c07, 0x926d06133b14c8cb, 0x016b1babe319e3f4,
+	 0x5ee88ac0037affc1, 0x34f0da566c4fff88, 0x6278f10eeded45d5, 0x2548cae1e160b198,
+	 0x7e11c7600c82b0e3, 0x4ce85ea408618238, 0x3cf1fe3f5ab142d7, 0x48a31e33cbacfbfe,
+	 0xef0908b476c82804, 0xa2d8a9f035dfc4bc, 0x023b71b9f2620516, 0x7b4981c967bb5409,
+	 0x8e6038ef833ad7b3, 0x6783bdf8382d5345, 0xb4d9306e199d8df2, 0x005c3f2012e47b04,
+	 0x10d2685be2b0ffa6, 0x501179c068869d19, 0x5d59618f0c07018b, 0x4db91a56bd863648,
+	 0x7d221e33ad1634f3, 0x0402364477260431, 0x47e163169a606fb6, 0x33e698cd7f538e9c,
+	 0xd937a9909f6352ed, 0x3ad0d16e9f3e55be, 0xa8c9d7ed30db10a9, 0x9de96e775974f0fa,
+	 0x673cafe363e7096e, 0xe077dac39a08419f, 0xde8bebeb444bf0aa, 0x3140e760125efcb0,
+	 0xbf0e0294bcab0ba3, 0x4ed1b848c696a180, 0xbb668bb54ba37579, 0x685a03705a28cde5,
+	 0x15518cd4a31fe3ab, 0x3ac25265eb736119, 0xd5f403d9e890914a, 0x1c91da47408b775a,
+	 0xe533806a26d7f83a, 0x3ae5a47df7dd11f3, 0xa57d64c555d33d2a, 0x1a2a8cf84100e886,
+	 0x24fd5b8d54997b48, 0xd4543b4c35c15280, 0xaacf70b8f0122577, 0x7bcb8b493c79e628,
+	 0x50b929cd5b75b896, 0xcf503fd801f4f1e0, 0xcb3cb06a2a327940, 0xabfd9dd0aab00f5a,
+	 0x5193932fb1bc0fef, 0x8d8662231954f657, 0xcc8746a884fda517, 0xb40d95247c5cc023,
+	 0xf4a11bd374716124, 0x41b6f78329a8f928, 0x3ce4d53c000f8221, 0x9dff1abce8ccb056,
+	 0x1ba3d4997361372d, 0x09f302fe0b01758e, 0xb9e4d16e8a0c6e96, 0x14dafc73183a9b04,
+	 0x6d7b59caf6e926c1, 0x0bbe140f2fae3acb, 0xb7a2afb970ad3fa7, 0xa5856597134d5a17,
+	 0x8103697df3bb4316, 0x9e583fbd8f665c7e, 0xbca09d4c5ad4bc7f, 0x8568b866d0609457,
+	 0xec33d721b1456e62, 0x38f97b2515a029a6, 0x2f2980c6f5482988, 0x5f8bad45b3eaef37,
+	 0x042bf6e571132d81, 0x253020c9d30e8c8d, 0x5b56ff1d1535bc16, 0x5fc24371306ee285,
+	 0xfc76149a758e5228, 0xd4d6ee98d34ab4da, 0xfdd0cd4cdef35a90, 0x8709390db753158e,
+	 0xf2cd7267de2461b2, 0x23aefc601cd0c1c1, 0xd3924397b51390c2, 0x7261df70aa44b404,
+	 0x5b0580503ac269f0, 0x07948d9b39e3c5d9, 0xa6124d1861eee231, 0x386512e0a43d8790,
+	 0x78830f0f03628fee, 0x45c88171c89093be, 0xe30121e104eb8fd1, 0x8dd337924af06b11,
+	 0x39326800972ebed9, 0x76aefb31cfbf8e78, 0x9fa1a6692f9591cb, 0x7392206c46c1cf56,
+	 0x434f2aaa89de3dac, 0xd9f1b8d25637335d, 0xf2d8632f00b79dde, 0x822d8427dffaabfb,
+	 0x202fd35bc63e69d4, 0xf2b8a196dc90e70e, 0xe858e36594ff7eca, 0x87f7c3df0977b44a,
+	 0x522d3bcb429e6f33, 0x783e6e45d0d4fb21, 0x4d554b6b906e55cd, 0xa3989d88b90161ce,
+	 0x52c632bf6964fd7e, 0x349aafd9081fd4b2, 0x7f1894f54ea9435a, 0x0e0a518e624ce6e6,
+	 0x2d3477445b11d9e3, 0xe359001c27a68e56, 0xa7727585d34703bc, 0x41a9149137290001,
+	 0xca8d98947f57ac28, 0x64548148abfdd38f, 0x3094e98f4515275d, 0x10f320074a2fb7a9,
+	 0x1134d7f6ccd8083b, 0xbbea4f9bd23e302f, 0x5e212787c5234abf, 0x34afc38a709543ea,
+	 0x3bb866f587cf6712, 0x41b195b68f4654f8, 0x59b1dca57d8617a6, 0x0ce69013a84fdb62,
+	 0x441b49e0eee1aebf, 0x100fdc71d270ac48, 0xd088804c443d4bdc, 0x15feaa5a6813097e
+	},
+	{
+	 0xa8ac8c2d74a86dbf, 0xe25a0da0ea433847, 0xdb8d21c6544bf698, 0x756d437fa63233c1,
+	 0xc7a3ce4b6b1cb665, 0x95cbb83e8e2d0e4c, 0x6619478a0273be7f, 0x5ba9540a9f5fc304,
+	 0x7cd5bf487149fbd2, 0xf449489cec249398, 0x7217570921e31c2d, 0x597df8fa3bb2a9bd,
+	 0xc8dfe52b10f34b95, 0x89667667b953e823, 0xbbc00ce2a00a6558, 0x8defc5d69d9d42da,
+	 0xd0dcf0f31278003e, 0xf24342257f5b6876, 0x59d63280caf4828b, 0x88aa7c9c5da28422,
+	 0x61ab10f39377d1fa, 0xef647ec2cb65fa74, 0x68b6c82928a2dacd, 0xa885834899823fda,
+	 0x568dd3d5cadc42cb, 0xe7a13255b28c71df, 0x47bc450db8f4f5b4, 0x4f0987079fa6542c,
+	 0x3939edfc5c5039c1, 0x4401baca1916d775, 0x8293a09c287a063d, 0x5a3a50586695e834,
+	 0x53f184a590b701a1, 0xbc0c9c57ada02bc2, 0x3813ecdc678b0b77, 0x7e5803ada91b28de,
+	 0xe4bc5daf56647fd4, 0x215957c9ecf8edf3, 0xe35b1c4084d43ccb, 0xa369c71c3ac835aa,
+	 0x6c4b2c85267fa7b4, 0x39ca0fc76567016b, 0xf3816610f19c6122, 0x19b456b3e91d6955,
+	 0x09a8ad6f23d693b0, 0xc4b17a09b48f4f48, 0x10ab2f43c69e905e, 0x369512619a05e80f,
+	 0x7390fc5865a8cceb, 0xefa1d3447f119961, 0xf69d60b73d33a9d4, 0xa4f94495eccec7ba,
+	 0xc38ada0b0853ec68, 0xb1287b089f64bd8f, 0x6be6aa748dc8f00c, 0x8b5e20473ef5ed96,
+	 0x6acf7e70f2a33c7b, 0x3c2d057282f6a13a, 0x01a0e4fea70e2874, 0xae5cdca1906a5aed,
+	 0xfbc491d123911b45, 0xf59d97da7287b1f2, 0xd0237dcf2fd18138, 0x917ade395c1ecf80,
+	 0x1dac320066b6379f, 0x6801d0e6cb191908, 0x1cb4b13c343c0937, 0x1acb274a57a30fcf,
+	 0xa3e352424bfac887, 0xd18b887cadc0ee0b, 0x42f48a509dab7bbf, 0xb524d6c0fa1eefca,
+	 0xb047076be50cc61c, 0x3f59f1d26d855550, 0x49d78139955c3fad, 0x1c0f5b3cbe1d8c08,
+	 0x889a8b91872b315a, 0x8bc4e471a6d00c98, 0x4f7a411e5c8b9909, 0x525234f6e6bb503d,
+	 0x757794436f6af8c8, 0xd0f1f0da8e109f77, 0x13a83a8a8a7c5f56, 0x9100ab4ac6ce2c91,
+	 0x0537f93cadccdacd, 0xf0e6a7293f9d5469, 0xc99ef2228dbc2dc3, 0x2ddcb834962d8f2d,
+	 0x444574a777207742, 0x7d636afe349f62c9, 0xb326e7e3fc67065a, 0xa9b3bef8c13b8315,
+	 0x8816673c94ca30ca, 0xb449f99db6ab399b, 0x92e66622a23f9872, 0x042e1e1976b0c40c,
+	 0x04df708de92795af, 0x41024eac6148eccd, 0x55104ca29f2d1703, 0x75ab18dab0ef01b0,
+	 0x46c185ce7a99ba2f, 0xab85f82b082aabb4, 0x34d425ad4f6a3da4, 0x5b928c3de4aa665d,
+	 0x9fa05a947eeaf2b4, 0xb10e06b245a206c9, 0x4291c8e2123469ff, 0x77864245703d9c61,
+	 0x9271a52839bf632e, 0xbf6efff1f5a8df42, 0x65074d1d84472bf0, 0x327620874a3c3ef6,
+	 0x21ce0f0d160c3a97, 0xe0c028233f95b7db, 0xfed730693123cc47, 0x5b78b472e65c7d68,
+	 0x1344bc37ae179685, 0x934f400ade1b5ec4, 0x5fbd4b356ac72535, 0x9286353bdfcc458e,
+	 0x7c6e83e4eda9a0e5, 0x6b761f79284dd89b, 0x262c803154a808b9, 0x6064f52431cffe49,
+	 0x3b6039d01246502d, 0x04834d26d4f6b492, 0x2052888378f80916, 0x9794134a71ff56a7,
+	 0x0c0fddf7369aaf74, 0x113fea831553baeb, 0x9a00eed1818ef8d4, 0x9ddc9fec4a18215a,
+	 0x98bac943f049c3c5, 0xd4fa5119208ff941, 0x444877ffe1d0d0c1, 0x8878e4918d19e116,
+	 0xf6ba59d4c7ace80b, 0xa94cb8c24de08b5e, 0x1768783040c49658, 0x0da1fd7733a2e42d,
+	 0x60aecc4c4b3e764c, 0x90ec49fc46ac9fb8, 0x5a837571d509d306, 0x5899feb9a3c1f6ae,
+	 0x1226beb4df05920d, 0xc6f0a19f7c257855, 0x5340e3a33bf107cd, 0x405c73cbd1be7356,
+	 0x90cbb616592027b0, 0x023834b6cbbba9bf, 0x67309303aa77f770, 0x459b50fc91d3eb15,
+	 0x6aa644c9f7581bdf, 0x50f112359452c276, 0x21ccdfbc33ec0bc9, 0x2ef306f6fbe80942,
+	 0x1e1e65eef17df6d1, 0x15fa4985ebd7a9d9, 0x6b6b9d3859b3bba9, 0x2ce3e43d76a408a9,
+	 0xd2d2c1e13a111aab, 0x63953cca62c4cb65, 0xd2d1f7ad7306ab13, 0x1061c9cd419819b5,
+	 0xf94b99e7456deba0, 0xce32c36ab1fab3ad, 0x5d05a77f56d7639c, 0x61cac7507d30ec87,
+	 0x2141f963f418db96, 0xc15085d5737ab55e, 0xb1fd9610a0c30caa, 0xb26bc601cfd01472,
+	 0xdd48afc754adc522, 0x323e2295ac09bf61, 0x8bbff3f73e51deaf, 0x2bc0f724ba74d151,
+	 0x8bef1ab7e0782937, 0x252b1efa8ef662d1, 0x65a4634275b913f8, 0x57ba30411816cbf2,
+	 0x49d5fedfd561626a, 0xe8421559cc76caf8, 0x735661fcc816a9d8, 0x351bf6de5ac0b9f9,
+	 0x5829a7afa9ed2b2a, 0xa20ce3c4ee7dc53a, 0x2139d6f5d95fee82, 0x6153deeb384e0f89,
+	 0xe5c0971d685661f8, 0x48d4d8dc544447ce, 0x0f6198e0b8412d93, 0x531c4c1483e6eb9f,
+	 0xcb402b7669086e7c, 0xb02c12b007079551, 0xcc682b422fd80f23, 0x87d989679da41988,
+	 0xb8eb607762391858, 0x0f95ef31fd1499d2, 0xd5748debc76663d4, 0xac7e952aa32c5858,
+	 0x036c39e8ca1fcc81, 0x36c95a8d8e99df1f, 0x059cccec0a7c1e1e, 0x041c67e015b4511d,
+	 0xaa606108bb927fe7, 0xf3747d7aebe0cc7c, 0x73649477ce06348e, 0x333a7db5c04b79e3,
+	 0x8654205f36355762, 0x7329cb4dee0869f9, 0xd1edde249df5f862, 0x3350423acd4d4c48,
+	 0x83b05055efd98c40, 0x03b5f9c9dcac5a1a, 0x059ed410a4ffe863, 0x90005cc8af68b018,
+	 0xe50be6ab9bb6bf98, 0xeb8ff1237dc8b801, 0xc5d39a12a0658d27, 0x4bd5c03885d85ef1,
+	 0xf6748f025ade59a1, 0x62e7c8f43f5eae45, 0xf16edef5555000f0, 0x57d24082f41ad236,
+	 0xb2a29f459ac32008, 0x1bb88b1c21a9e287, 0xa52ba2e072d03fb0, 0x8f685b73773c2619,
+	 0x028c94d87217d168, 0x4e32525df355aaec, 0xd7781df0fa948c60, 0x18a51c6f5fe82433,
+	 0xd371eeb254bf4211, 0xe9afdea75608746c, 0xf04fd216e0dc10a1, 0x6d0fe35f40b54564,
+	 0x8db6af6d8ec25fc0, 0x8b61cc7856236e34, 0x234b1e522291b783, 0x4391abe34a1523d6,
+	 0x6531cd2d9ccc901b, 0x05a553a8096e735c, 0xb62697d093fbc412, 0x6213e2b38f8ebf09,
+	 0xa1b5a235e3074613, 0x5e5fd1874d36d9f9, 0x12ae2bf172b12a67, 0x381a137274245576,
+	 0xeacb1baa242fee23, 0x860e325c4d381a27, 0x74163a9b06726787, 0xad22907f6386d521,
+	 0x5b601e2c95416582, 0x8edd369b8e8dbeb2, 0x877db301f12f90ab, 0x1a44b68c91f1b068
+	},
+	{
+	 0x4018d72a6614f766, 0x1fe0a9f830f77f50, 0x917378eb0ca5e262, 0x648cd5543b4ac44d,
+	 0x3790f40de27e522f, 0x09f192f13e84fa21, 0x156ba559d9755146, 0x9598eb09e018a95b,
+	 0x6fa00939bb4f16f7, 0x91d193fdb5ef7695, 0xb1176157ba61de28, 0x5f659fb2715cf84a,
+	 0xe47dfc8bafab9ece, 0x230e989f66015bf7, 0x5ec9100a81590e23, 0x094a981620112cbf,
+	 0x694018dba0cf1da8, 0x1d2b728749e2cae5, 0x253f42e03b874f9f, 0x6aa6635d3631a23b,
+	 0x1f7d29ff2f96436d, 0x0f87324a511f3687, 0x6e022bc852540c4e, 0x51f0e03493945295,
+	 0xf2757e72401f0937, 0xe7d8e03c76fe1918, 0x5bc7302260f83699, 0x5d68a2c7900be9d8,
+	 0xb4299320053e5630, 0xe243f560a0346109, 0x152ddcd8bfed708f, 0xad83e98b54fd446a,
+	 0x766a1d3ac059e5e3, 0x40e9ea4dfab9bdc5, 0xdfc7bf5679d27f63, 0x382e15de129d7481,
+	 0x7c11dabdde6b8256, 0x15378ef83749157d, 0x1f14c0bb83f9416f, 0x5f93447167ff6d52,
+	 0x2fbb99adc78609fc, 0x7a4b8a3f841c95df, 0x34be3bb937ad6907, 0x779cf635ad87508a,
+	 0x6611371956153281, 0xfcee69393ae23987, 0x2a78a13408e54f38, 0x30d0f6725142f240,
+	 0xe4a113391d8f182f, 0x5fb913ca0bddaf01, 0x99ed00479cf31153, 0xa5ab3ae597a429f9,
+	 0x78c18a49594afdf0, 0x7c0afef754da8f9f, 0x0f4d08636e168758, 0x8bd5e41a2ed3b925,
+	 0x90df204e862d07ad, 0x8f25052fe2176f1c, 0xdf84af6f1d738fff, 0x071c757c08c6c2d5,
+	 0x01f8e176033b7e47, 0xd0431b6e38f1035c, 0x1f2cab6ff375f6a1, 0x53f07fba8f43e343,
+	 0xc94d3d0201001ea4, 0xe909068c407c27a6, 0xfba6f23cbd4337ee, 0x0f7bd8f39cea2ae5,
+	 0xc75c5c62902487e2, 0xb0a17fe683e292ac, 0x21d646a0714fef7d, 0x41cfbe46966fd464,
+	 0xaf4a643378596587, 0xc9747202bf96ce9f, 0x6a76db43f445ab7f, 0x846278e86ed981d8,
+	 0x819af3a7f986b1bb, 0xeb4a5e2913033d07, 0x913bca92c67e5579, 0x9422f65e8f0bab8b,
+	 0x07d9983ea11b83de, 0x72d4626d97e7222e, 0x99d8ff8b9f324618, 0x9d3f249e4744420c,
+	 0x6b7b8627e872f01a, 0xe2faeeaea7d6d877, 0x2fdb250c53896b00, 0x63569c22cc4337e3,
+	 0x743b2204ae6e8f2c, 0x4f1d28f95163ffeb, 0x07e52b3c150fffcd, 0x78284b388c94a1c7,
+	 0x0e681ce6b9024802, 0x42f5db3c76a403e7, 0xe726d93d651d4618, 0xb20e1964b7bb214e,
+	 0xc146c1a47e46627b, 0xc08ca3fe00122ea9, 0x5625754bd4c90fda, 0x99500a18fdee38e7,
+	 0xcebf13a74ab4d011, 0xe0e8eb2b628086cf, 0xdd3214ddb56694dd, 0x2236155d099b3c73,
+	 0x8c272e4f07333698, 0x63c7b3afed82b017, 0xb88f20edf7c03965, 0x84b5c9b62faa96fe,
+	 0x0e7567b3d631c659, 0x6a48acd946d07eb9, 0x0a7458f4bec5b58b, 0x6c6da7085a1f7a76,
+	 0xe11294d0a77c7b45, 0xb9b71494171d920a, 0x8a6afda05106dc1e, 0x364125595fcf1138,
+	 0x608286d404279fdb, 0x5635f8a5d1155670, 0x8047c36c85849144, 0x269b8afba7b648c9,
+	 0x6e91e8fb98d05e7c, 0x7449ff7120f47061, 0x118defc862c5289e, 0x1cbff048b3870962,
+	 0x8cd3563ff6bb05c5, 0x8612e591949c3003, 0xbdb6f7035ac233bf, 0xa293c5ce58c1ff48,
+	 0xe114b296f716e519, 0xb234915260035be4, 0xcc2de361963b9e7a, 0x2b92e94c2218b0b5,
+	 0xf48affd29aa6f182, 0x4c56a6fa5c68f4eb, 0x05d4ceb4a4e69b19, 0x26a2ff0065187a8e,
+	 0xdb7f986d58daf954, 0xb017b6ad260a0aae, 0x37ff23fc0478317d, 0x8157619e7b052255,
+	 0xd96cbd346d80fbab, 0xb811c6530e8bc493, 0x05b5c39398203a5a, 0x9c394f395f2055d2,
+	 0x8deab17a2700c5c3, 0x638de41443511e5a, 0x73b105aa5bb35a0f, 0x6b8a6a06abf31db5,
+	 0x97df0c905eea94b2, 0x74a61e77b6965c2f, 0xa2bdd769778155ec, 0x3b5d975174396768,
+	 0x31e44f9a2626cb2f, 0x72d3e90e9500fe2c, 0x53d64da0658830b2, 0xb61fc4e3ccb5bcf8,
+	 0x63ea05a78f7cdcd7, 0xa9a78516440a240e, 0x32bc9c990c7a204d, 0x26224b94f4e074af,
+	 0x69719dcd48099747, 0x508dcc44af7c95d2, 0x54ca82b3d7a0a63e, 0x2c3854d49b610a91,
+	 0xa4ff1ae4941a63cb, 0x3fc7d3983ca3caf3, 0x77dc51c7c935f31f, 0x77eb0e13ef48f5b9,
+	 0x955fb0eddf5376e8, 0x8619d85428053626, 0x0a58c24f4aab0f8f, 0x3df6eae8f616a499,
+	 0x6e649ce9c2ea81ca, 0x0ca1402b6d9f25ce, 0x5818335f11468154, 0x6a8e56b34aa19fd4,
+	 0xe1ab3528a961600c, 0x4fb2b0eea8425942, 0x9c4523d77c1b921e, 0x6fb43697d7a337ba,
+	 0xe6ff2b3e9ce074ff, 0x1a0997965f018150, 0x3951bd65a45d78b7, 0xa3c6c5dd7af3eea7,
+	 0x3134b50ec9dd1a4c, 0x6b1cedc11adebf54, 0xda2c26b22149bae3, 0x401b3bfaa9f3ddd6,
+	 0x40593d54ac299d5c, 0x43c5835a45600762, 0xf0b3e0d28d1354ab, 0x08524db0c669e172,
+	 0x17795b97af6c29b8, 0xd06eed81bac5f933, 0xd35dd96514e1baf4, 0x6f31cc8113fda593,
+	 0x7feb02961886211a, 0x2822ce41e549adbb, 0x5a0db21a7c0a6f22, 0x483414981f1ebcb3,
+	 0x4bc9a48f13a98bdb, 0x0194acbb4699fe7f, 0xbd805d8718fda865, 0x074830019f92f177,
+	 0xe813542c0e2db340, 0x87bf559c1dc09b46, 0xde8b0e7fc22c3681, 0x8906380392e5e684,
+	 0x8571f01a5d7fd255, 0xb5d2a15395720b39, 0x9e08a10280723c89, 0x21a9ed2d91e1b3cd,
+	 0xae46fc86f6eccd99, 0x581e84f55a398652, 0x633228cd04910a8c, 0x720a9b5832f47c78,
+	 0xb54ee8a4d535e404, 0x6e1d2cd72068edcf, 0x924cfc81302539c5, 0xa944ab3065851130,
+	 0xd8d5234ea5c2af56, 0x5dcc30cee34e8b47, 0x184f22135cd3354a, 0x2a9a6326422e4b49,
+	 0xbaf9973f9ae5ada1, 0x7486cb30a4fe7a09, 0x07ce87170094e876, 0x5244c09e604a50a0,
+	 0xe9fefe447799c6dd, 0x9eb5d41887ef695a, 0xfee9b5d8db33d255, 0x0413840aa13f69ca,
+	 0x6039d78dac98b110, 0x4731dc6dbe833da9, 0xd19e773973659c4a, 0x47fb6de3d8726788,
+	 0x72ccf7f7e771d613, 0x77b0069796687949, 0xfdce4b16c3644926, 0x7378eb7267e087d6,
+	 0xfbc777552ccb5fb4, 0x5b5590d30f3a6cfe, 0x1bf7e2f021c42cc0, 0x013a56b2dbc2b089,
+	 0x0e108933cd46281f, 0xb4e86391d499be4b, 0xe7d520e047f00cf8, 0x0591186e5064c507,
+	 0x032d78c6e174c259, 0x3da987b6eaa962a0, 0xddb3bf8591abfc5f, 0x4ac2106db8491e9c,
+	 0x65aaf45e44276aec, 0x58dda900e360f45c, 0x21d5deae04016f15, 0x9ec9946a1320bac7
+	},
+	{
+	 0x2ac8c3263890d6eb, 0xa8117e7dcf103936, 0x3b603e32c55413ea, 0x32018d8995782335,
+	 0x225e081957011a8a, 0x37c343617111aa9e, 0xa41d9525b232e9fa, 0x8c9f66e896698889,
+	 0x1666e1f74f643ee1, 0x9798f96d466a632c, 0x716ed8aeb13701ac, 0x15b20479f108ed75,
+	 0x987f1c0aaa95e896, 0x569e4f832725143c, 0xbcf6e9f6e0365fa5, 0x79671cac5c6bdaab,
+	 0xf1468d91e95b20e0, 0xd5d00c665fe08967, 0x3166d54546a3aff9, 0x2536a0750de535f1,
+	 0x7d9903f0788ac6b9, 0x3c1b1af10f39e000, 0xf6c0f366bddce4af, 0x31ced0b5e727056a,
+	 0xe512a3d0da0beb47, 0x0b7393d134396ead, 0x46985587cfc76bcc, 0x77b206728b75981c,
+	 0xafbcf275c105420f, 0x586e015f76b80f31, 0x9d7bab6d972996ba, 0x74dc5307da179fb7,
+	 0x28cb8010109e7fc5, 0x4824c25bb852a978, 0x0235c6a98bac7b37, 0x2efe01ac4beb1d12,
+	 0xcef2c1a91614e3d2, 0x24de4c5ea2e9a480, 0xd61ea8547108f8d3, 0x4f40e3baabd4c7d2,
+	 0x5a5e0dc84391716b, 0x0a23c0e523400ceb, 0x13d0737add2df222, 0x9e7e16841f635b7a,
+	 0x2baab2c918bc2863, 0xfffa1572305ef267, 0x51cce903fe83e22e, 0x0b14246196644549,
+	 0x6402f680fadf8719, 0x5d44e4137995a350, 0xd04ab3fa22891eba, 0x5009bc4514f0599a,
+	 0x072a56d290c88f95, 0x69879dbe6bb661ab, 0xf8a7c5c19427d029, 0x43cf0f918296d9f7,
+	 0xb3677e99b51e0de5, 0x6bd2f2ba48228358, 0xdea936789cdeabdb, 0x464b8825b2dcc9e8,
+	 0xda9228ec5f94b13f, 0x6f8a86bce9cba30c, 0x73382176707894d5, 0x5ebadfa7a610a777,
+	 0x4091834f439fc929, 0x80b9909293a226ed, 0x06d1e54e86f112c5, 0xa919f401ccfcae9d,
+	 0x48d9108840f93aa4, 0xb10dd57715252669, 0xec74112fb6f0274f, 0x7a4b0549076e42fc,
+	 0x6d1609cea1cde3a6, 0x9900fb13ebdafbfd, 0x4c538c642a07cc63, 0x73a31167664be4be,
+	 0x48bd4da9f6bd4c5d, 0xb851ab5286bc35dc, 0x2f25f45f58d912af, 0x2d4f3882cd79808d,
+	 0x65a0f79be9fe82ad, 0x252cb1da4b9ab11a, 0x14eec9db8cc1cdf8, 0x1d2ebd13a75ba696,
+	 0x9276b50f04fe06fd, 0x1e87eb02c9a3d1c4, 0x7f089ac17f429ae6, 0xa91437ea2714279b,
+	 0x9631cac959b3db3b, 0xf98358795a6e2f55, 0x0ca70b51f2965ba6, 0x2d2106150343dc84,
+	 0xb9f3960d1694e06d, 0x9702775a8a842485, 0x50e3a3a72ce91765, 0x4a1656a53b1c7b51,
+	 0xfc71b76d5e2d8134, 0x81bcd48a60eaabbe, 0xbaaaf76b4793b735, 0x18dab264ed401fc0,
+	 0x75cc33df41f2d121, 0x56ac9b0cb01861bd, 0x8fff1910adf22115, 0x9af1684b9b7f9b12,
+	 0x1a7ca1933d0f4b7f, 0x4a43dfa2c1e3c950, 0x57a4cd327cefa273, 0x74e0e728eb28cd59,
+	 0xb8a250b8f335c158, 0xd1a4c96cdea0c3eb, 0xa319770d97117ebf, 0x8a864485b091ec7b,
+	 0xa352a2035f6eb2d8, 0x4cc81eb691304540, 0x2e349e45b09763b3, 0x584ffa6b0bc33b06,
+	 0x3f04cf6491a5e7dc, 0x962e22a0eadf9877, 0xa2607d0f16f6442a, 0x4691ee88a97d34fe,
+	 0x9babf89a78f29d49, 0x0405be5a0ddc9fa1, 0xe933465229766387, 0x8d56bfc110026556,
+	 0x8ae219fd994f4bc8, 0xdee3ba0fc778c5af, 0x02875c1fd16790dd, 0x085ed1b04b769675,
+	 0xa31607c18dcb71e0, 0xb552b1c0d021105e, 0xf56c4035e5813f5d, 0x939f2ac586d8e777,
+	 0xd21dba330c198f5f, 0x6b682430a9fd947e, 0xac9fb8f527e57b7c, 0xa85beaa92417f597,
+	 0xb9e6455b32500f9c, 0x7a68a0de3164479a, 0x3037d6c9e9217931, 0x96bd26c3e89d320a,
+	 0x25694b301411a5d8, 0x2eef3e7afd9b5f5d, 0x2f87b6226246b260, 0x479beb14fef4416e,
+	 0xe1cdd93c3d029fce, 0x70fc9a8f570d8c5a, 0x9bdbb132b99745e9, 0x667f2e87c227d1ec,
+	 0xa0b782dc6188abb2, 0x957d2c12957c7494, 0xab0961b5c4dc3a62, 0x98aaa42e4bbb3ba1,
+	 0xeb9ecb4c400eaf66, 0xc71a50bdae197821, 0x318b13b09f166568, 0x5d79712eda3d16ce,
+	 0xd012506836bc868f, 0x6ec333a5f340206c, 0x60e121b12af94c81, 0x15c0b2b067a00ed3,
+	 0x898567caecc441fd, 0x496ff698e295e806, 0xbb666f570fe400f6, 0x265f29cb7e4de687,
+	 0xb68e82e665e46869, 0xe799f6a334c8c8e6, 0x1a9d0f8d5a6d1cfc, 0x95484ba06fe7eee7,
+	 0x12ff396228373ef2, 0x66c8d284cf4524f2, 0x2770474ba63d688b, 0x09c60e52f2f92f55,
+	 0xa1073a9877520907, 0xefc6bcf3e8ab3ada, 0xe55aff94e1d192cc, 0x85e149529be9d3f2,
+	 0xdf96441bd718f5e5, 0x6103dd9dd81a19ca, 0x50e066a531c981c4, 0x4f4ad9904fea0bb7,
+	 0x3c9d27ff758342f8, 0xe7bfb7c22006ee54, 0x4d69adf395fe8fff, 0x69862853178cbfbf,
+	 0xfaf63c547eb705fd, 0xf866531dbb11c345, 0xd182b26c6412e2c0, 0x8745cfd1b4b846d6,
+	 0xdebf81cb3131c05d, 0x3699bdf261b5e9b1, 0xa6c5b10874d7034e, 0x71bd905166bf79d9,
+	 0xfad6e5c8924b325b, 0x40524b99482b6438, 0xb0fd8fcc9d66cfaf, 0x15802b835cb0a86f,
+	 0xcbee873f0a9e1599, 0x93cbbdaab1afc806, 0x55c61d5024c4bd38, 0x8512c209cc502b0d,
+	 0x933afbc813c777d1, 0x7680023f487d5619, 0x894e518511f3ac8b, 0xb340396842703f22,
+	 0x419f3cff870e7b76, 0x3804ca49f60a7d03, 0xb4a191769ee48a45, 0x53e18466b9c0b5a9,
+	 0xca0b4e5e04582f2b, 0xc56612873dcca243, 0x0bd267decb5179fe, 0x261eda8ea43c3fee,
+	 0xb89343ce8ab659cb, 0x1f0e2abda775afc0, 0xa1bf155acc753ee5, 0x4b7426b73b344548,
+	 0x4908c0cab72be2a9, 0xeaa048ad7e48c870, 0x2ca12266d8e1b51e, 0x75db9135a59fed58,
+	 0x70689c8778f94624, 0x7d46358012df2b66, 0x292585f0334eccaf, 0x83b51a4554fa98a3,
+	 0x299bac048a1dc1ae, 0x1dcdb961121a0952, 0xc9c96056aea2b6b3, 0x012bf1a63c61fa49,
+	 0x3d8d26bbff9a0624, 0xbf9e3eae8622c656, 0x6e8af785ef1c44af, 0x1b6553b9d4ad95eb,
+	 0xe4ef37f39c9de3c3, 0xfc77acd94cf3f41c, 0xa8214e6dcd157dac, 0x454facccb2b6c0e8,
+	 0xcace8bd49d3dbd9d, 0x3c7116e2cda50fec, 0x7cc050732eca506e, 0x75180c2722312a01,
+	 0x60f8bd0c3ad98738, 0xc6f9453399138d5d, 0xd9f8f4158eac1ae3, 0x382cec3b0d7f2db2,
+	 0x6463feec3c8bdbab, 0x64dc842b9bcee33b, 0xa3e6c43761abbfe7, 0x85559a3d0b1f130e,
+	 0xca527cf183587ced, 0xf89c3824adc81a59, 0x9bd5d8fb8c02195c, 0xa19141e277c74cbc,
+	 0x2c731b1525ad3c11, 0xb670090152839463, 0x9501f0a64010993c, 0xad858308fdc04a95
+	},
+	{
+	 0xa901e7db4233ea06, 0xdf0888f3180302dd, 0xe705185fafc9b823, 0x1e4d60528e321c54,
+	 0xdc421cae7efebc11, 0xb199871cda84405f, 0xbaa7815344c63186, 0x43cb37c1089103b7,
+	 0x833e2c4a516b82d8, 0x5d35108eab858b8d, 0x648890c1392c15ba, 0x483de8d2655971db,
+	 0xa601d706de5a5a78, 0x39a92541457b9272, 0xbe1a48a53ffeb703, 0x70518ffa8aaf2b83,
+	 0x69349f9fa4c4dd7d, 0x98789f5745e00837, 0x65284e671dfd2236, 0x2750ece951481fec,
+	 0xcc827763772b8afc, 0xbf1f9f1001b9e4c1, 0xa5863070bc913571, 0x6d029e25eee2de58,
+	 0x91f47aa4df5cc2eb, 0x361b6f3d38a70c81, 0x32a013272b91d426, 0x7592f9a5afc1cdeb,
+	 0xabb0337beb6c19f5, 0x4a9f9fedbe248558, 0x3eb7db9ba5815b98, 0x4b13115376b774e8,
+	 0x63928b0335fd809e, 0x4a7efd5f0d24614a, 0x8b96e06536d1ccc4, 0x6b8cde068fd2d4eb,
+	 0x5d0e6d1c9e02ffd6, 0x4d2661eebaadb183, 0xff53bb0600d8c43e, 0x13e5e14ceb290b64,
+	 0xcc548b8838555ec3, 0x80880983962c5701, 0xaa6e16ad05c990bd, 0x0d482e5540e9b5c7,
+	 0x5520b02456b7f70c, 0x183214229fad6c78, 0xdbce9b3db8a63377, 0x8a17ff78c91f9038,
+	 0x2b2bb73e6ecd0bb4, 0xbff9ac46753ac211, 0x0aeeaddaa2b9a17e, 0x99bf0f7fb462d1a5,
+	 0xdf0c9a03ec4f89cb, 0x46cfecad3f45d7b9, 0xa5cbe673ee3df64e, 0x9cc0e6c2b7d5e070,
+	 0x8f9ac3b8ef5cd36d, 0x879939db43b4a1cd, 0x8e0512db84e0dc01, 0x42cdd77694f3fd69,
+	 0x3f61d22400395aaa, 0x572e5db698c31bcf, 0xef3797b966cf7ca1, 0xafe3567eb7b214d5,
+	 0x81e50e79544304b1, 0xa85cc10dc7d95b5b, 0x2f4ebf9a696b60db, 0x4b735bd284bd803f,
+	 0xbd8f578f27900d0a, 0x0621ffad4e723959, 0xd38bddb108001da3, 0x5994cfa6a44243d7,
+	 0x210227d57e93896c, 0x1908d15c335c0bcd, 0x8be4d06afb8c8f2b, 0x0b3af0ab51c86838,
+	 0x25cc65683e2548e0, 0x7fb4f528daf83b8b, 0x1a59c9e3f7e5b323, 0x0eb1776abe0e9265,
+	 0x6ecfa294ea9ef61d, 0xc39adafb13768983, 0x53747bdd5b27fcae, 0x62a57079257573e1,
+	 0x721a61db4ee90e77, 0xbde365eddc55ac23, 0x5e1f244df80b15ee, 0x21bcf0eb3277db02,
+	 0xf10d7c8a58fd02ee, 0xb796b492698c2c04, 0xb96a2e5f98d651cf, 0x68846ba03c9bda84,
+	 0xd88b383a1fdb89e4, 0x48c91d40b4f90cbe, 0x2f6244e016836ec0, 0x3abe6f8d5c0f8502,
+	 0xf65d458b6e95c685, 0xa67511ede0187649, 0x206ec4d323798da6, 0x2d2b09d03a8deb54,
+	 0xb0d6d6d3cd83fb4a, 0x0098dd99a5323d05, 0xb7d1f6170f0e5d49, 0xa7930d4dcfff4505,
+	 0x006608fb5938f540, 0x6ccb9ce707000fb9, 0xdd624614ff2bbb4b, 0x96d958306da32dc6,
+	 0x4eaed7b61c7f0cae, 0x620678a765fee832, 0x3c6c3ea23ebb80bb, 0x241de5f30a070601,
+	 0xa42089c66972378a, 0x49863cbbd4a850a2, 0x5acf085ac761c3e4, 0x6b854e0ce4fb67fc,
+	 0x8dc73e0402dd703d, 0x2dea32f42b2d2184, 0x07027e7ebf22db3d, 0x0bef3a2b7b7d3cea,
+	 0x79e2db85302d745e, 0x9fb979ce233b3541, 0x158b1dec9d82e1f0, 0x8ef194fb32910c4f,
+	 0xa47ebb9b382537fb, 0x9c1edba9a0596e55, 0x8ced5992c762ee44, 0x82ba77351a6ce75d,
+	 0xd79ba27c9dadc7e5, 0xf1c59c9fca05abf7, 0x829c8020fbb52298, 0x3f2e69a2f645b2a1,
+	 0x2e1597f91128814b, 0xb58f9548b48eec04, 0x1eeb0c57a6f29517, 0x3b3a5a4f61a6790f,
+	 0x165e59ab9ba69f56, 0x13aad0370c355459, 0x93de85a0c3f79af0, 0xaf562eb49b962b0c,
+	 0x3087ea24597b259f, 0x0ea820140f23d3c7, 0x6372c6c3a549c0ae, 0x6b364357ec05ebd2,
+	 0xfa4b90c388a1006b, 0x17137f6e7f69cce4, 0xb974562eefb5c993, 0x9e6180e646e6e268,
+	 0x3b4dbe4d8d05afd8, 0x133e6979705e52d4, 0x07c95cafa46ab6df, 0x3ac1dabb19f5f92a,
+	 0xdf5828f5ced6e22c, 0x5b02ebf1655e3c50, 0xed4c635b7e79bb74, 0x15f82833b9486809,
+	 0x3724c14a00b6526a, 0xac835a793abbd848, 0xf6f62b39313353df, 0x7425069963496e3e,
+	 0x073208078b9ce8fa, 0xc43dca0c817d2aef, 0xa19364a1c24b6aba, 0x98a251e6a0edb6c4,
+	 0x928c38a588617b53, 0x4288c00a39fd1689, 0x050cde51bbe2d77c, 0xb00257919d57ade7,
+	 0xe73bea14b956f068, 0x997182e2fa3d34a6, 0xcfb8aedc881c1e6a, 0x97655912394ab99f,
+	 0x1bcdc9cc202be895, 0xa9251f193e35acc1, 0xb0f068422e08b321, 0x7aa785c109f93dcc,
+	 0x265942f107137a53, 0x6125eb70dfef8fc4, 0x13b06a04bf9c734c, 0x7ab89e073ac282df,
+	 0x1bc03ddab10dd79f, 0xe4f838aa984d74d1, 0x1544068e56afc331, 0x57763d0fdda55c12,
+	 0x7df8e28133f739e5, 0x0676ea89530d266e, 0xb463e70999c9fdc7, 0x89f3c76756fb3323,
+	 0xefcc6903001e0031, 0xa772b316165c114a, 0x17b9cec686e8a85c, 0x3b6dbb6ceaf68ae2,
+	 0xf09f39f446c44932, 0x559fff9bb2ef101f, 0x88604824222c9e1a, 0x3bc7225bf5102f78,
+	 0xcb63b5dfa21bc522, 0xde7db26c11517dbc, 0x4f91eb5e9bbbfbc9, 0x894914c1d1b9fa89,
+	 0xe01395319f3d6660, 0x63106f00cc7349d7, 0xec076ab15998dbb4, 0xa2249faebabc9a06,
+	 0xd5eb58bd803e29c4, 0x8e59536b1751764d, 0xa64e6c793540e2dd, 0x0ac8f828a3ae5914,
+	 0x4d603a43d146bfdb, 0x7c49dbd3c232270c, 0x67c73b0f81b978c1, 0x3a5e462f192da08d,
+	 0xa1acd65cc3c6e9c9, 0x94a8e462cc3a30fe, 0xc77d56367bff8465, 0x4ceaa020ae6eab78,
+	 0x4ab9f511dd64e385, 0xa415636fffb01e20, 0x10ec3b16ef1cb76b, 0x8014d60904b07c66,
+	 0xd8a47e24f14580f5, 0xdb85bf5590d6fa7c, 0xe9e3f6f3f2f97c1f, 0x6afbffcdadc728f6,
+	 0x383eceb44d70d5e4, 0x47f18a2d16c08146, 0x0f359da7bbce116f, 0x943e3345c4a7c205,
+	 0xab53cb84b0e45e80, 0xcf1c23c7f7b21696, 0xa97bcd552b84833e, 0x59b79ca2100fbef7,
+	 0x540d1adfa2737e44, 0x216bb5622320619d, 0xf992e722ad26ef1b, 0xb3c4ce4faaab8866,
+	 0x603b370bcaedea46, 0x8ddb62cefa608961, 0xff24848832b9c1a6, 0x6407da5779bd6982,
+	 0xad2fefc25993cb3f, 0x886c63ba55d95e7a, 0x61d5516ba476937f, 0x2a8950ac9b6258cc,
+	 0x4f2a1371bfd4d895, 0xed05a03f688d7a46, 0x4b0510e7cc50f258, 0xa9693dff92f8fb5c,
+	 0x6481efb748b57f42, 0x1e4ac37e4fefb952, 0x90d1a2291ee96cc3, 0x0be8dfaf0cd8bdf5,
+	 0x123d21b9977d3705, 0x82cfcfb917595a53, 0x8da65bbf8227e387, 0x3a0b27d8a041ec07
+	},
+	{
+	 0x8bda1d70f821097b, 0xf5ca8af2860850c8, 0xe572e515a2a345e9, 0x070ac9b308c0b0c4,
+	 0x2dc34d2791a91368, 0x1a9e274f1dcc02c8, 0xd7af846d08553330, 0x2cd5016b4031777d,
+	 0x0c7d668edddd4869, 0xc31fbdc695023de2, 0x08f46ab8affd8889, 0x5177ffdf14dffafe,
+	 0xa473fe3862f952cb, 0x25a2ab452cf274b8, 0xd9d593ddce68177b, 0x8aebc300460861d7,
+	 0x35392da3b4a3651f, 0x322a18d124b52ed4, 0xd47f22b27d32e0a8, 0xa73b534d83fe89ed,
+	 0xa7b1603c2ddf9f9e, 0xdb3a1e649d1b619d, 0x7679ffa1ff036278, 0x8456ad0555d7a5c2,
+	 0x6f1094531105c1c2, 0xf78e65bc3fb2ef89, 0xd51f51c1fe2da1da, 0x51986ca3515aaf08,
+	 0x44a13c6bce2ffde2, 0xfbd7ddf51dde3da2, 0xc0f00ca5ad69d006, 0x88a7f9ffcfd43142,
+	 0xa0028cf13693c3a9, 0x26730235d4e965f8, 0x16051b0132261388, 0x1b256348f3b4a106,
+	 0xae10105658752ace, 0x2cdad1162a6f1d3c, 0x9de77235f9ae7a47, 0x2c0ad6dfb6c80d7c,
+	 0xeb3966564fe05b22, 0xa2a007baab63d92b, 0x63b29c3bd2de0513, 0x2ad74f55f508749d,
+	 0x38ff6c3e669dcb4b, 0x1f00b46923a3c1f0, 0x7e22f62ed78274f2, 0x4b00c9dc413dd1bc,
+	 0x638dc1d69e55972a, 0xe1ecac510f19a772, 0x8972299fb1065f4d, 0xad68d6bb57b170d6,
+	 0x959885c4e6df4683, 0xc016b65fba9859e7, 0xd1aa3657323067e4, 0x1b0133642d9e99e5,
+	 0x1e03448e0982b29b, 0xc0f2c6060676607b, 0x40c432bbfbe30131, 0x78a4a92db7d97096,
+	 0x7f4b6c7cf8d9cb37, 0xf7c12bebc27727d7, 0xcf15c694ecb92121, 0x441db7a17bde7576,
+	 0xf0ccf9129e11849d, 0x96c8053ed8e5d008, 0x7951b40e1a309d13, 0xa2e873412940b8bd,
+	 0x2436d6a71fca83d3, 0xae4e4f438af46647, 0xcc82e2d742ce3d44, 0x77b77ccf38d81a4f,
+	 0x5ad60659469d7399, 0x9e0f51b9e5333521, 0xb7fc5fc9ece06b45, 0x8480eeba2266e2c0,
+	 0xd6431b728598387e, 0x4ef2ed9e095b7d12, 0x7b658d1aee1aad44, 0x6dff5b921e9b82f0,
+	 0x3c73aed0a0fbe24d, 0x3d1afe33507b4911, 0x8953871068d5e11f, 0x9e81ad74e2c973bb,
+	 0xa2e7ea9336236a9b, 0x5948f9240f2879a5, 0xcf6b3a916ad1205b, 0x678ed3a90cf81f73,
+	 0x83e38bb06ea17f1a, 0x1443240787470c38, 0x8a1fedf8c3e8a5b4, 0x11b0d5982baec44a,
+	 0xe36f227e44fc66e1, 0x56f1eff2d1c183c6, 0x6a73f553e68e0636, 0x25d013626247e98f,
+	 0xa0cf2f481f3d4677, 0xb4ae409d94208366, 0xcfbe07cdb6643d0b, 0x82d43cbd3ecf28ec,
+	 0x97bed8df7db03bdd, 0x4f5c5028ea024c34, 0x948e1aa24bbea7b8, 0x4d585aa8704dfa9d,
+	 0xfeafab0082e975d1, 0x8780652c070b7c7e, 0x1755dd31fbdf482a, 0x348e5374b39aa1f3,
+	 0x1dcc7d09618aafe9, 0x0fdd60f5f0d4fa5f, 0xba02138abfb5762d, 0x2c91d550de8b0159,
+	 0x9e67324c759f4266, 0x4a4ab5d17b1857f4, 0xb3cd934df517307a, 0x57df5c597fb289a9,
+	 0xd453f6334c1dead2, 0x8647938a5d480286, 0xe895c2dba462a21b, 0x4fa739c3d7350cfd,
+	 0xb8895fdbd8393875, 0x1feba5ed6477e568, 0xc5e94ac8a7939991, 0x99073ac5f5291ab2,
+	 0x7a68ac6d00149212, 0xc1471e4e403014c8, 0x0c7bc51bbf3a3ecb, 0x21b8dff28b046f32,
+	 0xe91611fbb72edaed, 0x4883fec163b56a0b, 0x6e2a2f95b82e63f1, 0x5fd7c0c760cf3b2e,
+	 0xadfb3587bbcccb91, 0x42dc0bea449e4f1f, 0x6fb37537cf20f3d5, 0x54382743e7b1e099,
+	 0x3054a80e4f0e145e, 0x53a55b250fa16a0b, 0xd917326a2e553924, 0xaca12eea79625371,
+	 0xd5bd6b6b51405468, 0x3f230c1aa4135238, 0x1cfe7836fdeb9306, 0x6c8a07cae66d40e8,
+	 0x129ff02d9ebc93b2, 0xea18e330aaafaa6d, 0xf9ed37eb6905ae52, 0x96e5ae56358c8972,
+	 0x7c52cda7cc738d72, 0xd69ba12eb61833bb, 0x33781fdc9f1a8436, 0x34e596ba6e2b3103,
+	 0x7fad5cedf8221afa, 0x0687fe2f42ca529c, 0x23e53df8b42bd34a, 0x4c3def6e700768ba,
+	 0x0549265a5c58da4f, 0x31c15b9769ba33d7, 0xf0b04ac63beef7e6, 0x025e195871eef6a7,
+	 0xea0f0c0b5553bfa0, 0x5bd0e3b3a21e8bcd, 0x2dbb6cbd63aa4b24, 0x252497c5c6b1b503,
+	 0xa9c03155543a0c52, 0x8d369754acabdc50, 0xe5c0e5180f460a83, 0x5c8afcbb991858f4,
+	 0xf667127983416e84, 0x7a6556655954c07a, 0xd3cc1fb96da1210b, 0xb1d82b2017628fd5,
+	 0xcfc2d95edf09406d, 0x5894db3e1723b05a, 0x1c85d4d9822a3ac3, 0x1eac4db990874c24,
+	 0x2364feebca2b7f79, 0xcc160379e9e74c0b, 0x528c5e9dd675b6eb, 0x50c5845118c72f7e,
+	 0x8aa6f0e47b54c838, 0xde761240d4d0873a, 0x8401ae8821a7aa39, 0x533be3b6a805d8c6,
+	 0x8489f433a26c6f83, 0xb060cb7fb7893c5d, 0x0b8452ec41bad309, 0x7d1487debbeb53a0,
+	 0x6659010aca31dabb, 0x0a163d511ab5fd9e, 0x62c7ade7237e31ea, 0x3e71d86b10c5c61f,
+	 0xb2e1946ed395e94d, 0x7eb6aff007b1ee44, 0xce54fe850debc68a, 0x3fa8eadeaf5b4d54,
+	 0x79b4964959edb62a, 0x97925465dbbd3a1f, 0x22e48215fba73513, 0x5361bf1481d55ece,
+	 0x468a518313691384, 0x658d8c7fd803979d, 0xea7ad0c865a41179, 0x8f2c73627ca70a99,
+	 0xae23197e7fe94733, 0x0ec8a20d98ef4900, 0x24cb0f23282d731e, 0x54a55fb81cf416b0,
+	 0x6b48615b6bdd7584, 0x7122f7090e82f2fc, 0x1c2cd10957bcb116, 0x3473fa9e64371089,
+	 0x604967f7ba4b81f1, 0x87340c70731b207f, 0xfbc35e71ec423261, 0x00485c556f07a9bf,
+	 0xca7140cbd195c707, 0xeea41e40c98753fb, 0x0d24db8c0db58c99, 0x529db1e3d126c117,
+	 0x39ced3aa562312d5, 0xb031bade1cf26542, 0x9cfece59bf6bb288, 0x01fbd3d5e2c95408,
+	 0xde6b038f87c79dfa, 0x978efb3149d081d1, 0xe12caab91caf50b5, 0xb55c894637a62d36,
+	 0x1520536b26ffdb6a, 0x5b0c2c6b3ea2f9fd, 0xbf4e78b55f896138, 0x18891af88b411dc9,
+	 0xdce34084623c6610, 0xdf5929d7fb36242e, 0x41dbed120d0f2388, 0x1eacce715e256ff6,
+	 0xd68cbc51a4b9b5b2, 0x97d86593c7baeadd, 0xd33b72a1e62835e6, 0x6e1f46c665e6c89a,
+	 0x940a79f102e3079a, 0x125f5e101d957ed6, 0x2d2a6111f11f588a, 0xb5aa42c7779f4d95,
+	 0xc6923c0999de3cd5, 0xd7d175ae9f979e78, 0x4a947f194e2d0907, 0x032882954a5224c0,
+	 0x62bd8a34ef8576fb, 0x2d2bfc35a3ea168a, 0xae4799ff62a9bdff, 0x1f7d141fe0c6c91d,
+	 0xca87fc14ff014fef, 0x92bf89df9220e860, 0x0e08a42404e41c45, 0x37217c8a6b489abd
+	},
+	{
+	 0xe0ef0f3b8b0dda03, 0x5b08f02d2bfda707, 0x65bbb6267c1545e0, 0x2167d5a770169329,
+	 0xb4d0339d76942dfe, 0xac9c679bf036b163, 0x5fbbb574d3c69a90, 0x5e3b8759a941228d,
+	 0xb91ad0cc1da52060, 0x70174fd6295292b4, 0x2287747ab7b09298, 0xb24e59c0b20c7363,
+	 0xc20ac2f61a7909d8, 0xcf314fa2f67ab8db, 0xf5d835fb0521b1e2, 0x643c42cd4d08e860,
+	 0x7cf8381b1d306c37, 0x37ca2695246e9c59, 0x66def9e81bb8b65e, 0x7d0846bebe9d784a,
+	 0x7f17a66385a64289, 0xa85ffafa2463a3f7, 0x9e410bbc66b0f8e1, 0x48017a279913e6ed,
+	 0x7641c771bd1ac19d, 0x77952790f54f2cc4, 0xebf6156638d100ae, 0x14bd776674da2bbe,
+	 0xd6ed384f589cf068, 0xb478937ab4af2eb1, 0x34b549d0b34f17cd, 0xac4f302e268fdc6e,
+	 0x8a70d0ea9f4a57ac, 0x68c7707935f999e1, 0xa235e7a59fe8f8f5, 0xa54f4940c99bdd5d,
+	 0x841426513897d370, 0x99d330b5f17ad604, 0x68bf6f9ae5e07324, 0x4a2a6d515ca2b303,
+	 0xd320f07e37fd9fd4, 0x4cd01746ed43d8c0, 0x067d714ab02df03a, 0x94caf0404564dfcb,
+	 0xe76f4b3ad6f8825a, 0x098d6dbe00168ff1, 0x305c3015eda42398, 0x42002373f369b101,
+	 0xc2e05fab45402f4c, 0x9d540d6a98352203, 0xb8a5a60fdc25b0e3, 0x4269d60888dbaf38,
+	 0xc61e867073d645de, 0x12498ab3208bffbb, 0x1e02a62587fec5cc, 0xa2821201f1e31bc1,
+	 0x2ed8de1797c7f096, 0x32fbaeaba395385a, 0xef9e2478fadab511, 0x471b69ddd00b90ca,
+	 0x724d3185238961c4, 0x78ae3b9f569efa7f, 0xa1ecff9e5b4ef82b, 0xb1498169bd37a5b8,
+	 0x95670dd9ed0e2deb, 0x4ebca6ed3459450c, 0x8fdbb6277e9131a0, 0x0750b2ee8946e87a,
+	 0x3843b73080fe4c6e, 0xec0529e454771dac, 0xa313f874b82e409e, 0x8109c7a34f3d2d58,
+	 0x54399aa51f7890fd, 0x58326ceb163cdaaa, 0xaf19a1534efea110, 0x50c0b739ca89fe8d,
+	 0xd6bc2b12e91ab1d8, 0xeeaf462433981c0e, 0x712445ee56865985, 0xad0646e8b3938055,
+	 0x493103ef46cd13b2, 0x1e905962b7d8f274, 0xc4409c5eebfff02d, 0x792538cad8029d88,
+	 0x99ebb9a29a458386, 0x6d6e3d4dbbe3c5f0, 0x9883cc9d3d4a6983, 0x0c42cbf81057a53a,
+	 0xb48f10e9b358a4af, 0xc372d585aed39c8e, 0x8f90f24fcfa44705, 0xb3b1e2ada1908333,
+	 0x8a7882c12234bb0b, 0xd1e73784fe395bc5, 0x1d22094db8b56357, 0x0267d8f1940afe23,
+	 0x234af80275703d10, 0x27230411a5e52438, 0x8a232eb504a81ab1, 0x9d7285109557ec2c,
+	 0x5b070b1629503988, 0x2918c9d4e6e43a33, 0x6c8f15614620e6c2, 0x35ab59f75612a9c8,
+	 0x019d1c5077f5d0fd, 0xd6965537f89d4281, 0xc07a8ad17e681d76, 0x2f89bcb82fb17885,
+	 0x792622e44f7f73ae, 0xa4c22bb1cc1c946e, 0x79dd6a4ef4c8efc1, 0x57c457fabfa3f850,
+	 0xd3297c60cdb314e4, 0xc08b1dbffa70e0e0, 0x7d1fc3114186d338, 0x3d4b4bf52bab8cc5,
+	 0x2139a54927562c61, 0xa844daae87dbbc2f, 0x2f670f63b0102d07, 0x60ed79cc4f672d1e,
+	 0xa718bf65153109d2, 0x3d307e35c46f2f56, 0xc07cd12b9419bc73, 0x39831e1d057bdd85,
+	 0xd88c7d6c16138067, 0xf3553e1113dfa3a8, 0x0c71bde0b8d2fe9e, 0x17ad6096fc474f0b,
+	 0x78cd831b81773755, 0x4982d94e8d22e07b, 0x5e0dccac7b2665dc, 0x80b735c3821ef103,
+	 0x2a44ad1ee2a14576, 0x1074aa5c27a68396, 0xb7e4272f93563f0e, 0x8cb42239e4a48c9e,
+	 0x04bfe77caf6390cc, 0x7b13b34481a6fa67, 0x1c37abe7deb7a16c, 0x23b704e763206e63,
+	 0xe1b750205866aa94, 0xc67068fc91bab1b4, 0xee1b1b17d54359db, 0x821662233f45484c,
+	 0x33ac63574e05667c, 0x4463735def5e6bb4, 0xfd9fbbe1124eba8a, 0x97574e42bbc2ef06,
+	 0x55b14f29ebc24584, 0xff1ffeaece4cf60e, 0xfa150f894613e0b7, 0x1451ffbdb678a000,
+	 0x4b7d1140d2b2a6be, 0xadbbf326d2f5c8f5, 0xc37cb15634942ddd, 0x899ae3c51daf011e,
+	 0xfa2c0f30a55057d2, 0xb47cd759e9761783, 0x24f6dae96c6d87df, 0x372f79b0541575fa,
+	 0x52cbfee8ca21c458, 0xc6ab5e58aa2e63a8, 0xc5a3cf1841407a42, 0x2fad004b813e5a5c,
+	 0xb6dd255cd6b110c2, 0x5fb09aad8d700bad, 0x645d5f39fc08f8ec, 0x2e0c775049d75937,
+	 0x24f15773fe294047, 0xbce2d442f22dd3b1, 0x25a519185320bebe, 0x65e17f9788e66d59,
+	 0xecb7c6065740d7a5, 0x2d45fba2774f91d1, 0xc95ca8417bc03978, 0x32ae64f31598dfc9,
+	 0xa7ac0903869f3ed4, 0x378a789d6426e9c3, 0x3b155767d566ce13, 0x044a96c5b9b9f340,
+	 0xd68f9b628504bc1f, 0xd08cb30a87350987, 0xc6eab48893903f19, 0x8f079c7ea690df26,
+	 0xccc6dcda0c76c478, 0x701b05c4a250e60e, 0xdc56ab1bb4bde5cd, 0x0b4ba11a919c6e13,
+	 0x16cb76ed75cb390f, 0xed5919b92edaeb3d, 0x53e9dc12cd81dfaf, 0x77a7408426792b8a,
+	 0x3f5cbd7c7b1810a1, 0xe73bf13482fab7f1, 0xbf80c885dabc7956, 0x9870c232d1de3962,
+	 0xa08747ecdbe580f7, 0x21a665a62adb885a, 0xa381ac012abb20f8, 0x7c8eccabfc19c329,
+	 0xa2cde9e843deb9ad, 0x2db255b63d04d0cc, 0xbb060c92973070da, 0xa75973ecaf20d4e3,
+	 0x9943c15618a89a91, 0x918d817bb9715535, 0x5feb41c0f996a0db, 0xb2b76ea1592a2341,
+	 0x8d83abb616464b14, 0xdc603cb31ed0d0fd, 0xfcf88e6adb75f236, 0x71ee6722a975eda7,
+	 0xeed652db9fb39fd5, 0x30a84efd22e12d21, 0x235a3c093d480bfd, 0x86910aef93638856,
+	 0xc17c2fb7da0ab85c, 0xcb4e6776bd7fe852, 0xd6976734599dd50d, 0x06ab764304ce4e6e,
+	 0x64737878a3210565, 0x46946ab16999bf7c, 0x198cc025c126c78f, 0x36ffb203ab03b64c,
+	 0x23b183bf59f0b729, 0x24041b5a35f566f9, 0x2d2eed1e1f7c1231, 0x4c681e464e7e5dce,
+	 0x1c82478b7293d706, 0x1147b3d0963918d9, 0x0f2a6f21c051ce35, 0x85b790402e007c71,
+	 0x0a618a7f3ddfe963, 0xa90b8aa8749b836c, 0xedbfaa4b102c730e, 0x69434c2e86cd5f79,
+	 0x9f05dfa6b75c92bb, 0xd4a14b917badcd5d, 0x593fdbf74dc34517, 0x5fc4042336e48a29,
+	 0x8d488c1b6f430543, 0x139847e1ed27dd45, 0x57cd03669ebaf016, 0x54547ba3eb8e1861,
+	 0xda74476e121c8355, 0x7c16f3f92d519b82, 0xb4d6abe5185f81c6, 0x6966e0f00dbe5abe,
+	 0x78c5a9aa4786c7af, 0x7f431a556aa45687, 0xcacf90a5b359488e, 0x2d6d0d5e34c504fa,
+	 0xb4500c094becf4a7, 0x983b7e64fbf3836d, 0xdb68aa1b84ccce58, 0x4c08623d3155c1ce
+	},
+	{
+	 0x533e4efe94d0185e, 0x4b11b49f68d7d690, 0xd223d1628dae6577, 0x721b4a245ea067d7,
+	 0x7b39106b0d24e559, 0xb6388253fa940ee7, 0x2446846a393614b1, 0x2f6ffdd915bf66aa,
+	 0x842b050a68f79d35, 0x7f08a316c16f991d, 0x2940e78542d2890a, 0x63013c44fbe47c67,
+	 0x67a87edcc247f1ee, 0xa10960ce834bee54, 0x3cf2ef1ba75f3320, 0x966bb8ceb2d093d6,
+	 0x7c6e9e6315e68f46, 0x49687cd2000731f2, 0x7df50e8883b8179e, 0x56d300af601d57c3,
+	 0x8452c61788e7c3b8, 0x56f1b678a6aaef2c, 0x512a97e9300ae1cf, 0x76b4cd03faab0aee,
+	 0xe6443238a7b73695, 0x6ccbcadfa8dce51c, 0xb526a0440ba285c8, 0xa36e01450c03c335,
+	 0x840b67fa5cb44dfc, 0x4a2dafc71ab5aa06, 0x267ef91e60557873, 0x48433d4f15e63a35,
+	 0xd9dd74162d1ae9dc, 0x1199850b1c88d7aa, 0x624d5662cb6971e0, 0x7adc432710f1176c,
+	 0x392a816caeecb1dd, 0xffdd465a9a681433, 0xbe836d8674c9c214, 0x1917e2b62c504dba,
+	 0x807ba14c209e46ce, 0x95767afb4cae78a6, 0xc4eb96eda61c9e1a, 0x925b88c3adb4728a,
+	 0x1baed827e004e1f7, 0x66a22bda9643fcfb, 0x0aea474e3662f5ca, 0x7e516f526e3c8ec4,
+	 0x98578bef7b51dbb2, 0x5678bb5856607e84, 0x54e521ac943ca61c, 0x37ffbc36658bedb5,
+	 0x80cf391787f88a90, 0x389bc6d90939b586, 0xf70a42e6bdf32087, 0x91a9c4482c9b77e6,
+	 0x4c1a658299030105, 0xf7ef2df0e206feb5, 0x509d68a23adea1e9, 0xa4777a50f4bef325,
+	 0x68027306b464e46b, 0x37d03ad11ed71282, 0xb619978faed8f33a, 0x3be4e3418f7ed483,
+	 0x4295816e38da44c9, 0x57c5aa841cccf277, 0x09135d112a9d0c4c, 0x8a8a0396c4de8b7f,
+	 0x45af80dee5f5620b, 0x92761ecaa4d5fbe9, 0xb7d8a67abe3418d2, 0x02cabc83efa5ef0b,
+	 0xf489e865d05a337e, 0xc2850b761e63e4e1, 0x9ab7ff668eb8fbc5, 0x0ccd2fcc5505513a,
+	 0x3549ffc54c031f45, 0x545aba383ef542e0, 0x612c01d02b85ffd4, 0x09d93bcae8e0e560,
+	 0x0e1b20ab75e70789, 0x1dd1b1e976d9382c, 0x34f23ee32dddaa2f, 0x2ff816e0d9462441,
+	 0xca8b7b297a1010a9, 0xa02950e80e79ce9e, 0x5781c737113a6dad, 0x3f52cfc12a3c95c6,
+	 0x23b6950d470b4cc4, 0xdcb3de142d1df2ea, 0x2cb6cbcd3c0a4719, 0x5ce33dba7f07c030,
+	 0x29161cb272e2cd64, 0xa9941e692794c66e, 0x6d9884c993367748, 0x771c43eb161b4d53,
+	 0xd02cd9b561d793ec, 0xfe4ce295fcc1f583, 0x93c84d26450b7657, 0x51cf8397cc3007cf,
+	 0x735c74c034de2af8, 0xe2a29569ec5f357a, 0x5c1c4cd6d236cec3, 0x1a266a4069f2950d,
+	 0x44ab56865eadc196, 0x421ea32986ac59dc, 0xa8b5e1e6146883d1, 0x521659367897006d,
+	 0x718444962492ad60, 0xf1190f4f6e7ad544, 0x7fe0de6dc1fadb5a, 0x510cf5f128410370,
+	 0xde06a505b85332cb, 0xbc5a27810ffdf389, 0x99e4cc88fdabd22c, 0x4bc9d8933f5c38f8,
+	 0x6279dc81bdf7c02f, 0x4f05ba842aa4630f, 0x5a68c30638e93d53, 0x7cae1e025fa4c46d,
+	 0x0bbc2ead9e2cdce7, 0x21fe9767e41bf7a3, 0x050c6a07ed45bec9, 0x935e0c597766ac61,
+	 0x7620b3a726f35f24, 0x8d1830f29aa1505d, 0x6838c446b8ab3a3a, 0x6ac5a625b3fda31b,
+	 0xe8cf488ec9d32ff0, 0xd3c20946f6fd2f74, 0x0536f285c1a00b90, 0x50ea7242ed39b155,
+	 0x69638ac9b3d5beea, 0x97d67f418e70e4e0, 0xdd860ef2ee2876e0, 0x86fca81d4fe80db5,
+	 0xb170c539dc82ec2b, 0x49571f1acf18a4f7, 0x43847015a612011d, 0x9be76719a1e5b7f1,
+	 0x554d9ddca71d0791, 0xb99baf1120e1d220, 0xb2d83bc60765be7f, 0xb4a2ac3af2a611f6,
+	 0x150d5ed9be972417, 0xb754e460c3e3dabc, 0x88b0b870639b5541, 0x86424f1099abd4cc,
+	 0xf8e0b4ac80c922a9, 0x14f056024f52cba0, 0x3e008a730efcd13b, 0x80e4191e6e95b16b,
+	 0x531c381eaec5b808, 0xcc411b765afafabf, 0x14e6f4c9c82b5ddf, 0x58970fc262b3095a,
+	 0xb5097fcc62528fa0, 0x6e5a08eeeb76f105, 0x9b6b4b91bd8edd8c, 0x903b2bb37c53d939,
+	 0x7ca120c1175c014f, 0x73ed130857a8b15c, 0x02c8f6243e7e723c, 0xb2989d042473400e,
+	 0x5f0a79309df78bfd, 0x26aecb845ec15f7b, 0xdc2241c0d07d00eb, 0x3b108e94efed6af7,
+	 0x811e70534df81021, 0x7af964d874371658, 0x556e308e5e70b9ab, 0x454a94b877cbb4f3,
+	 0x4e4ceeb8725fde1b, 0xe61b106094f30cdf, 0xde04ca091cc5de84, 0x5401582b8068123c,
+	 0xc5fc035e53856300, 0xa7cd5686164a348d, 0x0b00842bc6706bcb, 0x345e7656bd5fab92,
+	 0x3c620b8c97162594, 0x62424bb206aea845, 0xe49d2dd9ce627fed, 0x5c6ac87be63f68a9,
+	 0xaa01e5d52f5aa391, 0xbe226463b56c214e, 0x15df21a2c79112ca, 0x84b16adead6d1309,
+	 0xd372bf3a43a229f2, 0xc17f43b0352f32bc, 0x479872daa6126921, 0x0b908aef2acb60eb,
+	 0xe917c5e2c70f3351, 0x451272ae9f868c5f, 0x1b1013f9d25ea1b3, 0x398dd22d902e3e2a,
+	 0x115513b8f863f3df, 0xeaf1cc1013fbc182, 0xc91787b5bd37a063, 0x063eeeeefc13aeb4,
+	 0x368857d347f552be, 0x5e3e514e80bba0bf, 0xca1d8f1d94a404eb, 0x2233ec2d115944e3,
+	 0x71420aa75d0eec72, 0x825b6a0943763cf2, 0xc46e3a42fcd983b3, 0x28bebf4216a26389,
+	 0x41d96a609bc326b5, 0x943dd34f3e50d529, 0xde4a184d25a8d10e, 0x590fd56a1000a0df,
+	 0x159531b6ecf09001, 0xe551a3c36923c9d4, 0xbdfa948c0245910b, 0x83807adb58a7703b,
+	 0xca48b59b28a0f663, 0xd075238048d97d92, 0x6b3fbaea5d2fff4b, 0x12ef16cbf23227d1,
+	 0xde2160a6d12011a0, 0x24bcc70359c970af, 0xf59bdcadd248f1cb, 0x1f1a901af70d9147,
+	 0xec7610afc9a42afe, 0x9176b3f318b06074, 0x6af85754d0d817d1, 0x389b6cc1a8fd2b87,
+	 0x87d6404206eced04, 0xc9bc282c59d9995e, 0x44c1c2d6a38ccf46, 0x26d268ec1fac837a,
+	 0xef4e7f736bd0a5cc, 0x8128d14ef1124c3c, 0xfa75674898480452, 0x242dc488362cddb4,
+	 0x4fefa41f05cb62d9, 0x6f3a1ac8b80aaec8, 0xb2b87806c17a6e55, 0x0a27c975f23c0fe5,
+	 0x0ac009e6e11f4f2e, 0x35986fc96d26b8d0, 0xfaa799368f7fac92, 0xa20861d3453fd39a,
+	 0x187507ff767bab5e, 0x6487ffe31be2530c, 0xd68e5b82e915dea7, 0xb221c74041de1689,
+	 0x0b2bfe8a7a1358b4, 0xa3df4c144fa36d6a, 0x5d17997f35115a1e, 0x7e5f959c5d55f69e,
+	 0xaf0cacae0f833e21, 0x9299911596d8b782, 0xf705e06e4162d016, 0x2653f2c77efa8a80
+	},
+	{
+	 0x7b3acd94b5140626, 0x3e1ae8cb6c7bd969, 0x86c80481e7edfd5a, 0x72b449afdbcd3d5e,
+	 0x49f66a16fb0d7b6a, 0x019541f23378c0ed, 0x5a89434b650d064e, 0x37408c3d833e9bb0,
+	 0xaa8ef8b3ef9cfbac, 0xb49a191cda380690, 0x34f5709da54c0fce, 0x696f8ec9cb3b0711,
+	 0x41556c40049d79f0, 0x132026eec00c8ea0, 0x26e143a940c0cb22, 0x44d445b6da2a59cf,
+	 0x2b2685d01f664528, 0x5024838f70f0b0f6, 0xc303b7bcaae96f04, 0x7f2a4b9eb2ee5b9e,
+	 0x1ecf735bb002cd18, 0xa675b8ce4a30ffee, 0x1eab3831ed037b5b, 0x9995c8dc3633929a,
+	 0x4c6e0cbc21525ebb, 0x82efcc2467baf407, 0xfa9c443072cbcbbc, 0x0186a8059dcb93c5,
+	 0x51140c4302949336, 0x224b2c67570afc2b, 0x972413878cf4e026, 0x7b98844242b073ed,
+	 0x4da33d207e9e4738, 0x28783069ec07cf1a, 0x6260006e2f4ea573, 0x5d54fe383e9b553c,
+	 0x2e4dc08511ca9bcf, 0x2a28ec8e8b2e1a10, 0x93bd3f57416ae041, 0x8ca5910dc3345a13,
+	 0x6d32c7ae8a4c00a5, 0x1572337c4a6e7066, 0x076170fcfb24d1a1, 0x7649f69db80c8ab6,
+	 0x5c5fa71832955eb5, 0x18adec1e2dacd18e, 0xa5495c3e7b20f8ca, 0x89ce637a0de5f8cb,
+	 0xfd143992d91c7fe6, 0x0febca51627983d5, 0x2afa92ee58902ca3, 0x3e36e94c08d19fa6,
+	 0x9a3d2e11c600b4db, 0x0333a6c8e0e8ac77, 0x8d6c85825e4954bb, 0x03a8f588695df147,
+	 0xf1cfa8fbbb718fa2, 0x899faea8d16ca7fa, 0x86740f2afd956e3c, 0x45313162374925fb,
+	 0xdc34caa359900476, 0xa036a4399206028d, 0x5e92eed12a1d95fc, 0xab652ba3c6a31e86,
+	 0xd070102c7eb2729f, 0xc97d642de6c1fb77, 0xa811544752eca66a, 0x3570f67c30c86abe,
+	 0xc3149341c24d2b93, 0x2d7296e4bfe36a45, 0x3a2a99bb8b6a94a0, 0x5c77e80ee4c08034,
+	 0x490da343cbb2011e, 0xa8bb35cfe3fe34c7, 0x50c74687bf440c86, 0x534e113c39e8ddd6,
+	 0x7cd088cb66fe86f8, 0x25660f4617170a8e, 0x490fb51f69ce4408, 0x4d335e42c6d125ca,
+	 0x24fae7fed78023d0, 0xdca05eaea44cbf42, 0xea07b608130044ea, 0x072ae10bc740799a,
+	 0x7fbc013e4aa8c827, 0xde649f35cafb12a8, 0x4784cd231fe4aa77, 0x8cf4aec275f0c6b5,
+	 0x4ebaec3493433851, 0x331d082e80180556, 0xc04378f7f73e5314, 0x2d9dd4904c3f997d,
+	 0x41da0b2a812fad99, 0x57ae6ade25423319, 0xf6b6590c7beae3ab, 0x8e12fb8e179ab51a,
+	 0x8b921adf585b0f9a, 0xb8f5d41358a57722, 0x4becd2aba379a106, 0x92dd979b65d17d5f,
+	 0xd0e2484661334ca8, 0x620128f9cc16b4de, 0x807a609b09b6e7bd, 0xa67c05760d0b2a95,
+	 0xf294a47bcb9cf991, 0x9ab8d9a2a5d829e2, 0x8550f0ab215ddd99, 0x400bce7f88bb45b0,
+	 0x1400681c22eb5871, 0xa55c83c75268c56b, 0xdc3df75ce0ee7062, 0x551fc94c0d7c7c6e,
+	 0x72ba2ca35df5c480, 0x9e6f215f6fa764c2, 0xcdd811e83a92d943, 0xa6e33069f4e1138c,
+	 0x54a715d7520d62cc, 0xfc5df29eeedac426, 0x4abd2b9b93c1221d, 0x3a1fbe962fb83443,
+	 0xf68a70901ebab1da, 0x6bcfa2651722c6c9, 0x6cc001300bb8577e, 0x9b3b28f051a1d134,
+	 0x0c6453281ef186dd, 0x1c4523cb3e9b4cd0, 0xa726be10be52c376, 0x791cfea85f4e5279,
+	 0x5016f064790a6145, 0x1dec584c9b7b7f69, 0x060d7b2f7440e1b0, 0x15e993e8269e137f,
+	 0x6547c793ded6cf2e, 0x1652e03a4c7291e6, 0x1761bbbd18f7937d, 0x7540ebf61fe5cf63,
+	 0xf7acdafaffe4c71e, 0x314d21fb573c786f, 0xee49ec02c021c05b, 0x3a67b483d63b2b1c,
+	 0x23ba385f0e512233, 0x4b655676e78dd91d, 0x698d096dbdc6123a, 0x90fc85fc95225122,
+	 0x9fa460cdf59c7ad7, 0x79424da9ba1f29a1, 0x5c25406715d50eee, 0x6eb854f65da929cf,
+	 0x264fea997c1ddfeb, 0xb92580c24a4aa85f, 0x384ed7856b6d8df9, 0x0ed26adc9bd05009,
+	 0xaf9b0787660eeda9, 0xf9b325fd512e7a41, 0x71b7a79a336b9623, 0x84bb00c8c7dc0eca,
+	 0x5826c620007bdc13, 0x987352c1f06ca818, 0xd3a9af18999d2d9f, 0x6766bd554e8de7de,
+	 0x97dd72a3e1940799, 0x4d7346367f338ac0, 0x0d188c8063263e1b, 0x18f58a871746a1b3,
+	 0x25cacf4c76caf9f1, 0x28d5e5f1359f5b05, 0x2b192f244304d850, 0x40235926a02c21cd,
+	 0x720c1a439a94e17f, 0x6c87628ea1f6e8e6, 0xfe693d606619a843, 0x016d761514647bb5,
+	 0x1f075c544ca8c03a, 0x82f8199ad8f1035f, 0xf5d8934a331afa77, 0x37c9b26f9701fd5d,
+	 0xceb2f23e9cf6bb9b, 0x77e374d7233ddcbc, 0xd5c5cec9094d5725, 0x98a06994ba0d8d85,
+	 0x953ff7b933ee8f71, 0x97a44929e7af3581, 0x0586b830c2ec4865, 0x46c94770d7431786,
+	 0xf5f0f6128c407ad3, 0xb818c3cec7989399, 0xf97818b22320f080, 0x72a3a3dc53175622,
+	 0xf43e8957a773fc67, 0x7b6461495e4eb5c7, 0x38c0b2d8fc719a62, 0x79ac8ee6c290cadc,
+	 0xd114d7b9557f3709, 0x5b6f9a233bbee114, 0xb122bb9cb329d7f1, 0x949a813586c51ffe,
+	 0x07714a936d545f40, 0xf50e2a0c2e9edb8d, 0xd300e1687933dfc7, 0x7b6fd3eaf92b8f74,
+	 0x68eb6ccebbc56984, 0xd8574a47db4c74fa, 0xffa09c77a8c00165, 0x090aec6bfa4f3307,
+	 0xd2825e462311711b, 0x32c265b1b6afef98, 0x1f09c1242dcc3d1c, 0x6ab413af43ec350f,
+	 0x717683d371900821, 0x0f491a3c41bb8ff0, 0x6672ba7edc880053, 0x89997d4585fcd968,
+	 0xca1488801714fbb3, 0xb71100ded2c20a54, 0x72293270e529a297, 0x9d86a07839e4963f,
+	 0x27f73764751445fb, 0x56af56462148a57a, 0xd6236136637654d7, 0xb5e9560ed2c345dc,
+	 0xf29f1db1e838a19d, 0x016ec666424f4373, 0x608b93f3fa5581d2, 0x8a702fb7dd69c908,
+	 0x1d8f4f83381668a7, 0x75167b2de38864ff, 0xb150d7ee3d7fcbe2, 0x06b4179f54c1cff7,
+	 0xc63f179cd4570cb1, 0x9ba9469d15dabff6, 0xfa6faf809f348eb6, 0xb37675557dddb3d1,
+	 0xcd14ce7afc7733db, 0xf05b7868c83eb6f0, 0x845ba76843dbb14e, 0x48792fa1f06920b7,
+	 0x01a98c8115a3a729, 0x908a78ca018c2e65, 0x753b28e8c8604568, 0xafd1c8347de283b5,
+	 0x5981c95c2c4fd37a, 0x638754ccf20cec98, 0xc74a274ebadd84b6, 0x2ebbc7db14f76789,
+	 0x9085f295e2fb4c96, 0xe9e462bd4b2b1ef5, 0xdee4bf2e0aa1415a, 0x3c9e26b4d83fa052,
+	 0xf32d51dee787c77e, 0x29a65e04b2a005d6, 0xa64fae5f90f67541, 0x0c7922197a2b9273,
+	 0xd8f36830bc0becb4, 0xc10db77ddf1f189a, 0xf9cfa28afa7efecc, 0xa6023b2b9a02d16b
+	},
+	{
+	 0x64a13e374f60a18a, 0x7b8d2aa64589646d, 0x7e6d2247dcdb484a, 0x358c1ce185e2873b,
+	 0xefac4b97ec891777, 0x64fac0505a309ed8, 0xb463eaa734dda57c, 0x42e73728a2e07d5d,
+	 0x1ae2dae3fa2f141e, 0xe82d377e6f96b63d, 0xaf52534018f731bb, 0x056df36c33a3023d,
+	 0x471e0cbfe0a80c63, 0x6e1d45bd6fcc5f94, 0x14a7d0553fc46c21, 0x3dbe9f8c2afb2c95,
+	 0xda0b1ae395551818, 0x9b48150e5066d91f, 0x5cedd08f3ed14449, 0x3b2a92ab3cd6d2e6,
+	 0xaf3f9fccf31d0dda, 0x33f3f3791517083f, 0x806c9289baaaef5c, 0xb5e221c4b582e8a8,
+	 0x7115aceb49b7b705, 0xff36086f424450e4, 0x2ea8c7e09601f800, 0xa730cbe2efc6a18d,
+	 0x3bdea6591f2a3d60, 0xca986f118db2d3e8, 0x72f655a4fb290ebd, 0x5c264b8d6b54f9d4,
+	 0xc7af05e3a0c6af4f, 0x5de8585b6fc843ba, 0x7bbb9a25a53308b7, 0x67fca8e9121f780c,
+	 0x569ed3c5a3b7f488, 0x6327613d84ca1d34, 0xbb01a4456427e484, 0xa08ff46170a3af53,
+	 0xebc5839103d4f65a, 0x0aab65bf5229d0e4, 0x2ea312dc48c32fc6, 0x73e746685c9fc74d,
+	 0x9197efa113f2b72e, 0xe483b2d16b66e316, 0xce7d2073f1fc5a4c, 0x9871ae6031ab86a1,
+	 0x8c14e653ef9792a4, 0x3436ea17d2031cde, 0x99e82c8cd1c074f0, 0xa02f449b778aa2ba,
+	 0x69449adc4e65e25a, 0x96e780e9bb24ab6f, 0x126335d49b464abf, 0x68895c29b0c4fbd4,
+	 0xb1c117078ce1628f, 0x640eff50cd3d9cc5, 0x19bda47c24b97b2c, 0xab55edd6da369dd9,
+	 0x0111b3c6bde53ac2, 0x8484c5e5a5ae7fe6, 0xe4eb22a23ca0baba, 0x09f014f8ffb42fff,
+	 0x9b0c2a29d4f2e4cf, 0x343ec7e1b141ab23, 0x23da425354d23af0, 0x1db3a47e507911e9,
+	 0x3da6f39c730c079d, 0x5972e7c7bc9f1c71, 0x66170ed45909e2c9, 0xa58019be8e0f4692,
+	 0x6a73036f58fd33e4, 0x607faa21a17df8bc, 0x0c1bacd6d94d772b, 0x91620619d713cf97,
+	 0xafbdedd0554f7f06, 0x9f3a87664551f693, 0x900ebb6f5814ec1e, 0x1201b3cf48816ee0,
+	 0xd5bb17b8a5fae374, 0x7bbd650a76b6c659, 0x67440dcdf14fb7ad, 0x092bc1f3d0568bae,
+	 0x401753321d57d587, 0xde9d65a49a198d6f, 0x21d0b485676be97c, 0x6731c61f0ba44710,
+	 0xe0c2d4944508dd1b, 0xc9d779d5d0af9dc2, 0xa2f55cf51444f4a7, 0x61d178b7079e948a,
+	 0x98a814b2c7a9eed9, 0x332123b1f7cfff00, 0x23d7b06929e87cae, 0x2e286bcf875e5657,
+	 0x1670372f3f899167, 0x740373438a0704e9, 0xc11a1657ce03e711, 0x49dd9f6fd5bdccb6,
+	 0xdcdb2bc75c2c66b2, 0x99cecb2fbd3fc153, 0x9a657355d73456a8, 0x3daf2b14980365e4,
+	 0x6063199aa405b30c, 0xb4817664f986962a, 0x3bf7f0b4eecabd6a, 0x21a175d2ca753533,
+	 0x258e413a40d8bcf9, 0x4272af317404e811, 0x9e377060c569c938, 0x2cae31d59dcafae0,
+	 0xfb7e4523d6bbcb73, 0x7872d7de8ad87718, 0x52f313043f7eb432, 0xb1dd4c1beee003f0,
+	 0x8de44f33bdb0e006, 0x7270e96edaf27cec, 0xc6b718903722f469, 0x02eb1c814f1bde74,
+	 0x51d867ba4329f267, 0x3a998fbd3eb0537d, 0xb60f9b2329de17dd, 0x2dec9a20f897016d,
+	 0x5d14d80f21921488, 0x33de965692670759, 0x0db947c99b6d06b4, 0x2140fa66980eab0f,
+	 0x7a1da7b0d484f813, 0xb26c3e5cd4f58b0d, 0x5a9468a8b385a3be, 0x2e4d59b4aa65b5b0,
+	 0x74155e0eebbb1a05, 0x218f823e069a4658, 0x8262eab30f33f0ef, 0x73bfbd53572e3661,
+	 0x3477f8fd1050b0e1, 0xfa2e679bbd3c92a4, 0xaa4995a54cbf9a25, 0x9462516c76b781b4,
+	 0x661a23836ad5f25f, 0x35df3cd8fa28d19e, 0x4bc1f13287dccbb1, 0x10ea517bcd3b1067,
+	 0x9b9f2526eb10fd1d, 0x5e1de02a4e763f56, 0x57a43a675d7e159d, 0x38b1bd3daa376272,
+	 0x03e87f01bddb2e7d, 0xfa0622a1fec0fb6a, 0xb99d15f7f2bf8ab3, 0x9abe3bbd69e4978b,
+	 0xe8e55545aa6e9d04, 0x0aed6aafab37aaf2, 0x53ca01020434b86d, 0x6aa7da0903e7ef87,
+	 0xee6ddc11365bb321, 0x0501ff577a25c020, 0xb2007d91ad8de02a, 0xa2e8dfa985f2d5d4,
+	 0x16cfed5389d1499e, 0x75f369aece8aef9e, 0x18929194ce0b1597, 0x09a52723c477fa50,
+	 0x85e5b62991216e14, 0x41d03297eb53defc, 0xbf718a6794144d74, 0x552bf3e04477d942,
+	 0x8a019d5541aa0cbd, 0xa1eec5ff577ed2bd, 0x88e956991ebafe8c, 0xa1a13f81592f9b70,
+	 0x0547cd62b3641afc, 0x383342333b4a4436, 0x4dc76bd742a48434, 0x76d765e9b0afeffd,
+	 0x5292508d1b87a294, 0xf0a589c528be725d, 0x50833da29c4e2644, 0x2494bfba0353abf8,
+	 0x54ce55821422297f, 0x259ebe4dec800add, 0xbc6075d138bdec43, 0x99b04ab60253c0be,
+	 0x6b82a591a3a8ac1f, 0x02d2d140e12aacae, 0xdcfb21e0abcb177c, 0x6e26a25199361e10,
+	 0x92e61bded2652262, 0x4de53550afe9014d, 0xe4115dc8d29051f6, 0x046ca1a54c9b8569,
+	 0xd804c8173993df09, 0xf3fcd02aabe7eb61, 0x2733ddde8e8ba8c4, 0x2e0682b26c62d9ec,
+	 0x34ac5127cd32d326, 0x6f0847a556cd7b13, 0x655e66d621fb705d, 0x0a2774ab65ba670d,
+	 0x8b1164cd9d13732c, 0x39d1d5dc922f3bf6, 0x319c676482cb6607, 0x2df737994ad456ea,
+	 0x89a1ecb37650cd31, 0x926dafc85a1dc226, 0x42e59288098c4108, 0x18852a39c67ee067,
+	 0xe0f59bd54c91a666, 0xca9c0681d89a7506, 0xea46e947da4665af, 0x3ad2134b376bb5fe,
+	 0xe5a6ea07b7e45d16, 0xc34864ad5829d9ad, 0xf28aafb7ba38c679, 0xb3afbb44072495f2,
+	 0x2efcc16cd89be8de, 0x6a6b85d9e527fb14, 0x760a6262a4bf5c4c, 0x6ffc7448a2903d0d,
+	 0x3f4e96680e5024be, 0x683d2c64352d4076, 0x30d817c060b917df, 0x490480525b56b8fb,
+	 0xd44245bd5ec16de0, 0xa096b7f71c82485a, 0x7a43c79ad7863a26, 0xb4a44d0ac7e5741c,
+	 0xff6ca8c1c0bd9cf5, 0x18c9c4f783c613a4, 0x25e86ffddd9fd31d, 0x3626dae0fcd68a4d,
+	 0x64c1dd59c95b4813, 0x343280abc1164fdf, 0x3f5a4b1e3dc11d28, 0x35ea98f8113856b0,
+	 0x5ddb51c196d28fbf, 0x07d318c8c038e5a6, 0xba80930bec82e02f, 0x5bab489d0d4b012b,
+	 0x99efd4d39155317b, 0x32c76c69fd81edf1, 0x746ea72210b4376e, 0x880ca02e83a661c7,
+	 0xea7b578e135fb2e2, 0x001e9357952f8b19, 0x3404f4befb38ea00, 0x53dcb34e9f44b8e6,
+	 0xf19f718a6ff4d085, 0x98490a11d74ca51c, 0x2b4bd5bdeb51062a, 0x51f1c3402b2db996,
+	 0x46f85150b71bc192, 0xeeba6413de865373, 0x6ae77f85a98de3d5, 0x01bf1906750c2cf1
+	},
+	{
+	 0xf6b54450fbf8731f, 0x9016210c73314979, 0x2e8787c84cbeee73, 0x5a05bb7690d6b856,
+	 0xaaa7908660d4afcb, 0x1a878fb06fbf07f4, 0x2566ab82d27c463e, 0x4bac694820fa458d,
+	 0x18dd8c5a4556adfc, 0x6358add1c67a9d97, 0xc67bd79ecc4fd3d9, 0x77dda4597cab0b44,
+	 0x992c6ab6641923a9, 0x12b7c310e09cceca, 0xb4df3ddda5ff2738, 0xb149eeabcf86ff12,
+	 0xa9eaa942ca07e120, 0x238466744a039acb, 0x7e1a54a959fe2480, 0x42faaa621feaffaa,
+	 0xb1d8787cff1ff15a, 0xab372943f1dd9659, 0x8924974de51e1bd5, 0x13e108d59ca4be79,
+	 0xb24a710a83bc0e5c, 0x767d1ac0855f566a, 0xdab7822548ccedaa, 0x5ae1ec760a576f2c,
+	 0x09c489b48243a905, 0xae21f53c7565707c, 0x9b13e607f3563db7, 0x98332cd7199136e6,
+	 0x8804663570de620e, 0xf9928f153609717d, 0x2f9b31456a32d6a4, 0x53df53e84a12773b,
+	 0xbb799439bd94d529, 0xc9711929ed53e9c6, 0x6dfc13a8cd8dec18, 0x582f6e3ed4b6e82a,
+	 0xaf16175679c3092e, 0x30e5eb09059a411c, 0xebd987c70d4b20c3, 0x9381f00cf5d338ab,
+	 0x40601d4e67e1d257, 0x36d3c7265abae964, 0x7111660be88958e0, 0x03bf6cf37403b2a8,
+	 0x23fbf7ed88a3ae75, 0xb2ce9e6c567b9cad, 0x6dd9b0ba2545fc9a, 0x38b58dca39fc8f75,
+	 0x3c8a0a0bfcad2957, 0x1ec256a601f6e475, 0x0b1ba7ab061a1aae, 0xa969556dd06171e6,
+	 0x68579ef972144d53, 0xf95d75c147c1e80e, 0xf44bf7dcea17caa1, 0x47e73fcfddb4d663,
+	 0x76136c432b98dfac, 0x8dd180c2d2dad4f9, 0x232d4296cfa0b11b, 0x4831ae6f3f64e6f1,
+	 0x139b0314caac958b, 0x37bcf7b2dcaa16a4, 0xa0b8f9ada1d3fd58, 0x7a5063c96af6e7e1,
+	 0xa081bca8a1a163cd, 0x6e9ed033a3caa3cc, 0xb20fcbe0886f6da9, 0x61bf5548ec2d73f1,
+	 0x6cafb283d8158fd2, 0x81375e2e7d3e0b85, 0xd069568a718e6d82, 0x42a16d18294a27be,
+	 0xe9e1aa2e1e069dfb, 0xbfb1c75ac490d508, 0x388d0b1e66382008, 0x906d2fa438f965f6,
+	 0xccde7952e336fa55, 0xd190c5fd097ef345, 0x272aa3b84ceb69f4, 0x68a273bb1d17c8c5,
+	 0x49aed7f69e2da53c, 0x1ddf6471395b2c00, 0x5886e33920c63f54, 0x701e0e8a07cc29c0,
+	 0xc50e8711eec18c74, 0x55be1f7e12b82cfc, 0xfff005a3fefd99c8, 0x3ee4bf8904010e1c,
+	 0x360c25c9e9642a6f, 0x892298eab7aded90, 0x616d4953a0cef57b, 0xb2898f4df3240e67,
+	 0xcd1139440cc378a3, 0xcd93d65c14adcaaa, 0xc7058e5ac90b262e, 0x4520844c0d4ddd2b,
+	 0x0e23e91ffacb395c, 0x109e8fc390ab79f2, 0x73223ac897ede37a, 0x33de287a2731b6c4,
+	 0xfd32978905fc87ec, 0xc23b8469e39c76eb, 0xab70368b07d5d05d, 0x9d04df192ab9b073,
+	 0x214dd8d1a473ae6a, 0x720fe7b6f75c7975, 0x1f7e6e1fbee737ce, 0x69c6658dc89e1999,
+	 0x1a3b5e871e50e1f3, 0x1f22cfd868d2d5d0, 0x96a9a270f73dd423, 0xa423678421c8cef5,
+	 0xacb44f81afeac6af, 0x22e468b1e0625bf9, 0xe20c5efca29956f5, 0x7e281b83a347c811,
+	 0x2a7715a2f4f53ba0, 0x4e0e99712fa6befb, 0xbccb845d7eb7ca66, 0x991b4d060582a21d,
+	 0xdc4261a607509c9a, 0x7272b06751d63668, 0xe872050d4b4791ce, 0x2307c436b52cb652,
+	 0xfa2cc63d8d41427b, 0xd205d244edababb8, 0x8c435bfec36de4b7, 0x4a0a5d120efda47e,
+	 0x6e061ec4e52e5321, 0xc65226c85bb6f448, 0x9eccf47f6a37a87d, 0x84ea1eb99766c173,
+	 0x78572cc8d4a633a0, 0x78cfe1b398133f26, 0xf41707996dcda327, 0x8cfb0ed853636dae,
+	 0xe50c97ee77b3e5bd, 0xddf3412d69dd238a, 0x6299cde7559de888, 0xb3bec52d72077f4a,
+	 0xbde92b2d52fc6793, 0x34cf56c4a42f2872, 0xd5ac025003cb0b96, 0x285c9ee8bcf3c0fb,
+	 0xda651b023de60ec9, 0x5ec8bda27b9bce6d, 0x71570198efc80d76, 0x282ad7255dc584d5,
+	 0xe55706071e7a4a6a, 0x6e0d1477e7257eec, 0xf2526492e3cb18d1, 0x087b4c91fb1b63e5,
+	 0xfafbd305d7e53bde, 0x9b36d2f58d074b3e, 0x71eda1c11b2a45c3, 0x18a00d332a1ac7fe,
+	 0xf4f754223efa9d2d, 0x6f6326e13c81505f, 0x0380bf50b8e8513e, 0x1c444b2fb6554d54,
+	 0x6cddd69f1197fcbd, 0x661c83d4e99bea53, 0x96d9729d30515721, 0x9cb742854ad42db7,
+	 0xa8981ed4e9732685, 0x29ea23e144c4834f, 0x77d7bc641e5cc5ca, 0x253797dd90255a8d,
+	 0xb7b20308ed3e88c7, 0x1971606002eb3707, 0x94cae4d8a6f3ccfa, 0x83a036b94ea694f5,
+	 0x9b674448110579f8, 0x443f647089aad224, 0x41d61552e9d29ed3, 0x222c34b4a588077a,
+	 0x132977eb196ce60c, 0xbe5ccfa8ac23adc0, 0x55b0bf207f4b131b, 0x87151362e88888d5,
+	 0x4e6e5b3fa8b6b22c, 0x834b0ff4eb10be35, 0x86b2ec4e52c8628c, 0x7e69b39917c810c7,
+	 0x408f9c8cacd60248, 0xbbf31d000126410a, 0x41ac368cb55901b2, 0x718f51e8d1d92171,
+	 0x0b2ff9009c26f16d, 0xc95e1c55114c727e, 0xae9951ed355c4197, 0x817eaa67986424a7,
+	 0x783a3a98d7353ce2, 0xab4adc85d867713d, 0x73e10cfc5dd88830, 0x2ea9cfbfdbd2e736,
+	 0xd8f0b1077c335048, 0x97ad7dabf8b0b4e7, 0xfdc127db71bc5e1c, 0x3691ad7aeabf51d7,
+	 0x7b2c376487ad72fc, 0x6e2307d787e8adff, 0xa00bcebf73ea2b95, 0xa63ba6d1c7561801,
+	 0xc0a3da210c70a66e, 0x8194e1f35590814a, 0x3023ad50993b45c1, 0x1994616aa21cca01,
+	 0xf3c8598dea336ab9, 0x53550a3a8a013745, 0x16636d42d83747f2, 0x13be35ebbc0227ba,
+	 0x3a1d8ef3347979b4, 0x02134080d5430657, 0x9ecf108e71de75f0, 0x0fa4609d9a6f603b,
+	 0x4b27fb5f19b026a5, 0x02a18e632fc9d0ce, 0x49c488eac60d78d9, 0x15816a0426654af1,
+	 0x7811db20cd9fbfdd, 0xeb3c6c417e4b0914, 0x8eaabcafd9c7d093, 0x43fe3d1344c4c4d4,
+	 0x49409771f7c38631, 0xb755746b87667138, 0x8907c43ebffd9a21, 0x6edf15c905765458,
+	 0x3f626f23358a5857, 0x12db72d7bfed4268, 0x96adc9648df90789, 0x67a1cf6e17941b0b,
+	 0xcb709136ec857d27, 0x5bb37ed4f188fc67, 0x21119f5d5c610845, 0x6aad2078eb6de6a2,
+	 0x55a9ad95c22836cc, 0x4113f665a449194c, 0x0149058a1561eef3, 0xb5361bc240b7b129,
+	 0x3b1bb1fc21904a86, 0x252cd27bbdf057f8, 0x0ec2728a7812a908, 0x3239e651cfe3a00b,
+	 0x325bc55be2258ecf, 0xee0f0c964ffd0da2, 0xed5e9e9bcba38076, 0x99de8cbcdaf9bd3f,
+	 0x85fc40ac6ec7f8e4, 0xe354f4c13fe4115a, 0xfc7feb0b0e6153a7, 0x6763cc4502b8c342
+	},
+	{
+	 0x8a073617adfbeca7, 0x5030e2d1bde1e85a, 0x118d7f86fd259b6f, 0x5eaadfed75fa92b0,
+	 0x908a3aaf6d7bdce6, 0x0f277fe7a8a7d9fa, 0x0d9da1a2124db1a3, 0x86fc711211e0043d,
+	 0x14671a3d2aafcd96, 0xe17dffd67fca8fe6, 0x3cc9bd2c18c0e3c4, 0x8bb16a8466e727c7,
+	 0x050f4728c5eb7e85, 0x4084109aff7f0ea9, 0xcdefb29e2cae8705, 0x36f202f1877f2522,
+	 0x30219d7360d0fad9, 0xe3002e9c275e753d, 0x40eac95da27d3250, 0x75f2a2ece73cff5b,
+	 0x257ecd3204900dc6, 0x5166fc986a1b11c2, 0xd46991066e6137cb, 0x977fd65568565fb3,
+	 0x28402c4a56f8293f, 0x0d647a2dc6599463, 0xfe78fb6a17839b10, 0x0237c65967d0af11,
+	 0x337c9eb90d8a67b1, 0x73b05bdb49614521, 0xb04ba56a091a22e6, 0x2a348eb7c5a35ea7,
+	 0x2d6d973ef364c413, 0x4361f4be4bf76d87, 0x513795b5f946faeb, 0x52c6b4c5ad0db2e2,
+	 0x9bed433ac1d518d6, 0x7d754d10b85f3b62, 0x668a2cf943f62bf4, 0x351c59967c95f73e,
+	 0xefe90b9d0321567b, 0x6c0069d781ad3017, 0x1681acebfb5337b8, 0x58cfa7eee12af2f4,
+	 0xe1aa6b7d9470755d, 0x764f8f4e96193098, 0x77e6022430411463, 0x4e59788d856595cf,
+	 0x28d611efeafc677d, 0x31f95ff1ba0da434, 0x6659c8b674e45f51, 0x3b769f2fe281c027,
+	 0x06d43bac33263677, 0xcd730ca4843749f9, 0x1909a28c87805bce, 0xa66e79c5fb06565d,
+	 0x715934c4c61a2885, 0xa8899055734acafb, 0xd63a3eaa6ee86323, 0x659e929968c9ee37,
+	 0xa75f2d6a0779a81e, 0x3e215e9492989f93, 0xc7648fbc30920d40, 0xa4e1735b8f5321cb,
+	 0xdcc8370357e68b7f, 0x0606f9cbeb276bef, 0x727b2f24941e6807, 0x432780b5a2da09dd,
+	 0x0d0bcd877dc4d569, 0xbeca29ce25f36457, 0x767970c50ff20a1b, 0x9beec9425e014623,
+	 0x18de2b1d13d41fd9, 0x7e24c24b6355f623, 0x4e8a25f13937bc3d, 0x5ac217057efeac52,
+	 0xea6f311dbc6529c3, 0xb47709fec8988908, 0x94c16e14a42f9562, 0x98c539656e7175bb,
+	 0xd3f2b83de1c5a810, 0xc3b6652fa97b3c5f, 0x358ed3d9f1faed0b, 0x5c0aa2f98bacce18,
+	 0x403b4952b5d03e30, 0x501b26d077222dcc, 0xc607812b261c6cd5, 0x94038088231bcef5,
+	 0xa99ddb606d17a58a, 0xcb3be6d3c2a91ed2, 0x1f1112715b8d9e97, 0x137560796b92a11c,
+	 0xa1e3c0b7680e93d6, 0xf1da10600b610b23, 0x3eebda6c0d5cb12b, 0x4f90720a4052d266,
+	 0xd5819b78c1d6479f, 0xbea72aa17feaa429, 0xdf4920600e3b58fd, 0x21a7489aa9de931a,
+	 0x1245121c1bb13176, 0x586bce07e84777a1, 0xbf30eb216a8a94f7, 0xa28c174328e6c730,
+	 0xe8e819cb2ef071e9, 0x2d12fd60bae39ac3, 0xfcf79ee0118d5622, 0x4a3efd57e7a4dd02,
+	 0x2f86e2ff0d49daff, 0xd7e75ea6f7a763de, 0xe7d04602378ce34c, 0x009d2f7f583895f5,
+	 0x46e30d28be5d87a0, 0x9e6e3c7de2f3a161, 0x51ca0e1f7f33ba4c, 0x4ed89419152753ce,
+	 0xfdbf072483174bfa, 0x2ad1a283d8cf74a3, 0x0531eb91565152aa, 0x7e54e8f77fc34a61,
+	 0x471a4e493d88af42, 0xc1d2e8abb7123154, 0xa95553abb1e17d75, 0x15e85473694a1919,
+	 0x4877edd29596eaa2, 0x016da1beaaac82d4, 0x4a4d95ae62b53d3e, 0x4badf798e93711e5,
+	 0x3b00cc19162d6b3b, 0x05d1699bdb41242c, 0xa72421345b54bb50, 0x90228bbfba78e4e5,
+	 0xf53d4ca2ae9b9b66, 0x718384f4b2e38caf, 0x847d706064cc419a, 0x68e8b91eba5327e9,
+	 0x9e24b16f9145c982, 0xcaa1c4f038346b30, 0x7a6d56003fda7fa1, 0xa6e2bd50cc415adf,
+	 0xfb034d2b2de03b65, 0x245614e9384ac61a, 0x3fc34c0289f543c9, 0x76b4be8e1029eb67,
+	 0x375cf3ec18583ad1, 0x77337ed93d8ef6c2, 0x12d0b2f2bdb6dff1, 0x3408cf2f0ed001dd,
+	 0xeaddee42541186f2, 0x094cbca302ab7c38, 0xfedaa722a69b2422, 0x50832a11018f90bc,
+	 0xcfee594e70507dbb, 0x9e473d445f519163, 0xd285430ddba1f9ff, 0x1861e6ba598ca56a,
+	 0xffbe0179fd1b83de, 0x55932995a89e177a, 0xcd7a289c2e789ac9, 0xb1358f6be7e9dc77,
+	 0xc4b5237d6b90771f, 0xd58050aabd9e13b4, 0x6ed87ad402f6982c, 0x8f0972d202bb8f7b,
+	 0x966235b36346332e, 0x488c4dc672557e88, 0x91f2971458d6d5c3, 0x36bef62b2cdf5eb7,
+	 0x87c67cdeebe8d973, 0x0b42383036042380, 0x275240ed5f9609f4, 0x77bebf70c20dec7d,
+	 0x55b919fa3a90e52f, 0x918366a1d6f93bdd, 0x36d3b3f97f58a732, 0x7a84807f1dea70cb,
+	 0x3be6fafc086a704c, 0x46715e4eef3328a0, 0x3902ca40cf259f4e, 0x63be41d109760bb3,
+	 0x3a7072d2175d2e26, 0xf0442a4d8d2cabe1, 0x0081d3781e689e6e, 0x47a80e1426870508,
+	 0xa27b70c73d0d4bf3, 0x91f0cd72519fc37f, 0xdd7123088ea03d69, 0x432ec84146e2a4ba,
+	 0x56822b07b63a8e6d, 0x0a52bf5cc2111aec, 0x5cd79343d214188b, 0x687622ee82bb2773,
+	 0xb951f2eb11fe6249, 0xe41a742f3d4daf08, 0x95b08b187381c826, 0x658961f8032451c6,
+	 0xf3138c0d04b9facb, 0x875528f415374b50, 0x48597b665a166e19, 0x91af536bbb0440b0,
+	 0x854f04ce4adf1e9b, 0x04721b73c17b7aaa, 0x017c470e6c13d0ab, 0x2e406cdc1fc7a683,
+	 0x731eb444a7c66e91, 0x8c5612e9d9704820, 0xcd7293d228f31ef1, 0x86a15d2434e39317,
+	 0x8d7e5f5a34755013, 0x0cc0ee45018f5e0e, 0xd058a0055e53184d, 0x1a03dd5f1c237a06,
+	 0xd089a48d96aba751, 0x06646c1486c003cb, 0x33b8f0451528d478, 0x0bae29f4a7cff739,
+	 0xb693f6ce5dd2bd9b, 0xd8336f6427da867b, 0xcb73cbf3b9445bd9, 0x592e559475a3b2fc,
+	 0x0e5d2cbeb28e13da, 0x0d20c1a2af220e00, 0xce69801a08040931, 0x998b953ea36bcb69,
+	 0xec488e5daace9887, 0x81e1910f21fbefc1, 0x9ea7f435029832bf, 0x6b6ec9978d5d94d0,
+	 0xb777349cada2ec3a, 0xcec6c0589e01ff63, 0x233e39ba0b8c0f2f, 0x9aff8bce734141a2,
+	 0xb21bdb8e3bcf4a64, 0xc4c5fc84b4c8dfd5, 0x7c87e2e61d516f48, 0x0d750396550141c8,
+	 0xcc6ede7cd3149242, 0x4a353d0d33f4b5df, 0x325f19a27947d6b4, 0xa8f3b0f9a0951b81,
+	 0x66fc0f09c9d9e3ad, 0xeee7f5e0453218eb, 0x14e9c120204486c8, 0x11d102a2050c55dd,
+	 0x1598fb417390bd8d, 0xf8ad372d0dfb9ec5, 0x792644940fb94f72, 0x4e0d6528f6f9135c,
+	 0x265a35459d241369, 0x775373a63ef271ca, 0x725a4012268753ca, 0x4bb1fb3cef0f831e,
+	 0x18a375a0125aeef2, 0xb2fc10621861b357, 0x70eee7c9c8fb2d55, 0x8464ea6d118b70fc
+	},
+	{
+	 0x98c10b3d8a032f75, 0x13ce84019fb8dcf2, 0xa79e7678d943145f, 0x9680eb14aa5fd817,
+	 0x22e89db4e568053d, 0x0cf4aa1a46eaab60, 0xf987243876b06feb, 0xa1319b27bf8d952b,
+	 0x4a85104fb93884ed, 0x5249c1410a88827c, 0xff5b5822609b6cdd, 0x113d6b3d0de2846d,
+	 0x9f7844b846aa8c52, 0x001b23738d8dadc7, 0x43099c8708ad4ba4, 0x6f368d2b9ff2e035,
+	 0x9e0672f2dc99d8ca, 0x393e42c9cba1b46d, 0xc512944b8b464e58, 0x0fcae8e2c00a7ff2,
+	 0x202e5f8a0b99f68e, 0xad2e07fcc9ceabe2, 0x68d4fbcd6ddde1f4, 0x11b2310c02361c64,
+	 0xa29bbd548b7ce6e7, 0x9e5f12c5b02f85b1, 0x8fe5e2cb5fbae4c7, 0x8de60d6b1d4a0902,
+	 0xa59cba62403964bf, 0xa1700ca13be70d20, 0x91bdb5a636ca3684, 0x5bf469ad7bde774a,
+	 0xf1c38e6bb38f8172, 0x143793325c1847ee, 0xf76f228315d7c7ab, 0x79eae05c3c55e9f1,
+	 0xd2f9a0666498062c, 0x95f0276e2d6d96b8, 0xadb44f90432fd37b, 0x2063398f7f40e609,
+	 0x32017166264c001d, 0xaa79c01b1664f51e, 0x423c5332970296a4, 0x1f2962ec98bbbb25,
+	 0xd84bf1d30682822c, 0x94a4e0c3f76c08eb, 0x7d8fe588c83be3f4, 0x7ba9be101bebc1b7,
+	 0x17efe91d8fb2209d, 0x8cf7a3f3e6e272ea, 0x774e7031a3e9f2af, 0x888bf5789ac89235,
+	 0x4fd540d071ce1f81, 0x30f7bde72d041054, 0x8648aaa3c245116e, 0x3d76d4fe71ca16e2,
+	 0xb90c80ed47b42950, 0x7b93c8678e672bcc, 0x12d232977692aa73, 0x1de813ef68825fd1,
+	 0x1ee7cb452d5a058a, 0x66de00125f02e088, 0x873abbb538085880, 0x9409df203ceb949d,
+	 0x9e175d8b0cb96702, 0xb53e4ea9da31af4c, 0x72b26a2c72b7862d, 0x55e5d17ac106aa24,
+	 0xf5fc362fd2383f0b, 0xa0cc58fa1aeb976e, 0xc819a3a441447915, 0x11077323ef2d96c5,
+	 0xea378c7d75e7c4c9, 0xdf29468ee4d8d8d2, 0x1aea481122967e3a, 0xa9aec61c0c8791b0,
+	 0x9d3438bcdafd0e02, 0xcaf0f9a681959cd8, 0x7ea0352985bcb6b6, 0x9850c437b11dd534,
+	 0x0a221bcd04a0a9f3, 0x2b4b08b7f9b24d55, 0x41d6f0d7861eb095, 0x94009bcbcc18682c,
+	 0xce51eca676a52fe5, 0x949c9e6addc7ed2a, 0x93b36b988d6cf410, 0x8503ac08c5de6af6,
+	 0x6d3c0355c5677ab9, 0xe1be61807a59b054, 0x235b1b5363f848fb, 0x16fd37424bf4193a,
+	 0x43d822ffd79c0e6f, 0x0bedc53743b7af46, 0x193efbec5e661d35, 0x503e42923474f5a4,
+	 0xedf879bf02f660ec, 0x304b5965bffc17a4, 0x6d5dd85eadb9cb0d, 0x235641fe096a0755,
+	 0x011ba2891cc19420, 0x5fd9ede1479db0e3, 0x6e136c5f76f07602, 0x5a1a1cf202a59ef2,
+	 0x26c50c13125706b5, 0x98f26be81e19b355, 0x4d659db6c1b4d524, 0xae1bc18aead5f1d2,
+	 0x2d6211f5d5ab5dde, 0x7e9dc484e223d05d, 0x87472ddce52da67c, 0x621eb391a9f79097,
+	 0xbd8e50a6d2f58c57, 0x14ae0a54376ea43a, 0x948566dc1cf9b148, 0x4688ca2a90f096c8,
+	 0xb84c9dc53c76e208, 0x291536a6aaa98757, 0xccdd8ed62302b216, 0x78592dd3ee7f9e25,
+	 0xbb98798b178f2cf4, 0xb023558393db4340, 0x6318cde63ce9e92b, 0x4635b325b3ed30c1,
+	 0x78acf151decbe9ef, 0xc5c3ba825c94dced, 0xb93c7590ec10866d, 0x49819b5fe939417b,
+	 0xd2524e7a2a06d86c, 0x803b76a35fa62bd4, 0x5d51fa1fa7a869cf, 0x1dad6fc75c491e43,
+	 0x9ff142a22bfab7c6, 0x0dccdb765516823b, 0x2db7c3a86b437956, 0x3dda46c36773d690,
+	 0xefa8abaa7470b84d, 0x199aad44212d321e, 0x9e1871189beb7fce, 0xb18a2996c86373c0,
+	 0x0c02b737f5bddb0c, 0x3973bcd9fffd5f7c, 0x68c94caf00faa35d, 0x13cf85c51dca1a9e,
+	 0x7865d76813529b55, 0xc7996d781f637cd9, 0x48fa0a1a85d10ccc, 0x5541c01ae80d4173,
+	 0x4e78e01f89421df1, 0x8e9e5ffc1820abeb, 0x78e81b47d74fdc36, 0x8061f61b66a0edb7,
+	 0x5f95787bb479d071, 0xcff01916cdeaa014, 0x2f9afc425e0bbe82, 0x2891e4e544b8c04f,
+	 0x159b15f03f009446, 0x7c7c6fa3bf52724d, 0x78bc57c03b3a3c75, 0xaafcb136fcc9efa2,
+	 0xa6f713b03cab36df, 0x7a6f31ff09c28994, 0x48159e7988aa587a, 0x55154950f7d09881,
+	 0x46bf24431301f0b1, 0xd0a54751ef5a738f, 0x43af0310520fc584, 0x64614c1990aded15,
+	 0x795e97c03da19a76, 0xdaf3383a51057d8b, 0x9c9e9db1dece457d, 0x8d4ee5951fcc933b,
+	 0xf71471d3a5ec3d3b, 0x5d35aae88f4a56d9, 0xd49ed4404012f5c5, 0x03213d459cdb6f08,
+	 0x1449ff594f96ae4f, 0xd35c8d77ff34ad97, 0x738624067150fdfa, 0x25225b9d1a6bce81,
+	 0x61e8cb01436e2282, 0x13d943196ac1f9d3, 0x1159560bd12c4fc5, 0xa8f62d817ad88947,
+	 0xde29fdc8191688e3, 0x5e20ca9900692974, 0x199f2dbe3655d860, 0x340d6c01e3fb873d,
+	 0x9a55ad5b587bf460, 0x3b0467d1e2b92a41, 0x811cef0607a30aba, 0x056ce43863bd3466,
+	 0xe2e1b87528cd5529, 0x6e4a3990bb627f24, 0xfc3e10cb2687d6a6, 0x0fb1ad8c89618dfb,
+	 0xf9cbde0de0099b3f, 0xcbf90782bea681a6, 0x56b7ee49cdb97fb1, 0x47329e92183d5eb5,
+	 0xe1770af2377c2c02, 0xd162b8d6c0aaa0aa, 0xbb91270d57863271, 0x82118b3b4d106182,
+	 0x93abf41cc6ad45a1, 0x14d2d45b50c194ae, 0x75012d2c58d6de00, 0x0c24ace7f7f1210e,
+	 0xb431bafaeb317c07, 0x32f03c4c17629395, 0x5854a5f32b8334bc, 0x57b8a3fcbd8c8f88,
+	 0x901c4a5e0711f463, 0xc92010f5165ec44f, 0xd116cef18a7dc9b4, 0x28e802c58cb52d6e,
+	 0x730b99ebefc2c61a, 0xe2a34a6c8b3d6e10, 0x9617bb4e22ab1c46, 0x430ddc2e390765c4,
+	 0xe31afa26ede636a9, 0x0055ab5cb7323f46, 0x64f5ac1ac357a430, 0x0f947b6c9510b758,
+	 0x9501fc78247e07cc, 0x8f44ee5bc5522869, 0x8202e6d6404af72b, 0x4a46380d9e7cc1df,
+	 0xee33bd5a50d99910, 0xb299b7346774d3e1, 0xcff889a7563801db, 0x028f28d981e7b337,
+	 0x38bb18c3d0f7f651, 0xc29aceac98eb88a0, 0x497eb0ecea3baa30, 0x6f597708d4db606a,
+	 0xa478eef01c72576e, 0xe2aa342cf0e7e11f, 0xc9d00947f559476e, 0x6e6a15e95ed95586,
+	 0x10a9cd11f27faa54, 0xa45cfefc022d2629, 0x8a5f024164d4dc1b, 0x77f770864d55de8a,
+	 0xc1597e047bcf3fc1, 0x1a506fb6adc0755c, 0xdaaabb0ed09052d1, 0x86dd672f2f15b55b,
+	 0x490ede8bf518b64b, 0x6a20233ab68d993d, 0x5f698c9d2aef80bf, 0x8cf7cb73611b8599,
+	 0xeef7faf6ef0e060c, 0x9066e9726f57755e, 0xdfaabd5dbf86b46c, 0x224ca13cfc6af7d3
+	},
+	{
+	 0xd185b1fbdb72bc6c, 0xd54d7b45ef140cb6, 0xdc1e76ff4598d0a0, 0x78cf31a689ea25a6,
+	 0xbfde204f84a53178, 0xfaed9db9b04fc41a, 0x4a891efe2e1e5ce9, 0xa2c468810ff9a71e,
+	 0x1676e3d7e7c0bd24, 0xa4a324ae321d5be4, 0xabf9809a5534d4bf, 0x64e5e540934ec72e,
+	 0xa33581fe7321e7bf, 0x8298cbf01f1d8a7c, 0x4e67616ad8498e5d, 0x0bd31f1277b3dcda,
+	 0xd7214a7992d7f0d8, 0x70b15bd67f7f8fb3, 0x66ca3d27435965e1, 0x56e2000cbc42ec34,
+	 0xe6aebf430d7e9163, 0x645f1566df43f2a0, 0xe9997c02247b4367, 0x256b4b9d4f671d66,
+	 0x4ed89d9dff393693, 0x9d896b11a00af9e2, 0xb52ebbbf6c642cc4, 0x807aa0c18eefc8f5,
+	 0x9de5dcfdf7f451c9, 0x14489b9858f29177, 0x4d40c4a3edb3b50e, 0x8965e03df2e30407,
+	 0x0f4340140c6b9399, 0x88dd32ec2effe609, 0x1ccfb6ba68b9c686, 0x1f63182b3155c903,
+	 0xd623114286efe355, 0xea304574c6fe217f, 0x367f7ce530be461e, 0x9a981afcf6a8a076,
+	 0x5f19568161673ae8, 0x7423416e7749e1df, 0xbc24bdb260033187, 0x057c0ca39116ca1c,
+	 0x463886dfdca1aeb3, 0x818c5ee586c39375, 0x35898c5a6a0faa10, 0x23fc9e9a4bc7948f,
+	 0x71473ac38357e3cc, 0xa4757e79ca6bf155, 0x66b779254d313c52, 0x80d91f58ae4d26e3,
+	 0xf042e69f568d2050, 0x1e0d6315c4ebb847, 0xef9aacefa09be150, 0x9ea3828d86decb83,
+	 0x391034b42abdf77b, 0x1644bfea6c8e310f, 0xc21bff2345e96836, 0x24240431764ab9cb,
+	 0xd9a9c6741ee9380d, 0xf6cada1a1b8a742d, 0x186d6ebc1d417d36, 0xac288be058abc283,
+	 0x43be4f25627656fe, 0xcfde3e1af2eb33c5, 0xabe7d4345d66eba7, 0x9ccb2ae961e2aaa8,
+	 0x8fb6d43f353fbe34, 0xa76d0b8e33b683e7, 0x5c8b91ce5bbe7fd8, 0x2da3a356112c3b29,
+	 0xe6095c0c4abeca33, 0xc93ff62422d836f2, 0x0161b0451c8d1507, 0x7a2802ed9e6418b1,
+	 0xb60e60fe1643d986, 0x659ea249d15a4573, 0xcbc46cb12e99ecc8, 0xa6e66304d76489ff,
+	 0xe81ad5570df0ccde, 0xfea82a03439c4a6d, 0xc8f2376e8d50d9e8, 0x7a9317dfeae7d3d9,
+	 0xab93a37c984812ab, 0xe1cbf9991be4114c, 0x5e4d1014aa535550, 0xadbb977e9a623af1,
+	 0x5496d7e8cb11bb07, 0xab2e34ec7c692317, 0x2dd9916626b121d7, 0x824953c6fedfe220,
+	 0xbe4455c3fa360922, 0x6c05811d042a5ab4, 0xde604abc34610237, 0x182300c3816864da,
+	 0x1f3470f56379ceee, 0x90ba9d742e80d0b5, 0x470e398a10cdca47, 0xa02cdc3924e3c871,
+	 0xdcb76e9fca2594b1, 0xbf999420f10d25d4, 0xe9e7252593b8dff8, 0x8eb3b979fa178c85,
+	 0xc25736e76f3166dc, 0x7770689c61982375, 0x70fecc779ff1f8a7, 0x02eae6fb6a225630,
+	 0x7ec8aa2b1afccc6a, 0x1e59d268071deb0a, 0x127190075d1c7c25, 0x7684ce70980036a8,
+	 0x6d0dd93010e1818c, 0x13bf915137c931ab, 0xc4ee5b8c89ce00d2, 0x0b20750c4053a703,
+	 0x2913fb79a511741b, 0x47e165a457640498, 0x5a63027b4ff24116, 0x6871e50de79e2564,
+	 0x56a7f8d6780898e6, 0xbbd977261323a6a7, 0xf0423a774f483d5f, 0x29f1467ef15447bc,
+	 0x95158ad8f7ff012c, 0x0b5051dafbac426a, 0x87bad73f6fdcfbb9, 0x98be3f66dd367f0e,
+	 0x65157c5334aa00a0, 0xd1804cf128f5f6e1, 0xd091019e1601677b, 0x266e54f9d66490f5,
+	 0x47b73e0c30d4f06a, 0xa0bd7607b7f24363, 0x97e376c5695e5a2c, 0x30bb2fb9d0cffd76,
+	 0x708da2a8ecab3167, 0x20993a008dba9aa0, 0x4f994c502e81a02a, 0x816c23d3ba38a939,
+	 0x0a55b24249278213, 0xa24a9b3e2a25e19e, 0x3c0e97b817e4775f, 0x9ed84f49add1c60f,
+	 0x5b529695426b7ece, 0xf497105e605f781b, 0xdd64cfbd11dab7d4, 0x90e0efb4aff100d8,
+	 0x90474ba3493da889, 0x1ce365d4eb7d5db2, 0x4022f2116b7b33a4, 0x48432a22b13940a9,
+	 0xcd171ae5ae72f0b2, 0x0f26cf755689341b, 0x8d52a2263c3dde76, 0x1089029e2a818feb,
+	 0xe6ec0ccbf8d89967, 0x77facba2a91ee4a5, 0x3c9e9853066ca955, 0x7998deedaaeebda2,
+	 0xefcce9e263d17e3d, 0xe20dfcb3a431707a, 0x306a19d794f5cdab, 0x4586acee61367ab4,
+	 0x56b96890f07c0724, 0x80f04e381fae9cca, 0x754147afe3faf729, 0x5e4fb9783b29365d,
+	 0x80b9e0072b2f61c2, 0xf2108ec97fe4aff4, 0xa73a1a657844dfd6, 0x8f52f94343501b9e,
+	 0x7670668c72ca6177, 0x12ed80d87fa85965, 0xca8c19e89567e74b, 0x1da78acf45d28f19,
+	 0x46ba13492b16d665, 0x296a8ededede186f, 0x1af5c10eafea3f88, 0xad0f3292c48ee6f8,
+	 0xd39cd489efb622ea, 0xdc79aeed878ce38a, 0x80b0e330358c3c99, 0x0056d1a07ac0d193,
+	 0x10cd66929f543d81, 0x26d0e2e6ba2a7c3c, 0xafb883273bfe80c9, 0xa6c635e7205fa632,
+	 0x4ed0114de30ee6d7, 0xa4905600942aa31f, 0x03d33a01de1b60f8, 0x5bb1b804f95a3619,
+	 0x94c53d8c87fbef07, 0x0d6825718768aa7c, 0x86e4727a4e3088cd, 0x6df3a262acc4f3f3,
+	 0xc16447d340bce29c, 0xa4f1b6eb79de1ea7, 0x861825d8bdda6f63, 0x999c8c8fab82f02a,
+	 0x2c9644c900a93e4f, 0x90229d9d661b854c, 0x612257bb4b16a8b7, 0x7c980b5e8a450a1c,
+	 0x54e2d05041ce7125, 0xfa351a6bf66292c3, 0x2b9683cf59f95992, 0x6598702f1b2219fb,
+	 0x534ed4c7ff482645, 0xd678c32b79c55675, 0x569f10bf655760ec, 0x9700b7afc12fe58f,
+	 0x1b43543e8bff5ba8, 0x21be59d4339536db, 0x545f12b286d7319b, 0x8b27eb6db5512301,
+	 0x6dec18bd09a37095, 0x85d200f1418885e5, 0xc7050fe3eeb3d196, 0xb1580010b831c3e4,
+	 0x376e8f4194a29d8d, 0x77771198b6365a0f, 0x48eccd9c4d790110, 0xaaddad56e8a0595b,
+	 0xa4cc55a2d9122cff, 0x8da98089e3ccc7e2, 0xbc59919086d7c656, 0x32202f535549d168,
+	 0xc7e9899cdbed4a07, 0xd10a23a6e0e5c82a, 0xebd2eae92ec7ba6d, 0x172da9db8e1f34a7,
+	 0xa7dd79cf758ba937, 0x22f157948ea3d9b0, 0xab0f297b26794ec1, 0x4523e4b5845f05c6,
+	 0x977a24c22a297c68, 0xdce4390dbad5d091, 0xfb41032f65e2acef, 0x74e5fe946fd75ef3,
+	 0xc8d83b367982cf7b, 0x77028f90a333b051, 0x9633668cc58c4956, 0x82cd30b4e1eaa013,
+	 0x9ffd90c9a1269c03, 0x2064761f9a601dcd, 0x7c10a6630b2f0de3, 0x44d7271d3b9edf76,
+	 0xe01eace97be26958, 0xfb68cd1725f205b6, 0xd64d46e79eb08ad8, 0xb34fa08254397fa1,
+	 0x5595db48f6670f67, 0x8bdde05970650bf5, 0xde89beaa46767365, 0x606a47bcff4aea23
+	},
+	{
+	 0xb6ed25991fb81321, 0x2a01b7ccc43d8c41, 0xa28e3a181492b714, 0xa5e65f31a6418ed4,
+	 0x1eff19a88f219ada, 0x735d61ad54b04001, 0x1c2bd19797b452e8, 0x8da070112f6da468,
+	 0x168f32aabbeb2d3c, 0x2dab518841a20be9, 0xe178be9c9f1f464d, 0x3da690625d771a83,
+	 0x91ae45c2cf9e69e8, 0x3f9a36b221412c83, 0x2d960208626e9fa0, 0xb4763d7cadb6399d,
+	 0xec2dd793cec0f29e, 0xb4ef7e1dcdffba77, 0x67267332d2309df7, 0xa0138e5e47850aff,
+	 0x80921c57c884da55, 0xfbc4bc4d664b612b, 0xbcfc78799d4d9b0a, 0x18570a0ce409adda,
+	 0xea214035445a4c84, 0x7d0bcb92065b3277, 0xcd7386f331b47768, 0x20114228e037e86d,
+	 0x1aaa0364e60a854f, 0xe38b03e2386c10b0, 0x3e94bba64897e2bb, 0x26cff850de5ad109,
+	 0x2a9460c8ebd229cd, 0xf53fcb2a254627e0, 0xec7bfcaee6e976b1, 0x30609b1a94582a7a,
+	 0x995310ac82fb9a22, 0xdb59daa6442c8640, 0x1d69d22681b60992, 0x61d73263ac851017,
+	 0xb89e0a33c6dd705f, 0xf6a0ae8e00412831, 0x1e2dcd7791685953, 0xa993654e059a4631,
+	 0x3563ed54107a582a, 0x5195dd41fb153c5a, 0x2a833fb5c9c0817a, 0x04ac54de01589442,
+	 0x9f05f99452699c06, 0xba6d5766ea5bf930, 0xe51abad2ed88e404, 0x09a3cb8fa89ce867,
+	 0xa91a7ee5b081e13e, 0xa2c7b1a2e85e2346, 0xfadc604eca4c5f72, 0xb4a438b6e19fd52a,
+	 0x7aca3fe892b2c6b2, 0x51f295ef129cc7cb, 0x6fb3930ba84bb2f4, 0xadef9205aeeac167,
+	 0xd4ae7d326de30449, 0xbbc3b70447243869, 0x9ef6972b415a8e4a, 0x995a66c28a982781,
+	 0xcdf05a62457c8788, 0x2f8ced313b7be886, 0xb9cc8965155eecd6, 0x408d21e43d0694a6,
+	 0x2b1cd73646449285, 0x3c537f1efcc596b0, 0xb4fdac4281316586, 0x3442a4f225595e26,
+	 0xf5241123662e1c8f, 0x2510380869bc451e, 0x7e93ec49e0da5bf1, 0x96873569b01f19ff,
+	 0xaad11a89349b511b, 0x0d6931396a3828f1, 0x5664aea8c85b0e18, 0x0920f0d2381983f9,
+	 0x2ffeb1aa658bb12f, 0xc13c610dfc3628f3, 0x2ebbb212d01c2833, 0x5718951007bdf247,
+	 0x0c2f04c2bf07cd74, 0xf245cd5240fe9dcb, 0xf4a2ad15d3494ec7, 0x2964768c3e6965b1,
+	 0x3640ca5312e6275f, 0xced9838de5256633, 0x6b3f1a100cb9498c, 0x41068764ba63a171,
+	 0xa0d2c69eaca85289, 0xebe043318a430c53, 0x626b6da1e70cb9d9, 0x332bdb28b0652dda,
+	 0xe90e34f9f4cf7189, 0x88b45af2d12c47a8, 0x1b0fa5a8e3483696, 0x08480589af7a4c48,
+	 0xffca71cc0a61c224, 0x8b080f98636c43a6, 0xe85a7a80e86e852a, 0x6bb0083510062a8c,
+	 0x80d6473074e8f880, 0x9d228a5eec1d5a67, 0x3f0fae7aded146b6, 0x34bc8f82723c8fb6,
+	 0xd48ab9e01e605be0, 0x2207ecfd7b13290c, 0xf83a88d2e695c438, 0x9891832aa845afed,
+	 0xffb0213c09086900, 0x9cf1e5fcdec71624, 0x017c33c6796aab8f, 0x754978223954fa7e,
+	 0x420a2a350b042989, 0x31347ec0ecabe13c, 0xe418f2467b68a5cd, 0xb6378742127b39ec,
+	 0x3c833f648846c9e6, 0x7ac831a347428c6b, 0x17fb0c48735f979c, 0x9c5f1c55eeb1633c,
+	 0x60b07ab8e74a10c5, 0xe80f3aaedbe1d1ed, 0x2613df81de1c6393, 0x084c2688528812bd,
+	 0x5ac2d3aa1549949c, 0x654191adb73fbdd9, 0x4721cabb50729ecb, 0x192c37ebcd285e7d,
+	 0xe64e104d1c9bb24d, 0x98491305a83ae77a, 0xa90f2542c7e5d335, 0xb04e7cb123c14da7,
+	 0x01438b2aedeb7b64, 0x904b02ac22c2c747, 0xc7517f4aba74f4d0, 0x2a7d55f4844b4d76,
+	 0x1df07c7de7ff23de, 0xca02349946cc7c8a, 0x4997777e1e4f32bd, 0x625d434fde9cb308,
+	 0x35497b795ad5e63e, 0x3c708408edeb7dca, 0x3b7e68445746cfa6, 0x6ea2c34ce190af40,
+	 0xc8ffb2123baace3d, 0x06aac2aaa08b2f23, 0xb3f765ddb473f4d3, 0x4ab38f5e5cf13acf,
+	 0xbcb92e504a05c407, 0x3c387da4ff9db21e, 0xefd48f51b3f55694, 0x763f61fc0c8c7a5b,
+	 0xee2e9d691fdbffdd, 0x039bcc995e6fd494, 0x04a3f7117e1978ac, 0x65a0f342ef8a91fa,
+	 0xa46d93992cd9b698, 0x0872742deb1e1a34, 0x907a27c51ad0c873, 0x60470b52431acdbd,
+	 0x4247271a79d89f5b, 0x753ffbd3654cbd0e, 0x7d3965fffa7b4a64, 0x705a3b6b0c9194d5,
+	 0x18427e4c134b23eb, 0xe96255d20fb2975b, 0x5bc86c3e689ddca9, 0x3ed4c8f02567088f,
+	 0xd94d8c003229b2a0, 0xaaf37de5c81e7883, 0x1b781b304d2e1129, 0xac45ee8caf9869cb,
+	 0x883611f582ad187c, 0x539fd57eedc90a33, 0x68864a1209f66b66, 0x51c9028881d4dea1,
+	 0xe5292601a8c77b94, 0x66da6c0278386ceb, 0x7f3abf71dd900ec7, 0x661d461e028771ab,
+	 0x290a5d4ce254e9e4, 0xf1a46b0963bb8645, 0x9f89ed3c248b1bbe, 0x479a80fd335ac2e6,
+	 0x4ad310d41b7bd9fa, 0xb713054dc5da2e94, 0xedc12a8c04184c3f, 0x26a9baef84d62efc,
+	 0x9c353a78e47571bb, 0xddd6dc770caba558, 0xa2e470ef77cd7dfa, 0x60d9d34eaab74da0,
+	 0x8a6e9f522159d734, 0xa3a709aac37213bf, 0xdbbbf7a50b792834, 0x1b4f974fa2539bad,
+	 0xc9cc38d6229381bd, 0x1a40f1936164bb95, 0x0b20379721562c76, 0x4660e53655f7495a,
+	 0x0dd3ae0d84226571, 0x477698bb45ecc42b, 0x465bb423bfbcd32d, 0x2cd4996ca6195bbe,
+	 0x59f14117b89bd091, 0xf65d68bfb8bf0970, 0x2bc6106c4ac1ea7b, 0x688a79b849809b50,
+	 0x627abb2598b6abb1, 0x7bf3213e05d5e87c, 0xc4c6f0f8baaaf2e8, 0x3c3176a00194b5ef,
+	 0xfc25c8812d68d3a5, 0x834930511997b37c, 0xa8ccfd0861f5bb5d, 0x0ab3e7d8d84f9ccd,
+	 0x86a9c19e16b604c9, 0xfb554b6cc452bf22, 0x2f3062b8dc7fd4fd, 0x8cfa93d31f191af8,
+	 0x281ff3daf11beefc, 0x11098e7cc784e9f6, 0x1f8492390e824bbe, 0x7c6fcc6124616877,
+	 0x2c8a33dc217ae896, 0x5b138def681fa6ba, 0x4767e496ec65c124, 0x72d8f8bd51a87cae,
+	 0x22b7dbf81d6ec0bd, 0x9fc18cd9701d1cd4, 0xcbff6297f8a63f78, 0x168a32e356fc23c7,
+	 0x4af7e01a7302a4c3, 0xfcbb53b0b0130b1a, 0x88da1fcff965e5a5, 0x39b9bc90badd6c16,
+	 0xa8e66f3be2e07d7b, 0xe225e0c6458abc67, 0x1e6b6df172d53a0d, 0xa23d36e737ee634c,
+	 0x4af94146a53da311, 0xb9199d0927a766b7, 0xc367d57e5bd02b73, 0x769fb42a299100ad,
+	 0x9926eede12a2094b, 0x4b5ea7c333de0b15, 0xb7480f80a0f33449, 0x113a203c0017dee0,
+	 0x395ddeb692522e76, 0xf489787e12beab21, 0x18b2e808ef31c2f5, 0x2bb8a10aafe902a3
+	},
+	{
+	 0x417097416ce3a9d1, 0x7e3bb2a12777b341, 0xec97336527fff265, 0x73e7958b5bae694c,
+	 0x34d41f1305eef936, 0xcdb219ad0266ad67, 0x82754061a386e2cb, 0x8a105df783098c79,
+	 0x35588e336175189c, 0xc4d34d18f6325a85, 0x463278c697a4f612, 0x21a28fafba96c535,
+	 0xb8c107c0c859ea0d, 0x2d02ab7a0e11d79c, 0xbc49b6c9dc9eee4e, 0x9715ff213944cade,
+	 0xa75f8d7f4683dc68, 0xe7f114c37f909516, 0x0b46725985c668e9, 0x5fcbc82a96fe9676,
+	 0x7e356532bf748ce4, 0xdba5c37d1f9f697d, 0x66bf98bfef1cb229, 0x6a7c8f3741f9569d,
+	 0x6a22b029b5ad1e10, 0x9a74ec024600b8d6, 0x8dfb17ad88d4ef39, 0x7228b66e38088f3b,
+	 0x13fca13623ccd868, 0x41d5672192f99a6c, 0x9025aa9e3416af71, 0x33077cc5f839ba72,
+	 0xaf1c51d928d59228, 0xcd5e51e8699d2b7f, 0xc8dc24d043eb2f2f, 0x07fd41b383663026,
+	 0xe7c787f7d36e647f, 0x409ace639ed3de3c, 0xd2c62f8d0e037765, 0x7248684022880bcc,
+	 0xc37ba2718614a456, 0x256b85d64e064ac2, 0xc79eae129e7df2a4, 0x0c3895c1d9922fc7,
+	 0x4a4234d1885bc791, 0xb0c674d2f410336e, 0xb5130183abb90a91, 0x0ec79e4dd8298eaf,
+	 0x14a24892a02131bc, 0xebc6a6f8c44cb4bf, 0x205838ed8fc83c81, 0x48f3b431a93a9c44,
+	 0xcac99d2e674fb58f, 0xaec1e855a93ec7b5, 0x87a3ed1490988593, 0x71e335975a9c1c00,
+	 0x9cfeda2a338eee70, 0x71ef3b91c49f30d5, 0x0f94b5112fe60b40, 0x61d71859ed7b76b2,
+	 0xb1396061bed62a74, 0x565b05e31a052d08, 0x2c262d9b3f263c5e, 0xb3d918e94e34f9a7,
+	 0xfbead059d0ce870e, 0x54d95141b95695d4, 0x37375399212ca32d, 0x286cab0d5cd3be74,
+	 0x1c0e10503cd8e60b, 0xeed2f2302f2f07ca, 0x2f592f7606923e05, 0x39f66939c1f203ee,
+	 0xd8862183c1734753, 0x6458e217ea143777, 0x17b2fd5aa81bdf98, 0x2f11f6e277959480,
+	 0xb3b6200db2e5ad9c, 0x5e20805a62124152, 0x745e34222dd44f6e, 0x93c28cdabecf2130,
+	 0x8bb4d127cdb29b10, 0x26d8924707e8a351, 0x20dfbffb9d4c51c7, 0x2b8ab9b90671106c,
+	 0xd571c19c9ddb8ce4, 0x5005e34b5b9118ab, 0xab30013f31eea69e, 0x494d61725d85d523,
+	 0x03b6c5789da076bd, 0x70204d8609ad73a6, 0xe241950111203a65, 0x8da3f7a6d2f1c375,
+	 0xd326efc5e9c2dc74, 0xed99e00b1604aed2, 0xc228aec8117a0f80, 0x0ccb453513636c83,
+	 0xd5df3c72d2e340e9, 0x4a131f0e65dc67a6, 0xd39d383b54f1a271, 0x0dd0e6f693f7fe52,
+	 0x6a5e74326c1ad67b, 0x97dec3b293b1488d, 0x8edb90d689afab85, 0x534fb814794e569f,
+	 0x821a6f516703009b, 0xcbf50490f240c6c4, 0x9ff0ff6979330be8, 0x3888c6effa71bf74,
+	 0xb1a932d5600ccc86, 0xa9d56f029ddd1203, 0x86ecdab4a636433d, 0x92e18a929e40e238,
+	 0x9b2c0842a10ea055, 0x0349fc0187b18b56, 0xd5abbe5af2ef5d7d, 0x652a1bad50e46a1b,
+	 0xb86760c7ae841b75, 0x5727de7d7ba97263, 0x4aa54359fbe0ff1f, 0x75b906ef50cebe16,
+	 0x7fe10ccb1d63f8df, 0xf7de5120ba516ac9, 0xecf421c1b4675d5b, 0x171c6bc9c9bc53bd,
+	 0x3028788c5cd7ee2e, 0x995b2b92e1fec544, 0x062066f4a7bd88de, 0x3867550e239ee1a2,
+	 0x77ec76462c639f6f, 0x91897bef1678e428, 0x74f2f6c52d444f57, 0x83557c3b21117d21,
+	 0xbbb0fa02b05766fb, 0x253b2a8381aecfe6, 0xe52866d8f9ef1eb3, 0x5dbaf15b515fbb6f,
+	 0xb1e93e6fa7d7b0ee, 0x1bde218fc59a78f5, 0x26672692777bfb7d, 0x5a4e12c96f6493a8,
+	 0x6af8e76c47d5711e, 0xf31d2173c24512ae, 0x08f8caf6940f0c52, 0x247771db88dd8f84,
+	 0x1fbdfd6425c1b1d1, 0x811be0a08f1d9d38, 0xda670fd93e869f65, 0x46787941a6f57ad2,
+	 0x43b1861c5bf2cc2d, 0xfbe322ad5c8d1fa9, 0x8fbf0cd060679a4b, 0x226bf50751f145d2,
+	 0x527e3bbf1bef8c55, 0xf85b116712e3e72a, 0xf2ec2ccb850fe73b, 0x7c7996ba3f9403e9,
+	 0xadd15b7ac693fbac, 0x574f4da42182e0e4, 0x5e8a86d50b16806b, 0x024bdc7336a94ca9,
+	 0xbbd1a699929d1014, 0xa3372ae7b163b02f, 0x07ae446e08404bd6, 0x3b1e9f55e8bb6ef6,
+	 0x1a9d26f9e4f6fe22, 0xb302ef14c3bede27, 0xf8eec8108f307da4, 0x0d7ec1bdbabafa3f,
+	 0xfeae5a8145268fe4, 0xd045c3ef36af208f, 0x163a43afba469613, 0x18576d32866ad9cf,
+	 0xbe9ed709302770ac, 0x8b37236e6564b3fa, 0xb788a2ce9454165b, 0x92c56668b8bc282c,
+	 0x05a770d15839e839, 0xf3e488138634dae8, 0xb95d5b7dc882458b, 0x00be3fd8d17f5dcc,
+	 0x3cfbfd56590d6ba1, 0x56a12db7f982cc02, 0x82c3e424fdebbe6b, 0x7d81e224f9de8e61,
+	 0x9cdad14ed59abfb7, 0x53c6454ebe906b6d, 0x9279941a5ad80dda, 0x7caa6d9d4bd946d7,
+	 0x011b7e59bdea99c4, 0x4f85869318a12691, 0xa77e448b4d45cc67, 0xb4301afb7db519fa,
+	 0xdad24427489bb453, 0x745b8a3dce8b48c9, 0xf640338df7f0d14a, 0xa3731a8bcd05e9d8,
+	 0x4714b39282e7c82e, 0x0f991d5d8808bf89, 0x7a2e9a7b9d2a7a73, 0x337e83c99a760ef9,
+	 0x9e0d5ce8980100d1, 0x52386d210ce16af4, 0x46c8cceb4696edb0, 0xb191d3e3ef0190e3,
+	 0xb4bb029bf1818d51, 0xa5185860d39362a5, 0x6fed904309d99682, 0x872283d8c7378344,
+	 0x56dcbb9654da0533, 0x7ac22eb8d9fd3619, 0xaef7be8652ba7603, 0x092bf01c7d64b061,
+	 0xbfd786e4e7c8039a, 0x47365bcd4e55c7ff, 0xd616c4f6dd9d3f0c, 0xb523443d842725dc,
+	 0x2e3f27c0ecdc557d, 0xb6b922081bf78faa, 0x0c3292cac4b911ae, 0xa0e70bcf927b1b0d,
+	 0xa28e96b4ba5f6f1a, 0x19e6476e16cf4b6d, 0x46ccb62ee8fcaa9b, 0x0c93779bb45cf6c3,
+	 0x1f236bcfb42f0da5, 0x9f46905b021bbde1, 0xad5efec282bece9d, 0x2484acd21ba5b3e8,
+	 0xee063042c6ba7645, 0x506077bd770ae400, 0x76bafad0d1bffcab, 0x50adf47d35fb7594,
+	 0xa9ae4725f3a8c6c6, 0xdc6343473958d168, 0xd3ead4d1bcf4f512, 0x7c9cf829cc2c04be,
+	 0x7156e5a22d1b388a, 0x4b05bafffc78f8e4, 0xf4a6bd169c5ebf45, 0x5f5c708e5b8584db,
+	 0xcd8be982043fc313, 0xc8c0481aebb010f9, 0xc10b7a8bd06be7f1, 0x16f1cb234b134151,
+	 0x13b3a01db7168084, 0x3720ae80fade185d, 0x19679ec508b30442, 0xacef734670dcda46,
+	 0xf8fb787f8f72658c, 0x299b8d3b4bac86db, 0x2bb4aa5f78691099, 0x6328d9f11ef58da6,
+	 0x6485ce260b6242d7, 0x6bf669738d00b4c9, 0x3b4fe949d396968f, 0x122d41bbc8044ad1
+	},
+	{
+	 0xa547acd9ff28e696, 0xdfb5f91799ed86fa, 0x7fc0ffd4080fbd95, 0x0c35317d0150171c,
+	 0x36d3ef49c8b488bc, 0xb66e2138b3fd3b27, 0x48129288c7232621, 0x50916e1b1987236b,
+	 0xc335985901abe156, 0x219116f6b2ca735e, 0xbed72b8efe69d056, 0x8165827ececd272b,
+	 0x9a563a868ee9374d, 0x72a3ed6444cbec1d, 0x007def33e64dbd2b, 0x8f447d90384dfb92,
+	 0x004b8c34be120428, 0xcf28de2be9d10346, 0x7b1b919665373d74, 0x92bc4a9117d19afb,
+	 0x63e6061ae1ca7c44, 0xe836c3e48c0840ff, 0xa7b6790015749143, 0x7d5de57ba1233605,
+	 0x1cae9513eb4c286d, 0xa0cd02e3edbf11cb, 0xef3ab9913db360b5, 0x141b110f84d4aeab,
+	 0xba625c3ecafadab9, 0xed9e9b7471c258a3, 0x922418a92036645c, 0x220d3b92e661bc0f,
+	 0xaef316b66a85ac4d, 0x138bc0e3a440954c, 0x43152d92db24f6f1, 0x2071b36062f4dab1,
+	 0xd11044adec5f7039, 0xacc454acf1b8c9d5, 0xf0bc5dc611073d62, 0xa50b335fe8ca16b1,
+	 0x8f7a96cb4a221749, 0xb378d7947f0494fb, 0xf29de5a7b5c199ae, 0x017b28188a9dfcf8,
+	 0x815cff094291dbc5, 0x3f0d61a480bbf740, 0x73af99e0b587995e, 0x9c9c1d13984a605a,
+	 0x4683ad3f545b910d, 0x12f870a92910799e, 0x480aff9b0f547348, 0x2cee1b3ac7c823da,
+	 0xd32f72c348c91582, 0x5c41710ea1df02ae, 0x29f0b1f845e71d82, 0x3fa492feb2640d4e,
+	 0x42865e835640d084, 0xacfeb33bf1442adb, 0xc5568a4c7048f2c1, 0x86ed786cb3ae7278,
+	 0x708a216b5cbecb72, 0x80a594a96da61763, 0xd41e14bfd54f57d3, 0x543100ea260eb293,
+	 0xc2412b95ddbe2145, 0x8b2cf9a0c0f69326, 0xef4b861b26dcba8c, 0x3679bbdd05127ff4,
+	 0xba4489b86899f0cd, 0x962c78c42144e1e5, 0x27e3f571e179ff5f, 0x9aa0af685b9ced74,
+	 0x3d5aa021ae0ea61d, 0xe9d9835f492300d3, 0x177487e7302bdb29, 0x81c0f78c620d0b11,
+	 0x9f1be6285d2f8310, 0x92066bdceee015ef, 0x6010c3044b933040, 0x97d6ca3f81968cc2,
+	 0xf10c727f31d8d6b0, 0x3644e28619ac7d9e, 0x6ab1fcb036eb1010, 0x0f1cbbb7f680b4b7,
+	 0x7afa64774329e97a, 0x1e9f1c65ce701a61, 0x839798b4f971fad4, 0x18f06687fa8ed767,
+	 0x7853005f5a7902d4, 0x406d798c6f4a4a3a, 0x64e2eee892836695, 0x5e8a7f8419a87639,
+	 0x064727d3eaa0096b, 0xf96acda1bb343fff, 0xfd66266173ead896, 0x1e86b81eaaedf36b,
+	 0x6599e45826db639f, 0x7470962231d13f10, 0xa765655969daef43, 0x51deb12bd665e455,
+	 0x603ce0e611c500a4, 0x4f969e4122ecfd41, 0xc7784c386a22450c, 0x2a53a63f34caaac4,
+	 0x568d4c34699ad942, 0x83cc9bb73f46990f, 0xf53592eb8dd61ac5, 0x5a98cc21e3809636,
+	 0xb7de572d14b5e7df, 0x30c268cba18bdfa1, 0x135cbce5ff19bc22, 0xa4bd5a49d60ca964,
+	 0x1956294fa662b946, 0x4f4af30451e2a2e1, 0xe9137b8d29d20583, 0xac2e15d5b60b8b78,
+	 0x6f3387a1b02c9c9e, 0x9b887642c32a8d9e, 0x1c7dbd380fbdc42d, 0x6609e885885cd975,
+	 0xa83292b4fb9dc8d5, 0x70c17c8f0718d49e, 0x8412a5365903a75b, 0x33fce3ec94c31e25,
+	 0x1142bf699628bd2e, 0x7d2bd765f8bc697f, 0x1bbdc3e3c85c1cf4, 0x0a80f50787c1e928,
+	 0xb9a30f7a1ce968ea, 0xcd93ab9665bd8270, 0x259b6ed4a37939d9, 0x893e2500f2a89e94,
+	 0x98c3eeaef6a3248f, 0xa6ae0e9722314fda, 0xf521f2059b8cae2b, 0x3709a691a1431612,
+	 0x1c0ef65bd2415c73, 0x7452c103028aa4a8, 0xc06707c6fb01bedb, 0x44e29eda3d94602a,
+	 0xf410215c46fb9f89, 0x3edfdf1f8c6e4ac1, 0x7befdca0332d1940, 0x1e3546358605f5ad,
+	 0xe243ccb5af721b4b, 0x1e3447e4fb843313, 0x80f3faa589953490, 0x80bfa5d17e68417d,
+	 0x1f7f3b9a27a54f06, 0x73fa6aee4063ec3b, 0x857baf3fd6177b90, 0x0206e2f65156770a,
+	 0x2bf7187bd49e2805, 0xc10525ae0e8e8c57, 0x9e734a7217023270, 0x07bc1983c83c355d,
+	 0x5ddcd4387c2bde7d, 0x2937ecd43c5e84f1, 0x336cf39fc8a4c209, 0x5702709e2c9a188d,
+	 0x56fde6397a4db303, 0x69fbc35904d35074, 0x684d6bd9f3e8fded, 0x7e47e1e8ae109b09,
+	 0x4b7b2126215e26b1, 0xfced846f2eeb9d01, 0x0bd12407ac571aaa, 0x14e41d80539edd80,
+	 0x22554b809bfe3cb8, 0x5bbb1ab51b881453, 0x86f79f7138d7a862, 0x1fe64dc3aa012797,
+	 0x89eea2643b317574, 0x3a6871767954f669, 0x25086473e41cb12c, 0x85ca29102f24c924,
+	 0x4efdac04b5ed4b45, 0xbaac6a27af45e983, 0x2e568e32a1393da2, 0x6328cb7ec57e4bba,
+	 0x7ed3d1fb27cb6e74, 0x5afa812610388573, 0xa32aeedeba6e8c13, 0x817d5e86abcc1ec4,
+	 0x1c89f92da9b99c67, 0xc60c8c4d39fda91d, 0x4e8586080ae811c1, 0xad13a437c43052bb,
+	 0x85a854a5c263e3a9, 0xb459f440ea0fa054, 0xccb358f9ee18ff7d, 0x06a1468cc17fde35,
+	 0x062e42696a84a834, 0xc7fb04d55f32330e, 0xe6a49700d0270e8e, 0x7a0c13a845e09570,
+	 0x5d906644adb8b78b, 0xeb016d13c2a96f18, 0xb2f6679a7f7266c5, 0x31f6494309799528,
+	 0x4bb475905736faf2, 0x126df8b39933cdd7, 0xda243024bc58958a, 0x67d3e702a6a433b9,
+	 0x1909c06a00cfd7c5, 0x934783d2e1264b59, 0x12ebe5b022cfbb23, 0x5461a90283d411a9,
+	 0x1ca211a752845d3c, 0xef7bfe58d6b8f5af, 0x37fc9cb7641c2598, 0xb499587bbf3e8bc7,
+	 0x31096bb553cede69, 0x898ca399de4d10c5, 0xd41229a2addfde3d, 0x2cd836a0851a1ed4,
+	 0x1573915c1327df6d, 0x276a3f84b20589b3, 0xa5aa6a8a51b3f6c7, 0x36178f81a042aac1,
+	 0x023f7dc5c2179fac, 0x3801786a52cec7c3, 0x62118706dfe7adac, 0x192ebebbeb88e568,
+	 0x02bd8051fed073ae, 0x4e420c8713758d0b, 0xd004cdf5103262ba, 0x921f415de9710481,
+	 0x4fa8dbf469de8613, 0x1e3341863eb643e1, 0xc8f713cb7cb600ff, 0x0136e5c949b8f998,
+	 0x33733c13e032493a, 0x39f691612ba98126, 0x94db0d3bf63a6e5f, 0x1ac3e5d5e670b961,
+	 0x52caf954a8e9a424, 0x7a809643e808dc9c, 0x47bf062571b54043, 0x7d9095c571710179,
+	 0x0ee59ce335bccbc9, 0x638e7875b268590a, 0x624c6c07813259be, 0xa0cf56ceb54e2416,
+	 0x3835721102d329a3, 0x103f4dbad86e4e2b, 0x593ca6868b4257b9, 0xae403029182c453e,
+	 0x6ed8b1f01a6de3aa, 0x8f594510dc1386f0, 0x67e14038c9f4b88c, 0x154807e52a04bae4,
+	 0x1e6582879b77a716, 0xcf56a1abb833fa84, 0x323d7923669277c4, 0x671740258e8e479d
+	},
+	{
+	 0xc840af46ff8e1524, 0x36e123aedac47005, 0xc55aff0714ae6af9, 0xa616c5d251e9225d,
+	 0x0464c3a7cb3f237c, 0x2de2a98866344200, 0x0028b55bf06dfd84, 0x6f50d73529ea4c82,
+	 0x3b6045935bfbb038, 0x909306c3a0912dfa, 0x9f658f5ca2159b8a, 0x60c2174d1b0cca2a,
+	 0x6f2ba53c39ec6d74, 0x14e1a435cd1ee2ef, 0x29128ce69589f25b, 0x1f8c2620dabf3b47,
+	 0xe9b94c4cb6132e80, 0xe73036c27d780a1b, 0x7a62ed3524ec9768, 0x1f5003a3d42fcc9f,
+	 0x0e934185822a1675, 0x23d661d836b2baaa, 0x50f8c22e02e87407, 0x11d0029fdfe54a5f,
+	 0x9833296e7a876837, 0x8367664c93c497a5, 0x247c02db2d37c8fb, 0x27ca5dfc2c0b5465,
+	 0xd649f051d275a403, 0x4152964511ae9ad2, 0x5dd54a87388c2b35, 0x4832d2d9e7d1eb59,
+	 0xd3a65bd398534873, 0x0b10c63862316663, 0x65ea78b57b4c5bed, 0x9656ecc0d3ee5cdc,
+	 0xfda8641a49d5b4d5, 0x4fa7f9ac26a7e894, 0xc6f990033105c543, 0x8fc358558c301430,
+	 0x9be41c6f486ccbc4, 0x4cee13d3da97d83e, 0xfa8e2b9ca8e2f303, 0xafe0b2e4d8370b8a,
+	 0xaeb518e74f684f25, 0xcc8bd0746c2acec0, 0x271d42ffc3c5ee84, 0x6a2669c1c7521a78,
+	 0x6698413a4e2f3b80, 0x4fcebc6bd174c162, 0x6b95acda8d6fcc22, 0x1369b3e210a5b251,
+	 0xbd734bf1f6db208d, 0x86da02555ba86de1, 0xcf15b1cb1352856b, 0x0c775296d856bb23,
+	 0x481c68a6df9144bf, 0x686558441dd2b856, 0x927e9ab26b49f40c, 0x0d5c8e27d4f38394,
+	 0xb1e38ae787445b6f, 0x028d9628a4024866, 0x4be1d63d8cb0938f, 0x6a9e60ea99c579f9,
+	 0xaf65b131eede9d07, 0x3fbf3e4663fb484f, 0x602359139b9a9a03, 0xaa5599c048cd3826,
+	 0x57b81422d656b370, 0xc7bcdcc0e43cc98a, 0x393b883d56c07b6f, 0x1fb25baf1972496e,
+	 0x1d07c5cb4d3442fe, 0xac1538abcc754e3e, 0x1a2bef403b6f0974, 0x5b12d66cf0a9bb36,
+	 0x0ce233ea156b4fd4, 0xad8a60971c11ec34, 0x0f82ea52994d0e2f, 0x0e7d2195b5d09f2d,
+	 0x256f02f5ec3b2e0d, 0x11e6c5d497f7a209, 0xa9835442d2578f75, 0x34fc77e43baf9329,
+	 0xbabe5eff93c7861b, 0x8a81a397acdbf698, 0x02df7e6daf3a024c, 0x21145c8db8e7fa6b,
+	 0x6c0ea4eeb1670345, 0x7e730ae6828945d6, 0x8f235cc321809c1c, 0x611be2a888c7b136,
+	 0x867e8950d876b43a, 0x932e12a851df9596, 0x8903ac8e1f30cb6b, 0x7ffcb2f0cc7239a7,
+	 0x8b247c55d0401b00, 0xdd2ed34124bf0e27, 0xa82d9ca7b35b40ce, 0x3a0ecac46e76cf99,
+	 0x6d7421b706ff0430, 0x5ed4650b67decebe, 0x68d7caa77dd44d0c, 0x7a9b487e6d382773,
+	 0x8997988a97bd4874, 0xd1c03ed07b49e2f8, 0xa4ec356df5674886, 0x6ca3c71d87ce2c4d,
+	 0x35ec354d48a737bc, 0x3229b1d6ba150ad8, 0x32b88b358677eec6, 0xa8c45ce76c47e0ae,
+	 0xe10d16c5ae7b0609, 0x14a9316f6a67e0c6, 0x373a8faad9c440d4, 0x19d156630f898d38,
+	 0x7cc6c0b11923b73c, 0xe1affffe47af3ed4, 0xaf9aa70cff7561b3, 0x5b5e50329c2b2b7b,
+	 0x1bcbe81354e3df60, 0xcba0183b5aaf864b, 0xbbcfd73e97e664df, 0x6004f3be14ceecc3,
+	 0x34c4dfc6205a83b4, 0x86de6da435add220, 0x6d33a23588a82994, 0x8c7988a654462d00,
+	 0x258b5747c6ac1e1f, 0x96a991c05889d296, 0x67305cfc52a67b3e, 0x8c459bd9ba5448d2,
+	 0xa30e0e5b5f834eab, 0x9c0076da748f3c86, 0xec80a1679b6a1f6f, 0x0e5f8c593f75a481,
+	 0xc0f8bfbe3e787189, 0x8aecc44ef5043958, 0xf76e41079c2a35b4, 0xade7d5175d1cfcff,
+	 0xf562aa1d203d6c26, 0x81c6103c72874f70, 0xe25fdfc4c8a44a48, 0x26159ebc558f694a,
+	 0x16a9c85ab94754d4, 0x44fca19bef479bc4, 0x4ee2db138ec16004, 0x0df60c1877916e7b,
+	 0x3cb71c525ff7dfb4, 0x3a88c8bc3f2182b8, 0x6c19f0eb8c4e0a99, 0x1f6c314ae6c527f2,
+	 0x8cd36afffb6c9ffe, 0x165cd2e7c0b66650, 0xc14cb348789d83db, 0x561c03f71e8359cc,
+	 0x5e54430084eb5f66, 0x620fe74ed496c0e7, 0x340fac028e8e12a2, 0x7911512cda392b97,
+	 0x9967cb0cc286c29d, 0xca9a6afda0b65cba, 0x4c31d99df3810b36, 0x4cc7b6cc8627b076,
+	 0xe1832e84f1bcce26, 0x84eb9987190a13d7, 0xbb4d9e966bd61a39, 0x268224fff6ab83bb,
+	 0x48cf7ad7e4a527fd, 0x44c314ca36b31599, 0x7d8c6b715aa241d3, 0x6c6105613ecd576d,
+	 0x642af9fc971aa546, 0x0030a2a639af680b, 0x5993a4424118c309, 0x1c9452911f591904,
+	 0x88b8bd71c6b51d98, 0xb0c3dc8fe529476b, 0xc9d85e406e10cc09, 0x38602af2ca398d13,
+	 0x1c2328167985aacf, 0x892322402e634962, 0xa01232c2ef46e831, 0x7ea658f47afc35bc,
+	 0xa9f65236b3d67784, 0x797abe77ae79f2df, 0x8bb6e85709207ac7, 0x72fec3d3cc3bb8c6,
+	 0x6d5d5d8b7d7a61ab, 0x0eb98d56a2e57499, 0xec9a8aa4c1efbd29, 0x47e2760dd71724b7,
+	 0x5f6f32121334f245, 0x74a652752aff8a54, 0x27e57e21737f1c98, 0x70acc37c7eb0fc53,
+	 0xa31c73dd2e8838d2, 0xbb7716bcc8c0710f, 0x7b23664a8ed4f24c, 0x58df23b71ba363ef,
+	 0xeed67e03d3c6e16b, 0x9178cff2457ac11b, 0xc07bec24ea6be8b6, 0x551fa0a444ece5d3,
+	 0xb23c0cdfc5094ab0, 0x8c6322c49578f5af, 0x2e4fb2492cedad77, 0x79d02cffd1e6f312,
+	 0x1f6b6d3102e5337b, 0x8b661ff5071985ae, 0xb0cb0a3965da74ee, 0x78e32d589301dc45,
+	 0x6374fe1fbbe27ec1, 0x290449fe6a62b798, 0x4aaadc5c73940d86, 0x9aaf6ddfbc9fc772,
+	 0xe672c9b8dd39a88d, 0xbbb1390ccb7a27e7, 0xafb66f9004c929a2, 0xb4eae412842c54bf,
+	 0xfe409b68e823fcfe, 0xf3a056a4f22c8306, 0xe22409d4d39dc1c0, 0x34509ca093a43dea,
+	 0x7ba30ddfd4e06851, 0x3c60b128184104e2, 0xdbffd8953560fd30, 0x177bda8e89e16568,
+	 0x9b091fe7c192ab99, 0xb7cd181ea368827b, 0xcda38be09962f8e4, 0x0c492a4d9293142f,
+	 0x4f905c577e9ee1cf, 0x1195f3b4bcd72be2, 0x5bbbc99d980b913c, 0x1ed06c1155ccfc54,
+	 0xf7c778a49c49bc5f, 0x146ba2bd2c8b78e5, 0x3f940e8e0f756d6b, 0x18748181043b1975,
+	 0xe8460e93ae7551d7, 0xc9da2552b8eeaa82, 0x7106c284b0b93f0d, 0x68d5a4764af2d8c4,
+	 0x4eebd17e61e9a127, 0xe3e7fddac5c24d0c, 0xe8bd39ba9d81a76c, 0x6dd53a2c2e489a06,
+	 0x0d87655fef5a7aef, 0x47ad389f6e4d4344, 0xb58cd683e9cfceb0, 0x9ff68a248adc4ac7,
+	 0xf1c648445e8c2807, 0x83d11fe630d01d64, 0xcc919d7e2c435c64, 0x5c057dcec9303cf4
+	},
+	{
+	 0x00fbc867233a3b71, 0xb7d0825ceb909a3a, 0xc778daf11174c0a0, 0x9c6b583f46e6f19e,
+	 0xa566662012f71672, 0x3896a9a66e2cf57b, 0x4086c64aab0cd080, 0xac87c01740450bcf,
+	 0xd6e5f2b349f4bbb8, 0xff00a6e050e6a8dd, 0xc04a499fb5525e53, 0x3555d1013acb9062,
+	 0xc41f0e0cdf40d1d4, 0x0ab2708522ddaa73, 0x12b61752421bd818, 0x52178bbd438aea46,
+	 0x623925f8b67953f1, 0xb9fb19c2b8f38be3, 0xb7f1c792379398c5, 0xaeb2db33d884182d,
+	 0xa413778d023896cf, 0x4112b19fa053e198, 0xee29cb13d2129168, 0x5e107406e9015ea0,
+	 0xc8b00c2be1c23f04, 0x42c5437b7d432c80, 0x45298e4b43e92fe3, 0x574ce49569d893c5,
+	 0x41810e451aaa4486, 0x6f772b4af883d8dd, 0x1e6758ba0bd926d5, 0x6c8b1e567a8c5bad,
+	 0x61ef21b50360de94, 0x3f84de9afa86aa07, 0x94a0f50771be2b6c, 0x9f3200e3047abec2,
+	 0x299d15a2f417004d, 0x69e802b6c10fb776, 0x0785940de37b05ef, 0x7cc1e8567a094634,
+	 0x81df79c6da423ba7, 0x2f67d3a7814c4e12, 0xa3226873bfbdd88e, 0x7e19d7a7139c5246,
+	 0xeb683bc01534df4d, 0x9e2c496d0ed31245, 0x95699e616ef9b738, 0x83c303ef1b6b9f86,
+	 0xa782cb884c4b2500, 0x6c20f169d9f225ae, 0x50ff92903273f188, 0x0118f2125c3b2a93,
+	 0x6d57d3104d587197, 0x143735591e64da2b, 0x356c12a27ec1d64f, 0xae8f63f5b3552083,
+	 0x5b5307cb0cea8a21, 0x239b00aabcd469b1, 0x218e631b4eb5fe97, 0x11d6d3d5a3ff0bb6,
+	 0x39448d621fc8c687, 0xecf7e8ff771e7261, 0x875a7d996dc74f11, 0x4467477c6069cdd2,
+	 0x083539d32f092697, 0x3c41052a868ad8e5, 0xe974c5b2d838fc9b, 0x8c57e95ee0e9a110,
+	 0xe8eb830c248bcbb4, 0x20758e2f541b02ae, 0x73a9e56afb310229, 0x830e2593a6c14cb3,
+	 0x98d4e9f991715997, 0xee6d66ee1dc91c7b, 0x907d3a35fce83255, 0x6772ce1a30d55ed1,
+	 0x285cc10b191f99b4, 0xc8d91decfdce34b8, 0x976cc9e7ae5f50bb, 0x176b73c4a903c395,
+	 0x983d362cdf1815f8, 0xf126363e2802e752, 0x67daaf688bd9465d, 0x42b54e1eaf1ce83f,
+	 0xfef87f5527ce0903, 0xf7212840cd24c95f, 0x8da9ba512e5348da, 0xa8aa312b2d813982,
+	 0xe21dfbed9618ce05, 0xbfbbddff8af622bd, 0x532428c504522eda, 0x57aa596852b906ae,
+	 0x447a8b065cef6649, 0x3137cc1b71a6afb3, 0x6381aa25cac45a87, 0x0c7c506b5ea542d4,
+	 0x640e2c0c943b3530, 0x34dea7a783d4bf89, 0x4a9af784ed13acba, 0x7afd1f1ce1fa8969,
+	 0x1ed88469b7ca42e6, 0x5d268614af6336d0, 0xd91bff6114fbc0ee, 0x11f93573ffd200bd,
+	 0xa9184490a476b48c, 0x2cfd9749f644c398, 0x6a88ccc1490263f7, 0x94a4d86f3a7957c1,
+	 0x64b822dbca2c8a0e, 0xd0788412d13320d3, 0xff2d6680eae22fdc, 0x956542c3bc57723e,
+	 0x4e52327913e151bd, 0x3f6492919d21c830, 0xb2207432f51fe057, 0xa0100d47212e2f67,
+	 0x6cea28b2d7309462, 0xb498a1d8feedbc89, 0x1309903343bd7f0e, 0x419ef3a78396d4c1,
+	 0xd21350f427a96c6c, 0xfe07d81bc9d26a6a, 0x1a0a50039c8b9291, 0x611c1feb3e1b35d7,
+	 0xaa471a1bf4c06dfd, 0x4e3f16138f7a443c, 0x9e593211aa5ce6a0, 0x182479e24a2abd55,
+	 0x469aa75fe56604af, 0xe944769c93752f9f, 0x71bc24933919de39, 0x395c7de2a1ea56b3,
+	 0xae35b5055a82a410, 0xdc241adf299c265c, 0xf9a4a3723d4d1dc3, 0x036c099596045a4c,
+	 0x5555d294ad3fe07f, 0x5f4919a203c62c72, 0x7c2b1cc6952786ef, 0x1a270f2624b1c96d,
+	 0xf7809d7b108142ab, 0xb8cea4a1d1d85f4c, 0x3d9659aecb3838db, 0x0417a5d7352b8e54,
+	 0xb845a5e23b2d6baf, 0x9bcc1b883824c017, 0x75040a664f5145a5, 0x5c45eb2b6d582683,
+	 0x53e80925d621c66e, 0x00b65aa0574afd31, 0xde7b2f75ef9f5535, 0x1853c53e4271b2af,
+	 0x94e920d3eb4ffc4c, 0x5fdc843841dedc5b, 0x0fe0c6b62c626250, 0x080094862290ed35,
+	 0x7d35c5bed9dc39bb, 0x24eb4c82c47ebb92, 0xc1243e66971206ed, 0xa9f03133975eafd6,
+	 0x31ccb517ae0cce68, 0x05f554b77f6da386, 0x45ca3bbd7e111086, 0x7b540487c2c88912,
+	 0xed0be3ae930e5fe2, 0x2363b4b2da619565, 0x1d119686435f1351, 0x758135df25a81105,
+	 0x15d2fd94b4b92c3f, 0xe9da2caa76bfc8aa, 0xb4858606125644b6, 0x63748aa894806652,
+	 0x083d76ca414ce131, 0x723686eb124a2a0b, 0x22e09ba56fc2d8b3, 0x4f80a237019ec477,
+	 0xfb303df87ae0b7c4, 0xc0b1578708c4e416, 0x2a8d7dde87ba02ee, 0x4735d5084b9d6e76,
+	 0x5057ac54afaeb030, 0x1baaa23dce15d0e0, 0x097ad0bd3477166f, 0x46925f1bab0d7133,
+	 0x88ad69ca0c25f29e, 0x0b3a6576c57a41e0, 0x23aa502eeda2434c, 0x31eaec9e3607bd2b,
+	 0x7168543125cea5c6, 0x959a6c2b82c9b864, 0x61d5e4462b2298fd, 0x5648734c5f82c158,
+	 0x48c1e8cad73a4af7, 0x01eab4cdea2ce3cd, 0x47421a75b9125d23, 0x6be89db60785d451,
+	 0xa18923dae4e4efbf, 0x2e981e2642de248b, 0x80d1991cc26edb78, 0x44ba1fb318ae115a,
+	 0x87187df9c435f650, 0xf69b1f58c9aed20f, 0xcd8c338c4b5daeb1, 0x580ac319f23f00d7,
+	 0xdb0cc7ecc027c935, 0x6509b4dfce0b22c3, 0xf5be0ac2d74e4a77, 0x42026211c4a6c355,
+	 0x11dc36228690cc4b, 0xadab493dd2c2b2b8, 0x14273f2a77ee54fb, 0x9c4dd0e92780ef34,
+	 0x1d274e1373e71b65, 0x1bc06242cff364e7, 0xd3a5915962ba2b57, 0x06c4d024b4f29b76,
+	 0x24a68cc0830c5d80, 0xfa5d395e642a6b9c, 0x231d524255b705ea, 0xafa6a1b78a3b1bfd,
+	 0xe8e5c4b63f99e94f, 0xc81411fd1d16c182, 0x972a4b27c7193032, 0xb3737772c211e1aa,
+	 0x52c5b2261e015ad8, 0xb9fe2adb4ed6f9f6, 0x294c0687f5fc59bd, 0x86f2f69acfb56ac0,
+	 0xcf6340c0e53f2290, 0xb7d5d8ecf8987f83, 0x1a2d0c469adaad1a, 0x2b6e1dc1df6eb7dd,
+	 0xb01c5b0dbd80712e, 0xfb3239f1fcc1d2c6, 0x14d65cdb4260cfd6, 0x893425dd99b6a24c,
+	 0x92211c394c4bc6ae, 0x23d45971b0b45b78, 0x03937fc48f3ec58e, 0x2f9c259a3f93fbba,
+	 0xb43e825d282afeda, 0x2dfc054bc4d900a3, 0x3248d291c1fd040a, 0x802150db354ff599,
+	 0xf2b18be6fd699e52, 0x461a29f7520e363b, 0x8e6e86bc1e9a9474, 0x8c67f40ddb8e577e,
+	 0x846d9583028c5558, 0xbaffc4f3a9c41023, 0xcf6a4bef6d0fdb08, 0xacd4c6be1f8ee645,
+	 0x4439b3c3d55ba06c, 0x0de3c0a7797dec9f, 0x7e578459f8324355, 0x0736d243b0735e5a
+	},
+	{
+	 0xd34ebe02694dacaa, 0x6d86b95209ffc497, 0xd8e583b1da1d475b, 0x767525e5a5948ff0,
+	 0xee10f7456856e413, 0x6ed4141fa4d0cfa1, 0x3c3d9195f714cc94, 0x108d5dae33ce6a67,
+	 0x6bcf5b724b207c71, 0x2b5b8a1c3ee932c8, 0xa7764bebc6e3f334, 0x42b374a74d1368fd,
+	 0xf40008210a9f785a, 0x8828a581ce5ef146, 0xdf148181fc5421d4, 0x032b4fb2803ac0ad,
+	 0x8444d005d9e5c81d, 0xe7407ad765a3ed60, 0xd3dc4c5e38110fa2, 0x2e7ebb115b558fc9,
+	 0x4dd49398bf19a7e5, 0x0d15201c0f96bc4e, 0xb1bcd264c5fe552c, 0x6b720fe21f897f5c,
+	 0x42dfb12f0f5f22e3, 0xdf213d3ea1376710, 0x783394ffb18af3cf, 0x5038a736cea625f7,
+	 0xe61de1237e083731, 0xe9b488020d9dd425, 0x4892faeab80bf8b4, 0x7c71eed5d756a47b,
+	 0x081b2c768c8ce980, 0x35ca19e9254709e0, 0x125f1cdd2faecdcf, 0x1246f790f7b3be63,
+	 0xc3f90a384a4340da, 0x80f3c53ef73a044a, 0x4398bd75c7d98aa5, 0x8c7f44ae3ee1965b,
+	 0x7f737d40b1bd8baa, 0x5bdd69667db6359c, 0x41e5693e37375048, 0x02f56f8115890b05,
+	 0x09ec9d92380742e7, 0x506037fc04be4a88, 0xf099769983206093, 0x2c7aba9e188686de,
+	 0xe470aa9a87be3f50, 0xe547af530c197616, 0xdb0a23479196530c, 0x6bad341f7c2aab24,
+	 0x97ae3598b36e5b40, 0xbabf3d9946459bf7, 0x77c7ba2288c5177a, 0x8ee6fe378e33827f,
+	 0xd0c08b3262c8fe2d, 0x3849b76b387ec7c2, 0xe9b02e3cdd3a0993, 0x3e7e7986c27a4dc8,
+	 0x9f9d82d454cc44bd, 0x8538e04bbf39f88b, 0x1d6385c1f6d0c7d3, 0x8cfad44ed8b1d433,
+	 0xc824b089ceb62a2f, 0xf807b246b31d2da8, 0xb90e659bd61d6bfc, 0x06a2897f23de59b5,
+	 0x832960a5e53942b9, 0xea6e328c20c10ce2, 0x078ef118ed7ad927, 0x574d538208edbc39,
+	 0x73bd343a054c371d, 0xc6ba75ed24a78eff, 0x1a160742d4a8cf6a, 0x84c91207606bb15d,
+	 0x486758ac9bfbde7a, 0xcf4f5e4c15a8c0e5, 0x4cbe2c52e8173346, 0x44272175ef2dbd74,
+	 0x0240b96ddd02a498, 0x130ee17144d41e03, 0xb7a6c2f6b69182ff, 0x0cbb49a1e7ac173e,
+	 0x61cba2d29ecba1d3, 0x657ed7ff709a3a66, 0xc1aa8f627a5b0711, 0xae8007800c452a33,
+	 0xac67972d0d760f0d, 0x65e8fc7e5fb27427, 0x44f672247b42e05d, 0x0d95d2d7d5531bf6,
+	 0xbc9a1198fd6456cd, 0x23573c488ff8ca09, 0xf42efd7d67d5d92c, 0x209bdda835fbb53f,
+	 0x73f0a8e5a7cab560, 0x3781d1ed9067251a, 0x40976d5069af11e5, 0x7aafbc110248a3dc,
+	 0x358c9f4a837f1adb, 0x31a440c054fd0538, 0xf7446235981aac61, 0x76e2e25ec794602f,
+	 0x65d5a130c27e8346, 0x0b64236f45c6d7c3, 0xdd934282bdb538fe, 0x93a65a6862dc5146,
+	 0x097a74c5901b0488, 0x8afc88e8ff03b347, 0xd769385e9ae1fca5, 0x217b60c451cd7683,
+	 0xa53969ec56974f4c, 0x8b85e155291bdf72, 0x7155b308fade8f89, 0x42d8e0bbb5e25d24,
+	 0xdfd4ea5251c0a427, 0xec04d5024312a3fc, 0xd87d3e3770a29d43, 0x7709a5109499538e,
+	 0x949cfc3c96d09b94, 0x0071c2279ff975fd, 0xa76882c0251cfc8c, 0x930be3511619d463,
+	 0x06af6c953060e775, 0x0ca3ab1ebf245e8e, 0xaa438ff4a4698996, 0x6c53e090a0b534af,
+	 0x4f6bed3477128444, 0xa61dddffc80cea99, 0xff5504ccefcc7061, 0x304ac4206094e082,
+	 0xe3f190619914cb98, 0xb9c0e97a4579cb60, 0xbfd8ab5e7873be75, 0x0ceb80eb5c07a0bb,
+	 0x1b600db113e6c0d4, 0xe9bd27f48f8a0331, 0x6a80ac13c872308d, 0x558025e227249e0d,
+	 0x666efe9f9fa8853c, 0x41f32846f2a61803, 0x39ffc929cf4869d4, 0x677f956662dfc454,
+	 0x66c64bbb9e20aadb, 0x7899bcd926f42344, 0xf7ee80e4845bb062, 0x6dfb21e53a82ba23,
+	 0x1564b6c7b06eae4f, 0x81939a031f6ac511, 0xfb1f7b09ce591a64, 0x7fef7d03ac3b797f,
+	 0x447b39656338a666, 0xf2b3777facf3f72f, 0xd93ad3bfdd535654, 0xb03ef78f764c3a30,
+	 0xa4e724dfdf759b9c, 0xca4b292fef826ece, 0xe3ee44651002c206, 0x89b2084e60ecf335,
+	 0x44d266bebf485230, 0x1df11ebc5bce4c4e, 0xaafbb740a9f70b69, 0xa63db69d86ca6c74,
+	 0x2f780ee034bece94, 0xba2c994f528c573c, 0x400d5d5a6b642031, 0x2dc4ef5f5808619b,
+	 0x1da283dea03c093e, 0x8af53629ff3fef9f, 0x10108c3b99909004, 0x81b454462f92b3f5,
+	 0x88f86600d6e813e4, 0x6c801502445cc10d, 0xec3b8446476b430a, 0x2f0f91ca6598cf49,
+	 0x73ec6d13ad7bb7c5, 0x98d6a42b175ec752, 0x349f790aa5f2f92a, 0x0862b9fdb054611f,
+	 0xd0a9f215fcdfac32, 0x4b715a880ce1e4c2, 0x4f32bfab8de0f37d, 0x1ea6ff723fddb889,
+	 0xdf2bb65de650a836, 0x2a900c73c857c482, 0x3993da46802b3eba, 0x4deb9227b07581d5,
+	 0x33b84731d3ac1634, 0xdf132fe3be7791b4, 0x159a7733eb37ea9b, 0x5f7d4ba71544578e,
+	 0x627956033410db9c, 0xb0a56cb614ace946, 0x067064ff50b98e8f, 0xa8f3a7525b5d7d90,
+	 0x90165cdbf1e5e03c, 0x0cd60f8b6cb0f727, 0x8ad7fb3ed664d287, 0x2f3995abe4cc1993,
+	 0x4c87b35a2adee225, 0xd1ead51c4a30d733, 0xf296282e6e34e283, 0x632085b6cd6245e4,
+	 0x2ac907b05d8f70b0, 0x5e09777acbd54a20, 0xe2cec7d6a93341cd, 0x4500ea91327f183a,
+	 0xbc684a3b5279bbe7, 0xdf085a7d733c59f6, 0x035c1924d31df61c, 0x7a9f75b3d0e52c1a,
+	 0x0205f05e7c089164, 0xa0ced61fa3da5179, 0xa5cf1a68f962c1f3, 0x7516bff54e2c7f47,
+	 0x61236dbc9040194d, 0x594e2a8fee34f8f4, 0x497fcb7b192a2780, 0x1225c1bd423857c6,
+	 0x482b930f493cf98a, 0xefddb5911d62152e, 0x61c3cb7a6e136ea9, 0x1ee08c7638c1c6af,
+	 0xb1f94050fa31dc29, 0xfe16977c2bb20a1f, 0x59feddcd314f9c60, 0xa6baef9454ad59e2,
+	 0xc1805c566670855f, 0x97ccd4a03ac0add1, 0xe1cde09da3e49d4f, 0x5af174cde27a7981,
+	 0x48d14f0487caab21, 0x869d8fe6ffe0c8d0, 0x6c76cb694a7ab39f, 0x18534e8462d32294,
+	 0x818bb69a89e399dc, 0xb389ca5b9743236e, 0x87cc60723d2f4027, 0x367364824ace13ad,
+	 0xfee4b72ba23c93c1, 0xe5f8ea241ab5b59a, 0xcb45c28dcd829576, 0x33445eeab88f0792,
+	 0x8cef9595c2c81c79, 0x87bbf7b8cd09ba4e, 0x096b084d75877b71, 0x61d3b60cb58943c3,
+	 0xf35fe43775d761d3, 0x00e96da833c12a69, 0x1accbbc838bca88c, 0x6e9f893f4d3c186a,
+	 0xd973e39ebe211b34, 0x709151fd2d49b21f, 0xed4595a9e6786f49, 0x01483ed31e1b8f60
+	},
+	{
+	 0x8a48a1215e658c00, 0x378a355e949f7728, 0x30918ab5e0d8e015, 0x95e5b873b546fb8a,
+	 0x3f548debb201a503, 0x459cd2770eb78307, 0xd8aa31dcb0e1a802, 0x4506e62f8c26586d,
+	 0x85f62c39dcfc03e1, 0xa8f1fb9654e6cdf9, 0x45d7dd5dfe5281de, 0x49100606f5407822,
+	 0xe59d779b505da254, 0x0f325afb104ecdce, 0xb7d490e69fd51e4b, 0x6d22602ad48a2ecf,
+	 0xd66772f3c08ed26d, 0x30c2fed535affcc4, 0x17e905cd06b94dc3, 0x80cd944c6e4a75a1,
+	 0x47a3345adca3a0a1, 0x7f7172e9a358910f, 0x9298cc6c40131832, 0x13ec53846e20efcf,
+	 0x5572b0dc48309c9a, 0x7b06d4b8e0512aa2, 0x9405d3cb9611cbd7, 0x0a3934588b2b49e2,
+	 0x869ee24f5bd11296, 0x91be187833e17d7b, 0xdcea6f0bfd496633, 0x83a438aded4a06a1,
+	 0x2bb10609ba05b1ba, 0x6d3fa3a20b8b98af, 0x6fc55d0d926a0e17, 0x0f90ada29b9784a5,
+	 0x18f63170b97dc101, 0xd48090ca4a123999, 0xb53980da791d5e08, 0x45d6f1d5f0f75cdf,
+	 0x609251d4db501ce7, 0x04252755ccb5be32, 0x3a7f323c70136e21, 0x4485fa9ebc550f48,
+	 0xceb0f3f8c9204183, 0x96b0a4fa23172ec7, 0x2897c0f7e10cd450, 0x17ecd60b2d056246,
+	 0x864af97aaa1d8730, 0xcb744d595ac5da50, 0x728e112edf2b0a7d, 0x15b83306414155fa,
+	 0xc1a3a4d9d2eaec08, 0x339c89e66af54abe, 0x779b2b9ad8b39510, 0x2818a143d1eac0e1,
+	 0xfa96e949f9cc7b7c, 0xd73f4a2681f23c6a, 0x41fd4f6175341ce7, 0x3dbce6fc245224bd,
+	 0xcbe3d414bc0ef968, 0x1213d4816732c8b0, 0x8aed624907a0ceff, 0x4835f1e3b750e612,
+	 0x8d14dd06ddb47948, 0x3b5139a60f16fc7c, 0x43cb5bf37e9ee4d6, 0x0c1690d46c38f135,
+	 0x3ba4f7df4b6382a4, 0x1e33f032b63a03b6, 0xe8c7e5507d6da973, 0x30762b51a69777b7,
+	 0xa3968c46f29a0544, 0xc367a5aefe693856, 0x2740b8659fd3175c, 0x8b0f589388ae38aa,
+	 0xd642c78d7771711e, 0x2a3778d96889a143, 0x781c816f8feecfab, 0x37d37c89e34de83c,
+	 0xb4cd7e3f02536c68, 0xbec1be85e20447a2, 0x5ff3b5e05032679d, 0x375d999f46436700,
+	 0x2232db35e4b462ae, 0x0f33e03623eba2dd, 0x907310407c29537b, 0x6a662c17e801476c,
+	 0xd095f40e06c696b9, 0xf15c2684550241d1, 0xffd674a33b0b3017, 0x1a77b2b07e85eeef,
+	 0x11431da1ede0b3f9, 0x8203393527ddf7d6, 0x2b5935ed87027311, 0x46c8a8de58cba559,
+	 0xdb208532b86c5165, 0x20176f8e507d45a5, 0x28302b6206e04e68, 0x9ebb0627c1fe6447,
+	 0x494102ed57b0090d, 0x522b46ca5f7c4447, 0xa7d9b6362e6bfb81, 0x23cbe186c9c44004,
+	 0xd9555289bf03ca7c, 0x5fac3faf9d24ee78, 0x82b9a167112578de, 0x586736488f59473c,
+	 0xba24fcdc4bcf80c4, 0x4af4036f7d6ee8ff, 0xd79cf7c00eed92d5, 0x634c6436717f62ba,
+	 0x20eb582d7ae7dd4c, 0xd7a47b5ed84ef8c4, 0x26cf72acf790f3ba, 0x9dbe543c92764f7f,
+	 0x00ed011c988ef8f2, 0x0bc78b7af141460e, 0xca78d888253b24b0, 0x1b7c3a36bb5d5c7e,
+	 0x6fce4f3d986c5f42, 0x28142dada612503b, 0x73b4832a01b41a48, 0x9fbac1611f42fd82,
+	 0x5d6185a9656a7791, 0x118623054e8cd073, 0xbec0b1f8fda037e9, 0x367700b3ade566c9,
+	 0x3065d56e71af9ff4, 0xdcfcc77f0b664091, 0xbc4b9cf241c9458d, 0x0cb74ec9b5e44008,
+	 0xe19e7776286fce84, 0x73393250e77ea76c, 0x0e8e96be4f454cbe, 0x45974ff767309715,
+	 0x0343e9a971efcaac, 0x74bdb105196c0ad0, 0x17bafb97e71440c0, 0x62ce634f9096e15a,
+	 0xef9bb0e2dfae3202, 0x75f1a135b2b02fb8, 0x18402ad4bf04660b, 0x011c56423c270d78,
+	 0xbfc60041f5653524, 0xda16142e66e381b4, 0x7508a3f5c77ec93b, 0x9f5e48e5a2738d34,
+	 0xe7e1caef91b52731, 0x32ff12d519d0a59a, 0x43d9d48a4e10d6e1, 0x8660305872f08591,
+	 0xecd619abe4da9dbb, 0xe047a4251d4812c5, 0x5624ad3abce4e4b4, 0x031249b465963eeb,
+	 0x388edb5fa40a70bd, 0x91dc41d6c24ac011, 0xefab4788a7962d10, 0x3403e356320f5dee,
+	 0x5e1bdbd774e14f5f, 0xaa21ceff46d736a0, 0xcdcfc245ce1a2bf7, 0xa691212c6cf2d765,
+	 0x166b8581c59b3f49, 0x4ebc9334899dbf1e, 0x8ba8949c4cb6a3fb, 0x45281b9a9b45042e,
+	 0x0231d2be01d5e17d, 0x80f5b775dc0bace5, 0x34ece828f001ca05, 0x5122dd3abc330a88,
+	 0x3a920d3e5278c6f9, 0xb41843bebb860f27, 0xd3edd164f03b05f2, 0x0bb8e0e2e0f830b9,
+	 0x6fea17620491b974, 0x87552e29916b41e7, 0xf9b277cb346439f3, 0x5c2a9e2d0c977f11,
+	 0x39ca70beaedecd38, 0x084ad0b547e8584c, 0xe34c0b8cd910b2b4, 0x8ed2a1bf7ed0acdc,
+	 0x0e0e502e3f7cf298, 0x463167827342dd09, 0x258aa92d0aa0d75c, 0x7b6ab8b3499a8267,
+	 0x9dff8cf3ad4f13b4, 0x9c739a99484fd35f, 0x0bd930dcaed35b1e, 0x0c5c94cf8398a690,
+	 0xfa5a85ac107351d6, 0xf5115f2e8468b35a, 0x5f08c46b575c6454, 0xa811623198ff0a15,
+	 0x5d5c8a6f57af90cf, 0x25844ff3e7fddec6, 0xce5b32f56a835bc3, 0x83e73bd65e2a322a,
+	 0xfce220c4b3e4b188, 0xf8283ff85895d856, 0x38aedc33f0892923, 0x5f7f4399c92c1f28,
+	 0xeb2dfbf71eb26f30, 0xb47d8614f03c81d2, 0x950a873e1f0b459e, 0x9a25b8e484e0d48d,
+	 0xbc33345885acd845, 0xe203707c6d7e9a27, 0xc0a98d57fdc7fe61, 0x19650f3250ba8c4e,
+	 0x511e8df2d0d4ff52, 0x0397021f4108c553, 0x2a44a73b922c931f, 0x1ca3205f51c149aa,
+	 0x186a05ebeb325ceb, 0x0bf2c03de21686d8, 0x2dbfa4172e91db89, 0x47a0c4081ec7a0d6,
+	 0x8cd4f925e843c66b, 0x53d6fad51d402515, 0x1be007ac425ff0b2, 0x335eacb2de39f84e,
+	 0x6a890a3a225375f2, 0xad88b79795f624c2, 0x3e357193ded02316, 0x1e5a1c819a1ed6ed,
+	 0xee024d1e4cb16407, 0xbeb5e2b05fb1405f, 0x82188d336bc874bd, 0x008e4526d9b1ac48,
+	 0x837cacc7fd83be05, 0x1488be872d16e853, 0x68a57166a774cd96, 0x9f8859375d94b041,
+	 0x7e6da77ed1cc0903, 0x1151b7dbdea54ec9, 0xd1e43bd702099646, 0xae26c471cf5c2464,
+	 0x2c79b884eec0fe66, 0x3d191852021b7624, 0xed8e5ddde0dd96ab, 0x8016d52b47d5c6eb,
+	 0x30fbba647c5e06cd, 0x828ae6314bc15969, 0x6878022c3f67b111, 0x011cdf1f13c0129f,
+	 0x858f6226d8c13e72, 0xdde8dfc67d239e1e, 0x838d2f05b098a54b, 0x140169c20e931ed8,
+	 0x358286bb4468aa0e, 0xe3cf4166c58183f7, 0x6ab015756fe6cefd, 0x0c977d4d7eca10cc
+	},
+	{
+	 0x72757ac0b8df25c9, 0x5dcf099f6ab1cde2, 0x3bdcae7d6397c5fe, 0x2a807c0310d17fd4,
+	 0x331d5cfb42ef1fb5, 0xf7423e2f7aff313f, 0xdd189924b4eddbf7, 0x4cea34fe5445e221,
+	 0x7aecc1bec886fa6e, 0x8984b3cf41d85f92, 0x8a6c442bb04d8e81, 0x5ce0807c0413b9d5,
+	 0xf2ea41864c45b6b9, 0x2dd5e17e1c3f5278, 0xc16a9d6913c16284, 0x5e7fe7e87a8205ff,
+	 0xd822d93050918fec, 0xe1cd3b7d02334677, 0x91cf2c4f9bad3abf, 0x6bd7c4c8a691f67d,
+	 0x0e1a8768143e8a3c, 0x3fecad3c8379d522, 0xb02b44833ce16a98, 0x8cf176259ac6ab6a,
+	 0x8ab5bd3b2e99d5c5, 0x6785b13fcfd0725b, 0xd8db0f1c5eac7c21, 0x5a44299bc71c7257,
+	 0x94c694ec8acc3e0f, 0x68195983f24edf96, 0xb89f518ac5f89345, 0x8450c5022b9d97a3,
+	 0x5704c7230211cc59, 0xf15e8bba803fb21a, 0xff82ef2107b96a19, 0x7f5749d7c1f17a82,
+	 0xe1572bedbf518748, 0x446d93d2cf7599a0, 0xd29485f560f77001, 0xaf2214c4dc4abfce,
+	 0x30cbd922943bf458, 0x623a3ecc46ffa8ed, 0xe1aa988a7fe9baa5, 0xaf963d8da2f66abe,
+	 0xaa4ae182f21f8c59, 0xc4c676658229109f, 0xd6f14dd8296257ef, 0x3fe2f6b5bacb70e2,
+	 0x70117e0f460e307e, 0x92bbc6c2f4c5177d, 0x2c2938a5c5326a34, 0x3429f99b3d4a2dea,
+	 0x9097ed4c6f20a292, 0x7649c2312cc60ea1, 0xf307985cc2b966e3, 0x5a77c063bc373246,
+	 0xa184d508ab484354, 0x7450d33cb0d9c798, 0xbcff897b412a147f, 0xb2e64e1f8c2d6fd5,
+	 0xd9bcc1d52fc6e4e0, 0xf2de2446b13b99fd, 0x41e8304f6134ad0b, 0x804d6339fe124ab5,
+	 0x712dee6a38e15909, 0xc7a61b89d77edc75, 0x221fec636b41a7c4, 0x36f8c906a2ec9b87,
+	 0x2669c8efa40a1d6e, 0x6dd38cd886cbbce7, 0x0933d4761f0df366, 0x2649754c2eae92d3,
+	 0xb609be00e026f17c, 0x4fafa96c2c06e613, 0x52974ee89e30b2c5, 0x7a7d8d2d4b870aec,
+	 0xb72b6ba7c56926a0, 0xca67038c5a0feb49, 0x14c6bae0e0c38ad0, 0x914f58ce56b3a54c,
+	 0xeea5053d6500a3ca, 0x92acc4bd02e51125, 0xf0a3a6c74edf4920, 0x550626307ef8d9fe,
+	 0xf15d7142157390f0, 0x2c198ce4122b1c97, 0xe3450523ca323414, 0x34728fd50dde9183,
+	 0xea1be5e6f09c1844, 0x37f958f202aac6d3, 0x72b1df604c0ba18f, 0xb566f9d8f8d67bdc,
+	 0x4ad933cc09900704, 0xfaca929d748032c1, 0x6c71119b1c571c25, 0x04b2af302ea9a6ce,
+	 0xacc8417f7628c46a, 0x22961744c9401b1b, 0xd2ca3f2b1447e646, 0x8a0f1b387b7a40c5,
+	 0x3022885a38551c4b, 0x1ce1b7e27ea3a818, 0x8838f0bf6d412ee5, 0x2d8b2291619a3110,
+	 0x09d0d9c6db547c32, 0xc73005e62acf07ad, 0x4e4b61e18da6f0e1, 0x90e15702ae7342e8,
+	 0x8cb1c1d3c5ca14ec, 0x41d1579815ac2864, 0x333d7f9026f8d577, 0x30ba4ceb5609231a,
+	 0xa38dea1a4b519c3a, 0xdadda9a781251782, 0xd0ccc17858d02937, 0xb33ba5e9ded99dae,
+	 0x9ae7b7ea2a6b5f56, 0x59a5f119ba2fbaa5, 0x52e75def6367c894, 0x87024884ed96f7ce,
+	 0x8d9956064213fb55, 0xdbfa88d44ca238c2, 0x54d54c275fc4669d, 0x78e56f3b78059f35,
+	 0x512166e7d009e29e, 0x421e34f0a9d1b4ce, 0xd3fa7ff8c8070b31, 0x7ec313ae5ea37c34,
+	 0x20db3b7741b2b8f7, 0xfeb7c46ca95de46d, 0xe994a2ecab32630c, 0x938b03b78e376de4,
+	 0x284d58215d1c6bf2, 0xc4f596c460dfc9bf, 0x3cad69873b23d4ee, 0x45111ec6d9f711dc,
+	 0xe2ce9ca9444ca8b9, 0xa7374c8b8679f58c, 0x1445eccba4d69a0a, 0x99b19c57a80c6b53,
+	 0xe3b0a59ad33626c7, 0x0e2b5213fd817fe7, 0xf48ba00bf2790571, 0x5965c26a6a0367ca,
+	 0xe8b601cd251313af, 0x2e1eedae6437fea2, 0x181164cc64b4ac53, 0x26f50cdd455e43fc,
+	 0xcedaffd32dfad330, 0x9786808ab3e5bb41, 0x670073af01c61660, 0x0cecb4be2273eb26,
+	 0x471a95b885eb3df0, 0x8fec4c7d8c9329a7, 0xf57d4e896780aade, 0x8849fcc3c0831b83,
+	 0x3c6ba13ca05985b3, 0x9ac6258624425c8f, 0x0d3de49d716ecd59, 0x1540cb0fd1422a77,
+	 0x10b30a30b76d05a5, 0xce741295124b12f4, 0x7b7048103eece955, 0x9e12e710fa0125c8,
+	 0x3c51c062cb9a64dc, 0x3b8dddcb3b831f7c, 0xfbe0fb0a704701a3, 0x2f700fe5f0569b04,
+	 0x3707c8c3f90b7081, 0x50094f6ff2b5d640, 0x67d215e86018ac88, 0x91622c1155a598bb,
+	 0x5ab0cd5e26b1e68d, 0xd884807fa8fdd110, 0x2ab7171c0fe875e9, 0x3e51ccf9604f385d,
+	 0x4131d0305fd14c7d, 0xcee7a50273fd95dd, 0x9402d22b56307be7, 0x5c6f35e238d5b4a7,
+	 0xdcc7fc6368329412, 0xda4e0b188daee02e, 0x849d137d60654027, 0x8d2ab5ef1e51e470,
+	 0x3d297d912099bc4a, 0x967e7d9e6b35f4b8, 0xce8d12cdde1c0d20, 0x300a86cb8d8545e6,
+	 0x8ac9c73ec77739ad, 0x28a7e9f3b75d5430, 0x59f9c04697723a60, 0x853077644dfaee9e,
+	 0xca6ee5ddf230c0a4, 0x6862fbe5ec404ea0, 0x2504ce11d65f4af6, 0x098cb6cf46701bac,
+	 0x8933e278ce2d65d6, 0x62a4300470c7e1cf, 0x039d3a59d3f8a0fb, 0xb1b67dfa1fb0cfb7,
+	 0x784586dba7ff7e90, 0x65c2be21ccd57ba7, 0x764dc92479a15a73, 0x9227d55e1a03899b,
+	 0x080d0aa6e7d59686, 0xc2878f4f0d232456, 0x55595b01a3a77aae, 0x26d171669be60d4a,
+	 0xaf86252b281805bb, 0xbdad1dc6c06f88e6, 0x621f80a27a3b3f8d, 0x3a57cf797d75a802,
+	 0x38b60f90bbed6b8b, 0xfb69f8b19c660c22, 0x5c2540927968a79a, 0x9e1dcd612294141f,
+	 0x60347210d865b474, 0x5fb8088093c542ed, 0xc05c49357e24fb9b, 0x5cbebb8a294a73e6,
+	 0x838bfa19148cc785, 0x1098b9869a9b6b42, 0x4720f7e6624f8549, 0x1f5f53cd4dc65737,
+	 0x6e597f0eb9972e4b, 0xb1346b2e865698bf, 0xbb568d20309cd338, 0x750f35c42f281d35,
+	 0x21c92b34fa2c4f6d, 0x48c1136d5905e477, 0xca898131a85a9a85, 0x23163dfc434fe044,
+	 0x17f9053fa19d5af0, 0xfbf3c5c01347f098, 0x3f16fef7d181af6e, 0x1b28b08b662fb686,
+	 0x568f38a388e589c8, 0x8dc5a6e3a57630a2, 0x087b74a733e944e3, 0x2f17fc6e75e3e038,
+	 0x6ee0916e2e20b368, 0x3a33dd418abfabc6, 0x4e3ab4dbbee149c5, 0x716a5cbde81025e8,
+	 0x8b98a11b9a99bdaf, 0x8fdeb37b1d4c72df, 0x199c5ecd397b567c, 0x4438a1cafc7cc2d9,
+	 0xef5c51c82a87b6b2, 0x5260baefe236073a, 0x21f5d39d3107edf8, 0x6c06682400a15813,
+	 0xf84873002d974be1, 0x52ec602f2e8bc3e8, 0x5fee4719487e1526, 0xb51b78add33e0722
+	},
+	{
+	 0x78131efbda694fdd, 0x489b58501b3f267f, 0x43272d9b6183bbf3, 0x856c423e02e8a964,
+	 0x7536c8f9f621501f, 0x1fe2e42172131bb9, 0x6c3e130eda9082e0, 0x4b23824b848b59fa,
+	 0xe435237d7a214cd9, 0xee6c12df54a5b7c7, 0x4363bad2e56f0bc5, 0x65bc49f33f81faa0,
+	 0x5edb6d367fbe20ce, 0x8088cd300dd06034, 0x409a61722ede1fc2, 0x91bfb2c63ac87f5e,
+	 0x167b34cee6b5973a, 0x50a2a9d5a36c5fbc, 0x7a8974bd0dc31a2f, 0x2698063fbf14d292,
+	 0x01e1a7f593c4529a, 0xc540b36754b61a2e, 0xf927f9b8baf51cf7, 0x7a460518ab3efd99,
+	 0xfc6c62c5be7fd552, 0x12580ec29c335786, 0xf793656b485fb91b, 0x88c593a5e832182c,
+	 0x367b7d87b0a3c96e, 0xe2f2b85edbacd205, 0x7e6829b85952bba6, 0x9fa78d95c04627e9,
+	 0xe90a02a635e81de8, 0xefc969a656200864, 0xb37e7373e2459ac8, 0x9beb6cedfae5621a,
+	 0x53045e18be1c5803, 0x057b170d0fb35b9e, 0x51ab655c69ce0916, 0x534fd49bc0b65d34,
+	 0x1d7a600a9ed77d7d, 0xa09e5ca1b507bf83, 0x5fe388e882d16dfe, 0x7d5c8ec2762dbf70,
+	 0x7af38dcc6355cfba, 0xd190cdffb584917a, 0x03e081a4ddaefa6c, 0x0929ffad7a351931,
+	 0x6c9a95c6b8173107, 0xc6b1b93b099e5baa, 0xeb88e41fbe0d2d51, 0x00c3ab80928c035f,
+	 0xa4fe0c828bb6ce3d, 0xddb6926662035a0f, 0x115e819aa0981921, 0x6133edfab36d8402,
+	 0x87460da2a8111ce9, 0x9a1111223482b179, 0x598e6407ec863e78, 0x31a1ba300f8b4768,
+	 0xf68e16ba241c98ed, 0x35322ff13032ef56, 0xfa6b1f11bbbc6744, 0x9fe58a278e89fbcd,
+	 0xea7835bc1e547733, 0x4ddf00467d78649c, 0x7380207b53e06dd4, 0x978959b3cdd4514c,
+	 0x27a2a0dbea727228, 0x2d878f4814ddb59f, 0xc0854841b9410688, 0xa6e1264c34ae8e7c,
+	 0x21e9b8818ae776e7, 0xe22fe1cfd769348d, 0x146b9b4126d5b42d, 0x3e91704c46e91092,
+	 0x81f9dc05ba91023e, 0x9a10d1e28de6e590, 0x2cae2e3420373854, 0xaaf2af48093f4aed,
+	 0xaedb26d134a5b4d0, 0x339d922f02e59ecc, 0xbad8b5b8dd3e6054, 0x2da252d59039fabf,
+	 0x70200861583070f4, 0xe73555508104488d, 0x5d225a38dfebdcbb, 0x150f5056a15e9ce9,
+	 0xcab064adb2de683f, 0x3c48413dbfdf5072, 0x3825d001ba0eeb18, 0x516c55e6171c8575,
+	 0x31e29aba0cf2e5f3, 0x3a67ed9434584440, 0xe7c0042cb64fb37d, 0x76cc5a82bdffc54a,
+	 0x49d8f6cfb5ad1b47, 0x600e6ea8fefbdec1, 0x59fe436f4d09fef9, 0x503ccafe7e13e918,
+	 0x5d67d055e44a2719, 0xa6b6e0692dcdf6b1, 0xc67744065944c31a, 0x12dbfa573d1f1a06,
+	 0x2a6b3c00d2648515, 0xdb8da1c998533d85, 0xb5db212dd0079d37, 0xaebd0245cd2168f3,
+	 0xb23d52bc1781a58f, 0xb49abf8cb31d72c1, 0x061627d39dd5b956, 0x7bbe7ace8234b4f6,
+	 0x1faaa5cf66d0a152, 0x6219d596634bf915, 0x1fe282ed9fd37ef1, 0x9199c298695f2015,
+	 0xaacd8d37e8829c50, 0xd81fcb7eb96da5fd, 0xce240dbfa7483933, 0x18ff2b58e2647dab,
+	 0xcba3743fd7947f12, 0x48c59cb0025d60d1, 0xadbe953c277da813, 0x7ce86226ca0a1b7c,
+	 0xca618860d9f50dda, 0x8675640a396ba7ce, 0xb0ac93854b115e0f, 0x37bccb4161cc4e74,
+	 0x7001328bca0c2ed9, 0x1c75bd155f6b05aa, 0x8cae6de22baa6abc, 0x79bfd087dd97c3c4,
+	 0x706afa7cb5d0fc58, 0xf3e936e1a377fd7a, 0x3c620740470396f0, 0x6ff7a6fefc9776d1,
+	 0x18ecdec44c21087e, 0x0a150467c9b4e68b, 0xf5b808d594bbff88, 0x8f6105b4fd5777a2,
+	 0x5b70d1430c045218, 0xfeeb0912533d85f3, 0x99ed97fdc61303f6, 0x2e2ca6fdb8957c42,
+	 0xaee83fa54219b17a, 0x18ed129e37e24467, 0x393fed66ee97a0d7, 0xa2e37c23dd85424f,
+	 0x74e7d8a709ecef8d, 0xc98e57d5d76c15e1, 0x39eecc6efdd3ea86, 0x7ead9ec6d070a16a,
+	 0x81e8bb80be1f7027, 0x0c09948edcea66dc, 0x829542cc95fe4369, 0x2dc364b02b91e472,
+	 0x2d79cd5f76ac5efb, 0xe2c809bdefde8cdd, 0x1def91664a85d481, 0x1945cdf07cc78326,
+	 0xf825eeff07a5dc2a, 0x3d1d5853eca0a31d, 0xe2ee8b88f9c6656c, 0x04eb4e737d0a2140,
+	 0x63fb6cda71178d7d, 0x95a210f08ab81c10, 0x4e70d17f1424a8d7, 0x5dc1171b4ba585eb,
+	 0x5d7a23c6a49cf7df, 0x239a9c12f2fbe83a, 0xf590030e65c50bbe, 0x7d300596511eaf26,
+	 0x3e414b9c399ca8ec, 0x9b09cebd5eb690e4, 0xee19ef19433cf32b, 0x8de6ad0c82b06b28,
+	 0x402b77b21a7523d2, 0xb27e6750ef0edf21, 0xeb6a0f6c376146e6, 0xb17c2330840030a9,
+	 0xf466367e8b168a21, 0xdc870b9a9fec0e5f, 0x6bcb4353e6e55d8a, 0x3b181df33f3d8861,
+	 0x692c41398d84a8f1, 0x61506c9ab204a887, 0xc22726bdaae906ec, 0x7125e409fe5087b4,
+	 0xea8c3a560bfaeec0, 0x027a7180bceb266f, 0x2bd93aab613ff76d, 0x137cb7c8d5c4b6c4,
+	 0xfec3b954f45aeef4, 0x4135c0c343109d26, 0x61264b34ee973148, 0x0b366d02a646a2ef,
+	 0x3daedb3a88b1887e, 0xf85df26bb98bd438, 0x9008950f1ab4bda2, 0x87fcb336675b4a56,
+	 0xed7650b801ccb18d, 0x16d044acec62b1e6, 0x2b0530256d932cd4, 0x86cdb135c8598245,
+	 0x8811f9c5a37dfe5a, 0x44463e9b9314c435, 0x2c3090444a8b37e2, 0x0b38ca4353157b94,
+	 0x9ec1974d693b4e9b, 0x5ad600e1e712ec4f, 0x8fe9490f7bcb282b, 0x48a8f0848c76f1e1,
+	 0x3a418a46a70bfda1, 0x3e2a0ae79196de8b, 0xf26bca7482a698a6, 0x756625c99f3900fe,
+	 0xe07be1ff3f7fffa7, 0xa024a4b89c6f2c19, 0xc25c366f4bae751a, 0x9ac2a5de2c49c4d9,
+	 0x716fbd82ebc37e91, 0x5ad03752937e5cdb, 0x88d6e0187cbb5c67, 0x4530da46898d0f34,
+	 0x7ed19ad038fd53d5, 0x0876cbf89660ee42, 0xf9564e7ab6230b20, 0x019097d8d4b22c12,
+	 0x34e2683e4db30e06, 0x9506eb9862ae8a0f, 0x063373b763b8146c, 0x03e35240504af5c2,
+	 0x2768d3c218c0187a, 0x114af91c0c7abbea, 0xe1bf37cb35277d97, 0x19c1f047942f9e30,
+	 0x0217a42e5861c343, 0x1255a1c9e73598ee, 0xdc4669011c5e189c, 0x46677dd721716640,
+	 0x93b78bf225a4b2c5, 0x1187627644f3ad78, 0xa2b499b70af460ba, 0x7b76c7ac50ee1cfb,
+	 0x692c6f8d12ac89fd, 0xfbc7080e1fe1270c, 0x1730b4e7d66f0c80, 0x4ea65aa61ad0e5c0,
+	 0x79744c92a2a97386, 0x07d812142d585e21, 0x197e8f0affef09e2, 0x2843432438d01457,
+	 0x919efeb18350e92a, 0x5bc15667606e52e4, 0xefb962b1264fc8f0, 0x42cde577ad5dbabf
+	},
+	{
+	 0x8ce5b5f9dac20217, 0x5c9a863ace158b45, 0x291552f57f053a3a, 0x9a710e9c09065ff8,
+	 0xc97be8ec3efef610, 0x740ce6b3927df809, 0x28b4073215b10cd9, 0x11360af700244976,
+	 0x8f59deab98b7e244, 0x6d000b9abb7cce2a, 0xd8c01d62545a2176, 0x4775afbcba4fdac9,
+	 0x53c45a118b282b7e, 0x27467c4558e973c0, 0xae19cea60d7c9115, 0x06a6740e0fb12f11,
+	 0xf23f52ae3eb3d8d7, 0xb13484cdd95da75b, 0xc0b159076623e9aa, 0x3ad478dde433f294,
+	 0xdd54034e7b724b8a, 0xb80c482e929a203e, 0x9eec69277e856999, 0x6f8ae7642ed805b5,
+	 0xe9c1dbc77b4db4f9, 0x921b22bcf792e2ad, 0xa202a7f87b22a7c8, 0x794fa3bff5078613,
+	 0x8d0d34c10c48cd68, 0xe7ad740bfeb315d1, 0xac4d816fa0cd416e, 0x7df618c7e19eb47e,
+	 0xb16fd03d5083fab4, 0x5ed2e74e4abb9810, 0x3dd3fc58b76a8c42, 0x83e3253ec1fd7170,
+	 0xcbbb31992f1d755b, 0x6d8bd96f4c22821b, 0x1f6709dfa314f248, 0x1975d5b390fdfb10,
+	 0x56c69b0662862bc9, 0x3e032a8c12428c99, 0xe1516d6927f2af9c, 0x89ba6ed9d1a73e6b,
+	 0x3e5c8d673f384772, 0x1839bf2a1bbdf97c, 0xc9a4ac573a5aba8f, 0x5346b1312d634b8a,
+	 0x8c08cc850a58e242, 0x44f480418b85031c, 0x329b0565c248cd12, 0x27c0ffaf97da0dba,
+	 0x75952a9b9f82adae, 0xa3e658817710bdd4, 0xcc291b6d7df9eebe, 0x378e3a27a27b3201,
+	 0xd614278d7077ea03, 0xf53932b707811f40, 0x8bb5fec8d4b1d4bb, 0x901fa4c450b8fdd5,
+	 0xb72433e009d51a6f, 0x057c104ea0b9be74, 0x7a2bd91efca4bb83, 0x95c7f5e3524e803e,
+	 0xfad5d5082c50b9e3, 0xf0a2ea930aca79ad, 0x0f1eaafd43503940, 0x42dc3657761b6c5c,
+	 0xe33d5519d537e871, 0xc10dce62a89c0c05, 0xfbd4b466a5d3f392, 0xaa28e0ed8da48b1f,
+	 0x968d69c79a7c283f, 0x2730fa7477e0f76d, 0xd65c10749d1e6dc3, 0x81a2e77e3a65777d,
+	 0xfbc66ff9ab769210, 0xe9074a52bf983c72, 0x3b2bb8529b1653a5, 0xb50c3e94da922c70,
+	 0xa1034052cb686387, 0x16cfc4bd5b831a51, 0xb79e24afd5a71a0d, 0x156ec5687c039571,
+	 0x7d56821a28187470, 0xb804da3059ce4f73, 0x7e8b5df86c70b25b, 0x12a8e82b04bf4d40,
+	 0x5fd355875b6ca2f7, 0xfefc279d7d244a12, 0x6e247b6c8ba96e4c, 0x58bb5b16cf9c880c,
+	 0xecee770ddaea5f09, 0xe2bf07f68e983930, 0xceeea39aea627f6f, 0x7881e4a5493e5d4d,
+	 0xac8778c990bbc2c3, 0xe589c8632fe84713, 0x615dc5d25dab2eef, 0x8efb700c7e32028c,
+	 0xcacb43849189ee2f, 0x4c78b44e1475b3cf, 0xe94bb0aa4b985983, 0x5de3e9c3da410fda,
+	 0xf9b41f058b03d711, 0x44cadcc110dc753a, 0x2c840aec0474a718, 0x92ac21f349eba058,
+	 0x5b6414cbcf8da7a6, 0x86d87d3323a54428, 0xaed37e8d30b0e52b, 0x7ef295c7968dfded,
+	 0x0c05d70b104ec0ab, 0x604254d6ba1f446a, 0x122a4288daa83356, 0x346444bd0d994640,
+	 0x6e663e223eac1cda, 0xe5561276831c4768, 0xe99f1b80c4639ccb, 0x18e76dd3de004cbf,
+	 0xc11654078e03e410, 0x23fcd92b4fd1281b, 0xe395df1276f085d1, 0x660414a308b2a8a4,
+	 0x1d7e3719771f573f, 0x3d35f612f063b5cf, 0x240901f05e444de8, 0x19de937254e9d725,
+	 0x8a7fc7de83377bfb, 0x0045fbf32e657e33, 0x0008a5b15d8d21a6, 0x7ce4b6556d32976a,
+	 0x8f49a473e625fc9d, 0x9667e0345f5c6df8, 0x4da4d1c56def199a, 0x69ed59b0489ee382,
+	 0x72ade45ace82ca28, 0x23c2a8941721422d, 0x754182d20180ec8a, 0xa1b39b10430fe740,
+	 0xb3a86523d396c213, 0xe702e3853587464f, 0xf1e267aa3e03d6fc, 0x05e1b694198a5277,
+	 0xd69fb8667cd4006a, 0x991c77a81b11d6aa, 0xe39e448158879cec, 0x3d54200c86bc9a3b,
+	 0x2227a5572d87c7ef, 0x411e51e35b6c8262, 0x730b2b20e7da7b39, 0x4ee3ad2868472388,
+	 0xa1cebc1d2db66ef3, 0x3a85b06f536179dc, 0x7f275751610ffe0f, 0x37d5d3db3ee2ccca,
+	 0x421c9ada0d2bbded, 0x219d02e6f3b18a02, 0xb901e7cf5e28aecc, 0x6fc0eee72b3e9226,
+	 0x3a5b5f7d5824f11c, 0x486568aa12fc49e9, 0xdc5feccf88f3c078, 0x0cf0b10c5bb55223,
+	 0x105ec24e9b3b1244, 0x48c5ecce4285fc09, 0x28a8278a5566aa04, 0x71a2751672c9c31c,
+	 0xd94117542a7edf0c, 0xe48299d128bb2a50, 0x4ccc92a0c0e3c18b, 0xac34dc39586bc216,
+	 0xcbb76d348c1a6d0a, 0xb82a1ad2fd3e513c, 0x7d17c5ae36037c86, 0xb5b8c7faccdcb3e5,
+	 0x7cde02c5dffd37ce, 0x86f32b182616d428, 0x42b25633d2125d6f, 0x3455148c64ae122e,
+	 0x94f62eca1f04584c, 0xf9cc1f02b0fa3d54, 0xa154c8610984a050, 0x79ffd145e87859b1,
+	 0x26e4585eb13d4521, 0x707fbf036057a7cd, 0x0ed81f3b2a25c425, 0xa26a76254c58854c,
+	 0xb3533dc644302714, 0x4c758476616ab012, 0xa750227e12b71d9a, 0xa3871410a7a07a47,
+	 0xd33e7c46d8407ed7, 0x492e8515979076ba, 0x3633c4223f8e2efc, 0xa7eba3ac73743adb,
+	 0x6337dfb315172bcf, 0x771388bf9c88c7e7, 0xfc96a83ce20c4286, 0x907d3ccb2c44fdb5,
+	 0xb3f1670b665b5b04, 0x9b4d69485468d944, 0xe5257cbb59cc07ad, 0x36a15cf6acf22a10,
+	 0x0404d9e0d6f6662e, 0xe5808c0f1ba67706, 0x15f58e20b28a5420, 0x8d5c483d27ff84af,
+	 0x9b560bdc67b46552, 0x98527c239d914d43, 0x085ae3d9e1040d44, 0x231de84c1c29e7fa,
+	 0xed9c8a01378e228d, 0x12099abdbcc5a2e4, 0x61873b713cb3ec4e, 0x341f8dfe032ab301,
+	 0x9b8c5ef92ef89ddd, 0x13abe47945e29c89, 0x41033f04d9a328a4, 0x26857b9aa1d29da4,
+	 0xefa1954cc079f47d, 0x7112973e8fa5de10, 0x9b20cfe7c024b39a, 0x0114df47ece08d66,
+	 0x1af1eba108c3804f, 0x005e21a34a501169, 0x0f1a353f7e669104, 0x48bdc2fb53bf48ee,
+	 0xc29d2fc5941cd339, 0xa695f82d0f1f2054, 0xf7066153d4c6c099, 0x7a533779529a463d,
+	 0x6d77ce5c0eb61595, 0x6149c804a6dfdb25, 0xd836cd6526e0f6bb, 0x976b6bd94de2e412,
+	 0x1ce00ff83587d377, 0xcbaa5b0a3d0f5771, 0xbfeb5b837c08d187, 0x0bbd77c39f20544d,
+	 0x3eacde47d544d614, 0x24d52b2579f64ffa, 0xdebf697ae148bc80, 0x2a787edda8718afa,
+	 0xfbe8f19828a59682, 0xd2214ae348e09702, 0xee827bacdf0e6d72, 0x6d7b10d75d8f59fe,
+	 0x83442de609befbd2, 0xd7b388159f9b3418, 0x42cb7a4d33033a5a, 0x70cc2092416193f9,
+	 0x1fb13f2dfc9e7f3d, 0xf7d7aeb91ff0470b, 0x5623f33f38336881, 0x9a032e78e016b03e
+	},
+	{
+	 0xcf63a35eb3570374, 0xce42f844d93330b9, 0x5dcbd9684cba54f2, 0xb487402ca9c09301,
+	 0xf5ddce3b26d89a81, 0x68d54ad37349ed02, 0x1790230111a6e8f5, 0x19679f303ca45af1,
+	 0x0abe4de4fe7ab927, 0x7e7e46dd3dbef909, 0x0495a6cb5e621d75, 0xa8cc15b8c810daf7,
+	 0x51f4729b6a79867c, 0x96e3d47f403a24ea, 0x01b0066f5efc6813, 0x5d3a123dc6f48492,
+	 0x0b713021ab96d3f9, 0xce7f479560a61aee, 0xcea7cf45ac002c42, 0x6a533572bc7550ce,
+	 0xd0f4fed748e1721e, 0xf4454a0aec693fcb, 0x42c28193e00f35b3, 0x7260db33852b435b,
+	 0x3967a19e77cac5a7, 0xefe575a1b23f7516, 0x4c25464fb1967493, 0x5c2fa3960194922a,
+	 0x843bab72c529dc77, 0x5b774738a3e54297, 0xea849732cce38da1, 0x58da097e8f5e862b,
+	 0x1e030c8478ca5eaa, 0xc7aa96a7068ca425, 0x6219ad09d0ef997c, 0x1f564584c3164fbe,
+	 0x76882898541ab452, 0xd26f33c43dff3385, 0x4edb234c22a01112, 0x4205d0e95f49696e,
+	 0xcf5d1edecbcef52e, 0x930bbffdcd079153, 0x6d3d5c2475a17ca5, 0xa6fba76bc729ecb5,
+	 0x498a04a54a2b8336, 0xc6369fad1da06f6f, 0x78ee081fa02b8a43, 0x206ca7b097d5c5aa,
+	 0x6790d2708829c992, 0x8cd1e19fbf76c7de, 0x3e4c45694bb985df, 0xa923baf7042075de,
+	 0x5d3106dfa0803460, 0x25ebd1f1c11b0647, 0xb14dc0d6be709c5b, 0x0b15cfff071e980d,
+	 0x1ee8404b6fe48056, 0x1db51e49132d24e5, 0x9776a3d473338ac3, 0x2a4a129ce2d54597,
+	 0xe56e42012b641d2b, 0x1e712f77d623aaff, 0x0137041d8684fdb1, 0x905ca95c334b6022,
+	 0xb4996ce7c9cf1298, 0x061ea7bbf7fd80a7, 0x081be10bebfdaf1a, 0x8da698a254b8fd9b,
+	 0xa98f1675cb750254, 0xb71e6c98ba031bfd, 0xf16c07a09f90e5da, 0x662e8e8c632928e6,
+	 0xc84f671eff40bff3, 0x6d6848dedd320d6e, 0xc7e16fa046931d34, 0x2de01d068fb1c3ef,
+	 0x6003316d9d8571bf, 0x1b585a840b0f161c, 0xd1ee445c3244a098, 0x418c4a4b859550ce,
+	 0x6f7f933875f2360d, 0xa10bcc69554a4602, 0x1b2daa8e1332a5f8, 0x75222c8b45f94be2,
+	 0x00f62a2a62cf48d8, 0x86ae2cc53e34be85, 0xae7fd0cbecd182eb, 0x92e2c495b9874eff,
+	 0x7073b654b7f273d5, 0xfeae89bcf527d400, 0x24c2e706cc9adf07, 0x894b09d600a0f524,
+	 0xbcd819c9eb96d47b, 0xb374426cd15a0303, 0xab580938d55b8736, 0xa3ae1961e2f8f41e,
+	 0x522d171083d7e7c8, 0x4a045c935c2afd05, 0xb68dd50f16cf76e4, 0x3bd8acf70adf0b31,
+	 0x2521f06a70ba1c69, 0x93bfb5acda108fb1, 0x99dd46701041d66e, 0x621f51dcdbe117bf,
+	 0x884c6ade3289c11b, 0xe2365ab6a954a098, 0x05e5e8045e28ffca, 0x41c7107be52404d6,
+	 0xda561f9d1a2b6ffd, 0xefe692492bad49b0, 0x3cb94080ccbd15d5, 0x188b87239bcc9ae2,
+	 0x212688fbbccf180a, 0x7179fe0c05b06b69, 0xe9fdf4ddfe6677b9, 0x81f97fcc743ce547,
+	 0x1b09592a3f8323f6, 0x9af99ec65ad30f03, 0x782d139a4a846b97, 0x7ca24aaa1b39d7ea,
+	 0x727e43f7cfe72002, 0x5a30b940935802f3, 0xe6e2b3fb038fadfc, 0x50b4240da46e626c,
+	 0x8199ce8b5d32e294, 0xd67eb613163633b1, 0x093cbcaf66550d14, 0xb38f528803873a0f,
+	 0x8ba39265aa14a7bc, 0x7be254b80a15fb28, 0xeb020871fff32035, 0x42112296524e40c9,
+	 0x717424d84f87d487, 0x7f6f9e0afca7003b, 0x2f7e21d381702781, 0x7a16d880021c79be,
+	 0xe98df9e23d73fa9f, 0xa2996d3ae56eef83, 0x81987c1b898da74c, 0x3c1e7a51bc3ccaaa,
+	 0x84ea12694b272eb4, 0x5fc1a30380d380f2, 0xca155392c1f97731, 0xad37cfc8fefad956,
+	 0x35eca58144a6e9cc, 0x258327b1460d6b59, 0x4d9f290e7eab98cb, 0x30886486bf4ae37e,
+	 0xbc5ce48a09f591ab, 0x6d772bf54b023a13, 0x421e1e921d95ce77, 0x4b754c9e723c8cad,
+	 0xa76f286c6efa8e1c, 0x8c025baefda9c852, 0x2b111f634276bb11, 0x6f814ec053c7471b,
+	 0xd0d04f777acbbfc1, 0x82d10232aa5607b4, 0xdd9a9e567c0dc8af, 0x20e7e08bd322d3f3,
+	 0x2071f951edb9cc36, 0x8652beb68fcd642c, 0x9d0db4a0395da805, 0x22525ad2002b03a4,
+	 0xbb2c1e810bf0dda5, 0x075d19c1b94ff185, 0x6bd34573147ce69f, 0x224c6c23284e87ba,
+	 0xab1969f5055c6a52, 0xda20e5aad3eb7aad, 0xe07b182cf45b1802, 0x16efb40ae141aa7d,
+	 0x095f9a3177b28bc8, 0x265be5a863df9221, 0x6c64a7d6b5e4ce8b, 0x0d64f1b91b396cef,
+	 0xe7344add7716ff4c, 0x21dc5cc0085972bf, 0x3269128c268ad96a, 0x8fbc232a3a4d82b8,
+	 0xc2c3292b37878fdb, 0x134bd9a1ae05749f, 0x03e563d6a0cba135, 0x81a5d05fdf15d839,
+	 0xf30e79eade4b56a7, 0x7509fe9012fd6552, 0x634518299195b43c, 0x490f822bb9706977,
+	 0x4d5c5167d73fb67f, 0x2397a5bdf450d0c0, 0x1146947088470e11, 0xab822ec58ce9468c,
+	 0xc1e925b6eb9e88fa, 0x044db94f88d27016, 0xffa95adb2c24605c, 0x31d7396c76954801,
+	 0xc94763d9dede4105, 0x6463b544f3d25170, 0x9d4dff21130bca4e, 0x82f271a7013a330d,
+	 0x38109af13521dab2, 0x0cfb6417a3b8be0c, 0xcc0834cbff9a997f, 0x2c7043dd9078e287,
+	 0x349619bfa0ad6ba3, 0xd1158e9e8235af1a, 0x8b60afecbaf56d2b, 0x21810eba921d0c7d,
+	 0x1d083c74c836c535, 0x9154a03043c32e65, 0x00e2ce21eb013da8, 0x7270fe5f8ec6288a,
+	 0xc4f6f5040ed192fd, 0x1bb325fc76bfc619, 0xe43aa27f93c197d2, 0x3847940cc8ef8086,
+	 0x8e5156ccd27c08d3, 0xc62dd0539b7cce47, 0x973d6a713426136c, 0x912de41d9db5baf2,
+	 0x64578a286eccabb9, 0x10fc5a6a9aa6421d, 0x9ff79fc8fb1352c4, 0x763097b3da115a64,
+	 0x2047c27566b514d8, 0xb68cce03ac32ad9e, 0xda3848981d6c883d, 0x5bf128fc3ba9369d,
+	 0x4b1850ae9cfafac4, 0xb4fd2c8623e0ded1, 0x9c7d57fc3015ec41, 0x3851df6a8e58f6ab,
+	 0xf7455eb99a1f245b, 0xe0569d7c9bb77348, 0x877709177335c4f9, 0x0191db6fe34ec100,
+	 0xe158a6aa2cfffb56, 0xe259ae1feb14eb4f, 0x1cb863fb5e811b88, 0x1f9f27f42d60a929,
+	 0x4ad6b48df371e12a, 0xf66c5254c6e9a33c, 0x282fe0e98e09736c, 0x003033e315ed4c78,
+	 0x09872add6bcbcecf, 0x84444b43e9e7ba44, 0x62bbdd4e17f9f111, 0x20702e691e28aa25,
+	 0x7ae934d4a41646e6, 0x07cd805453e4ba29, 0x2d4c4ddbcaec7592, 0x61d8d2e92d232ac6,
+	 0x7630dff86feaf91f, 0x471efcc57e0b4626, 0xf8b953f075f06aed, 0x8ffba6cb2c316f5d
+	},
+	{
+	 0x32ff11387ce6d0ce, 0x0f3a607978e030ce, 0x466e67611c3f9e2c, 0x4f8844532da9f8b4,
+	 0x66a7be9bd3023601, 0xb33c359c5805f487, 0xa54085007d928b74, 0xacd7200a785916f8,
+	 0xf1ebaaa7521f6592, 0xde328158b2621907, 0x0cabb0667337b844, 0x4cedf92ca1511e6a,
+	 0xd00108a28ba11207, 0xa0392ebe9a6c4fc5, 0x4110a11c68866e2b, 0xb175e2cc3b1a7694,
+	 0x9cbf9be98cb5312f, 0xa5ca693f5183dc9d, 0xe132a45e5e4dbca6, 0x1c6c7da2cadc9864,
+	 0x6f8d6c31c6471fa9, 0x5628df0233179ddd, 0xbf17489d297cb935, 0x88af13046abb222a,
+	 0x8d74489b18bd8128, 0x856dca518b0a57f9, 0x36de16291e9e9c1f, 0x7965539f57f0002e,
+	 0xd6bce70c298011ae, 0x35a88f63e791857f, 0xa8830317fe00499f, 0x60ac80f4f9ed1594,
+	 0x85a323487b79725e, 0x49e63f5ae0509f0b, 0xb24948ac9c6b8fa7, 0x130daf3d2c5c64fa,
+	 0x98cff905533905fe, 0xf67a9d38ddfd88b6, 0x39ab71e54b802137, 0x145998b15af71217,
+	 0xb78bfad176e45bc8, 0xeb31d9882e5d67ff, 0x2cf3f3d7df8c0c2e, 0xa8639acee70e232c,
+	 0xbb34f824bf2ffe4d, 0xf4e308bade2d4d71, 0xca27de3e789042fd, 0x22d8d8ba86482a11,
+	 0xd740eee1d8c19d7a, 0x540c1a7e7438a79e, 0x7f1405a3e06e56d8, 0x691941aa937eb4ba,
+	 0x1d83792df41292b7, 0xe0a1283e1fe3ed74, 0x28749f4e4aebae27, 0xa12c8737c3c66c33,
+	 0xd68465988aa5f685, 0xe936b85ac1c5d18e, 0x4bbd8c0ac60b1655, 0xadbd91ec35410e7e,
+	 0x5f8757d2984eb541, 0x46f97e4e4863d2f2, 0x8907cd6cf8422f01, 0x65b972c42db777fe,
+	 0x79261efedb9657ef, 0x43dc86691e5f367d, 0xc3f81b81e8de24d5, 0x5954017cefb92757,
+	 0xfdf09a448f904861, 0xcebff1812b35128f, 0x6381fc1011b987ef, 0x911bed9aa0c6e2c7,
+	 0x5dfdb68ee6ad06b1, 0xdb8c92f389b170ef, 0xed92d1bd7ef5d78c, 0x9ed254a65de7e627,
+	 0xffe71c2caee56485, 0xdc342622ccfe3a16, 0x781af2a921100264, 0x30c346dfe86b1d74,
+	 0x984ae5ea6ef0ce30, 0xe163f5e943598f37, 0x33423f1feba56251, 0x089a085bdfa24363,
+	 0xa42988ce177102d4, 0x25e3f438735f404f, 0x234630780e483b3c, 0x0b4ad7336e6f29b8,
+	 0x027ef1e3974a68aa, 0x2e7ee666e80abe74, 0xc2b2a824413329d5, 0xa6055d19f4537cb4,
+	 0x699c9835eaa6d9bc, 0x935101fcc1bf95e1, 0x0fc4791251796f73, 0x6d48df1297ffba5b,
+	 0x89b3d04c63721303, 0x86d9bf45b8d08561, 0xe4cdf1723c6e25e1, 0x20e8a77ec5259d31,
+	 0x6e58dea0f098ffa4, 0xe45786e0493b5055, 0xb1be70723d22b812, 0x7325baf060bbbd2b,
+	 0x0119617723fcd07c, 0xec2e91d5c3338124, 0x73135fd6f8e794c0, 0x6dae537c6ae776d8,
+	 0x859357239245947b, 0x82333b177e2c4aec, 0x1b84c54ef6615930, 0x61a7934185e5e83f,
+	 0x249b26fa4e4a9842, 0x1654f7b7fc25223b, 0xd32f37ea90300e94, 0x9fe905a2d9b25f22,
+	 0x20e91b486455c8bf, 0x6d7f7b566bf5df0e, 0xacb1339251fcc892, 0x34fba64e7b526aa9,
+	 0xcb34ba05ea62cf9b, 0x09117f4d988e924f, 0xcdc24650824f35b4, 0x710a1085b40b7658,
+	 0x2b5fdc004b61035d, 0x91a99899dc0a5c93, 0xa5c9413851022e75, 0x95beb8c070e509df,
+	 0xfbf72d254cafddc9, 0x4e3cd195e64607b9, 0x7012edba17f566df, 0x660a291ca422ea3d,
+	 0xf57f30ef7c5c60c5, 0xaaa27d39e8cfb591, 0x7b33d91c2c06eb59, 0x7abf0b2040158164,
+	 0xe9df7e8031e49580, 0xa50ff3dc5a6df9b1, 0xc2be2e920fd88bfc, 0x036808fcc1658e89,
+	 0x5f330c69a21aa6ae, 0x3886e8a001b76c73, 0x4c96b3dd1a1b60ce, 0x02c6f8a202004fb2,
+	 0x03df32acc63ba349, 0x68a4a6ad12c6b77a, 0x156c106e8650dc43, 0xaf147cf1d4a0c69e,
+	 0x46d7691d76b77aec, 0x7ad002def55b4177, 0xfc97a0da0e587272, 0x23abb5d52bf58c40,
+	 0x0743e2f82ee656fa, 0xf5ef0065b9f65c4f, 0xced33d8d5b52658c, 0x8e94d36c6044f1f5,
+	 0x5eb6c37b557f9750, 0x4bfcde35bb48e6bd, 0x64ab9b008098bee9, 0x39c6e4cfc2122aaf,
+	 0x2dd64e9893fe6204, 0xfe2837e965d32bd6, 0x34ddc14142b9e500, 0x15b4ed86943ce891,
+	 0xe10896393df07951, 0xe9d6db06a8cb16b1, 0x0d212439e2aec406, 0x0d88a1346c8ed000,
+	 0x05163f92c2d123db, 0x5a9794664ab77cac, 0xd237080a9c839e15, 0x266534baf4a79d8f,
+	 0xa09c0b72a3aca442, 0x6836d49ec315930f, 0xd431d467a102740f, 0xac56f759b9d2d490,
+	 0xc31ec212abe35aff, 0x1b55732559cc1e52, 0x274b76a8fd8b0544, 0x1132707197f59bf6,
+	 0xc9420460ca6acabd, 0xb4ee24ea899679d6, 0x046d5163261d2afe, 0x92447272dfdccd49,
+	 0x31ed110d4dcccafa, 0x8a866dff57f1a184, 0x7c09f4b44600e2d9, 0x4a8b8fbe39a08ee1,
+	 0x5be49ea5c50f9fb1, 0xc9ea3ba0948e8aca, 0xb403ba564a6d0388, 0x95d9d65469e87795,
+	 0x0f5ff939b708dcdd, 0xf8cf95fca74229ee, 0x5d1ceee10765b2fc, 0xa75505c79d31a160,
+	 0x352c2c41b2707e9e, 0xded1fe8bea335a10, 0x0650cef80eff7dcf, 0x424d9262f6426b53,
+	 0xdbafcfeec0533f3e, 0xe6eb14630f7e5178, 0xfb8bb3043e53bf47, 0x498bcec968a5353b,
+	 0xb5b088fa05209ed4, 0x2a046fcbd083c4ed, 0x9056cb4063508a27, 0x72f292f21cc0e674,
+	 0xc18928379a500f60, 0x23c38e51288a9635, 0x893a6ddd077e5e56, 0x9c0b046466eec04b,
+	 0x83c5c86eb7ecf528, 0xb926015793058cff, 0x970f1894ee2f1fe2, 0x7dcb408ba86e7920,
+	 0x2a5d83e6fe83adad, 0xd79f7cebcca643dc, 0xe63d82c46609ad5a, 0x905ce146c33eef6c,
+	 0x11c56896ffebad1c, 0x4202426c558345b3, 0xe00a86b54901c6e1, 0x6dcc79a470bc07b9,
+	 0xc3352414654fe00c, 0xcf3335012fd7e0e8, 0x9a36700c524205a3, 0x03846eb35101908a,
+	 0x42ff21c960b6f2ea, 0x2c55760e1aafdf9c, 0x8142dd9b7c9fc71f, 0x29544e606f8b3107,
+	 0xdb723568022f4d89, 0xb1f2c86d68f0d3f1, 0x765538eacd217e03, 0xb3b9fc8c23c758e3,
+	 0xf2ee93456a9e7740, 0x0ab1109f7a2b3c49, 0xa6b0471fbeb11eff, 0x20a3891f059d11cf,
+	 0x7fa403d56e6e5b83, 0x278ad51cd3869979, 0xb885a76c3dac29cf, 0xab9a371908bce5ee,
+	 0x6578c57771cf1d30, 0xd780442eb98fd865, 0x5ec8d00202b4a5de, 0x71f73ceff331dca3,
+	 0x90e46ef2b1d66083, 0x574adb5f7a54343c, 0x0aafa25458669e3f, 0x3addd8f91b86658a,
+	 0x110e94090bb4dfd2, 0x1ad97ff2a1747012, 0x0a7818ab7159a227, 0x9942f42f7ffc75e5
+	},
+	{
+	 0xde22dac45f2554e0, 0x98a5a755a1c98053, 0x0c56300c91f9b943, 0x0c8e1bff3b6bde03,
+	 0xcf06acfdd1d281de, 0x7ac7c8337a26eb07, 0xf2513eebb0e28c9b, 0x7818fca6c6c9bba3,
+	 0xcaa995071dfeeff4, 0xf4fa553c958769e7, 0xe8ee2309cbc4ba94, 0x0f013863bae95d08,
+	 0xcc7312976e75ca9b, 0x3818d00c871b97db, 0x1fc66e70b477355b, 0x4f6e4582d1e0bd96,
+	 0x6fd59fd80cf70183, 0xad23ba2161d298ae, 0x8296659d5d760bd0, 0x91e536de3454952d,
+	 0x3962cd5fa3c94e91, 0xdd5e13068074ae0b, 0x1ffa9b353e87cb37, 0x0f9ecd2fc62fec38,
+	 0x7def443229595445, 0xae4cc8598bf012a6, 0x3c3e7703a9a5239a, 0x314f200661a5fda3,
+	 0x6ac5694e1b1a1594, 0x1d320c4dc22beb7f, 0x08fd1394d8d53b74, 0x9d0578ee342014d7,
+	 0x721958bad0df1fea, 0x971b6c8b5d15f279, 0x5f1339519011e964, 0x6ceed442bbe60a29,
+	 0x7baef5db4e0ed771, 0x9b29e6e6ea3aa25c, 0x590307ab353d5b1e, 0x6c9bc3242a8f6da2,
+	 0xa25f426544236eef, 0x8fa6edabfd753bce, 0xebdc67c3420a8794, 0x1019b1f48e7cf54b,
+	 0x68d224ed775061c9, 0xd8d78904b4cbd4e1, 0x3fa60f2c27e1a674, 0x7b33f65824640f74,
+	 0xbd6a5ca9ba6cba69, 0x414e47efbec5be1a, 0xb21f67331cc756ab, 0x51ebc6d9dd083524,
+	 0x55c4bb48b02630aa, 0xe142f1c78cc95901, 0x22cadf2be560a747, 0x745701055545649f,
+	 0x7b2c51479dc899bf, 0x32463764acd59eb8, 0xe1a18e8c9b6497d0, 0x85c58b5d3c4feb5d,
+	 0xc0338c454b7099d9, 0x17cee5ef5ea61e3f, 0x7eb31d325c9c1913, 0x08bd26c92ada6ec3,
+	 0xbd48e42cd795e665, 0xf8afc932b56a87c5, 0x23b0c97360a06ae8, 0x9beba47f98f2911a,
+	 0xbb596a8f3d2060eb, 0x00619f1766e2fd25, 0x97eed8a9bd921963, 0x293c2c3759a38c35,
+	 0xee28ed2a2a2335e2, 0x931a8f00521adf18, 0x7cbfc7a4eb950a13, 0x370e41453788dd48,
+	 0xe5efda5c9492c15b, 0x756649631dcbc466, 0xc50d16eef6a97410, 0x06faae37e5d3e98f,
+	 0x6c5fc1063f786d50, 0xe3539e5a3571a1f4, 0x3e18980814409994, 0x54c75132cbe6b42a,
+	 0x4b13bfb02a14ca1f, 0x753c7173835d4fa8, 0x2e433af20f239814, 0x0a44163b0dd11e18,
+	 0x8c02a12d2d5a93f1, 0x84451f3416ef2679, 0x965eacefd5677b2f, 0x50cce27095d1fd01,
+	 0x59e9c172b045a80d, 0x773cea536e38dde0, 0xb94929a5bc0fdb0a, 0x9f672737f6ca547f,
+	 0x36a65d454dda0ba0, 0x6c31bcd1399f0a62, 0xd510a193d1a7e852, 0x444ccce769208b55,
+	 0x8b686b7c5ba98b0a, 0x39ab7722de265851, 0x59224c4df4ec1ae3, 0x4adcc3cca584f9f0,
+	 0x1a9cf2ade69042a9, 0x5ea76f59a5ec3712, 0x9b05d49ef3d6ab70, 0x2fb9e0b9d4c85304,
+	 0x1e48d5020ea0d7af, 0x4f89e63dd72c77d6, 0x2bb243735b30b08d, 0x52cafdde8b05906d,
+	 0x88fa4d1835ec1455, 0x7d7577850745f637, 0x47a8b64c21bb7dec, 0xb3622df7d7f6d944,
+	 0x68e6739853f58b49, 0x7a97753774ec2316, 0x08f4a564b91059bf, 0x0bc2edc76c8f9e63,
+	 0xd98ba379354660ac, 0x56f166906657ffeb, 0xb5efb6060e6f23d4, 0x2df6495d20cfea45,
+	 0xd68636a4971f4614, 0x91eed3c9216fac48, 0xf8411053e1640c31, 0xa5289948a4520bae,
+	 0xe359a1070ea45236, 0x509256859c7ade59, 0xd0ca8ef55f72b61f, 0x4a11ca79542d28d8,
+	 0x70f2e6c12c820241, 0xd59107b99cfc188c, 0x9220a11b5b5c4ec4, 0x51f7eb5f8db8b4d1,
+	 0x67617d89aaf7e01b, 0xfd40df1c0bf41735, 0x9730b82f320748b2, 0x617407fe93f8fd72,
+	 0x0cf622074b08caaa, 0xa2779fc43be402e8, 0x2b1c22541c0d1157, 0x5272dd94bff843d6,
+	 0x61ca522270274342, 0x7593d63fc932a939, 0x471bb9aa4eb81418, 0x2a5e6ea2cce87842,
+	 0x362a2f4e5309a195, 0xc32a9f71f666ba0f, 0xa5171fda60ac6f7b, 0x5c9cad8ac95d0af7,
+	 0xefe0a0dbc7dccd7d, 0x430ad3ee0efe9fbd, 0x7ea57aa564dab29c, 0x445029027130a69e,
+	 0x22589b466b56a185, 0xa0451b3ee1ce2a74, 0xaa51deea16084bbf, 0x6e3ba8815ae27946,
+	 0x43c0252413a16be6, 0xcc5277b21db1336d, 0xbb666ea991cfcdcc, 0x90be5380e911acbc,
+	 0x32455d922a04b662, 0xae0bb5df2c096dac, 0x8ddf8f29130303c6, 0x24e32cca94b395b5,
+	 0x43fd02c194c8b76e, 0xe81741e4742d8a7b, 0xdb3934e662945fdf, 0x93228ea63c28a83a,
+	 0x935056aa9fceb63c, 0xc639d866cbb77cbb, 0xcc5f73783b5cea06, 0x0255338f3679775d,
+	 0x851ff9ee1f9e18a7, 0x3bd1e0b1f9db2f68, 0x44dfe9fb86f5c19a, 0x947be2e674d4fc6f,
+	 0xc8459211cdbab3b2, 0x99f6984a8680645e, 0xec722d4527325150, 0x444879e519487158,
+	 0x088961c3d0f8c139, 0x452a3c1e726b3317, 0x0a8716ed3fe5c9b6, 0xa2be98a36dfb7c3f,
+	 0x67c16b69b43aef1b, 0x2f9609e9f61d63de, 0x38ee734f778d6f6b, 0x9549ef3da9813deb,
+	 0xe629232b30f64412, 0xf4e2598a1d523e4f, 0x1febb34108bc8129, 0xb0c8aebd91fcaf6a,
+	 0x98d6d191c4b11f3e, 0xb64576b9199f2e72, 0x41b632c198f36285, 0x029a81844189dc72,
+	 0xbbfcdc5adf95cf8d, 0x545436146e7c9bae, 0xacff575d0a53b153, 0x234e8885ca9bafe5,
+	 0xa991ae9763d04ce1, 0xc42225179bcbfd16, 0xe469e643ccf3c00e, 0x546f333610cef10f,
+	 0x4a6c52e56fe4ee25, 0x69b8988cccf41e83, 0x896e83640b4787ab, 0x17d6e479881d92d4,
+	 0xc067d5bf4f37fd8d, 0x0510463493ef22c9, 0xf3d27cdb9d4ddeab, 0x28924842e1b63ce6,
+	 0xe8a309a85c7d8d90, 0xf0b533ed00cdb480, 0xffd78ff2ac7c91b0, 0x2fbba655d7b0cb45,
+	 0xea647ad5c214a3fe, 0x5bb16b2c563522cb, 0x4c6bc2efd70e0ed4, 0x2f92e38e3ef770e1,
+	 0x6d57067a0e764289, 0xdf1e7b84813dd84a, 0xca4d82a6fc650f4b, 0x03ab824702eb83d4,
+	 0x583e4e34b94014d1, 0xe993455947f52b50, 0x26caad6f2876ada8, 0x65c63563c74aa8eb,
+	 0x091610d1dbbc6374, 0x774f8c781379ddf7, 0x129eee476636eb28, 0x18be899c6c842e46,
+	 0x99042a257f7cad5f, 0x2d8224daa0575ba8, 0xfd1bdc3359969cab, 0x2ddf710e0e54a790,
+	 0x033d84fed21ff40c, 0x82a7cb854d264be0, 0x5e9c40b4ae11c3a2, 0x1f47bce6a3c9e1ac,
+	 0x79c1626af44953e2, 0x297c63b77b0fd23e, 0xae7b4cf1fccb2acc, 0x631e3541b7436d99,
+	 0x9d8219b65c76c599, 0x7d69c5f38632e3da, 0xbb5b7e5d4c98d95f, 0x5756dcda6487f3b3,
+	 0x42a60a57d41af00f, 0x8ca67f6cde094e9d, 0x3a6bf6845d32ec0d, 0x19ad3dadf1105c92
+	},
+	{
+	 0x4e5fc8468239830b, 0x9488c5bbd7d58c6c, 0x4d968ca74563da07, 0x8dfe61efe6cfd452,
+	 0x1950384c2cdcc07f, 0x0f897e6447e2f34f, 0xfda537d9826ac28d, 0x0fa1dda25ea12407,
+	 0x003df09bc0b52680, 0x3e50e8056243f376, 0x1b6404a20a5dcdd0, 0x967554e5172b62ae,
+	 0xe435c7f2a7546c7d, 0x63de4b617bcdf618, 0x1f240685023135ed, 0x71faf3d815322fa0,
+	 0x5d7e8ecb2eedd25a, 0x8a0c68df5ef0826b, 0x93e48205907da9cf, 0x6ca0685f5c013a78,
+	 0x08ff6e4235bbb136, 0x9d1e59511afd372f, 0xd7ca6e99eecee1d7, 0x789794022606f73d,
+	 0x9273e515df210536, 0xe94884becebe565b, 0x3b43f38e713d4f29, 0x0418395608f96995,
+	 0xd277deeb4f5691cb, 0xc4f0cf30cd16817c, 0x09fc4d24c99a342b, 0x707692c6002ec37e,
+	 0x539b726c4b7abeb4, 0x490b83b4b14452d5, 0x7a35b23a78872bf2, 0xb08e756f69a29750,
+	 0xf009e65b3466f37c, 0xe9d4d9f7cd6e4bab, 0x81d3cabdd046bcd3, 0x6d4814e028f5a3df,
+	 0xdb2ed4d8e2c3793c, 0xf793860af17c09e1, 0x40482001850c4dfb, 0x8155530aa190d75f,
+	 0xdd24f04092bb02ce, 0x2b943c21c4eddc69, 0xec3c7910904649c5, 0x017bac2306921475,
+	 0xcf1a29f7a42f7faf, 0x2f69bb5debed5738, 0xfbb72fca2ad5c9e4, 0xad679b261f8b468f,
+	 0x727964a03bd64586, 0x915bb1d25008a628, 0xb1d3e4be1417878b, 0x75d0f000da235d01,
+	 0x17f0fc4e70e7741f, 0xbb6dd522e46e26dc, 0xd012252de32582a1, 0x526a546070ed8091,
+	 0xf2e84ae7196c70b3, 0x6ed76a4bac11edfc, 0x0c408336c8124eec, 0x57a711f368916885,
+	 0x9cfcb9a1852ec625, 0x78e5bb24a6a7f7bb, 0x55624979a4f4f7e5, 0x92ec67647d46210b,
+	 0xd0f92379fe17251b, 0xbefef740656a934e, 0x69e01ccc9c7c5cb8, 0x32f923a504f12c43,
+	 0x4965894f60831067, 0x704a4ebcdb2bb0da, 0x0434d5c942ed9447, 0x743b487b8a74c7eb,
+	 0x3459548fb0006090, 0x38660e3bcf8e2c68, 0x2d514a743b9bc15e, 0x822a6d52a2cb3602,
+	 0x18827e9217cbf5b7, 0x2341d6ab9aee62d0, 0x28384ea699c3b918, 0x0e4135f99a7741f1,
+	 0x95ab936d90332196, 0x7c4e4e793faa317a, 0xad8973452e850866, 0xa6391f0f7c894a0b,
+	 0x1c9084e45a58438c, 0xdc20c3b23a784cb1, 0x05856695f37ae1f8, 0x83b4c791843c4593,
+	 0xba6560ce10319e99, 0xdb55e6fe3eba2a81, 0xf13c8c82aa3aeca7, 0x83f4809a3c58ee29,
+	 0x35dc902d4a9c70c0, 0x6aa88972843fa28a, 0x0d6262f06f48d1b7, 0x1f54d5ca5b8f4389,
+	 0x93441a4fef56e1dd, 0x53677bc51b6042bd, 0x8b6d8bd0b55f45f7, 0x2f39f79b3a909574,
+	 0x6ade4f7d76d3da5a, 0x0fc7597a38aff782, 0x99a8b8a407da1bd2, 0x05ec7a858ee00e54,
+	 0x284fd87bd31714e6, 0x1befdfdb0843c760, 0xc0ff7eba2c3e8175, 0x148e2825b932a3a8,
+	 0x027b987f951b91a2, 0xd698cb301d9457f5, 0x06d365332d9d0374, 0x0c7d94d9059390ce,
+	 0x1aeb277346b85a81, 0x2f8be0437566e275, 0xdd0393d2cc437e1e, 0x45eeb592a74ec0fb,
+	 0x3cc79d41cc2c693f, 0x9785c0888cc53027, 0x7d90870066d6006b, 0x7786c54d501fd38e,
+	 0x51616e4cfca9569f, 0xcfecd29cddd6f716, 0xd64e04e716914eb8, 0x7405a6aeafef170a,
+	 0x6207327114d4f9f0, 0x6d21b92b8dc34436, 0xba09bd82901957ce, 0x885aac64a69b7e13,
+	 0xde500663630d896b, 0x967e3d996fa81679, 0xcadafc386c63ab41, 0x4e4095dff398ba6e,
+	 0x1508ed40d6bce560, 0x3b2c70344ee8f8e8, 0x6e7e059895ebd004, 0xa62e5de31d9d666e,
+	 0x2c2d6a8f8bf77e46, 0x149559721e7af767, 0x1cc6b6aac80b1730, 0x0667fe601fc2936b,
+	 0x50940bf4ea805b07, 0xfecddbc2e9456b55, 0x191bd1d4019bc413, 0x0deef027a14152e9,
+	 0x403f210dfd6012e0, 0x59615708893fe0ba, 0x89c8a9c097dad8f8, 0x2ca12b4edbe2ac9f,
+	 0xf5e4bf52999a980a, 0x183d70767ec83d96, 0xee66e98ddb61e8c7, 0x704a86ea19c4d9d3,
+	 0xd2220879c72a0c6e, 0xfe127e68a3e1041d, 0xae445d177e858c41, 0x238306ed5738bf82,
+	 0xca20b4b9259c6d66, 0x7b9d976705dd97a6, 0x64a995bfa9cb394a, 0x0f0a1e9ca77682b4,
+	 0x542a87d9324c15f6, 0x6baf095746d7f2d4, 0xd092e88d72bc5e32, 0xa9040b25fb2cc669,
+	 0x4bb6aee8f71c5fa0, 0x407a65b46475b23b, 0xd8081a0356e8176b, 0x737842e4d9169a23,
+	 0x1a055a39aba07464, 0x774d16e2881361d9, 0xd70934c0d21a6815, 0xa586386cf5063289,
+	 0x4baa8685f6d6dce6, 0xbe8cf4dcd4fa52b8, 0x421c4263fc99ca2e, 0x98de12fcc85ebb85,
+	 0xae30de299a1029c2, 0xc4f58dd015ddb77d, 0x1e8e96c543539445, 0x9909eec00cc574d4,
+	 0x1edd6b11f797f97e, 0xe4a4e3c4b2712dce, 0x4f2ce35fa6f86fc4, 0x69c6ef8c766a85eb,
+	 0x874947941522096b, 0x123009aa756e7503, 0xa674b88febde7512, 0x86aec9e64066f6c2,
+	 0x7190634278133668, 0xcd699a775924f8d2, 0xe62857568eb5d665, 0x5473df9c450adef2,
+	 0x225fab9a083b4cd5, 0xf9ea6ab708a2568b, 0xd4ba2d2147bd86fb, 0x2bb9780bb4e38a34,
+	 0xb3b4246232f8231a, 0x1fa74d677a8e2279, 0x1fc524583c77ca21, 0x61bfb6c2fcedb44d,
+	 0x8f221ff1dc2c809b, 0x3caba4a25eb2b5da, 0xa7343b0b80c0ecea, 0x642246a7159f8129,
+	 0xfc788badd518c081, 0x314ad06ea098a5e4, 0x89f8e44bfbe43ea1, 0x5b67097cf59cd7af,
+	 0x7b7f40ff43581a50, 0x0963e11e10207131, 0x6ce4e904a8b4a241, 0xaaba358820cf0d03,
+	 0x116e10be7e5f95f2, 0x8935f0add458c2c5, 0x4aea41fad6576aee, 0x594b22de109a43d1,
+	 0xf73b53b64d710ef0, 0x69b9b0e288c7bfc1, 0x1374b10be5a7d6d8, 0xb3d2af15ce9edeb6,
+	 0xd16509c3690fed94, 0x9f0d359032cef301, 0x10fa8b748e65eeb9, 0x93da616c342f2c90,
+	 0x96bde33c7605b9e4, 0x91cb9322e5cd61eb, 0x5acd46cdc410c4e9, 0x86e90b470eae02be,
+	 0xa611b7e9601c8e04, 0xe1b7e388a722bf02, 0x0a1506d1736f90e7, 0x49431d946275de42,
+	 0xf6ca8ebce8c49edb, 0x45e76040d20c73d6, 0x7d29590bcebd16c6, 0x268852987c656ec9,
+	 0x3ccaf919cc744bc7, 0x3f4e22a6d3c32fc7, 0x5e404171aa356b1c, 0xa5f822514c6ee32b,
+	 0x3ac96fb41ece2b78, 0xd39194241c684554, 0x004a04a73a14557d, 0xb31c321f7a39da9e,
+	 0x5dbd4095a5d8e204, 0x80e90cb5c3ba07f4, 0x01b0caa3a04854a4, 0x7d46ab0dd2b0d749,
+	 0x20481e1940d7454e, 0x86b6fde86fe43bca, 0xd788e410eaddeb9e, 0x72896ec66dd69ab1
+	},
+	{
+	 0xb596762525a7c7b9, 0x27835240dd987a92, 0x553341cb9f312c45, 0x18ada8f46d2c259e,
+	 0x79c43cc6e5000fbf, 0x3b7fc4eaf6673a36, 0xda27c0af28b9a92c, 0xb395047e80bfcbd0,
+	 0x26e7cfaa5c15d94b, 0x79301e49ce93341c, 0x33489b08d7f43bfe, 0x2023ba2a851f9b9e,
+	 0x9b97b6accb788a03, 0x3c7fdba1fc08bbb0, 0x6c5a2291500d69e9, 0x636a995b0bc33a9d,
+	 0xd386eb1e3491b8ea, 0x3d426d99b156f290, 0x4f6429c61f673975, 0x64b69dfbabb69d99,
+	 0xcd72fd1794b11e3b, 0x3f319ed3f6729f63, 0xa5f7a3b10b94e2df, 0x4c07fdabaee1ade4,
+	 0xb82c872c3aa9e801, 0x02e045cddcf5de34, 0x88a23e66a8801b35, 0x665d24b5000df6f1,
+	 0xcafed9b711e8587c, 0xbcb92753415ccebf, 0x315b5f32f51042f8, 0x59816d2749dc1287,
+	 0xad3adb5572cb8187, 0x0eb3bfdea7a9c37b, 0x2c61eee61f6c22b7, 0x7a1dd4008bed50ba,
+	 0x6ac781572f1fbcf3, 0x450a35e23d7c03db, 0xe135a9f1efe4eac2, 0x5c6c300326615536,
+	 0x645adbc94ba80953, 0x4327d3adc181547b, 0x99288bac96713778, 0x9ed1e3bc86e5e285,
+	 0x0d3229b2f41584de, 0xdfba1859c8d9a37e, 0x996eb4da24ac3c53, 0x7703091be04291d8,
+	 0xf3a901441ce74179, 0x236bdf8e4595b187, 0xf1c23dab188d7205, 0x8834165eadf04e3e,
+	 0x076354a80a48d5b1, 0xcc260f45b9c9c5e6, 0xdf4e8b4412164795, 0x114fb812c5e530bc,
+	 0xa060e4a1a117aef9, 0x9bd75db8b2908d46, 0x849819feb3f8bf1a, 0x80e675c776d83820,
+	 0x14bac52dd6bbc975, 0xb52f68be51fd1ccb, 0xea966716e29a6b2d, 0x918d14c2b223c089,
+	 0x93099489f8d5774c, 0xa0e3c3f78757937f, 0xd21c9e50f3655e3e, 0x5ef271f3c4923c00,
+	 0x4af2a7136fe5f11c, 0xeef586f710412e32, 0x92986d9f390ddd0b, 0x0c0991ebf21f40a5,
+	 0xd4066275d64ed556, 0x12c4ac4958cc713b, 0x0b8aeb5ce588fb47, 0x759deeea622fda68,
+	 0x8557da1b50f468cd, 0xb87ece728cd48940, 0x5a4340f2d99ce321, 0x810e265e570e9ad1,
+	 0x86d31f2adb0374b2, 0xe90beef3a6dc0d99, 0x3ac6c153e659a3de, 0xb2877ca39b467636,
+	 0xc763e2c9c64cadd7, 0xfd8000f1382d0543, 0x10447332abd8ac09, 0x6b31e419e66247aa,
+	 0x99e882ea2735a3dc, 0x6c48c7700c57d622, 0xa8269e60a5bbb55e, 0x41b5b243d448e225,
+	 0x6084371b4d6d1aca, 0x57009770cfbceedf, 0x4dcf08f6229b641c, 0x3ac9e38d0561ff3a,
+	 0xf42cb20e0a6aa8f8, 0x8d0b6663c9b3ee8d, 0x4061deba4c4890a9, 0x8ab500f6236315c4,
+	 0x360d7d3df353fea6, 0x9c428aeef8a0c13c, 0xbea6964822f795b4, 0x102dd8dcc386e4f5,
+	 0x06e18f8fd577f593, 0x0a45d61403c9d8d4, 0xe96e0da4a50871bc, 0x2bafe2d81e75a7c0,
+	 0x641541218d90250c, 0xfaceb5285f3fa8c2, 0x3f433782c74b8e12, 0xab4ae444df783b11,
+	 0x183e6c86348c129a, 0x8ca6c100af7d561a, 0xec9a9b366a699d3c, 0xaf9158e31ca7398f,
+	 0x783c6d427ed53720, 0x82b0e52eb90d5d9a, 0xf9fc0e282e6ae9d4, 0x8bbc5db2a69426ab,
+	 0x618d6b1805622e66, 0xc728daae0b4a76f1, 0xab35a9a9a155bb09, 0x100c2384d9ba53a8,
+	 0xfd00c985ba5045d9, 0xf6d6b63e8910f542, 0xe1cb0604eda278ba, 0x391669ac94971d32,
+	 0x27a9793cdd036c47, 0xa99aba2e0978fc16, 0x94322dc87cbaf5c7, 0x19a7075fa87a6668,
+	 0x10769a76d8bac4b4, 0x42b56223c75f0c04, 0x3d670b76be914e2f, 0xb63b77c8c1a81f28,
+	 0x3e988367b5386672, 0x67b2ee9fe6e2c350, 0x041f9238219b360e, 0x0ba1678661de0323,
+	 0x1dc57a5013cef87a, 0x213fc4472b44e4a4, 0x4ef96419da671ed4, 0x154bd30d1a3ff74a,
+	 0xbd184d900af3321d, 0xca29c7ccc4a9f4cc, 0x0150d68a761956d7, 0x13192785bffc693e,
+	 0xa3e7e618bcc23c6b, 0x1e919b05ae4c39a2, 0x50452a501b7f2d97, 0x540025dddb84623f,
+	 0x92885398a9c0ab0a, 0xd1a1bdca6e3b4b8f, 0xa00b4a794e9a7fa4, 0x046e7efcbc9a0eff,
+	 0xfc4ce7e452b730ea, 0x70154a442ae2c07c, 0x5e0b69698ce3f192, 0x6ff177698cf7823e,
+	 0x32d64f7224a6f4bf, 0xbe5455a3e5c9a275, 0x984550b56754aede, 0x1394f9bbffefde2a,
+	 0xc353ff7366961b90, 0xf310684ad195b76a, 0x35393af46ba38377, 0x1193ba458b40ee7d,
+	 0xb7b3a70cb427b813, 0xc46942baf9d44efe, 0x9b032807c186a4ac, 0x6fbb645a286918ef,
+	 0x1559da29d786755a, 0x43014d5f1a77cf0a, 0x41ecec47ec6590a2, 0x52418dd02e5d388a,
+	 0xe08442d271e72572, 0xde9381d08265bea5, 0xbf2cf2da192052b7, 0x03476a832b0f2474,
+	 0xb02be7efd991bf9d, 0x93ec40e486c96b86, 0xe0b5135fbed241fb, 0x60807cce0f69ef31,
+	 0x8104aedcc60ad2c7, 0xad9dbe6b5e6b2d50, 0x605db084a907b697, 0x048650b49d922905,
+	 0x721fc00a4f6958b8, 0xd2e845444d5d2768, 0xa404827d9b6f661f, 0x026f9b4b6a556c51,
+	 0x222bc4ee44baaa24, 0x4c28c6d28bd8a770, 0xd60568ccdc73d5e9, 0x9a719b54115a07f2,
+	 0xa4d07314b5b71d44, 0xfa73f7da7f6293eb, 0x7506a293e103074c, 0x41b2fe65f1244cc9,
+	 0xb2d434d43f9bf9d2, 0xbe849f39be9cc3bf, 0xac037b733082b187, 0x45223670bd2ffc4e,
+	 0xaf5ebe16f88c5142, 0xfcb3c458f140eca6, 0x3b676c32a99c46f3, 0x32c582a74ab4acb2,
+	 0xa0b5d5385edc8117, 0xd65ea1fc02a6c38e, 0x77d90e351eed2b4a, 0x504b5a2ff0a8a279,
+	 0xfb012855cd0bc9c8, 0x5417ca2c23464201, 0xead40e6a17e93848, 0x322a6dc8850811f9,
+	 0x2b5b56ddcc824f9f, 0xb574e23d9bae9f19, 0xdb338fad8f44f283, 0x4b7f55a75f7bad27,
+	 0x3390a665eb9e344c, 0x142e7935164ffeda, 0xa1f9358b61827ae0, 0x373bfa6b76de66d5,
+	 0xec6e5b949f790b5a, 0xb6950a3754eb569b, 0xe863e232171989bb, 0x3c5fcb573cdb31e9,
+	 0xe673102c0044742e, 0x97061d18da3eb40e, 0x681da31c6a389509, 0x0d1632dac4be6533,
+	 0x374726a525d34c8f, 0xfcad82ec4960d7b8, 0xff7311fcaa8529e5, 0x0e26861b1a42a7ca,
+	 0xbdbd434b7e1e23d7, 0x4ba2f1e3d46a617c, 0x6699dd780f608923, 0x2ca8f677dea94196,
+	 0x7e8096d45b0d8542, 0xf01710dca704d2fa, 0x71d83308bd8f91e5, 0x6d17938d8eb84823,
+	 0xb5dc6dc50b5d8c57, 0x77ba225ef326935e, 0x88fd0331fa428441, 0x83334ba8f0a52260,
+	 0x4e5dc91236f982e4, 0x67dd78182ae57430, 0x5501143ddf0cfbe4, 0xb2cc9d054c26f98f,
+	 0x98623cacc796e856, 0x67ef55c00bfb2fa7, 0x7ba7a927f4e19dec, 0x88e88643b167bf13
+	},
+	{
+	 0x9a83ed0b48183954, 0x12ee5d3f2284bda4, 0x436518e695e465ec, 0x238a09331c504292,
+	 0x5ef23d76afc7b165, 0xc47864f475a8b56d, 0x8997f5980073c824, 0xa1af0f0263257f76,
+	 0x29c0129cc24e1b2a, 0xd6ce327bc5c114db, 0x98b42d1186cf6088, 0x6258dff61e64f5bc,
+	 0x7af238f9b05f52f8, 0x7cabd0ea7cd598c2, 0x0a3abdf9c041c5c4, 0x74f84ca9a96bc555,
+	 0x41ce265af5ef2af0, 0xc88a4a4b976e1467, 0xed518bad4c2f1959, 0x8e6de58b4d35ca7d,
+	 0xd78b6d5fd8e20c5f, 0xc14a89d2d2e33813, 0xea99c769f0adbea0, 0x526b3551fe8723a0,
+	 0xa6915dc9e612be52, 0x6b85690cab5356c0, 0x83536032408b8b30, 0x189f9a81a66e551d,
+	 0x0b3cfa6664761dd6, 0xcc7c6b2ea80b39c8, 0x0fc730dfa6d6baff, 0x905b4d3f7323f8ac,
+	 0x305632f602588581, 0xc472f6f08b433ea9, 0xa7791ab52f7ac50f, 0x276fbc097c7dc8c2,
+	 0xfe986f3ae9475454, 0x1c6af10248f82a4c, 0x43ed42c668b709b0, 0x6d9bd69109438bf7,
+	 0xb384e01712f3fb5f, 0x2a3aab6acf83a0ee, 0xd2a3e14ea1b754be, 0xb22a3f7105430fe7,
+	 0x9fce2fb59faa75fd, 0x8aff94760c653c87, 0xb969730b5ffc2e5e, 0x190c583b2d049570,
+	 0x5fc6ebe71fc205c1, 0xeaa5ca080d434639, 0xeb314389b2087b65, 0x1c02f2e1a591aaf4,
+	 0x7fa8011696f7f0b4, 0x9ab20b69c34b2a9d, 0x02b5f9b23bb582c3, 0x7bb303fda9f61120,
+	 0x943225b9fc565a7b, 0x15e2316f561ce8b1, 0x967f6264da8436cb, 0x50cc52fcccdb456c,
+	 0xa4f20b9696b9c1b5, 0x007f71b802072d59, 0x3153c69b8bb57944, 0x59cac863445048b7,
+	 0xa6b1f9669c263886, 0x246dc0c5c80e27bf, 0x0195a77f68be8a3f, 0x9b7a833bc2129693,
+	 0x8e35a963e61107c9, 0x9443f0eb1890ce11, 0x2ed0cfcca9682e2e, 0x3371c2320a47fb38,
+	 0x85ee458eecb1f892, 0x31017d98416b928e, 0x595eaf89242ea555, 0x8995823b710bc760,
+	 0x655638f15acbbfe1, 0xdc81997f6c39aec1, 0xa6bdbfa40c0eb240, 0x5f654e1a46bd3afc,
+	 0xc2a9bcc2a0409729, 0xe10cf8371e1f9e87, 0xd26a831cf3055889, 0xab1bc763cd12f0ce,
+	 0xe7c0f47048781d39, 0xa683d75678c90b13, 0x13a9aeaa1e47ead7, 0x3be1b169b3169e6f,
+	 0x3ba5c70bc852bf2c, 0xa21a3d1c9c9fd721, 0x7bbf653ac5645f9a, 0x9ac7fb92a7202ff6,
+	 0x77bd5328138b0e41, 0x37a6ac0a0e9a7d7f, 0x38e796a2e87cccab, 0x48b8c00734e8ae90,
+	 0xce5f6c3372b51064, 0x308c03f1b0f3aca5, 0x781769b57ccc1217, 0x28ac11517e40a6b2,
+	 0xf9f889bc916646ed, 0xe88f980f475eb4fb, 0x0aa6651a8e741f96, 0x6039c0b35db86df2,
+	 0xf8064f13728c3d2e, 0x71b3769e49ddce85, 0x68e7359bd76f82c7, 0x6cbec33cd454e427,
+	 0x49ea76b238f305c8, 0x62eb325928031a83, 0x6ee3aa9cdfc45171, 0x2f8287b2161e4b1e,
+	 0xc9abc71e03bbb579, 0xd70ebc6691141968, 0xad2d8fd0bc6249b2, 0x71993880c1c47bf0,
+	 0x629febe6b62691ea, 0x821ddc97f008654d, 0x30a92b680f8c8379, 0x4660f2495380e9d8,
+	 0x3d2ec6c7907fc7fe, 0x645f8292e8e2ffee, 0x57bff6403f8935d6, 0x6e1f84364f7267e3,
+	 0xb25173b1790a98ee, 0x98efbe9f31047eca, 0x8ef288b123736d40, 0x5c21a7f5a049482b,
+	 0x0ebf3c879348427b, 0x9bd995abe223cb43, 0xe9ed2547b9aad5a5, 0xa8d98fcb45a3ca61,
+	 0x966fa58d5e282956, 0x262fe39429b1d3e5, 0x9764e5d4d0da828d, 0x1e4b3fda50c413d6,
+	 0x3eb1829535cf0118, 0x96a1043ff4a211aa, 0xf765a1f8a01d0cc9, 0x3fa808125bf6d914,
+	 0xeb25d8a105cffba1, 0xcc91f68958657b9d, 0xf7f8db6e82b251fd, 0x4dec7b5c45c48076,
+	 0xbdd89b8de5f38ef5, 0x51624dfce02c3f57, 0xddf7d16527a686e3, 0x01a933a9529f76df,
+	 0xf82d030a4ba74ddf, 0xc3499922cabb9a01, 0x376f3beeeebf59a0, 0x9c5a4c128cfe8e8b,
+	 0xd21014249ed76999, 0x774005ba98357dfd, 0x07c0d0dbdeaba537, 0x7fb65510fd14c3f7,
+	 0x1e8d842bda5a40ef, 0x7d51792543f3cb27, 0xc219e98bca8998bd, 0x41592407c7d6e9cb,
+	 0x0289b436fdbd3dc5, 0xfe952ddca16d6273, 0x304f2a88540f2571, 0x201bf9a0d46f3061,
+	 0x56ed409694417df9, 0xfd3623640392b964, 0x32682a1beeb88c22, 0x4926718998b237e1,
+	 0x7bf59f4cc96e5b09, 0x4053fa2ba620622c, 0x3e9dec6979447ae1, 0x9c45834683fb8254,
+	 0x496249f10a6ebb3a, 0xffae402d81cf5845, 0x693019db9a43f96b, 0x2c020a9b98a5801b,
+	 0xfb2be2149dc92298, 0x005ad45e0dc26ca7, 0x1b716061f7295e89, 0x682b67801393e532,
+	 0xca662a01cd8b8881, 0x99210ee1e36e280e, 0x4dbc2d75d4d997f3, 0x4af3f2ee138ed165,
+	 0x0755c89f022cfaa0, 0xddb9c7e77d0e24e6, 0x89618b2c2ee472ff, 0x273863b2e9959825,
+	 0xf17a55078959495b, 0x69d4496c988ebcf5, 0x05f61b016bb3211e, 0x78460a304377f0fd,
+	 0xb7a6fd5afe172631, 0xfe6d0973d54191ba, 0x0c79a041572bafe9, 0xa0a4c5cabc259dcf,
+	 0x864082e52d4d5c4d, 0xca54839d56022d50, 0x5b50791ecf220e0f, 0x22d7a9a3feeeb9bd,
+	 0x7aa5ce66f0bbd92c, 0x493635b2ec035adf, 0xba534b3e45cd9f80, 0x729df22a521ca473,
+	 0x819b1fcf11079309, 0x6e3fd1b55e0fff6c, 0x8a7b4642933ae7f9, 0x9f20635fd5410898,
+	 0x54ae8bc90a9e7306, 0xbce06ef2fa5eb955, 0x772101451611a5b4, 0x94a419fe52d6ddcf,
+	 0x36933823e80c7ddc, 0xe024d9d91cce492d, 0x45dd9be57b597499, 0x9e5b8b361d394a7e,
+	 0x31b67a82ee1255d7, 0xdcab9a0b9aeb6626, 0x437f20cee25ea39e, 0x7d05cc1ed5fdb1dc,
+	 0x9de3c68348541792, 0x92ddc9f5b531ba59, 0x0d6ec564086d6cd9, 0x0d1c274059137833,
+	 0x1d2ac6759c59fe60, 0xd10989ba07c5c774, 0x8b4b45f3915e0fc1, 0x5dc557ed73cb5bc1,
+	 0xb6a1a1c2287482a7, 0xbdcd5c6b20d23db0, 0xc8d8e3ecd76bef52, 0x4c4d09a81ba44548,
+	 0xeb35284be34f9019, 0xd2fb4613d8cbd54c, 0x31c44a94acf53016, 0x7c7110a93775daca,
+	 0x1e3a16364f66cbd1, 0xbc19ab1fa61e893d, 0x32974dbc1c6010d2, 0x2f38c36ef003e772,
+	 0xe71fc63b331d231d, 0x98c49ac4068e6c57, 0x0295db261168f3c0, 0x59674d3f61121c72,
+	 0x51d09c274674d9f7, 0x4d0c473f0890a52f, 0x72fdee5be515f5c1, 0x22ba98daf20d45bc,
+	 0x929d9e3aecb52744, 0x27e59f71cd8febfa, 0xca4284e04e7d8856, 0x0e30bb81e62b69d3,
+	 0xe17b0df171e844fd, 0xba89d0c23a457e24, 0xe1a2d9d1bd9be9f1, 0x567fa38ba812a576
+	},
+	{
+	 0x68e68df2cf5c6458, 0x6f0b05f4a83000aa, 0x05edf52041dc1128, 0xa2f34bcfa4f165c7,
+	 0xbfd1a02f868a8999, 0xcd9b1cadf40a1df4, 0x4ba8d0faec5983a6, 0x898a2469468ee985,
+	 0x20b983a1e1e118da, 0x7e058c59b511d822, 0x19c8c1ab480060e2, 0xa3f458c1a9229d70,
+	 0xcd7630d61af81348, 0x013dc88649f6cb33, 0x6bbdfcf55e00cb0b, 0x461a126f67d46763,
+	 0x6dad524b99d5b362, 0xb7c9744c2bf3ef14, 0xbcb4c1b94465f7ea, 0x4ebb274fd00b10d1,
+	 0x8c07b61d2648e639, 0x10d6019cc1117c52, 0xa0d28b6f5fb2c7ea, 0xaf4f2d84f8e90d99,
+	 0x2f2b95e1ca23c2be, 0x8db4ca10bdeadf6e, 0x25a71138491e0ca9, 0x9ef78f3d9b3e6e84,
+	 0x0e0d583483bd62c4, 0xa66664eec9bfe072, 0x39e464b029afb52e, 0x33f7db7a9fa0579a,
+	 0xd4569fd8408e3e5d, 0xc191cb30ce063f53, 0x2a26647430414aae, 0x15c86ef9323e9237,
+	 0xa8f790d3ccb32bcd, 0x17a6466218a2272c, 0xa71928156712d3db, 0x45ed9a6eb024b9b2,
+	 0x28a60b7e2176a86b, 0x833d446d8c93e050, 0x613cc8f81dd2f856, 0x2b79f3c742522311,
+	 0xdbf56ea88530c6d2, 0x6118bcb0c52546da, 0xa5d67d371c4b2be3, 0x324afdf4f383c49c,
+	 0x641e7ef23d6d3f34, 0xeaf75a986dce93dc, 0x2768f394388c5574, 0x4450b4388689e6c6,
+	 0xa339e2ff0689a351, 0x375c2f0259cc7663, 0x3c9cf8ee38c1e769, 0x366853d7a3f9aeb8,
+	 0x84b25da337e6e7ad, 0x92949b412d4835e3, 0x23739a75d9d48811, 0x8e2b24de599fc0e4,
+	 0x703e469b880723a2, 0x31645affaea72f7b, 0x5dfd329c81feed2a, 0x33a71e5c35ed0a00,
+	 0x759459294787b1c7, 0xa9896423762c3ae1, 0xb9357cd68dd8297f, 0x519b740693b6428b,
+	 0x511ef1cf9e74f551, 0x83253f3934f0bdfe, 0x4ed3d2dbe683c34d, 0x535d789b2becf675,
+	 0x097c854d1408b64a, 0xeeb6ebfa2dd6768c, 0x4396553863f13366, 0x88599fd8a8962cd9,
+	 0x1e9a35f0273baa2e, 0x9255bf2839ae9c4f, 0xae58f4be6325c187, 0x193eecf63af1eeff,
+	 0xe8dc40ae2eb35e86, 0x0115ab12d4bd4aba, 0x4b2dff231c99abc2, 0x1f5a566465a51830,
+	 0x9cedf457f737da71, 0x7a564935dfcb0b4f, 0x0b6f5f9bc6e15668, 0x22d0040c0d34c584,
+	 0x577118e0ade219ae, 0x9124131a79081f0c, 0x09588ab1aadfc8fa, 0x2f70553f2521657b,
+	 0xa3c0eb9b0e3f2dcd, 0x3847ab1985e19bb5, 0xbede9d9dc94fb3ae, 0x309ade3a970bf6d2,
+	 0x769ee167a55699fa, 0x8f16f495ea24f634, 0xb0a9c3638de70183, 0xaf935795f98e0853,
+	 0xa20c9fa5ef88dc13, 0xf5e9fdd9fe25c450, 0x5b03d0df95651c20, 0x89bcfd129f63bde0,
+	 0x51b23a33cbb1c1c2, 0x9ab8e974d7c00eda, 0xa9afacfca00502aa, 0x16461d196725753f,
+	 0xf20811bd0e8077ae, 0xc59d02effb03f34c, 0xa039129c40763a64, 0xac8cafd128cb117e,
+	 0x413550b121cadb79, 0xc628c23443d60009, 0xd63cbbbb08b9df00, 0x38f835ac07595791,
+	 0x27a19ac7556720bf, 0x75c2d8dc5e0d21a6, 0xadcdb1a2cf415a62, 0x06b4eb775bcea215,
+	 0xa5faef197ae142f8, 0x9af7c9b87f22a2be, 0xc9dd6ec739c02ee3, 0xb22ff1c10de60fc3,
+	 0xd30bcf8f4062be47, 0xd44954fdf88edbbe, 0xe70fb03c84d5924e, 0x35e5cee51561368b,
+	 0x55b19e749acb1189, 0xdcc45c2859b442bf, 0xe23dfb1e095b0307, 0x98ee08f0cd5f2a09,
+	 0x34d320a3e7faf906, 0x6199ea8d06a98835, 0x911323c5773f3e55, 0x87b69267dcc22b6c,
+	 0x092f8ece3912afb8, 0x551af4ae66a86853, 0xa3d8035102d33c60, 0x7fcef55e1d5df886,
+	 0xdde19beef3bfc41b, 0x430356022d743b15, 0xf728cefd14a461bf, 0x4fee152bd845f658,
+	 0x348fb2d680f8a24a, 0xeec5a3cf5f75ff28, 0xb7fc320c04a60cbd, 0x8d75cc3dbf8d1f18,
+	 0x0771780da4e85348, 0xd2ae5b4d5cbaa7e2, 0x439d59bdc6367f20, 0x3bf74c961db72425,
+	 0x0693501ec6c1a6bd, 0x79be4695dfce4a96, 0x81a11e9a8ba082b0, 0x96a2fc0e9b7a494a,
+	 0xfb25d1a90ff996af, 0x26b7bd64e22db777, 0xbc5fa8614fb01200, 0x239db575e7c7417a,
+	 0x7aaefa23d3e03ca7, 0x94b1dcf25647efdb, 0x7ba3190cc64b4967, 0xa28e2f584a3d1b2e,
+	 0x719c4a1007e12357, 0x3a3ee1cc7eccbb49, 0xd69656b12024d451, 0x62ac3c618fb235b7,
+	 0xa2edb12ed84aabd3, 0xce200c0a23af6326, 0x6d25ec8a5aa1bc51, 0x5084868846f3c4ad,
+	 0x28460b1bf92daeef, 0xa6f5d9d19a185045, 0xa16d0eb0adef7a36, 0xb11a88df3e470daa,
+	 0x2db3851cce9f12c9, 0xcdf4035866cb3c88, 0x7d317a7c77f99fd3, 0x27207f15c960dcee,
+	 0xe3067acc07fa53c7, 0xe05e8541db0dce9c, 0x4540e0d92db92f83, 0x9ec730d5742c22ad,
+	 0x18cd3be83dcb9649, 0x5790467a237b385e, 0xcc2d32839bf1072b, 0x6d71f35c639db471,
+	 0xf0251864e33da347, 0xb534ff3a62b3e563, 0xe33f50c6d93d00bc, 0x3b8d1404735bd5ef,
+	 0x089de3af63607256, 0xf8fae73e5125819f, 0x2e7c9a10108c2dbb, 0x933497149831b891,
+	 0x162c8096c5390066, 0x299fae7704838bda, 0x05ec801681b12333, 0x6ebf44da8eb71321,
+	 0x40f2a7790c45fa06, 0x2dfeb0db7c326237, 0x90d6012e37933c5d, 0x715b1899245b897c,
+	 0xe1ef2d47bfccdc02, 0xf211224d1a9abab5, 0xda8173ff80145f18, 0x42c672065620155d,
+	 0x741002b2158a1903, 0xd820bfece5facf4a, 0xead0091100d31a35, 0x003a00c1cbf73d33,
+	 0xcc0b5bf87ea8bf8b, 0x6cc120d9755988c5, 0x6a515322d511de61, 0x5c92b9ce79831bea,
+	 0xe0a7e7f13cf075b5, 0x60237ecd75532515, 0x44f777ecebf294a5, 0x5a5d86697200f081,
+	 0xc0eb7799fb0b847d, 0x9b2068d5a28a0927, 0xb7d31f1b3c5f6d3c, 0x4236956bb7731f01,
+	 0xd86921eb9f45bca8, 0xb4f2e59e56733930, 0x6c7d15fb11ddb865, 0x327e41d597ece6d8,
+	 0xe35e3075e2f016fd, 0x7f730e437e82b961, 0x1b70f31f83da2508, 0x1442cb9adb09b6ec,
+	 0xee6e3f7652ed5481, 0xa2786ea4baf0eda1, 0x3ce5c8d4e48514d0, 0x59bd4acca30b5394,
+	 0x0ddf3c95dae2f4d5, 0x577c967e092a110c, 0xd2db1eee302d90d1, 0x3b859a02a6522c2f,
+	 0x0f9cdce62bf852a7, 0x4abdb587453cdce0, 0x12ca37d470d334c9, 0xa848865074dde48b,
+	 0x12f3f45f985948bd, 0xa1b90db1c4fb295a, 0xcd9c7e02df0ff12e, 0x28e7c66e1ec0d926,
+	 0x6a6d0d6418b200b4, 0xd7786dea637b186e, 0xc17dd9da297133cd, 0xa2f8f0c5f5ffe1b1,
+	 0xa667c18952a02212, 0x936495b3c1e85d4c, 0x3b11e489a158f9b2, 0x5b1e4612cf758427
+	},
+	{
+	 0x51aa83a22c964ca4, 0x26c6126a54fdaced, 0xa0810367edc63c9d, 0x55f5d8f7fef6fd05,
+	 0xd6677a71ed670cca, 0x855b49286c1b925f, 0x811e696919f2a2d5, 0x369eff4ba25b8c2d,
+	 0x9309a74bca4fd003, 0x46f6c6fe45c5dc62, 0x116dba9a409427dd, 0x6cfa50416847486d,
+	 0x71a9f5335740228f, 0x073c15b50fa90eca, 0x267dc61994a71659, 0x8f11b0da00431506,
+	 0x503c3226b4452dc1, 0xe3377661b8366ec4, 0x232fe2fe84118484, 0x1712f13b312b28ad,
+	 0x130dd2dc827c460e, 0x853f1f58ee4f3a6c, 0x09819d702afc6aab, 0xb60c21acca4bc2cb,
+	 0x4ec92fb373005c1f, 0x37792b937b86773f, 0x607d27d9bda297c6, 0x9606b3cd3f95f512,
+	 0xa9a327a8d46cdcb8, 0x80ce5fbad6a26137, 0xb4e9da17853c5d8c, 0x51d7f3e16d4aeb4a,
+	 0xc2a67d5ef993fc2f, 0x5ae98ddeac036316, 0x154b8d2270d1453e, 0xb5e1d94df28c2f1c,
+	 0x2b08571d13fb505a, 0x52dbe339da419583, 0xa4e176e2a8c2f970, 0x3c0811a7a99fcb03,
+	 0x291586f4ec15ac31, 0x8b09f909139ea164, 0x7747875bc73d9443, 0x5ce5813798e855eb,
+	 0x97acbd50ab8142ae, 0x304677ae34690470, 0x93e02590610316a8, 0x069544d58fe89dfe,
+	 0x9bc6d6ed320e933d, 0xf3b339ccaee0eb37, 0x3ef84bcba533aa3f, 0x7ade9735b07a4b06,
+	 0xa3df27cd529e958c, 0x24eb4d6a36a01496, 0x6f5c13b680bafb16, 0x0e01470f40d7eadc,
+	 0xa0c9f1fd976ab584, 0x1a8c8c7584ff4b28, 0xf5b4482a8f4c1040, 0x663102c16319fa9b,
+	 0xb95a7ebc9d3e6523, 0x8a5780c5148af3a5, 0xf2d5311a1c3bdf1e, 0x794bd52858673530,
+	 0x43c51e89b30c63f0, 0x6afeafd0a6d201a6, 0x5a1234d72f72727f, 0x2ee481baf74189a9,
+	 0x22ac2bf0ce7bd251, 0x40fb17fdf1b88598, 0x87c23243b39be4fc, 0x04f823340131ae4d,
+	 0x9298ce92b84f6f3c, 0x2917432b170a7853, 0x8e7dfb4ffbaccae9, 0x59d1b3169bc814a4,
+	 0xe9e48920ecdcd247, 0x01270e7b122b60c8, 0x2a20bc69ee717939, 0x1a72d4ef9c962985,
+	 0x6e5394ec8b69b77b, 0xe38c60a0db20871a, 0xd55100151f1c78b5, 0x927c82e38d848b46,
+	 0x27846e1ec2f97235, 0x44e7df2be57fe98d, 0x9eb0575ee14b6cf8, 0x7cb9bf8c3014c455,
+	 0xd9f91630451106e3, 0x65b1f10426713926, 0x40e4cabc7327df57, 0xa94fc07201f5c409,
+	 0x844d23ad7fb1bad5, 0xb939e3a2b653038a, 0x88248a7dc1890a5c, 0x0d94ab423de5cac7,
+	 0xde7b28b004ad1d41, 0xa61858156b9dff8c, 0x68387f6a247430e0, 0xaff5e0138d11247d,
+	 0xbea86a8e56a61472, 0xdd221fd2bfe8baa4, 0xe32589050953592c, 0x654f3884ea1e2796,
+	 0x477472a8289a7d82, 0x91d114a37cda652c, 0xc4dcd17f9f2e7e58, 0x87aa713f74f3c526,
+	 0x1d38566357378324, 0xbdc5f92b4982df26, 0x8e024de62ec34e48, 0x67c8ac7a6c148aa8,
+	 0x6f190e9d50a3dec8, 0xd664ecea0527fdba, 0xe8d38311344f0d5d, 0xa368ba28e8b3d190,
+	 0x6532a27eddf9bb98, 0x8112b208f32fd7e6, 0xc8976cdbc0737413, 0x5c257e583c0e62c9,
+	 0x2c20ec67f63bd29c, 0x50bf75207d93bc08, 0x309817a49049533c, 0x3138c3ebe084c21c,
+	 0xafaec4781444c182, 0x5943e8cc33c012ec, 0x777c14a38da4659f, 0x92c62e711c0ad533,
+	 0x2548110a3bcf2ffd, 0x67ccf8f961ad6f41, 0xfd14b83eed9faba0, 0x39256b9b0b7feb50,
+	 0x4ba8e3c650ed710d, 0x5f2f61fd088d58f6, 0x16fb4204f21c93c4, 0xaa278a1c8966cd8f,
+	 0x585f3b93cfbf3c59, 0xdb555b3e67089e85, 0xc1dc83ea627db3a7, 0x95226d66e5d49c8b,
+	 0xd1b59a5c63d0c9a6, 0xe0a816e50fdd80ab, 0xfe5b3eb719317086, 0x7e48748a0d01f23b,
+	 0x29113d5353806938, 0x6e31c6f300bdbb71, 0xd922adf7ca9dd1ce, 0xb5f44643b95adb1b,
+	 0x414eafd090edfee4, 0xbdc8da1554285366, 0xa564a4b7c99ffa07, 0x9539338a4e9758c7,
+	 0xdb0ac1857510660f, 0x3993ac16b4a7e96a, 0xf19bc321ef9a494e, 0x6b56e10afe9c4c2b,
+	 0xa7690c0c0798c1be, 0x79662fac29cb045b, 0x54b671a8d47a33eb, 0x1ff0a8c2cc6db37a,
+	 0x6d2cb4ed5741a253, 0x4bd32373c42ad95e, 0x25ffad048677368f, 0x15546488ba3da46f,
+	 0xab79efb5dfb48076, 0x2853522d4149ff59, 0xe9e29955270f575b, 0x12487b265d9efa0c,
+	 0xef8ebba53c8218c4, 0x15f83e36cd407d7e, 0x866f1ae23643dafa, 0x9608b050a58aa61f,
+	 0x5138cf5de0cbd028, 0xc6e0b236c61ebe9f, 0x2a766935e1009a21, 0x57b06c713d11f042,
+	 0x051e5b748e72da5d, 0x598477f1ff72a85f, 0x67920404baf47d48, 0x08c38f79482746ab,
+	 0xecd9fc39e851119e, 0xd977a9a08b94a260, 0x53ce4b111e7bae83, 0x4ef3cad383df16d5,
+	 0x65fbadb8ab822835, 0x255f16dbf4ebfdfa, 0x906372823678a523, 0xa2168a7c958d2176,
+	 0xb8c58b6eb5381370, 0xaff1c60d2cf4871e, 0x324a64c5f0b65773, 0x984853f20d6fd186,
+	 0x3b1a4544bb23a832, 0x1810e719b752b7ec, 0x84da8197e914574c, 0xa9aa3d58a012ba0e,
+	 0x8ae188c968b98eb1, 0xdcd8fa96ca613ed2, 0x83aecdb8f6025291, 0xb365df717a79d48a,
+	 0xff8a2496ec9f5a27, 0x0cd3b97cb66c87d7, 0x26f70a02f78ba073, 0x47318a1be213dedd,
+	 0x8838acea5fe1ba0f, 0xb131930d2259793b, 0x2a5cf9ee22b8892d, 0x1feca2547c422740,
+	 0x5dd072684a7655a7, 0xbe6cb9afc96ee393, 0x3619a5385834b21d, 0xb4e003c92ebbdfed,
+	 0x99a3ec521c6cb647, 0x85e686a54c0a2b95, 0x3e77db0004f3a041, 0xaf04eb35c425334a,
+	 0x411e6ac4167e237d, 0x64a0e8c1144004ff, 0x2d3c8a4e7998942f, 0x27eefb0a4ec59341,
+	 0x6864eb7cbb7f2caa, 0x339a9728fe2104ce, 0x168d61a5d7b108d1, 0x438142ab42cc61a5,
+	 0x0320994a1a16c4fe, 0x32f3bbea690a84a2, 0x6c5074871249767d, 0x7f97f450e533617d,
+	 0x01ca7973d2dfca1d, 0x438402cd4b2ed959, 0x1f5c026d8414d07d, 0x46632b6ab7fc776e,
+	 0x34f01341343160eb, 0xbcfd1da4fe18d2ed, 0x5b4608328d0b78f1, 0x2fa1e2da6c17fb5e,
+	 0x8cf5e3055ba9d198, 0x462874ccb3c40d9f, 0x1ec461c5630af60e, 0x8e7ca62169bc18eb,
+	 0xef4d7241929f44a8, 0x45312ee82469f69f, 0xbe90fa48e1dd6f38, 0x4343256effdbd7f4,
+	 0xf3313c707c264287, 0xeaa0e2584b610d99, 0xb001582768dfa966, 0x61c93d0f1b1b33af,
+	 0x89b6ced0ae2c6907, 0x61af5913b5e5fcb8, 0xd10d9b07ca43dff1, 0x514ded206f044b90,
+	 0x6d5cb67429c1edcb, 0xccad75521e3c9834, 0xf0e8438d3cc597c5, 0x0861a45d3bb3d3bf
+	},
+	{
+	 0x25a0766887582fe1, 0x00b95a1390291af8, 0xb583704b44575278, 0x1ccf9ef632644e3b,
+	 0x8fad19648a717c4e, 0x1b88cc0ce5cd4876, 0x1bf328239355b866, 0x2a32eea916776033,
+	 0x71a285ab4f074a20, 0xfe1a05c956aa79bb, 0xf24fd54b56adfeef, 0x5ef5a48837b5b069,
+	 0xed384da2716dc0c5, 0xb0bb818dead47f4c, 0x36e73308bd40a931, 0x13a0c38c89dd0770,
+	 0xe2bb54213dad6baf, 0x052409e8b9459281, 0xf51771e8f5198a37, 0x69c3f8d97ff6106e,
+	 0xaf9dcfd6554c133c, 0xbd85f920d87848d6, 0x04b5002a7402b890, 0x296c8c0f38dd7d95,
+	 0x33685cd81b392302, 0xe76a4af2a81f1c12, 0xf3a4fed24a531a53, 0x314ce401ebcc82c7,
+	 0xe6d434c9f0f40c72, 0x74ff1fcfcb9a1bc8, 0xaba874d51b5735fc, 0x1e7751c949184e66,
+	 0x0429a64ef5f0034d, 0x55e5daa9124752c2, 0xd8cd3681f2324ce0, 0x8d0b7896c201a39f,
+	 0x3e9520663f0421bd, 0xa494317be054a281, 0x1a222029142aff86, 0x07de23a213c65c26,
+	 0xeb2b6fa9f38a3c50, 0x403ed1399b5a4c47, 0x5f0c822f25f910a1, 0x8dac2a5c48f73965,
+	 0x07fce07a993084bd, 0x87de407e7931f178, 0x11c79e6ebe0ce128, 0x793fcec9888f4f62,
+	 0x3fae50fcd61fb4e2, 0xdaa4953e3b0fd899, 0x55199899d32ccfeb, 0x5f0c41c4c6627f37,
+	 0x2115e850ba6dbdc2, 0x11273feba8644d06, 0xc9de1dba837e98bd, 0x8f82c46fbca81d46,
+	 0xf7b16ff3c21a1bae, 0xa8e97d485339b3ca, 0xc9de325f25fbf276, 0x58c3d9cbdd6b30b7,
+	 0x160e5bfdb96631ec, 0x6ea48e7c880ba490, 0x67f218b9b6730415, 0x8d536f979e3333f5,
+	 0xc4676ceedcde95ab, 0xc9ba49b0b2c3b294, 0xfb73430e3e0c4e98, 0x31e6968cc7ef2045,
+	 0x8f7f7a9aa06a7512, 0xd629289a3e124fae, 0x1d8e3b14fac6ec44, 0x2d220abf12204784,
+	 0x8e54c80132aaf46b, 0x95cda8a690289e0b, 0xde42cebd34800e69, 0x905093d1367ef212,
+	 0x5d781966c88c8b10, 0xb6e3e2ff1bcc5434, 0x15ef0d6bb5a25655, 0x22f651f365c59775,
+	 0xdbb21f34ab749e13, 0xb4c1800b871298a1, 0xfdf006b0efff5330, 0x46ae9bb2c6ff7ecf,
+	 0xa0c92669504e7bbd, 0xbe95e18be96907db, 0x55c0d12f25bc5983, 0xa71fc9fb46a7fdf8,
+	 0xa44e52921bd73e3f, 0x48ea14e02f0e1635, 0x67c6bc5482b0edf3, 0x342614d74c50fc9d,
+	 0x7cb9a0f14ac867fc, 0x92c3b9dae8fe39ec, 0x42947f23fe9e305b, 0x75ed15dbfe3d60f6,
+	 0x03d2a14d8414fe98, 0x5cb7193db67b46bb, 0x985f9653e78a7b85, 0x5d1c534b0cfa28c5,
+	 0x7f4ddcd7eed26407, 0x7d8b19e8b4052610, 0x7bc17cb3066eefc0, 0x1688a9232cd2af33,
+	 0xd426ced96debc0e8, 0x9590fc973f2674bc, 0xaaa2416eae38dcb2, 0x9616b7eb0938351b,
+	 0x7dcfb9c503b3ca47, 0xe837c2eb1d8acc61, 0xa3aef612aed023b0, 0x470647c644b364ac,
+	 0x7dfb60d5b425df1b, 0x30958c7491fe92bd, 0xc9fece1cd4131fca, 0xa1ba38c1310e9c4b,
+	 0xfe50d470ce437dc1, 0xba77c4fa9cc639bd, 0x9f920270c94f15bd, 0xaf42e920daf4c5a5,
+	 0x1df8515afab5a156, 0x634ac4c7d695cdad, 0x0cc4d14547dccc09, 0x1bb9c21ee9b1d69c,
+	 0xcb57886f3eb2dfa2, 0xd68ad7419d3103c1, 0xe196d94057ce7a6f, 0xae9669cdb2d43f09,
+	 0x25484c54129361fb, 0x084c8b73c495b2fa, 0x13bc695ab3d21892, 0x6d5a1d0b3c4ba2e1,
+	 0xff2c8bf131a2c445, 0xc515faaa963a8246, 0x1adf043f03183088, 0x9ad1a50c3177f3a2,
+	 0x1d01de4f4526d2f6, 0x233e6249761a9cd3, 0x62b807e0d67289f1, 0x8c0e3b56686f0987,
+	 0xe864627937b12fcf, 0x0c1e487521473372, 0x20b8039a0e1a2fb4, 0x4de6ad0940e78f4e,
+	 0x66c29ecb33d8c2d6, 0xad764ef5dee2ede5, 0xda9d977e5b5f7776, 0x1eec572151d43170,
+	 0x6fb6a37961b3de27, 0x20264b924e077736, 0x7493afd2f48a5341, 0x4ec7a8ff59659076,
+	 0x9b0d15f5148b8474, 0xe6608ba574c13603, 0x1a44e9ce99ff9a97, 0x20338569e31c0c5d,
+	 0xc239606e96a3d9d7, 0xb2171d4701a12e8d, 0xad18ad8058bb87c7, 0x7d96e8fa13bd76f0,
+	 0x561e7402b485eebf, 0xfb1606ad10206306, 0x85f94a0b0557505e, 0xae862cba8af72fd7,
+	 0x16a453c7023f3ee3, 0xd89790353f5ec04c, 0xdd1b8ff56a9d5d55, 0x94cce07139b25087,
+	 0x50e3f63938b63cd1, 0x0955ef2712201fcd, 0xe8182d920a47776d, 0x6ad12a0eba779755,
+	 0xfbce13566b2b995b, 0xe3ecc7829d307e33, 0xa20187cc96f01cf9, 0x20ac37e4cb61d8d4,
+	 0x5fecc537466456e1, 0xa9d92690ace387ae, 0x67d270f5d24c172e, 0x1b12b93111fbb139,
+	 0xa36828ed3b5f4a72, 0x825b14ee80610097, 0x8af649db94e3feab, 0x2d88731b20c6b7c8,
+	 0xac929f12c1630c46, 0x703a48fd57695795, 0xa3ab4bda01e4abf1, 0x6b99a490bf5dbff0,
+	 0xf31aa3960ab41788, 0xe8f4b10b352653e7, 0x40c33d32cbb287ac, 0xa6fe597e1ed49de4,
+	 0xf3623c3ce032275f, 0x1d75eb88d19b1b6a, 0x54ff040a6461e018, 0x8d84b59c30f88c37,
+	 0x67d28f00d29f861b, 0xc29ff2f3a007caed, 0x76466e79441cfcf7, 0x6ef2f71c84fedc55,
+	 0xe05bc1d1876d941f, 0xce040c884a1da1d7, 0xbc4ac4794c77a257, 0xa869d586da77aa53,
+	 0x23eab467431f4c22, 0xe1163a6f1ab52a08, 0xb8af1c331e51852d, 0x99bbea42138e97a9,
+	 0x6d7c9575b466830d, 0x06ac9f65b2ef2c47, 0x11e2f5da1dc79355, 0x125caa2420d7cc05,
+	 0x308e4f8128828202, 0x54d934e2f092f251, 0x42d8023dddde90aa, 0x6f86791838102e91,
+	 0x3c550a7a7e556b4c, 0xa7ba3adda00fb9b2, 0x13ef63b54d33a269, 0x443e8176730deb58,
+	 0xa43f6f801b3302ec, 0xe8b25e1c81f29b79, 0xa721c51775041bbb, 0x82d0b5c71f6d4f8f,
+	 0xf8af4c48ecf2f8c6, 0x1a7995c3e78a7fda, 0x04fc2b49a9bcdab3, 0x8fac788c6b1961ba,
+	 0x152d8d088f6a3cc2, 0x493044ec0c30781e, 0xaf8b2867eb30bdd8, 0x80b62b6fe9726891,
+	 0x26f29bc62a0ba4d7, 0x194da15ec6ac1db1, 0x2fe1a1ddc34baada, 0x2bbcef4214773116,
+	 0x1ba8aa37546931e8, 0x66c31f3114a0c545, 0x12b133a1e16db0c3, 0x11d177cacc1edf62,
+	 0xc0116101798f7270, 0x21bd7df2af3bb560, 0xac6ed5083abb2b9d, 0x45b47b7fbcf1b646,
+	 0x703be1c4f0e98eaf, 0x9bcf709acf0aa456, 0xc34c4ad37486bd37, 0xb5cf7e47068bbc00,
+	 0x98d615f5affa60d4, 0x0fa0189822baa718, 0x2c97b7811728bf06, 0x67f4a1f668cd13a6,
+	 0xd4c31b0b994b7467, 0x963f00573ad962ae, 0x494210c9d804153a, 0xaa4f289352f081b1
+	},
+	{
+	 0x5dad87734a4b9364, 0xe223addd19a02658, 0x3fe18a5c5c703569, 0x70cd2dcce4b2c564,
+	 0xaf358c677165c0cd, 0x537f89b3ed6076c4, 0xc223f3d2424e13e1, 0x11fcade7d33419f3,
+	 0x6ce46e5d20e16bb8, 0x2fa3f27b821c5110, 0xe61c9e841dba9295, 0x83167e51516f6430,
+	 0x3a809e80372e3dbf, 0x1a3e83dcb3e722c2, 0x70ef2455e232dd5e, 0xb40de1db8fac78db,
+	 0x7144d7093c42e70e, 0x3d12f43a429f5a76, 0x2e093e13f716f3a4, 0x6d267c689900cd51,
+	 0x0067332d59b556a2, 0x86bb98e335889b80, 0x8738254859fc5cff, 0xa82302626a4dd849,
+	 0xa42132eb792d080f, 0x3dc6bcc0f0a890b3, 0xcc227cc7d5d56f8a, 0x3ac3da21473d2d6e,
+	 0x224032da3e5ca835, 0x805cb614cb800952, 0xa8eaf1bf1d9a113d, 0x7a01b0ffa5ddc143,
+	 0x08c47ed55ded89d2, 0xf1d3e966c5282d9b, 0xc7ceacad5b2fe205, 0x13b618d32ccc1fde,
+	 0xbdc6842488cb9a84, 0x54e3d2114998a77d, 0x3e6f64f1e95b2fd4, 0x06f61741377657f6,
+	 0x88891ee170d659b7, 0xd756b4fdc44b480e, 0xb52b54f8675f3057, 0x0728c71da5996d7c,
+	 0x696fd22740c06d98, 0x1f4d2d137362cb73, 0xe33722e356b96755, 0xa118f6ff82a5b7ae,
+	 0xb46403c78001018f, 0x6c7af39534aefb5f, 0x50c29339684d929c, 0xa160b0b1e120378a,
+	 0x820cd8c18101b31f, 0x1f9faf64253f8bbb, 0x576177683d9bdff2, 0x082bc596b834a5fe,
+	 0x9aafefeeb63c0121, 0xc99e4205031ad138, 0xa068c549126ebe23, 0xa4f6a727b6b53939,
+	 0x934584e6a6e919a7, 0x1c80e4468d4cb8c2, 0x43710f0a63cc97b5, 0x25fc64d948ef042a,
+	 0xce4f106d053fa933, 0xd6913b4666e3857d, 0xdc56cd08e07948be, 0xa94f995f35038e72,
+	 0x839a75f38b71fd80, 0x89a549d93b72bc7b, 0xc7bc86170ed506f0, 0xaa320415043a6113,
+	 0xea170cd0aac4e77e, 0x055444b13c92740a, 0xb85380616e2e2917, 0x01b78f44c1594692,
+	 0x51676b6924f9852e, 0x8cf29b511b3dd561, 0x25418cf9f708d41b, 0x4449d72603635bf4,
+	 0xafb73642e7968147, 0x6fa022c46ba15c1d, 0x5e38459dfcb40ca5, 0x0f4c6dd724f8c08f,
+	 0x521302238f93bbcc, 0x3f96cc6138a050ad, 0x432f65d2422836a6, 0x67a8164375e8d068,
+	 0x1a5654929ee62cea, 0x97036cc8f8a8165b, 0xdc91d55f1433dca9, 0x5ead2a0163e0fbb5,
+	 0x6a7f5080f5f3811d, 0x1ce6491dd7b03220, 0x6da60e8558515cf7, 0x2ab095d65d4883f3,
+	 0xdb51c4d569ad6fa0, 0xc92498a92458d241, 0x589d8b39c2d338b6, 0x9c310134b18a9c3b,
+	 0x2e14e43c521666ed, 0x89042e90efed9232, 0xe74d874b1f1de665, 0x114b852cd84365fa,
+	 0x9332bbe2378248da, 0x7cd66508046b1f9e, 0xfee1370254e00164, 0x8a103ea421d52666,
+	 0x3c2ec2fea52d812e, 0xddf036030cf989aa, 0xe43b22d628c66ad8, 0x1052ff7b8db0f919,
+	 0x650b2460b863531b, 0x04453be24cd86cd6, 0x4dde7ab74bac48cf, 0x7d05ada4c0eb345c,
+	 0x8aa6885acf9b9ad5, 0xda48db1985e3327c, 0x315914e2b103528b, 0x0aadf339e39ee0f1,
+	 0xae4102981caf9524, 0x1ba8154a93863048, 0xa245c5ce0e2277e4, 0xa21d952a24d010cb,
+	 0x639301c46568790c, 0x4aac1cc90b558def, 0x7a03553743f81ee1, 0x4b84d4ce3d3ef045,
+	 0x6c654a053a5668a7, 0xd1020339ecc5109c, 0x8b279c7972bd6b10, 0x14033f354d8cd61d,
+	 0x26e100723aa7f9a1, 0xbdcee261864bff79, 0xbf7a407350a14143, 0x6fa2d5d14e2d3edb,
+	 0x9852f479115bba2c, 0xff973d1a0c4e7ec2, 0x5d31729e5315492d, 0x6c5dec08fe9911cc,
+	 0x6c644543c44e1061, 0x7053c72776114d04, 0xeb883f7e83cd0798, 0x9bd0299b1782deb9,
+	 0x40207b5221abdee4, 0xc04096bede98f2b3, 0xbed7a53accfc0f09, 0x103ba24e24e325c6,
+	 0x844468c14e724ac6, 0xd6e279ab7f9ff69a, 0x111b0f83b1345d45, 0x5ddf9bc49df03c5b,
+	 0x91976a7a728511ca, 0x73090e319a43bc03, 0xb8824709cfec921c, 0x1ced48f3e05291e3,
+	 0x2e3c73c95eda371c, 0x9ba5cc1c160e672e, 0xf29e55001bd70799, 0x5d06633de4edbf9b,
+	 0x11301eecab647860, 0x234e2cdaa3400fad, 0xe23b1f8530689a61, 0x986eb77aaaac6e4f,
+	 0xa639f4084a2b7db8, 0x260ac84349f03e4b, 0xade50027abf2391c, 0x9a860f8fa1245ae1,
+	 0x95c09b1fa8a3c4e9, 0x581ee8502dc90517, 0x311da6ebebe77da8, 0x024012a42d3e0d43,
+	 0x9b279eaffbad9843, 0x7f50c685c1eb060f, 0xab817a47f9291c17, 0x61cab6462c93ce8b,
+	 0x66e13ccdb08fb394, 0xa5de0d08d9a977a0, 0xf1e763e0519994e5, 0x499350f8a5e6f720,
+	 0x681f0743dadeeb2c, 0x3fea496b785ce539, 0xa7da2e5217152661, 0x6b6dd287cb527c1a,
+	 0x7ccacbe903c439bf, 0x7af23ee2282d728f, 0x8e94a77db0e5f92a, 0x8044dd5169baa233,
+	 0x55abc08f294ae3c3, 0x8bc10e92800143b2, 0x8d0c677104a02496, 0x30f2abb1b8eb5f31,
+	 0x31e84aaf798fddcc, 0x84eb2834d9152e1b, 0xc90b52f61ecc909f, 0x9b9b17ed621761ea,
+	 0xba9c33bd4b9e8934, 0xd9f05c18f8c65170, 0xd5580947cd7b6a53, 0x89218d5dafdb2456,
+	 0x104f6b53b13cab4f, 0xdf98671c085c8d04, 0xec2a92b949a30b99, 0xb4fb4113bce939a9,
+	 0x09b6367a7d0644a3, 0x0036fdd021b97a59, 0xc7d698696f84ff5c, 0x1bb6975b313ae8c3,
+	 0x4ac61bd7b506cdc6, 0x2daa616b237443fd, 0xd7d9ef5a812e4113, 0x7b9577e979528d49,
+	 0x0da42e9e117de4dd, 0x6acbd9b874524910, 0x98df7a25fcdbf4e5, 0x3bb70d38ce38565a,
+	 0x8c6e0bf1ee93ac83, 0xc35951360ba3bad5, 0xfd39ba4df09ce1a0, 0x28653edb8dacf372,
+	 0xe81e4ac55e38b006, 0xb17efdf0db0a6f4e, 0x32afc1b1b1672d97, 0x0b520362fe8bb995,
+	 0x3cc0fdba7cd9ca66, 0x6e029f6d1e7bb024, 0x9a7b06496173d9e5, 0x08a28da8555823fb,
+	 0x25228d3dde4249f7, 0x62addb2c3cefbe35, 0xe93ec9b7965dd703, 0x4eefe744b18f305a,
+	 0x039dffb22698269e, 0x59422f1dc8556c9c, 0x3b54b52bb7c510cf, 0x97b5ca697985ca83,
+	 0x519efe6033262f28, 0xacf6a3a917567305, 0xc66596b6391233d5, 0x35aaa68fe845b861,
+	 0xebc813b4f1c1919c, 0x191929a16931562a, 0xc30516e5e3322958, 0x7acb5758ff16bc33,
+	 0xadef4ef940b160ee, 0xc20540db87a65718, 0x9195ac8a9d478bba, 0x9c12bba1019a1b22,
+	 0x804ed3ff53a80422, 0x2d7f030e7511fc89, 0x9ea6e8c27a3238d2, 0x3331ed5195b6bac0,
+	 0x122f8105fe221cc2, 0x01f282b18f05dfdf, 0x0a33286d995ce356, 0xade037437227b771
+	},
+	{
+	 0x36cfd0d50259495d, 0x5a59280cb9c714be, 0x73e63c654aeb8a6f, 0xb2178b1251b35fc6,
+	 0x926c00eb5e2a9fe1, 0x1bab277ea3b50459, 0x1979ef0d7730f366, 0x291de8abc6e49a75,
+	 0xb582d052a074b11f, 0x46e3b34e631b2d6e, 0x60fe5138f85dc1fe, 0xa2df314b7a0bd752,
+	 0x96cebdd080b79eea, 0xc4e3c0c2b5935420, 0xd99f2b34f2850306, 0x43a33cb7c748c7b2,
+	 0x6ac30e0c690909e8, 0xff2bb347ec5b84e2, 0xd5ffc38256028435, 0x7aa278444f8e2a29,
+	 0xcfce4d7f85a4a319, 0xef7c79b52d79f443, 0x54c9cd654c639f2c, 0x84162efd6f860292,
+	 0xb5f4701949848c7d, 0x900df009ec30e4d4, 0x903416a45fdb3571, 0x7882b308e72c3dae,
+	 0x88f1446af087056f, 0x6236d583d895fa54, 0xfc73039e9c329467, 0x1c14ee7ce2401ecd,
+	 0x3971c649112921d0, 0xa8551fa67bd46d7a, 0x9717a92219038bf8, 0x50288a5774c30af0,
+	 0xd93d3ba099113ad5, 0x8a3c1d74a3176f61, 0x8640f086cc72c529, 0x05fdd2afbefdc89b,
+	 0x3003355db745bcf6, 0x9420ab4d573b777e, 0x1ce4a34d62d5b697, 0x67352a41721795ea,
+	 0x1d61df65ecc3cc76, 0x69cdc437dcbf3d0f, 0xb30e99b321dba8c3, 0x563250cbf1c4f23b,
+	 0x48f874203dfdbf32, 0x5ebe6d0153f1f52b, 0x031ec155f4efb426, 0xaf73408b2691d4ef,
+	 0x6f6bd17ce793de71, 0x3484bcbe8f76f8c8, 0xa61c2c6d54cc8813, 0x2c89b62a234e9521,
+	 0x2b0e060010cfbaf3, 0x7bdc52d26ec8a222, 0x4b5ed6b8620e5b7b, 0x2ee06c61ca0fef25,
+	 0xdbce20d350dd8f43, 0x97e63ba3e1af94ec, 0xe9d81259e8bd30c4, 0x77fa5416ab95d109,
+	 0x62162f6fc26865c2, 0xf0f921526351c9f4, 0x70797bdf76d0b6b3, 0xa3b6786ae2db818c,
+	 0x1904eefbd07d81cd, 0xa0e1785a74fe2da1, 0x76af34448ca33b02, 0x72ebdfd4c9b756c5,
+	 0xb42d52c67cd535db, 0xaf53483f570d9dc3, 0xf643fc39a2cca8fc, 0x55e3d769f5822531,
+	 0x460f85b817fcffdf, 0xc7dbc7e8e3c6bb67, 0xb448b27d907e61c3, 0x39e345a1700461f4,
+	 0x4ca2d328f39812b5, 0x91c9083c8712cd7f, 0xf690f7c0bc2592af, 0x419b53b5a7e0908a,
+	 0x54b128b21dbc2a81, 0x8e374d3fe9c3e454, 0x12c53aa7bd95517b, 0x9689e0cc27914769,
+	 0x3e2f8800d067a2a9, 0x453195ce1867fb67, 0x4cc5df5c3338d7ee, 0x904c3a936b6d7821,
+	 0x22e44bce523376bd, 0xb43a0cc33da75e28, 0x1d5638cc4af93364, 0x3723e1abb335cf08,
+	 0x8861747e43db317d, 0x8203b9174b0107a1, 0xa886d83e6ed70dd4, 0x16c0becf60152906,
+	 0xd8cdab2e24fc04e4, 0x57458f7b7f9f774f, 0xac73096e9c6c3605, 0x6b0a05f4db270b5e,
+	 0x8a904b706c73c0e4, 0x50a24faca004cece, 0xd005101ef6bd1761, 0x79500f988883b04f,
+	 0xaca7766846fd206d, 0x29b7fe0dd13d2ca7, 0x686d4cc391bf8e43, 0x203561c65628473a,
+	 0x2ba44ed03ee35ed6, 0xa86cb4d54d9a148b, 0xf11f63afcbea63e1, 0x2cb4d5ab244f20ce,
+	 0xc05bfb38450b4a57, 0xf03a3d3b632730bb, 0x3ef5db6124a47617, 0x0bbc12dc85847575,
+	 0x601ac7d53d056f70, 0x219deec50eedeae9, 0xa78c38d4aca8449d, 0x160bb5ba1ac4dc9d,
+	 0x8d770e3a2474be0b, 0xa9c10d6a3def5057, 0x414f2a1e0204b51f, 0xb3be31506dfa4867,
+	 0xa61d1ce5fb306708, 0xb7feea09683c2dbb, 0x9f7c257e85d6c183, 0x9dc375edc7a65911,
+	 0xc6dfdf5a3918dba5, 0x89ac8f3f352c90c2, 0x8dc1c75767006fa2, 0x07743ecc75515b96,
+	 0xf16cc3b3678764c1, 0x93956b23a8cd2a70, 0x49afce46f86f2d9a, 0x3d76f3ec94d9bcc2,
+	 0x00e11255e82a7d31, 0x92c74be2cb0735f3, 0xe6afd0649f294c50, 0xa0ebc1e415d2ad27,
+	 0x80551545254241ea, 0xcfa17e9f278ed991, 0xecf36af08cf06a8d, 0x59647115e55fe374,
+	 0xcee0da14655fe792, 0xd2a9ac391476645f, 0x7edbd6c61ecb3afb, 0x0c09dd4bdcfb222f,
+	 0x49b2a6ee2d56e004, 0xa9e38029aeccb907, 0x9809549a480cfec1, 0x0df7c8de237cd069,
+	 0x4fd81498f8fbd9ab, 0x6526000237b96e80, 0x229fb425c1325031, 0x05b636c9325747e7,
+	 0x814f0c589ec73e43, 0x2ce1f7af8e4af77d, 0x1757c3d49abba058, 0x6c27010ee999f0f4,
+	 0xc7679fa257efc02a, 0xa174c64086e241ac, 0x89e767578f12b59a, 0x61f1519b0931adbe,
+	 0x338d2263416ad873, 0x70313f993ff324ac, 0xd0a630cdc6385cf4, 0x55b8c0f39238aed2,
+	 0xe2f73c7926d2e1b4, 0x4e6d4aab202ddded, 0x6067c1b9fdbc9c1b, 0x630a2850268f3da2,
+	 0xc8b41f17675d0054, 0x3bea1844799930d1, 0xb8096df0cabbf9a3, 0x13669a157e82a7b4,
+	 0x101549e451333bb9, 0x1c55725e152eb833, 0xe2e7cefe07547eb5, 0x4e39f1d9e46b6a0c,
+	 0xd1a9d4128018c956, 0x7159ae229faa0516, 0x5a313c1f522dd104, 0x1976b7c83b334928,
+	 0x410bab95847a7aa6, 0xf89902614ca2f52b, 0xf6aebd0dc1a57bd6, 0x78829120a43300fc,
+	 0xa366630bdf55cd55, 0xfa63d19c7b6aa987, 0x083425afb4c55f4e, 0x342fb4b8d6bb850b,
+	 0xac20e4e1c9095b2a, 0xe9d7465d606b01d8, 0xae42ac4555f906a2, 0x34037682321c0a65,
+	 0x6b6fed607cf7bf47, 0x723f379e055093bb, 0x7113d2d536112fff, 0x5160f6ffa0425563,
+	 0x08b7b717ba881b9b, 0x825dbaf223af8f85, 0x988b73aad2e6ebf2, 0x4f7da2fb4c56dba6,
+	 0x4f62a2488b010154, 0xe961d9e32a0a74de, 0x2c4c115176ed0c48, 0x2f5b053a607b8434,
+	 0x83957700421b23f0, 0x1fb79a9978a2d718, 0xe38452c45968ce54, 0x46379421694150a1,
+	 0xd1fc3cc2f06b2b6e, 0xd23e3891d8fafcdb, 0x0de571ff5c58838a, 0xa931e2a68e048b1c,
+	 0xf5417e49f4b7b23c, 0x83b99ae1d963146c, 0xe00daa653984d78c, 0xae238de8cb583e48,
+	 0x981adc7846cbce19, 0x84883e3aaccf3ecf, 0x8da822b00162f5e6, 0x5b5931219627627b,
+	 0x29ea48a473d8bc9a, 0x02c3ee907476e98c, 0x34d6a7d7c97afbd6, 0xa4f6a674e67fc54e,
+	 0x702cf7bfae89f276, 0x2eb3b533b51c7120, 0x18ccef4972805af7, 0x240d2b83b7a21db3,
+	 0x6d4007e84eb05eba, 0xe3a98b114f5406bf, 0x86747595bf799353, 0x29bc1cc5115feeae,
+	 0x6b729c5f3f15a03b, 0x34bede6a286b694e, 0x46f3a2fa405b789d, 0x2ff291c74e39cc3f,
+	 0x602c0c9c61743084, 0x097f99e2d85c57b8, 0xcb5568f1420e213b, 0x7a2b7a4924cf138a,
+	 0x35508152d6cf1c5b, 0x127766216c939f39, 0x0d3e271f5d0b0500, 0x712cebcb77f503d4,
+	 0xb82d4ff6e1375a51, 0xb84b06fca51a2537, 0x8b8c2edfff966149, 0x6098d390c02c98b3
+	},
+	{
+	 0x4673ff0a4f64747a, 0xc35fdd6a0b236841, 0x4c6cd14902e37800, 0x803e3649943316bf,
+	 0x79c1947aa4dae080, 0x5a36f7ba6877922c, 0xbae3b115599c83e8, 0xa2ce112755e8536e,
+	 0x5493ff83802df89c, 0x03a26be94e5e1f48, 0xd398efb89869157b, 0x7eb65504be1a62c6,
+	 0x6dec620c69286959, 0xe84187aa6a791655, 0xebfe40b03e286ebf, 0xb10c00642f1f32d1,
+	 0x84f2a2cab70a1070, 0x08cf8d04a3f73eae, 0xfd8c73d38bd96bea, 0xb4b809b50d469193,
+	 0x42a7b7e930ce755b, 0x6edad1022525df34, 0x3cf307ca69faae26, 0xabbb51272cb56241,
+	 0x812f03c253cc41c0, 0xf64e398a009a6637, 0xb30c753382f37e4f, 0x89fe0b68094eacaa,
+	 0xe70cc53dff05962c, 0x0e3a148cf2ac5eb6, 0x699c724b3a50710c, 0x9f377323fddd3506,
+	 0x158fb48d7e57bda7, 0xd62125502113490e, 0xd47bb67c589df205, 0x57def42c84fd6ef3,
+	 0x135416eca0e7114b, 0x2d3b8e6726e64ede, 0x536b84197c2042d1, 0x5fcf244f0ab2b9a0,
+	 0xd1229095c5cbe627, 0xb749e18f8f9f09cb, 0x2534395c1538a1a1, 0xabe5f189b19efc0e,
+	 0x183edebde9e2ec54, 0x37c8868eedf3a167, 0x5873e30e99f3ee15, 0xa21dce0bda0e24f1,
+	 0x6cf11ddbcd61f20e, 0x1f0c7dabaa59d563, 0x79a9a074c9f45bd0, 0x810d06d654a64ee5,
+	 0x1f0b673bd060a74c, 0xf83edf6c9f3380d5, 0x4d77066344ad193f, 0x711a7648da285867,
+	 0xe16773912ab6ec00, 0x5d7b48b7c9100984, 0x55974c6fedbc6d44, 0x49bfcab88009e57e,
+	 0x37dbe4e86456ed7a, 0x91e4575ebe9a6390, 0xb7ca2ff43124cc82, 0xa9d089e1fece5408,
+	 0x29de4e4b505731bd, 0x335e7a239bf34be8, 0xd2676b07e1f59248, 0x9d4600bdde868e31,
+	 0x0cdad23abbd8f724, 0x7642f28b3d6a6f24, 0xb40056394fd033b0, 0x05f365a7d8e96509,
+	 0x473e3951f920d5c0, 0x4bba03ef793947be, 0xbe897144f27cf4ce, 0x1a48ea4a3dd4ac9f,
+	 0x25743114543bda59, 0xb66c8908fad158ef, 0xb9198d6fe102787f, 0x5adf89dacdde9276,
+	 0x0d68037c7262b381, 0x556b9abbe8fbc21d, 0x9440f4c89cbefa88, 0x472fcadae6884b7f,
+	 0xf01d15c4a1c13f41, 0x08d12ba89375d8cb, 0x4a4d5714c4da28ba, 0x018c1a9dbb79e6c6,
+	 0xc0cf138bd608a615, 0xc03f4aed4f747ebb, 0xfe3df4f028a8c680, 0x37c908acf6498a80,
+	 0x11a83d1c79c240cb, 0xf288599b7e8eec41, 0xf280d65be5f96dcf, 0x9099dd9b01020d05,
+	 0x28e8c2f370b4e1f2, 0x5192e986947bb243, 0x6fccbc8db09adbfc, 0x604f26fcfb579dbb,
+	 0x8e76a6c1c9a56adb, 0x04aa4f4f2a483463, 0x95df45ce25275ce5, 0x98d65dade80d6b7e,
+	 0xf613f27a334c9656, 0xc3d9353b9d2c5555, 0xa5a43f0f54e64d62, 0x2cb888274c6eb26f,
+	 0xff612c0f98327245, 0x6dd4ed6c77ec50bf, 0x578a431f848bb0f7, 0x2bf7f0a16b686a5b,
+	 0xbb380665b000c4f6, 0xa0792f0823eeba2a, 0xc48e0f4813734fdb, 0x5395d985150e6c22,
+	 0x43694eca700d620c, 0xa53485b89b827983, 0x3b7037d146474ded, 0x8153d070ca33e364,
+	 0x41246486b03b083e, 0x0ee63440148ad73d, 0xf8bbd41905bd359e, 0xa5378ec3dc9188e3,
+	 0x48b800ece81e0034, 0x35cec7694be8267c, 0x5a2d643d277418e5, 0x07605e9d614a3e2d,
+	 0x2665d4bf96b55c89, 0xedf508ffde9d0e32, 0x630d65e5a52d8fdb, 0x9de4df7fb6b4066d,
+	 0x2816a70886510efe, 0xa513a2a86b7bcd9b, 0xf2cb4fdc4531337e, 0x45947a6c4f8d8ec0,
+	 0x0ea86c6e026b5007, 0x536ba65873553b5e, 0x874b8bbe4d9dfd63, 0x7ae88c5ef7182465,
+	 0xe7a910b02e716042, 0xb83cc9d49087b29f, 0xd892ffa62c02997f, 0x7a2e15a9597c1093,
+	 0xd99cb64eb0ad9bab, 0xb8afbf568ff91df5, 0x23dbbdfcfcddb32e, 0x9c5cb6ef00cd1d4f,
+	 0x84c93017afb51511, 0xf3215735650b75c9, 0xea2dde92654eb022, 0x85557a0217419ff9,
+	 0xc93a8457d5172563, 0x2c267865ac1dcec3, 0x884886a003c4d017, 0x3777cdd563459370,
+	 0x74a1af89d5d5fc35, 0xda9794ef0247521b, 0x73107038b88f5c44, 0xb1ce480cedb8e3e1,
+	 0x3d7379e8578227ac, 0xc2d1b1bfcffd268d, 0xc8f495ff75d699fc, 0x334a9f1c15144ab8,
+	 0x9e96d4d2e8905b5c, 0xfb84ad0c7ef46f35, 0x1112f8fcde995c41, 0x0f712133e228d0eb,
+	 0xe8434d0fc7152359, 0x310b2e82f4ce6c42, 0x9c7fe0b0d167fb89, 0x16bedaeaad6d6ede,
+	 0xed1f8fbed4282b75, 0xa0623041f804878a, 0xdb3390089f00c858, 0x7aa276c593d9a244,
+	 0x436a77957e6dba9f, 0x8a0021df3d9d6c78, 0x59538abbced499cb, 0x22c787a7abd02a27,
+	 0x053176fcc1730bcd, 0xfe1e0d8d66696119, 0x25952bda599b7d26, 0x91e25b42b2530550,
+	 0x104bf20f706d7ceb, 0x1fdbc589ecb77d0c, 0x9be1422644282c1a, 0x57c4aa364de405cd,
+	 0x094ec7022c9f69a9, 0x147a2eecb29c13a0, 0xaaff336883579b3a, 0x8b1caf9ef2d4e575,
+	 0xfe51c46b901458ed, 0xdc2e9943eca6c05e, 0xef55be21bdca1c84, 0x660a4eba4c3d694b,
+	 0x37fa747cd10fe98f, 0x53c031badc08bd4f, 0x4bb18ecfbc873aa2, 0x9b3e523a580e6a08,
+	 0x6e64d0eff973a56a, 0x8274d0fe7c22e9b7, 0xd8b16e87ebba2fe7, 0xaa90b2d82ba1b57a,
+	 0x5d3891e0d7ae8bca, 0x3c57b6e1c591900b, 0xc0d46edc1f5bd6b8, 0x61248ba6af7eaa3f,
+	 0x24a911d60c1f453f, 0x77e49be2f8a5de96, 0xfeb9b128f68110d3, 0x9654a7c36b2ec3bb,
+	 0x9cc6811941eeee74, 0x8bf23b288f4ad112, 0x2e57fd06ad23c3bc, 0x4e8e6ea82b49e17a,
+	 0xe016f735509fff94, 0x701218f654ed06e5, 0x2a55158f77dd6abe, 0x48ab31f1c233a687,
+	 0xd6b6797850e9ea76, 0xf8ea9118b6e9fabb, 0x2e058cdd1feaa748, 0x69942ebe31111d55,
+	 0x10b120814bfc41e9, 0x4608120f3261ee64, 0x2e3557386080abb1, 0xa2a66cabbd099277,
+	 0x2e5806843ecac631, 0xa9b369151b64e82c, 0xf74883b9ee2f11c8, 0x92bd0e2668cf49f0,
+	 0x024ec68cf9c038fe, 0x82e09539b38377c8, 0xf2ef78cb1ba80ff6, 0x493086281bb78d92,
+	 0x8c3d5a9236322fda, 0xe8b49b9378bff399, 0xa90844ae523c424c, 0x6a22c2938e8efd0f,
+	 0x5f443f5a149f94aa, 0xeb6b6e9b7613e317, 0xf4cd6d87cc4635c5, 0x4f3e13ee17dc0716,
+	 0x448d539a8866255e, 0x346e895f2a231dbb, 0xd61017bc1ed31538, 0x81370b94acfd3f7c,
+	 0xaba1d83900311e15, 0xdbacceb9890d48ad, 0x7b6e8b7e75bf818b, 0xb5ce5139478238f7,
+	 0x040c6605f9862216, 0x4f759ed88cac1e4b, 0xe81fdfcae672fbd2, 0x7be7ab962a10ed69
+	},
+	{
+	 0x2963ba57f84bb900, 0x68e450a9721a8be7, 0xd1a3bf110d32faf5, 0xa3b5a98fe812ecdb,
+	 0x355a9579af39175a, 0x2aac883f8d5731e6, 0xc8b7149435031d13, 0x041afe06046c5c65,
+	 0xe4b07d454f377bbc, 0x6178ff38d1d0e92b, 0xbd7bcdbfa69a614e, 0x4bfe7268e01eb83c,
+	 0xb69a9387387e40af, 0x61f0d8d7235bb248, 0x3abfc0d597512762, 0x4c217ea0b419eefb,
+	 0x5d2ec267c55e3218, 0x32324ae237638e6a, 0xc3bbe6ec06856744, 0x909d43fa12f1e76c,
+	 0xa6dfde3b8e13b4d7, 0xefae1772f22027b3, 0x3e24b68c42d25f01, 0x36999bc53201bdbf,
+	 0x5a0b032fb59b17ac, 0x3ffb022357ea0e9c, 0xcec22d17606c5a15, 0x6e9ae477b3f10ea5,
+	 0x560863ff64550ab4, 0x02b244771ac72775, 0x7c5fc76a6f885afc, 0x697e596f4fde4279,
+	 0xc6502295c2a06259, 0x3c7f33492ad83afb, 0xbabed1cef897d3e3, 0x869fae9a381f0a27,
+	 0xbcc28c54281d38fb, 0xadc0f7a20ff436eb, 0x4b950518eddc88fc, 0x0423e1b94fad9c15,
+	 0x84280845e4cee472, 0x8636a3dceee620f2, 0x8b18d29c2ae7531c, 0x6706e25e8ccd8ba9,
+	 0x5fa0046cdaf5f5b2, 0x26a72719fba60463, 0x4c93c7f9ac60076e, 0x21666d04dab51781,
+	 0x9b9855520848a490, 0x4d9a0ae6766d4387, 0x6e9fc7c41e540a6a, 0x201f34c36c1772e4,
+	 0x9a11d1b16f2e787b, 0x6fb5a5f99568a2f4, 0x5fbdac243d40f842, 0x95091d387590bdba,
+	 0x2410cf4366ec16e0, 0x7ca296414895126d, 0x8eeabbaa1df13883, 0x78e9b9d6e7d82e1a,
+	 0x463e3ffec61e6613, 0xaa7588c4e0744f5d, 0xe6107670794e0353, 0x42dd629a177a742f,
+	 0xb9ff8a4113aef8fd, 0x5c3e5704203c557c, 0xf3aeb2b586c1bbeb, 0x57778d4fc9c55d0c,
+	 0xec5077c0699ca412, 0xf5d6bb336780b73c, 0xb57b341769172bb4, 0x7364c8aac833b5d8,
+	 0x965b0d745d6da9d1, 0x0edb812d6a81c2f5, 0x82fc13c75aeb5ef6, 0xa8a04705dd95bd58,
+	 0x5190c62054fb7c6e, 0xe1aa2994dea56a53, 0xcedcaae707472c90, 0x1c55734421c4e307,
+	 0x977fca6377c29e6c, 0xa2311d89735b587f, 0x382595ef3d9870b2, 0x8eb41d03c3d9bfcb,
+	 0x6b9e8cbaa5a92379, 0x05788276f208af00, 0xb0d8723a19a0aff2, 0x4444e3dd24672cf0,
+	 0xdd52255ec507697d, 0x8c7ae9c9589dbb17, 0xad332343f37b2e97, 0x924b043e1c131db0,
+	 0xde083ba0a1441a90, 0xc27c917d3d2c6e94, 0x4cf2b96cf7198458, 0x404dc590810913a0,
+	 0x3f971675b117b711, 0x2d6c897154cbeaff, 0xea06f167d0030ff3, 0x26972d7b542dc6bb,
+	 0xb7503e8485c8a904, 0x4547674c06f52637, 0xdf96874ab6aa97cb, 0x94ec94d134ba8d51,
+	 0xab12523a66017be1, 0x6a5a0891beb589ff, 0x5b95fe3b65e43fc1, 0x20755fbd93f68092,
+	 0x444fc62d7a13b0b7, 0xf207388727e8af11, 0xeab80b78616bbaed, 0x7c738fe45171c14a,
+	 0xbe3468f9c3066a95, 0xba17a20d68d9ea82, 0xc42feb5bddc51cd5, 0x1a9f3b62b6448986,
+	 0xb0871248f8bd3a0f, 0x0971b0274c8f73ce, 0x0aad9701fe824e75, 0x35878f3ea6049d73,
+	 0x8df7b99f9696a532, 0x9f74c76267f7266c, 0x797aa17c91544293, 0x12866e3aa0c31374,
+	 0x11c14629c0fdb810, 0x8c0b8078868dd4c3, 0x0f925ede3a44502e, 0x1c2ff964c8005c15,
+	 0x045c5c4c682093dd, 0x74fa5612fff0c8e4, 0x2702968977203f9f, 0x4253a448f5a5b27b,
+	 0x5e7181cd020e8134, 0xc0c2ae79213f2151, 0xf5574097fe96f67d, 0x3ea27cff905f56ab,
+	 0x3e204e45e4ac678d, 0x67c7f6ef3dc7b55d, 0xecf1b78bff796368, 0x887d784b3d74abd7,
+	 0x02fe31f173ea47ee, 0x14ffa9a5108078e4, 0xf27c23f5f4e5d435, 0x8b2e8bea698786a0,
+	 0xab6c83b02a616434, 0x6e9b1b8442fa0506, 0x5ef8f105b2510725, 0xa08742956849e8ac,
+	 0x88d46d4cc4182f2a, 0xab7bad38098b7db5, 0x8a5fc262d0a41cb2, 0x0a5e3a847849bd5a,
+	 0x5845cd3c84ae3861, 0x21ae6d817da9166f, 0x83bfb46f1127dc0b, 0x904ee8ca20cea94a,
+	 0xa65a1e105f1101c0, 0x43bf3b37c9f1a5b5, 0xae1a21099204f5a3, 0xa1ab2f6037599ae5,
+	 0x8574c120363206ce, 0xadd15944da827ee9, 0x5772107c7f8f445b, 0x206675501d892bb2,
+	 0xd79557dbf3ac5517, 0xfe2c78cf2022b3e7, 0x209797b5db3f0b0b, 0x2e6331c2d6fc38e1,
+	 0xd2c2a9e95e05b6e7, 0xcc0757509e12075d, 0xa9c2c63d72cb2b0b, 0xad48055353723dd2,
+	 0x0bf0e6ffcdae85f9, 0xc1ffeca196f5e2e4, 0x4990e8862bcbcc4a, 0x618652fb670f366f,
+	 0xdfc6d8bfba9cbce4, 0x0a243ecafddc2ebe, 0xb821f0d17892b9d3, 0x809e61d97deb8249,
+	 0x688ab07691f5dba2, 0x4dab9b5543d9b5b0, 0x905319b712364af1, 0x118d3b209d2ab21b,
+	 0x6790a64cfa4d7c37, 0x735eb64e4a46c3bd, 0x9cfa2363e879b3bc, 0x6fa24b40d5265fb0,
+	 0x4378058229a1e071, 0x3bb29666e31c5d03, 0x86a33cc19f435fa2, 0x94e3249a46c353e6,
+	 0x5b5a6c99d484ccfb, 0xab817e70f723b4cc, 0x2c7095d3832a2835, 0x81e8424b2440af7c,
+	 0xec901e3e2fface24, 0x9ad31a6dac732be4, 0x885b5b312ae20980, 0x386b57224a9411ca,
+	 0xab920bc04efdfc72, 0x98eb3657727c56f7, 0xbf5cc6ec22e95dc3, 0x0bd5a221f2c8bf47,
+	 0x3a72926b1843b0b6, 0x8575162246bdc8b1, 0xe150aad3ddb18f1c, 0x6da41b5e6b617fbc,
+	 0x98870c2d31af58d4, 0xda15d95a8913bb1b, 0xc053fbd849c02c60, 0x1170be39e94007ca,
+	 0x0bcbc08b6b2e6fda, 0x8c952931e4261bba, 0xdc1522edb7ac06bc, 0x0c3a4df9d9855b23,
+	 0x7831dc0316f8be00, 0xbd43525d39b5bd14, 0x66dbb46c0c0a6b5b, 0x65228e91c2221848,
+	 0xa98fd5e48714f4a9, 0xc905135d45103375, 0x7f4f0e893f59a0b5, 0x152abc6c268870f7,
+	 0x20dd6683831b3a96, 0x1631ced2c39a423d, 0x14ab292f2b01f1be, 0x3cf45eb0314acf8f,
+	 0x614c36483c349d06, 0x7ed41f5c1e3eaf1b, 0x55e449edc6eebb4f, 0x6fd2ac5a21c57464,
+	 0x4de4f9d2d79cb7bd, 0x18acdbf90bd3a591, 0x07ab4c047519ad06, 0x17e630a98d099d46,
+	 0x597c07b3225447e8, 0x5c79f4216db78d7a, 0x8132306a00ee7d77, 0x90266bf5ebaafebe,
+	 0xcce655c8d6ba0f65, 0x2eb24f990d4e895d, 0xbbd0763cebf2bcf8, 0x5977eb473189b76c,
+	 0x552e5378f278a52d, 0xe34c6552ea0eb2b5, 0xe6c8bef616f45139, 0x30e4e0fac79558a5,
+	 0x2973b04a982d569a, 0x37a596733f2a2ba3, 0x91bf980f43ae3fa5, 0x06553451a9136ea8,
+	 0x53b3f1bf985872cd, 0x817669938fca6a88, 0x7e29b12bda03eef9, 0x55cdd12f86910ebb
+	},
+	{
+	 0x256efe1c8f9bc776, 0x255f7d8bfe7b54b1, 0x2d8eb828d2f81f65, 0x18b27328c76f12ae,
+	 0xd7b0bf3e34b53478, 0x324b7f54a51f0ec2, 0x66a072a35ddfff3d, 0xafd54cc441ab6d4d,
+	 0xd98e1aa3f4444c4c, 0x22debf7bec2b90a6, 0x3c9f9aedededcef6, 0x40abc774114320dd,
+	 0x3fb88f39a2bb45a8, 0xe150cd5d0fc7aba8, 0xfba795b6dbebef8a, 0x0c12053eb491557b,
+	 0xbf4c860ddeee1781, 0x571fb6eed4f0eca4, 0x283fab171e0c2480, 0x999ef7827fed452e,
+	 0x6fa24e2d061ada4c, 0x8119a3db932783dd, 0xa9bc269b69a479f0, 0x66ca0e85cd9f96e9,
+	 0xbfd62609f59becb0, 0x7fa301d6944cd543, 0xcfa68c8a96bb9bed, 0xb11d830a1e265983,
+	 0x276c42e2ce9dd591, 0xc969a2368d0e1121, 0x71128f10abd434e7, 0xb272295b7874ba8a,
+	 0xe6d0c60a90330837, 0x98207dc1db70d73b, 0x66ba6c3c81044a1f, 0x29186da21cf6ad02,
+	 0x3f36c91eb977d40d, 0xa3364fc533741c3e, 0xbe0c143877b97f62, 0x82b315c1f093f2e7,
+	 0xe4812b7248ff2748, 0x04c7315404412d89, 0xc795b58151f27f56, 0x2a8c7ab8c390e7f3,
+	 0x95193316bcf3e9bf, 0x48fe5519b95ff999, 0x6fe89347e0a384c4, 0x33b0ed12482b9558,
+	 0xc878fc8e2e9f7fb2, 0xed87041065de4295, 0xe9384f132b0ff42e, 0x87873f004e406405,
+	 0xce8b0ef38f43e31b, 0x4a303b3b7274f63b, 0x177cc6ec27a67389, 0x0f9c479a54f74255,
+	 0xa1515cd584417913, 0x2d6f9137ae470d42, 0x8a001a2922a0a7a5, 0x3a447cf58c291857,
+	 0xd832643d537d3241, 0xdbf3d058890475b9, 0x4bcc408d92d81f26, 0x09d11ec3a448a14d,
+	 0x412188227184f711, 0x5c35cb60ce8f7184, 0x8a03c80d259fc812, 0x04243285c02b2d72,
+	 0xe9e0e188a4ec2182, 0xee86774dc71c7d75, 0x5dfae3f6070790c2, 0x3dcad5136d91cc6b,
+	 0x71fb3c64df72b1e5, 0x93697da07a6089d1, 0x2360a5ce528b9a6a, 0x98d5abb101730fc0,
+	 0xbe539fc61e2b859e, 0x0aff1940f43af85d, 0xaa844ecb55f5fbce, 0x5248adf4650a93f4,
+	 0x18a4a544bbb5e590, 0x23e0e9b02143d6b7, 0x2149fa1d452f97cc, 0x9dd78b590ddfe19f,
+	 0x0d93b8ea53a836d8, 0xf3ea1c97103502b1, 0xc7e9448dc0adc461, 0x1a0a473577337e4d,
+	 0xb14fc4f06b557151, 0x634d51a43e724eba, 0xb62c08c32d74cd4e, 0x7144a70f56b943ad,
+	 0xc110101d3b19f9b4, 0x3158999497581b1b, 0x21a8f517df163c18, 0x4cfe940557b33489,
+	 0x65db78327455d289, 0xb01704aec77de429, 0x25f579bf704e0086, 0x0fb4d7c38ce0f350,
+	 0x0812718ff92637fa, 0x5208f647c114aa51, 0xc75c7afb9d24c3d4, 0x4defdc6cd0a55d72,
+	 0x4233c2ede866d057, 0x3aa1335b16d8ecf4, 0xb06df87193d014fb, 0x997778c09e6503e9,
+	 0x2fb8d9ce6edc98d0, 0x34d3645c93e87bdf, 0x04db07212b0572a0, 0x19219efd1e4ec643,
+	 0x26787f2ee1b15553, 0x7ad171d94b38eb78, 0xcaebbbf180493a00, 0x311c030497ea3704,
+	 0x20a39640d0782166, 0x51714d704b476a0a, 0xa7e05efcb22cf694, 0x6f7985591d6f81e0,
+	 0xc5ccec48ca91ea5c, 0x1de531732f2f2aa7, 0x20f91b5e30d7c174, 0x02c42c1b3a514008,
+	 0xb8a4b86651386c50, 0x36eab55f5c03fd0f, 0xfc4cc33cce3da7e1, 0x5aad7b0f0a1555ff,
+	 0xd4db00412a190972, 0x99deca893a691341, 0xa9334549e04f43ed, 0x6797d7bdd7ce97d8,
+	 0x58074c366bccd206, 0x153579082082a882, 0x1fd22331413708aa, 0x0168785e43379e73,
+	 0xa4a99123d135dafa, 0x8b3941dfc9f6eae5, 0xe85a805ab8b345bb, 0x60d5aa1abdfe097d,
+	 0x5e401d17e07e39c0, 0xecd816fcfa5d3493, 0x61ac9eb1e591c84b, 0xb110b34d2a9a8129,
+	 0xda5b593d7f7378d8, 0xa2fb21b55e8092f8, 0x1ba5081a8daba3bb, 0x87e687e7a3dc3e28,
+	 0x05a22367ddba5c7f, 0xa6faca72023cc915, 0x02e23de3376966d7, 0x1e8d7a4b4e1f1864,
+	 0xb729ede1b13e49e3, 0x32e8daf09d3779e4, 0x61dad6d6d8fa8c71, 0x24f018ae35a0384d,
+	 0x2fc152506a9ef7dd, 0x6bcf5c7394c227eb, 0xa6fc31695cbe9531, 0x98a8895b512583a7,
+	 0x75ed55d55e7d7c09, 0x90ebfdc5d4854990, 0xf2bfd68ba6fa3e46, 0x61e8b919439c425d,
+	 0x0351951d58be429a, 0x09d3b739fff7d1fb, 0x58547e65b9c2f8e9, 0x07457144388a9c26,
+	 0x32023fe5fc4c745d, 0x2d1c2e4b78ccf697, 0x67c81a43822ede7e, 0x9c1d93ad18749d6c,
+	 0xe12c23101c9b845c, 0x91ce8ad8826ab088, 0xcbadd7bdc6e0c777, 0x9ee120103ff6efa5,
+	 0x2847b0ca9e6af119, 0xe5f90cc42deadfa3, 0xf6907c0fd859d885, 0x322fa97788a150df,
+	 0x8e9bd50f84391d24, 0x232d7286cd534da2, 0xf89a9cab4fe67cf9, 0x4f31599434388739,
+	 0x0c5e3b15c1709f56, 0x6df60f4e078b611d, 0x5baa804d6c0652b8, 0x1da72beedfd55e5d,
+	 0x45389541ab7693ba, 0xdeffc079654f67aa, 0x0463cb16cba7fcac, 0x38b2e48ec6d389f4,
+	 0x3004609f5fa55e4e, 0xe8fa91bc198f260a, 0x35645a119de7c0b7, 0xb250a4931c84ef2c,
+	 0x9a6429d9990389ff, 0xb31261c3ca585483, 0x54ee3cba5c70305b, 0x9caf1eb38d989711,
+	 0x0dea0ded6be80627, 0x5691e7bc60611494, 0x93dc6da77790a812, 0x1296f5f2b7569c51,
+	 0x0a7b4309820d8231, 0x321f3c2f23cfc5d2, 0x0e01a8cb16ebdc33, 0x1be1d4b5651f1229,
+	 0xb7c27026d4081cd2, 0x55dc30579f2a54ad, 0x87a4ac56c0ef3305, 0x2ffac5b7c599a9e0,
+	 0x9b41cd832c54ff74, 0xac9cc2e14dfb534a, 0xf626dab7f67f74da, 0x49892035f7977844,
+	 0xb531e4c503a8f286, 0xae69915b677c4582, 0x2d83b9e91efb1acd, 0x35052653008a9572,
+	 0xedab59863bd8ae3e, 0x8afeeae72d2a0ada, 0x90198005a22a0039, 0x992ba41626741fc6,
+	 0x4524efaa44ad13a6, 0x9cc40f618a4980e5, 0xd6ba2673de488ce7, 0x76abcd68881044d7,
+	 0x890a623ad9f4487e, 0x3152c7478bd22f54, 0xf68768d96ab764f0, 0x8a11468b45029da8,
+	 0x05d8335072712724, 0x37bbd24ca274be16, 0x28bc8bddbb505fd9, 0xac23b466284e755c,
+	 0x37b7dcedad5af2d2, 0x886c79c40005f74a, 0xfee698dbc79b757f, 0x0832c1c4d8d09fca,
+	 0x1751d2ca04389bf2, 0x3ca39daea9c6aa94, 0x6d54b2b6938f5e09, 0x27c69faaa164fdbb,
+	 0xc8d5ccdb51f7bc62, 0x7ce3da4bde4f56d5, 0x6ceeb9921973db2d, 0xb5fd765315d4e179,
+	 0x5058bbf9614fb78e, 0x921f8585ec4dae3b, 0xbf4762bc99faccfe, 0x70d8c35461f250a3,
+	 0xdcabe82162307758, 0x7f28143bf944cd48, 0x047032d437cd556b, 0x9b7a55f2ad3688b7
+	},
+	{
+	 0x828e555c21db1fd5, 0x3758b1fb5de1446f, 0x7b1c5f248241144a, 0x16ef1be60b6ededa,
+	 0x2b0bd74b275a4383, 0x0f12f9a466353515, 0xe933f0fa332fd93c, 0xafaa1fa311e6b54a,
+	 0xe4ee2672783d6c4a, 0xcea0cbce600f6c75, 0x353d570d68b6bf9f, 0xada5f8ef19fbb481,
+	 0x8470c60bf59926ed, 0xa8c25cfa6b9ae262, 0x5fb05ede8480bdf8, 0x6cf9b6deee570caa,
+	 0xed23b7964800d44e, 0x62c0ead96a5ff6f8, 0xfe9223df10140e42, 0x41be66b0a41f9100,
+	 0x8eaa6130b3bcd090, 0x308a8900aed642db, 0x1eeeca8cb778df35, 0xb6282e7f1ff2e64d,
+	 0xeff534ed47d585df, 0x5fd21b0bc1a8ed73, 0x7028060c1849671b, 0x4c0b134aaa1d034e,
+	 0xade2e05858d27ed5, 0x6d227604b4773e73, 0xde596c35e9c1cef7, 0x317786d43f6401e4,
+	 0x880f67c54a50e32b, 0x72038ac26c82db8d, 0x9d3a8c01758fdf33, 0x65388af2c8ade999,
+	 0x7d0d1958f01cda63, 0xfec4e8d6fa1626bb, 0x7f4435ec8fa23a82, 0x0a972a36fe85f7f9,
+	 0x4d6b7259cbbaa61e, 0xa61dfadf61a87fcf, 0x908cc3725c2d6102, 0xaf96be4ebd882706,
+	 0x2ccead65e051a383, 0x92491dc5e498af6b, 0xc8a321d82d3f0df4, 0x34d871c3654be811,
+	 0xd0b4617610060ccc, 0xaabbdf4c35ce2a5f, 0xe006e58962c717f3, 0x78e128c8e407f5ab,
+	 0xf64bdc40feeac5f9, 0xc7c3038a84cd2b79, 0x123ec7d5891f9565, 0x5c91a83e0e67d9a8,
+	 0xf788876a788f1548, 0x9e3d727be1674583, 0x84b6fa62514721b9, 0x99ff25c39cc2095b,
+	 0xaa48961c5d0030c8, 0x44b34a04ae3db099, 0x508446addcb5a0bd, 0x36aa09e5626142ad,
+	 0x440967ebefe67ee4, 0xaf01b705dbff8ebb, 0x8ccd3c91fcf8ed57, 0x126c3d91131544d6,
+	 0xb451258df327b734, 0x89d5065452a0a07b, 0x78f001e1fba0c27d, 0x4a8c3bf837a06f03,
+	 0xfb731a041fc87c81, 0xf98784993ae5595c, 0x4f1bb87e56770089, 0x082a4ec7bbcb4f81,
+	 0x707a339f4350c18a, 0xbdebcee9976976f3, 0x5c9e926661488500, 0x22093ab5799f5dad,
+	 0x9f36a28256e0807b, 0x3b28339955bb005f, 0x9a67a8cdf3ce594b, 0x30fc8211bc598b0f,
+	 0xfffaf1a39ea1c012, 0x558c2b095e535d35, 0x2d07e3f5d488df63, 0x97e0051364b6b2fd,
+	 0xb53afdad978e7344, 0x795577c04c97dd35, 0x2133a859bb632284, 0x23bad4fa1cd4a25f,
+	 0x1fd1abb5015b25b8, 0xd542827357900a96, 0xcb0eea0775b1ee3b, 0x8255200590910a56,
+	 0x0dad0fd83fd21640, 0x80de5867c67b884c, 0xba880b46eb53db7b, 0x5421e2c5a07e76e5,
+	 0x72dfa982ee3db4a2, 0x30c112cb965f0578, 0x45025fe888e18582, 0x89edeb685d0e6b66,
+	 0x0959084a86c1593d, 0xecb5134719f24259, 0x8bd4e76e73d289f1, 0xb1ce0b0364c4a0a2,
+	 0xae054ae4bd1353ad, 0x146ff89eb4a07a11, 0x9b71b4e89fa87345, 0x31ec08a858f7a855,
+	 0x405993263ad5d4ae, 0xe05f2a1d66ef2cc6, 0xea2c2e61fcbecefe, 0x6fce7778140ddbb3,
+	 0xab40fca2078da415, 0x077b78b3f6d54d37, 0x809f0d0bf897e24d, 0x05e4347e433e4014,
+	 0x8e541905166cedc5, 0x64634dec1afb2175, 0xaf6ffd0dc6c89745, 0x48ff89c5a63951d1,
+	 0x5a7b19ba09e24341, 0x5be469e46dec1d8d, 0xbcd048f3fdc1f4b2, 0x3e7a22dd6c68505c,
+	 0xfe32250fb5fa2574, 0x787cfe898dc17944, 0x4b13c3bda643218b, 0xa7ea674a1293a69c,
+	 0x60cf6321d248fe59, 0x08e527f9f9ac3cf0, 0x27851521a0fc0401, 0x5592d86ebfe41e7c,
+	 0x5e5b3d3c2608ff73, 0xf2d087ecf014ce08, 0x60a744b22aac0248, 0x6572a8615b10072e,
+	 0x4426bb55d234117a, 0x342a9a0cdaeecd46, 0xe996a81aa96e8f35, 0x70d84179d6751154,
+	 0xfda90d47858d75f5, 0xcf74e96b6d6dddb8, 0xbb37e1d1e345e49b, 0x990dffecd34fac83,
+	 0xacb7e48fb81366c0, 0x1d1c5eca521ce147, 0x5ff42c18e113bc22, 0xadef3824ee4e0902,
+	 0x20ebb274b90419a2, 0xba7709f25dbf90c9, 0x489332137dae7a44, 0x57ca893f6ef4e7bb,
+	 0x988f9c7a3f49d0c7, 0xd44edc5cf8652aa0, 0x0cf2c7ba17b33663, 0x6453206ffda522ac,
+	 0xcd2dc99a80411aee, 0xa50db94e8fbfce6b, 0x6042fd247b53d6f1, 0xae2a2d0c99d6490e,
+	 0x680d8ef487d7fe62, 0xbe24b59bef86929c, 0x91398ff5a61fa0ba, 0xa684d97347ef31c3,
+	 0x27185fe575abe1bb, 0xfd51f66775b542dd, 0x920f8fbfb120c692, 0xa7d73c723937fa17,
+	 0xb2830c6550e9f4ed, 0xee356d2491327130, 0xf621d10e0a7eb5a7, 0x26df92cfeed1290a,
+	 0x574143bbf3a70a3d, 0xd7fa5a77e6126117, 0xd47b7b7646dc4ac9, 0x50aa97c1f792aad0,
+	 0x099e71e72d785174, 0xe2063436b64960e6, 0xfdbaba722572b48b, 0x24f36df04799110c,
+	 0x2ae564f35844d22c, 0x57030a2c1886ebc1, 0x70743da95e6d81ea, 0x53c2b535545b5da2,
+	 0xf061cacd3d0b9a76, 0xbae52e3c768354d9, 0xf643f31295f77f03, 0x7c1ead5bf893ae0e,
+	 0x6142722deb5a4bbc, 0x57109dc55bdb3da8, 0x6e4215617e35c676, 0xb5cd48ed1fa333ff,
+	 0x43e7a16b1dbdf690, 0x351aba6ca7aed17a, 0x0e1362410bbb277a, 0x14a1b0b376575205,
+	 0x82842a6b6d04f207, 0xe7b48689ddc67946, 0x86f4a6db861cb907, 0x94ac9354b3b8f5ca,
+	 0x2bf57d3b978f4c29, 0x19b56609d7b4e5f0, 0x7e291165c7f40884, 0x4804f10f9205b872,
+	 0xba17252913bb7a90, 0x1af4ac2c3ad9b730, 0x5b0e533aa3921ea2, 0x8003b7b3f9d657c3,
+	 0x5b780f4d7ff209f7, 0x4cdb973da95de389, 0x3cf02041da19d668, 0x2f1f3f78abf124e1,
+	 0xc963ba5b5716839f, 0xfc0485c4446126aa, 0x118049950e3abf87, 0x8082bbea19775154,
+	 0x1990d8d53664b38e, 0x5daeac17fd8e58e8, 0x28454cdec2ea6c2d, 0x220e853c43084210,
+	 0xeb547a1827413c19, 0xa38e5cb1cda642bb, 0x3fb5692d7a4864e9, 0x79cfe643153c86fe,
+	 0x03af38f330b400c1, 0x502a6def1a848cd4, 0x2e29e32b6830929b, 0x64ffdfa10d84901a,
+	 0xb3cfdae67915bba1, 0x2e4a5a53f0e6d369, 0x3d55defc6bec18b7, 0x2158e1cfdaab8220,
+	 0xd344d8562a2a134c, 0x47f836f2b3706848, 0xf7751242ecd34966, 0x2a319f5950251619,
+	 0xc588b37d848bca35, 0xc15de26426a478c1, 0x39392cc78ceea9cf, 0x04b0db6c7c483b12,
+	 0xbca83be24f4a73bd, 0xb242d7c34ad9f706, 0xa7c405ce2544cb35, 0x2b93eb770c28c4ed,
+	 0xdeb793afb59514cd, 0x3cab6dd41220e997, 0xef184bbaae60a3d0, 0x2112fb3bfba3a07b,
+	 0x0ddfb4c28ee91a33, 0x7611188539de9ea1, 0x86ad9af1d4450290, 0x518d6a6557915b5f
+	},
+	{
+	 0x91006feffb74ed8a, 0x09b850b448514952, 0x2e0f49b9c73e7a38, 0x87a91caf8895d2bc,
+	 0x067d2f83411a3f9b, 0x68820d01887ad3f9, 0x3b621aa5c5473d02, 0x112b1995d7d0a365,
+	 0xcfedb01e188cd5d3, 0x1c5261c5227d61f0, 0xead0038238197f1d, 0x1afa1c8840ae67ff,
+	 0x430575a364961c6e, 0xc1f5a80d8b0d0c42, 0x5072405b5a9e9069, 0x36297b481514c937,
+	 0xd8063caecc1bcc60, 0xe4923f99d022d9c0, 0xae228bab43654e3f, 0x90c1bf43de49d6e2,
+	 0x39dc5f4d406cb04a, 0x986d2df9fa6b8d3f, 0x63f7c7d032dfbc73, 0x81ea3eeb81800261,
+	 0x4db432bd058dc871, 0xce1838ae212a17e4, 0xe9ab52886633cea0, 0x150c7705f2441755,
+	 0x0e1b66936478139e, 0x1a60653eff3bfe5a, 0x84d452f86c6be08b, 0x69187710ad6d3bbf,
+	 0x36bf5e9131af7db3, 0x036ace77e0694b98, 0x402512b32efbce84, 0x2683677148757603,
+	 0x02576ae8e411e97c, 0x15ce6fe02ad39578, 0x33ceb14d0fa1b935, 0x15dc9f8aa0e1cfe1,
+	 0xfe66fa6f68ecd9b9, 0xddb3c4b2f593c9a9, 0x2d67ccbb1899876d, 0x09f446953f5cfb58,
+	 0x43fff62ead07efb7, 0x1b8a5770acf8a793, 0x5858a094690e5c93, 0x33493fc8a3b10fe7,
+	 0xacfc071aa68703cb, 0xad1e8b1aab5a2d72, 0xf6aa4fba0a0145ac, 0xa232e46cd922b6d5,
+	 0x3ad8a05ab016c4ee, 0x8ef026994b3659f4, 0x8d01e88e570c4853, 0x58c3a73a2f043afb,
+	 0x96c6cda52e73fb20, 0x457b13f416a278a5, 0xe729ea8073f4d4a5, 0x4fcf28f34140c454,
+	 0xacc1f1776af76665, 0x8c30379c115af87d, 0x04e6f4b881a9cf20, 0x27b5d0b3d2d5f69c,
+	 0x67ce0796c48307b0, 0xa44282b034404e14, 0xd6df52689a95ab07, 0x9e38c40ce8583693,
+	 0x38352a63140385ec, 0xf4393b378a02c7ce, 0xe38269e7a8bfc1dd, 0x3088a773843afd9e,
+	 0xca8dcf7d0878b069, 0x7cab46d00110287e, 0x75764b784cd30b1a, 0x8c8729015d965487,
+	 0x17c2d9de61fbec2b, 0x66bef97932b23a33, 0x9b1f12bdef219a92, 0xa85369900ec94ca4,
+	 0xc60e46c562debb3b, 0x4c641ca1bb657632, 0xc33f4b83ab5b16c4, 0x25b6c1b23c4cf7c1,
+	 0xae0639d7b4cee3d1, 0x524f167b18ccb046, 0x1d420744bc8899ff, 0x0716f6559ba0e482,
+	 0x36968665ec15237a, 0xf243fa885fe90ae9, 0x0544631fb745f9b7, 0x1ca778d18f41ea47,
+	 0x8a9f45920abda486, 0xbadbfb4b14c0c4b2, 0x1d6e18567086d623, 0x3f8b8d80798135cc,
+	 0xfc4bc2da8ea31c28, 0xa9e7758ace7cbaf9, 0x7972c430f056b848, 0x36c1c059ee5b2472,
+	 0xf9a099629563e861, 0x22f844fadf8aed99, 0xbdefc0192c132de9, 0x9a7302a40ccbc2f5,
+	 0xd23a39a2387309b4, 0x67887093837918b4, 0xb13148a7137ca310, 0x47d50ca39d111b9b,
+	 0xe77bafb890a9b48b, 0x1696772ac0638abe, 0xd1d6d278dad8dc43, 0x3ba6db051e871787,
+	 0x5c48312087231c2c, 0xde697f758cbf4aac, 0xa567d58ac48c7d02, 0x4207d4fc85004479,
+	 0xcdf90e74d9338864, 0x20d9e927270408e4, 0xc39a603b541cae7e, 0x01d839ca25080a3b,
+	 0x19f172ab1aea95f9, 0x2ac9ae9aee4e78fa, 0x553e210bf4a87149, 0x728ec67278bbea84,
+	 0x53b0bb1ee9e1d997, 0xb435e39512fd1aa3, 0xec861ed62a08b7d4, 0x702037e6ace55fbc,
+	 0x7cae01a3bcba0e41, 0x5192200ec5bb38dd, 0x792ec173336b2671, 0x5c9df6552b2baba4,
+	 0xda172580d43da4b4, 0x8c52e2e32638a2a3, 0xba799ea70e24f535, 0x42cd6b5048e46c8e,
+	 0x81f8d8fd8f1367e6, 0x406b08499880ef34, 0x539179c50787145b, 0x70c163a3c997ebb1,
+	 0x1f32da10f8004976, 0xc9d89c0b4b61c7a1, 0x74b929abbd8f0b2f, 0x83e5f9ece05a1119,
+	 0xb1251af93f9a751d, 0xcd47722415602676, 0xc357491802fc9849, 0x7ed03a42270b3395,
+	 0xd284e0dd3185cc7f, 0x139bf6295b549cef, 0xc90b845275546cc4, 0x96c0b7cae520c932,
+	 0x89ab31e30e8bac61, 0x649c7fe9ee482432, 0x92091be02c90e2b5, 0x7e432751191a4359,
+	 0xa9c8d3c0be99c5e3, 0x13257329206fc565, 0xacc5688b5a5f2561, 0xad5b378a91d90aa8,
+	 0x1e02fd218c1a45d5, 0x82cb98f33e036575, 0x18cf2f94b67dc0b9, 0x116f0e8e2cb54288,
+	 0xdacfd42fd57c175d, 0x9758d021e8c7670d, 0xed9c41cf1e8dc1cc, 0x6e6132f8b9a3cd15,
+	 0x393831843176f234, 0x4ccbb01f024ef241, 0x3fef3f00e7bee361, 0x06af370b76148789,
+	 0x1940311f615474c8, 0x1cb5285e992f0325, 0x23cde36191e6f542, 0x92d5d9baeea15f5f,
+	 0x807ac8388c72da82, 0x6511ae1cacf06939, 0xa0ee4fa8fed574d6, 0x4358b7458d3d641a,
+	 0x800cb0a3cb497cf5, 0xd2f30d4f0f11d58d, 0xef78061c6a3cea31, 0x6b19520a89705a08,
+	 0xca234c48dc60b5a4, 0xb0652d6b951dadf8, 0x70fe1594232e209a, 0x021c9a2648c1f0cf,
+	 0x4fc97977f1fd9f7b, 0xa155eff2785d34de, 0xa7a4fe8f66a6162f, 0x9c532cdcbb1371e6,
+	 0x7b33e1674098440f, 0xe0e785b286f0a082, 0x37918035fca771df, 0x305c91087289c8a1,
+	 0x8465d3e79d2ab3ba, 0x9b871ba331e400d0, 0xad38a40131842ecc, 0xb306c2c71b1a5b1e,
+	 0xee26489d0ffbce56, 0xeca8bab01c312109, 0x6009938c2d99fa9f, 0x6ba718a146749556,
+	 0xe031ba217fc42674, 0x9f8dd4b9dc6e4f62, 0x5bce313d26f176cb, 0x8fe8969e0e46bf33,
+	 0xfb1f2d638c802607, 0xc6d83d20e15cd320, 0xccfe3810a1a9cf4a, 0x869e56b395ebd134,
+	 0xa02612f0b085d6b8, 0x3133387a99a5b335, 0xa216c81ad7786c8c, 0x656dd5c7ad7d7ba0,
+	 0xcaa6fbdd7f57741c, 0x760c523b2aa00744, 0xe3d732e8da2e93ec, 0x2d76c4c2d3c18e2a,
+	 0x363363dc5b3fd4ab, 0x3f994355da096a3c, 0x53558ad4f68f7b88, 0xa2317fe22e6a95f4,
+	 0xe96bf11f6297811a, 0xc7b4ed9187d84bc6, 0x60de88592c07f989, 0x9cf0e5cc43586dac,
+	 0xbb83af040867ce50, 0x288e5d374210d6fe, 0x842baed1377dba28, 0x367841c79c3a0845,
+	 0xefbe5c8ad1d7fecb, 0x5f0357eceaaac98d, 0x35e9c7eb2ee20128, 0x1355971d76cb482a,
+	 0x960af9f583291cd0, 0xc6df61d634f8fb0f, 0x635811e1c11c5365, 0x61e6998d9c3e97f1,
+	 0x4b9c63c58143de38, 0x62fa07b4b7176d93, 0x18937ca123a79973, 0x5216b2ea3477c645,
+	 0x5d3815d3798e8b75, 0x8dae10c33b537ec7, 0xdde1afb860b90888, 0x3b8837ccfab96375,
+	 0xcecd35ace0b58f58, 0xe72aedd33469703e, 0x6b08c023f172a5d4, 0x6ee593a0a117c940,
+	 0xba98a6be8e88e9ed, 0xdffe86cb41c65ee4, 0x34fbd4bbf37e3d78, 0x24f51af54e50ecf3
+	},
+	{
+	 0x3b7639456b2a4167, 0x44686e6d11faf413, 0xc2f8a913f3b16c9c, 0x4cff6bca0242ef29,
+	 0x7e2918ab38fa8051, 0xd7d43a0d733dc51d, 0x9a1768ee02097d51, 0x7e43628c07a91056,
+	 0x6a49ae0edfb19507, 0xf999bdb613d88d46, 0x86cc05dbd4d4d8de, 0x59b45d9d03e66387,
+	 0x1b7366f58273dd88, 0xbb4169c68d108c66, 0x53d6ecc92869f237, 0x9c87aefa75f82542,
+	 0x9b9d3755bc4b4422, 0xa79610443078e9d8, 0xdbc4bd374013a907, 0x1e2fc06213904ff7,
+	 0x54e55cd39c1ac4ce, 0xdd6d56a0e78fa42d, 0x014ab8d526f58ca7, 0xa50e3e2ea7287767,
+	 0xa8365ae332d22e09, 0xa3626574369d3e03, 0x58c316ee151fd5ed, 0x645527bc67c45bb0,
+	 0x970993e135b22b9c, 0x4f80d07fc172ccdc, 0x7a1fd762237403ac, 0x0e433bfbb4ba75ea,
+	 0xe2fe7871aabedbbb, 0xd09ab88dfd3b0d5e, 0x21bf4064f1bb0788, 0x8daadf4627cac598,
+	 0x338cbd19e0f9bdae, 0x7274e22025405cea, 0x64f90e2fafb9047a, 0x0fb0fa940626cecc,
+	 0xfee9e76975f116e5, 0x65c810e0d5836722, 0xae93880afc0c0fbc, 0x4d24b86a35145cce,
+	 0xf1f2cce57e0ea3aa, 0x41ae93880086d9f7, 0x32c51c43a2b3660b, 0x9e0b19e53806f5cc,
+	 0x85f00a40fb60edc6, 0x1386323870c2a485, 0x4a08d5c92d41fc07, 0xadbdad65b419dde0,
+	 0xf7b106d744ceacbc, 0x1dc14713cd6ce21d, 0x790d1d4e82c49a8d, 0x8825387f7121403c,
+	 0xf574b0c24868d965, 0xcb30fb831ec1b5bc, 0x5b9591a72d665404, 0xa994a0480c1ce23f,
+	 0x2c2c474e1333e061, 0x535c610286ef17bb, 0xb217d0687a925400, 0x4e20dd4bac4afa23,
+	 0x10655f73c63dc915, 0xcd5271f8aef4d2ff, 0xf21ff09d13f074e2, 0x19fa9c87cc06cb81,
+	 0xff34082e6c4c4207, 0x1eef5607f258d249, 0xfdc570612df4c312, 0x289be7f6fce0a962,
+	 0x4395522106f538db, 0x7f3317d4c95f8f2e, 0x539a1c07d9486c0d, 0x2bdb07601859c12c,
+	 0xbdb3d46f5086f210, 0x3797e01445d3f64b, 0x58656c6238cb7215, 0x22e07e13fc3c2816,
+	 0xc581db8172421019, 0xc920b2bb84bb8479, 0xd4cc7015304a5ff6, 0x90c1c59f526e0864,
+	 0x53be106da97e0b28, 0x3d2051f210b57af5, 0xd463d1140ba906e9, 0x0334ad6b92d97e34,
+	 0xcd3fb7d9a6e3e8dd, 0xd20cbdbae35cb823, 0x0c4617c9e5b2a4ce, 0x1467c5d8b7125699,
+	 0x823e84be3e682511, 0x12e23304f62d8d00, 0x95d907547ac2bd62, 0x268198fb0a8fb481,
+	 0x3206ae5a39103bf7, 0x0baffb4d5f80999f, 0xb8f27317dc727cdb, 0xa2378a82db8a0f32,
+	 0xa4b9521fed981db0, 0x16d7ac44115327fd, 0x6f6a68018065ae7a, 0x1cb4fe786d42be5c,
+	 0xa13445b347f7961c, 0xddbd6b4f07f878c6, 0xb9c22d8400fdd7bc, 0x041ce65120c284fc,
+	 0x476461fdf3320e41, 0xeef84176326710f2, 0x89646ae87801fff9, 0x145fde89fc7ee492,
+	 0x0d3419b33dfa5c49, 0xcedd0d05da47398a, 0x036dc60fa0e673c1, 0x764513a260ca9bae,
+	 0x0519e26200107198, 0x41ae49e2b3e0c1c1, 0x12d142c7e8288f5c, 0xaafb1f39429bf4bc,
+	 0x5a06b447c49846e1, 0xd5f43e8bc73f818c, 0xc0eb8be28dce3d5b, 0x5acb37ecc90b7a90,
+	 0x1b961ccaf48f5f12, 0x2aefdb294e1df335, 0xb87aa0ea324bea9f, 0x4fc5f01030b391f3,
+	 0x9ffd828ecb538589, 0x54459d0985a551dc, 0x57fd6bb9b296ad98, 0x2cd0d40ea086e90c,
+	 0xd9f31fe07f3fb21c, 0xd0ea73d0cea82d10, 0x534a709c8ac1cdac, 0x9ad852a19ba80477,
+	 0x4842fd8af3634af2, 0x4e989cbf5d5e67a8, 0x7c96fd6d8d1ed3f0, 0x76d7448f33396356,
+	 0xef7bb0c460d7054b, 0x48ea16b8e82b757f, 0x3a3e02f4269eb488, 0x18de92836f35f8c6,
+	 0x9acf0b83781545c6, 0x0c57a917ff8606c6, 0x4c2d2ce5cfef5a75, 0x0f5f59393230f567,
+	 0x18da02bfaee6f6ec, 0xe604ab57660067da, 0xc88e940d7633e677, 0xab9170f4eb6b5b2f,
+	 0x0b27ecb009ced439, 0xe12f08b12e42e382, 0x4619a312273f3588, 0x30e194b1001b3cbe,
+	 0xba3c7bd8e40f0cc9, 0x45ac00f1b2912fb1, 0x8689e9e06d1a6d8b, 0x293f7893743f83d2,
+	 0xc85c775527b9570d, 0xb9f10f8d6af396ce, 0x7a2ebc16b054c88c, 0x4024b0ab2fe393f6,
+	 0x38f41555ed0204b3, 0xf3dcdfe21915721d, 0x46f96af55f4cdfa6, 0x7ab9264f1aab3ba8,
+	 0x174abe211f4b8df1, 0xf20e43415082d328, 0x7416d95cab7815a4, 0x0e1cd06446649f55,
+	 0xf5e772ad7b23ad53, 0x19a65e75430d1b01, 0x1767c6781418cc29, 0x44b65e712f153a46,
+	 0x578a408e08467093, 0xa38ccf2a67fbcf33, 0xe95f235593ec1380, 0xb25a90758c0244f6,
+	 0x1adf97c9dc8b250c, 0x3553427db5800c53, 0xdd8dd7bd220af1b7, 0xaa0cd4b9c7e46f8d,
+	 0x39ae95b10985e856, 0x480f74b6ce976b36, 0x0a9c0961463cc2dc, 0x7b5a77c2341469f4,
+	 0x11697d586e8bae42, 0xe72aff46a4fe34e1, 0x8f07049a14db3d71, 0x3d0b06066a44bf8b,
+	 0xacd2749be084efda, 0x35d3497e123c1be6, 0x184a28ce017617aa, 0x2fe78948a9042a86,
+	 0x71d25b5d8f02eca6, 0x5eb90d68ade8bab1, 0x223307f619c53d50, 0x50b3425a5ef63216,
+	 0xfd2f43d72424d2b5, 0x6184164fa6b27b9e, 0x3ca2b40f6a1f9e41, 0x7f6c86ea518b1801,
+	 0x9de3c2f02b1361c0, 0x733bea33c5148a50, 0x650a6037f37d0903, 0x3a27e54fd91983a5,
+	 0xf40ba07eabb54104, 0x499701a54840b9bb, 0xea6cf49976659ce2, 0x865915597e036202,
+	 0xf4df6c87a20e220f, 0xe905c07d246ab0ab, 0x125cbbf5353b8468, 0x99860250c8884287,
+	 0x074043e2a73a4ada, 0xda54a8895a519a4b, 0x463213503d6b826d, 0x9cc578c0a797f6b2,
+	 0xf1013186aeab7c9f, 0x3c16d7395491c558, 0xb46ff42c1d656d7b, 0x25d40ea6d653e547,
+	 0xce1308a5fd2d6c5b, 0x77453c9177183df4, 0x1f728101317abf5f, 0x988cdc9f5dd16ab0,
+	 0x967a08d32986d0a1, 0x63efaf88cff6dcb9, 0xf4f75c4d6a5c0926, 0x8f1f2d1203414f7c,
+	 0x0b6e721dbb415cde, 0x74230c55f7eeb2e9, 0xefa69c28d5331487, 0x309b67e26de1138d,
+	 0xf46ba07477a4af1a, 0xd6d0bad13c721337, 0x3b255aeac2f44577, 0x4b8c96b37fa2ef72,
+	 0x8ff8ba062111ed85, 0xa1246f9205c5d957, 0x8f8b7b443b6a3f30, 0x7e280d47f097483d,
+	 0xbc44d1047d813776, 0xd43a2942d7c5bb56, 0xeb894036b1e0a8b9, 0x6f8dbcbb5ba92eb8,
+	 0x874c61c11aa57698, 0xcd7891d7aba6d81f, 0xc4317403be70f1a2, 0x35cebb6d42917377,
+	 0xfa3039e507defbad, 0xce487dd6f135cd54, 0x249104c1d729265e, 0x461b5c78f80754c5
+	},
+	{
+	 0x9b52b947eb73955e, 0x842eec5c1097ceae, 0x17005b5adbc0db24, 0x490ed7230c16b1f2,
+	 0x2d11d316e90477af, 0x74dc9985335deafb, 0x7fd3643817f25a4e, 0x39f17239301d1e1c,
+	 0xb411324d5a52ce65, 0x52ba09769cfc596e, 0xe5c262e8242fa624, 0x7338227b0adde5ae,
+	 0xda60527a4c87b000, 0x79bc6c452edf347c, 0xf4f9f0b244a519ab, 0xa0cc2a238057af51,
+	 0x75b09a13c1c3bcf2, 0x8123046bc20a4afe, 0x0df131fad823304a, 0x1b1a954b55f7fadb,
+	 0xc88ffbfe70b93bf4, 0x85bf1c0ef60b5c1d, 0x6ff38936ae6d8900, 0x8a14f5b73641efcd,
+	 0x6bec44e71595d6ff, 0x38bb62ac3113bc51, 0x31a655cbc9f977af, 0x35720a2c5495ebde,
+	 0x77296352caa620f0, 0x12dacec86d16ed6e, 0x075ee0d94e8c8b31, 0x88cf23c3249e6c4c,
+	 0x1107b2cb6d6b9bfe, 0xa3b65b4e9cdad6b4, 0xf4c668ccc6bf75e9, 0x75a3b3841fd27b3a,
+	 0x633851f80df9757c, 0x5815a52a8be75b17, 0x3cac3003e1d1ebf0, 0x1df82a0eb5c44cab,
+	 0xe4d855a0673fb338, 0x3837759164ebab91, 0x1c1fc32e3ca0e2e4, 0x734ef534f5ed42c7,
+	 0xc3cc48552e376a5a, 0x8c9f3bd759db6135, 0xcdb1747b6f57b30b, 0xb0c347e8468c25f5,
+	 0xd5b618b0ef820577, 0xde144d0d24f75657, 0x9742989039ca12ab, 0x5541e30043dbf215,
+	 0x3f065707a66c4d59, 0xab08aa0652c168db, 0xc722e12740c43490, 0x3d290ecdc2be5cb3,
+	 0x08fd0aac37808f92, 0x811ac9878345874d, 0xb91986aefa9f5b34, 0x244e88baae736068,
+	 0xfbd02d081fb89608, 0x58a1807447cef37e, 0xe34d32b6e4ec262d, 0x67c4266ffb20d21a,
+	 0x19d6065a4a120783, 0xfd67c42c741e99cc, 0x2acc7d62a495eeaf, 0x74bb45f2b22aa0ad,
+	 0x3e43442acfae7780, 0xd6a62c341cd0e970, 0xd5c3e54025ebd4c9, 0x60221970e5a62509,
+	 0xbf525413fc3e7554, 0x439307c3d0270054, 0xd8ffad938403cc0e, 0x3e38bbedc0c48a85,
+	 0x4b7421de01856153, 0x508908ccf1fc5fa2, 0x181e3f4fdbd4cf32, 0x611e1fca74ad09ac,
+	 0xd09233231e9b5652, 0x6f6fab136d8068cd, 0xbc5ddb195a05af55, 0xa7eeaebfa354e310,
+	 0x91974d650068fae6, 0x89d499eec412a6b2, 0x39f8aa8fbc9e2372, 0x5363e8b30a6becf3,
+	 0x140b6c6e631ab939, 0x5fb95cb5c1accecc, 0x91cbec36951a793f, 0x54b842500c78bb19,
+	 0x1b934bc65d619b2f, 0x661018c163aa4988, 0xab9b29a4ce1d5180, 0x049a7f9f15a6f8de,
+	 0xce464ebbd7b44c0f, 0xd27ffd0838cb5e2d, 0x371df94ae100a364, 0x1249f0a7ae4a59a9,
+	 0x56d206361286472d, 0xab6a62b296caa0dd, 0x9a18a2c87c1e8c4b, 0x5295e4694813647c,
+	 0xfd37745230ae3386, 0x7d8d02fd0b37145e, 0xc5c53370039639c9, 0x94e287651b5b8608,
+	 0x28511adba8cb5458, 0xcc24afcf81dbcf00, 0x95f90aaec14435a6, 0x1c5f735408518a95,
+	 0x0863a866f884ef98, 0x2ea9811d4bf18d02, 0x4bcdfdd56f102cbd, 0x5c653cbf2fe42482,
+	 0x945279f1db2307a0, 0x064e7c597f659751, 0x006f6b1c2bede554, 0x0bac652c6e734d24,
+	 0x16c9acb6050c274c, 0x4b954f1246b77952, 0x14187eee1dbc1db7, 0x9f837d7eb95b6b8c,
+	 0xba11fe905cdd6892, 0x189924984fdb890c, 0x1c1e1668490e5d5b, 0x297566e31f95a5fd,
+	 0x56c12ab2cf852383, 0xf291e84b0e0316b9, 0x7c2e03984d2132ba, 0x5e1e664b1e5ad47a,
+	 0x63d4c7b134aedd85, 0x749ad038e65af0fd, 0xa56e72d9f47387ac, 0x64254129d95bf903,
+	 0x391d3218f4b28f0d, 0x6f76d3780f4878f5, 0xd1fd9dbaf8e8cbce, 0x3746311950bd83be,
+	 0x88a9e47387bcf610, 0x4632f924fb2de3e9, 0x629f97054a1a92de, 0x7763a3b38872680c,
+	 0x880fefb3e1e3b8c9, 0x243596ab362cbabb, 0xf1691aeb5b3eea79, 0x88677d8ed73de94f,
+	 0x8c6916c601bccd4f, 0x20dbafa990f85c7a, 0xaf72602e7f729242, 0x32d0ad078fd3cb1c,
+	 0xa9fd60d65d7ac140, 0x5fe0eb2de247141a, 0x98edd881876a2b66, 0x5465ef97e7f92bb8,
+	 0xd238ab229a30746a, 0x4d99f9f594b61a51, 0x1907ea0a5324e97c, 0x9c645c65c11214d1,
+	 0x9489ec431b41a1c2, 0xe75fbaa48fd9afe1, 0xc12bc1d489a9b89c, 0x95d0a1065ba679e7,
+	 0xfbced1c5c4b7d7f7, 0x8caf2b54c8cf4679, 0x871a78c3d1b70410, 0x211606d6650a5055,
+	 0xdab39c2cf368e632, 0xa704d19d1cc41c3f, 0x02f28554497ce5bd, 0x2d5be4564863d1db,
+	 0xa4ceb20db6b04044, 0x317b2bc3fcf969be, 0x2c9bfa9d0aec3c8c, 0x5f8b667d9fb33c94,
+	 0x3e660475dc833b3c, 0x687900d81117f365, 0xe480b1c153bfed65, 0x0886c6a96fc3a0eb,
+	 0x0c9f2a55d440d9e7, 0x027a7184b920af6a, 0x45c441d7e9f2d06b, 0xb33933b5396f64f5,
+	 0x822694c5371f8527, 0xef0e53cfb48b0c1d, 0xb9557842a0129cff, 0x855296b7fb7db34d,
+	 0x85da66712cf1947a, 0x3a14b6c4fe85335b, 0xa29630a631fbb1a3, 0x8f891090a9256e36,
+	 0x25c22c639c482ce7, 0xf48da7ad2905f56c, 0x8fd10b84d602f3c7, 0x6148f64f3794c36d,
+	 0x258ba4904e180438, 0x5b5469bfe895394b, 0x8eaad44b58bae63c, 0x4aa3ca2e28066c10,
+	 0x4a899b7b39288a92, 0x725f926264d95d1d, 0xacf1d2c977b38dfd, 0xb59cdf44473b803e,
+	 0xbdf49a8060ad488b, 0x3b6a435e3a01be60, 0x2a345e2d3a267ad8, 0x07e78d72f63fdd6e,
+	 0xa1c7a5b3addeaa02, 0x20b0807d30108440, 0x89f8d80cde280251, 0x1a9de9f291075af0,
+	 0xf9f94f33f11a3043, 0x58147b69951b3e80, 0x93e62f89b15c555e, 0x070d370f35aa1857,
+	 0x5a1d9618f4a8e5b9, 0x2f874b293a8c7f76, 0x51e0f0d587a61576, 0x83802582f602939e,
+	 0x7697ee4db0149406, 0xe1c3e53b6ec12b8c, 0x8e3887bb6216435c, 0x4652280a0610c9ca,
+	 0xfdfa1f59687bd52d, 0xc2b5ab345175c6fc, 0x6e5f240feb155d8d, 0x0361de28a08f57cd,
+	 0xe3a5864f114a3af5, 0x3c2d3469509cd57a, 0x9634b1389fc90cf8, 0x07c0a548f681dbff,
+	 0xe24b171f962ca78f, 0xe3f8d91cb715b0cf, 0xeb16ece509ffa52e, 0x0d6b3595565a8d43,
+	 0x35bf0f18b4f0feb2, 0xa5aa5c9785fbf4b7, 0x85522b34aa1d8f42, 0xa11f0b3db043d60c,
+	 0x1b324101401f982b, 0x9edab95878947baa, 0xa49125787e5de63b, 0x656086262d4e07e5,
+	 0x1c3bd8273b6bcedc, 0x2c9e6618734bcfa0, 0x45ea971ef3c74ade, 0x3214adc5dc63e791,
+	 0xbc3c3d176acd654a, 0x9916055143376a95, 0xcbff8c148542e319, 0x2123927347d503b2,
+	 0x3017ae86475bd4e2, 0xa49a62fca184f98e, 0x9f034ee66d530d45, 0x7309c052fb7d1344
+	},
+	{
+	 0x96dba8a261b3a87d, 0x9bd9dbd9c1cd1912, 0x3c026df1a3ad48ed, 0x9871a8688c77246e,
+	 0xb71eee4eea01f432, 0x202e0edb979f5c7d, 0x7fc0416b3fab0220, 0x84b920ba2898e139,
+	 0x29d5f634f0e75e66, 0xa36db396834b8e68, 0xcdad7e1180016c79, 0x9d13adda64d43a90,
+	 0x4f8aeb2fe8677d26, 0xe247a7ff4742d3b0, 0x5107ae840a65f932, 0x7a72f932686df05d,
+	 0xfab72ffbbe163a90, 0xe4f984417cc842f2, 0xd7924983bf93e774, 0x08e85393e7af748a,
+	 0x7319b1b39358a9e5, 0x9e0b2e304b7246f7, 0x8f2066f76901c3ce, 0x89d4a1311ed830a1,
+	 0xd842e296137f3b4f, 0x6c115a6498c1313b, 0x0874830126a1ba64, 0x5d7100f9ff7ecd2f,
+	 0xe484adcd51acbec1, 0x23273a42ba9351d0, 0x09d93b587e8f6dae, 0x6a664579c0cddf1b,
+	 0x12890ff2444d70f6, 0xc41f1866a6861320, 0xdd30590c893372b1, 0x2b08a650ac1b4465,
+	 0x859603cc04796b17, 0xc43a55d04c39f529, 0x4c01b5fd57a27629, 0x5ee3f7d99f6cf5e7,
+	 0x86dd4e9d6b1318e6, 0xd470ccc775e302a2, 0xe10376ca4c36b00a, 0x75b1906a40f52baf,
+	 0xfda83bd1223168cd, 0x30909342c6757b7f, 0x6a70770f1c50973b, 0x03871c6730c3cea1,
+	 0x8b92c0de9c08e62f, 0xee84963e76933d49, 0x0470d6f58ab86672, 0xa76e28d9849e5fe0,
+	 0x302ff237ddce2906, 0x3b108496c7774496, 0x4533065fed2ab8e4, 0x963584260d93385f,
+	 0x12d08be0b0e7fcdf, 0xb80f535650546fc1, 0xf58acbfe12815a47, 0x61e48a13c5fdf9a1,
+	 0x4c8cb14f1e4a5e2c, 0x16d298a9f983783f, 0x39b0d5416a3a3ec1, 0x98f41e77afad7290,
+	 0x719b5d1ccd41b40a, 0xcf2d57adf83048fb, 0x56b548b0bb1f54c3, 0x952bd36c9bbc7776,
+	 0xab1489d7e35f372c, 0x7fb22fd6599e104f, 0xf0eaea00e3047381, 0xb396a5b1bd7a7ed1,
+	 0xd7fadeac648567e9, 0xef8ec3901b8e376e, 0xe258735b85a07baf, 0x98a4cb497e3b5f04,
+	 0x3bb3897a855850e4, 0xe27d4d7c77ec66ca, 0xa1fbd87757bcbf1a, 0x2a1780d97eb1fb46,
+	 0x16b4c9be0f411b39, 0x6429308f192520c1, 0xe74e767b4b8b9bf4, 0x3085be882e017a74,
+	 0x1cf8b8477df15c26, 0x525b3ef823efe349, 0x5b12a9615d11eb16, 0x1f6c760a95c5e308,
+	 0x7c69d8c6525bae93, 0xd7884d44de74e203, 0x968ee479baf3bb41, 0x82c53c4e8d521516,
+	 0xfe7824bc91d01c30, 0x6c0f25d5fde122c3, 0x0f790f028b62b5d9, 0x72e8df9dbada10b9,
+	 0xa1843f2fc6d156d9, 0x94987f71f5f6c83f, 0xa196ee157c552bc9, 0x0776a96f4a05334b,
+	 0x844745e3e42bddd3, 0x5528babc4179a9e1, 0xd0ceb9641c31c14e, 0x2134efed23681026,
+	 0x1e6c3f7ee15535cd, 0xd9850fe1c305395a, 0x8eab182f7578fd01, 0x341ccd8f6bd5679e,
+	 0x1f6bc86f9a1d4275, 0xc256345e045f61a9, 0xe3ed4f18484d4069, 0x673fa62a480194db,
+	 0xb047b98919d02bc9, 0x84b86ed777e6be37, 0x6a1acfea1b52e8cb, 0xa29e6849a6fd2694,
+	 0x19c1841fb41e52f7, 0x29b5717b6d14a6bd, 0xb746023c21f2b0ec, 0x0e9603434aa76e3f,
+	 0x6da9509c95310be6, 0x477834833ea90475, 0x2869bd659e1d1226, 0x365b0e0fec6cabac,
+	 0x779bb230eb5e6865, 0x56863d3d009593b2, 0x55d9e5941e24ca81, 0x8db445a3cc9ec055,
+	 0x3befa38c31f6b568, 0xb83f49acd63f2dde, 0xf4c99f6600763467, 0x167aabbf138c07b2,
+	 0x48b561990a003a93, 0x990b868c4b2ed66c, 0x6b82c1201ec6d227, 0x3e3be8a7e2f00ff2,
+	 0xe2ebf6284bad4508, 0xa8659f7556497609, 0xbc58b6ac53a27656, 0x4608d017fe520e13,
+	 0x55633cea0d2cc37f, 0xea02f67524b6e4a5, 0x3505c86aa468bd97, 0x3693ca4017a07c7b,
+	 0x36fd22a8100062b6, 0xbb4d8758afba839b, 0xb0382703de7e98af, 0x9e7e56ab3853bdaf,
+	 0x1740549eeb2e16e8, 0x938ee34fc0303cd3, 0xdd28e46f99368b0f, 0x9e59918ead3b1b7c,
+	 0xf570848614b02365, 0x8c4dec463f69289f, 0xf535db6ea4789787, 0x5aa1038208a8e18a,
+	 0xdf5a13cfac3dc088, 0xa8538032212d5f44, 0x6a0e66eb8c10ced4, 0x45b6a1a496ebd2d9,
+	 0x2dae10005e70f427, 0xbe59d79506c9cce9, 0x4cd6ea988165ee6c, 0x520a9c4507701bce,
+	 0xd18a1246d1a50015, 0x265764469c6d8016, 0x77236c8106dc6eb0, 0x0fda7d69aa4ddd67,
+	 0x9d03bd4856bf8942, 0x48dbbee048648849, 0xc9c57e56df19863d, 0x55c3cc9666b64caf,
+	 0x0bb62cbfda1bd906, 0x872f69c35148b7c3, 0x5fe3ecbb7266625c, 0x88ee1716e14ad73c,
+	 0x2fc174dd224cca2d, 0x5d2ab69303d7737b, 0x29142b29ca5809c0, 0x4731e0bcb64bfcfc,
+	 0x8e4076cf132751cc, 0x697b81109c047072, 0x2664008a160412f7, 0x5f5105bc0ec824d1,
+	 0x36557e8d3b74d36f, 0x99cf1a67c6425894, 0x8c79f6f18932b21a, 0x76fabfe60af51572,
+	 0xeb5003e0ef5867d9, 0x55437c1907b494f7, 0x946d871f3466bf0a, 0x4db6c4643388d68d,
+	 0x23851bea58582cc4, 0x46ec2b178e30e8e5, 0x6e7cb001f9f554b2, 0x35cce1cc2007b6b3,
+	 0xf17c9d65d4a43d1b, 0x035e0682032d8cee, 0xa9495e5175952339, 0xa6b87cc6590458e4,
+	 0x7a1a2355121c01d7, 0x87fbd33868bfc6c9, 0x6c362178544a19f6, 0x13b74f1bf746f6cb,
+	 0xe9421f3c8a9e161c, 0xbbb15fe47af848be, 0x1fc5f10e5dd5f4e8, 0x8a95a2b4e609bec8,
+	 0x94a8061d5ab40732, 0x4655bbaecf5d0d18, 0x69e9097f38029ee1, 0x04c6d26c9ed2cb3d,
+	 0xb27858dcce61146a, 0x7c79aa0e239a6f1a, 0x3924339e0221730f, 0x6c255d004a90d7fe,
+	 0xcd86b2d221ba3b1f, 0x04d6d766a88ae24a, 0x616a549238258177, 0x2ef0e3ee0103fc9d,
+	 0xab6ac9db3e2b633a, 0x329db6908d4d2823, 0x5fe13dafccf6fe82, 0x608729b586a4432a,
+	 0x3c78e3f2a79a03d7, 0xfa3371da5ec244cc, 0x66040c1590149d22, 0x59974c3bb327c594,
+	 0xdeeff645b91d0681, 0xdf52f017b475c818, 0xebda37fe1e34f201, 0x8f6c156b69d9cfce,
+	 0x51465f41eedbe592, 0xdefc7326999e4e56, 0xe8d30c6015d5d278, 0x2a8527d072253aa8,
+	 0xc5244ac2c38633e8, 0xbafdf7def5330bec, 0x61125da76e823747, 0x2a8b4c39fd211c9d,
+	 0x2027a50aa6ae2ff3, 0x98f106a879aa4bf0, 0x0e9fd9541f0dfd7f, 0x3178bc1849af6dd9,
+	 0x306ee1359c0418d0, 0x6899056eb5279cc3, 0xd51ce1eed571076b, 0xa0397ba0e96ccf39,
+	 0xd9022bc544e2a825, 0x3b5aba656d0b1620, 0xec6ebc59f796f238, 0x719012f159d08b94,
+	 0xd4da2f559b195e00, 0x6f34ded30687a05f, 0xb597f4b42d64fc76, 0xb5e032942096384f
+	}
+};
@@ -145,6 +145,7 @@ int tlcp_do_connect(TLS_CONNECT *conn)
 	const uint8_t *exts;
 	size_t exts_len;
 
+	X509_CERT_VIEW view;
 	SM2_KEY server_sign_key;
 	SM2_KEY server_enc_key;
 	SM2_VERIFY_CTX verify_ctx;
@@ -171,7 +172,6 @@ int tlcp_do_connect(TLS_CONNECT *conn)
 
 	int depth = 5;
 	int alert = 0;
-	int verify_result;
 
 
 	// 初始化记录缓冲
@@ -256,11 +256,11 @@ int tlcp_do_connect(TLS_CONNECT *conn)
 	sm3_update(&sm3_ctx, record + 5, recordlen - 5);
 
 	// verify ServerCertificate
-	if (conn->ca_certs_len) {
+	if (tls_has_ca_certificates(conn)) {
 		// 只有提供了CA证书才验证服务器证书链
 		// FIXME: 逻辑需要再检查
-		if (x509_certs_verify_tlcp(conn->server_certs, conn->server_certs_len, X509_cert_chain_server,
-			conn->ca_certs, conn->ca_certs_len, depth, &verify_result) != 1) {
+		if (tls_certs_verify(conn, conn->server_certs, conn->server_certs_len,
+			X509_cert_chain_server, depth) != 1) {
 			error_print();
 			tls_send_alert(conn, TLS_alert_bad_certificate);
 			goto end;
@@ -285,9 +285,11 @@ int tlcp_do_connect(TLS_CONNECT *conn)
 
 	// verify ServerKeyExchange
 	if (x509_certs_get_cert_by_index(conn->server_certs, conn->server_certs_len, 0, &cp, &len) != 1
-		|| x509_cert_get_subject_public_key(cp, len, &server_sign_key) != 1
+		|| x509_cert_view_init(&view, cp, len) != 1
+		|| x509_cert_view_get_subject_public_key(&view, &server_sign_key) != 1
 		|| x509_certs_get_cert_by_index(conn->server_certs, conn->server_certs_len, 1, &server_enc_cert, &server_enc_cert_len) != 1
-		|| x509_cert_get_subject_public_key(server_enc_cert, server_enc_cert_len, &server_enc_key) != 1) {
+		|| x509_cert_view_init(&view, server_enc_cert, server_enc_cert_len) != 1
+		|| x509_cert_view_get_subject_public_key(&view, &server_enc_key) != 1) {
 		error_print();
 		tls_send_alert(conn, TLS_alert_bad_certificate);
 		goto end;
@@ -557,7 +559,7 @@ int tlcp_do_connect(TLS_CONNECT *conn)
 		goto end;
 	}
 
-	if (!conn->quiet)
+	if (!conn->quiet && gmssl_error_stderr_enabled())
 		fprintf(stderr, "Connection established!\n");
 
 
@@ -604,11 +606,11 @@ int tlcp_do_accept(TLS_CONNECT *conn)
 	size_t siglen;
 
 	// ClientCertificate, CertificateVerify
+	X509_CERT_VIEW view;
 	SM2_KEY client_sign_key;
 	SM2_VERIFY_CTX verify_ctx;
 	const uint8_t *sig;
 	const int verify_depth = 5;
-	int verify_result;
 
 	// ClientKeyExchange
 	const uint8_t *enced_pms;
@@ -630,7 +632,7 @@ int tlcp_do_accept(TLS_CONNECT *conn)
 
 
 	// 服务器端如果设置了CA
-	if (conn->ca_certs_len)
+	if (tls_has_ca_certificates(conn))
 		client_verify = 1;
 
 	// 初始化Finished和客户端验证环境
@@ -756,7 +758,7 @@ int tlcp_do_accept(TLS_CONNECT *conn)
 		}
 		if (tls_record_set_handshake_certificate_request(record, &recordlen,
 			cert_types, sizeof(cert_types),
-			ca_names, ca_names_len) != 1) {
+			ca_names_len ? ca_names : NULL, ca_names_len) != 1) {
 			error_print();
 			goto end;
 		}
@@ -779,7 +781,7 @@ int tlcp_do_accept(TLS_CONNECT *conn)
 	sm3_update(&sm3_ctx, record + 5, recordlen - 5);
 
 	// recv ClientCertificate
-	if (conn->ca_certs_len) {
+	if (client_verify) {
 		tls_trace("recv ClientCertificate\n");
 		if (tls_record_recv(record, &recordlen, conn->sock) != 1
 			|| tls_record_protocol(record) != TLS_protocol_tlcp) {
@@ -793,8 +795,8 @@ int tlcp_do_accept(TLS_CONNECT *conn)
 			tls_send_alert(conn, TLS_alert_unexpected_message);
 			goto end;
 		}
-		if (x509_certs_verify(conn->client_certs, conn->client_certs_len, X509_cert_chain_client,
-			conn->ca_certs, conn->ca_certs_len, verify_depth, &verify_result) != 1) {
+		if (tls_certs_verify(conn, conn->client_certs, conn->client_certs_len,
+			X509_cert_chain_client, verify_depth) != 1) {
 			error_print();
 			tls_send_alert(conn, TLS_alert_bad_certificate);
 			goto end;
@@ -848,7 +850,8 @@ int tlcp_do_accept(TLS_CONNECT *conn)
 			goto end;
 		}
 		if (x509_certs_get_cert_by_index(conn->client_certs, conn->client_certs_len, 0, &cp, &len) != 1
-			|| x509_cert_get_subject_public_key(cp, len, &client_sign_key) != 1) {
+			|| x509_cert_view_init(&view, cp, len) != 1
+			|| x509_cert_view_get_subject_public_key(&view, &client_sign_key) != 1) {
 			error_print();
 			tls_send_alert(conn, TLS_alert_bad_certificate);
 			goto end;
@@ -997,7 +1000,7 @@ int tlcp_do_accept(TLS_CONNECT *conn)
 
 	conn->protocol = TLS_protocol_tlcp;
 
-	if (!conn->quiet)
+	if (!conn->quiet && gmssl_error_stderr_enabled())
 		fprintf(stderr, "Connection Established!\n\n");
 
 	ret = 1;
@@ -281,7 +281,7 @@ int tls_cbc_encrypt(const SM3_HMAC_CTX *inited_hmac_ctx, const SM4_KEY *enc_key,
 		return -1;
 	}
 	if (inlen > (1 << 14)) {
-		error_print_msg("invalid tls record data length %zu\n", inlen);
+		error_print_code(GMSSL_ERR_DECODE);
 		return -1;
 	}
 	if ((((size_t)header[3]) << 8) + header[4] != inlen) {
@@ -341,7 +341,7 @@ int tls_cbc_decrypt(const SM3_HMAC_CTX *inited_hmac_ctx, const SM4_KEY *dec_key,
 	if (inlen % 16
 		|| inlen < (16 + 0 + 32 + 16) // iv + data +  mac + padding
 		|| inlen > (16 + (1<<14) + 32 + 256)) {
-		error_print_msg("invalid tls cbc ciphertext length %zu\n", inlen);
+		error_print_code(GMSSL_ERR_DECODE);
 		return -1;
 	}
 
@@ -354,12 +354,12 @@ int tls_cbc_decrypt(const SM3_HMAC_CTX *inited_hmac_ctx, const SM4_KEY *dec_key,
 	padding_len = out[inlen - 1];
 	padding = out + inlen - padding_len - 1;
 	if (padding < out + 32) {
-		error_print();
+		error_print_code(GMSSL_ERR_VERIFY);
 		return -1;
 	}
 	for (i = 0; i < padding_len; i++) {
 		if (padding[i] != padding_len) {
-			error_puts("tls ciphertext cbc-padding check failure");
+			error_print_code(GMSSL_ERR_VERIFY);
 			return -1;
 		}
 	}
@@ -379,7 +379,7 @@ int tls_cbc_decrypt(const SM3_HMAC_CTX *inited_hmac_ctx, const SM4_KEY *dec_key,
 	sm3_hmac_update(&hmac_ctx, out, *outlen);
 	sm3_hmac_finish(&hmac_ctx, hmac);
 	if (gmssl_secure_memcmp(mac, hmac, sizeof(hmac)) != 0) {
-		error_puts("tls ciphertext mac check failure\n");
+		error_print_code(GMSSL_ERR_VERIFY);
 		return -1;
 	}
 	return 1;
@@ -2133,6 +2133,44 @@ int tls_ctx_set_ca_certificates(TLS_CTX *ctx, const char *cacertsfile, int depth
 	return 1;
 }
 
+int tls_ctx_set_trust_store(TLS_CTX *ctx, const X509_TRUST_STORE *store, int depth)
+{
+	if (!ctx || !store) {
+		error_print();
+		return -1;
+	}
+	if (depth < 0 || depth > TLS_MAX_VERIFY_DEPTH) {
+		error_print();
+		return -1;
+	}
+	if (!tls_protocol_name(ctx->protocol)) {
+		error_print();
+		return -1;
+	}
+	if (ctx->trust_store) {
+		error_print();
+		return -1;
+	}
+	ctx->trust_store = store;
+	ctx->verify_depth = depth;
+	return 1;
+}
+
+int tls_ctx_set_verify_cache(TLS_CTX *ctx, X509_VERIFY_CACHE *cache)
+{
+	if (!ctx || !cache) {
+		error_print();
+		return -1;
+	}
+	// the cache is only consulted by the trust store verification
+	if (!ctx->trust_store) {
+		error_print();
+		return -1;
+	}
+	ctx->verify_cache = cache;
+	return 1;
+}
+
 int tls_ctx_set_certificate_and_key(TLS_CTX *ctx, const char *chainfile,
 	const char *keyfile, const char *keypass)
 {
@@ -2143,6 +2181,7 @@ int tls_ctx_set_certificate_and_key(TLS_CTX *ctx, const char *chainfile,
 	SM2_KEY key;
 	const uint8_t *cert;
 	size_t certlen;
+	X509_CERT_VIEW view;
 	SM2_KEY public_key;
 
 	if (!ctx || !chainfile || !keyfile || !keypass) {
@@ -2171,7 +2210,8 @@ int tls_ctx_set_certificate_and_key(TLS_CTX *ctx, const char *chainfile,
 		goto end;
 	}
 	if (x509_certs_get_cert_by_index(certs, certslen, 0, &cert, &certlen) != 1
-		|| x509_cert_get_subject_public_key(cert, certlen, &public_key) != 1) {
+		|| x509_cert_view_init(&view, cert, certlen) != 1
+		|| x509_cert_view_get_subject_public_key(&view, &public_key) != 1) {
 		error_print();
 		return -1;
 	}
@@ -2206,6 +2246,7 @@ int tls_ctx_set_tlcp_server_certificate_and_keys(TLS_CTX *ctx, const char *chain
 
 	const uint8_t *cert;
 	size_t certlen;
+	X509_CERT_VIEW view;
 	SM2_KEY public_key;
 
 	if (!ctx || !chainfile || !signkeyfile || !signkeypass || !kenckeyfile || !kenckeypass) {
@@ -2235,7 +2276,8 @@ int tls_ctx_set_tlcp_server_certificate_and_keys(TLS_CTX *ctx, const char *chain
 		goto end;
 	}
 	if (x509_certs_get_cert_by_index(certs, certslen, 0, &cert, &certlen) != 1
-		|| x509_cert_get_subject_public_key(cert, certlen, &public_key) != 1
+		|| x509_cert_view_init(&view, cert, certlen) != 1
+		|| x509_cert_view_get_subject_public_key(&view, &public_key) != 1
 		|| sm2_public_key_equ(&signkey, &public_key) != 1) {
 		error_print();
 		goto end;
@@ -2250,7 +2292,8 @@ int tls_ctx_set_tlcp_server_certificate_and_keys(TLS_CTX *ctx, const char *chain
 		goto end;
 	}
 	if (x509_certs_get_cert_by_index(certs, certslen, 1, &cert, &certlen) != 1
-		|| x509_cert_get_subject_public_key(cert, certlen, &public_key) != 1
+		|| x509_cert_view_init(&view, cert, certlen) != 1
+		|| x509_cert_view_get_subject_public_key(&view, &public_key) != 1
 		|| sm2_public_key_equ(&kenckey, &public_key) != 1) {
 		error_print();
 		goto end;
@@ -2303,6 +2346,8 @@ int tls_init(TLS_CONNECT *conn, const TLS_CTX *ctx)
 	}
 	memcpy(conn->ca_certs, ctx->cacerts, ctx->cacertslen);
 	conn->ca_certs_len = ctx->cacertslen;
+	conn->trust_store = ctx->trust_store;
+	conn->verify_cache = ctx->verify_cache;
 
 	conn->sign_key = ctx->signkey;
 	conn->kenc_key = ctx->kenckey;
@@ -2317,6 +2362,47 @@ void tls_cleanup(TLS_CONNECT *conn)
 	gmssl_secure_clear(conn, sizeof(TLS_CONNECT));
 }
 
+int tls_has_ca_certificates(const TLS_CONNECT *conn)
+{
+	return (conn->ca_certs_len || conn->trust_store) ? 1 : 0;
+}
+
+// the shared trust store is used when set, the ca_certs are searched linearly
+int tls_certs_verify(const TLS_CONNECT *conn, const uint8_t *certs, size_t certslen, int certs_type, int depth)
+{
+	int verify_result;
+	int ret;
+
+	if (conn->protocol == TLS_protocol_tlcp && certs_type == X509_cert_chain_server) {
+		if (conn->trust_store && conn->verify_cache) {
+			ret = x509_certs_verify_tlcp_by_trust_store_cached(certs, certslen, certs_type,
+				conn->trust_store, depth, conn->verify_cache, &verify_result);
+		} else if (conn->trust_store) {
+			ret = x509_certs_verify_tlcp_by_trust_store(certs, certslen, certs_type,
+				conn->trust_store, depth, &verify_result);
+		} else {
+			ret = x509_certs_verify_tlcp(certs, certslen, certs_type,
+				conn->ca_certs, conn->ca_certs_len, depth, &verify_result);
+		}
+	} else {
+		if (conn->trust_store && conn->verify_cache) {
+			ret = x509_certs_verify_by_trust_store_cached(certs, certslen, certs_type,
+				conn->trust_store, depth, conn->verify_cache, &verify_result);
+		} else if (conn->trust_store) {
+			ret = x509_certs_verify_by_trust_store(certs, certslen, certs_type,
+				conn->trust_store, depth, &verify_result);
+		} else {
+			ret = x509_certs_verify(certs, certslen, certs_type,
+				conn->ca_certs, conn->ca_certs_len, depth, &verify_result);
+		}
+	}
+	if (ret != 1) {
+		error_print();
+		return -1;
+	}
+	return 1;
+}
+
 int tls_set_socket(TLS_CONNECT *conn, tls_socket_t sock)
 {
 	int flags = 0;
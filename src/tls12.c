@@ -202,6 +202,7 @@ int tls12_do_connect(TLS_CONNECT *conn)
 	int signature_algor = -1;
 
 
+	X509_CERT_VIEW view;
 	SM2_KEY server_sign_key;
 	SM2_SIGN_CTX sign_ctx;
 	const uint8_t *sig;
@@ -221,7 +222,6 @@ int tls12_do_connect(TLS_CONNECT *conn)
 
 	int depth = 5;
 	int alert = 0;
-	int verify_result;
 
 
 	// 初始化记录缓冲
@@ -340,8 +340,8 @@ int tls12_do_connect(TLS_CONNECT *conn)
 		sm2_sign_update(&sign_ctx, record + 5, recordlen - 5);
 
 	// verify ServerCertificate
-	if (x509_certs_verify(conn->server_certs, conn->server_certs_len, X509_cert_chain_server,
-		conn->ca_certs, conn->ca_certs_len, depth, &verify_result) != 1) {
+	if (tls_certs_verify(conn, conn->server_certs, conn->server_certs_len,
+		X509_cert_chain_server, depth) != 1) {
 		error_print();
 		tls_send_alert(conn, TLS_alert_bad_certificate);
 		goto end;
@@ -375,7 +375,8 @@ int tls12_do_connect(TLS_CONNECT *conn)
 
 	// verify ServerKeyExchange
 	if (x509_certs_get_cert_by_index(conn->server_certs, conn->server_certs_len, 0, &cp, &len) != 1
-		|| x509_cert_get_subject_public_key(cp, len, &server_sign_key) != 1) {
+		|| x509_cert_view_init(&view, cp, len) != 1
+		|| x509_cert_view_get_subject_public_key(&view, &server_sign_key) != 1) {
 		error_print();
 		tls_send_alert(conn, TLS_alert_bad_certificate);
 		goto end;
@@ -637,7 +638,7 @@ int tls12_do_connect(TLS_CONNECT *conn)
 		goto end;
 	}
 
-	if (!conn->quiet)
+	if (!conn->quiet && gmssl_error_stderr_enabled())
 		fprintf(stderr, "Connection established!\n");
 
 	conn->protocol = conn->protocol;
@@ -687,10 +688,10 @@ int tls12_do_accept(TLS_CONNECT *conn)
 
 	// ClientCertificate, CertificateVerify
 	TLS_CLIENT_VERIFY_CTX client_verify_ctx;
+	X509_CERT_VIEW view;
 	SM2_KEY client_sign_key;
 	const uint8_t *sig;
 	const int verify_depth = 5;
-	int verify_result;
 
 	// ClientKeyExchange
 	SM2_Z256_POINT client_ecdhe_point;
@@ -709,7 +710,7 @@ int tls12_do_accept(TLS_CONNECT *conn)
 
 
 	// 服务器端如果设置了CA
-	if (conn->ca_certs_len)
+	if (tls_has_ca_certificates(conn))
 		client_verify = 1;
 
 	// 初始化Finished和客户端验证环境
@@ -843,7 +844,7 @@ int tls12_do_accept(TLS_CONNECT *conn)
 		}
 		if (tls_record_set_handshake_certificate_request(record, &recordlen,
 			cert_types, sizeof(cert_types),
-			ca_names, ca_names_len) != 1) {
+			ca_names_len ? ca_names : NULL, ca_names_len) != 1) {
 			error_print();
 			goto end;
 		}
@@ -869,7 +870,7 @@ int tls12_do_accept(TLS_CONNECT *conn)
 		tls_client_verify_update(&client_verify_ctx, record + 5, recordlen - 5);
 
 	// recv ClientCertificate
-	if (conn->ca_certs_len) {
+	if (client_verify) {
 		tls_trace("recv ClientCertificate\n");
 		if (tls_record_recv(record, &recordlen, conn->sock) != 1
 			|| tls_record_protocol(record) != conn->protocol) { // protocol检查应该在trace之后
@@ -883,8 +884,8 @@ int tls12_do_accept(TLS_CONNECT *conn)
 			tls_send_alert(conn, TLS_alert_unexpected_message);
 			goto end;
 		}
-		if (x509_certs_verify(conn->client_certs, conn->client_certs_len, X509_cert_chain_client,
-			conn->ca_certs, conn->ca_certs_len, verify_depth, &verify_result) != 1) {
+		if (tls_certs_verify(conn, conn->client_certs, conn->client_certs_len,
+			X509_cert_chain_client, verify_depth) != 1) {
 			error_print();
 			tls_send_alert(conn, TLS_alert_bad_certificate);
 			goto end;
@@ -928,7 +929,8 @@ int tls12_do_accept(TLS_CONNECT *conn)
 			goto end;
 		}
 		if (x509_certs_get_cert_by_index(conn->client_certs, conn->client_certs_len, 0, &cp, &len) != 1
-			|| x509_cert_get_subject_public_key(cp, len, &client_sign_key) != 1) {
+			|| x509_cert_view_init(&view, cp, len) != 1
+			|| x509_cert_view_get_subject_public_key(&view, &client_sign_key) != 1) {
 			error_print();
 			tls_send_alert(conn, TLS_alert_bad_certificate);
 			goto end;
@@ -1071,7 +1073,7 @@ int tls12_do_accept(TLS_CONNECT *conn)
 
 	conn->protocol = conn->protocol;
 
-	if (!conn->quiet)
+	if (!conn->quiet && gmssl_error_stderr_enabled())
 		fprintf(stderr, "Connection Established!\n\n");
 
 	ret = 1;
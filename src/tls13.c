@@ -1497,6 +1497,7 @@ int tls13_do_connect(TLS_CONNECT *conn)
 
 	SM2_KEY client_ecdhe;
 	SM2_Z256_POINT server_ecdhe_public;
+	X509_CERT_VIEW view;
 	SM2_KEY server_sign_key;
 
 	const DIGEST *digest = DIGEST_sm3();
@@ -1724,7 +1725,8 @@ int tls13_do_connect(TLS_CONNECT *conn)
 		goto end;
 	}
 	if (x509_certs_get_cert_by_index(conn->server_certs, conn->server_certs_len, 0, &cert, &certlen) != 1
-		|| x509_cert_get_subject_public_key(cert, certlen, &server_sign_key) != 1) {
+		|| x509_cert_view_init(&view, cert, certlen) != 1
+		|| x509_cert_view_get_subject_public_key(&view, &server_sign_key) != 1) {
 		error_print();
 		tls_send_alert(conn, TLS_alert_unexpected_message);
 		goto end;
@@ -1733,9 +1735,8 @@ int tls13_do_connect(TLS_CONNECT *conn)
 	tls_seq_num_incr(conn->server_seq_num);
 
 	// verify ServerCertificate
-	int verify_result = 0; // TODO: maybe remove this arg from x509_certs_verify()
-	if (x509_certs_verify(conn->server_certs, conn->server_certs_len, X509_cert_chain_server,
-		conn->ca_certs, conn->ca_certs_len, X509_MAX_VERIFY_DEPTH, &verify_result) != 1) {
+	if (tls_certs_verify(conn, conn->server_certs, conn->server_certs_len,
+		X509_cert_chain_server, X509_MAX_VERIFY_DEPTH) != 1) {
 		error_print();
 		tls_send_alert(conn, TLS_alert_bad_certificate);
 		goto end;
@@ -1927,7 +1928,7 @@ int tls13_do_connect(TLS_CONNECT *conn)
 	format_print(stderr, 0, 0, "\n");
 	*/
 
-	if (!conn->quiet)
+	if (!conn->quiet && gmssl_error_stderr_enabled())
 		fprintf(stderr, "Connection established\n");
 
 	ret = 1;
@@ -1975,6 +1976,7 @@ int tls13_do_accept(TLS_CONNECT *conn)
 
 	SM2_KEY server_ecdhe;
 	SM2_Z256_POINT client_ecdhe_public;
+	X509_CERT_VIEW view;
 	SM2_KEY client_sign_key;
 	const BLOCK_CIPHER *cipher = NULL;
 	const DIGEST *digest = NULL;
@@ -2014,7 +2016,7 @@ int tls13_do_accept(TLS_CONNECT *conn)
 
 
 	int client_verify = 0;
-	if (conn->ca_certs_len)
+	if (tls_has_ca_certificates(conn))
 		client_verify = 1;
 
 
@@ -2283,7 +2285,8 @@ int tls13_do_accept(TLS_CONNECT *conn)
 			tls_send_alert(conn, TLS_alert_unexpected_message);
 			goto end;
 		}
-		if (x509_cert_get_subject_public_key(cert, certlen, &client_sign_key) != 1) {
+		if (x509_cert_view_init(&view, cert, certlen) != 1
+			|| x509_cert_view_get_subject_public_key(&view, &client_sign_key) != 1) {
 			error_print();
 			tls_send_alert(conn, TLS_alert_unexpected_message);
 			goto end;
@@ -2292,9 +2295,8 @@ int tls13_do_accept(TLS_CONNECT *conn)
 		tls_seq_num_incr(conn->client_seq_num);
 
 		// verify client Certificate
-		int verify_result;
-		if (x509_certs_verify(conn->client_certs, conn->client_certs_len, X509_cert_chain_client,
-			conn->ca_certs, conn->ca_certs_len, X509_MAX_VERIFY_DEPTH, &verify_result) != 1) {
+		if (tls_certs_verify(conn, conn->client_certs, conn->client_certs_len,
+			X509_cert_chain_client, X509_MAX_VERIFY_DEPTH) != 1) {
 			error_print();
 			tls_send_alert(conn, TLS_alert_bad_certificate);
 			goto end;
@@ -2399,7 +2401,7 @@ int tls13_do_accept(TLS_CONNECT *conn)
 	format_print(stderr, 0, 0, "\n");
 	*/
 
-	if (!conn->quiet)
+	if (!conn->quiet && gmssl_error_stderr_enabled())
 		fprintf(stderr, "Connection Established!\n\n");
 
 	ret = 1;
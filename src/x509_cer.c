@@ -1169,6 +1169,107 @@ int x509_cert_sign_to_der(
 	return 1;
 }
 
+int x509_tbs_cert_to_writer(
+	int version,
+	const uint8_t *serial, size_t serial_len,
+	int signature_algor,
+	const uint8_t *issuer, size_t issuer_len,
+	time_t not_before, time_t not_after,
+	const uint8_t *subject, size_t subject_len,
+	const SM2_KEY *subject_public_key,
+	const uint8_t *issuer_unique_id, size_t issuer_unique_id_len,
+	const uint8_t *subject_unique_id, size_t subject_unique_id_len,
+	const uint8_t *exts, size_t exts_len,
+	ASN1_WRITER *w)
+{
+	size_t tbs_pos;
+	size_t len = 0;
+
+	if (x509_explicit_version_to_der(0, version, NULL, &len) < 0
+		|| asn1_integer_to_der(serial, serial_len, NULL, &len) != 1
+		|| x509_signature_algor_to_der(signature_algor, NULL, &len) != 1
+		|| asn1_sequence_to_der(issuer, issuer_len, NULL, &len) != 1
+		|| x509_validity_to_der(not_before, not_after, NULL, &len) != 1
+		|| asn1_sequence_to_der(subject, subject_len, NULL, &len) != 1
+		|| x509_public_key_info_to_der(subject_public_key, NULL, &len) != 1
+		|| asn1_implicit_bit_octets_to_der(1, issuer_unique_id, issuer_unique_id_len, NULL, &len) < 0
+		|| asn1_implicit_bit_octets_to_der(2, subject_unique_id, subject_unique_id_len, NULL, &len) < 0
+		|| x509_explicit_exts_to_der(3, exts, exts_len, NULL, &len) < 0) {
+		error_print();
+		return -1;
+	}
+	if (asn1_writer_begin(w, ASN1_TAG_SEQUENCE, &tbs_pos) != 1
+		|| asn1_writer_reserve(w, len) != 1
+		|| x509_explicit_version_to_der(0, version, &w->p, &w->len) < 0
+		|| asn1_integer_to_der(serial, serial_len, &w->p, &w->len) != 1
+		|| x509_signature_algor_to_der(signature_algor, &w->p, &w->len) != 1
+		|| asn1_sequence_to_der(issuer, issuer_len, &w->p, &w->len) != 1
+		|| x509_validity_to_der(not_before, not_after, &w->p, &w->len) != 1
+		|| asn1_sequence_to_der(subject, subject_len, &w->p, &w->len) != 1
+		|| x509_public_key_info_to_der(subject_public_key, &w->p, &w->len) != 1
+		|| asn1_implicit_bit_octets_to_der(1, issuer_unique_id, issuer_unique_id_len, &w->p, &w->len) < 0
+		|| asn1_implicit_bit_octets_to_der(2, subject_unique_id, subject_unique_id_len, &w->p, &w->len) < 0
+		|| x509_explicit_exts_to_der(3, exts, exts_len, &w->p, &w->len) < 0
+		|| asn1_writer_end(w, tbs_pos) != 1) {
+		error_print();
+		return -1;
+	}
+	return 1;
+}
+
+int x509_cert_sign_to_writer(
+	int version,
+	const uint8_t *serial, size_t serial_len,
+	int signature_algor,
+	const uint8_t *issuer, size_t issuer_len,
+	time_t not_before, time_t not_after,
+	const uint8_t *subject, size_t subject_len,
+	const SM2_KEY *subject_public_key,
+	const uint8_t *issuer_unique_id, size_t issuer_unique_id_len,
+	const uint8_t *subject_unique_id, size_t subject_unique_id_len,
+	const uint8_t *exts, size_t exts_len,
+	const SM2_KEY *sign_key, const char *signer_id, size_t signer_id_len,
+	ASN1_WRITER *w)
+{
+	int sig_alg = OID_sm2sign_with_sm3;
+	uint8_t sig[SM2_MAX_SIGNATURE_SIZE];
+	size_t siglen = SM2_signature_typical_size;
+	size_t cert_pos, tbs_offset;
+	size_t len = 0;
+	SM2_SIGN_CTX sign_ctx;
+
+	if (asn1_writer_begin(w, ASN1_TAG_SEQUENCE, &cert_pos) != 1) {
+		error_print();
+		return -1;
+	}
+	tbs_offset = w->len;
+	if (x509_tbs_cert_to_writer(version, serial, serial_len, signature_algor,
+		issuer, issuer_len, not_before, not_after, subject, subject_len,
+		subject_public_key, issuer_unique_id, issuer_unique_id_len,
+		subject_unique_id, subject_unique_id_len, exts, exts_len, w) != 1) {
+		error_print();
+		return -1;
+	}
+	if (sm2_sign_init(&sign_ctx, sign_key, signer_id, signer_id_len) != 1
+		|| sm2_sign_update(&sign_ctx, w->buf + tbs_offset, w->len - tbs_offset) != 1
+		|| sm2_sign_finish_fixlen(&sign_ctx, siglen, sig) != 1) {
+		gmssl_secure_clear(&sign_ctx, sizeof(sign_ctx));
+		error_print();
+		return -1;
+	}
+	gmssl_secure_clear(&sign_ctx, sizeof(sign_ctx));
+	if (x509_signature_algor_to_der(sig_alg, NULL, &len) != 1
+		|| asn1_bit_octets_to_der(sig, siglen, NULL, &len) != 1
+		|| asn1_writer_reserve(w, len) != 1
+		|| x509_signature_algor_to_der(sig_alg, &w->p, &w->len) != 1
+		|| asn1_bit_octets_to_der(sig, siglen, &w->p, &w->len) != 1
+		|| asn1_writer_end(w, cert_pos) != 1) {
+		error_print();
+		return -1;
+	}
+	return 1;
+}
+
 int x509_signed_from_der(const uint8_t **tbs, size_t *tbslen,
 	int *sig_alg, const uint8_t **sig, size_t *siglen,
 	const uint8_t **in, size_t *inlen)
@@ -1244,18 +1345,15 @@ int x509_cert_verify_by_ca_cert(const uint8_t *a, size_t alen,
 	const uint8_t *cacert, size_t cacertlen,
 	const char *signer_id, size_t signer_id_len)
 {
-	const uint8_t *issuer;
-	size_t issuer_len;
-	const uint8_t *subject;
-	size_t subject_len;
+	X509_CERT_VIEW view;
+	X509_CERT_VIEW ca;
 
-	if (x509_cert_get_issuer(a, alen, &issuer, &issuer_len) != 1
-		|| x509_cert_get_subject(cacert, cacertlen, &subject, &subject_len) != 1
-		|| x509_name_equ(issuer, issuer_len, subject, subject_len) != 1) {
+	if (x509_cert_view_init(&view, a, alen) != 1
+		|| x509_cert_view_init(&ca, cacert, cacertlen) != 1) {
 		error_print();
 		return -1;
 	}
-	if (x509_signed_verify_by_ca_cert(a, alen, cacert, cacertlen, signer_id, signer_id_len) != 1) {
+	if (x509_cert_view_verify_by_ca_view(&view, &ca, signer_id, signer_id_len) != 1) {
 		error_print();
 		return -1;
 	}
@@ -1380,6 +1478,131 @@ int x509_cert_print(FILE *fp, int fmt, int ind, const char *label, const uint8_t
 	return 1;
 }
 
+int x509_cert_view_init(X509_CERT_VIEW *view, const uint8_t *cert, size_t certlen)
+{
+	const uint8_t *tbs;
+	size_t tbslen;
+	const uint8_t *d;
+	size_t dlen;
+
+	memset(view, 0, sizeof(*view));
+	view->cert = cert;
+	view->cert_len = certlen;
+
+	if (x509_signed_from_der(&view->tbs, &view->tbs_len, &view->signature_algor,
+			&view->signature, &view->signature_len, &cert, &certlen) != 1
+		|| asn1_length_is_zero(certlen) != 1) {
+		error_print();
+		return -1;
+	}
+
+	tbs = view->tbs;
+	tbslen = view->tbs_len;
+	if (asn1_sequence_from_der(&d, &dlen, &tbs, &tbslen) != 1
+		|| asn1_length_is_zero(tbslen) != 1) {
+		error_print();
+		return -1;
+	}
+	if (x509_explicit_version_from_der(0, &view->version, &d, &dlen) < 0
+		|| asn1_integer_from_der(&view->serial_number, &view->serial_number_len, &d, &dlen) != 1
+		|| x509_signature_algor_from_der(&view->inner_signature_algor, &d, &dlen) != 1
+		|| asn1_sequence_from_der(&view->issuer, &view->issuer_len, &d, &dlen) != 1
+		|| asn1_any_from_der(&view->validity, &view->validity_len, &d, &dlen) != 1
+		|| asn1_sequence_from_der(&view->subject, &view->subject_len, &d, &dlen) != 1
+		|| asn1_any_from_der(&view->subject_public_key_info, &view->subject_public_key_info_len, &d, &dlen) != 1
+		|| asn1_implicit_bit_octets_from_der(1, &view->issuer_unique_id, &view->issuer_unique_id_len, &d, &dlen) < 0
+		|| asn1_implicit_bit_octets_from_der(2, &view->subject_unique_id, &view->subject_unique_id_len, &d, &dlen) < 0
+		|| x509_explicit_exts_from_der(3, &view->exts, &view->exts_len, &d, &dlen) < 0
+		|| asn1_length_is_zero(dlen) != 1) {
+		error_print();
+		return -1;
+	}
+	if (view->validity[0] != ASN1_TAG_SEQUENCE
+		|| view->subject_public_key_info[0] != ASN1_TAG_SEQUENCE) {
+		error_print();
+		return -1;
+	}
+	return 1;
+}
+
+int x509_cert_view_from_der(X509_CERT_VIEW *view, const uint8_t **in, size_t *inlen)
+{
+	int ret;
+	const uint8_t *cert;
+	size_t certlen;
+
+	if ((ret = asn1_any_from_der(&cert, &certlen, in, inlen)) != 1) {
+		if (ret < 0) error_print();
+		return ret;
+	}
+	if (x509_cert_view_init(view, cert, certlen) != 1) {
+		error_print();
+		return -1;
+	}
+	return 1;
+}
+
+int x509_cert_view_get_validity(const X509_CERT_VIEW *view, time_t *not_before, time_t *not_after)
+{
+	const uint8_t *p = view->validity;
+	size_t len = view->validity_len;
+
+	if (x509_validity_from_der(not_before, not_after, &p, &len) != 1
+		|| asn1_length_is_zero(len) != 1) {
+		error_print();
+		return -1;
+	}
+	return 1;
+}
+
+int x509_cert_view_get_subject_public_key(const X509_CERT_VIEW *view, SM2_KEY *public_key)
+{
+	const uint8_t *p = view->subject_public_key_info;
+	size_t len = view->subject_public_key_info_len;
+
+	if (x509_public_key_info_from_der(public_key, &p, &len) != 1
+		|| asn1_length_is_zero(len) != 1) {
+		error_print();
+		return -1;
+	}
+	return 1;
+}
+
+int x509_cert_view_verify(const X509_CERT_VIEW *view, const SM2_KEY *public_key,
+	const char *signer_id, size_t signer_id_len)
+{
+	SM2_VERIFY_CTX verify_ctx;
+
+	if (view->signature_algor != OID_sm2sign_with_sm3) {
+		error_print();
+		return -1;
+	}
+	if (sm2_verify_init(&verify_ctx, public_key, signer_id, signer_id_len) != 1
+		|| sm2_verify_update(&verify_ctx, view->tbs, view->tbs_len) != 1
+		|| sm2_verify_finish(&verify_ctx, view->signature, view->signature_len) != 1) {
+		error_print();
+		return -1;
+	}
+	return 1;
+}
+
+int x509_cert_view_verify_by_ca_view(const X509_CERT_VIEW *view, const X509_CERT_VIEW *ca,
+	const char *signer_id, size_t signer_id_len)
+{
+	SM2_KEY public_key;
+
+	if (x509_name_equ(view->issuer, view->issuer_len, ca->subject, ca->subject_len) != 1) {
+		error_print();
+		return -1;
+	}
+	if (x509_cert_view_get_subject_public_key(ca, &public_key) != 1
+		|| x509_cert_view_verify(view, &public_key, signer_id, signer_id_len) != 1) {
+		error_print();
+		return -1;
+	}
+	return 1;
+}
+
 int x509_cert_get_details(const uint8_t *a, size_t alen,
 	int *version,
 	const uint8_t **serial_number, size_t *serial_number_len,
@@ -1394,65 +1617,46 @@ int x509_cert_get_details(const uint8_t *a, size_t alen,
 	int *signature_algor,
 	const uint8_t **signature, size_t *signature_len)
 {
-	const uint8_t *tbs_a;
-	size_t tbs_alen;
-	int sig_alg;
-	const uint8_t *sig;
-	size_t sig_len;
-
-	struct {
-		int version;
-		const uint8_t *serial; size_t serial_len;
-		int sig_alg;
-		const uint8_t *issuer; size_t issuer_len;
-		time_t not_before; time_t not_after;
-		const uint8_t *subject; size_t subject_len;
-		SM2_KEY subject_public_key;
-		const uint8_t *issuer_unique_id; size_t issuer_unique_id_len;
-		const uint8_t *subject_unique_id; size_t subject_unique_id_len;
-		const uint8_t *exts; size_t exts_len;
-	} tbs;
-
-	if (x509_signed_from_der(&tbs_a, &tbs_alen, &sig_alg, &sig, &sig_len, &a, &alen) != 1
-		|| asn1_length_is_zero(alen) != 1) {
+	X509_CERT_VIEW view;
+	time_t validity[2];
+
+	if (x509_cert_view_init(&view, a, alen) != 1) {
 		error_print();
 		return -1;
 	}
-	if (x509_tbs_cert_from_der(
-		&tbs.version,
-		&tbs.serial, &tbs.serial_len,
-		&tbs.sig_alg,
-		&tbs.issuer, &tbs.issuer_len,
-		&tbs.not_before, &tbs.not_after,
-		&tbs.subject, &tbs.subject_len,
-		&tbs.subject_public_key,
-		&tbs.issuer_unique_id, &tbs.issuer_unique_id_len,
-		&tbs.subject_unique_id, &tbs.subject_unique_id_len,
-		&tbs.exts, &tbs.exts_len, &tbs_a, &tbs_alen) != 1) {
-		error_print();
-		return -1;
-	}
-
-	if (version) *version = tbs.version;
-	if (serial_number) *serial_number = tbs.serial;
-	if (serial_number_len) *serial_number_len = tbs.serial_len;
-	if (inner_signature_algor) *inner_signature_algor = tbs.sig_alg;
-	if (issuer) *issuer = tbs.issuer;
-	if (issuer_len) *issuer_len = tbs.issuer_len;
-	if (not_before) *not_before = tbs.not_before;
-	if (not_after) *not_after = tbs.not_after;
-	if (subject) *subject = tbs.subject;
-	if (subject_len) *subject_len = tbs.subject_len;
-	if (subject_public_key) *subject_public_key = tbs.subject_public_key;
-	if (issuer_unique_id) *issuer_unique_id = tbs.issuer_unique_id;
-	if (issuer_unique_id_len) *issuer_unique_id_len = tbs.issuer_unique_id_len;
-	if (subject_unique_id) *subject_unique_id = tbs.subject_unique_id;
-	if (subject_unique_id_len) *subject_unique_id_len = tbs.subject_unique_id_len;
-	if (extensions) *extensions = tbs.exts;
-	if (extensions_len) *extensions_len = tbs.exts_len;
-	if (signature_algor) *signature_algor = sig_alg;
-	if (signature) *signature = sig;
-	if (signature_len) *signature_len = sig_len;
+	// validity and public key are only decoded when asked for
+	if (not_before || not_after) {
+		if (x509_cert_view_get_validity(&view, &validity[0], &validity[1]) != 1) {
+			error_print();
+			return -1;
+		}
+	}
+	if (subject_public_key) {
+		if (x509_cert_view_get_subject_public_key(&view, subject_public_key) != 1) {
+			error_print();
+			return -1;
+		}
+	}
+
+	if (version) *version = view.version;
+	if (serial_number) *serial_number = view.serial_number;
+	if (serial_number_len) *serial_number_len = view.serial_number_len;
+	if (inner_signature_algor) *inner_signature_algor = view.inner_signature_algor;
+	if (issuer) *issuer = view.issuer;
+	if (issuer_len) *issuer_len = view.issuer_len;
+	if (not_before) *not_before = validity[0];
+	if (not_after) *not_after = validity[1];
+	if (subject) *subject = view.subject;
+	if (subject_len) *subject_len = view.subject_len;
+	if (issuer_unique_id) *issuer_unique_id = view.issuer_unique_id;
+	if (issuer_unique_id_len) *issuer_unique_id_len = view.issuer_unique_id_len;
+	if (subject_unique_id) *subject_unique_id = view.subject_unique_id;
+	if (subject_unique_id_len) *subject_unique_id_len = view.subject_unique_id_len;
+	if (extensions) *extensions = view.exts;
+	if (extensions_len) *extensions_len = view.exts_len;
+	if (signature_algor) *signature_algor = view.signature_algor;
+	if (signature) *signature = view.signature;
+	if (signature_len) *signature_len = view.signature_len;
 	return 1;
 }
 
@@ -1660,81 +1864,65 @@ int x509_certs_get_cert_by_subject(const uint8_t *d, size_t dlen,
 	return 0;
 }
 
-int x509_certs_get_cert_by_issuer_and_serial_number(const uint8_t *d, size_t dlen,
+int x509_certs_get_cert_view_by_issuer_and_serial_number(const uint8_t *d, size_t dlen,
 	const uint8_t *issuer, size_t issuer_len, const uint8_t *serial, size_t serial_len,
-	const uint8_t **cert, size_t *cert_len)
+	X509_CERT_VIEW *view)
 {
-	const uint8_t *cur_issuer;
-	size_t cur_issuer_len;
-	const uint8_t *cur_serial;
-	size_t cur_serial_len;
-
 	while (dlen) {
-		if (x509_cert_from_der(cert, cert_len, &d, &dlen) != 1
-			|| x509_cert_get_issuer_and_serial_number(*cert, *cert_len,
-				&cur_issuer, &cur_issuer_len, &cur_serial, &cur_serial_len) != 1) {
+		if (x509_cert_view_from_der(view, &d, &dlen) != 1) {
 			error_print();
 			return -1;
 		}
-		if (x509_name_equ(cur_issuer, cur_issuer_len, issuer, issuer_len) == 1
-			&& cur_serial_len == serial_len && memcmp(cur_serial, serial, serial_len) == 0) {
+		if (x509_name_equ(view->issuer, view->issuer_len, issuer, issuer_len) == 1
+			&& view->serial_number_len == serial_len
+			&& memcmp(view->serial_number, serial, serial_len) == 0) {
 			return 1;
 		}
 	}
-	*cert = NULL;
-	*cert_len = 0;
+	memset(view, 0, sizeof(*view));
 	return 0;
 }
 
-int x509_cert_check(const uint8_t *cert, size_t certlen, int cert_type,
-	int *path_len_constraint)
+int x509_certs_get_cert_by_issuer_and_serial_number(const uint8_t *d, size_t dlen,
+	const uint8_t *issuer, size_t issuer_len, const uint8_t *serial, size_t serial_len,
+	const uint8_t **cert, size_t *cert_len)
 {
-	int version;
-	const uint8_t *serial;
-	size_t serial_len;
-	int tbs_sig_algor;
-	const uint8_t *issuer;
-	size_t issuer_len;
-	time_t not_before;
-	time_t not_after;
-	time_t now;
-	const uint8_t *subject;
-	size_t subject_len;
-	const uint8_t *exts;
-	size_t extslen;
-	int sig_algor;
-
-
-	if (x509_cert_get_details(cert, certlen,
-		&version, // version
-		&serial, &serial_len, // serial
-		&tbs_sig_algor, // signature_algor
-		&issuer, &issuer_len, // issuer
-		&not_before, &not_after, // validity
-		&subject, &subject_len, // subject
-		NULL, // subject_public_key
-		NULL, NULL, // issuer_unique_id
-		NULL, NULL, // subject_unique_id
-		&exts, &extslen, // extensions
-		&sig_algor, // signature_algor
-		NULL, NULL // signature
-		) != 1) {
+	X509_CERT_VIEW view;
+	int ret;
+
+	if ((ret = x509_certs_get_cert_view_by_issuer_and_serial_number(d, dlen,
+		issuer, issuer_len, serial, serial_len, &view)) < 0) {
 		error_print();
 		return -1;
 	}
+	*cert = view.cert;
+	*cert_len = view.cert_len;
+	return ret;
+}
+
+int x509_cert_view_check(const X509_CERT_VIEW *view, int cert_type, int *path_len_constraint)
+{
+	time_t not_before;
+	time_t not_after;
+	time_t now;
+	SM2_KEY public_key;
 
-	if (version != X509_version_v3) {
+	if (view->version != X509_version_v3) {
 		error_print();
 		return -1;
 	}
-	if (!serial || !serial_len) {
+	if (!view->serial_number || !view->serial_number_len) {
 		error_print();
 		return -1;
 	}
-	if (serial_len < 4) {
+	if (view->serial_number_len < 4) {
 		error_print(); // not enough randomness
 	}
 
+	if (x509_cert_view_get_validity(view, &not_before, &not_after) != 1) {
+		error_print();
+		return -1;
+	}
 	time(&now);
 	if (x509_validity_check(not_before, not_after, now, X509_VALIDITY_MAX_SECONDS) != 1) {
 		error_print();
@@ -1742,37 +1930,60 @@ int x509_cert_check(const uint8_t *cert, size_t certlen, int cert_type,
 	}
 
 	// check issuer and subject not empty
-	if (x509_name_check(issuer, issuer_len) != 1) {
+	if (x509_name_check(view->issuer, view->issuer_len) != 1) {
 		error_print();
 		return -1;
 	}
-	if (x509_name_check(subject, subject_len) != 1) {
+	if (x509_name_check(view->subject, view->subject_len) != 1) {
 		error_print();
 		return -1;
 	}
 
-	if (x509_exts_check(exts, extslen, cert_type, path_len_constraint) != 1) {
+	// the view does not decode the key, a malformed or off-curve key is rejected here
+	if (x509_cert_view_get_subject_public_key(view, &public_key) != 1) {
 		error_print();
 		return -1;
 	}
-	if (tbs_sig_algor != sig_algor) {
+
+	if (x509_exts_check(view->exts, view->exts_len, cert_type, path_len_constraint) != 1) {
 		error_print();
 		return -1;
 	}
+	if (view->inner_signature_algor != view->signature_algor) {
+		error_print();
+		return -1;
+	}
+
+	return 1;
+}
+
+int x509_cert_check(const uint8_t *cert, size_t certlen, int cert_type,
+	int *path_len_constraint)
+{
+	X509_CERT_VIEW view;
 
+	if (x509_cert_view_init(&view, cert, certlen) != 1) {
+		error_print();
+		return -1;
+	}
+	if (x509_cert_view_check(&view, cert_type, path_len_constraint) != 1) {
+		error_print();
+		return -1;
+	}
 	return 1;
 }
 
+// every certificate of the chain is parsed once into a view
 int x509_certs_verify(const uint8_t *certs, size_t certslen, int certs_type,
 	const uint8_t *rootcerts, size_t rootcertslen, int depth, int *verify_result)
 {
 	int entity_cert_type;
-	const uint8_t *cert;
-	size_t certlen;
-	const uint8_t *cacert;
-	size_t cacertlen;
-	const uint8_t *name;
-	size_t namelen;
+	X509_CERT_VIEW views[2];
+	X509_CERT_VIEW *cert = &views[0];
+	X509_CERT_VIEW *cacert = &views[1];
+	X509_CERT_VIEW *tmp;
+	const uint8_t *rootcert;
+	size_t rootcertlen;
 
 	int path_len = 0;
 	int path_len_constraint;
@@ -1790,25 +2001,25 @@ int x509_certs_verify(const uint8_t *certs, size_t certslen, int certs_type,
 	}
 
 	// entity cert
-	if (x509_cert_from_der(&cert, &certlen, &certs, &certslen) != 1) {
+	if (x509_cert_view_from_der(cert, &certs, &certslen) != 1) {
 		error_print();
 		return -1;
 	}
-	if (x509_cert_check(cert, certlen, entity_cert_type, &path_len_constraint) != 1) {
+	if (x509_cert_view_check(cert, entity_cert_type, &path_len_constraint) != 1) {
 		error_print();
-		x509_cert_print(stderr, 0, 10, "Invalid Entity Certificate", cert, certlen);
+		x509_cert_print(stderr, 0, 10, "Invalid Entity Certificate", cert->cert, cert->cert_len);
 		return -1;
 	}
 
 	while (certslen) {
 
-		if (x509_cert_from_der(&cacert, &cacertlen, &certs, &certslen) != 1) {
+		if (x509_cert_view_from_der(cacert, &certs, &certslen) != 1) {
 			error_print();
 			return -1;
 		}
-		if (x509_cert_check(cacert, cacertlen, X509_cert_ca, &path_len_constraint) != 1) {
+		if (x509_cert_view_check(cacert, X509_cert_ca, &path_len_constraint) != 1) {
 			error_print();
-			x509_cert_print(stderr, 0, 10, "Invalid CA Certificate", cacert, cacertlen);
+			x509_cert_print(stderr, 0, 10, "Invalid CA Certificate", cacert->cert, cacert->cert_len);
 			return -1;
 		}
 
@@ -1824,28 +2035,29 @@ int x509_certs_verify(const uint8_t *certs, size_t certslen, int certs_type,
 			return -1;
 		}
 
-		if (x509_cert_verify_by_ca_cert(cert, certlen, cacert, cacertlen,
+		if (x509_cert_view_verify_by_ca_view(cert, cacert,
 			SM2_DEFAULT_ID, SM2_DEFAULT_ID_LENGTH) != 1) {
 			error_print();
 			return -1;
 		}
 
+		tmp = cert;
 		cert = cacert;
-		certlen = cacertlen;
+		cacert = tmp;
 		path_len++;
 	}
 
-	if (x509_cert_get_issuer(cert, certlen, &name, &namelen) != 1) {
+	if (x509_certs_get_cert_by_subject(rootcerts, rootcertslen, cert->issuer, cert->issuer_len,
+		&rootcert, &rootcertlen) != 1) {
 		error_print();
 		return -1;
 	}
-	if (x509_certs_get_cert_by_subject(rootcerts, rootcertslen, name, namelen,
-		&cacert, &cacertlen) != 1) {
+	if (x509_cert_view_init(cacert, rootcert, rootcertlen) != 1) {
 		error_print();
 		return -1;
 	}
 
-	if (x509_cert_check(cacert, cacertlen, X509_cert_ca, &path_len_constraint) != 1) {
+	if (x509_cert_view_check(cacert, X509_cert_ca, &path_len_constraint) != 1) {
 		error_print();
 		return -1;
 	}
@@ -1854,7 +2066,7 @@ int x509_certs_verify(const uint8_t *certs, size_t certslen, int certs_type,
 		error_print();
 		return -1;
 	}
-	if (x509_cert_verify_by_ca_cert(cert, certlen, cacert, cacertlen,
+	if (x509_cert_view_verify_by_ca_view(cert, cacert,
 		SM2_DEFAULT_ID, SM2_DEFAULT_ID_LENGTH) != 1) {
 		error_print();
 		return -1;
@@ -1868,14 +2080,13 @@ int x509_certs_verify_tlcp(const uint8_t *certs, size_t certslen, int certs_type
 {
 	int sign_cert_type;
 	int kenc_cert_type;
-	const uint8_t *cert;
-	size_t certlen;
-	const uint8_t *kenc_cert;
-	size_t kenc_certlen;
-	const uint8_t *cacert;
-	size_t cacertlen;
-	const uint8_t *name;
-	size_t namelen;
+	X509_CERT_VIEW views[2];
+	X509_CERT_VIEW kenc_cert;
+	X509_CERT_VIEW *cert = &views[0];
+	X509_CERT_VIEW *cacert = &views[1];
+	X509_CERT_VIEW *tmp;
+	const uint8_t *rootcert;
+	size_t rootcertlen;
 
 	int path_len = 0;
 	int path_len_constraint;
@@ -1894,32 +2105,32 @@ int x509_certs_verify_tlcp(const uint8_t *certs, size_t certslen, int certs_type
 		return -1;
 	}
 
-	if (x509_cert_from_der(&cert, &certlen, &certs, &certslen) != 1) {
+	if (x509_cert_view_from_der(cert, &certs, &certslen) != 1) {
 		error_print();
 		return -1;
 	}
-	if (x509_cert_check(cert, certlen, sign_cert_type, &path_len_constraint) != 1) {
+	if (x509_cert_view_check(cert, sign_cert_type, &path_len_constraint) != 1) {
 		error_print();
 		return -1;
 	}
 
 	// entity key encipherment cert
-	if (x509_cert_from_der(&kenc_cert, &kenc_certlen, &certs, &certslen) != 1) {
+	if (x509_cert_view_from_der(&kenc_cert, &certs, &certslen) != 1) {
 		error_print();
 		return -1;
 	}
-	if (x509_cert_check(kenc_cert, kenc_certlen, kenc_cert_type, &path_len_constraint) != 1) {
+	if (x509_cert_view_check(&kenc_cert, kenc_cert_type, &path_len_constraint) != 1) {
 		error_print();
 		return -1;
 	}
 
 	while (certslen) {
 
-		if (x509_cert_from_der(&cacert, &cacertlen, &certs, &certslen) != 1) {
+		if (x509_cert_view_from_der(cacert, &certs, &certslen) != 1) {
 			error_print();
 			return -1;
 		}
-		if (x509_cert_check(cacert, cacertlen, X509_cert_ca, &path_len_constraint) != 1) {
+		if (x509_cert_view_check(cacert, X509_cert_ca, &path_len_constraint) != 1) {
 			error_print();
 			return -1;
 		}
@@ -1931,7 +2142,7 @@ int x509_certs_verify_tlcp(const uint8_t *certs, size_t certslen, int certs_type
 			}
 
 			// verify entity key encipherment cert
-			if (x509_cert_verify_by_ca_cert(kenc_cert, kenc_certlen, cacert, cacertlen,
+			if (x509_cert_view_verify_by_ca_view(&kenc_cert, cacert,
 				SM2_DEFAULT_ID, SM2_DEFAULT_ID_LENGTH) != 1) {
 				error_print();
 				return -1;
@@ -1943,27 +2154,29 @@ int x509_certs_verify_tlcp(const uint8_t *certs, size_t certslen, int certs_type
 			return -1;
 		}
 
-		if (x509_cert_verify_by_ca_cert(cert, certlen, cacert, cacertlen,
+		if (x509_cert_view_verify_by_ca_view(cert, cacert,
 			SM2_DEFAULT_ID, SM2_DEFAULT_ID_LENGTH) != 1) {
 			error_print();
 			return -1;
 		}
 
+		tmp = cert;
 		cert = cacert;
-		certlen = cacertlen;
+		cacert = tmp;
 		path_len++;
 	}
 
 
-	if (x509_cert_get_issuer(cert, certlen, &name, &namelen) != 1) {
+	if (x509_certs_get_cert_by_subject(rootcerts, rootcertslen, cert->issuer, cert->issuer_len,
+		&rootcert, &rootcertlen) != 1) {
 		error_print();
 		return -1;
 	}
-	if (x509_certs_get_cert_by_subject(rootcerts, rootcertslen, name, namelen, &cacert, &cacertlen) != 1) {
+	if (x509_cert_view_init(cacert, rootcert, rootcertlen) != 1) {
 		error_print();
 		return -1;
 	}
-	if (x509_cert_check(cacert, cacertlen, X509_cert_ca, &path_len_constraint) != 1) {
+	if (x509_cert_view_check(cacert, X509_cert_ca, &path_len_constraint) != 1) {
 		error_print();
 		return -1;
 	}
@@ -1975,14 +2188,14 @@ int x509_certs_verify_tlcp(const uint8_t *certs, size_t certslen, int certs_type
 
 	// when no mid CA certs
 	if (path_len == 0) {
-		if (x509_cert_verify_by_ca_cert(kenc_cert, kenc_certlen, cacert, cacertlen,
+		if (x509_cert_view_verify_by_ca_view(&kenc_cert, cacert,
 			SM2_DEFAULT_ID, SM2_DEFAULT_ID_LENGTH) != 1) {
 			error_print();
 			return -1;
 		}
 	}
 
-	if (x509_cert_verify_by_ca_cert(cert, certlen, cacert, cacertlen,
+	if (x509_cert_view_verify_by_ca_view(cert, cacert,
 		SM2_DEFAULT_ID, SM2_DEFAULT_ID_LENGTH) != 1) {
 		error_print();
 		return -1;
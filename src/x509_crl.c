@@ -1472,6 +1472,74 @@ int x509_crl_sign_to_der(
 	return 1;
 }
 
+int x509_crl_sign_to_writer(
+	int version, int sig_alg,
+	const uint8_t *issuer, size_t issuer_len,
+	time_t this_update, time_t next_update,
+	const uint8_t *revoked_certs, size_t revoked_certs_len,
+	const uint8_t *crl_exts, size_t crl_exts_len,
+	const SM2_KEY *sign_key, const char *signer_id, size_t signer_id_len,
+	ASN1_WRITER *w)
+{
+	uint8_t sig[SM2_MAX_SIGNATURE_SIZE];
+	size_t siglen = SM2_signature_typical_size;
+	size_t crl_pos, tbs_pos, tbs_offset;
+	size_t len = 0;
+	SM2_SIGN_CTX sign_ctx;
+
+	if (sig_alg != OID_sm2sign_with_sm3) {
+		error_print();
+		return -1;
+	}
+	if (asn1_int_to_der(version, NULL, &len) < 0
+		|| x509_signature_algor_to_der(sig_alg, NULL, &len) != 1
+		|| x509_name_to_der(issuer, issuer_len, NULL, &len) != 1
+		|| x509_time_to_der(this_update, NULL, &len) != 1
+		|| x509_time_to_der(next_update, NULL, &len) < 0
+		|| asn1_sequence_to_der(revoked_certs, revoked_certs_len, NULL, &len) < 0
+		|| x509_explicit_exts_to_der(0, crl_exts, crl_exts_len, NULL, &len) < 0) {
+		error_print();
+		return -1;
+	}
+	if (asn1_writer_begin(w, ASN1_TAG_SEQUENCE, &crl_pos) != 1) {
+		error_print();
+		return -1;
+	}
+	tbs_offset = w->len;
+	if (asn1_writer_begin(w, ASN1_TAG_SEQUENCE, &tbs_pos) != 1
+		|| asn1_writer_reserve(w, len) != 1
+		|| asn1_int_to_der(version, &w->p, &w->len) < 0
+		|| x509_signature_algor_to_der(sig_alg, &w->p, &w->len) != 1
+		|| x509_name_to_der(issuer, issuer_len, &w->p, &w->len) != 1
+		|| x509_time_to_der(this_update, &w->p, &w->len) != 1
+		|| x509_time_to_der(next_update, &w->p, &w->len) < 0
+		|| asn1_sequence_to_der(revoked_certs, revoked_certs_len, &w->p, &w->len) < 0
+		|| x509_explicit_exts_to_der(0, crl_exts, crl_exts_len, &w->p, &w->len) < 0
+		|| asn1_writer_end(w, tbs_pos) != 1) {
+		error_print();
+		return -1;
+	}
+	if (sm2_sign_init(&sign_ctx, sign_key, signer_id, signer_id_len) != 1
+		|| sm2_sign_update(&sign_ctx, w->buf + tbs_offset, w->len - tbs_offset) != 1
+		|| sm2_sign_finish_fixlen(&sign_ctx, siglen, sig) != 1) {
+		gmssl_secure_clear(&sign_ctx, sizeof(sign_ctx));
+		error_print();
+		return -1;
+	}
+	gmssl_secure_clear(&sign_ctx, sizeof(sign_ctx));
+	len = 0;
+	if (x509_signature_algor_to_der(sig_alg, NULL, &len) != 1
+		|| asn1_bit_octets_to_der(sig, siglen, NULL, &len) != 1
+		|| asn1_writer_reserve(w, len) != 1
+		|| x509_signature_algor_to_der(sig_alg, &w->p, &w->len) != 1
+		|| asn1_bit_octets_to_der(sig, siglen, &w->p, &w->len) != 1
+		|| asn1_writer_end(w, crl_pos) != 1) {
+		error_print();
+		return -1;
+	}
+	return 1;
+}
+
 int x509_crl_from_der_ex(
 	int *version,
 	int *inner_sig_alg,
@@ -0,0 +1,580 @@
+/*
+ *  Copyright 2014-2024 The GmSSL Project. All Rights Reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the License); you may
+ *  not use this file except in compliance with the License.
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+#ifndef WIN32
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+#include <gmssl/asn1.h>
+#include <gmssl/sm3.h>
+#include <gmssl/x509_crl.h>
+#include <gmssl/file.h>
+#include <gmssl/mem.h>
+#include <gmssl/error.h>
+#ifdef ENABLE_PTHREAD
+#include <pthread.h>
+#endif
+
+
+static const uint8_t x509_crl_index_magic[8] = { 'G','M','C','R','L','I','D','X' };
+
+#define X509_CRL_INDEX_BYTE_ORDER	0x01020304
+#define X509_CRL_INDEX_BLOOM_HASHES	4
+#define X509_CRL_INDEX_BLOOM_MIN_SIZE	64
+
+// two 32-bit hashes of the serial, bloom bit i is h1 + i * h2
+static void x509_crl_index_bloom_hash(const uint8_t *serial, size_t serial_len,
+	uint32_t *h1, uint32_t *h2)
+{
+	uint64_t h = 0xcbf29ce484222325ULL;
+
+	while (serial_len--) {
+		h ^= *serial++;
+		h *= 0x100000001b3ULL;
+	}
+	*h1 = (uint32_t)h;
+	*h2 = (uint32_t)(h >> 32) | 1;
+}
+
+static void x509_crl_index_bloom_add(uint8_t *bloom, size_t bloom_size,
+	const uint8_t *serial, size_t serial_len)
+{
+	uint32_t mask = (uint32_t)(bloom_size * 8 - 1);
+	uint32_t h1, h2, bit;
+	int i;
+
+	x509_crl_index_bloom_hash(serial, serial_len, &h1, &h2);
+	for (i = 0; i < X509_CRL_INDEX_BLOOM_HASHES; i++) {
+		bit = (h1 + i * h2) & mask;
+		bloom[bit >> 3] |= 1 << (bit & 7);
+	}
+}
+
+static int x509_crl_index_bloom_test(const uint8_t *bloom, size_t bloom_size,
+	const uint8_t *serial, size_t serial_len)
+{
+	uint32_t mask = (uint32_t)(bloom_size * 8 - 1);
+	uint32_t h1, h2, bit;
+	int i;
+
+	x509_crl_index_bloom_hash(serial, serial_len, &h1, &h2);
+	for (i = 0; i < X509_CRL_INDEX_BLOOM_HASHES; i++) {
+		bit = (h1 + i * h2) & mask;
+		if (!(bloom[bit >> 3] & (1 << (bit & 7)))) {
+			return 0;
+		}
+	}
+	return 1;
+}
+
+static int x509_crl_index_entry_cmp(const void *a, const void *b)
+{
+	const X509_CRL_INDEX_ENTRY *x = (const X509_CRL_INDEX_ENTRY *)a;
+	const X509_CRL_INDEX_ENTRY *y = (const X509_CRL_INDEX_ENTRY *)b;
+	int r;
+
+	if ((r = memcmp(x->serial, y->serial, X509_CRL_INDEX_MAX_SERIAL_SIZE)) != 0) {
+		return r;
+	}
+	return (int)x->serial_len - (int)y->serial_len;
+}
+
+static int x509_crl_index_set_entry(X509_CRL_INDEX_ENTRY *entry,
+	const uint8_t *serial, size_t serial_len)
+{
+	if (!serial_len || serial_len > X509_CRL_INDEX_MAX_SERIAL_SIZE) {
+		error_print();
+		return -1;
+	}
+	memset(entry, 0, sizeof(*entry));
+	memcpy(entry->serial + X509_CRL_INDEX_MAX_SERIAL_SIZE - serial_len, serial, serial_len);
+	entry->serial_len = (uint8_t)serial_len;
+	return 1;
+}
+
+// index->buf holds the file image, set the pointers into it
+static int x509_crl_index_set_buf(X509_CRL_INDEX *index, uint8_t *buf, size_t buflen)
+{
+	const X509_CRL_INDEX_HEADER *header = (const X509_CRL_INDEX_HEADER *)buf;
+
+	if (buflen < sizeof(X509_CRL_INDEX_HEADER)) {
+		error_print();
+		return -1;
+	}
+	if (memcmp(header->magic, x509_crl_index_magic, sizeof(header->magic)) != 0
+		|| header->version != X509_CRL_INDEX_VERSION
+		|| header->byte_order != X509_CRL_INDEX_BYTE_ORDER
+		|| header->header_size != sizeof(X509_CRL_INDEX_HEADER)
+		|| header->entry_size != sizeof(X509_CRL_INDEX_ENTRY)
+		|| header->issuer_len > X509_CRL_INDEX_MAX_ISSUER_SIZE) {
+		error_print();
+		return -1;
+	}
+	if (header->bloom_size < X509_CRL_INDEX_BLOOM_MIN_SIZE
+		|| (header->bloom_size & (header->bloom_size - 1))
+		|| header->entries_cnt > (buflen - sizeof(X509_CRL_INDEX_HEADER)) / sizeof(X509_CRL_INDEX_ENTRY)
+		|| buflen != sizeof(X509_CRL_INDEX_HEADER)
+			+ sizeof(X509_CRL_INDEX_ENTRY) * header->entries_cnt + header->bloom_size) {
+		error_print();
+		return -1;
+	}
+
+	index->header = header;
+	index->entries = (const X509_CRL_INDEX_ENTRY *)(buf + sizeof(X509_CRL_INDEX_HEADER));
+	index->entries_cnt = (size_t)header->entries_cnt;
+	index->bloom = (const uint8_t *)(index->entries + index->entries_cnt);
+	index->bloom_size = (size_t)header->bloom_size;
+	index->buf = buf;
+	index->buflen = buflen;
+	return 1;
+}
+
+int x509_crl_index_build(X509_CRL_INDEX *index, const uint8_t *crl, size_t crl_len)
+{
+	const uint8_t *issuer;
+	size_t issuer_len;
+	time_t this_update;
+	time_t next_update;
+	const uint8_t *revoked_certs;
+	size_t revoked_certs_len;
+	const uint8_t *d;
+	size_t dlen;
+	size_t cnt = 0;
+	size_t bloom_size = X509_CRL_INDEX_BLOOM_MIN_SIZE;
+	size_t buflen;
+	uint8_t *buf = NULL;
+	X509_CRL_INDEX_HEADER *header;
+	X509_CRL_INDEX_ENTRY *entries;
+	uint8_t *bloom;
+	SM3_CTX sm3_ctx;
+	size_t i;
+
+	if (!index || !crl || !crl_len) {
+		error_print();
+		return -1;
+	}
+	memset(index, 0, sizeof(*index));
+
+	if (x509_crl_get_details(crl, crl_len,
+		NULL, // version
+		NULL, // inner_sig_alg
+		&issuer, &issuer_len,
+		&this_update, &next_update,
+		&revoked_certs, &revoked_certs_len,
+		NULL, NULL, // exts
+		NULL, // signature_algor
+		NULL, NULL // signature
+		) != 1) {
+		error_print();
+		return -1;
+	}
+	if (issuer_len > X509_CRL_INDEX_MAX_ISSUER_SIZE) {
+		error_print();
+		return -1;
+	}
+
+	// count the entries (only the sequence headers) before the allocation
+	d = revoked_certs;
+	dlen = revoked_certs_len;
+	while (dlen) {
+		const uint8_t *p;
+		size_t len;
+		if (asn1_sequence_from_der(&p, &len, &d, &dlen) != 1) {
+			error_print();
+			return -1;
+		}
+		cnt++;
+	}
+	// 16 bits per entry, about 0.24% false positives with 4 hashes
+	while (bloom_size < cnt * 2) {
+		bloom_size <<= 1;
+	}
+
+	buflen = sizeof(X509_CRL_INDEX_HEADER) + sizeof(X509_CRL_INDEX_ENTRY) * cnt + bloom_size;
+	if (!(buf = (uint8_t *)calloc(1, buflen))) {
+		error_print();
+		return -1;
+	}
+	header = (X509_CRL_INDEX_HEADER *)buf;
+	entries = (X509_CRL_INDEX_ENTRY *)(buf + sizeof(X509_CRL_INDEX_HEADER));
+	bloom = (uint8_t *)(entries + cnt);
+
+	memcpy(header->magic, x509_crl_index_magic, sizeof(header->magic));
+	header->version = X509_CRL_INDEX_VERSION;
+	header->byte_order = X509_CRL_INDEX_BYTE_ORDER;
+	header->header_size = sizeof(X509_CRL_INDEX_HEADER);
+	header->entry_size = sizeof(X509_CRL_INDEX_ENTRY);
+	header->entries_cnt = cnt;
+	header->bloom_size = bloom_size;
+	header->this_update = this_update;
+	header->next_update = next_update;
+	sm3_init(&sm3_ctx);
+	sm3_update(&sm3_ctx, crl, crl_len);
+	sm3_finish(&sm3_ctx, header->crl_digest);
+	header->issuer_len = (uint32_t)issuer_len;
+	memcpy(header->issuer, issuer, issuer_len);
+
+	d = revoked_certs;
+	dlen = revoked_certs_len;
+	for (i = 0; i < cnt; i++) {
+		const uint8_t *serial;
+		size_t serial_len;
+		time_t revoke_date;
+		const uint8_t *entry_exts;
+		size_t entry_exts_len;
+		int reason;
+		time_t invalid_date;
+		const uint8_t *cert_issuer;
+		size_t cert_issuer_len;
+
+		if (x509_revoked_cert_from_der(&serial, &serial_len, &revoke_date,
+				&entry_exts, &entry_exts_len, &d, &dlen) != 1
+			|| x509_crl_entry_exts_get(entry_exts, entry_exts_len,
+				&reason, &invalid_date, &cert_issuer, &cert_issuer_len) != 1
+			|| x509_crl_index_set_entry(&entries[i], serial, serial_len) != 1) {
+			error_print();
+			free(buf);
+			return -1;
+		}
+		entries[i].reason = (int8_t)reason;
+		entries[i].revoke_date = revoke_date;
+		x509_crl_index_bloom_add(bloom, bloom_size, serial, serial_len);
+	}
+	qsort(entries, cnt, sizeof(X509_CRL_INDEX_ENTRY), x509_crl_index_entry_cmp);
+
+	if (x509_crl_index_set_buf(index, buf, buflen) != 1) {
+		error_print();
+		free(buf);
+		return -1;
+	}
+	return 1;
+}
+
+// written to file.tmp and renamed, readers never see a partial file
+int x509_crl_index_to_file(const X509_CRL_INDEX *index, const char *file)
+{
+	int ret = -1;
+	char *tmp = NULL;
+	size_t tmplen;
+	FILE *fp = NULL;
+
+	if (!index || !index->buf || !file) {
+		error_print();
+		return -1;
+	}
+	tmplen = strlen(file) + sizeof(".tmp");
+	if (!(tmp = (char *)malloc(tmplen))) {
+		error_print();
+		return -1;
+	}
+	snprintf(tmp, tmplen, "%s.tmp", file);
+
+	if (!(fp = fopen(tmp, "wb"))) {
+		error_print();
+		goto end;
+	}
+	if (fwrite(index->buf, 1, index->buflen, fp) != index->buflen
+		|| fflush(fp) != 0) {
+		error_print();
+		goto end;
+	}
+	fclose(fp);
+	fp = NULL;
+#ifdef WIN32
+	remove(file);
+#endif
+	if (rename(tmp, file) != 0) {
+		error_print();
+		goto end;
+	}
+	ret = 1;
+end:
+	if (fp) fclose(fp);
+	if (ret != 1) remove(tmp);
+	free(tmp);
+	return ret;
+}
+
+int x509_crl_index_from_file(X509_CRL_INDEX *index, const char *file)
+{
+	uint8_t *buf;
+	size_t buflen;
+
+	if (!index || !file) {
+		error_print();
+		return -1;
+	}
+	memset(index, 0, sizeof(*index));
+
+#ifndef WIN32
+	{
+		int fd;
+		struct stat st;
+		void *p;
+
+		if ((fd = open(file, O_RDONLY)) < 0) {
+			error_print();
+			return -1;
+		}
+		if (fstat(fd, &st) < 0 || st.st_size <= 0) {
+			error_print();
+			close(fd);
+			return -1;
+		}
+		buflen = (size_t)st.st_size;
+		p = mmap(NULL, buflen, PROT_READ, MAP_SHARED, fd, 0);
+		close(fd);
+		if (p == MAP_FAILED) {
+			error_print();
+			return -1;
+		}
+		buf = (uint8_t *)p;
+	}
+	if (x509_crl_index_set_buf(index, buf, buflen) != 1) {
+		error_print();
+		munmap(buf, buflen);
+		memset(index, 0, sizeof(*index));
+		return -1;
+	}
+	index->mapped = 1;
+#else
+	if (file_read_all(file, &buf, &buflen) != 1) {
+		error_print();
+		return -1;
+	}
+	if (x509_crl_index_set_buf(index, buf, buflen) != 1) {
+		error_print();
+		free(buf);
+		memset(index, 0, sizeof(*index));
+		return -1;
+	}
+#endif
+	return 1;
+}
+
+int x509_crl_index_get_issuer(const X509_CRL_INDEX *index, const uint8_t **issuer, size_t *issuer_len)
+{
+	if (!index || !index->header || !issuer || !issuer_len) {
+		error_print();
+		return -1;
+	}
+	*issuer = index->header->issuer;
+	*issuer_len = index->header->issuer_len;
+	return 1;
+}
+
+int x509_crl_index_find_revoked_cert_by_serial_number(const X509_CRL_INDEX *index,
+	const uint8_t *serial, size_t serial_len, time_t *revoke_date, int *reason)
+{
+	X509_CRL_INDEX_ENTRY key;
+	const X509_CRL_INDEX_ENTRY *entry;
+
+	if (!index || !index->header || !serial || !revoke_date || !reason) {
+		error_print();
+		return -1;
+	}
+	*revoke_date = -1;
+	*reason = -1;
+
+	// longer serials can not be in the index
+	if (!serial_len || serial_len > X509_CRL_INDEX_MAX_SERIAL_SIZE) {
+		return 0;
+	}
+	if (!x509_crl_index_bloom_test(index->bloom, index->bloom_size, serial, serial_len)) {
+		return 0;
+	}
+	x509_crl_index_set_entry(&key, serial, serial_len);
+	if (!(entry = (const X509_CRL_INDEX_ENTRY *)bsearch(&key, index->entries, index->entries_cnt,
+		sizeof(X509_CRL_INDEX_ENTRY), x509_crl_index_entry_cmp))) {
+		return 0;
+	}
+	*revoke_date = (time_t)entry->revoke_date;
+	*reason = entry->reason;
+	return 1;
+}
+
+int x509_crl_index_check_time(const X509_CRL_INDEX *index, time_t now)
+{
+	if (!index || !index->header) {
+		error_print();
+		return -1;
+	}
+	// a CRL without nextUpdate never goes stale by itself
+	if (index->header->next_update >= 0 && (int64_t)now >= index->header->next_update) {
+		return 0;
+	}
+	return 1;
+}
+
+void x509_crl_index_cleanup(X509_CRL_INDEX *index)
+{
+	if (index) {
+		if (index->buf) {
+#ifndef WIN32
+			if (index->mapped) {
+				munmap(index->buf, index->buflen);
+			} else {
+				free(index->buf);
+			}
+#else
+			free(index->buf);
+#endif
+		}
+		memset(index, 0, sizeof(*index));
+	}
+}
+
+int x509_crl_index_slot_init(X509_CRL_INDEX_SLOT *slot, const char *cache_file)
+{
+	FILE *fp;
+
+	if (!slot) {
+		error_print();
+		return -1;
+	}
+	memset(slot, 0, sizeof(*slot));
+#ifdef ENABLE_PTHREAD
+	if (!(slot->lock = malloc(sizeof(pthread_rwlock_t)))) {
+		error_print();
+		return -1;
+	}
+	if (pthread_rwlock_init((pthread_rwlock_t *)slot->lock, NULL) != 0) {
+		free(slot->lock);
+		slot->lock = NULL;
+		error_print();
+		return -1;
+	}
+#endif
+
+	// a missing cache is not an error, the slot is empty until the first refresh
+	if (cache_file && (fp = fopen(cache_file, "rb")) != NULL) {
+		fclose(fp);
+		if (!(slot->index = (X509_CRL_INDEX *)malloc(sizeof(X509_CRL_INDEX)))) {
+			error_print();
+			x509_crl_index_slot_cleanup(slot);
+			return -1;
+		}
+		if (x509_crl_index_from_file(slot->index, cache_file) != 1) {
+			error_print();
+			x509_crl_index_slot_cleanup(slot);
+			return -1;
+		}
+		// a stale cache is dropped, same as a missing one
+		if (x509_crl_index_check_time(slot->index, time(NULL)) != 1) {
+			x509_crl_index_cleanup(slot->index);
+			free(slot->index);
+			slot->index = NULL;
+		}
+	}
+	return 1;
+}
+
+int x509_crl_index_slot_refresh(X509_CRL_INDEX_SLOT *slot, const uint8_t *crl, size_t crl_len,
+	const char *cache_file)
+{
+	X509_CRL_INDEX *index;
+	X509_CRL_INDEX *old;
+
+	if (!slot || !crl || !crl_len) {
+		error_print();
+		return -1;
+	}
+	if (!(index = (X509_CRL_INDEX *)malloc(sizeof(X509_CRL_INDEX)))) {
+		error_print();
+		return -1;
+	}
+	if (x509_crl_index_build(index, crl, crl_len) != 1) {
+		error_print();
+		free(index);
+		return -1;
+	}
+
+#ifdef ENABLE_PTHREAD
+	pthread_rwlock_wrlock((pthread_rwlock_t *)slot->lock);
+#endif
+	old = slot->index;
+	slot->index = index;
+#ifdef ENABLE_PTHREAD
+	pthread_rwlock_unlock((pthread_rwlock_t *)slot->lock);
+#endif
+
+	if (old) {
+		x509_crl_index_cleanup(old);
+		free(old);
+	}
+
+	// the new CRL is already in use, a cache write failure does not undo it
+	if (cache_file) {
+		int ret;
+#ifdef ENABLE_PTHREAD
+		pthread_rwlock_rdlock((pthread_rwlock_t *)slot->lock);
+#endif
+		ret = x509_crl_index_to_file(slot->index, cache_file);
+#ifdef ENABLE_PTHREAD
+		pthread_rwlock_unlock((pthread_rwlock_t *)slot->lock);
+#endif
+		if (ret != 1) {
+			error_print();
+			return 0;
+		}
+	}
+	return 1;
+}
+
+int x509_crl_index_slot_find_revoked_cert_by_serial_number(X509_CRL_INDEX_SLOT *slot,
+	const uint8_t *serial, size_t serial_len, time_t *revoke_date, int *reason)
+{
+	int ret;
+
+	if (!slot) {
+		error_print();
+		return -1;
+	}
+#ifdef ENABLE_PTHREAD
+	pthread_rwlock_rdlock((pthread_rwlock_t *)slot->lock);
+#endif
+	if (!slot->index) {
+		error_print();
+		ret = -1;
+	} else if (x509_crl_index_check_time(slot->index, time(NULL)) != 1) {
+		// nextUpdate has passed, the slot must be refreshed before any answer
+		error_print();
+		ret = -1;
+	} else {
+		ret = x509_crl_index_find_revoked_cert_by_serial_number(slot->index,
+			serial, serial_len, revoke_date, reason);
+	}
+#ifdef ENABLE_PTHREAD
+	pthread_rwlock_unlock((pthread_rwlock_t *)slot->lock);
+#endif
+	return ret;
+}
+
+void x509_crl_index_slot_cleanup(X509_CRL_INDEX_SLOT *slot)
+{
+	if (slot) {
+		if (slot->index) {
+			x509_crl_index_cleanup(slot->index);
+			free(slot->index);
+		}
+#ifdef ENABLE_PTHREAD
+		if (slot->lock) {
+			pthread_rwlock_destroy((pthread_rwlock_t *)slot->lock);
+			free(slot->lock);
+		}
+#endif
+		memset(slot, 0, sizeof(*slot));
+	}
+}
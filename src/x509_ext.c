@@ -880,8 +880,7 @@ int x509_general_name_from_der(int *choice, const uint8_t **d, size_t *dlen, con
 	case ASN1_TAG_IMPLICIT(7): *choice = 7; break;
 	case ASN1_TAG_IMPLICIT(8): *choice = 8; break;
 	default:
-		fprintf(stderr, "%s %d: tag = %x\n", __FILE__, __LINE__, tag);
-		error_print();
+		error_print_msg("tag = %x\n", tag);
 		return -1;
 	}
 	return 1;
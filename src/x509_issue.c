@@ -0,0 +1,372 @@
+/*
+ *  Copyright 2014-2024 The GmSSL Project. All Rights Reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the License); you may
+ *  not use this file except in compliance with the License.
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+#include <gmssl/asn1.h>
+#include <gmssl/oid.h>
+#include <gmssl/x509_alg.h>
+#include <gmssl/x509.h>
+#include <gmssl/x509_ext.h>
+#include <gmssl/x509_req.h>
+#include <gmssl/x509_issue.h>
+#include <gmssl/rand.h>
+#include <gmssl/mem.h>
+#include <gmssl/error.h>
+#ifdef ENABLE_PTHREAD
+#include <pthread.h>
+#endif
+
+
+int x509_issue_ctx_init(X509_ISSUE_CTX *ctx,
+	const uint8_t *cacert, size_t cacertlen,
+	const SM2_KEY *sign_key, const char *signer_id, size_t signer_id_len,
+	const char *req_id, size_t req_id_len,
+	time_t not_before, time_t not_after,
+	const uint8_t *exts, size_t exts_len, int gen_subject_key_id,
+	size_t serial_len)
+{
+	const uint8_t *issuer;
+	size_t issuer_len;
+	SM2_KEY issuer_public_key;
+
+	if (!ctx || !cacert || !cacertlen || !sign_key || (!exts && exts_len)) {
+		error_print();
+		return -1;
+	}
+	if (serial_len < X509_ISSUE_MIN_SERIAL_SIZE || serial_len > X509_ISSUE_MAX_SERIAL_SIZE
+		|| exts_len > X509_ISSUE_MAX_EXTS_SIZE
+		|| req_id_len > SM2_MAX_ID_LENGTH
+		|| not_before > not_after) {
+		error_print();
+		return -1;
+	}
+	if (!signer_id) {
+		signer_id = SM2_DEFAULT_ID;
+		signer_id_len = SM2_DEFAULT_ID_LENGTH;
+	}
+	if (!req_id) {
+		req_id = SM2_DEFAULT_ID;
+		req_id_len = SM2_DEFAULT_ID_LENGTH;
+	}
+	memset(ctx, 0, sizeof(*ctx));
+
+	if (x509_cert_get_subject(cacert, cacertlen, &issuer, &issuer_len) != 1
+		|| x509_cert_get_subject_public_key(cacert, cacertlen, &issuer_public_key) != 1) {
+		error_print();
+		return -1;
+	}
+	if (sm2_public_key_equ(sign_key, &issuer_public_key) != 1) {
+		error_print();
+		return -1;
+	}
+	if (!(ctx->issuer = (uint8_t *)malloc(issuer_len))
+		|| (exts_len && !(ctx->exts = (uint8_t *)malloc(exts_len)))) {
+		x509_issue_ctx_cleanup(ctx);
+		error_print();
+		return -1;
+	}
+	memcpy(ctx->issuer, issuer, issuer_len);
+	ctx->issuer_len = issuer_len;
+	if (exts_len) {
+		memcpy(ctx->exts, exts, exts_len);
+		ctx->exts_len = exts_len;
+	}
+
+	if (sm2_sign_init(&ctx->sign_ctx, sign_key, signer_id, signer_id_len) != 1) {
+		x509_issue_ctx_cleanup(ctx);
+		error_print();
+		return -1;
+	}
+	// the precomputed k values must never be shared, every copy computes its own
+	gmssl_secure_clear(ctx->sign_ctx.pre_comp, sizeof(ctx->sign_ctx.pre_comp));
+	ctx->sign_ctx.num_pre_comp = 0;
+
+	memcpy(ctx->req_id, req_id, req_id_len);
+	ctx->req_id_len = req_id_len;
+	ctx->not_before = not_before;
+	ctx->not_after = not_after;
+	ctx->gen_subject_key_id = gen_subject_key_id;
+	ctx->serial_len = serial_len;
+	return 1;
+}
+
+void x509_issue_ctx_cleanup(X509_ISSUE_CTX *ctx)
+{
+	if (ctx) {
+		if (ctx->issuer) free(ctx->issuer);
+		if (ctx->exts) free(ctx->exts);
+		gmssl_secure_clear(ctx, sizeof(*ctx));
+	}
+}
+
+static const char *x509_issue_status_names[] = {
+	"ok",
+	"parse_error",
+	"bad_signature",
+	"error",
+};
+
+const char *x509_issue_status_name(int status)
+{
+	if (status < 0 || status >= X509_ISSUE_STATUS_CNT) {
+		return NULL;
+	}
+	return x509_issue_status_names[status];
+}
+
+static int x509_issue_cert(const X509_ISSUE_CTX *ctx, SM2_SIGN_CTX *sign_ctx, ASN1_WRITER *w,
+	X509_ISSUE_ITEM *item)
+{
+	const uint8_t *subject;
+	size_t subject_len;
+	SM2_KEY subject_public_key;
+	uint8_t serial[X509_ISSUE_MAX_SERIAL_SIZE];
+	uint8_t exts[X509_ISSUE_MAX_EXTS_SIZE + 64];
+	size_t exts_len = ctx->exts_len;
+	uint8_t sig[SM2_MAX_SIGNATURE_SIZE];
+	size_t siglen;
+	size_t cert_pos, tbs_offset;
+	size_t len;
+
+	if (x509_req_get_details(item->req, item->reqlen,
+		NULL, &subject, &subject_len, &subject_public_key,
+		NULL, NULL, NULL, NULL, NULL) != 1) {
+		item->status = X509_ISSUE_PARSE_ERROR;
+		return 1;
+	}
+	if (x509_req_verify(item->req, item->reqlen, ctx->req_id, ctx->req_id_len) != 1) {
+		item->status = X509_ISSUE_BAD_SIGNATURE;
+		return 1;
+	}
+
+	if (exts_len) {
+		memcpy(exts, ctx->exts, exts_len);
+	}
+	if (ctx->gen_subject_key_id) {
+		if (x509_exts_add_subject_key_identifier_ex(exts, &exts_len, sizeof(exts), -1,
+			&subject_public_key) != 1) {
+			error_print();
+			return -1;
+		}
+	}
+
+	// positive and of the same length for all the certificates
+	if (rand_bytes(serial, ctx->serial_len) != 1) {
+		error_print();
+		return -1;
+	}
+	serial[0] &= 0x7f;
+	if (!serial[0]) {
+		serial[0] = 1;
+	}
+
+	asn1_writer_reset(w);
+	if (asn1_writer_begin(w, ASN1_TAG_SEQUENCE, &cert_pos) != 1) {
+		error_print();
+		return -1;
+	}
+	tbs_offset = w->len;
+	if (x509_tbs_cert_to_writer(X509_version_v3,
+		serial, ctx->serial_len,
+		OID_sm2sign_with_sm3,
+		ctx->issuer, ctx->issuer_len,
+		ctx->not_before, ctx->not_after,
+		subject, subject_len,
+		&subject_public_key,
+		NULL, 0,
+		NULL, 0,
+		exts, exts_len,
+		w) != 1) {
+		error_print();
+		return -1;
+	}
+	if (sm2_sign_reset(sign_ctx) != 1
+		|| sm2_sign_update(sign_ctx, w->buf + tbs_offset, w->len - tbs_offset) != 1
+		|| sm2_sign_finish(sign_ctx, sig, &siglen) != 1) {
+		error_print();
+		return -1;
+	}
+	len = 0;
+	if (x509_signature_algor_to_der(OID_sm2sign_with_sm3, NULL, &len) != 1
+		|| asn1_bit_octets_to_der(sig, siglen, NULL, &len) != 1
+		|| asn1_writer_reserve(w, len) != 1
+		|| x509_signature_algor_to_der(OID_sm2sign_with_sm3, &w->p, &w->len) != 1
+		|| asn1_bit_octets_to_der(sig, siglen, &w->p, &w->len) != 1
+		|| asn1_writer_end(w, cert_pos) != 1) {
+		error_print();
+		return -1;
+	}
+
+	if (!(item->cert = (uint8_t *)malloc(w->len))) {
+		error_print();
+		return -1;
+	}
+	memcpy(item->cert, w->buf, w->len);
+	item->certlen = w->len;
+	item->status = X509_ISSUE_OK;
+	return 1;
+}
+
+typedef struct {
+	const X509_ISSUE_CTX *ctx;
+	X509_ISSUE_ITEM *items;
+	size_t n;
+	int ret;
+} X509_ISSUE_TASK;
+
+static void *x509_issue_routine(void *arg)
+{
+	X509_ISSUE_TASK *task = (X509_ISSUE_TASK *)arg;
+	SM2_SIGN_CTX sign_ctx;
+	ASN1_WRITER w;
+	size_t i;
+
+	task->ret = -1;
+
+	if (!task->n) {
+		task->ret = 1;
+		return NULL;
+	}
+	if (asn1_writer_init(&w, 1024) != 1) {
+		error_print();
+		return NULL;
+	}
+	sign_ctx = task->ctx->sign_ctx;
+
+	for (i = 0; i < task->n; i++) {
+		X509_ISSUE_ITEM *item = &task->items[i];
+
+		if (x509_issue_cert(task->ctx, &sign_ctx, &w, item) != 1) {
+			// the remaining items are still tried, the caller sees the status
+			item->status = X509_ISSUE_ERROR;
+		}
+	}
+	task->ret = 1;
+
+	gmssl_secure_clear(&sign_ctx, sizeof(sign_ctx));
+	asn1_writer_cleanup(&w);
+	return NULL;
+}
+
+// split the items into nthreads contiguous ranges, the first range is done by the calling thread
+static int x509_issue_run_tasks(const X509_ISSUE_CTX *ctx, X509_ISSUE_ITEM *items, size_t items_cnt, int nthreads)
+{
+	X509_ISSUE_TASK tasks[X509_ISSUE_MAX_THREADS];
+	size_t per_thread, offset = 0;
+	int ret = 1;
+	int i;
+#ifdef ENABLE_PTHREAD
+	pthread_t threads[X509_ISSUE_MAX_THREADS];
+	int started = 0;
+#endif
+
+	if (!ctx || (!items && items_cnt)) {
+		error_print();
+		return -1;
+	}
+	if (!items_cnt) {
+		return 1;
+	}
+	if (nthreads < 1) {
+		nthreads = 1;
+	}
+	if (nthreads > X509_ISSUE_MAX_THREADS) {
+		nthreads = X509_ISSUE_MAX_THREADS;
+	}
+	if ((size_t)nthreads > items_cnt) {
+		nthreads = (int)items_cnt;
+	}
+	per_thread = (items_cnt + nthreads - 1) / nthreads;
+
+	for (offset = 0; offset < items_cnt; offset++) {
+		items[offset].cert = NULL;
+		items[offset].certlen = 0;
+		items[offset].status = X509_ISSUE_ERROR;
+	}
+	offset = 0;
+	for (i = 0; i < nthreads; i++) {
+		size_t len = items_cnt - offset < per_thread ? items_cnt - offset : per_thread;
+
+		tasks[i].ctx = ctx;
+		tasks[i].items = items + offset;
+		tasks[i].n = len;
+		tasks[i].ret = -1;
+		offset += len;
+	}
+
+#ifdef ENABLE_PTHREAD
+	for (i = 1; i < nthreads; i++) {
+		if (pthread_create(&threads[i], NULL, x509_issue_routine, &tasks[i]) != 0) {
+			error_print();
+			break;
+		}
+		started = i;
+	}
+	x509_issue_routine(&tasks[0]);
+	for (i = started + 1; i < nthreads; i++) {
+		x509_issue_routine(&tasks[i]);
+	}
+	for (i = 1; i <= started; i++) {
+		pthread_join(threads[i], NULL);
+	}
+#else
+	for (i = 0; i < nthreads; i++) {
+		x509_issue_routine(&tasks[i]);
+	}
+#endif
+
+	for (i = 0; i < nthreads; i++) {
+		if (tasks[i].ret != 1) {
+			ret = -1;
+		}
+	}
+	if (ret != 1) {
+		error_print();
+	}
+	return ret;
+}
+
+int x509_certs_issue(const X509_ISSUE_CTX *ctx, X509_ISSUE_ITEM *items, size_t items_cnt)
+{
+	if (x509_issue_run_tasks(ctx, items, items_cnt, 1) != 1) {
+		error_print();
+		return -1;
+	}
+	return 1;
+}
+
+#ifdef ENABLE_PTHREAD
+int x509_certs_issue_threads(const X509_ISSUE_CTX *ctx, X509_ISSUE_ITEM *items, size_t items_cnt, int nthreads)
+{
+	if (x509_issue_run_tasks(ctx, items, items_cnt, nthreads) != 1) {
+		error_print();
+		return -1;
+	}
+	return 1;
+}
+#endif
+
+void x509_issue_items_cleanup(X509_ISSUE_ITEM *items, size_t items_cnt)
+{
+	size_t i;
+
+	if (!items) {
+		return;
+	}
+	for (i = 0; i < items_cnt; i++) {
+		if (items[i].cert) {
+			free(items[i].cert);
+		}
+		items[i].cert = NULL;
+		items[i].certlen = 0;
+	}
+}
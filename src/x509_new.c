@@ -59,31 +59,86 @@ end:
 int x509_certs_new_from_file(uint8_t **out, size_t *outlen, const char *file)
 {
 	int ret = -1;
-	FILE *fp = NULL;
-	size_t fsize;
+	FILE_MAP map;
+	PEM_ITER iter;
+	const char *name;
+	const uint8_t *der;
+	size_t derlen;
 	uint8_t *buf = NULL;
-	size_t buflen;
+	size_t buflen = 0;
+	int rv;
 
-	if (!(fp = fopen(file, "r"))
-		|| file_size(fp, &fsize) != 1
-		|| (buflen = (fsize * 3)/4 + 1) < 0
-		|| (buf = malloc((fsize * 3)/4 + 1)) == NULL) {
+	memset(&iter, 0, sizeof(iter));
+	if (file_map(&map, file) != 1) {
+		error_print();
+		return -1;
+	}
+	if (pem_iter_init(&iter, map.data, map.datalen) != 1
+		|| (buf = malloc((map.datalen * 3)/4 + 1)) == NULL) {
 		error_print();
 		goto end;
 	}
-	if (x509_certs_from_pem(buf, outlen, buflen, fp) != 1) {
+	while ((rv = pem_iter_next(&iter, &name, &der, &derlen)) == 1) {
+		if (strcmp(name, "CERTIFICATE") != 0
+			|| x509_cert_get_subject(der, derlen, NULL, NULL) != 1) {
+			error_print();
+			goto end;
+		}
+		memcpy(buf + buflen, der, derlen);
+		buflen += derlen;
+	}
+	if (rv < 0 || buflen == 0) {
 		error_print();
 		goto end;
 	}
 	*out = buf;
+	*outlen = buflen;
 	buf = NULL;
 	ret = 1;
 end:
-	if (fp) fclose(fp);
+	pem_iter_cleanup(&iter);
+	file_unmap(&map);
 	if (buf) free(buf);
 	return ret;
 }
 
+int x509_cert_sign_new(uint8_t **cert, size_t *certlen,
+	int version,
+	const uint8_t *serial, size_t serial_len,
+	int signature_algor,
+	const uint8_t *issuer, size_t issuer_len,
+	time_t not_before, time_t not_after,
+	const uint8_t *subject, size_t subject_len,
+	const SM2_KEY *subject_public_key,
+	const uint8_t *issuer_unique_id, size_t issuer_unique_id_len,
+	const uint8_t *subject_unique_id, size_t subject_unique_id_len,
+	const uint8_t *exts, size_t exts_len,
+	const SM2_KEY *sign_key, const char *signer_id, size_t signer_id_len)
+{
+	ASN1_WRITER w;
+
+	if (!cert || !certlen) {
+		error_print();
+		return -1;
+	}
+	if (asn1_writer_init(&w, 0) != 1) {
+		error_print();
+		return -1;
+	}
+	if (x509_cert_sign_to_writer(version, serial, serial_len, signature_algor,
+		issuer, issuer_len, not_before, not_after, subject, subject_len,
+		subject_public_key, issuer_unique_id, issuer_unique_id_len,
+		subject_unique_id, subject_unique_id_len, exts, exts_len,
+		sign_key, signer_id, signer_id_len, &w) != 1) {
+		asn1_writer_cleanup(&w);
+		error_print();
+		return -1;
+	}
+	*cert = w.buf;
+	*certlen = w.len;
+	return 1;
+}
+
 int x509_req_new_from_pem(uint8_t **out, size_t *outlen, FILE *fp)
 {
 	uint8_t *req;
@@ -129,6 +184,66 @@ int x509_req_new_from_file(uint8_t **req, size_t *reqlen, const char *file)
 	return 1;
 }
 
+int x509_req_sign_new(uint8_t **req, size_t *reqlen,
+	int version,
+	const uint8_t *subject, size_t subject_len,
+	const SM2_KEY *subject_public_key,
+	const uint8_t *attrs, size_t attrs_len,
+	int signature_algor,
+	const SM2_KEY *sign_key, const char *signer_id, size_t signer_id_len)
+{
+	ASN1_WRITER w;
+
+	if (!req || !reqlen) {
+		error_print();
+		return -1;
+	}
+	if (asn1_writer_init(&w, 0) != 1) {
+		error_print();
+		return -1;
+	}
+	if (x509_req_sign_to_writer(version, subject, subject_len, subject_public_key,
+		attrs, attrs_len, signature_algor,
+		sign_key, signer_id, signer_id_len, &w) != 1) {
+		asn1_writer_cleanup(&w);
+		error_print();
+		return -1;
+	}
+	*req = w.buf;
+	*reqlen = w.len;
+	return 1;
+}
+
+int x509_crl_sign_new(uint8_t **crl, size_t *crl_len,
+	int version, int sig_alg,
+	const uint8_t *issuer, size_t issuer_len,
+	time_t this_update, time_t next_update,
+	const uint8_t *revoked_certs, size_t revoked_certs_len,
+	const uint8_t *crl_exts, size_t crl_exts_len,
+	const SM2_KEY *sign_key, const char *signer_id, size_t signer_id_len)
+{
+	ASN1_WRITER w;
+
+	if (!crl || !crl_len) {
+		error_print();
+		return -1;
+	}
+	if (asn1_writer_init(&w, 0) != 1) {
+		error_print();
+		return -1;
+	}
+	if (x509_crl_sign_to_writer(version, sig_alg, issuer, issuer_len,
+		this_update, next_update, revoked_certs, revoked_certs_len,
+		crl_exts, crl_exts_len, sign_key, signer_id, signer_id_len, &w) != 1) {
+		asn1_writer_cleanup(&w);
+		error_print();
+		return -1;
+	}
+	*crl = w.buf;
+	*crl_len = w.len;
+	return 1;
+}
+
 int x509_crl_new_from_uri(uint8_t **crl, size_t *crl_len, const char *uri, size_t urilen)
 {
 	int ret = -1;
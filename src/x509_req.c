@@ -206,6 +206,57 @@ int x509_req_sign_to_der(
 	return 1;
 }
 
+int x509_req_sign_to_writer(
+	int version,
+	const uint8_t *subject, size_t subject_len,
+	const SM2_KEY *subject_public_key,
+	const uint8_t *attrs, size_t attrs_len,
+	int signature_algor,
+	const SM2_KEY *sign_key, const char *signer_id, size_t signer_id_len,
+	ASN1_WRITER *w)
+{
+	int sig_alg = OID_sm2sign_with_sm3;
+	uint8_t sig[SM2_MAX_SIGNATURE_SIZE];
+	size_t siglen = SM2_signature_typical_size;
+	size_t req_pos, info_pos, tbs_offset;
+	SM2_SIGN_CTX sign_ctx;
+
+	if (version != X509_version_v1) {
+		error_print();
+		return -1;
+	}
+	if (asn1_writer_reserve(w, subject_len + attrs_len + 512) != 1
+		|| asn1_writer_begin(w, ASN1_TAG_SEQUENCE, &req_pos) != 1) {
+		error_print();
+		return -1;
+	}
+	tbs_offset = w->len;
+	if (asn1_writer_begin(w, ASN1_TAG_SEQUENCE, &info_pos) != 1
+		|| asn1_int_to_der(version, &w->p, &w->len) != 1
+		|| asn1_sequence_to_der(subject, subject_len, &w->p, &w->len) != 1
+		|| x509_public_key_info_to_der(subject_public_key, &w->p, &w->len) != 1
+		|| asn1_implicit_set_to_der(0, attrs, attrs_len, &w->p, &w->len) != 1
+		|| asn1_writer_end(w, info_pos) != 1) {
+		error_print();
+		return -1;
+	}
+	if (sm2_sign_init(&sign_ctx, sign_key, signer_id, signer_id_len) != 1
+		|| sm2_sign_update(&sign_ctx, w->buf + tbs_offset, w->len - tbs_offset) != 1
+		|| sm2_sign_finish_fixlen(&sign_ctx, siglen, sig) != 1) {
+		gmssl_secure_clear(&sign_ctx, sizeof(sign_ctx));
+		error_print();
+		return -1;
+	}
+	gmssl_secure_clear(&sign_ctx, sizeof(sign_ctx));
+	if (x509_signature_algor_to_der(sig_alg, &w->p, &w->len) != 1
+		|| asn1_bit_octets_to_der(sig, siglen, &w->p, &w->len) != 1
+		|| asn1_writer_end(w, req_pos) != 1) {
+		error_print();
+		return -1;
+	}
+	return 1;
+}
+
 int x509_req_verify(const uint8_t *a, size_t alen, const char *signer_id, size_t signer_id_len)
 {
 	SM2_KEY public_key;
@@ -0,0 +1,1079 @@
+/*
+ *  Copyright 2014-2024 The GmSSL Project. All Rights Reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the License); you may
+ *  not use this file except in compliance with the License.
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+#include <gmssl/asn1.h>
+#include <gmssl/oid.h>
+#include <gmssl/x509.h>
+#include <gmssl/x509_ext.h>
+#include <gmssl/x509_store.h>
+#include <gmssl/rand.h>
+#include <gmssl/sm3.h>
+#include <gmssl/mem.h>
+#include <gmssl/endian.h>
+#include <gmssl/error.h>
+#ifdef ENABLE_PTHREAD
+#include <pthread.h>
+#endif
+
+
+#define FNV1A_INIT	0x811c9dc5
+#define FNV1A_PRIME	0x01000193
+
+static uint32_t fnv1a_update(uint32_t h, const uint8_t *p, size_t len)
+{
+	while (len--) {
+		h ^= *p++;
+		h *= FNV1A_PRIME;
+	}
+	return h;
+}
+
+static uint32_t x509_trust_store_hash(const uint8_t *a, size_t alen, const uint8_t *b, size_t blen)
+{
+	uint32_t h = FNV1A_INIT;
+	h = fnv1a_update(h, a, alen);
+	h = fnv1a_update(h, b, blen);
+	return h;
+}
+
+static void x509_trust_store_index_add(size_t *index, size_t mask, uint32_t hash, size_t i)
+{
+	size_t slot = hash & mask;
+
+	while (index[slot]) {
+		slot = (slot + 1) & mask;
+	}
+	index[slot] = i + 1;
+}
+
+static int x509_cert_view_get_subject_key_id(const X509_CERT_VIEW *view,
+	const uint8_t **keyid, size_t *keyid_len)
+{
+	int ret;
+	int critical;
+	const uint8_t *val;
+	size_t vlen;
+
+	if ((ret = x509_exts_get_ext_by_oid(view->exts, view->exts_len,
+		OID_ce_subject_key_identifier, &critical, &val, &vlen)) < 0) {
+		error_print();
+		return -1;
+	}
+	if (ret == 0) {
+		*keyid = NULL;
+		*keyid_len = 0;
+		return 0;
+	}
+	if (asn1_octet_string_from_der(keyid, keyid_len, &val, &vlen) != 1
+		|| asn1_length_is_zero(vlen) != 1) {
+		error_print();
+		return -1;
+	}
+	return 1;
+}
+
+static int x509_cert_view_get_authority_key_id(const X509_CERT_VIEW *view,
+	const uint8_t **keyid, size_t *keyid_len)
+{
+	int ret;
+	int critical;
+	const uint8_t *val;
+	size_t vlen;
+	const uint8_t *issuer;
+	size_t issuer_len;
+	const uint8_t *serial;
+	size_t serial_len;
+
+	*keyid = NULL;
+	*keyid_len = 0;
+	if ((ret = x509_exts_get_ext_by_oid(view->exts, view->exts_len,
+		OID_ce_authority_key_identifier, &critical, &val, &vlen)) < 0) {
+		error_print();
+		return -1;
+	}
+	if (ret == 0) {
+		return 0;
+	}
+	if (x509_authority_key_identifier_from_der(keyid, keyid_len,
+			&issuer, &issuer_len, &serial, &serial_len, &val, &vlen) != 1
+		|| asn1_length_is_zero(vlen) != 1) {
+		error_print();
+		return -1;
+	}
+	return *keyid ? 1 : 0;
+}
+
+// store->certs is owned by the store, all the views point into it
+static int x509_trust_store_build(X509_TRUST_STORE *store)
+{
+	const uint8_t *p = store->certs;
+	size_t len = store->certs_len;
+	size_t cnt;
+	size_t index_size = 16;
+	size_t i;
+
+	if (x509_certs_get_count(store->certs, store->certs_len, &cnt) != 1
+		|| !cnt) {
+		error_print();
+		goto err;
+	}
+	// keep the tables at most half full
+	while (index_size < cnt * 2) {
+		index_size <<= 1;
+	}
+	if (!(store->anchors = (X509_TRUST_ANCHOR *)calloc(cnt, sizeof(X509_TRUST_ANCHOR)))
+		|| !(store->subject_index = (size_t *)calloc(index_size, sizeof(size_t)))
+		|| !(store->subject_key_id_index = (size_t *)calloc(index_size, sizeof(size_t)))
+		|| !(store->issuer_and_serial_number_index = (size_t *)calloc(index_size, sizeof(size_t)))) {
+		error_print();
+		goto err;
+	}
+	store->index_mask = index_size - 1;
+
+	for (i = 0; i < cnt; i++) {
+		X509_TRUST_ANCHOR *anchor = &store->anchors[i];
+		X509_CERT_VIEW *view = &anchor->view;
+
+		if (x509_cert_view_from_der(view, &p, &len) != 1
+			|| x509_cert_view_get_subject_key_id(view,
+				&anchor->subject_key_id, &anchor->subject_key_id_len) < 0
+			|| x509_cert_view_get_subject_public_key(view, &anchor->public_key) != 1
+			|| sm2_verify_init(&anchor->verify_ctx, &anchor->public_key,
+				SM2_DEFAULT_ID, SM2_DEFAULT_ID_LENGTH) != 1) {
+			error_print();
+			goto err;
+		}
+
+		x509_trust_store_index_add(store->subject_index, store->index_mask,
+			x509_trust_store_hash(view->subject, view->subject_len, NULL, 0), i);
+		if (anchor->subject_key_id) {
+			x509_trust_store_index_add(store->subject_key_id_index, store->index_mask,
+				x509_trust_store_hash(anchor->subject_key_id, anchor->subject_key_id_len, NULL, 0), i);
+		}
+		x509_trust_store_index_add(store->issuer_and_serial_number_index, store->index_mask,
+			x509_trust_store_hash(view->issuer, view->issuer_len,
+				view->serial_number, view->serial_number_len), i);
+	}
+	store->anchors_cnt = cnt;
+
+	// identifies this store in the X509_VERIFY_CACHE keys
+	if (rand_bytes((uint8_t *)&store->generation, sizeof(store->generation)) != 1) {
+		error_print();
+		goto err;
+	}
+	return 1;
+
+err:
+	x509_trust_store_cleanup(store);
+	return -1;
+}
+
+int x509_trust_store_init(X509_TRUST_STORE *store, const uint8_t *certs, size_t certslen)
+{
+	uint8_t *buf;
+
+	if (!store || !certs || !certslen) {
+		error_print();
+		return -1;
+	}
+	if (!(buf = malloc(certslen))) {
+		error_print();
+		return -1;
+	}
+	memcpy(buf, certs, certslen);
+
+	memset(store, 0, sizeof(*store));
+	store->certs = buf;
+	store->certs_len = certslen;
+	return x509_trust_store_build(store);
+}
+
+int x509_trust_store_init_from_file(X509_TRUST_STORE *store, const char *file)
+{
+	uint8_t *certs;
+	size_t certslen;
+
+	if (!store || !file) {
+		error_print();
+		return -1;
+	}
+	if (x509_certs_new_from_file(&certs, &certslen, file) != 1) {
+		error_print();
+		return -1;
+	}
+	if (!certslen) {
+		error_print();
+		free(certs);
+		return -1;
+	}
+
+	memset(store, 0, sizeof(*store));
+	store->certs = certs;
+	store->certs_len = certslen;
+	return x509_trust_store_build(store);
+}
+
+void x509_trust_store_cleanup(X509_TRUST_STORE *store)
+{
+	if (store) {
+		if (store->anchors) {
+			gmssl_secure_clear(store->anchors, sizeof(X509_TRUST_ANCHOR) * store->anchors_cnt);
+			free(store->anchors);
+		}
+		if (store->certs) free(store->certs);
+		if (store->subject_index) free(store->subject_index);
+		if (store->subject_key_id_index) free(store->subject_key_id_index);
+		if (store->issuer_and_serial_number_index) free(store->issuer_and_serial_number_index);
+		memset(store, 0, sizeof(*store));
+	}
+}
+
+int x509_trust_store_get_by_subject(const X509_TRUST_STORE *store,
+	const uint8_t *subject, size_t subject_len, const X509_TRUST_ANCHOR **anchor)
+{
+	size_t slot;
+	size_t i;
+
+	if (!store || !subject || !anchor) {
+		error_print();
+		return -1;
+	}
+	if (!store->anchors_cnt) {
+		*anchor = NULL;
+		return 0;
+	}
+	slot = x509_trust_store_hash(subject, subject_len, NULL, 0) & store->index_mask;
+	while ((i = store->subject_index[slot]) != 0) {
+		const X509_CERT_VIEW *view = &store->anchors[i - 1].view;
+		if (x509_name_equ(view->subject, view->subject_len, subject, subject_len) == 1) {
+			*anchor = &store->anchors[i - 1];
+			return 1;
+		}
+		slot = (slot + 1) & store->index_mask;
+	}
+	*anchor = NULL;
+	return 0;
+}
+
+int x509_trust_store_get_by_subject_key_id(const X509_TRUST_STORE *store,
+	const uint8_t *keyid, size_t keyid_len, const X509_TRUST_ANCHOR **anchor)
+{
+	size_t slot;
+	size_t i;
+
+	if (!store || !keyid || !anchor) {
+		error_print();
+		return -1;
+	}
+	if (!store->anchors_cnt) {
+		*anchor = NULL;
+		return 0;
+	}
+	slot = x509_trust_store_hash(keyid, keyid_len, NULL, 0) & store->index_mask;
+	while ((i = store->subject_key_id_index[slot]) != 0) {
+		const X509_TRUST_ANCHOR *a = &store->anchors[i - 1];
+		if (a->subject_key_id_len == keyid_len
+			&& memcmp(a->subject_key_id, keyid, keyid_len) == 0) {
+			*anchor = a;
+			return 1;
+		}
+		slot = (slot + 1) & store->index_mask;
+	}
+	*anchor = NULL;
+	return 0;
+}
+
+int x509_trust_store_get_by_issuer_and_serial_number(const X509_TRUST_STORE *store,
+	const uint8_t *issuer, size_t issuer_len, const uint8_t *serial, size_t serial_len,
+	const X509_TRUST_ANCHOR **anchor)
+{
+	size_t slot;
+	size_t i;
+
+	if (!store || !issuer || !serial || !anchor) {
+		error_print();
+		return -1;
+	}
+	if (!store->anchors_cnt) {
+		*anchor = NULL;
+		return 0;
+	}
+	slot = x509_trust_store_hash(issuer, issuer_len, serial, serial_len) & store->index_mask;
+	while ((i = store->issuer_and_serial_number_index[slot]) != 0) {
+		const X509_CERT_VIEW *view = &store->anchors[i - 1].view;
+		if (x509_name_equ(view->issuer, view->issuer_len, issuer, issuer_len) == 1
+			&& view->serial_number_len == serial_len
+			&& memcmp(view->serial_number, serial, serial_len) == 0) {
+			*anchor = &store->anchors[i - 1];
+			return 1;
+		}
+		slot = (slot + 1) & store->index_mask;
+	}
+	*anchor = NULL;
+	return 0;
+}
+
+// prefer the AuthorityKeyIdentifier, CAs might be re-keyed with the same subject
+int x509_trust_store_get_issuer(const X509_TRUST_STORE *store,
+	const X509_CERT_VIEW *cert, const X509_TRUST_ANCHOR **anchor)
+{
+	int ret;
+	const uint8_t *keyid;
+	size_t keyid_len;
+
+	if (x509_cert_view_get_authority_key_id(cert, &keyid, &keyid_len) < 0) {
+		error_print();
+		return -1;
+	}
+	if (keyid) {
+		if ((ret = x509_trust_store_get_by_subject_key_id(store, keyid, keyid_len, anchor)) < 0) {
+			error_print();
+			return -1;
+		}
+		if (ret == 1 && x509_name_equ((*anchor)->view.subject, (*anchor)->view.subject_len,
+			cert->issuer, cert->issuer_len) == 1) {
+			return 1;
+		}
+	}
+	if ((ret = x509_trust_store_get_by_subject(store, cert->issuer, cert->issuer_len, anchor)) < 0) {
+		error_print();
+		return -1;
+	}
+	return ret;
+}
+
+int x509_trust_anchor_verify(const X509_TRUST_ANCHOR *anchor, const X509_CERT_VIEW *cert,
+	const char *signer_id, size_t signer_id_len)
+{
+	SM2_VERIFY_CTX verify_ctx;
+
+	if (!anchor || !cert) {
+		error_print();
+		return -1;
+	}
+	if (x509_name_equ(cert->issuer, cert->issuer_len,
+		anchor->view.subject, anchor->view.subject_len) != 1) {
+		error_print();
+		return -1;
+	}
+	if (!signer_id || signer_id_len != SM2_DEFAULT_ID_LENGTH
+		|| memcmp(signer_id, SM2_DEFAULT_ID, SM2_DEFAULT_ID_LENGTH) != 0) {
+		if (x509_cert_view_verify(cert, &anchor->public_key, signer_id, signer_id_len) != 1) {
+			error_print();
+			return -1;
+		}
+		return 1;
+	}
+
+	if (cert->signature_algor != OID_sm2sign_with_sm3) {
+		error_print();
+		return -1;
+	}
+	// the prepared context already has Z and the public point table
+	verify_ctx = anchor->verify_ctx;
+	if (sm2_verify_update(&verify_ctx, cert->tbs, cert->tbs_len) != 1
+		|| sm2_verify_finish(&verify_ctx, cert->signature, cert->signature_len) != 1) {
+		error_print();
+		return -1;
+	}
+	return 1;
+}
+
+// the chain is only valid until the earliest notAfter of its certs
+static int x509_cert_view_update_not_after(const X509_CERT_VIEW *view, time_t *not_after)
+{
+	time_t not_before;
+	time_t t;
+
+	if (x509_cert_view_get_validity(view, &not_before, &t) != 1) {
+		error_print();
+		return -1;
+	}
+	if (t < *not_after) {
+		*not_after = t;
+	}
+	return 1;
+}
+
+// kenc_cert_type is -1 when the chain has no TLCP key encipherment cert
+static int x509_trust_store_verify_chain(const uint8_t *certs, size_t certslen,
+	int sign_cert_type, int kenc_cert_type, const X509_TRUST_STORE *store, int depth,
+	time_t *not_after)
+{
+	X509_CERT_VIEW views[2];
+	X509_CERT_VIEW kenc_cert;
+	X509_CERT_VIEW *cert = &views[0];
+	X509_CERT_VIEW *cacert = &views[1];
+	X509_CERT_VIEW *tmp;
+	const X509_TRUST_ANCHOR *anchor;
+	time_t not_before;
+
+	int path_len = 0;
+	int path_len_constraint;
+
+	// entity cert
+	if (x509_cert_view_from_der(cert, &certs, &certslen) != 1) {
+		error_print();
+		return -1;
+	}
+	if (x509_cert_view_check(cert, sign_cert_type, &path_len_constraint) != 1) {
+		error_print();
+		x509_cert_print(stderr, 0, 10, "Invalid Entity Certificate", cert->cert, cert->cert_len);
+		return -1;
+	}
+	if (x509_cert_view_get_validity(cert, &not_before, not_after) != 1) {
+		error_print();
+		return -1;
+	}
+
+	// entity key encipherment cert
+	if (kenc_cert_type >= 0) {
+		if (x509_cert_view_from_der(&kenc_cert, &certs, &certslen) != 1) {
+			error_print();
+			return -1;
+		}
+		if (x509_cert_view_check(&kenc_cert, kenc_cert_type, &path_len_constraint) != 1
+			|| x509_cert_view_update_not_after(&kenc_cert, not_after) != 1) {
+			error_print();
+			return -1;
+		}
+	}
+
+	while (certslen) {
+
+		if (x509_cert_view_from_der(cacert, &certs, &certslen) != 1) {
+			error_print();
+			return -1;
+		}
+		if (x509_cert_view_check(cacert, X509_cert_ca, &path_len_constraint) != 1) {
+			error_print();
+			x509_cert_print(stderr, 0, 10, "Invalid CA Certificate", cacert->cert, cacert->cert_len);
+			return -1;
+		}
+		if (x509_cert_view_update_not_after(cacert, not_after) != 1) {
+			error_print();
+			return -1;
+		}
+
+		if (path_len == 0) {
+			if (path_len_constraint != 0) {
+				error_print();
+				return -1;
+			}
+			if (kenc_cert_type >= 0) {
+				if (x509_cert_view_verify_by_ca_view(&kenc_cert, cacert,
+					SM2_DEFAULT_ID, SM2_DEFAULT_ID_LENGTH) != 1) {
+					error_print();
+					return -1;
+				}
+			}
+		}
+		if ((path_len_constraint >= 0 && path_len > path_len_constraint)
+			|| path_len > depth) {
+			error_print();
+			return -1;
+		}
+
+		if (x509_cert_view_verify_by_ca_view(cert, cacert,
+			SM2_DEFAULT_ID, SM2_DEFAULT_ID_LENGTH) != 1) {
+			error_print();
+			return -1;
+		}
+
+		tmp = cert;
+		cert = cacert;
+		cacert = tmp;
+		path_len++;
+	}
+
+	if (x509_trust_store_get_issuer(store, cert, &anchor) != 1) {
+		error_print();
+		return -1;
+	}
+	if (x509_cert_view_check(&anchor->view, X509_cert_ca, &path_len_constraint) != 1
+		|| x509_cert_view_update_not_after(&anchor->view, not_after) != 1) {
+		error_print();
+		return -1;
+	}
+	if ((path_len_constraint >= 0 && path_len > path_len_constraint)
+		|| path_len > depth) {
+		error_print();
+		return -1;
+	}
+
+	// when no mid CA certs
+	if (path_len == 0 && kenc_cert_type >= 0) {
+		if (x509_trust_anchor_verify(anchor, &kenc_cert,
+			SM2_DEFAULT_ID, SM2_DEFAULT_ID_LENGTH) != 1) {
+			error_print();
+			return -1;
+		}
+	}
+	if (x509_trust_anchor_verify(anchor, cert, SM2_DEFAULT_ID, SM2_DEFAULT_ID_LENGTH) != 1) {
+		error_print();
+		return -1;
+	}
+	return 1;
+}
+
+static int x509_trust_store_verify(const uint8_t *certs, size_t certslen, int certs_type, int tlcp,
+	const X509_TRUST_STORE *store, int depth, time_t *not_after)
+{
+	int sign_cert_type;
+	int kenc_cert_type = -1;
+
+	if (!certs || !store) {
+		error_print();
+		return -1;
+	}
+	switch (certs_type) {
+	case X509_cert_chain_server:
+		sign_cert_type = X509_cert_server_auth;
+		break;
+	case X509_cert_chain_client:
+		sign_cert_type = X509_cert_client_auth;
+		break;
+	default:
+		error_print();
+		return -1;
+	}
+	// same cert types as x509_certs_verify_tlcp
+	if (tlcp) {
+		sign_cert_type = X509_cert_server_auth;
+		kenc_cert_type = X509_cert_server_key_encipher;
+	}
+	if (x509_trust_store_verify_chain(certs, certslen, sign_cert_type, kenc_cert_type,
+		store, depth, not_after) != 1) {
+		error_print();
+		return -1;
+	}
+	return 1;
+}
+
+int x509_certs_verify_by_trust_store(const uint8_t *certs, size_t certslen, int certs_type,
+	const X509_TRUST_STORE *store, int depth, int *verify_result)
+{
+	time_t not_after;
+
+	if (x509_trust_store_verify(certs, certslen, certs_type, 0, store, depth, &not_after) != 1) {
+		error_print();
+		return -1;
+	}
+	return 1;
+}
+
+int x509_certs_verify_tlcp_by_trust_store(const uint8_t *certs, size_t certslen, int certs_type,
+	const X509_TRUST_STORE *store, int depth, int *verify_result)
+{
+	time_t not_after;
+
+	if (x509_trust_store_verify(certs, certslen, certs_type, 1, store, depth, &not_after) != 1) {
+		error_print();
+		return -1;
+	}
+	return 1;
+}
+
+int x509_verify_cache_init(X509_VERIFY_CACHE *cache, size_t max_entries, time_t ttl)
+{
+	size_t nsets = 1;
+
+	if (!cache || !max_entries || ttl <= 0) {
+		error_print();
+		return -1;
+	}
+	memset(cache, 0, sizeof(*cache));
+
+	while (nsets * X509_VERIFY_CACHE_WAYS < max_entries) {
+		nsets <<= 1;
+	}
+	if (!(cache->entries = (X509_VERIFY_CACHE_ENTRY *)calloc(nsets * X509_VERIFY_CACHE_WAYS,
+		sizeof(X509_VERIFY_CACHE_ENTRY)))) {
+		error_print();
+		return -1;
+	}
+#ifdef ENABLE_PTHREAD
+	if (!(cache->lock = malloc(sizeof(pthread_mutex_t)))) {
+		error_print();
+		free(cache->entries);
+		cache->entries = NULL;
+		return -1;
+	}
+	if (pthread_mutex_init((pthread_mutex_t *)cache->lock, NULL) != 0) {
+		error_print();
+		free(cache->lock);
+		free(cache->entries);
+		cache->entries = NULL;
+		cache->lock = NULL;
+		return -1;
+	}
+#endif
+	cache->sets_mask = nsets - 1;
+	cache->ttl = ttl;
+	cache->generation = 1;
+	return 1;
+}
+
+void x509_verify_cache_cleanup(X509_VERIFY_CACHE *cache)
+{
+	if (cache) {
+		if (cache->entries) {
+			free(cache->entries);
+#ifdef ENABLE_PTHREAD
+			pthread_mutex_destroy((pthread_mutex_t *)cache->lock);
+			free(cache->lock);
+#endif
+		}
+		memset(cache, 0, sizeof(*cache));
+	}
+}
+
+// entries of older generations are never returned and are overwritten first
+void x509_verify_cache_invalidate(X509_VERIFY_CACHE *cache)
+{
+	if (!cache || !cache->entries) {
+		error_print();
+		return;
+	}
+#ifdef ENABLE_PTHREAD
+	pthread_mutex_lock((pthread_mutex_t *)cache->lock);
+#endif
+	cache->generation++;
+#ifdef ENABLE_PTHREAD
+	pthread_mutex_unlock((pthread_mutex_t *)cache->lock);
+#endif
+}
+
+void x509_verify_cache_get_stats(X509_VERIFY_CACHE *cache, uint64_t *hits, uint64_t *misses,
+	uint64_t *evictions)
+{
+	if (!cache || !cache->entries) {
+		error_print();
+		return;
+	}
+#ifdef ENABLE_PTHREAD
+	pthread_mutex_lock((pthread_mutex_t *)cache->lock);
+#endif
+	if (hits) *hits = cache->hits;
+	if (misses) *misses = cache->misses;
+	if (evictions) *evictions = cache->evictions;
+#ifdef ENABLE_PTHREAD
+	pthread_mutex_unlock((pthread_mutex_t *)cache->lock);
+#endif
+}
+
+static int x509_verify_cache_get(X509_VERIFY_CACHE *cache, const uint8_t key[32], time_t now, int *result)
+{
+	X509_VERIFY_CACHE_ENTRY *set;
+	size_t i;
+	int ret = 0;
+
+#ifdef ENABLE_PTHREAD
+	pthread_mutex_lock((pthread_mutex_t *)cache->lock);
+#endif
+	set = cache->entries + (GETU32(key) & cache->sets_mask) * X509_VERIFY_CACHE_WAYS;
+	for (i = 0; i < X509_VERIFY_CACHE_WAYS; i++) {
+		if (set[i].generation == cache->generation
+			&& now < set[i].expires
+			&& memcmp(set[i].key, key, 32) == 0) {
+			*result = set[i].result;
+			ret = 1;
+			break;
+		}
+	}
+	if (ret) {
+		cache->hits++;
+	} else {
+		cache->misses++;
+	}
+#ifdef ENABLE_PTHREAD
+	pthread_mutex_unlock((pthread_mutex_t *)cache->lock);
+#endif
+	return ret;
+}
+
+// replace a stale entry if any, or the one expiring first
+static void x509_verify_cache_put(X509_VERIFY_CACHE *cache, const uint8_t key[32],
+	time_t expires, int result)
+{
+	X509_VERIFY_CACHE_ENTRY *set;
+	X509_VERIFY_CACHE_ENTRY *victim = NULL;
+	size_t i;
+
+#ifdef ENABLE_PTHREAD
+	pthread_mutex_lock((pthread_mutex_t *)cache->lock);
+#endif
+	set = cache->entries + (GETU32(key) & cache->sets_mask) * X509_VERIFY_CACHE_WAYS;
+	for (i = 0; i < X509_VERIFY_CACHE_WAYS; i++) {
+		if (set[i].generation != cache->generation
+			|| memcmp(set[i].key, key, 32) == 0) {
+			victim = &set[i];
+			break;
+		}
+		if (!victim || set[i].expires < victim->expires) {
+			victim = &set[i];
+		}
+	}
+	if (victim->generation == cache->generation
+		&& memcmp(victim->key, key, 32) != 0) {
+		cache->evictions++;
+	}
+	memcpy(victim->key, key, 32);
+	victim->expires = expires;
+	victim->generation = cache->generation;
+	victim->result = result;
+#ifdef ENABLE_PTHREAD
+	pthread_mutex_unlock((pthread_mutex_t *)cache->lock);
+#endif
+}
+
+static int x509_trust_store_verify_cached(const uint8_t *certs, size_t certslen, int certs_type, int tlcp,
+	const X509_TRUST_STORE *store, int depth, X509_VERIFY_CACHE *cache)
+{
+	SM3_CTX sm3_ctx;
+	uint8_t key[32];
+	uint8_t params[20];
+	uint8_t *p = params;
+	time_t now;
+	time_t not_after;
+	time_t expires;
+	int ret;
+
+	if (!certs || !store || !cache) {
+		error_print();
+		return -1;
+	}
+
+	// key is SM3(store generation || certs_type || tlcp || depth || certs)
+	PUTU64(p, store->generation); p += 8;
+	PUTU32(p, (uint32_t)certs_type); p += 4;
+	PUTU32(p, (uint32_t)tlcp); p += 4;
+	PUTU32(p, (uint32_t)depth);
+	sm3_init(&sm3_ctx);
+	sm3_update(&sm3_ctx, params, sizeof(params));
+	sm3_update(&sm3_ctx, certs, certslen);
+	sm3_finish(&sm3_ctx, key);
+
+	time(&now);
+	if (x509_verify_cache_get(cache, key, now, &ret) == 1) {
+		if (ret != 1) error_print();
+		return ret;
+	}
+
+	ret = x509_trust_store_verify(certs, certslen, certs_type, tlcp, store, depth, &not_after);
+	expires = now + cache->ttl;
+	if (ret == 1 && not_after < expires) {
+		expires = not_after;
+	}
+	x509_verify_cache_put(cache, key, expires, ret);
+
+	if (ret != 1) {
+		error_print();
+		return -1;
+	}
+	return 1;
+}
+
+int x509_certs_verify_by_trust_store_cached(const uint8_t *certs, size_t certslen, int certs_type,
+	const X509_TRUST_STORE *store, int depth, X509_VERIFY_CACHE *cache, int *verify_result)
+{
+	if (x509_trust_store_verify_cached(certs, certslen, certs_type, 0, store, depth, cache) != 1) {
+		error_print();
+		return -1;
+	}
+	return 1;
+}
+
+int x509_certs_verify_tlcp_by_trust_store_cached(const uint8_t *certs, size_t certslen, int certs_type,
+	const X509_TRUST_STORE *store, int depth, X509_VERIFY_CACHE *cache, int *verify_result)
+{
+	if (x509_trust_store_verify_cached(certs, certslen, certs_type, 1, store, depth, cache) != 1) {
+		error_print();
+		return -1;
+	}
+	return 1;
+}
+
+
+static const char *x509_bulk_verify_status_names[] = {
+	"ok",
+	"parse_error",
+	"unknown_issuer",
+	"bad_signature",
+	"not_yet_valid",
+	"expired",
+	"revoked",
+};
+
+const char *x509_bulk_verify_status_name(int status)
+{
+	if (status < 0 || status >= X509_BULK_VERIFY_STATUS_CNT) {
+		return NULL;
+	}
+	return x509_bulk_verify_status_names[status];
+}
+
+typedef struct {
+	const X509_TRUST_STORE *store;
+	const X509_CRL_INDEX **anchor_crls; // CRL index of each anchor, or NULL
+	time_t verify_time;
+	X509_BULK_VERIFY_ITEM *items;
+	const X509_CERT_VIEW *views;
+	const size_t *anchor_ids; // anchor of each item
+	const size_t *order; // item indexes grouped by anchor
+	size_t n;
+	int ret;
+} X509_BULK_VERIFY_TASK;
+
+static void *x509_bulk_verify_routine(void *arg)
+{
+	X509_BULK_VERIFY_TASK *task = (X509_BULK_VERIFY_TASK *)arg;
+	size_t i;
+
+	task->ret = -1;
+
+	for (i = 0; i < task->n; i++) {
+		size_t id = task->order[i];
+		X509_BULK_VERIFY_ITEM *item = &task->items[id];
+		const X509_CERT_VIEW *view = &task->views[id];
+		const X509_TRUST_ANCHOR *anchor = &task->store->anchors[task->anchor_ids[id]];
+		const X509_CRL_INDEX *crl_index = task->anchor_crls[task->anchor_ids[id]];
+		time_t not_before, not_after;
+		int rv;
+
+		if (x509_trust_anchor_verify(anchor, view, SM2_DEFAULT_ID, SM2_DEFAULT_ID_LENGTH) != 1) {
+			item->status = X509_BULK_VERIFY_BAD_SIGNATURE;
+			continue;
+		}
+		if (crl_index) {
+			if ((rv = x509_crl_index_find_revoked_cert_by_serial_number(crl_index,
+				view->serial_number, view->serial_number_len,
+				&item->revoke_date, &item->revoke_reason)) < 0) {
+				error_print();
+				return NULL;
+			}
+			if (rv) {
+				item->status = X509_BULK_VERIFY_REVOKED;
+				continue;
+			}
+		}
+		if (x509_cert_view_get_validity(view, &not_before, &not_after) != 1) {
+			item->status = X509_BULK_VERIFY_PARSE_ERROR;
+		} else if (task->verify_time < not_before) {
+			item->status = X509_BULK_VERIFY_NOT_YET_VALID;
+		} else if (task->verify_time > not_after) {
+			item->status = X509_BULK_VERIFY_EXPIRED;
+		} else {
+			item->status = X509_BULK_VERIFY_OK;
+		}
+	}
+
+	task->ret = 1;
+	return NULL;
+}
+
+// split the grouped items into nthreads contiguous ranges, the first range is done by the calling thread
+static int x509_bulk_verify_run_tasks(const X509_BULK_VERIFY_TASK *all, int nthreads)
+{
+	X509_BULK_VERIFY_TASK tasks[X509_BULK_VERIFY_MAX_THREADS];
+	size_t per_thread, offset = 0;
+	int ret = 1;
+	int i;
+#ifdef ENABLE_PTHREAD
+	pthread_t threads[X509_BULK_VERIFY_MAX_THREADS];
+	int started = 0;
+#endif
+
+	if (nthreads < 1) {
+		nthreads = 1;
+	}
+	if (nthreads > X509_BULK_VERIFY_MAX_THREADS) {
+		nthreads = X509_BULK_VERIFY_MAX_THREADS;
+	}
+	if ((size_t)nthreads > all->n) {
+		nthreads = all->n ? (int)all->n : 1;
+	}
+	per_thread = (all->n + nthreads - 1) / nthreads;
+
+	for (i = 0; i < nthreads; i++) {
+		size_t len = all->n - offset < per_thread ? all->n - offset : per_thread;
+
+		tasks[i] = *all;
+		tasks[i].order += offset;
+		tasks[i].n = len;
+		tasks[i].ret = -1;
+		offset += len;
+	}
+
+#ifdef ENABLE_PTHREAD
+	for (i = 1; i < nthreads; i++) {
+		if (pthread_create(&threads[i], NULL, x509_bulk_verify_routine, &tasks[i]) != 0) {
+			error_print();
+			break;
+		}
+		started = i;
+	}
+	x509_bulk_verify_routine(&tasks[0]);
+	for (i = 1; i <= started; i++) {
+		pthread_join(threads[i], NULL);
+	}
+#else
+	for (i = 0; i < nthreads; i++) {
+		x509_bulk_verify_routine(&tasks[i]);
+	}
+#endif
+
+	for (i = 0; i < nthreads; i++) {
+		if (tasks[i].ret != 1) {
+			ret = -1;
+		}
+	}
+	if (ret != 1) {
+		error_print();
+	}
+	return ret;
+}
+
+static int x509_bulk_verify(const X509_TRUST_STORE *store,
+	const X509_CRL_INDEX *crl_indexes, size_t crl_indexes_cnt, time_t verify_time,
+	X509_BULK_VERIFY_ITEM *items, size_t items_cnt, int nthreads)
+{
+	int ret = -1;
+	X509_BULK_VERIFY_TASK task;
+	const X509_CRL_INDEX **anchor_crls = NULL;
+	X509_CERT_VIEW *views = NULL;
+	size_t *anchor_ids = NULL;
+	size_t *order = NULL;
+	size_t *counts = NULL;
+	const X509_TRUST_ANCHOR *anchor;
+	size_t n = 0;
+	size_t i, j;
+	int rv;
+
+	if (!store || (!crl_indexes && crl_indexes_cnt) || (!items && items_cnt)) {
+		error_print();
+		return -1;
+	}
+	if (!items_cnt) {
+		return 1;
+	}
+
+	if (!(anchor_crls = (const X509_CRL_INDEX **)calloc(store->anchors_cnt + 1, sizeof(*anchor_crls)))
+		|| !(views = (X509_CERT_VIEW *)malloc(sizeof(*views) * items_cnt))
+		|| !(anchor_ids = (size_t *)malloc(sizeof(*anchor_ids) * items_cnt))
+		|| !(order = (size_t *)malloc(sizeof(*order) * items_cnt))
+		|| !(counts = (size_t *)calloc(store->anchors_cnt + 1, sizeof(*counts)))) {
+		error_print();
+		goto end;
+	}
+
+	// the CRL of a CA applies to all the anchors of the same subject
+	for (j = 0; j < crl_indexes_cnt; j++) {
+		const uint8_t *issuer;
+		size_t issuer_len;
+
+		if (x509_crl_index_get_issuer(&crl_indexes[j], &issuer, &issuer_len) != 1) {
+			error_print();
+			goto end;
+		}
+		for (i = 0; i < store->anchors_cnt; i++) {
+			if (x509_name_equ(store->anchors[i].view.subject, store->anchors[i].view.subject_len,
+				issuer, issuer_len) == 1) {
+				anchor_crls[i] = &crl_indexes[j];
+			}
+		}
+	}
+
+	// find the issuers, items without an issuer are done
+	for (i = 0; i < items_cnt; i++) {
+		items[i].revoke_date = -1;
+		items[i].revoke_reason = -1;
+		anchor_ids[i] = store->anchors_cnt;
+
+		if (x509_cert_view_init(&views[i], items[i].cert, items[i].certlen) != 1) {
+			items[i].status = X509_BULK_VERIFY_PARSE_ERROR;
+			continue;
+		}
+		if ((rv = x509_trust_store_get_issuer(store, &views[i], &anchor)) < 0) {
+			error_print();
+			goto end;
+		}
+		if (!rv) {
+			items[i].status = X509_BULK_VERIFY_UNKNOWN_ISSUER;
+			continue;
+		}
+		anchor_ids[i] = anchor - store->anchors;
+		counts[anchor_ids[i]]++;
+		n++;
+	}
+
+	// counting sort of the items by anchor
+	for (i = 0, j = 0; i < store->anchors_cnt; i++) {
+		size_t cnt = counts[i];
+		counts[i] = j;
+		j += cnt;
+	}
+	for (i = 0; i < items_cnt; i++) {
+		if (anchor_ids[i] < store->anchors_cnt) {
+			order[counts[anchor_ids[i]]++] = i;
+		}
+	}
+
+	task.store = store;
+	task.anchor_crls = anchor_crls;
+	task.verify_time = verify_time;
+	task.items = items;
+	task.views = views;
+	task.anchor_ids = anchor_ids;
+	task.order = order;
+	task.n = n;
+	task.ret = -1;
+
+	if (x509_bulk_verify_run_tasks(&task, nthreads) != 1) {
+		error_print();
+		goto end;
+	}
+	ret = 1;
+
+end:
+	if (anchor_crls) free(anchor_crls);
+	if (views) free(views);
+	if (anchor_ids) free(anchor_ids);
+	if (order) free(order);
+	if (counts) free(counts);
+	return ret;
+}
+
+int x509_certs_bulk_verify(const X509_TRUST_STORE *store,
+	const X509_CRL_INDEX *crl_indexes, size_t crl_indexes_cnt, time_t verify_time,
+	X509_BULK_VERIFY_ITEM *items, size_t items_cnt)
+{
+	if (x509_bulk_verify(store, crl_indexes, crl_indexes_cnt, verify_time, items, items_cnt, 1) != 1) {
+		error_print();
+		return -1;
+	}
+	return 1;
+}
+
+#ifdef ENABLE_PTHREAD
+int x509_certs_bulk_verify_threads(const X509_TRUST_STORE *store,
+	const X509_CRL_INDEX *crl_indexes, size_t crl_indexes_cnt, time_t verify_time,
+	X509_BULK_VERIFY_ITEM *items, size_t items_cnt, int nthreads)
+{
+	if (x509_bulk_verify(store, crl_indexes, crl_indexes_cnt, verify_time, items, items_cnt, nthreads) != 1) {
+		error_print();
+		return -1;
+	}
+	return 1;
+}
+#endif
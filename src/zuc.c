@@ -14,6 +14,12 @@
 #include <gmssl/mem.h>
 #include <gmssl/endian.h>
 
+#if defined(ENABLE_ZUC_PCLMUL)
+#include <wmmintrin.h>
+#elif defined(ENABLE_ZUC_PMULL)
+#include <arm_neon.h>
+#endif
+
 
 static const ZUC_UINT15 KD[16] = {
 	0x44D7,0x26BC,0x626B,0x135E,0x5789,0x35E2,0x7135,0x09AF,
@@ -350,6 +356,62 @@ void zuc_encrypt(ZUC_STATE *state, const uint8_t *in, size_t inlen, uint8_t *out
 	state->R2 = R2;
 }
 
+#if defined(ENABLE_ZUC_PCLMUL) || defined(ENABLE_ZUC_PMULL)
+static uint64_t reverse_bits32(uint32_t a)
+{
+	a = ((a >> 1) & 0x55555555) | ((a & 0x55555555) << 1);
+	a = ((a >> 2) & 0x33333333) | ((a & 0x33333333) << 2);
+	a = ((a >> 4) & 0x0f0f0f0f) | ((a & 0x0f0f0f0f) << 4);
+	a = ((a >> 8) & 0x00ff00ff) | ((a & 0x00ff00ff) << 8);
+	return (a >> 16) | (a << 16);
+}
+#endif
+
+/*
+ * T = XOR of ((K0||K1) << i) >> 32 for each bit i (from MSB) of M set, which is
+ * bits 32..63 of the carry-less product of K0||K1 and the bit-reversed M.
+ */
+ZUC_UINT32 zuc_eia_word(ZUC_UINT32 K0, ZUC_UINT32 K1, ZUC_UINT32 M)
+{
+	uint64_t W = ((uint64_t)K0 << 32) | K1;
+
+#if defined(ENABLE_ZUC_PCLMUL)
+	__m128i a = _mm_cvtsi64_si128((long long)W);
+	__m128i b = _mm_cvtsi64_si128((long long)reverse_bits32(M));
+	return (ZUC_UINT32)((uint64_t)_mm_cvtsi128_si64(_mm_clmulepi64_si128(a, b, 0x00)) >> 32);
+#elif defined(ENABLE_ZUC_PMULL)
+	poly128_t r = vmull_p64((poly64_t)W, (poly64_t)reverse_bits32(M));
+	return (ZUC_UINT32)(vgetq_lane_u64(vreinterpretq_u64_p128(r), 0) >> 32);
+#else
+	// H[n] = XOR of W << i for each bit i (from MSB) of the 4-bit n set
+	uint64_t H[16];
+	ZUC_UINT32 T = 0;
+	int i;
+
+	H[0] = 0;
+	H[8] = W;
+	H[4] = W << 1;
+	H[2] = W << 2;
+	H[1] = W << 3;
+	H[12] = H[8] ^ H[4];
+	H[10] = H[8] ^ H[2];
+	H[9] = H[8] ^ H[1];
+	H[6] = H[4] ^ H[2];
+	H[5] = H[4] ^ H[1];
+	H[3] = H[2] ^ H[1];
+	H[14] = H[12] ^ H[2];
+	H[13] = H[12] ^ H[1];
+	H[11] = H[10] ^ H[1];
+	H[7] = H[6] ^ H[1];
+	H[15] = H[14] ^ H[1];
+
+	for (i = 0; i < 32; i += 4) {
+		T ^= (ZUC_UINT32)((H[(M >> (28 - i)) & 0xf] << i) >> 32);
+	}
+	return T;
+#endif
+}
+
 void zuc_mac_init(ZUC_MAC_CTX *ctx, const uint8_t key[16], const uint8_t iv[16])
 {
 	memset(ctx, 0, sizeof(*ctx));
@@ -367,7 +429,6 @@ void zuc_mac_update(ZUC_MAC_CTX *ctx, const uint8_t *data, size_t len)
 	ZUC_UINT32 R2 = ctx->R2;
 	ZUC_UINT32 X0, X1, X2, X3;
 	ZUC_UINT32 W1, W2, U, V;
-	size_t i;
 
 	if (!data || !len) {
 		return;
@@ -389,14 +450,8 @@ void zuc_mac_update(ZUC_MAC_CTX *ctx, const uint8_t *data, size_t len)
 		K1 = X3 ^ F(X0, X1, X2);
 		LFSRWithWorkMode();
 
-		for (i = 0; i < 32; i++) {
-			if (M & 0x80000000) {
-				T ^= K0;
-			}
-			M <<= 1;
-			K0 = (K0 << 1) | (K1 >> 31);
-			K1 <<= 1;
-		}
+		T ^= zuc_eia_word(K0, K1, M);
+		K0 = K1;
 
 		data += num;
 		len -= num;
@@ -409,14 +464,8 @@ void zuc_mac_update(ZUC_MAC_CTX *ctx, const uint8_t *data, size_t len)
 		K1 = X3 ^ F(X0, X1, X2);
 		LFSRWithWorkMode();
 
-		for (i = 0; i < 32; i++) {
-			if (M & 0x80000000) {
-				T ^= K0;
-			}
-			M <<= 1;
-			K0 = (K0 << 1) | (K1 >> 31);
-			K1 <<= 1;
-		}
+		T ^= zuc_eia_word(K0, K1, M);
+		K0 = K1;
 
 		data += 4;
 		len -= 4;
@@ -442,7 +491,6 @@ void zuc_mac_finish(ZUC_MAC_CTX *ctx, const uint8_t *data, size_t nbits, uint8_t
 	ZUC_UINT32 R2;
 	ZUC_UINT32 X0, X1, X2, X3;
 	ZUC_UINT32 W1, W2, U, V;
-	size_t i;
 
 	if (!data)
 		nbits = 0;
@@ -462,19 +510,15 @@ void zuc_mac_finish(ZUC_MAC_CTX *ctx, const uint8_t *data, size_t nbits, uint8_t
 		ctx->buf[ctx->buflen] = *data;
 
 	if (ctx->buflen || nbits) {
-		M = GETU32(ctx->buf);
+		size_t n = ctx->buflen * 8 + nbits;
+
+		M = GETU32(ctx->buf) & ~(0xffffffff >> n);
 		BitReconstruction4(X0, X1, X2, X3);
 		K1 = X3 ^ F(X0, X1, X2);
 		LFSRWithWorkMode();
 
-		for (i = 0; i < ctx->buflen * 8 + nbits; i++) {
-			if (M & 0x80000000) {
-				T ^= K0;
-			}
-			M <<= 1;
-			K0 = (K0 << 1) | (K1 >> 31);
-			K1 <<= 1;
-		}
+		T ^= zuc_eia_word(K0, K1, M);
+		K0 = (K0 << n) | (K1 >> (32 - n));
 	}
 
 	T ^= K0;
@@ -593,11 +637,25 @@ void zuc256_mac_init(ZUC256_MAC_CTX *ctx, const uint8_t key[32],
 	ctx->macbits = (macbits/32) * 32;
 }
 
+// T[j] ^= window j of the keystream K0[0..n-1]||K1 for M, then shift the window by nbits
+static void zuc256_mac_word(ZUC_UINT32 *T, ZUC_UINT32 *K0, size_t n,
+	ZUC_UINT32 K1, ZUC_UINT32 M, size_t nbits)
+{
+	size_t j;
+
+	for (j = 0; j < n; j++) {
+		T[j] ^= zuc_eia_word(K0[j], j + 1 < n ? K0[j + 1] : K1, M);
+	}
+	for (j = 0; j < n; j++) {
+		ZUC_UINT32 next = j + 1 < n ? K0[j + 1] : K1;
+		K0[j] = nbits < 32 ? (K0[j] << nbits) | (next >> (32 - nbits)) : next;
+	}
+}
+
 void zuc256_mac_update(ZUC256_MAC_CTX *ctx, const uint8_t *data, size_t len)
 {
 	ZUC_UINT32 K1, M;
 	size_t n = ctx->macbits / 32;
-	size_t i, j;
 
 	if (!data || !len) {
 		return;
@@ -617,19 +675,7 @@ void zuc256_mac_update(ZUC256_MAC_CTX *ctx, const uint8_t *data, size_t len)
 
 		K1 = zuc256_generate_keyword((ZUC256_STATE *)ctx);
 
-		for (i = 0; i < 32; i++) {
-			if (M & 0x80000000) {
-				for (j = 0; j < n; j++) {
-					ctx->T[j] ^= ctx->K0[j];
-				}
-			}
-			M <<= 1;
-			for (j = 0; j < n - 1; j++) {
-				ctx->K0[j] = (ctx->K0[j] << 1) | (ctx->K0[j + 1] >> 31);
-			}
-			ctx->K0[j] = (ctx->K0[j] << 1) | (K1 >> 31);
-			K1 <<= 1;
-		}
+		zuc256_mac_word(ctx->T, ctx->K0, n, K1, M, 32);
 
 		data += num;
 		len -= num;
@@ -639,19 +685,7 @@ void zuc256_mac_update(ZUC256_MAC_CTX *ctx, const uint8_t *data, size_t len)
 		M = GETU32(data);
 		K1 = zuc256_generate_keyword((ZUC256_STATE *)ctx);
 
-		for (i = 0; i < 32; i++) {
-			if (M & 0x80000000) {
-				for (j = 0; j < n; j++) {
-					ctx->T[j] ^= ctx->K0[j];
-				}
-			}
-			M <<= 1;
-			for (j = 0; j < n - 1; j++) {
-				ctx->K0[j] = (ctx->K0[j] << 1) | (ctx->K0[j + 1] >> 31);
-			}
-			ctx->K0[j] = (ctx->K0[j] << 1) | (K1 >> 31);
-			K1 <<= 1;
-		}
+		zuc256_mac_word(ctx->T, ctx->K0, n, K1, M, 32);
 
 		data += 4;
 		len -= 4;
@@ -667,7 +701,7 @@ void zuc256_mac_finish(ZUC256_MAC_CTX *ctx, const uint8_t *data, size_t nbits, u
 {
 	ZUC_UINT32 K1, M;
 	size_t n = ctx->macbits/32;
-	size_t i, j;
+	size_t j;
 
 
 	if (!data)
@@ -683,23 +717,11 @@ void zuc256_mac_finish(ZUC256_MAC_CTX *ctx, const uint8_t *data, size_t nbits, u
 		ctx->buf[ctx->buflen] = *data;
 
 	if (ctx->buflen || nbits) {
-		M = GETU32(ctx->buf);
-		K1 = zuc256_generate_keyword((ZUC256_STATE *)ctx);
+		size_t nbits_left = ctx->buflen * 8 + nbits;
 
-
-		for (i = 0; i < ctx->buflen * 8 + nbits; i++) {
-			if (M & 0x80000000) {
-				for (j = 0; j < n; j++) {
-					ctx->T[j] ^= ctx->K0[j];
-				}
-			}
-			M <<= 1;
-			for (j = 0; j < n - 1; j++) {
-				ctx->K0[j] = (ctx->K0[j] << 1) | (ctx->K0[j + 1] >> 31);
-			}
-			ctx->K0[j] = (ctx->K0[j] << 1) | (K1 >> 31);
-			K1 <<= 1;
-		}
+		M = GETU32(ctx->buf) & ~(0xffffffff >> nbits_left);
+		K1 = zuc256_generate_keyword((ZUC256_STATE *)ctx);
+		zuc256_mac_word(ctx->T, ctx->K0, n, K1, M, nbits_left);
 	}
 
 	for (j = 0; j < n; j++) {
@@ -13,19 +13,27 @@
 #include <string.h>
 #include <stdlib.h>
 #include <gmssl/zuc.h>
+#include <gmssl/mem.h>
 #include <gmssl/error.h>
 #include <gmssl/endian.h>
 
 
-static void zuc_set_eea_key(ZUC_STATE *key, const uint8_t user_key[16],
-	ZUC_UINT32 count, ZUC_UINT5 bearer, ZUC_BIT direction)
+static void zuc_set_eea_iv(uint8_t iv[16], ZUC_UINT32 count, ZUC_UINT5 bearer,
+	ZUC_BIT direction)
 {
-	uint8_t iv[16] = {0};
+	memset(iv, 0, 16);
 	iv[0] = iv[8] = count >> 24;
 	iv[1] = iv[9] = count >> 16;
 	iv[2] = iv[10] = count >> 8;
 	iv[3] = iv[11] = count;
 	iv[4] = iv[12] = ((bearer << 1) | (direction & 1)) << 2;
+}
+
+static void zuc_set_eea_key(ZUC_STATE *key, const uint8_t user_key[16],
+	ZUC_UINT32 count, ZUC_UINT5 bearer, ZUC_BIT direction)
+{
+	uint8_t iv[16];
+	zuc_set_eea_iv(iv, count, bearer, direction);
 	zuc_init(key, user_key, iv);
 }
 
@@ -74,6 +82,248 @@ ZUC_UINT32 zuc_eia_generate_mac(const ZUC_UINT32 *data, size_t nbits,
 	return GETU32(mac);
 }
 
+static ZUC_UINT32 zuc_eea_eia(const ZUC_UINT32 *in, ZUC_UINT32 *out, size_t nbits,
+	const uint8_t eea_key[16], const uint8_t eia_key[16],
+	ZUC_UINT32 count, ZUC_UINT5 bearer, ZUC_BIT direction, int enc)
+{
+	ZUC_STATE eea_state;
+	ZUC_STATE eia_state;
+	ZUC_UINT32 Z[16];
+	ZUC_UINT32 K[17];
+	uint8_t iv[16];
+	size_t nwords = ZUC_EEA_ENCRYPT_NWORDS(nbits);
+	size_t s = nbits % 32;
+	ZUC_UINT32 T = 0;
+	size_t i;
+
+	zuc_set_eea_key(&eea_state, eea_key, count, bearer, direction);
+	zuc_set_eia_iv(iv, count, bearer, direction);
+	zuc_init(&eia_state, eia_key, iv);
+	K[0] = zuc_generate_keyword(&eia_state);
+
+	while (nwords) {
+		size_t n = nwords < 16 ? nwords : 16;
+
+		zuc_generate_keystream(&eea_state, n, Z);
+		zuc_generate_keystream(&eia_state, n, K + 1);
+
+		for (i = 0; i < n; i++) {
+			ZUC_UINT32 P = in[i];
+			ZUC_UINT32 C = P ^ Z[i];
+			ZUC_UINT32 M;
+
+			if (s && nwords == n && i == n - 1) {
+				C &= 0xffffffff << (32 - s);
+			}
+			out[i] = C;
+			if (!enc) {
+				P = C;
+			}
+			M = GETU32((uint8_t *)&P);
+
+			if (s && nwords == n && i == n - 1) {
+				M &= 0xffffffff << (32 - s);
+				T ^= zuc_eia_word(K[i], K[i + 1], M);
+				T ^= (K[i] << s) | (K[i + 1] >> (32 - s));
+			} else {
+				T ^= zuc_eia_word(K[i], K[i + 1], M);
+			}
+		}
+		K[0] = K[n];
+		in += n;
+		out += n;
+		nwords -= n;
+	}
+
+	if (!s) {
+		T ^= K[0];
+	}
+	T ^= zuc_generate_keyword(&eia_state);
+
+	gmssl_secure_clear(&eea_state, sizeof(eea_state));
+	gmssl_secure_clear(&eia_state, sizeof(eia_state));
+	gmssl_secure_clear(Z, sizeof(Z));
+	gmssl_secure_clear(K, sizeof(K));
+	return T;
+}
+
+ZUC_UINT32 zuc_eea_eia_encrypt(const ZUC_UINT32 *in, ZUC_UINT32 *out, size_t nbits,
+	const uint8_t eea_key[16], const uint8_t eia_key[16],
+	ZUC_UINT32 count, ZUC_UINT5 bearer, ZUC_BIT direction)
+{
+	return zuc_eea_eia(in, out, nbits, eea_key, eia_key, count, bearer, direction, 1);
+}
+
+ZUC_UINT32 zuc_eea_eia_decrypt(const ZUC_UINT32 *in, ZUC_UINT32 *out, size_t nbits,
+	const uint8_t eea_key[16], const uint8_t eia_key[16],
+	ZUC_UINT32 count, ZUC_UINT5 bearer, ZUC_BIT direction)
+{
+	return zuc_eea_eia(in, out, nbits, eea_key, eia_key, count, bearer, direction, 0);
+}
+
+typedef struct {
+	ZUC_JOB *job;
+	size_t nwords; // keystream words required by the job
+	size_t pos; // keystream words consumed
+	ZUC_UINT32 K0; // EIA3 only, previous keystream word
+	ZUC_UINT32 T; // EIA3 only
+} ZUC_LANE;
+
+static void zuc_lane_eea_update(ZUC_LANE *lane, const ZUC_UINT32 (*words)[ZUC_X8_LANES], int j, size_t nwords)
+{
+	ZUC_JOB *job = lane->job;
+	size_t i;
+
+	for (i = 0; i < nwords; i++) {
+		job->out[lane->pos + i] = job->in[lane->pos + i] ^ words[i][j];
+	}
+	lane->pos += nwords;
+
+	if (lane->pos == lane->nwords && job->nbits % 32) {
+		job->out[lane->pos - 1] &= 0xffffffff << (32 - job->nbits % 32);
+	}
+}
+
+// same as zuc_mac_finish(), keystream word `pos` is consumed with message word `pos - 1`
+static void zuc_lane_eia_update(ZUC_LANE *lane, const ZUC_UINT32 (*words)[ZUC_X8_LANES], int j, size_t nwords)
+{
+	ZUC_JOB *job = lane->job;
+	const uint8_t *data = (const uint8_t *)job->in;
+	size_t mwords = ZUC_EEA_ENCRYPT_NWORDS(job->nbits);
+	size_t i;
+
+	for (i = 0; i < nwords; i++, lane->pos++) {
+		ZUC_UINT32 K1 = words[i][j];
+
+		if (lane->pos) {
+			size_t m = lane->pos - 1;
+
+			if (m < mwords) {
+				size_t nbits = job->nbits - 32 * m;
+				ZUC_UINT32 M;
+
+				if (nbits >= 32) {
+					M = GETU32(data + 4 * m);
+				} else {
+					uint8_t buf[4] = {0};
+					memcpy(buf, data + 4 * m, (nbits + 7) / 8);
+					M = GETU32(buf) & ~(0xffffffff >> nbits);
+				}
+				lane->T ^= zuc_eia_word(lane->K0, K1, M);
+			}
+			if (m == job->nbits / 32) {
+				size_t s = job->nbits % 32;
+				lane->T ^= s ? (lane->K0 << s) | (K1 >> (32 - s)) : lane->K0;
+			}
+			if (m == mwords) {
+				job->mac = lane->T ^ K1;
+			}
+		}
+		lane->K0 = K1;
+	}
+}
+
+int zuc_process_jobs(ZUC_JOB *jobs, size_t njobs)
+{
+	ZUC_X8_STATE state;
+	ZUC_LANE lanes[ZUC_X8_LANES];
+	ZUC_UINT32 words[16][ZUC_X8_LANES];
+	const uint8_t *keys[ZUC_X8_LANES];
+	const uint8_t *ivs[ZUC_X8_LANES];
+	uint8_t iv[ZUC_X8_LANES][ZUC_IV_SIZE];
+	size_t next = 0;
+	size_t i;
+	int j;
+
+	if (!jobs && njobs) {
+		error_print();
+		return -1;
+	}
+	for (i = 0; i < njobs; i++) {
+		if (jobs[i].type != ZUC_JOB_EEA3 && jobs[i].type != ZUC_JOB_EIA3) {
+			error_print();
+			return -1;
+		}
+	}
+
+	memset(&state, 0, sizeof(state));
+	memset(lanes, 0, sizeof(lanes));
+
+	for (;;) {
+		unsigned int init_lanes = 0;
+		size_t nwords = sizeof(words)/sizeof(words[0]);
+		int nactive = 0;
+
+		// refill idle lanes
+		for (j = 0; j < ZUC_X8_LANES; j++) {
+			ZUC_JOB *job;
+
+			if (lanes[j].job) {
+				continue;
+			}
+			// EEA3 of empty message has no output
+			while (next < njobs && jobs[next].type == ZUC_JOB_EEA3 && !jobs[next].nbits) {
+				next++;
+			}
+			if (next >= njobs) {
+				break;
+			}
+			job = &jobs[next++];
+
+			if (job->type == ZUC_JOB_EEA3) {
+				zuc_set_eea_iv(iv[j], job->count, job->bearer, job->direction);
+				lanes[j].nwords = ZUC_EEA_ENCRYPT_NWORDS(job->nbits);
+			} else {
+				zuc_set_eia_iv(iv[j], job->count, job->bearer, job->direction);
+				lanes[j].nwords = ZUC_EEA_ENCRYPT_NWORDS(job->nbits) + 2;
+			}
+			lanes[j].job = job;
+			lanes[j].pos = 0;
+			lanes[j].T = 0;
+			keys[j] = job->key;
+			ivs[j] = iv[j];
+			init_lanes |= 1 << j;
+		}
+		if (init_lanes) {
+			zuc_x8_init(&state, init_lanes, keys, ivs);
+		}
+
+		// run all lanes until the shortest job is finished
+		for (j = 0; j < ZUC_X8_LANES; j++) {
+			if (lanes[j].job) {
+				nactive++;
+				if (lanes[j].nwords - lanes[j].pos < nwords) {
+					nwords = lanes[j].nwords - lanes[j].pos;
+				}
+			}
+		}
+		if (!nactive) {
+			break;
+		}
+
+		zuc_x8_generate_keystream(&state, nwords, words);
+
+		for (j = 0; j < ZUC_X8_LANES; j++) {
+			if (!lanes[j].job) {
+				continue;
+			}
+			if (lanes[j].job->type == ZUC_JOB_EEA3) {
+				zuc_lane_eea_update(&lanes[j], words, j, nwords);
+			} else {
+				zuc_lane_eia_update(&lanes[j], words, j, nwords);
+			}
+			if (lanes[j].pos == lanes[j].nwords) {
+				lanes[j].job = NULL;
+			}
+		}
+	}
+
+	gmssl_secure_clear(&state, sizeof(state));
+	gmssl_secure_clear(lanes, sizeof(lanes));
+	gmssl_secure_clear(words, sizeof(words));
+	return 1;
+}
+
 #define ZUC_BLOCK_SIZE 4
 
 int zuc_encrypt_init(ZUC_CTX *ctx, const uint8_t key[ZUC_KEY_SIZE], const uint8_t iv[ZUC_IV_SIZE])
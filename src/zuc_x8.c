@@ -0,0 +1,357 @@
+/*
+ *  Copyright 2014-2024 The GmSSL Project. All Rights Reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the License); you may
+ *  not use this file except in compliance with the License.
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+
+#include <string.h>
+#include <gmssl/zuc.h>
+#include <gmssl/mem.h>
+
+
+#ifdef ENABLE_ZUC_AVX2
+#include <immintrin.h>
+
+
+static const ZUC_UINT15 KD[16] = {
+	0x44D7,0x26BC,0x626B,0x135E,0x5789,0x35E2,0x7135,0x09AF,
+	0x4D78,0x2F13,0x6BC4,0x1AF1,0x5E26,0x3C4D,0x789A,0x47AC,
+};
+
+// S0, S1 of zuc.c, widen to 32-bit for _mm256_i32gather_epi32
+static const int S0_32[256] = {
+	0x3e,0x72,0x5b,0x47,0xca,0xe0,0x00,0x33,
+	0x04,0xd1,0x54,0x98,0x09,0xb9,0x6d,0xcb,
+	0x7b,0x1b,0xf9,0x32,0xaf,0x9d,0x6a,0xa5,
+	0xb8,0x2d,0xfc,0x1d,0x08,0x53,0x03,0x90,
+	0x4d,0x4e,0x84,0x99,0xe4,0xce,0xd9,0x91,
+	0xdd,0xb6,0x85,0x48,0x8b,0x29,0x6e,0xac,
+	0xcd,0xc1,0xf8,0x1e,0x73,0x43,0x69,0xc6,
+	0xb5,0xbd,0xfd,0x39,0x63,0x20,0xd4,0x38,
+	0x76,0x7d,0xb2,0xa7,0xcf,0xed,0x57,0xc5,
+	0xf3,0x2c,0xbb,0x14,0x21,0x06,0x55,0x9b,
+	0xe3,0xef,0x5e,0x31,0x4f,0x7f,0x5a,0xa4,
+	0x0d,0x82,0x51,0x49,0x5f,0xba,0x58,0x1c,
+	0x4a,0x16,0xd5,0x17,0xa8,0x92,0x24,0x1f,
+	0x8c,0xff,0xd8,0xae,0x2e,0x01,0xd3,0xad,
+	0x3b,0x4b,0xda,0x46,0xeb,0xc9,0xde,0x9a,
+	0x8f,0x87,0xd7,0x3a,0x80,0x6f,0x2f,0xc8,
+	0xb1,0xb4,0x37,0xf7,0x0a,0x22,0x13,0x28,
+	0x7c,0xcc,0x3c,0x89,0xc7,0xc3,0x96,0x56,
+	0x07,0xbf,0x7e,0xf0,0x0b,0x2b,0x97,0x52,
+	0x35,0x41,0x79,0x61,0xa6,0x4c,0x10,0xfe,
+	0xbc,0x26,0x95,0x88,0x8a,0xb0,0xa3,0xfb,
+	0xc0,0x18,0x94,0xf2,0xe1,0xe5,0xe9,0x5d,
+	0xd0,0xdc,0x11,0x66,0x64,0x5c,0xec,0x59,
+	0x42,0x75,0x12,0xf5,0x74,0x9c,0xaa,0x23,
+	0x0e,0x86,0xab,0xbe,0x2a,0x02,0xe7,0x67,
+	0xe6,0x44,0xa2,0x6c,0xc2,0x93,0x9f,0xf1,
+	0xf6,0xfa,0x36,0xd2,0x50,0x68,0x9e,0x62,
+	0x71,0x15,0x3d,0xd6,0x40,0xc4,0xe2,0x0f,
+	0x8e,0x83,0x77,0x6b,0x25,0x05,0x3f,0x0c,
+	0x30,0xea,0x70,0xb7,0xa1,0xe8,0xa9,0x65,
+	0x8d,0x27,0x1a,0xdb,0x81,0xb3,0xa0,0xf4,
+	0x45,0x7a,0x19,0xdf,0xee,0x78,0x34,0x60,
+};
+
+static const int S1_32[256] = {
+	0x55,0xc2,0x63,0x71,0x3b,0xc8,0x47,0x86,
+	0x9f,0x3c,0xda,0x5b,0x29,0xaa,0xfd,0x77,
+	0x8c,0xc5,0x94,0x0c,0xa6,0x1a,0x13,0x00,
+	0xe3,0xa8,0x16,0x72,0x40,0xf9,0xf8,0x42,
+	0x44,0x26,0x68,0x96,0x81,0xd9,0x45,0x3e,
+	0x10,0x76,0xc6,0xa7,0x8b,0x39,0x43,0xe1,
+	0x3a,0xb5,0x56,0x2a,0xc0,0x6d,0xb3,0x05,
+	0x22,0x66,0xbf,0xdc,0x0b,0xfa,0x62,0x48,
+	0xdd,0x20,0x11,0x06,0x36,0xc9,0xc1,0xcf,
+	0xf6,0x27,0x52,0xbb,0x69,0xf5,0xd4,0x87,
+	0x7f,0x84,0x4c,0xd2,0x9c,0x57,0xa4,0xbc,
+	0x4f,0x9a,0xdf,0xfe,0xd6,0x8d,0x7a,0xeb,
+	0x2b,0x53,0xd8,0x5c,0xa1,0x14,0x17,0xfb,
+	0x23,0xd5,0x7d,0x30,0x67,0x73,0x08,0x09,
+	0xee,0xb7,0x70,0x3f,0x61,0xb2,0x19,0x8e,
+	0x4e,0xe5,0x4b,0x93,0x8f,0x5d,0xdb,0xa9,
+	0xad,0xf1,0xae,0x2e,0xcb,0x0d,0xfc,0xf4,
+	0x2d,0x46,0x6e,0x1d,0x97,0xe8,0xd1,0xe9,
+	0x4d,0x37,0xa5,0x75,0x5e,0x83,0x9e,0xab,
+	0x82,0x9d,0xb9,0x1c,0xe0,0xcd,0x49,0x89,
+	0x01,0xb6,0xbd,0x58,0x24,0xa2,0x5f,0x38,
+	0x78,0x99,0x15,0x90,0x50,0xb8,0x95,0xe4,
+	0xd0,0x91,0xc7,0xce,0xed,0x0f,0xb4,0x6f,
+	0xa0,0xcc,0xf0,0x02,0x4a,0x79,0xc3,0xde,
+	0xa3,0xef,0xea,0x51,0xe6,0x6b,0x18,0xec,
+	0x1b,0x2c,0x80,0xf7,0x74,0xe7,0xff,0x21,
+	0x5a,0x6a,0x54,0x1e,0x41,0x31,0x92,0x35,
+	0xc4,0x33,0x07,0x0a,0xba,0x7e,0x0e,0x34,
+	0x88,0xb1,0x98,0x7c,0xf3,0x3d,0x60,0x6c,
+	0x7b,0xca,0xd3,0x1f,0x32,0x65,0x04,0x28,
+	0x64,0xbe,0x85,0x9b,0x2f,0x59,0x8a,0xd7,
+	0xb0,0x25,0xac,0xaf,0x12,0x03,0xe2,0xf2,
+};
+
+
+#define MAKEU31(k,d,iv) 				\
+	(((uint32_t)(k) << 23) |			\
+	 ((uint32_t)(d) <<  8) |			\
+	  (uint32_t)(iv))
+
+#define _mm256_rotl_epi32(a, i)						\
+	_mm256_or_si256(_mm256_slli_epi32(a, i), _mm256_srli_epi32(a, 32 - (i)))
+
+#define L1(X)								\
+	_mm256_xor_si256(_mm256_xor_si256(_mm256_xor_si256(		\
+	_mm256_xor_si256((X),						\
+	_mm256_rotl_epi32((X),  2)),					\
+	_mm256_rotl_epi32((X), 10)),					\
+	_mm256_rotl_epi32((X), 18)),					\
+	_mm256_rotl_epi32((X), 24))
+
+#define L2(X)								\
+	_mm256_xor_si256(_mm256_xor_si256(_mm256_xor_si256(		\
+	_mm256_xor_si256((X),						\
+	_mm256_rotl_epi32((X),  8)),					\
+	_mm256_rotl_epi32((X), 14)),					\
+	_mm256_rotl_epi32((X), 22)),					\
+	_mm256_rotl_epi32((X), 30))
+
+// a = (a + b) mod (2^31 - 1)
+#define ADD31(a, b)							\
+	a = _mm256_add_epi32(a, b);					\
+	a = _mm256_add_epi32(_mm256_and_si256(a, mask31), _mm256_srli_epi32(a, 31))
+
+#define ROT31(a, k)							\
+	_mm256_and_si256(_mm256_or_si256(_mm256_slli_epi32(a, k),	\
+		_mm256_srli_epi32(a, 31 - (k))), mask31)
+
+// LFSR cells are kept in a ring buffer, LFSR(0) is the oldest cell
+#define LFSR(i)	S[(t + (i)) & 15]
+
+#define BitReconstruction2(X1, X2)					\
+	X1 = _mm256_or_si256(_mm256_slli_epi32(LFSR(11), 16),		\
+		_mm256_srli_epi32(LFSR(9), 15));			\
+	X2 = _mm256_or_si256(_mm256_slli_epi32(LFSR(7), 16),		\
+		_mm256_srli_epi32(LFSR(5), 15))
+
+#define BitReconstruction3(X0, X1, X2)					\
+	X0 = _mm256_or_si256(						\
+		_mm256_slli_epi32(_mm256_and_si256(LFSR(15), mask_hi), 1),\
+		_mm256_and_si256(LFSR(14), mask_lo));			\
+	BitReconstruction2(X1, X2)
+
+#define BitReconstruction4(X0, X1, X2, X3)				\
+	BitReconstruction3(X0, X1, X2);					\
+	X3 = _mm256_or_si256(_mm256_slli_epi32(LFSR(2), 16),		\
+		_mm256_srli_epi32(LFSR(0), 15))
+
+// (X0 ^ R1) + R2, then update R1, R2
+#define F(W, X0, X1, X2)						\
+	W = _mm256_add_epi32(_mm256_xor_si256(X0, R1), R2);		\
+	F_(X1, X2)
+
+#define F_(X1, X2)							\
+	W1 = _mm256_add_epi32(R1, X1);					\
+	W2 = _mm256_xor_si256(R2, X2);					\
+	U = L1(_mm256_or_si256(_mm256_slli_epi32(W1, 16), _mm256_srli_epi32(W2, 16))); \
+	V = L2(_mm256_or_si256(_mm256_slli_epi32(W2, 16), _mm256_srli_epi32(W1, 16))); \
+	R1 = zuc_x8_sbox(U);						\
+	R2 = zuc_x8_sbox(V)
+
+#define LFSRWithWorkMode()						\
+	V = LFSR(0);							\
+	ADD31(V, ROT31(LFSR( 0),  8));					\
+	ADD31(V, ROT31(LFSR( 4), 20));					\
+	ADD31(V, ROT31(LFSR(10), 21));					\
+	ADD31(V, ROT31(LFSR(13), 17));					\
+	ADD31(V, ROT31(LFSR(15), 15));					\
+	LFSR(0) = V;							\
+	t++
+
+#define LFSRWithInitialisationMode(u)					\
+	V = LFSR(0);							\
+	ADD31(V, ROT31(LFSR( 0),  8));					\
+	ADD31(V, ROT31(LFSR( 4), 20));					\
+	ADD31(V, ROT31(LFSR(10), 21));					\
+	ADD31(V, ROT31(LFSR(13), 17));					\
+	ADD31(V, ROT31(LFSR(15), 15));					\
+	ADD31(V, (u));							\
+	LFSR(0) = V;							\
+	t++
+
+static inline __m256i zuc_x8_sbox(__m256i x)
+{
+	__m256i mask = _mm256_set1_epi32(0xff);
+	__m256i t0, t1, t2, t3;
+
+	t0 = _mm256_i32gather_epi32(S0_32, _mm256_srli_epi32(x, 24), 4);
+	t1 = _mm256_i32gather_epi32(S1_32, _mm256_and_si256(_mm256_srli_epi32(x, 16), mask), 4);
+	t2 = _mm256_i32gather_epi32(S0_32, _mm256_and_si256(_mm256_srli_epi32(x, 8), mask), 4);
+	t3 = _mm256_i32gather_epi32(S1_32, _mm256_and_si256(x, mask), 4);
+
+	t0 = _mm256_or_si256(_mm256_slli_epi32(t0, 24), _mm256_slli_epi32(t1, 16));
+	t2 = _mm256_or_si256(_mm256_slli_epi32(t2, 8), t3);
+	return _mm256_or_si256(t0, t2);
+}
+
+void zuc_x8_init(ZUC_X8_STATE *state, unsigned int lanes,
+	const uint8_t *key[ZUC_X8_LANES], const uint8_t *iv[ZUC_X8_LANES])
+{
+	__m256i mask31 = _mm256_set1_epi32(0x7fffffff);
+	__m256i mask_hi = _mm256_set1_epi32(0x7fff8000);
+	__m256i mask_lo = _mm256_set1_epi32(0xffff);
+	__m256i S[16];
+	__m256i R1, R2;
+	__m256i X0, X1, X2;
+	__m256i W, W1, W2, U, V;
+	ZUC_X8_STATE init;
+	unsigned int t = 0;
+	int i, j;
+
+	lanes &= (1 << ZUC_X8_LANES) - 1;
+	if (!lanes) {
+		return;
+	}
+
+	memcpy(&init, state, sizeof(init));
+	for (j = 0; j < ZUC_X8_LANES; j++) {
+		if (lanes & (1 << j)) {
+			for (i = 0; i < 16; i++) {
+				init.LFSR[i][j] = MAKEU31(key[j][i], KD[i], iv[j][i]);
+			}
+		}
+	}
+
+	for (i = 0; i < 16; i++) {
+		S[i] = _mm256_loadu_si256((__m256i *)init.LFSR[i]);
+	}
+	R1 = _mm256_setzero_si256();
+	R2 = _mm256_setzero_si256();
+
+	for (i = 0; i < 32; i++) {
+		BitReconstruction3(X0, X1, X2);
+		F(W, X0, X1, X2);
+		LFSRWithInitialisationMode(_mm256_srli_epi32(W, 1));
+	}
+
+	BitReconstruction2(X1, X2);
+	F_(X1, X2);
+	LFSRWithWorkMode();
+
+	for (i = 0; i < 16; i++) {
+		_mm256_storeu_si256((__m256i *)init.LFSR[i], LFSR(i));
+	}
+	_mm256_storeu_si256((__m256i *)init.R1, R1);
+	_mm256_storeu_si256((__m256i *)init.R2, R2);
+
+	for (j = 0; j < ZUC_X8_LANES; j++) {
+		if (lanes & (1 << j)) {
+			for (i = 0; i < 16; i++) {
+				state->LFSR[i][j] = init.LFSR[i][j];
+			}
+			state->R1[j] = init.R1[j];
+			state->R2[j] = init.R2[j];
+		}
+	}
+	gmssl_secure_clear(&init, sizeof(init));
+}
+
+void zuc_x8_generate_keystream(ZUC_X8_STATE *state, size_t nwords, ZUC_UINT32 (*words)[ZUC_X8_LANES])
+{
+	__m256i mask31 = _mm256_set1_epi32(0x7fffffff);
+	__m256i mask_hi = _mm256_set1_epi32(0x7fff8000);
+	__m256i mask_lo = _mm256_set1_epi32(0xffff);
+	__m256i S[16];
+	__m256i R1, R2;
+	__m256i X0, X1, X2, X3;
+	__m256i W, W1, W2, U, V;
+	unsigned int t = 0;
+	size_t i;
+
+	for (i = 0; i < 16; i++) {
+		S[i] = _mm256_loadu_si256((__m256i *)state->LFSR[i]);
+	}
+	R1 = _mm256_loadu_si256((__m256i *)state->R1);
+	R2 = _mm256_loadu_si256((__m256i *)state->R2);
+
+	for (i = 0; i < nwords; i++) {
+		BitReconstruction4(X0, X1, X2, X3);
+		F(W, X0, X1, X2);
+		_mm256_storeu_si256((__m256i *)words[i], _mm256_xor_si256(X3, W));
+		LFSRWithWorkMode();
+	}
+
+	for (i = 0; i < 16; i++) {
+		_mm256_storeu_si256((__m256i *)state->LFSR[i], LFSR(i));
+	}
+	_mm256_storeu_si256((__m256i *)state->R1, R1);
+	_mm256_storeu_si256((__m256i *)state->R2, R2);
+}
+
+#else
+
+static void zuc_x8_get_lane(const ZUC_X8_STATE *state, int j, ZUC_STATE *lane)
+{
+	int i;
+	for (i = 0; i < 16; i++) {
+		lane->LFSR[i] = state->LFSR[i][j];
+	}
+	lane->R1 = state->R1[j];
+	lane->R2 = state->R2[j];
+}
+
+static void zuc_x8_set_lane(ZUC_X8_STATE *state, int j, const ZUC_STATE *lane)
+{
+	int i;
+	for (i = 0; i < 16; i++) {
+		state->LFSR[i][j] = lane->LFSR[i];
+	}
+	state->R1[j] = lane->R1;
+	state->R2[j] = lane->R2;
+}
+
+void zuc_x8_init(ZUC_X8_STATE *state, unsigned int lanes,
+	const uint8_t *key[ZUC_X8_LANES], const uint8_t *iv[ZUC_X8_LANES])
+{
+	ZUC_STATE lane;
+	int j;
+
+	for (j = 0; j < ZUC_X8_LANES; j++) {
+		if (lanes & (1 << j)) {
+			zuc_init(&lane, key[j], iv[j]);
+			zuc_x8_set_lane(state, j, &lane);
+		}
+	}
+	gmssl_secure_clear(&lane, sizeof(lane));
+}
+
+void zuc_x8_generate_keystream(ZUC_X8_STATE *state, size_t nwords, ZUC_UINT32 (*words)[ZUC_X8_LANES])
+{
+	ZUC_STATE lane;
+	ZUC_UINT32 buf[16];
+	size_t len, i;
+	int j;
+
+	for (j = 0; j < ZUC_X8_LANES; j++) {
+		ZUC_UINT32 (*out)[ZUC_X8_LANES] = words;
+
+		zuc_x8_get_lane(state, j, &lane);
+		len = nwords;
+		while (len) {
+			size_t n = len < 16 ? len : 16;
+			zuc_generate_keystream(&lane, n, buf);
+			for (i = 0; i < n; i++) {
+				out[i][j] = buf[i];
+			}
+			out += n;
+			len -= n;
+		}
+		zuc_x8_set_lane(state, j, &lane);
+	}
+	gmssl_secure_clear(&lane, sizeof(lane));
+	gmssl_secure_clear(buf, sizeof(buf));
+}
+
+#endif
@@ -835,6 +835,67 @@ static int test_asn1_from_der_null_args(void)
 	return 1;
 }
 
+static int test_asn1_writer(void)
+{
+	size_t lens[] = { 1, 127, 128, 255, 256, 65535, 65536, 100000 };
+	ASN1_WRITER w;
+	uint8_t *buf;
+	uint8_t *p;
+	size_t len;
+	size_t outer_pos, pos;
+	size_t i;
+
+	if (!(buf = (uint8_t *)malloc(200100))) {
+		error_print();
+		return -1;
+	}
+	for (i = 0; i < sizeof(lens)/sizeof(lens[0]); i++) {
+		uint8_t *data = buf + 100100;
+		memset(data, (int)i, lens[i]);
+
+		// SEQUENCE { OCTET STRING, [0] { } }
+		p = buf;
+		len = 0;
+		asn1_header_to_der(ASN1_TAG_SEQUENCE, lens[i] + 2 + (lens[i] < 128 ? 2 : lens[i] < 256 ? 3 : lens[i] < 65536 ? 4 : 5), &p, &len);
+		asn1_octet_string_to_der(data, lens[i], &p, &len);
+		asn1_header_to_der(ASN1_TAG_EXPLICIT(0), 0, &p, &len);
+
+		if (asn1_writer_init(&w, 0) != 1
+			|| asn1_writer_begin(&w, ASN1_TAG_SEQUENCE, &outer_pos) != 1
+			|| asn1_writer_begin(&w, ASN1_TAG_OCTET_STRING, &pos) != 1
+			|| asn1_writer_reserve(&w, lens[i]) != 1
+			|| asn1_data_to_der(data, lens[i], &w.p, &w.len) != 1
+			|| asn1_writer_end(&w, pos) != 1
+			|| asn1_writer_begin(&w, ASN1_TAG_EXPLICIT(0), &pos) != 1
+			|| asn1_writer_end(&w, pos) != 1
+			|| asn1_writer_end(&w, outer_pos) != 1) {
+			asn1_writer_cleanup(&w);
+			free(buf);
+			error_print();
+			return -1;
+		}
+		if (w.len != len
+			|| w.p != w.buf + w.len
+			|| memcmp(w.buf, buf, len) != 0) {
+			asn1_writer_cleanup(&w);
+			free(buf);
+			error_print();
+			return -1;
+		}
+		asn1_writer_cleanup(&w);
+	}
+	free(buf);
+
+	// a cleaned up writer never grows
+	if (asn1_writer_reserve(&w, 1) != -1) {
+		error_print();
+		return -1;
+	}
+
+	printf("%s() ok\n", __FUNCTION__);
+	return 1;
+}
+
 int main(void)
 {
 	if (test_asn1_tag() != 1) goto err;
@@ -854,6 +915,7 @@ int main(void)
 	if (test_asn1_utc_time() != 1) goto err;
 	if (test_asn1_generalized_time() != 1) goto err;
 	if (test_asn1_from_der_null_args() != 1) goto err;
+	if (test_asn1_writer() != 1) goto err;
 	printf("%s all tests passed\n", __FILE__);
 	return 0;
 err:
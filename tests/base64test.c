@@ -61,9 +61,93 @@ static int test_base64(void)
 	return 1;
 }
 
+// full lines go through the 48/64 bytes kernels, compare with the 3 bytes path
+static int test_base64_lines(void)
+{
+	uint8_t bin[1000];
+	uint8_t enc[BASE64_ENCODE_LENGTH(1000)];
+	uint8_t ref[BASE64_ENCODE_LENGTH(1000)];
+	uint8_t dec[BASE64_DECODE_LENGTH(sizeof(enc))];
+	BASE64_CTX ctx;
+	size_t lens[] = { 0, 1, 47, 48, 49, 95, 96, 97, 144, 500, 1000 };
+	size_t chunks[] = { 1, 7, 64, 65, 1000 };
+	size_t i, j, k, off;
+	int enclen, declen, len;
+
+	for (i = 0; i < sizeof(bin); i++) {
+		bin[i] = (uint8_t)(i * 7);
+	}
+
+	for (i = 0; i < sizeof(lens)/sizeof(lens[0]); i++) {
+		uint8_t *p = ref;
+		for (off = 0; off < lens[i]; off += 48) {
+			size_t n = lens[i] - off < 48 ? lens[i] - off : 48;
+			for (k = 0; k < n; k += 3) {
+				p += base64_encode_block(p, bin + off + k, n - k < 3 ? (int)(n - k) : 3);
+			}
+			*p++ = '\n';
+		}
+
+		base64_encode_init(&ctx);
+		base64_encode_update(&ctx, bin, (int)lens[i], enc, &enclen);
+		base64_encode_finish(&ctx, enc + enclen, &len);
+		enclen += len;
+		if (enclen != (int)(p - ref) || memcmp(enc, ref, enclen) != 0) {
+			error_print();
+			return -1;
+		}
+
+		for (j = 0; j < sizeof(chunks)/sizeof(chunks[0]); j++) {
+			declen = 0;
+			base64_decode_init(&ctx);
+			for (off = 0; off < (size_t)enclen; off += chunks[j]) {
+				size_t n = enclen - off < chunks[j] ? enclen - off : chunks[j];
+				if (base64_decode_update(&ctx, enc + off, (int)n, dec + declen, &len) < 0) {
+					error_print();
+					return -1;
+				}
+				declen += len;
+			}
+			if (base64_decode_finish(&ctx, dec + declen, &len) != 1) {
+				error_print();
+				return -1;
+			}
+			declen += len;
+			if (declen != (int)lens[i] || memcmp(dec, bin, lens[i]) != 0) {
+				error_print();
+				return -1;
+			}
+		}
+	}
+
+	// invalid char in a full line
+	base64_encode_init(&ctx);
+	base64_encode_update(&ctx, bin, 96, enc, &enclen);
+	enc[10] = '*';
+	base64_decode_init(&ctx);
+	if (base64_decode_update(&ctx, enc, enclen, dec, &len) != -1) {
+		error_print();
+		return -1;
+	}
+	enc[10] = 0x80 | 'A';
+	base64_decode_init(&ctx);
+	if (base64_decode_update(&ctx, enc, enclen, dec, &len) != -1) {
+		error_print();
+		return -1;
+	}
+	if (base64_decode_block(dec, enc, 64) != -1) {
+		error_print();
+		return -1;
+	}
+
+	printf("%s() ok\n", __FUNCTION__);
+	return 1;
+}
+
 int main(void)
 {
 	if (test_base64() != 1) goto err;
+	if (test_base64_lines() != 1) goto err;
 	printf("%s all tests passed\n", __FILE__);
 	return 0;
 err:
@@ -978,6 +978,303 @@ static int test_cms_key_agreement_info(void)
 	return 1;
 }
 
+static int cms_stream_test_cert(SM2_KEY *sm2_key, uint8_t *cert, size_t *certlen)
+{
+	uint8_t serial[20];
+	uint8_t name[256];
+	size_t namelen = 0;
+	time_t not_before, not_after;
+	uint8_t *p = cert;
+
+	*certlen = 0;
+	if (sm2_key_generate(sm2_key) != 1
+		|| rand_bytes(serial, sizeof(serial)) != 1
+		|| x509_name_set(name, &namelen, sizeof(name), "CN", "Beijing", "Haidian", "PKU", "CS", "Alice") != 1
+		|| time(&not_before) == -1
+		|| x509_validity_add_days(&not_after, not_before, 365) != 1
+		|| x509_cert_sign_to_der(
+			X509_version_v3,
+			serial, sizeof(serial),
+			OID_sm2sign_with_sm3,
+			name, namelen,
+			not_before, not_after,
+			name, namelen,
+			sm2_key, NULL, 0, NULL, 0, NULL, 0,
+			sm2_key, SM2_DEFAULT_ID, SM2_DEFAULT_ID_LENGTH,
+			&p, certlen) != 1) {
+		error_print();
+		return -1;
+	}
+	return 1;
+}
+
+// feed the CMS in steps of `step` bytes, collect the attached content
+static int cms_stream_test_verify(const uint8_t *cms, size_t cmslen, size_t step,
+	const uint8_t *detached, size_t detached_len, uint8_t *content, size_t *content_len)
+{
+	CMS_VERIFY_CTX *ctx;
+	size_t len;
+	int ret = -1;
+
+	if (!(ctx = malloc(sizeof(CMS_VERIFY_CTX)))) {
+		error_print();
+		return -1;
+	}
+	*content_len = 0;
+	if (cms_verify_init(ctx) != 1) {
+		goto end;
+	}
+	while (cmslen) {
+		size_t n = cmslen < step ? cmslen : step;
+		if (cms_verify_update(ctx, cms, n, content, &len) != 1) {
+			goto end;
+		}
+		content += len;
+		*content_len += len;
+		cms += n;
+		cmslen -= n;
+	}
+	if (detached && cms_verify_detached_update(ctx, detached, detached_len) != 1) {
+		goto end;
+	}
+	ret = cms_verify_finish(ctx);
+end:
+	free(ctx);
+	return ret;
+}
+
+static int test_cms_sign_stream(void)
+{
+	SM2_KEY sm2_key;
+	uint8_t cert[1024];
+	size_t certlen;
+	CMS_CERTS_AND_KEY signer;
+	CMS_SIGN_CTX sign_ctx;
+	uint8_t data[10000];
+	size_t steps[] = { 1, 7, 4096, sizeof(data) };
+	uint8_t *cms = NULL;
+	uint8_t *content = NULL;
+	size_t cmslen, content_len, len;
+	size_t i, j;
+	int ret = -1;
+
+	if (cms_stream_test_cert(&sm2_key, cert, &certlen) != 1) {
+		error_print();
+		return -1;
+	}
+	for (i = 0; i < sizeof(data); i++) {
+		data[i] = (uint8_t)(i * 7);
+	}
+	signer.certs = cert;
+	signer.certs_len = certlen;
+	signer.sign_key = &sm2_key;
+
+	if (!(cms = malloc(sizeof(data) * 2 + 4096))
+		|| !(content = malloc(sizeof(data)))) {
+		error_print();
+		goto end;
+	}
+
+	// attached, updates of 1000 bytes
+	if (cms_sign_init(&sign_ctx, &signer, 1, 0, cms, &cmslen) != 1) {
+		error_print();
+		goto end;
+	}
+	for (i = 0; i < sizeof(data); i += 1000) {
+		if (cms_sign_update(&sign_ctx, data + i, 1000, cms + cmslen, &len) != 1) {
+			error_print();
+			goto end;
+		}
+		cmslen += len;
+	}
+	if (cms_sign_finish(&sign_ctx, NULL, &len) != 1
+		|| cms_sign_finish(&sign_ctx, cms + cmslen, &j) != 1
+		|| j != len) {
+		error_print();
+		goto end;
+	}
+	cmslen += len;
+
+	for (i = 0; i < sizeof(steps)/sizeof(steps[0]); i++) {
+		if (cms_stream_test_verify(cms, cmslen, steps[i], NULL, 0, content, &content_len) != 1
+			|| content_len != sizeof(data)
+			|| memcmp(content, data, sizeof(data)) != 0) {
+			error_print();
+			goto end;
+		}
+	}
+	cms[cmslen/2] ^= 1;
+	if (cms_stream_test_verify(cms, cmslen, 4096, NULL, 0, content, &content_len) == 1) {
+		error_print();
+		goto end;
+	}
+
+	// detached
+	if (cms_sign_init(&sign_ctx, &signer, 1, 1, cms, &cmslen) != 1
+		|| cms_sign_update(&sign_ctx, data, sizeof(data), cms + cmslen, &len) != 1
+		|| len != 0
+		|| cms_sign_finish(&sign_ctx, cms + cmslen, &len) != 1) {
+		error_print();
+		goto end;
+	}
+	cmslen += len;
+	if (cms_stream_test_verify(cms, cmslen, 7, data, sizeof(data), content, &content_len) != 1
+		|| content_len != 0) {
+		error_print();
+		goto end;
+	}
+	if (cms_stream_test_verify(cms, cmslen, 7, data, sizeof(data) - 1, content, &content_len) == 1) {
+		error_print();
+		goto end;
+	}
+
+	// DER output of cms_sign
+	if (cms_sign(cms, &cmslen, &signer, 1, OID_cms_data, data, sizeof(data), NULL, 0) != 1) {
+		error_print();
+		goto end;
+	}
+	for (i = 0; i < sizeof(steps)/sizeof(steps[0]); i++) {
+		if (cms_stream_test_verify(cms, cmslen, steps[i], NULL, 0, content, &content_len) != 1
+			|| content_len != sizeof(data)
+			|| memcmp(content, data, sizeof(data)) != 0) {
+			error_print();
+			goto end;
+		}
+	}
+
+	printf("%s() ok\n", __FUNCTION__);
+	ret = 1;
+end:
+	if (cms) free(cms);
+	if (content) free(content);
+	return ret;
+}
+
+static int cms_stream_test_deenvelop(const uint8_t *cms, size_t cmslen, size_t step,
+	const SM2_KEY *sm2_key, const uint8_t *cert, size_t certlen,
+	uint8_t *content, size_t *content_len)
+{
+	CMS_DEENVELOP_CTX *ctx;
+	size_t len;
+	int ret = -1;
+
+	if (!(ctx = malloc(sizeof(CMS_DEENVELOP_CTX)))) {
+		error_print();
+		return -1;
+	}
+	*content_len = 0;
+	if (cms_deenvelop_init(ctx, sm2_key, cert, certlen) != 1) {
+		goto end;
+	}
+	while (cmslen) {
+		size_t n = cmslen < step ? cmslen : step;
+		if (cms_deenvelop_update(ctx, cms, n, content, &len) != 1) {
+			goto end;
+		}
+		content += len;
+		*content_len += len;
+		cms += n;
+		cmslen -= n;
+	}
+	if (cms_deenvelop_finish(ctx, content, &len) != 1) {
+		goto end;
+	}
+	*content_len += len;
+	ret = 1;
+end:
+	free(ctx);
+	return ret;
+}
+
+static int test_cms_envelop_stream(void)
+{
+	SM2_KEY sm2_key;
+	uint8_t cert[1024];
+	size_t certlen;
+	uint8_t key[16];
+	uint8_t iv[16];
+	CMS_ENVELOP_CTX envelop_ctx;
+	uint8_t data[10000];
+	size_t steps[] = { 1, 13, 4096, 3 * sizeof(data) };
+	uint8_t *cms = NULL;
+	uint8_t *content = NULL;
+	size_t cmslen, content_len, len;
+	size_t i;
+	int ret = -1;
+
+	if (cms_stream_test_cert(&sm2_key, cert, &certlen) != 1
+		|| rand_bytes(key, sizeof(key)) != 1
+		|| rand_bytes(iv, sizeof(iv)) != 1) {
+		error_print();
+		return -1;
+	}
+	for (i = 0; i < sizeof(data); i++) {
+		data[i] = (uint8_t)(i * 7);
+	}
+	if (!(cms = malloc(sizeof(data) * 2 + 4096))
+		|| !(content = malloc(sizeof(data) + 4096))) {
+		error_print();
+		goto end;
+	}
+
+	if (cms_envelop_init(&envelop_ctx, cert, certlen,
+			OID_sm4_cbc, key, sizeof(key), iv, sizeof(iv), cms, &cmslen) != 1) {
+		error_print();
+		goto end;
+	}
+	for (i = 0; i < sizeof(data); i += 2500) {
+		if (cms_envelop_update(&envelop_ctx, data + i, 2500, cms + cmslen, &len) != 1) {
+			error_print();
+			goto end;
+		}
+		cmslen += len;
+	}
+	if (cms_envelop_finish(&envelop_ctx, cms + cmslen, &len) != 1) {
+		error_print();
+		goto end;
+	}
+	cmslen += len;
+
+	for (i = 0; i < sizeof(steps)/sizeof(steps[0]); i++) {
+		if (cms_stream_test_deenvelop(cms, cmslen, steps[i],
+				&sm2_key, cert, certlen, content, &content_len) != 1
+			|| content_len != sizeof(data)
+			|| memcmp(content, data, sizeof(data)) != 0) {
+			error_print();
+			goto end;
+		}
+	}
+	if (cms_stream_test_deenvelop(cms, cmslen - 2, 4096,
+		&sm2_key, cert, certlen, content, &content_len) == 1) {
+		error_print();
+		goto end;
+	}
+
+	// DER output of cms_envelop
+	if (cms_envelop(cms, &cmslen, cert, certlen,
+			OID_sm4_cbc, key, sizeof(key), iv, sizeof(iv),
+			OID_cms_data, data, sizeof(data), NULL, 0, NULL, 0) != 1) {
+		error_print();
+		goto end;
+	}
+	for (i = 0; i < sizeof(steps)/sizeof(steps[0]); i++) {
+		if (cms_stream_test_deenvelop(cms, cmslen, steps[i],
+				&sm2_key, cert, certlen, content, &content_len) != 1
+			|| content_len != sizeof(data)
+			|| memcmp(content, data, sizeof(data)) != 0) {
+			error_print();
+			goto end;
+		}
+	}
+
+	printf("%s() ok\n", __FUNCTION__);
+	ret = 1;
+end:
+	if (cms) free(cms);
+	if (content) free(content);
+	return ret;
+}
+
 int main(int argc, char **argv)
 {
 	if (test_cms_content_type() != 1) goto err;
@@ -993,6 +1290,8 @@ int main(int argc, char **argv)
 	if (test_cms_recipient_info() != 1) goto err;
 	if (test_cms_enveloped_data() != 1) goto err;
 	if (test_cms_key_agreement_info() != 1) goto err;
+	if (test_cms_sign_stream() != 1) goto err;
+	if (test_cms_envelop_stream() != 1) goto err;
 
 	printf("%s all tests passed\n", __FILE__);
 	return 0;
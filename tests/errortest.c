@@ -0,0 +1,153 @@
+/*
+ *  Copyright 2014-2024 The GmSSL Project. All Rights Reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the License); you may
+ *  not use this file except in compliance with the License.
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+#include <gmssl/hex.h>
+#include <gmssl/error.h>
+#ifdef ENABLE_PTHREAD
+#include <pthread.h>
+#endif
+
+
+static int test_error_queue(void)
+{
+	GMSSL_ERROR err;
+	uint8_t buf[4];
+	size_t len;
+	int line;
+	int i;
+
+	gmssl_error_set_stderr(0);
+	gmssl_error_clear();
+
+	if (gmssl_error_get(&err) != 0 || gmssl_error_peek_last(&err) != 0) {
+		gmssl_error_set_stderr(1);
+		error_print();
+		return -1;
+	}
+
+	// a failure inside the library is recorded with its location
+	if (hex_to_bytes("abc", 3, buf, &len) == 1
+		|| gmssl_error_peek_last(&err) != 1
+		|| strcmp(err.func, "hex2bin") != 0
+		|| err.code != GMSSL_ERR_UNSPECIFIED) {
+		gmssl_error_set_stderr(1);
+		error_print();
+		return -1;
+	}
+	gmssl_error_clear();
+
+	line = __LINE__ + 1;
+	error_print_code(GMSSL_ERR_DECODE);
+	error_print_code(GMSSL_ERR_VERIFY);
+	if (gmssl_error_get(&err) != 1
+		|| err.line != line || err.code != GMSSL_ERR_DECODE
+		|| strcmp(err.func, __FUNCTION__) != 0
+		|| gmssl_error_get(&err) != 1 || err.code != GMSSL_ERR_VERIFY
+		|| gmssl_error_get(&err) != 0) {
+		gmssl_error_set_stderr(1);
+		error_print();
+		return -1;
+	}
+
+	// the oldest errors are overwritten
+	for (i = 0; i < GMSSL_ERROR_QUEUE_SIZE + 3; i++) {
+		error_print_code(i);
+	}
+	for (i = 3; i < GMSSL_ERROR_QUEUE_SIZE + 3; i++) {
+		if (gmssl_error_get(&err) != 1 || err.code != i) {
+			gmssl_error_set_stderr(1);
+			error_print();
+			return -1;
+		}
+	}
+	if (gmssl_error_get(&err) != 0) {
+		gmssl_error_set_stderr(1);
+		error_print();
+		return -1;
+	}
+
+	error_puts("not formatted");
+	error_print();
+	if (gmssl_error_print(stdout) != 1 || gmssl_error_get(&err) != 0) {
+		gmssl_error_set_stderr(1);
+		error_print();
+		return -1;
+	}
+
+	gmssl_error_set_stderr(1);
+	printf("%s() ok\n", __FUNCTION__);
+	return 1;
+}
+
+#ifdef ENABLE_PTHREAD
+static void *error_thread(void *arg)
+{
+	GMSSL_ERROR err;
+	int *ret = arg;
+
+	*ret = -1;
+	if (gmssl_error_get(&err) != 0) {
+		return NULL;
+	}
+	error_print_code(GMSSL_ERR_VERIFY);
+	if (gmssl_error_get(&err) != 1 || err.code != GMSSL_ERR_VERIFY) {
+		return NULL;
+	}
+	*ret = 1;
+	return NULL;
+}
+
+static int test_error_queue_threads(void)
+{
+	pthread_t thread;
+	GMSSL_ERROR err;
+	int thread_ret = -1;
+
+	gmssl_error_set_stderr(0);
+	gmssl_error_clear();
+	error_print_code(GMSSL_ERR_DECODE);
+
+	if (pthread_create(&thread, NULL, error_thread, &thread_ret) != 0) {
+		gmssl_error_set_stderr(1);
+		error_print();
+		return -1;
+	}
+	pthread_join(thread, NULL);
+
+	// errors of other threads are not seen
+	if (thread_ret != 1
+		|| gmssl_error_get(&err) != 1 || err.code != GMSSL_ERR_DECODE
+		|| gmssl_error_get(&err) != 0) {
+		gmssl_error_set_stderr(1);
+		error_print();
+		return -1;
+	}
+
+	gmssl_error_set_stderr(1);
+	printf("%s() ok\n", __FUNCTION__);
+	return 1;
+}
+#endif
+
+int main(void)
+{
+	if (test_error_queue() != 1) goto err;
+#ifdef ENABLE_PTHREAD
+	if (test_error_queue_threads() != 1) goto err;
+#endif
+	printf("%s all tests passed\n", __FILE__);
+	return 0;
+err:
+	error_print();
+	return 1;
+}
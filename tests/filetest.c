@@ -0,0 +1,134 @@
+/*
+ *  Copyright 2014-2024 The GmSSL Project. All Rights Reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the License); you may
+ *  not use this file except in compliance with the License.
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <gmssl/file.h>
+#include <gmssl/error.h>
+
+
+static int file_reader_test_read(FILE *fp, const uint8_t *data, size_t datalen)
+{
+	FILE_READER reader;
+	const uint8_t *block;
+	size_t blocklen;
+	size_t offset = 0;
+	int rv;
+
+	if (file_reader_init(&reader, fp) != 1) {
+		error_print();
+		return -1;
+	}
+	while ((rv = file_reader_read(&reader, &block, &blocklen)) == 1) {
+		if (!blocklen || blocklen > FILE_IO_BLOCK_SIZE
+			|| blocklen > datalen - offset
+			|| memcmp(block, data + offset, blocklen) != 0) {
+			file_reader_cleanup(&reader);
+			error_print();
+			return -1;
+		}
+		offset += blocklen;
+	}
+	// stays at the end
+	if (rv == 0) {
+		rv = file_reader_read(&reader, &block, &blocklen);
+	}
+	file_reader_cleanup(&reader);
+	if (rv != 0 || offset != datalen) {
+		error_print();
+		return -1;
+	}
+	return 1;
+}
+
+static int test_file_reader(void)
+{
+	size_t lens[] = { 0, 1, FILE_IO_BLOCK_SIZE, FILE_IO_BLOCK_SIZE * 2 + 1000 };
+	size_t datalen = FILE_IO_BLOCK_SIZE * 2 + 1000;
+	uint8_t *data;
+	size_t i;
+
+	if (!(data = (uint8_t *)malloc(datalen))) {
+		error_print();
+		return -1;
+	}
+	for (i = 0; i < datalen; i++) {
+		data[i] = (uint8_t)(i * 7);
+	}
+
+	for (i = 0; i < sizeof(lens)/sizeof(lens[0]); i++) {
+		FILE *fp;
+
+		// regular file, mapped
+		if (!(fp = tmpfile())
+			|| file_write(fp, data, lens[i]) != 1
+			|| fseek(fp, 0, SEEK_SET) != 0
+			|| file_reader_test_read(fp, data, lens[i]) != 1) {
+			error_print();
+			return -1;
+		}
+		fclose(fp);
+	}
+
+#ifndef WIN32
+	{
+		const char *file = "filetest.bin";
+		char cmd[64];
+		FILE *fp;
+		FILE_READER reader;
+		const uint8_t *block;
+		size_t blocklen;
+
+		if (!(fp = fopen(file, "wb"))
+			|| file_write(fp, data, datalen) != 1) {
+			error_print();
+			return -1;
+		}
+		fclose(fp);
+
+		// pipe, read into the buffers
+		snprintf(cmd, sizeof(cmd), "cat %s", file);
+		if (!(fp = popen(cmd, "r"))
+			|| file_reader_test_read(fp, data, datalen) != 1) {
+			error_print();
+			return -1;
+		}
+		pclose(fp);
+
+		// stop in the middle of the input
+		if (!(fp = popen(cmd, "r"))
+			|| file_reader_init(&reader, fp) != 1
+			|| file_reader_read(&reader, &block, &blocklen) != 1
+			|| memcmp(block, data, blocklen) != 0) {
+			error_print();
+			return -1;
+		}
+		file_reader_cleanup(&reader);
+		pclose(fp);
+		remove(file);
+	}
+#endif
+
+	free(data);
+	printf("%s() ok\n", __FUNCTION__);
+	return 1;
+}
+
+int main(void)
+{
+	if (test_file_reader() != 1) goto err;
+	printf("%s all tests passed\n", __FILE__);
+	return 0;
+err:
+	error_print();
+	return 1;
+}
@@ -235,11 +235,84 @@ static int test_pem_windows_style_without_last_newline(void)
 	return 1;
 }
 
+static int test_pem_iter(void)
+{
+	char text[4096];
+	uint8_t bin[1024];
+	size_t binlen;
+	PEM_ITER iter;
+	const char *name;
+	const uint8_t *der;
+	size_t derlen;
+	int i;
+
+	hex_to_bytes(pem_bin_hex, strlen(pem_bin_hex), bin, &binlen);
+
+	snprintf(text, sizeof(text), "# comment before the first object\n%s%s\n"
+		"-----BEGIN TEST-----\nAQID\n-----END TEST-----\ntrailing text\n",
+		pem_unix_style, pem_windows_style);
+
+	if (pem_iter_init(&iter, (uint8_t *)text, strlen(text)) != 1) {
+		error_print();
+		return -1;
+	}
+	for (i = 0; i < 2; i++) {
+		if (pem_iter_next(&iter, &name, &der, &derlen) != 1
+			|| strcmp(name, "CERTIFICATE") != 0
+			|| derlen != binlen
+			|| memcmp(der, bin, binlen) != 0) {
+			pem_iter_cleanup(&iter);
+			error_print();
+			return -1;
+		}
+	}
+	if (pem_iter_next(&iter, &name, &der, &derlen) != 1
+		|| strcmp(name, "TEST") != 0
+		|| derlen != 3
+		|| memcmp(der, "\x01\x02\x03", 3) != 0) {
+		pem_iter_cleanup(&iter);
+		error_print();
+		return -1;
+	}
+	if (pem_iter_next(&iter, &name, &der, &derlen) != 0) {
+		pem_iter_cleanup(&iter);
+		error_print();
+		return -1;
+	}
+	pem_iter_cleanup(&iter);
+
+	// END line missing
+	snprintf(text, sizeof(text), "%s", pem_unix_style);
+	text[strlen(text) - 10] = 0;
+	pem_iter_init(&iter, (uint8_t *)text, strlen(text));
+	if (pem_iter_next(&iter, &name, &der, &derlen) != -1) {
+		pem_iter_cleanup(&iter);
+		error_print();
+		return -1;
+	}
+	pem_iter_cleanup(&iter);
+
+	// invalid base64 char
+	snprintf(text, sizeof(text), "%s", pem_unix_style);
+	text[40] = '*';
+	pem_iter_init(&iter, (uint8_t *)text, strlen(text));
+	if (pem_iter_next(&iter, &name, &der, &derlen) != -1) {
+		pem_iter_cleanup(&iter);
+		error_print();
+		return -1;
+	}
+	pem_iter_cleanup(&iter);
+
+	printf("%s() ok\n", __FUNCTION__);
+	return 1;
+}
+
 int main(void)
 {
 	if (test_pem_unix_style() != 1) { error_print(); return 1; }
 	if (test_pem_unix_style_without_last_newline() != 1) { error_print(); return 1; }
 	if (test_pem_windows_style() != 1) { error_print(); return 1; }
 	if (test_pem_windows_style_without_last_newline() != 1) { error_print(); return 1; }
+	if (test_pem_iter() != 1) { error_print(); return 1; }
 	return 0;
 }
@@ -0,0 +1,174 @@
+/*
+ *  Copyright 2014-2024 The GmSSL Project. All Rights Reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the License); you may
+ *  not use this file except in compliance with the License.
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+#include <stdint.h>
+#ifndef WIN32
+#include <unistd.h>
+#include <sys/wait.h>
+#endif
+#ifdef ENABLE_PTHREAD
+#include <pthread.h>
+#endif
+#include <gmssl/rand.h>
+#include <gmssl/error.h>
+
+
+static int test_rand_bytes(void)
+{
+	uint8_t buf1[32];
+	uint8_t buf2[32];
+	size_t len = 1024 * 1024 + 5;
+	uint8_t *big;
+	size_t zeros = 0;
+	size_t i;
+
+	if (rand_bytes(buf1, sizeof(buf1)) != 1
+		|| rand_bytes(buf2, sizeof(buf2)) != 1
+		|| memcmp(buf1, buf2, sizeof(buf1)) == 0) {
+		error_print();
+		return -1;
+	}
+	if (rand_bytes(buf1, 0) == 1) {
+		error_print();
+		return -1;
+	}
+
+	// more than RAND_BYTES_MAX_SIZE in one call
+	if (!(big = (uint8_t *)calloc(1, len))) {
+		error_print();
+		return -1;
+	}
+	if (rand_bytes(big, len) != 1) {
+		free(big);
+		error_print();
+		return -1;
+	}
+	for (i = 0; i < len; i++) {
+		if (!big[i]) zeros++;
+	}
+	free(big);
+	if (zeros > len / 128) {
+		error_print();
+		return -1;
+	}
+
+	printf("%s() ok\n", __FUNCTION__);
+	return 1;
+}
+
+#ifndef WIN32
+// the child of fork() must not repeat the output of the parent
+static int test_rand_bytes_fork(void)
+{
+	uint8_t buf[32];
+	uint8_t parent_buf[32];
+	uint8_t child_buf[32];
+	int fds[2];
+	pid_t pid;
+	int status;
+
+	if (rand_bytes(buf, sizeof(buf)) != 1) {
+		error_print();
+		return -1;
+	}
+	if (pipe(fds) != 0) {
+		error_print();
+		return -1;
+	}
+	if ((pid = fork()) < 0) {
+		error_print();
+		return -1;
+	}
+	if (pid == 0) {
+		close(fds[0]);
+		if (rand_bytes(child_buf, sizeof(child_buf)) != 1
+			|| write(fds[1], child_buf, sizeof(child_buf)) != sizeof(child_buf)) {
+			_exit(1);
+		}
+		_exit(0);
+	}
+	close(fds[1]);
+	if (rand_bytes(parent_buf, sizeof(parent_buf)) != 1
+		|| read(fds[0], child_buf, sizeof(child_buf)) != sizeof(child_buf)
+		|| waitpid(pid, &status, 0) != pid
+		|| !WIFEXITED(status) || WEXITSTATUS(status) != 0) {
+		close(fds[0]);
+		error_print();
+		return -1;
+	}
+	close(fds[0]);
+	if (memcmp(parent_buf, child_buf, sizeof(child_buf)) == 0) {
+		error_print();
+		return -1;
+	}
+
+	printf("%s() ok\n", __FUNCTION__);
+	return 1;
+}
+#endif
+
+#ifdef ENABLE_PTHREAD
+static void *rand_bytes_routine(void *arg)
+{
+	uint8_t *buf = (uint8_t *)arg;
+
+	if (rand_bytes(buf, 32) != 1) {
+		memset(buf, 0, 32);
+	}
+	return NULL;
+}
+
+static int test_rand_bytes_threads(void)
+{
+	pthread_t threads[4];
+	uint8_t bufs[4][32];
+	int i, j;
+
+	for (i = 0; i < 4; i++) {
+		if (pthread_create(&threads[i], NULL, rand_bytes_routine, bufs[i]) != 0) {
+			error_print();
+			return -1;
+		}
+	}
+	for (i = 0; i < 4; i++) {
+		pthread_join(threads[i], NULL);
+	}
+	for (i = 0; i < 4; i++) {
+		for (j = i + 1; j < 4; j++) {
+			if (memcmp(bufs[i], bufs[j], 32) == 0) {
+				error_print();
+				return -1;
+			}
+		}
+	}
+
+	printf("%s() ok\n", __FUNCTION__);
+	return 1;
+}
+#endif
+
+int main(void)
+{
+	if (test_rand_bytes() != 1) goto err;
+#ifndef WIN32
+	if (test_rand_bytes_fork() != 1) goto err;
+#endif
+#ifdef ENABLE_PTHREAD
+	if (test_rand_bytes_threads() != 1) goto err;
+#endif
+	printf("%s all tests passed\n", __FILE__);
+	return 0;
+err:
+	error_print();
+	return 1;
+}
@@ -0,0 +1,243 @@
+/*
+ *  Copyright 2014-2024 The GmSSL Project. All Rights Reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the License); you may
+ *  not use this file except in compliance with the License.
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+#include <gmssl/sm2.h>
+#include <gmssl/sdf.h>
+#include <gmssl/rand.h>
+#include <gmssl/error.h>
+#ifdef ENABLE_PTHREAD
+#include <pthread.h>
+#endif
+
+
+#define TEST_KEY_INDEX		1
+#define TEST_PASS		"P@ssw0rd"
+#define TEST_NUM_SESSIONS	4
+#define TEST_NUM_REQUESTS	32
+
+static SDF_DEVICE dev;
+static SM2_KEY sign_key;
+static SM2_KEY enc_key;
+
+
+static int test_sdf_pool(void)
+{
+	SDF_SESSION_POOL *pool;
+	SDF_POOL_REQUEST reqs[TEST_NUM_REQUESTS];
+	SDF_POOL_STATS stats;
+	uint8_t dgsts[TEST_NUM_REQUESTS][32];
+	uint8_t ciphertexts[TEST_NUM_REQUESTS][SM2_MAX_CIPHERTEXT_SIZE];
+	uint8_t outs[TEST_NUM_REQUESTS][SM2_MAX_PLAINTEXT_SIZE];
+	uint8_t sig[SM2_MAX_SIGNATURE_SIZE];
+	size_t siglen;
+	uint8_t plaintext[SM2_MAX_PLAINTEXT_SIZE];
+	size_t plaintext_len;
+	size_t len;
+	size_t num_workers = 4;
+	int i;
+
+	if (!(pool = sdf_pool_new(&dev, TEST_KEY_INDEX, TEST_PASS, TEST_NUM_SESSIONS, num_workers))) {
+		error_print();
+		return -1;
+	}
+
+	// synchronous calls
+	if (rand_bytes(dgsts[0], 32) != 1
+		|| sdf_pool_sign(pool, dgsts[0], sig, &siglen) != 1
+		|| sm2_verify(&sign_key, dgsts[0], sig, siglen) != 1
+		|| sm2_encrypt(&enc_key, dgsts[0], 32, ciphertexts[0], &len) != 1
+		|| sdf_pool_decrypt(pool, ciphertexts[0], len, plaintext, &plaintext_len) != 1
+		|| plaintext_len != 32 || memcmp(plaintext, dgsts[0], 32) != 0) {
+		error_print();
+		goto err;
+	}
+
+	// queued requests, a signature or a decryption each
+	for (i = 0; i < TEST_NUM_REQUESTS; i++) {
+		if (rand_bytes(dgsts[i], 32) != 1) {
+			error_print();
+			goto err;
+		}
+		memset(&reqs[i], 0, sizeof(SDF_POOL_REQUEST));
+		if (i % 2) {
+			if (sm2_encrypt(&enc_key, dgsts[i], 32, ciphertexts[i], &len) != 1) {
+				error_print();
+				goto err;
+			}
+			reqs[i].type = SDF_POOL_DECRYPT;
+			reqs[i].in = ciphertexts[i];
+			reqs[i].inlen = len;
+		} else {
+			reqs[i].type = SDF_POOL_SIGN;
+			reqs[i].in = dgsts[i];
+			reqs[i].inlen = 32;
+		}
+		reqs[i].out = outs[i];
+		if (sdf_pool_submit(pool, &reqs[i]) != 1) {
+			error_print();
+			goto err;
+		}
+	}
+	for (i = 0; i < TEST_NUM_REQUESTS; i++) {
+		if (sdf_pool_wait(pool, &reqs[i]) != 1) {
+			error_print();
+			goto err;
+		}
+		if (i % 2) {
+			if (reqs[i].outlen != 32 || memcmp(outs[i], dgsts[i], 32) != 0) {
+				error_print();
+				goto err;
+			}
+		} else {
+			if (sm2_verify(&sign_key, dgsts[i], outs[i], reqs[i].outlen) != 1) {
+				error_print();
+				goto err;
+			}
+		}
+	}
+
+	// a failed request is reported by sdf_pool_wait and counted
+	ciphertexts[1][reqs[1].inlen - 1] ^= 1;
+	if (sdf_pool_submit(pool, &reqs[1]) != 1
+		|| sdf_pool_wait(pool, &reqs[1]) == 1
+		|| reqs[1].status != -1) {
+		error_print();
+		goto err;
+	}
+
+	sdf_pool_get_stats(pool, &stats);
+	if (stats.requests != TEST_NUM_REQUESTS + 3
+		|| stats.errors != 1
+		|| stats.busy_sessions != 0
+		|| stats.queued != 0
+		|| stats.max_busy_sessions < 1
+		|| stats.max_busy_sessions > TEST_NUM_SESSIONS) {
+		error_print();
+		goto err;
+	}
+#ifdef ENABLE_PTHREAD
+	// with the emulated latency the workers keep several requests in flight
+	if (stats.max_busy_sessions < 2) {
+		error_print();
+		goto err;
+	}
+#endif
+
+	sdf_pool_free(pool);
+	printf("%s() ok\n", __FUNCTION__);
+	return 1;
+err:
+	sdf_pool_free(pool);
+	return -1;
+}
+
+#ifdef ENABLE_PTHREAD
+typedef struct {
+	SDF_SESSION_POOL *pool;
+	int ret;
+} TEST_THREAD_ARG;
+
+static void *test_sign_thread(void *p)
+{
+	TEST_THREAD_ARG *arg = p;
+	uint8_t dgst[32];
+	uint8_t sig[SM2_MAX_SIGNATURE_SIZE];
+	size_t siglen;
+	int i;
+
+	arg->ret = -1;
+	for (i = 0; i < 8; i++) {
+		if (rand_bytes(dgst, sizeof(dgst)) != 1
+			|| sdf_pool_sign(arg->pool, dgst, sig, &siglen) != 1
+			|| sm2_verify(&sign_key, dgst, sig, siglen) != 1) {
+			return NULL;
+		}
+	}
+	arg->ret = 1;
+	return NULL;
+}
+
+// more threads than sessions, the dummy device fails a request on a busy session
+static int test_sdf_pool_threads(void)
+{
+	SDF_SESSION_POOL *pool;
+	SDF_POOL_STATS stats;
+	pthread_t threads[6];
+	TEST_THREAD_ARG args[6];
+	int i;
+
+	if (!(pool = sdf_pool_new(&dev, TEST_KEY_INDEX, TEST_PASS, 2, 0))) {
+		error_print();
+		return -1;
+	}
+	for (i = 0; i < 6; i++) {
+		args[i].pool = pool;
+		args[i].ret = -1;
+		if (pthread_create(&threads[i], NULL, test_sign_thread, &args[i]) != 0) {
+			error_print();
+			return -1;
+		}
+	}
+	for (i = 0; i < 6; i++) {
+		pthread_join(threads[i], NULL);
+	}
+	sdf_pool_get_stats(pool, &stats);
+	sdf_pool_free(pool);
+
+	for (i = 0; i < 6; i++) {
+		if (args[i].ret != 1) {
+			error_print();
+			return -1;
+		}
+	}
+	if (stats.requests != 6 * 8 || stats.errors
+		|| stats.max_busy_sessions != 2 || !stats.session_waits) {
+		error_print();
+		return -1;
+	}
+
+	printf("%s() ok\n", __FUNCTION__);
+	return 1;
+}
+#endif
+
+int main(void)
+{
+	int ret = 1;
+
+#ifdef ENABLE_PTHREAD
+	// emulated round trip to the card in microseconds
+	setenv("SDF_DUMMY_LATENCY", "2000", 1);
+#endif
+	if (sdf_load_library(SDF_DUMMY_LIBRARY, NULL) != 1) {
+		error_print();
+		return 1;
+	}
+	if (sdf_open_device(&dev) != 1
+		|| sdf_export_sign_public_key(&dev, TEST_KEY_INDEX, &sign_key) != 1
+		|| sdf_export_encrypt_public_key(&dev, TEST_KEY_INDEX, &enc_key) != 1) {
+		error_print();
+		goto end;
+	}
+
+	if (test_sdf_pool() != 1) goto end;
+#ifdef ENABLE_PTHREAD
+	if (test_sdf_pool_threads() != 1) goto end;
+#endif
+	printf("%s all tests passed\n", __FILE__);
+	ret = 0;
+end:
+	sdf_close_device(&dev);
+	sdf_unload_library();
+	return ret;
+}
@@ -0,0 +1,179 @@
+/*
+ *  Copyright 2014-2024 The GmSSL Project. All Rights Reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the License); you may
+ *  not use this file except in compliance with the License.
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <gmssl/hex.h>
+#include <gmssl/sm3.h>
+#include <gmssl/sm3_drbg.h>
+#include <gmssl/error.h>
+
+
+static int test_sm3_drbg(void)
+{
+	// generated by an independent SP 800-90A Hash_DRBG implementation with SM3
+	const char *out1_hex =
+		"3470dc4421911d6b764ad8d45d073120b81b2bbf361e5fda6c4a12cc368a2258"
+		"b3158d86dadd014228e1945b3b1678022a2f59998e88247cf0f8376c129756d5"
+		"e834c2bcfd35ddfa11c4302214a70e1d";
+	const char *out2_hex =
+		"05d6e11f2a5970b68e16928ac150106c325ca50fc90e35b0b02764f8d23d3b69"
+		"b339f029a981453e396c078d018f779e2237cdb57c05d16d9a00401f754218a5"
+		"75adb865c2bdbfd86e631647101c6992";
+	const char *out3_hex =
+		"85b539f8da08db4560fb3a68cab66b3baeeedcddbe26dcd22d3a980224d8d40d53";
+	SM3_DRBG drbg;
+	uint8_t entropy[48];
+	uint8_t nonce[16];
+	uint8_t reseed_entropy[32];
+	const char *personalstr = "GmSSL";
+	const char *additional = "additional input";
+	uint8_t out[80];
+	uint8_t ref[80];
+	size_t reflen;
+	size_t i;
+
+	for (i = 0; i < sizeof(entropy); i++) {
+		entropy[i] = (uint8_t)i;
+	}
+	for (i = 0; i < sizeof(nonce); i++) {
+		nonce[i] = (uint8_t)(0x20 + i);
+	}
+	for (i = 0; i < sizeof(reseed_entropy); i++) {
+		reseed_entropy[i] = (uint8_t)(0x80 + i);
+	}
+
+	if (sm3_drbg_init(&drbg, entropy, sizeof(entropy), nonce, sizeof(nonce),
+		(const uint8_t *)personalstr, strlen(personalstr)) != 1) {
+		error_print();
+		return -1;
+	}
+	hex_to_bytes(out1_hex, strlen(out1_hex), ref, &reflen);
+	if (sm3_drbg_generate(&drbg, NULL, 0, out, 80) != 1
+		|| memcmp(out, ref, reflen) != 0) {
+		error_print();
+		return -1;
+	}
+	hex_to_bytes(out2_hex, strlen(out2_hex), ref, &reflen);
+	if (sm3_drbg_generate(&drbg, (const uint8_t *)additional, strlen(additional), out, 80) != 1
+		|| memcmp(out, ref, reflen) != 0) {
+		error_print();
+		return -1;
+	}
+	hex_to_bytes(out3_hex, strlen(out3_hex), ref, &reflen);
+	if (sm3_drbg_reseed(&drbg, reseed_entropy, sizeof(reseed_entropy), NULL, 0) != 1
+		|| sm3_drbg_generate(&drbg, NULL, 0, out, 33) != 1
+		|| memcmp(out, ref, reflen) != 0) {
+		error_print();
+		return -1;
+	}
+
+	// not enough entropy
+	if (sm3_drbg_reseed(&drbg, entropy, SM3_DRBG_MIN_ENTROPY_SIZE - 1, NULL, 0) == 1) {
+		error_print();
+		return -1;
+	}
+
+	// generate is refused when the reseed interval is reached
+	if (sm3_drbg_need_reseed(&drbg) != 0) {
+		error_print();
+		return -1;
+	}
+	drbg.reseed_counter = SM3_DRBG_RESEED_INTERVAL + 1;
+	if (sm3_drbg_need_reseed(&drbg) != 1
+		|| sm3_drbg_generate(&drbg, NULL, 0, out, 32) == 1
+		|| sm3_drbg_reseed(&drbg, entropy, sizeof(entropy), NULL, 0) != 1
+		|| sm3_drbg_generate(&drbg, NULL, 0, out, 32) != 1) {
+		error_print();
+		return -1;
+	}
+	drbg.last_reseed_time -= SM3_DRBG_RESEED_TIME + 1;
+	if (sm3_drbg_need_reseed(&drbg) != 1) {
+		error_print();
+		return -1;
+	}
+
+	sm3_drbg_cleanup(&drbg);
+	printf("%s() ok\n", __FUNCTION__);
+	return 1;
+}
+
+static void test_sm3(const uint8_t *prefix, size_t prefixlen, const uint8_t *data, size_t datalen,
+	uint8_t dgst[SM3_DIGEST_SIZE])
+{
+	SM3_CTX sm3_ctx;
+	sm3_init(&sm3_ctx);
+	sm3_update(&sm3_ctx, prefix, prefixlen);
+	sm3_update(&sm3_ctx, data, datalen);
+	sm3_finish(&sm3_ctx, dgst);
+}
+
+// Hashgen and the V update are additions mod 2^440, the carry has to run through all of V
+static int test_sm3_drbg_carry(void)
+{
+	SM3_DRBG drbg;
+	uint8_t entropy[32] = {0};
+	uint8_t ones[SM3_DRBG_SEED_SIZE];
+	uint8_t zeros[SM3_DRBG_SEED_SIZE] = {0};
+	uint8_t V[SM3_DRBG_SEED_SIZE] = {0};
+	uint8_t prefix = 0x03;
+	uint8_t out[64];
+	uint8_t dgst[SM3_DIGEST_SIZE];
+
+	if (sm3_drbg_init(&drbg, entropy, sizeof(entropy), NULL, 0, NULL, 0) != 1) {
+		error_print();
+		return -1;
+	}
+	memset(ones, 0xff, sizeof(ones));
+	memcpy(drbg.V, ones, SM3_DRBG_SEED_SIZE);
+	memset(drbg.C, 0, SM3_DRBG_SEED_SIZE);
+	drbg.reseed_counter = 1;
+
+	// Hash(V) || Hash(V + 1), V + 1 wraps to zero
+	if (sm3_drbg_generate(&drbg, NULL, 0, out, sizeof(out)) != 1) {
+		error_print();
+		return -1;
+	}
+	test_sm3(NULL, 0, ones, sizeof(ones), dgst);
+	if (memcmp(out, dgst, SM3_DIGEST_SIZE) != 0) {
+		error_print();
+		return -1;
+	}
+	test_sm3(NULL, 0, zeros, sizeof(zeros), dgst);
+	if (memcmp(out + SM3_DIGEST_SIZE, dgst, SM3_DIGEST_SIZE) != 0) {
+		error_print();
+		return -1;
+	}
+
+	// V = V + Hash(0x03 || V) + C + reseed_counter = (2^440 - 1) + H + 0 + 1 = H
+	test_sm3(&prefix, 1, ones, sizeof(ones), V + SM3_DRBG_SEED_SIZE - SM3_DIGEST_SIZE);
+	if (memcmp(drbg.V, V, SM3_DRBG_SEED_SIZE) != 0
+		|| drbg.reseed_counter != 2) {
+		error_print();
+		return -1;
+	}
+
+	sm3_drbg_cleanup(&drbg);
+	printf("%s() ok\n", __FUNCTION__);
+	return 1;
+}
+
+int main(void)
+{
+	if (test_sm3_drbg() != 1) goto err;
+	if (test_sm3_drbg_carry() != 1) goto err;
+	printf("%s all tests passed\n", __FILE__);
+	return 0;
+err:
+	error_print();
+	return 1;
+}
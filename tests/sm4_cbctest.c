@@ -12,6 +12,7 @@
 #include <string.h>
 #include <stdlib.h>
 #include <stdint.h>
+#include <time.h>
 #include <gmssl/sm4.h>
 #include <gmssl/hex.h>
 #include <gmssl/rand.h>
@@ -321,12 +322,129 @@ static int test_sm4_cbc_ctx(void)
 	return 1;
 }
 
+static int test_sm4_x8_encrypt(void)
+{
+	SM4_KEY sm4_keys[SM4_X8_LANES];
+	const SM4_KEY *keys[SM4_X8_LANES];
+	SM4_X8_KEY x8_key;
+	uint8_t key[16];
+	uint8_t in[SM4_X8_LANES][16];
+	uint8_t out[SM4_X8_LANES][16];
+	uint8_t buf[16];
+	int j;
+
+	for (j = 0; j < SM4_X8_LANES; j++) {
+		rand_bytes(key, sizeof(key));
+		sm4_set_encrypt_key(&sm4_keys[j], key);
+		keys[j] = &sm4_keys[j];
+	}
+	rand_bytes((uint8_t *)in, sizeof(in));
+
+	sm4_x8_set_key(&x8_key, 0xff, keys);
+	sm4_x8_encrypt(&x8_key, in, out);
+
+	for (j = 0; j < SM4_X8_LANES; j++) {
+		sm4_encrypt(&sm4_keys[j], in[j], buf);
+		if (memcmp(out[j], buf, 16) != 0) {
+			error_print();
+			return -1;
+		}
+	}
+
+	printf("%s() ok\n", __FUNCTION__);
+	return 1;
+}
+
+#define TEST_CBC_NJOBS		21
+#define TEST_CBC_MAX_NBLOCKS	40
+
+static int test_sm4_cbc_encrypt_jobs(void)
+{
+	SM4_KEY sm4_keys[5];
+	SM4_CBC_JOB jobs[TEST_CBC_NJOBS];
+	uint8_t key[16];
+	uint8_t in[TEST_CBC_NJOBS][TEST_CBC_MAX_NBLOCKS * 16];
+	uint8_t out[TEST_CBC_NJOBS][TEST_CBC_MAX_NBLOCKS * 16];
+	uint8_t ref[TEST_CBC_NJOBS][TEST_CBC_MAX_NBLOCKS * 16];
+	uint8_t ref_iv[TEST_CBC_NJOBS][16];
+	size_t i, j;
+
+	for (i = 0; i < sizeof(sm4_keys)/sizeof(sm4_keys[0]); i++) {
+		rand_bytes(key, sizeof(key));
+		sm4_set_encrypt_key(&sm4_keys[i], key);
+	}
+
+	// mixed lengths with some empty jobs, job 3 is encrypted in place
+	for (i = 0; i < TEST_CBC_NJOBS; i++) {
+		for (j = 0; j < TEST_CBC_MAX_NBLOCKS; j += 10) {
+			rand_bytes(in[i] + j * 16, 10 * 16);
+		}
+		jobs[i].key = &sm4_keys[i % 5];
+		rand_bytes(jobs[i].iv, 16);
+		jobs[i].in = in[i];
+		jobs[i].nblocks = (i * 7) % (TEST_CBC_MAX_NBLOCKS + 1);
+		jobs[i].out = (i == 3) ? in[i] : out[i];
+
+		memcpy(ref_iv[i], jobs[i].iv, 16);
+		sm4_cbc_encrypt_blocks(jobs[i].key, ref_iv[i], in[i], jobs[i].nblocks, ref[i]);
+	}
+
+	sm4_cbc_encrypt_jobs(jobs, TEST_CBC_NJOBS);
+
+	for (i = 0; i < TEST_CBC_NJOBS; i++) {
+		if (memcmp(jobs[i].out, ref[i], jobs[i].nblocks * 16) != 0
+			|| memcmp(jobs[i].iv, ref_iv[i], 16) != 0) {
+			error_print();
+			return -1;
+		}
+	}
+
+	printf("%s() ok\n", __FUNCTION__);
+	return 1;
+}
+
+static int speed_sm4_cbc_encrypt_jobs(void)
+{
+	SM4_KEY sm4_key;
+	SM4_CBC_JOB jobs[64];
+	uint8_t key[16] = {0};
+	static uint8_t buf[64][1024];
+	clock_t begin, end;
+	double seconds;
+	size_t i;
+
+	sm4_set_encrypt_key(&sm4_key, key);
+	for (i = 0; i < 64; i++) {
+		jobs[i].key = &sm4_key;
+		memset(jobs[i].iv, 0, 16);
+		jobs[i].in = buf[i];
+		jobs[i].nblocks = sizeof(buf[i])/16;
+		jobs[i].out = buf[i];
+	}
+
+	begin = clock();
+	for (i = 0; i < 256; i++) {
+		sm4_cbc_encrypt_jobs(jobs, 64);
+	}
+	end = clock();
+
+	seconds = (double)(end - begin)/ CLOCKS_PER_SEC;
+	fprintf(stderr, "%s: %f MiB per second\n", __FUNCTION__, 16/seconds);
+
+	return 1;
+}
+
 int main(void)
 {
 	if (test_sm4_cbc() != 1) goto err;
 	if (test_sm4_cbc_test_vectors() != 1) goto err;
 	if (test_sm4_cbc_padding() != 1) goto err;
 	if (test_sm4_cbc_ctx() != 1) goto err;
+	if (test_sm4_x8_encrypt() != 1) goto err;
+	if (test_sm4_cbc_encrypt_jobs() != 1) goto err;
+#if ENABLE_TEST_SPEED
+	if (speed_sm4_cbc_encrypt_jobs() != 1) goto err;
+#endif
 	printf("%s all tests passed\n", __FILE__);
 	return 0;
 err:
@@ -86,6 +86,16 @@ static int test_sm4_ccm_test_vectors(void)
 		"aaaaaaaaaaaaaaaabbbbbbbbbbbbbbbbccccccccccccccccddddddddddddddddeeeeeeeeeeeeeeeeffffffffffffffffeeeeeeeeeeeeeeeeaaaaaaaaaaaaaaaa",
 		"48af93501fa62adbcd414cce6034d895dda1bf8f132f042098661572e7483094fd12e518ce062c98acee28d95df4416bed31a2f04476c18bb40c84a74b97dc5b",
 		},
+		{
+		// 2-byte length and 14-byte aad fill one block, no zero padding block
+		"aad block aligned",
+		"0123456789abcdeffedcba9876543210",
+		"00001234567800000000abcd",
+		"feedfacedeadbeeffeedfacedead",
+		"24eba3a977cc80172ecbbe8625c068af",
+		"aaaaaaaaaaaaaaaabbbbbbbbbbbbbbbbccccccccccccccccdddddddddddddddd",
+		"48af93501fa62adbcd414cce6034d895dda1bf8f132f042098661572e7483094",
+		},
 	};
 
 	uint8_t key[16];
@@ -175,6 +185,119 @@ static int test_sm4_ccm_test_vectors(void)
 	return 1;
 }
 
+static int test_sm4_ccm_ctx(void)
+{
+	SM4_KEY sm4_key;
+	SM4_CCM_CTX ctx;
+	uint8_t key[16];
+	uint8_t iv[12];
+	uint8_t aad[20];
+	uint8_t plaintext[250];
+	uint8_t ciphertext[sizeof(plaintext) + SM4_CCM_MAX_TAG_SIZE];
+	uint8_t encrypted[sizeof(plaintext) + SM4_CCM_MAX_TAG_SIZE + 32];
+	uint8_t decrypted[sizeof(plaintext) + 32];
+	size_t inlen[] = { 0, 5, 16, 100, sizeof(plaintext) };
+	size_t steps[] = { 1, 7, 16, 33 };
+	size_t taglen = 12;
+	size_t i, j;
+
+	rand_bytes(key, sizeof(key));
+	rand_bytes(iv, sizeof(iv));
+	rand_bytes(aad, sizeof(aad));
+	rand_bytes(plaintext, sizeof(plaintext));
+
+	sm4_set_encrypt_key(&sm4_key, key);
+
+	for (i = 0; i < sizeof(inlen)/sizeof(inlen[0]); i++) {
+	for (j = 0; j < sizeof(steps)/sizeof(steps[0]); j++) {
+		const uint8_t *in;
+		uint8_t *out;
+		size_t left, len, outlen;
+
+		if (sm4_ccm_encrypt(&sm4_key, iv, sizeof(iv), aad, sizeof(aad),
+			plaintext, inlen[i], ciphertext, taglen, ciphertext + inlen[i]) != 1) {
+			error_print();
+			return -1;
+		}
+
+		// reuse the key schedule after the first init
+		if (sm4_ccm_encrypt_init(&ctx, (i || j) ? NULL : key, sizeof(key), iv, sizeof(iv),
+			aad, sizeof(aad), inlen[i], taglen) != 1) {
+			error_print();
+			return -1;
+		}
+		in = plaintext;
+		out = encrypted;
+		for (left = inlen[i]; left; left -= len) {
+			len = left < steps[j] ? left : steps[j];
+			if (sm4_ccm_encrypt_update(&ctx, in, len, out, &outlen) != 1) {
+				error_print();
+				return -1;
+			}
+			in += len;
+			out += outlen;
+		}
+		if (sm4_ccm_encrypt_finish(&ctx, out, &outlen) != 1) {
+			error_print();
+			return -1;
+		}
+		out += outlen;
+		if ((size_t)(out - encrypted) != inlen[i] + taglen
+			|| memcmp(encrypted, ciphertext, inlen[i] + taglen) != 0) {
+			error_print();
+			return -1;
+		}
+
+		if (sm4_ccm_decrypt_init(&ctx, key, sizeof(key), iv, sizeof(iv),
+			aad, sizeof(aad), inlen[i], taglen) != 1) {
+			error_print();
+			return -1;
+		}
+		in = encrypted;
+		out = decrypted;
+		for (left = inlen[i] + taglen; left; left -= len) {
+			len = left < steps[j] ? left : steps[j];
+			if (sm4_ccm_decrypt_update(&ctx, in, len, out, &outlen) != 1) {
+				error_print();
+				return -1;
+			}
+			in += len;
+			out += outlen;
+		}
+		if (sm4_ccm_decrypt_finish(&ctx, out, &outlen) != 1) {
+			error_print();
+			return -1;
+		}
+		out += outlen;
+		if ((size_t)(out - decrypted) != inlen[i]
+			|| memcmp(decrypted, plaintext, inlen[i]) != 0) {
+			error_print();
+			return -1;
+		}
+	}
+	}
+
+	// tampered tag of a fresh inlen[1] message
+	if (sm4_ccm_encrypt(&sm4_key, iv, sizeof(iv), aad, sizeof(aad),
+		plaintext, inlen[1], encrypted, taglen, encrypted + inlen[1]) != 1) {
+		error_print();
+		return -1;
+	}
+	encrypted[inlen[1] + taglen - 1] ^= 1;
+	if (sm4_ccm_decrypt_init(&ctx, key, sizeof(key), iv, sizeof(iv), aad, sizeof(aad), inlen[1], taglen) != 1
+		|| sm4_ccm_decrypt_update(&ctx, encrypted, inlen[1] + taglen, decrypted, &i) != 1) {
+		error_print();
+		return -1;
+	}
+	if (sm4_ccm_decrypt_finish(&ctx, decrypted + i, &j) == 1) {
+		error_print();
+		return -1;
+	}
+
+	printf("%s() ok\n", __FUNCTION__);
+	return 1;
+}
+
 static int speed_sm4_ccm_encrypt(void)
 {
 	SM4_KEY sm4_key;
@@ -208,6 +331,7 @@ int main(void)
 {
 	if (test_sm4_ccm() != 1) goto err;
 	if (test_sm4_ccm_test_vectors() != 1) goto err;
+	if (test_sm4_ccm_ctx() != 1) goto err;
 #if ENABLE_TEST_SPEED
 	if (speed_sm4_ccm_encrypt() != 1) goto err;
 #endif
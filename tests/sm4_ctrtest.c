@@ -425,6 +425,85 @@ static int test_sm4_ctr_ctx_multi_updates(void)
 	return 1;
 }
 
+#ifdef ENABLE_PTHREAD
+static int test_sm4_ctr_update_threads(void)
+{
+	SM4_KEY sm4_key;
+	SM4_CTR_CTX ctx;
+	uint8_t key[16];
+	uint8_t iv[16];
+	uint8_t ctr[16];
+	size_t mlen = 16 * 5000 + 7;
+	uint8_t *mbuf = NULL;
+	uint8_t *cbuf = NULL;
+	uint8_t *tbuf = NULL;
+	size_t lens[] = { 3, 16 * 4100 };
+	size_t clen, len, i;
+	int ctr32;
+
+	if (!(mbuf = (uint8_t *)malloc(mlen))
+		|| !(cbuf = (uint8_t *)malloc(mlen + 16))
+		|| !(tbuf = (uint8_t *)malloc(mlen))) {
+		error_print();
+		return -1;
+	}
+	for (i = 0; i < mlen; i++) {
+		mbuf[i] = (uint8_t)(i * 7);
+	}
+	rand_bytes(key, sizeof(key));
+	// carry over the low 32 bits in the middle of the thread ranges
+	memset(iv, 0xff, sizeof(iv));
+	iv[0] = 0;
+	iv[12] = 0xfe;
+	sm4_set_encrypt_key(&sm4_key, key);
+
+	for (ctr32 = 0; ctr32 <= 1; ctr32++) {
+		const uint8_t *in = mbuf;
+		size_t left = mlen;
+
+		if ((ctr32 ? sm4_ctr32_encrypt_init(&ctx, key, iv) : sm4_ctr_encrypt_init(&ctx, key, iv)) != 1) {
+			error_print();
+			return -1;
+		}
+		clen = 0;
+		for (i = 0; i <= sizeof(lens)/sizeof(lens[0]); i++) {
+			size_t inlen = i < sizeof(lens)/sizeof(lens[0]) ? lens[i] : left;
+
+			if ((ctr32 ? sm4_ctr32_encrypt_update_threads(&ctx, in, inlen, cbuf + clen, &len, 4)
+				: sm4_ctr_encrypt_update_threads(&ctx, in, inlen, cbuf + clen, &len, 4)) != 1) {
+				error_print();
+				return -1;
+			}
+			in += inlen;
+			left -= inlen;
+			clen += len;
+		}
+		if ((ctr32 ? sm4_ctr32_encrypt_finish(&ctx, cbuf + clen, &len) : sm4_ctr_encrypt_finish(&ctx, cbuf + clen, &len)) != 1) {
+			error_print();
+			return -1;
+		}
+		clen += len;
+
+		memcpy(ctr, iv, sizeof(iv));
+		if (ctr32) {
+			sm4_ctr32_encrypt(&sm4_key, ctr, mbuf, mlen, tbuf);
+		} else {
+			sm4_ctr_encrypt(&sm4_key, ctr, mbuf, mlen, tbuf);
+		}
+		if (clen != mlen || memcmp(cbuf, tbuf, mlen) != 0) {
+			error_print();
+			return -1;
+		}
+	}
+
+	free(mbuf);
+	free(cbuf);
+	free(tbuf);
+	printf("%s() ok\n", __FUNCTION__);
+	return 1;
+}
+#endif
+
 int main(void)
 {
 	if (test_sm4_ctr() != 1) goto err;
@@ -433,6 +512,9 @@ int main(void)
 	if (test_sm4_ctr_iv_overflow() != 1) goto err;
 	if (test_sm4_ctr_ctx() != 1) goto err;
 	if (test_sm4_ctr_ctx_multi_updates() != 1) goto err;
+#ifdef ENABLE_PTHREAD
+	if (test_sm4_ctr_update_threads() != 1) goto err;
+#endif
 	printf("%s all tests passed\n", __FILE__);
 	return 0;
 err:
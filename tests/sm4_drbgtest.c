@@ -0,0 +1,174 @@
+/*
+ *  Copyright 2014-2024 The GmSSL Project. All Rights Reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the License); you may
+ *  not use this file except in compliance with the License.
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <gmssl/hex.h>
+#include <gmssl/sm4_drbg.h>
+#include <gmssl/error.h>
+
+
+static int test_sm4_drbg(void)
+{
+	// generated by an independent SP 800-90A CTR_DRBG implementation with SM4 and the derivation function
+	const char *out1_hex =
+		"ff91ae110bd7cdc3adeb734991d579bdcda3ad0a0854935eedddb037bd56e8c3"
+		"6d84103a70557882a2fb7c7e1af2e5f181e734dc531e552096a5d385738cdb00"
+		"833bea2eee2c2a4df6ee5b7e0d097cfc";
+	const char *out2_hex =
+		"a31791e8d231c081b596e08c00c5cb897fdd4c1cf73b65b8e1f5146116b55d51"
+		"2bd02d67ce0b8856b597da325e8437b7a15ef892dade8d06642349d916ee3d31"
+		"72dc9305f7908ad1a7561f39d02788ee";
+	const char *out3_hex =
+		"5e21ae9a14f63e6699b2d0631692b9e80a0e445c5c2f4f87735da680d421b4f6bf";
+	SM4_DRBG drbg;
+	uint8_t entropy[48];
+	uint8_t nonce[16];
+	uint8_t reseed_entropy[32];
+	const char *personalstr = "GmSSL";
+	const char *additional = "additional input";
+	uint8_t out[80];
+	uint8_t ref[80];
+	size_t reflen;
+	size_t i;
+
+	for (i = 0; i < sizeof(entropy); i++) {
+		entropy[i] = (uint8_t)i;
+	}
+	for (i = 0; i < sizeof(nonce); i++) {
+		nonce[i] = (uint8_t)(0x20 + i);
+	}
+	for (i = 0; i < sizeof(reseed_entropy); i++) {
+		reseed_entropy[i] = (uint8_t)(0x80 + i);
+	}
+
+	if (sm4_drbg_init(&drbg, entropy, sizeof(entropy), nonce, sizeof(nonce),
+		(const uint8_t *)personalstr, strlen(personalstr)) != 1) {
+		error_print();
+		return -1;
+	}
+	hex_to_bytes(out1_hex, strlen(out1_hex), ref, &reflen);
+	if (sm4_drbg_generate(&drbg, NULL, 0, out, 80) != 1
+		|| memcmp(out, ref, reflen) != 0) {
+		error_print();
+		return -1;
+	}
+	hex_to_bytes(out2_hex, strlen(out2_hex), ref, &reflen);
+	if (sm4_drbg_generate(&drbg, (const uint8_t *)additional, strlen(additional), out, 80) != 1
+		|| memcmp(out, ref, reflen) != 0) {
+		error_print();
+		return -1;
+	}
+	hex_to_bytes(out3_hex, strlen(out3_hex), ref, &reflen);
+	if (sm4_drbg_reseed(&drbg, reseed_entropy, sizeof(reseed_entropy), NULL, 0) != 1
+		|| sm4_drbg_generate(&drbg, NULL, 0, out, 33) != 1
+		|| memcmp(out, ref, reflen) != 0) {
+		error_print();
+		return -1;
+	}
+
+	// not enough entropy
+	if (sm4_drbg_reseed(&drbg, entropy, SM4_DRBG_MIN_ENTROPY_SIZE - 1, NULL, 0) == 1) {
+		error_print();
+		return -1;
+	}
+
+	// generate is refused when the reseed interval is reached
+	if (sm4_drbg_need_reseed(&drbg) != 0) {
+		error_print();
+		return -1;
+	}
+	drbg.reseed_counter = SM4_DRBG_RESEED_INTERVAL + 1;
+	if (sm4_drbg_need_reseed(&drbg) != 1
+		|| sm4_drbg_generate(&drbg, NULL, 0, out, 32) == 1
+		|| sm4_drbg_reseed(&drbg, entropy, sizeof(entropy), NULL, 0) != 1
+		|| sm4_drbg_generate(&drbg, NULL, 0, out, 32) != 1) {
+		error_print();
+		return -1;
+	}
+	drbg.last_reseed_time -= SM4_DRBG_RESEED_TIME + 1;
+	if (sm4_drbg_need_reseed(&drbg) != 1) {
+		error_print();
+		return -1;
+	}
+
+	sm4_drbg_cleanup(&drbg);
+	printf("%s() ok\n", __FUNCTION__);
+	return 1;
+}
+
+// the counter wraps at V + 1, the partial last block still consumes a counter
+static int test_sm4_drbg_counter_wrap(void)
+{
+	const uint8_t key[SM4_KEY_SIZE] = {
+		0x01, 0x23, 0x45, 0x67, 0x89, 0xab, 0xcd, 0xef,
+		0xfe, 0xdc, 0xba, 0x98, 0x76, 0x54, 0x32, 0x10,
+	};
+	SM4_DRBG drbg;
+	SM4_KEY sm4_key;
+	uint8_t entropy[32] = {0};
+	uint8_t ctr[SM4_BLOCK_SIZE] = {0};
+	uint8_t block[SM4_BLOCK_SIZE];
+	uint8_t out[20];
+
+	if (sm4_drbg_init(&drbg, entropy, sizeof(entropy), NULL, 0, NULL, 0) != 1) {
+		error_print();
+		return -1;
+	}
+	sm4_set_encrypt_key(&drbg.sm4_key, key);
+	memset(drbg.V, 0xff, SM4_BLOCK_SIZE);
+	if (sm4_drbg_generate(&drbg, NULL, 0, out, sizeof(out)) != 1) {
+		error_print();
+		return -1;
+	}
+
+	// E(0) || E(1)[0..3]
+	sm4_set_encrypt_key(&sm4_key, key);
+	sm4_encrypt(&sm4_key, ctr, block);
+	if (memcmp(out, block, SM4_BLOCK_SIZE) != 0) {
+		error_print();
+		return -1;
+	}
+	ctr[15] = 1;
+	sm4_encrypt(&sm4_key, ctr, block);
+	if (memcmp(out + SM4_BLOCK_SIZE, block, sizeof(out) - SM4_BLOCK_SIZE) != 0) {
+		error_print();
+		return -1;
+	}
+
+	// V is left at 1, the update takes Key = E(2), V = E(3)
+	ctr[15] = 2;
+	sm4_encrypt(&sm4_key, ctr, block);
+	ctr[15] = 3;
+	sm4_encrypt(&sm4_key, ctr, ctr);
+	sm4_set_encrypt_key(&sm4_key, block);
+	if (memcmp(drbg.V, ctr, SM4_BLOCK_SIZE) != 0
+		|| memcmp(&drbg.sm4_key, &sm4_key, sizeof(SM4_KEY)) != 0) {
+		error_print();
+		return -1;
+	}
+
+	sm4_drbg_cleanup(&drbg);
+	printf("%s() ok\n", __FUNCTION__);
+	return 1;
+}
+
+int main(void)
+{
+	if (test_sm4_drbg() != 1) goto err;
+	if (test_sm4_drbg_counter_wrap() != 1) goto err;
+	printf("%s all tests passed\n", __FILE__);
+	return 0;
+err:
+	error_print();
+	return 1;
+}
@@ -180,11 +180,105 @@ static int test_sm4_ecb_ctx(void)
 	return 1;
 }
 
+#ifdef ENABLE_PTHREAD
+static int test_sm4_ecb_update_threads(void)
+{
+	SM4_ECB_CTX ctx;
+	SM4_KEY sm4_key;
+	uint8_t key[16];
+	size_t mlen = 16 * 5000;
+	uint8_t *mbuf = NULL;
+	uint8_t *cbuf = NULL;
+	uint8_t *tbuf = NULL;
+	size_t lens[] = { 7, 16 * 4100 + 9 };
+	size_t outlen, len, left, i;
+	const uint8_t *in;
+
+	if (!(mbuf = (uint8_t *)malloc(mlen))
+		|| !(cbuf = (uint8_t *)malloc(mlen + 16))
+		|| !(tbuf = (uint8_t *)malloc(mlen + 16))) {
+		error_print();
+		return -1;
+	}
+	for (i = 0; i < mlen; i++) {
+		mbuf[i] = (uint8_t)(i * 7);
+	}
+	rand_bytes(key, sizeof(key));
+	sm4_set_encrypt_key(&sm4_key, key);
+	sm4_encrypt_blocks(&sm4_key, mbuf, mlen / 16, tbuf);
+
+	// encrypt
+	if (sm4_ecb_encrypt_init(&ctx, key) != 1) {
+		error_print();
+		return -1;
+	}
+	in = mbuf;
+	left = mlen;
+	outlen = 0;
+	for (i = 0; i <= sizeof(lens)/sizeof(lens[0]); i++) {
+		size_t inlen = i < sizeof(lens)/sizeof(lens[0]) ? lens[i] : left;
+		if (sm4_ecb_encrypt_update_threads(&ctx, in, inlen, cbuf + outlen, &len, 4) != 1) {
+			error_print();
+			return -1;
+		}
+		in += inlen;
+		left -= inlen;
+		outlen += len;
+	}
+	if (sm4_ecb_encrypt_finish(&ctx, cbuf + outlen, &len) != 1) {
+		error_print();
+		return -1;
+	}
+	outlen += len;
+	if (outlen != mlen || memcmp(cbuf, tbuf, mlen) != 0) {
+		error_print();
+		return -1;
+	}
+
+	// decrypt
+	if (sm4_ecb_decrypt_init(&ctx, key) != 1) {
+		error_print();
+		return -1;
+	}
+	in = cbuf;
+	left = mlen;
+	outlen = 0;
+	for (i = 0; i <= sizeof(lens)/sizeof(lens[0]); i++) {
+		size_t inlen = i < sizeof(lens)/sizeof(lens[0]) ? lens[i] : left;
+		if (sm4_ecb_decrypt_update_threads(&ctx, in, inlen, tbuf + outlen, &len, 4) != 1) {
+			error_print();
+			return -1;
+		}
+		in += inlen;
+		left -= inlen;
+		outlen += len;
+	}
+	if (sm4_ecb_decrypt_finish(&ctx, tbuf + outlen, &len) != 1) {
+		error_print();
+		return -1;
+	}
+	outlen += len;
+	if (outlen != mlen || memcmp(tbuf, mbuf, mlen) != 0) {
+		error_print();
+		return -1;
+	}
+
+	free(mbuf);
+	free(cbuf);
+	free(tbuf);
+	printf("%s() ok\n", __FUNCTION__);
+	return 1;
+}
+#endif
+
 int main(void)
 {
 	if (test_sm4_ecb() != 1) goto err;
 	if (test_sm4_ecb_test_vectors() != 1) goto err;
 	if (test_sm4_ecb_ctx() != 1) goto err;
+#ifdef ENABLE_PTHREAD
+	if (test_sm4_ecb_update_threads() != 1) goto err;
+#endif
 	printf("%s all tests passed\n", __FILE__);
 	return 0;
 err:
@@ -313,6 +313,105 @@ static int test_sm4_gcm_ctx(void)
 	return 1;
 }
 
+#ifdef ENABLE_PTHREAD
+static int test_sm4_gcm_update_threads(void)
+{
+	SM4_GCM_CTX ctx;
+	SM4_KEY sm4_key;
+	uint8_t key[16];
+	uint8_t iv[12];
+	uint8_t aad[20];
+	size_t mlen = 16 * 5000 + 9;
+	uint8_t *mbuf = NULL;
+	uint8_t *cbuf = NULL;
+	uint8_t *tbuf = NULL;
+	size_t lens[] = { 5, 16 * 4200 };
+	size_t clen, tlen, len, left, i;
+	const uint8_t *in;
+
+	if (!(mbuf = (uint8_t *)malloc(mlen))
+		|| !(cbuf = (uint8_t *)malloc(mlen + 32))
+		|| !(tbuf = (uint8_t *)malloc(mlen + 32))) {
+		error_print();
+		return -1;
+	}
+	for (i = 0; i < mlen; i++) {
+		mbuf[i] = (uint8_t)(i * 7);
+	}
+	rand_bytes(key, sizeof(key));
+	rand_bytes(iv, sizeof(iv));
+	rand_bytes(aad, sizeof(aad));
+
+	if (sm4_gcm_encrypt_init(&ctx, key, sizeof(key), iv, sizeof(iv), aad, sizeof(aad), GHASH_SIZE) != 1) {
+		error_print();
+		return -1;
+	}
+	in = mbuf;
+	left = mlen;
+	clen = 0;
+	for (i = 0; i <= sizeof(lens)/sizeof(lens[0]); i++) {
+		size_t inlen = i < sizeof(lens)/sizeof(lens[0]) ? lens[i] : left;
+		if (sm4_gcm_encrypt_update_threads(&ctx, in, inlen, cbuf + clen, &len, 4) != 1) {
+			error_print();
+			return -1;
+		}
+		in += inlen;
+		left -= inlen;
+		clen += len;
+	}
+	if (sm4_gcm_encrypt_finish(&ctx, cbuf + clen, &len) != 1) {
+		error_print();
+		return -1;
+	}
+	clen += len;
+
+	sm4_set_encrypt_key(&sm4_key, key);
+	if (sm4_gcm_encrypt(&sm4_key, iv, sizeof(iv), aad, sizeof(aad), mbuf, mlen,
+		tbuf, GHASH_SIZE, tbuf + mlen) != 1) {
+		error_print();
+		return -1;
+	}
+	if (clen != mlen + GHASH_SIZE || memcmp(cbuf, tbuf, clen) != 0) {
+		error_print();
+		return -1;
+	}
+
+	// the first update is shorter than the tag
+	if (sm4_gcm_decrypt_init(&ctx, key, sizeof(key), iv, sizeof(iv), aad, sizeof(aad), GHASH_SIZE) != 1) {
+		error_print();
+		return -1;
+	}
+	in = cbuf;
+	left = clen;
+	tlen = 0;
+	for (i = 0; i <= sizeof(lens)/sizeof(lens[0]); i++) {
+		size_t inlen = i < sizeof(lens)/sizeof(lens[0]) ? lens[i] : left;
+		if (sm4_gcm_decrypt_update_threads(&ctx, in, inlen, tbuf + tlen, &len, 4) != 1) {
+			error_print();
+			return -1;
+		}
+		in += inlen;
+		left -= inlen;
+		tlen += len;
+	}
+	if (sm4_gcm_decrypt_finish(&ctx, tbuf + tlen, &len) != 1) {
+		error_print();
+		return -1;
+	}
+	tlen += len;
+	if (tlen != mlen || memcmp(tbuf, mbuf, mlen) != 0) {
+		error_print();
+		return -1;
+	}
+
+	free(mbuf);
+	free(cbuf);
+	free(tbuf);
+	printf("%s() ok\n", __FUNCTION__);
+	return 1;
+}
+#endif
+
 static int speed_sm4_gcm_encrypt(void)
 {
 	SM4_KEY sm4_key;
@@ -348,6 +447,9 @@ int main(void)
 	if (test_sm4_gcm_gbt36624_1() != 1) goto err;
 	if (test_sm4_gcm_gbt36624_2() != 1) goto err;
 	if (test_sm4_gcm_ctx() != 1) goto err;
+#ifdef ENABLE_PTHREAD
+	if (test_sm4_gcm_update_threads() != 1) goto err;
+#endif
 #if ENABLE_TEST_SPEED
 	if (speed_sm4_gcm_encrypt() != 1) goto err;
 #endif
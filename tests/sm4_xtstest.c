@@ -163,10 +163,113 @@ static int test_sm4_xts_test_vectors(void)
 	return 1;
 }
 
+#ifdef ENABLE_PTHREAD
+static int test_sm4_xts_update_threads(void)
+{
+	SM4_XTS_CTX ctx;
+	uint8_t key[32];
+	uint8_t iv[16];
+	size_t data_unit_size = 512;
+	size_t mlen = 512 * 200;
+	uint8_t *mbuf = NULL;
+	uint8_t *cbuf = NULL;
+	uint8_t *tbuf = NULL;
+	size_t lens[] = { 100, 512 * 150 + 30 };
+	size_t outlen, len, left, i;
+	const uint8_t *in;
+	int threads;
+
+	if (!(mbuf = (uint8_t *)malloc(mlen))
+		|| !(cbuf = (uint8_t *)malloc(mlen + 512))
+		|| !(tbuf = (uint8_t *)malloc(mlen + 512))) {
+		error_print();
+		return -1;
+	}
+	for (i = 0; i < mlen; i++) {
+		mbuf[i] = (uint8_t)(i * 7);
+	}
+	rand_bytes(key, sizeof(key));
+	memset(iv, 0xff, sizeof(iv));
+	iv[0] = 0xf0; // carry of the little-endian tweak inside the thread ranges
+
+	// single thread reference in tbuf, then 4 threads in cbuf
+	for (threads = 1; threads <= 4; threads += 3) {
+		uint8_t *out = threads == 1 ? tbuf : cbuf;
+
+		if (sm4_xts_encrypt_init(&ctx, key, iv, data_unit_size) != 1) {
+			error_print();
+			return -1;
+		}
+		in = mbuf;
+		left = mlen;
+		outlen = 0;
+		for (i = 0; i <= sizeof(lens)/sizeof(lens[0]); i++) {
+			size_t inlen = i < sizeof(lens)/sizeof(lens[0]) ? lens[i] : left;
+			if (sm4_xts_encrypt_update_threads(&ctx, in, inlen, out + outlen, &len, threads) != 1) {
+				error_print();
+				return -1;
+			}
+			in += inlen;
+			left -= inlen;
+			outlen += len;
+		}
+		if (sm4_xts_encrypt_finish(&ctx, out + outlen, &len) != 1) {
+			error_print();
+			return -1;
+		}
+		outlen += len;
+		if (outlen != mlen) {
+			error_print();
+			return -1;
+		}
+	}
+	if (memcmp(cbuf, tbuf, mlen) != 0) {
+		error_print();
+		return -1;
+	}
+
+	if (sm4_xts_decrypt_init(&ctx, key, iv, data_unit_size) != 1) {
+		error_print();
+		return -1;
+	}
+	in = cbuf;
+	left = mlen;
+	outlen = 0;
+	for (i = 0; i <= sizeof(lens)/sizeof(lens[0]); i++) {
+		size_t inlen = i < sizeof(lens)/sizeof(lens[0]) ? lens[i] : left;
+		if (sm4_xts_decrypt_update_threads(&ctx, in, inlen, tbuf + outlen, &len, 4) != 1) {
+			error_print();
+			return -1;
+		}
+		in += inlen;
+		left -= inlen;
+		outlen += len;
+	}
+	if (sm4_xts_decrypt_finish(&ctx, tbuf + outlen, &len) != 1) {
+		error_print();
+		return -1;
+	}
+	outlen += len;
+	if (outlen != mlen || memcmp(tbuf, mbuf, mlen) != 0) {
+		error_print();
+		return -1;
+	}
+
+	free(mbuf);
+	free(cbuf);
+	free(tbuf);
+	printf("%s() ok\n", __FUNCTION__);
+	return 1;
+}
+#endif
+
 int main(void)
 {
 	if (test_sm4_xts() != 1) goto err;
 	if (test_sm4_xts_test_vectors() != 1) goto err;
+#ifdef ENABLE_PTHREAD
+	if (test_sm4_xts_update_threads() != 1) goto err;
+#endif
 	printf("%s all tests passed\n", __FILE__);
 	return 0;
 err:
@@ -184,6 +184,84 @@ static int test_sm4_ctr32_encrypt_blocks(void)
 
 
 
+static int test_sm4_x8_set_encrypt_key(void)
+{
+	uint8_t raw_keys[SM4_X8_LANES][16];
+	SM4_X8_KEY x8_key;
+	SM4_KEY sm4_key;
+	int i, j;
+
+	rand_bytes((uint8_t *)raw_keys, sizeof(raw_keys));
+
+	sm4_x8_set_encrypt_key(&x8_key, raw_keys);
+	for (j = 0; j < SM4_X8_LANES; j++) {
+		sm4_set_encrypt_key(&sm4_key, raw_keys[j]);
+		for (i = 0; i < SM4_NUM_ROUNDS; i++) {
+			if (x8_key.rk[i][j] != sm4_key.rk[i]) {
+				error_print();
+				return -1;
+			}
+		}
+	}
+
+	sm4_x8_set_decrypt_key(&x8_key, raw_keys);
+	for (j = 0; j < SM4_X8_LANES; j++) {
+		sm4_set_decrypt_key(&sm4_key, raw_keys[j]);
+		for (i = 0; i < SM4_NUM_ROUNDS; i++) {
+			if (x8_key.rk[i][j] != sm4_key.rk[i]) {
+				error_print();
+				return -1;
+			}
+		}
+	}
+
+	printf("%s() ok\n", __FUNCTION__);
+	return 1;
+}
+
+static int test_sm4_multi_key_encrypt_blocks(void)
+{
+	uint8_t raw_keys[19][16];
+	uint8_t in[19 * 3 * 16];
+	uint8_t out[sizeof(in)];
+	uint8_t buf[sizeof(in)];
+	size_t nkeys[] = { 19, 16, 8, 3 };
+	size_t nblocks[] = { 1, 3 };
+	SM4_KEY sm4_key;
+	size_t i, j, k;
+
+	rand_bytes((uint8_t *)raw_keys, 10 * 16);
+	rand_bytes((uint8_t *)raw_keys + 10 * 16, 9 * 16);
+	for (i = 0; i < sizeof(in); i += 228) {
+		rand_bytes(in + i, 228);
+	}
+
+	for (i = 0; i < sizeof(nkeys)/sizeof(nkeys[0]); i++) {
+		for (j = 0; j < sizeof(nblocks)/sizeof(nblocks[0]); j++) {
+			size_t len = nkeys[i] * nblocks[j] * 16;
+
+			sm4_multi_key_encrypt_blocks(raw_keys, nkeys[i], in, nblocks[j], out);
+			for (k = 0; k < nkeys[i]; k++) {
+				sm4_set_encrypt_key(&sm4_key, raw_keys[k]);
+				sm4_encrypt_blocks(&sm4_key, in + k * nblocks[j] * 16, nblocks[j], buf + k * nblocks[j] * 16);
+			}
+			if (memcmp(out, buf, len) != 0) {
+				error_print();
+				return -1;
+			}
+
+			sm4_multi_key_decrypt_blocks(raw_keys, nkeys[i], out, nblocks[j], buf);
+			if (memcmp(buf, in, len) != 0) {
+				error_print();
+				return -1;
+			}
+		}
+	}
+
+	printf("%s() ok\n", __FUNCTION__);
+	return 1;
+}
+
 static int speed_sm4_encrypt(void)
 {
 	SM4_KEY sm4_key;
@@ -349,11 +427,46 @@ static int speed_sm4_ctr32_encrypt_blocks(void)
 
 
 
+static int speed_sm4_multi_key_encrypt_blocks(void)
+{
+	static uint8_t raw_keys[1024][16];
+	static uint8_t buf[1024][16];
+	SM4_KEY sm4_key;
+	clock_t begin, end;
+	double seconds;
+	int i, j;
+
+	begin = clock();
+	for (i = 0; i < 1024; i++) {
+		for (j = 0; j < 1024; j++) {
+			sm4_set_encrypt_key(&sm4_key, raw_keys[j]);
+			sm4_encrypt(&sm4_key, buf[j], buf[j]);
+		}
+	}
+	end = clock();
+
+	seconds = (double)(end - begin)/ CLOCKS_PER_SEC;
+	fprintf(stderr, "%s: sm4_set_encrypt_key + sm4_encrypt %f keys per second\n", __FUNCTION__, 1024*1024/seconds);
+
+	begin = clock();
+	for (i = 0; i < 1024; i++) {
+		sm4_multi_key_encrypt_blocks(raw_keys, 1024, (uint8_t *)buf, 1, (uint8_t *)buf);
+	}
+	end = clock();
+
+	seconds = (double)(end - begin)/ CLOCKS_PER_SEC;
+	fprintf(stderr, "%s: %f keys per second\n", __FUNCTION__, 1024*1024/seconds);
+
+	return 1;
+}
+
 int main(void)
 {
 	if (test_sm4() != 1) goto err;
 	if (test_sm4_encrypt_blocks() != 1) goto err;
 	if (test_sm4_ctr32_encrypt_blocks() != 1) goto err;
+	if (test_sm4_x8_set_encrypt_key() != 1) goto err;
+	if (test_sm4_multi_key_encrypt_blocks() != 1) goto err;
 #if ENABLE_TEST_SPEED
 	if (speed_sm4_encrypt() != 1) goto err;
 	if (speed_sm4_encrypt_blocks() != 1) goto err;
@@ -361,6 +474,7 @@ int main(void)
 	if (speed_sm4_cbc_decrypt_blocks() != 1) goto err;
 	if (speed_sm4_ctr_encrypt_blocks() != 1) goto err;
 	if (speed_sm4_ctr32_encrypt_blocks() != 1) goto err;
+	if (speed_sm4_multi_key_encrypt_blocks() != 1) goto err;
 #endif
 	printf("%s all tests passed\n", __FILE__);
 	return 0;
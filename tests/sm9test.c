@@ -191,6 +191,67 @@ err:
 	return -1;
 }
 
+#ifdef ENABLE_SM9_AMD64
+// cross-check the MULX/ADX mont_mul/mont_sqr with the generic C
+int test_sm9_z256_fp_adx() {
+	sm9_z256_t a[3 + 1000];
+	sm9_z256_t b[3 + 1000];
+	sm9_z256_t r_adx[3 + 1000];
+	sm9_z256_t s_adx[3 + 1000];
+	sm9_z256_t r, s;
+	size_t n = sizeof(a)/sizeof(a[0]);
+	size_t i;
+	int j = 1;
+
+	if (!sm9_z256_cpu_supports_adx()) {
+		printf("%s() skipped, no BMI2/ADX\n", __FUNCTION__);
+		return 1;
+	}
+
+	// 0, 1, p - 1 and random values
+	sm9_z256_set_zero(a[0]);
+	sm9_z256_set_zero(a[1]); a[1][0] = 1;
+	sm9_z256_copy(a[2], sm9_z256_prime()); a[2][0] -= 1;
+	for (i = 0; i < 3; i++) {
+		sm9_z256_copy(b[i], a[2 - i]);
+	}
+	for (i = 3; i < n; i++) {
+		if (sm9_z256_rand_range(a[i], sm9_z256_prime()) != 1) goto err;
+		if (sm9_z256_rand_range(b[i], sm9_z256_prime()) != 1) goto err;
+	}
+
+	if (sm9_z256_modp_set_adx(1) != 1) goto err; ++j;
+	for (i = 0; i < n; i++) {
+		sm9_z256_modp_mont_mul(r_adx[i], a[i], b[i]);
+		sm9_z256_modp_mont_sqr(s_adx[i], a[i]);
+	}
+
+	sm9_z256_modp_set_adx(0);
+	for (i = 0; i < n; i++) {
+		sm9_z256_modp_mont_mul(r, a[i], b[i]);
+		sm9_z256_modp_mont_sqr(s, a[i]);
+		if (sm9_z256_cmp(r, r_adx[i]) != 0 || sm9_z256_cmp(s, s_adx[i]) != 0) {
+			sm9_z256_modp_set_adx(1);
+			goto err;
+		}
+	}
+	++j;
+
+	// the test vectors with the generic C
+	if (test_sm9_z256_fp() != 1) goto err; ++j;
+	if (test_sm9_z256_fp2() != 1) goto err; ++j;
+	sm9_z256_modp_set_adx(1);
+
+	printf("%s() ok\n", __FUNCTION__);
+	return 1;
+err:
+	sm9_z256_modp_set_adx(1);
+	printf("%s() test %d failed\n", __FUNCTION__, j);
+	error_print();
+	return -1;
+}
+#endif
+
 #define hex_iv4 \
 	"123456789abcdef00fedcba987654321123456789abcdef00fedcba987654321\n" \
 	"a39654024e243d806e492768664a2b72d632457dd14f49a9f1fdd299c9bb073c\n" \
@@ -475,7 +536,7 @@ int test_sm9_z256_twist_point() {
 	SM9_Z256_TWIST_POINT r;
 	SM9_Z256_TWIST_POINT s;
 	sm9_z256_t k;
-	int j = 1;
+	int i, j = 1;
 
 	sm9_z256_from_hex(k, hex_iv);
 
@@ -489,6 +550,19 @@ int test_sm9_z256_twist_point() {
 	sm9_z256_twist_point_mul(&r, k, &p);  sm9_z256_twist_point_from_hex(&s, hex_tpoint_mul); if (!sm9_z256_twist_point_equ(&r, &s)) goto err; ++j;
 	sm9_z256_twist_point_mul_generator(&r, k);    sm9_z256_twist_point_from_hex(&s, hex_tpoint_mulg); if (!sm9_z256_twist_point_equ(&r, &s)) goto err; ++j;
 
+	sm9_z256_set_zero(k);
+	sm9_z256_twist_point_mul(&r, k, &p); if (!sm9_z256_twist_point_is_at_infinity(&r)) goto err; ++j;
+	sm9_z256_twist_point_mul_generator(&r, k); if (!sm9_z256_twist_point_is_at_infinity(&r)) goto err; ++j;
+	sm9_z256_sub(k, sm9_z256_order(), k); k[0] -= 1; // k = n - 1
+	sm9_z256_twist_point_mul_generator(&r, k); sm9_z256_twist_point_neg(&s, sm9_z256_twist_generator());
+	if (!sm9_z256_twist_point_equ(&r, &s)) goto err; ++j;
+	for (i = 0; i < 8; i++) {
+		sm9_z256_rand_range(k, sm9_z256_order());
+		sm9_z256_twist_point_mul_generator(&r, k);
+		sm9_z256_twist_point_mul(&s, k, sm9_z256_twist_generator());
+		if (!sm9_z256_twist_point_equ(&r, &s)) goto err;
+	} ++j;
+
 	printf("%s() ok\n", __FUNCTION__);
 	return 1;
 err:
@@ -569,6 +643,7 @@ static int test_sm9_z256_pairing_speed(void)
 		{1,0,0,0},
 	};
 	sm9_z256_fp12_t r;
+	SM9_Z256_PAIRING_PREP prep;
 
 	clock_t begin, end;
 	double seconds;
@@ -593,10 +668,118 @@ static int test_sm9_z256_pairing_speed(void)
 	seconds = (double)(end - begin)/CLOCKS_PER_SEC;
 
 	printf("%s: %d pairings per seconds\n", __FUNCTION__, (int)(256/seconds));
+
+	sm9_z256_pairing_prepare(&prep, &Ppubs);
+	begin = clock();
+	for (i = 0; i < 256; i++) {
+		sm9_z256_pairing_prepared(r, &prep, &P1);
+	}
+	end = clock();
+	seconds = (double)(end - begin)/CLOCKS_PER_SEC;
+
+	printf("%s: %d prepared pairings per seconds\n", __FUNCTION__, (int)(256/seconds));
+	return 1;
+}
+
+
+static int test_sm9_z256_pow_speed(void)
+{
+	SM9_Z256_FP12_POW_TABLE table;
+	sm9_z256_fp12_t g;
+	sm9_z256_fp12_t r;
+	sm9_z256_t k;
+	clock_t begin, end;
+	double seconds;
+	int i;
+
+	sm9_z256_pairing(g, sm9_z256_twist_generator(), sm9_z256_generator());
+	sm9_z256_fp12_pow_table_init(&table, g);
+	sm9_z256_rand_range(k, sm9_z256_order());
+
+	begin = clock();
+	for (i = 0; i < 256; i++) {
+		sm9_z256_fp12_pow(r, g, k);
+	}
+	end = clock();
+	seconds = (double)(end - begin)/CLOCKS_PER_SEC;
+	printf("%s: sm9_z256_fp12_pow %d per seconds\n", __FUNCTION__, (int)(256/seconds));
+
+	begin = clock();
+	for (i = 0; i < 256; i++) {
+		sm9_z256_fp12_cyclotomic_pow(r, g, k);
+	}
+	end = clock();
+	seconds = (double)(end - begin)/CLOCKS_PER_SEC;
+	printf("%s: sm9_z256_fp12_cyclotomic_pow %d per seconds\n", __FUNCTION__, (int)(256/seconds));
+
+	begin = clock();
+	for (i = 0; i < 4096; i++) {
+		sm9_z256_fp12_sqr(r, g);
+	}
+	end = clock();
+	seconds = (double)(end - begin)/CLOCKS_PER_SEC;
+	printf("%s: sm9_z256_fp12_sqr %d per seconds\n", __FUNCTION__, (int)(4096/seconds));
+
+	begin = clock();
+	for (i = 0; i < 4096; i++) {
+		sm9_z256_fp12_cyclotomic_sqr(r, g);
+	}
+	end = clock();
+	seconds = (double)(end - begin)/CLOCKS_PER_SEC;
+	printf("%s: sm9_z256_fp12_cyclotomic_sqr %d per seconds\n", __FUNCTION__, (int)(4096/seconds));
+
+	begin = clock();
+	for (i = 0; i < 4096; i++) {
+		sm9_z256_fp12_compressed_sqr(r, g);
+	}
+	end = clock();
+	seconds = (double)(end - begin)/CLOCKS_PER_SEC;
+	printf("%s: sm9_z256_fp12_compressed_sqr %d per seconds\n", __FUNCTION__, (int)(4096/seconds));
+
+	begin = clock();
+	for (i = 0; i < 256; i++) {
+		sm9_z256_fp12_decompress(r, g);
+	}
+	end = clock();
+	seconds = (double)(end - begin)/CLOCKS_PER_SEC;
+	printf("%s: sm9_z256_fp12_decompress %d per seconds\n", __FUNCTION__, (int)(256/seconds));
+
+	begin = clock();
+	for (i = 0; i < 256; i++) {
+		sm9_z256_fp12_pow_with_table(r, &table, k);
+	}
+	end = clock();
+	seconds = (double)(end - begin)/CLOCKS_PER_SEC;
+	printf("%s: sm9_z256_fp12_pow_with_table %d per seconds\n", __FUNCTION__, (int)(256/seconds));
 	return 1;
 }
+static int test_sm9_z256_twist_point_mul_speed(void)
+{
+	SM9_Z256_TWIST_POINT P;
+	sm9_z256_t k;
+	clock_t begin, end;
+	double seconds;
+	int i;
 
+	sm9_z256_rand_range(k, sm9_z256_order());
 
+	begin = clock();
+	for (i = 0; i < 1024; i++) {
+		sm9_z256_twist_point_mul(&P, k, sm9_z256_twist_generator());
+	}
+	end = clock();
+	seconds = (double)(end - begin)/CLOCKS_PER_SEC;
+	printf("%s: sm9_z256_twist_point_mul %d per seconds\n", __FUNCTION__, (int)(1024/seconds));
+
+	begin = clock();
+	for (i = 0; i < 1024; i++) {
+		sm9_z256_twist_point_mul_generator(&P, k);
+	}
+	end = clock();
+	seconds = (double)(end - begin)/CLOCKS_PER_SEC;
+	printf("%s: sm9_z256_twist_point_mul_generator %d per seconds\n", __FUNCTION__, (int)(1024/seconds));
+	return 1;
+}
 
 int test_sm9_z256_pairing()
 {
@@ -628,8 +811,13 @@ int test_sm9_z256_pairing()
 	SM9_Z256_POINT q;
 	sm9_z256_fp12_t r;
 	sm9_z256_fp12_t s;
+	sm9_z256_fp12_t t;
 	sm9_z256_t k;
-	int j = 1;
+	SM9_Z256_FP12_POW_TABLE table;
+	SM9_Z256_PAIRING_PREP prep;
+	SM9_Z256_PAIRING_PAIR pairs[5];
+	SM9_Z256_POINT Ppube;
+	int i, j = 1;
 	
 	sm9_z256_modp_to_mont(P1->X, P1->X);
 	sm9_z256_modp_to_mont(P1->Y, P1->Y);
@@ -651,10 +839,51 @@ int test_sm9_z256_pairing()
 
 	sm9_z256_twist_point_from_hex(&p, hex_deB); sm9_z256_point_from_hex(&q, hex_RA);
 	sm9_z256_pairing(r, &p, &q); sm9_z256_fp12_from_hex(s, hex_pairing2); if (!sm9_z256_fp12_equ(r, s)) goto err; ++j;
+	sm9_z256_pairing_prepare(&prep, &p); sm9_z256_pairing_prepared(r, &prep, &q); if (!sm9_z256_fp12_equ(r, s)) goto err; ++j;
+
+	// e(deB, RA) * e(Ppubs, P1) * e(P2, Ppube) * e(deB, Ppube) * e(Ppubs, RA)
+	pairs[0].Q = &p; pairs[0].P = &q;
+	pairs[1].Q = Ppubs; pairs[1].P = P1;
+	pairs[2].Q = P2; pairs[2].P = &Ppube;
+	pairs[3].Q = &p; pairs[3].P = &Ppube;
+	pairs[4].Q = Ppubs; pairs[4].P = &q;
+	sm9_z256_point_from_hex(&Ppube, hex_Ppube);
+	sm9_z256_fp12_set_one(t);
+	for (i = 0; i < 5; i++) {
+		sm9_z256_pairing(r, pairs[i].Q, pairs[i].P);
+		sm9_z256_fp12_mul(t, t, r);
+	}
+	sm9_z256_pairing_product(r, pairs, 5); if (!sm9_z256_fp12_equ(r, t)) goto err; ++j;
+	sm9_z256_pairing_prepare(&prep, Ppubs); sm9_z256_pairing_prepared(r, &prep, P1);
+	sm9_z256_fp12_from_hex(s, hex_pairing1); if (!sm9_z256_fp12_equ(r, s)) goto err; ++j;
 
 	sm9_z256_from_hex(k, rB); sm9_z256_point_from_hex(&q, hex_Ppube);
 	sm9_z256_pairing(r, P2, &q); sm9_z256_fp12_pow(r, r, k); sm9_z256_fp12_from_hex(s, hex_pairing3); if (!sm9_z256_fp12_equ(r, s)) goto err; ++j;
 
+	sm9_z256_pairing(r, P2, &q); sm9_z256_fp12_pow_table_init(&table, r);
+	sm9_z256_fp12_pow_with_table(r, &table, k); if (!sm9_z256_fp12_equ(r, s)) goto err; ++j;
+	sm9_z256_fp12_sqr(r, s); sm9_z256_fp12_cyclotomic_sqr(t, s); if (!sm9_z256_fp12_equ(r, t)) goto err; ++j;
+	for (i = 0; i < 64; i++) sm9_z256_fp12_sqr(r, r);
+	sm9_z256_fp12_compressed_sqr(t, s);
+	for (i = 0; i < 64; i++) sm9_z256_fp12_compressed_sqr(t, t);
+	sm9_z256_fp12_decompress(t, t); if (!sm9_z256_fp12_equ(r, t)) goto err; ++j;
+	sm9_z256_fp12_cyclotomic_sqr_n(t, s, 65); if (!sm9_z256_fp12_equ(r, t)) goto err; ++j;
+	for (i = 0; i < 8; i++) {
+		if (sm9_z256_rand_range(k, sm9_z256_order()) != 1) goto err;
+		memset(k + 4 - i % 4, 0, sizeof(uint64_t) * (i % 4)); // short exponents
+		sm9_z256_fp12_pow(r, s, k);
+		sm9_z256_fp12_cyclotomic_pow(t, s, k);
+		if (!sm9_z256_fp12_equ(r, t)) goto err;
+	} ++j;
+
+	sm9_z256_fp12_pow_table_init(&table, s);
+	for (i = 0; i < 8; i++) {
+		if (sm9_z256_rand_range(k, sm9_z256_order()) != 1) goto err;
+		sm9_z256_fp12_pow(r, s, k);
+		sm9_z256_fp12_pow_with_table(t, &table, k);
+		if (!sm9_z256_fp12_equ(r, t)) goto err;
+	} ++j;
+
 	printf("%s() ok\n", __FUNCTION__);
 	return 1;
 err:
@@ -703,6 +932,84 @@ err:
 	return -1;
 }
 
+int test_sm9_z256_sign_prepared()
+{
+	SM9_SIGN_CTX ctx;
+	SM9_SIGN_KEY key;
+	SM9_SIGN_MASTER_KEY msk;
+	SM9_SIGN_MASTER_KEY_PREP prep;
+	uint8_t sig[1000] = {0};
+	size_t siglen = 0;
+	SM9_VERIFY_JOB jobs[4];
+	uint8_t sigs[4][SM9_SIGNATURE_SIZE];
+	uint8_t msgs[4][20];
+	int i, j = 1;
+
+	uint8_t data[20] = {0x43, 0x68, 0x69, 0x6E, 0x65, 0x73, 0x65, 0x20, 0x49, 0x42, 0x53, 0x20, 0x73, 0x74, 0x61, 0x6E, 0x64, 0x61, 0x72, 0x64};
+	uint8_t IDA[5] = {0x41, 0x6C, 0x69, 0x63, 0x65};
+
+	sm9_z256_from_hex(msk.ks, hex_ks); sm9_z256_twist_point_mul_generator(&(msk.Ppubs), msk.ks);
+	if (sm9_sign_master_key_extract_key(&msk, (char *)IDA, sizeof(IDA), &key) < 0) goto err; ++j;
+	if (sm9_sign_master_public_key_prepare(&prep, &msk) != 1) goto err; ++j;
+
+	// prepared sign, normal verify
+	sm9_sign_init(&ctx);
+	sm9_sign_update(&ctx, data, sizeof(data));
+	if (sm9_sign_finish_prepared(&ctx, &key, &prep, sig, &siglen) != 1) goto err; ++j;
+
+	sm9_verify_init(&ctx);
+	sm9_verify_update(&ctx, data, sizeof(data));
+	if (sm9_verify_finish(&ctx, sig, siglen, &msk, (char *)IDA, sizeof(IDA)) != 1) goto err; ++j;
+
+	// normal sign, prepared verify
+	sm9_sign_init(&ctx);
+	sm9_sign_update(&ctx, data, sizeof(data));
+	if (sm9_sign_finish(&ctx, &key, sig, &siglen) != 1) goto err; ++j;
+
+	sm9_verify_init(&ctx);
+	sm9_verify_update(&ctx, data, sizeof(data));
+	if (sm9_verify_finish_prepared(&ctx, sig, siglen, &prep, (char *)IDA, sizeof(IDA)) != 1) goto err; ++j;
+
+	// wrong identity
+	sm9_verify_init(&ctx);
+	sm9_verify_update(&ctx, data, sizeof(data));
+	if (sm9_verify_finish_prepared(&ctx, sig, siglen, &prep, (char *)IDA, sizeof(IDA) - 1) != 0) goto err; ++j;
+
+	// batch verify, the third signature is of another message
+	for (i = 0; i < 4; i++) {
+		data[0] = (uint8_t)i;
+		sm9_sign_init(&ctx);
+		sm9_sign_update(&ctx, data, sizeof(data));
+		if (sm9_sign_finish_prepared(&ctx, &key, &prep, sigs[i], &jobs[i].siglen) != 1) goto err;
+		jobs[i].id = (char *)IDA;
+		jobs[i].idlen = sizeof(IDA);
+		jobs[i].msg = msgs[i];
+		jobs[i].msglen = sizeof(data);
+		jobs[i].sig = sigs[i];
+		memcpy(msgs[i], data, sizeof(data));
+	}
+	msgs[2][1] ^= 1;
+	if (sm9_verify_many(&msk, jobs, 4) != 0) goto err;
+	for (i = 0; i < 4; i++) {
+		if (jobs[i].ret != (i == 2 ? 0 : 1)) goto err;
+	} ++j;
+	msgs[2][1] ^= 1;
+	if (sm9_verify_many(&msk, jobs, 4) != 1) goto err; ++j;
+
+	// key of another master
+	prep.Ppubs = *sm9_z256_twist_generator();
+	sm9_sign_init(&ctx);
+	sm9_sign_update(&ctx, data, sizeof(data));
+	if (sm9_sign_finish_prepared(&ctx, &key, &prep, sig, &siglen) != -1) goto err; ++j;
+
+	printf("%s() ok\n", __FUNCTION__);
+	return 1;
+err:
+	printf("%s test %d failed\n", __FUNCTION__, j);
+	error_print();
+	return -1;
+}
+
 #define hex_ke		"0001EDEE3778F441F8DEA3D9FA0ACC4E07EE36C93F9A08618AF4AD85CEDE1C22"
 
 #define hex_de \
@@ -778,6 +1085,109 @@ err:
 	return -1;
 }
 
+int test_sm9_z256_encrypt_prepared()
+{
+	SM9_ENC_MASTER_KEY msk;
+	SM9_ENC_MASTER_KEY_PREP prep;
+	SM9_ENC_KEY key;
+	SM9_ENC_KEY_PREP key_prep;
+	uint8_t out[1000] = {0};
+	size_t outlen = 0;
+	int i, j = 1;
+
+	uint8_t data[20] = {0x43, 0x68, 0x69, 0x6E, 0x65, 0x73, 0x65, 0x20, 0x49, 0x42, 0x53, 0x20, 0x73, 0x74, 0x61, 0x6E, 0x64, 0x61, 0x72, 0x64};
+	uint8_t dec[20] = {0};
+	size_t declen = 20;
+	uint8_t IDB[3] = {0x42, 0x6F, 0x62};
+
+	sm9_z256_from_hex(msk.ke, hex_ke);
+	sm9_z256_point_mul_generator(&(msk.Ppube), msk.ke);
+
+	if (sm9_enc_master_key_extract_key(&msk, (char *)IDB, sizeof(IDB), &key) < 0) goto err; ++j;
+	if (sm9_enc_master_public_key_prepare(&prep, &msk) != 1) goto err; ++j;
+
+	for (i = 0; i < 4; i++) {
+		if (sm9_encrypt_prepared(&prep, (char *)IDB, sizeof(IDB), data, sizeof(data), out, &outlen) != 1) goto err;
+		if (sm9_decrypt(&key, (char *)IDB, sizeof(IDB), out, outlen, dec, &declen) != 1) goto err;
+		if (declen != sizeof(data) || memcmp(data, dec, sizeof(data)) != 0) goto err;
+	} ++j;
+
+	if (sm9_enc_key_prepare(&key_prep, &key) != 1) goto err; ++j;
+	for (i = 0; i < 4; i++) {
+		if (sm9_encrypt(&msk, (char *)IDB, sizeof(IDB), data, sizeof(data), out, &outlen) != 1) goto err;
+		memset(dec, 0, sizeof(dec));
+		if (sm9_decrypt_prepared(&key_prep, (char *)IDB, sizeof(IDB), out, outlen, dec, &declen) != 1) goto err;
+		if (declen != sizeof(data) || memcmp(data, dec, sizeof(data)) != 0) goto err;
+	} ++j;
+	sm9_enc_key_prep_cleanup(&key_prep);
+
+	printf("%s() ok\n", __FUNCTION__);
+	return 1;
+err:
+	printf("%s test %d failed\n", __FUNCTION__, j);
+	error_print();
+	return -1;
+}
+
+int test_sm9_z256_extract_keys()
+{
+	SM9_SIGN_MASTER_KEY sign_msk;
+	SM9_ENC_MASTER_KEY enc_msk;
+	SM9_SIGN_KEY sign_key;
+	SM9_ENC_KEY enc_key;
+	SM9_SIGN_KEY sign_keys[70];
+	SM9_ENC_KEY enc_keys[70];
+	char idbuf[70][16];
+	const char *ids[70];
+	size_t idlens[70];
+	size_t n = sizeof(ids)/sizeof(ids[0]);
+	size_t i;
+	int j = 1;
+
+	sm9_z256_from_hex(sign_msk.ks, hex_ks); sm9_z256_twist_point_mul_generator(&(sign_msk.Ppubs), sign_msk.ks);
+	sm9_z256_from_hex(enc_msk.ke, hex_ke); sm9_z256_point_mul_generator(&(enc_msk.Ppube), enc_msk.ke);
+
+	// more than SM9_EXTRACT_BATCH_SIZE ids
+	for (i = 0; i < n; i++) {
+		snprintf(idbuf[i], sizeof(idbuf[i]), "user%zu", i);
+		ids[i] = idbuf[i];
+		idlens[i] = strlen(idbuf[i]);
+	}
+
+	if (sm9_sign_master_key_extract_keys(&sign_msk, ids, idlens, n, sign_keys) != 1) goto err; ++j;
+	if (sm9_enc_master_key_extract_keys(&enc_msk, ids, idlens, n, enc_keys) != 1) goto err; ++j;
+	for (i = 0; i < n; i++) {
+		if (sm9_sign_master_key_extract_key(&sign_msk, ids[i], idlens[i], &sign_key) != 1) goto err;
+		if (!sm9_z256_point_equ(&sign_key.ds, &sign_keys[i].ds)) goto err;
+		if (!sm9_z256_twist_point_equ(&sign_key.Ppubs, &sign_keys[i].Ppubs)) goto err;
+		if (sm9_enc_master_key_extract_key(&enc_msk, ids[i], idlens[i], &enc_key) != 1) goto err;
+		if (!sm9_z256_twist_point_equ(&enc_key.de, &enc_keys[i].de)) goto err;
+		if (!sm9_z256_point_equ(&enc_key.Ppube, &enc_keys[i].Ppube)) goto err;
+	}
+	++j;
+
+#ifdef ENABLE_PTHREAD
+	memset(sign_keys, 0, sizeof(sign_keys));
+	memset(enc_keys, 0, sizeof(enc_keys));
+	if (sm9_sign_master_key_extract_keys_threads(&sign_msk, ids, idlens, n, sign_keys, 4) != 1) goto err; ++j;
+	if (sm9_enc_master_key_extract_keys_threads(&enc_msk, ids, idlens, n, enc_keys, 4) != 1) goto err; ++j;
+	for (i = 0; i < n; i++) {
+		if (sm9_sign_master_key_extract_key(&sign_msk, ids[i], idlens[i], &sign_key) != 1) goto err;
+		if (!sm9_z256_point_equ(&sign_key.ds, &sign_keys[i].ds)) goto err;
+		if (sm9_enc_master_key_extract_key(&enc_msk, ids[i], idlens[i], &enc_key) != 1) goto err;
+		if (!sm9_z256_twist_point_equ(&enc_key.de, &enc_keys[i].de)) goto err;
+	}
+	++j;
+#endif
+
+	printf("%s() ok\n", __FUNCTION__);
+	return 1;
+err:
+	printf("%s test %d failed\n", __FUNCTION__, j);
+	error_print();
+	return -1;
+}
+
 #define hex_kex		"0002E65B0762D042F51F0D23542B13ED8CFA2E9A0E7206361E013A283905E31F"
 
 #define hex_deA \
@@ -836,6 +1246,9 @@ int main(void) {
 	if (test_sm9_z256_fp() != 1) goto err;
 	if (test_sm9_z256_fn() != 1) goto err;
 	if (test_sm9_z256_fp2() != 1) goto err;
+#ifdef ENABLE_SM9_AMD64
+	if (test_sm9_z256_fp_adx() != 1) goto err;
+#endif
 	if (test_sm9_z256_fp4() != 1) goto err;
 	if (test_sm9_z256_fp12() != 1) goto err;
 	if (test_sm9_z256_point() != 1) goto err;
@@ -845,7 +1258,12 @@ int main(void) {
 	if (test_sm9_z256_ciphertext() != 1) goto err;
 	if (test_sm9_z256_encrypt() != 1) goto err;
 	if (test_sm9_z256_exchange() != 1) goto err;
+	if (test_sm9_z256_sign_prepared() != 1) goto err;
+	if (test_sm9_z256_encrypt_prepared() != 1) goto err;
+	if (test_sm9_z256_extract_keys() != 1) goto err;
 	if (test_sm9_z256_pairing_speed() != 1) goto err;
+	if (test_sm9_z256_pow_speed() != 1) goto err;
+	if (test_sm9_z256_twist_point_mul_speed() != 1) goto err;
 
 	printf("%s all tests passed\n", __FILE__);
 	return 0;
@@ -437,6 +437,218 @@ static int test_x509_cert_revoke(void)
 	return 1;
 }
 
+#define TEST_CRL_INDEX_COUNT 1000
+
+// thisUpdate is now, nextUpdate a day later
+static int test_gen_crl(uint8_t *crl, size_t *crl_len, const SM2_KEY *key,
+	uint8_t serials[][20], size_t *serial_lens, size_t cnt, time_t now)
+{
+	uint8_t issuer[256];
+	size_t issuer_len;
+	uint8_t *revoked_certs;
+	uint8_t *p;
+	size_t revoked_certs_len = 0;
+	size_t i;
+
+	if (!(revoked_certs = (uint8_t *)malloc(cnt * 64))) {
+		error_print();
+		return -1;
+	}
+	p = revoked_certs;
+	for (i = 0; i < cnt; i++) {
+		rand_bytes(serials[i], 20);
+		serial_lens[i] = 8 + serials[i][19] % 13;
+		serials[i][0] = (serials[i][0] & 0x7f) | 0x01;
+		if (x509_revoked_cert_to_der_ex(serials[i], serial_lens[i], now - (time_t)i,
+			(i % 2) ? X509_cr_key_compromise : -1, -1, NULL, 0, &p, &revoked_certs_len) != 1) {
+			error_print();
+			free(revoked_certs);
+			return -1;
+		}
+	}
+	*crl_len = 0;
+	p = crl;
+	if (x509_name_set(issuer, &issuer_len, sizeof(issuer), "CN", "Beijing", "Haidian", "PKU", "CS", "CA") != 1
+		|| x509_crl_sign_to_der(X509_version_v2, OID_sm2sign_with_sm3,
+			issuer, issuer_len, now, now + 86400,
+			revoked_certs, revoked_certs_len,
+			NULL, 0,
+			key, SM2_DEFAULT_ID, SM2_DEFAULT_ID_LENGTH,
+			&p, crl_len) != 1) {
+		error_print();
+		free(revoked_certs);
+		return -1;
+	}
+	free(revoked_certs);
+	return 1;
+}
+
+static int test_x509_crl_index_lookup(const X509_CRL_INDEX *index,
+	uint8_t serials[][20], const size_t *serial_lens, size_t cnt)
+{
+	uint8_t serial[20];
+	time_t revoke_date;
+	int reason;
+	size_t i;
+
+	for (i = 0; i < cnt; i++) {
+		if (x509_crl_index_find_revoked_cert_by_serial_number(index, serials[i], serial_lens[i],
+				&revoke_date, &reason) != 1
+			|| reason != ((i % 2) ? X509_cr_key_compromise : -1)) {
+			error_print();
+			return -1;
+		}
+		// same bytes but shorter, not revoked
+		if (x509_crl_index_find_revoked_cert_by_serial_number(index, serials[i], serial_lens[i] - 1,
+				&revoke_date, &reason) != 0
+			|| revoke_date != -1) {
+			error_print();
+			return -1;
+		}
+	}
+	for (i = 0; i < cnt; i++) {
+		rand_bytes(serial, sizeof(serial));
+		serial[0] |= 0x80; // not generated by test_gen_crl
+		if (x509_crl_index_find_revoked_cert_by_serial_number(index, serial, sizeof(serial),
+			&revoke_date, &reason) != 0) {
+			error_print();
+			return -1;
+		}
+	}
+	return 1;
+}
+
+static int test_x509_crl_index(void)
+{
+	SM2_KEY key;
+	uint8_t *crl = NULL;
+	size_t crl_len;
+	uint8_t (*serials)[20] = NULL;
+	size_t *serial_lens = NULL;
+	X509_CRL_INDEX index;
+	X509_CRL_INDEX mapped;
+	X509_CRL_INDEX_SLOT slot;
+	const uint8_t *issuer;
+	size_t issuer_len;
+	const uint8_t *crl_issuer;
+	size_t crl_issuer_len;
+	time_t revoke_date;
+	time_t revoke_date2;
+	const uint8_t *entry_exts;
+	size_t entry_exts_len;
+	int reason;
+	const char *file = "crl_index.bin";
+	int ret = -1;
+
+	memset(&index, 0, sizeof(index));
+	memset(&mapped, 0, sizeof(mapped));
+	memset(&slot, 0, sizeof(slot));
+
+	if (!(crl = (uint8_t *)malloc(TEST_CRL_INDEX_COUNT * 64 + 1024))
+		|| !(serials = malloc(sizeof(*serials) * TEST_CRL_INDEX_COUNT))
+		|| !(serial_lens = (size_t *)malloc(sizeof(size_t) * TEST_CRL_INDEX_COUNT))) {
+		error_print();
+		goto end;
+	}
+	if (sm2_key_generate(&key) != 1
+		|| test_gen_crl(crl, &crl_len, &key, serials, serial_lens, TEST_CRL_INDEX_COUNT, time(NULL)) != 1) {
+		error_print();
+		goto end;
+	}
+
+	if (x509_crl_index_build(&index, crl, crl_len) != 1
+		|| index.entries_cnt != TEST_CRL_INDEX_COUNT
+		|| test_x509_crl_index_lookup(&index, serials, serial_lens, TEST_CRL_INDEX_COUNT) != 1) {
+		error_print();
+		goto end;
+	}
+	// same answer as the linear search
+	if (x509_crl_find_revoked_cert_by_serial_number(crl, crl_len, serials[7], serial_lens[7],
+			&revoke_date, &entry_exts, &entry_exts_len) != 1
+		|| x509_crl_index_find_revoked_cert_by_serial_number(&index, serials[7], serial_lens[7],
+			&revoke_date2, &reason) != 1
+		|| revoke_date != revoke_date2) {
+		error_print();
+		goto end;
+	}
+	if (x509_crl_get_issuer(crl, crl_len, &crl_issuer, &crl_issuer_len) != 1
+		|| x509_crl_index_get_issuer(&index, &issuer, &issuer_len) != 1
+		|| issuer_len != crl_issuer_len
+		|| memcmp(issuer, crl_issuer, issuer_len) != 0) {
+		error_print();
+		goto end;
+	}
+
+	// cache file
+	if (x509_crl_index_to_file(&index, file) != 1
+		|| x509_crl_index_from_file(&mapped, file) != 1
+		|| mapped.entries_cnt != TEST_CRL_INDEX_COUNT
+		|| memcmp(mapped.header->crl_digest, index.header->crl_digest, 32) != 0
+		|| test_x509_crl_index_lookup(&mapped, serials, serial_lens, TEST_CRL_INDEX_COUNT) != 1) {
+		error_print();
+		goto end;
+	}
+	x509_crl_index_cleanup(&mapped);
+
+	// the slot is loaded from the cache, then refreshed with a new CRL
+	if (x509_crl_index_slot_init(&slot, file) != 1
+		|| x509_crl_index_slot_find_revoked_cert_by_serial_number(&slot, serials[1], serial_lens[1],
+			&revoke_date, &reason) != 1) {
+		error_print();
+		goto end;
+	}
+	if (test_gen_crl(crl, &crl_len, &key, serials, serial_lens, TEST_CRL_INDEX_COUNT / 2, time(NULL)) != 1
+		|| x509_crl_index_slot_refresh(&slot, crl, crl_len, file) != 1
+		|| test_x509_crl_index_lookup(slot.index, serials, serial_lens, TEST_CRL_INDEX_COUNT / 2) != 1) {
+		error_print();
+		goto end;
+	}
+	x509_crl_index_slot_cleanup(&slot);
+	if (x509_crl_index_slot_init(&slot, file) != 1
+		|| slot.index->entries_cnt != TEST_CRL_INDEX_COUNT / 2) {
+		error_print();
+		goto end;
+	}
+
+	// an unwritable cache does not keep the new CRL from the lookups
+	if (test_gen_crl(crl, &crl_len, &key, serials, serial_lens, TEST_CRL_INDEX_COUNT, time(NULL)) != 1
+		|| x509_crl_index_slot_refresh(&slot, crl, crl_len, "/nonexistent/crl_index.bin") != 0
+		|| test_x509_crl_index_lookup(slot.index, serials, serial_lens, TEST_CRL_INDEX_COUNT) != 1) {
+		error_print();
+		goto end;
+	}
+
+	// nextUpdate has passed, the cache is not loaded and the lookups fail
+	x509_crl_index_slot_cleanup(&slot);
+	if (test_gen_crl(crl, &crl_len, &key, serials, serial_lens, 16, time(NULL) - 2 * 86400) != 1
+		|| x509_crl_index_slot_init(&slot, NULL) != 1
+		|| x509_crl_index_slot_refresh(&slot, crl, crl_len, file) != 1
+		|| x509_crl_index_check_time(slot.index, time(NULL)) != 0
+		|| x509_crl_index_slot_find_revoked_cert_by_serial_number(&slot, serials[1], serial_lens[1],
+			&revoke_date, &reason) != -1) {
+		error_print();
+		goto end;
+	}
+	x509_crl_index_slot_cleanup(&slot);
+	if (x509_crl_index_slot_init(&slot, file) != 1
+		|| slot.index != NULL) {
+		error_print();
+		goto end;
+	}
+
+	printf("%s() ok\n", __FUNCTION__);
+	ret = 1;
+end:
+	x509_crl_index_cleanup(&index);
+	x509_crl_index_cleanup(&mapped);
+	x509_crl_index_slot_cleanup(&slot);
+	remove(file);
+	if (crl) free(crl);
+	if (serials) free(serials);
+	if (serial_lens) free(serial_lens);
+	return ret;
+}
+
 /*
 	http://mscrl.microsoft.com/pki/mscorp/crl/Microsoft%20RSA%20TLS%20CA%2002.crl
 	http://crl.microsoft.com/pki/mscorp/crl/Microsoft%20RSA%20TLS%20CA%2002.crl
@@ -454,6 +666,7 @@ int main(void)
 	if (test_x509_issuing_distribution_point() != 1) goto err;
 	if (test_x509_issuing_distribution_point_from_der() != 1) goto err;
 	if (test_x509_crl_exts() != 1) goto err;
+	if (test_x509_crl_index() != 1) goto err;
 	printf("%s all tests passed\n", __FILE__);
 	return 0;
 err:
@@ -0,0 +1,183 @@
+/*
+ *  Copyright 2014-2024 The GmSSL Project. All Rights Reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the License); you may
+ *  not use this file except in compliance with the License.
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+#include <gmssl/oid.h>
+#include <gmssl/x509.h>
+#include <gmssl/x509_ext.h>
+#include <gmssl/x509_req.h>
+#include <gmssl/x509_issue.h>
+#include <gmssl/rand.h>
+#include <gmssl/error.h>
+
+
+#define TEST_ISSUE_CNT	8
+
+static int test_x509_certs_issue(void)
+{
+	SM2_KEY ca_key;
+	SM2_KEY other_key;
+	SM2_KEY keys[TEST_ISSUE_CNT];
+	uint8_t name[256];
+	size_t namelen;
+	uint8_t serial[12] = {1};
+	time_t not_before, not_after;
+	uint8_t *cacert = NULL;
+	size_t cacertlen;
+	uint8_t attrs[1]; // empty attributes
+	uint8_t exts[256];
+	size_t extslen = 0;
+	uint8_t *reqs[TEST_ISSUE_CNT] = {0};
+	size_t reqlens[TEST_ISSUE_CNT];
+	X509_ISSUE_ITEM items[TEST_ISSUE_CNT];
+	X509_ISSUE_CTX ctx;
+	int ret = -1;
+	int nthreads;
+	int i;
+
+	memset(&ctx, 0, sizeof(ctx));
+	memset(items, 0, sizeof(items));
+
+	time(&not_before);
+	x509_validity_add_days(&not_after, not_before, 365);
+
+	if (sm2_key_generate(&ca_key) != 1
+		|| sm2_key_generate(&other_key) != 1
+		|| x509_name_set(name, &namelen, sizeof(name), "CN", "Beijing", "Haidian", "PKU", "CS", "CA") != 1
+		|| x509_cert_sign_new(&cacert, &cacertlen, X509_version_v3,
+			serial, sizeof(serial), OID_sm2sign_with_sm3,
+			name, namelen, not_before, not_after, name, namelen, &ca_key,
+			NULL, 0, NULL, 0, NULL, 0,
+			&ca_key, SM2_DEFAULT_ID, SM2_DEFAULT_ID_LENGTH) != 1) {
+		error_print();
+		goto end;
+	}
+
+	for (i = 0; i < TEST_ISSUE_CNT; i++) {
+		char cn[16];
+
+		snprintf(cn, sizeof(cn), "Alice%d", i);
+		if (sm2_key_generate(&keys[i]) != 1
+			|| x509_name_set(name, &namelen, sizeof(name), "CN", "Beijing", "Haidian", "PKU", "CS", cn) != 1
+			|| x509_req_sign_new(&reqs[i], &reqlens[i], X509_version_v1,
+				name, namelen, &keys[i], attrs, 0, OID_sm2sign_with_sm3,
+				&keys[i], SM2_DEFAULT_ID, SM2_DEFAULT_ID_LENGTH) != 1) {
+			error_print();
+			goto end;
+		}
+	}
+	// tampered CSR
+	reqs[3][reqlens[3] - 1] ^= 1;
+
+	// the key must match the CA certificate
+	if (x509_issue_ctx_init(&ctx, cacert, cacertlen, &other_key, NULL, 0, NULL, 0,
+		not_before, not_after, NULL, 0, 1, 12) == 1) {
+		error_print();
+		goto end;
+	}
+	// short serial numbers are guessable
+	if (x509_issue_ctx_init(&ctx, cacert, cacertlen, &ca_key, NULL, 0, NULL, 0,
+		not_before, not_after, NULL, 0, 1, X509_ISSUE_MIN_SERIAL_SIZE - 1) == 1) {
+		error_print();
+		goto end;
+	}
+
+	if (x509_exts_add_key_usage(exts, &extslen, sizeof(exts), X509_critical, X509_KU_DIGITAL_SIGNATURE) != 1
+		|| x509_issue_ctx_init(&ctx, cacert, cacertlen, &ca_key, NULL, 0, NULL, 0,
+			not_before, not_after, exts, extslen, 1, 12) != 1) {
+		error_print();
+		goto end;
+	}
+
+	for (nthreads = 1; nthreads <= 3; nthreads++) {
+		for (i = 0; i < TEST_ISSUE_CNT; i++) {
+			items[i].req = reqs[i];
+			items[i].reqlen = reqlens[i];
+		}
+#ifdef ENABLE_PTHREAD
+		if (x509_certs_issue_threads(&ctx, items, TEST_ISSUE_CNT, nthreads) != 1) {
+			error_print();
+			goto end;
+		}
+#else
+		if (x509_certs_issue(&ctx, items, TEST_ISSUE_CNT) != 1) {
+			error_print();
+			goto end;
+		}
+#endif
+		for (i = 0; i < TEST_ISSUE_CNT; i++) {
+			const uint8_t *cert_serial;
+			size_t cert_serial_len;
+			const uint8_t *issuer;
+			size_t issuer_len;
+			const uint8_t *cert_exts;
+			size_t cert_exts_len;
+			SM2_KEY public_key;
+			int critical;
+			const uint8_t *val;
+			size_t vlen;
+
+			if (i == 3) {
+				if (items[i].status != X509_ISSUE_BAD_SIGNATURE || items[i].cert) {
+					error_print();
+					goto end;
+				}
+				continue;
+			}
+			if (items[i].status != X509_ISSUE_OK
+				|| x509_signed_verify(items[i].cert, items[i].certlen,
+					&ca_key, SM2_DEFAULT_ID, SM2_DEFAULT_ID_LENGTH) != 1
+				|| x509_signed_verify_by_ca_cert(items[i].cert, items[i].certlen,
+					cacert, cacertlen, SM2_DEFAULT_ID, SM2_DEFAULT_ID_LENGTH) != 1
+				|| x509_cert_get_details(items[i].cert, items[i].certlen,
+					NULL, &cert_serial, &cert_serial_len, NULL,
+					&issuer, &issuer_len, NULL, NULL, NULL, NULL, &public_key,
+					NULL, NULL, NULL, NULL, &cert_exts, &cert_exts_len,
+					NULL, NULL, NULL) != 1) {
+				error_print();
+				goto end;
+			}
+			if (cert_serial_len != 12 || (cert_serial[0] & 0x80)
+				|| sm2_public_key_equ(&keys[i], &public_key) != 1
+				|| issuer_len != ctx.issuer_len || memcmp(issuer, ctx.issuer, issuer_len) != 0
+				|| x509_exts_get_ext_by_oid(cert_exts, cert_exts_len, OID_ce_key_usage,
+					&critical, &val, &vlen) != 1
+				|| x509_exts_get_ext_by_oid(cert_exts, cert_exts_len, OID_ce_subject_key_identifier,
+					&critical, &val, &vlen) != 1) {
+				error_print();
+				goto end;
+			}
+		}
+		x509_issue_items_cleanup(items, TEST_ISSUE_CNT);
+	}
+
+	printf("%s() ok\n", __FUNCTION__);
+	ret = 1;
+end:
+	x509_issue_items_cleanup(items, TEST_ISSUE_CNT);
+	x509_issue_ctx_cleanup(&ctx);
+	for (i = 0; i < TEST_ISSUE_CNT; i++) {
+		if (reqs[i]) free(reqs[i]);
+	}
+	if (cacert) free(cacert);
+	return ret;
+}
+
+int main(void)
+{
+	if (test_x509_certs_issue() != 1) goto err;
+	printf("%s all tests passed\n", __FILE__);
+	return 0;
+err:
+	error_print();
+	return -1;
+}
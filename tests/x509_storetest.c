@@ -0,0 +1,477 @@
+/*
+ *  Copyright 2014-2024 The GmSSL Project. All Rights Reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the License); you may
+ *  not use this file except in compliance with the License.
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+#include <gmssl/oid.h>
+#include <gmssl/x509.h>
+#include <gmssl/x509_ext.h>
+#include <gmssl/x509_crl.h>
+#include <gmssl/x509_store.h>
+#include <gmssl/rand.h>
+#include <gmssl/error.h>
+
+
+// issue a cert of subject CN=cn, self-signed when issuer_key is NULL
+static int issue_cert(const char *cn, const SM2_KEY *key, int ca,
+	const char *issuer_cn, const SM2_KEY *issuer_key,
+	uint8_t **out, size_t *outlen)
+{
+	uint8_t serial[12];
+	uint8_t subject[256];
+	size_t subject_len;
+	uint8_t issuer[256];
+	size_t issuer_len;
+	time_t not_before, not_after;
+	uint8_t exts[512];
+	size_t extslen = 0;
+
+	if (!issuer_key) {
+		issuer_cn = cn;
+		issuer_key = key;
+	}
+	rand_bytes(serial, sizeof(serial));
+	serial[0] &= 0x7f;
+	time(&not_before);
+	x509_validity_add_days(&not_after, not_before, 365);
+
+	if (x509_name_set(subject, &subject_len, sizeof(subject), "CN", "Beijing", "Haidian", "PKU", "CS", cn) != 1
+		|| x509_name_set(issuer, &issuer_len, sizeof(issuer), "CN", "Beijing", "Haidian", "PKU", "CS", issuer_cn) != 1
+		|| x509_exts_add_default_authority_key_identifier(exts, &extslen, sizeof(exts), issuer_key) != 1
+		|| x509_exts_add_subject_key_identifier_ex(exts, &extslen, sizeof(exts), -1, key) != 1) {
+		error_print();
+		return -1;
+	}
+	if (ca) {
+		if (x509_exts_add_key_usage(exts, &extslen, sizeof(exts), X509_critical,
+				X509_KU_KEY_CERT_SIGN|X509_KU_CRL_SIGN) != 1
+			|| x509_exts_add_basic_constraints(exts, &extslen, sizeof(exts), X509_critical,
+				1, issuer_key == key ? -1 : 0) != 1) {
+			error_print();
+			return -1;
+		}
+	} else {
+		if (x509_exts_add_key_usage(exts, &extslen, sizeof(exts), X509_critical,
+			X509_KU_DIGITAL_SIGNATURE) != 1) {
+			error_print();
+			return -1;
+		}
+	}
+
+	if (x509_cert_sign_to_der(
+		X509_version_v3,
+		serial, sizeof(serial),
+		OID_sm2sign_with_sm3,
+		issuer, issuer_len,
+		not_before, not_after,
+		subject, subject_len,
+		key,
+		NULL, 0,
+		NULL, 0,
+		exts, extslen,
+		issuer_key, SM2_DEFAULT_ID, SM2_DEFAULT_ID_LENGTH,
+		out, outlen) != 1) {
+		error_print();
+		return -1;
+	}
+	return 1;
+}
+
+static int test_x509_trust_store(void)
+{
+	SM2_KEY root_key;
+	SM2_KEY rekeyed_root_key;
+	SM2_KEY other_key;
+	SM2_KEY ca_key;
+	SM2_KEY entity_key;
+	uint8_t rootcerts[16384];
+	uint8_t *p = rootcerts;
+	size_t rootcertslen = 0;
+	uint8_t chain[4096];
+	size_t chainlen = 0;
+	uint8_t rekeyed_chain[4096];
+	size_t rekeyed_chainlen = 0;
+	X509_TRUST_STORE store;
+	const X509_TRUST_ANCHOR *anchor;
+	const uint8_t *root;
+	size_t rootlen;
+	X509_CERT_VIEW view;
+	int verify_result;
+	int i;
+
+	memset(&store, 0, sizeof(store));
+
+	if (sm2_key_generate(&root_key) != 1
+		|| sm2_key_generate(&rekeyed_root_key) != 1
+		|| sm2_key_generate(&other_key) != 1
+		|| sm2_key_generate(&ca_key) != 1
+		|| sm2_key_generate(&entity_key) != 1) {
+		error_print();
+		return -1;
+	}
+
+	// some unrelated roots, the root and a re-keyed root with the same subject
+	for (i = 0; i < 8; i++) {
+		char cn[32];
+		snprintf(cn, sizeof(cn), "Other Root CA %d", i);
+		if (issue_cert(cn, &other_key, 1, NULL, NULL, &p, &rootcertslen) != 1) {
+			error_print();
+			return -1;
+		}
+	}
+	root = p;
+	if (issue_cert("Root CA", &root_key, 1, NULL, NULL, &p, &rootcertslen) != 1) {
+		error_print();
+		return -1;
+	}
+	rootlen = p - root;
+	if (issue_cert("Root CA", &rekeyed_root_key, 1, NULL, NULL, &p, &rootcertslen) != 1) {
+		error_print();
+		return -1;
+	}
+
+	p = chain;
+	if (issue_cert("Entity", &entity_key, 0, "Sub CA", &ca_key, &p, &chainlen) != 1
+		|| issue_cert("Sub CA", &ca_key, 1, "Root CA", &root_key, &p, &chainlen) != 1) {
+		error_print();
+		return -1;
+	}
+	p = rekeyed_chain;
+	if (issue_cert("Entity", &entity_key, 0, "Sub CA", &ca_key, &p, &rekeyed_chainlen) != 1
+		|| issue_cert("Sub CA", &ca_key, 1, "Root CA", &rekeyed_root_key, &p, &rekeyed_chainlen) != 1) {
+		error_print();
+		return -1;
+	}
+
+	if (x509_trust_store_init(&store, rootcerts, rootcertslen) != 1) {
+		error_print();
+		return -1;
+	}
+	if (store.anchors_cnt != 10) {
+		error_print();
+		goto err;
+	}
+
+	if (x509_cert_view_init(&view, root, rootlen) != 1) {
+		error_print();
+		goto err;
+	}
+	if (x509_trust_store_get_by_subject(&store, view.subject, view.subject_len, &anchor) != 1
+		|| anchor->view.cert_len != rootlen
+		|| memcmp(anchor->view.cert, root, rootlen) != 0) {
+		error_print();
+		goto err;
+	}
+	if (x509_trust_store_get_by_issuer_and_serial_number(&store, view.issuer, view.issuer_len,
+			view.serial_number, view.serial_number_len, &anchor) != 1
+		|| memcmp(anchor->view.cert, root, rootlen) != 0) {
+		error_print();
+		goto err;
+	}
+	if (x509_trust_store_get_by_subject_key_id(&store, anchor->subject_key_id,
+			anchor->subject_key_id_len, &anchor) != 1
+		|| memcmp(anchor->view.cert, root, rootlen) != 0) {
+		error_print();
+		goto err;
+	}
+	if (x509_certs_verify_by_trust_store(chain, chainlen, X509_cert_chain_server,
+		&store, X509_MAX_VERIFY_DEPTH, &verify_result) != 1) {
+		error_print();
+		goto err;
+	}
+	// the subject lookup finds the first root, the AuthorityKeyIdentifier the re-keyed one
+	if (x509_certs_verify_by_trust_store(rekeyed_chain, rekeyed_chainlen, X509_cert_chain_server,
+		&store, X509_MAX_VERIFY_DEPTH, &verify_result) != 1) {
+		error_print();
+		goto err;
+	}
+	// same result as the linear search
+	if (x509_certs_verify(chain, chainlen, X509_cert_chain_server,
+		rootcerts, rootcertslen, X509_MAX_VERIFY_DEPTH, &verify_result) != 1) {
+		error_print();
+		goto err;
+	}
+
+	x509_trust_store_cleanup(&store);
+
+	// without the root
+	if (x509_trust_store_init(&store, rootcerts, root - rootcerts) != 1) {
+		error_print();
+		return -1;
+	}
+	if (x509_certs_verify_by_trust_store(chain, chainlen, X509_cert_chain_server,
+		&store, X509_MAX_VERIFY_DEPTH, &verify_result) == 1) {
+		error_print();
+		goto err;
+	}
+	x509_trust_store_cleanup(&store);
+
+	printf("%s() ok\n", __FUNCTION__);
+	return 1;
+err:
+	x509_trust_store_cleanup(&store);
+	return -1;
+}
+
+static int test_x509_verify_cache(void)
+{
+	SM2_KEY root_key;
+	SM2_KEY ca_key;
+	SM2_KEY entity_key;
+	uint8_t rootcert[1024];
+	uint8_t *p = rootcert;
+	size_t rootcertlen = 0;
+	uint8_t chain[4096];
+	size_t chainlen = 0;
+	X509_TRUST_STORE store;
+	X509_TRUST_STORE store2;
+	X509_VERIFY_CACHE cache;
+	uint64_t hits, misses, evictions;
+	int verify_result;
+	int i;
+
+	memset(&store, 0, sizeof(store));
+	memset(&store2, 0, sizeof(store2));
+	memset(&cache, 0, sizeof(cache));
+
+	if (sm2_key_generate(&root_key) != 1
+		|| sm2_key_generate(&ca_key) != 1
+		|| sm2_key_generate(&entity_key) != 1
+		|| issue_cert("Root CA", &root_key, 1, NULL, NULL, &p, &rootcertlen) != 1) {
+		error_print();
+		return -1;
+	}
+	p = chain;
+	if (issue_cert("Entity", &entity_key, 0, "Sub CA", &ca_key, &p, &chainlen) != 1
+		|| issue_cert("Sub CA", &ca_key, 1, "Root CA", &root_key, &p, &chainlen) != 1) {
+		error_print();
+		return -1;
+	}
+	if (x509_trust_store_init(&store, rootcert, rootcertlen) != 1
+		|| x509_trust_store_init(&store2, rootcert, rootcertlen) != 1
+		|| x509_verify_cache_init(&cache, 16, 600) != 1) {
+		error_print();
+		goto err;
+	}
+
+	for (i = 0; i < 3; i++) {
+		if (x509_certs_verify_by_trust_store_cached(chain, chainlen, X509_cert_chain_server,
+			&store, X509_MAX_VERIFY_DEPTH, &cache, &verify_result) != 1) {
+			error_print();
+			goto err;
+		}
+	}
+	x509_verify_cache_get_stats(&cache, &hits, &misses, &evictions);
+	if (hits != 2 || misses != 1) {
+		error_print();
+		goto err;
+	}
+
+	// the failure is cached too, with other options (sub CA exceeds depth 0)
+	if (x509_certs_verify_by_trust_store_cached(chain, chainlen, X509_cert_chain_server,
+		&store, 0, &cache, &verify_result) == 1) {
+		error_print();
+		goto err;
+	}
+	// another store
+	if (x509_certs_verify_by_trust_store_cached(chain, chainlen, X509_cert_chain_server,
+		&store2, X509_MAX_VERIFY_DEPTH, &cache, &verify_result) != 1) {
+		error_print();
+		goto err;
+	}
+	x509_verify_cache_get_stats(&cache, &hits, &misses, &evictions);
+	if (hits != 2 || misses != 3) {
+		error_print();
+		goto err;
+	}
+
+	// after CRL updates
+	x509_verify_cache_invalidate(&cache);
+	if (x509_certs_verify_by_trust_store_cached(chain, chainlen, X509_cert_chain_server,
+		&store, X509_MAX_VERIFY_DEPTH, &cache, &verify_result) != 1) {
+		error_print();
+		goto err;
+	}
+	x509_verify_cache_get_stats(&cache, &hits, &misses, &evictions);
+	if (hits != 2 || misses != 4) {
+		error_print();
+		goto err;
+	}
+
+	x509_trust_store_cleanup(&store);
+	x509_trust_store_cleanup(&store2);
+	x509_verify_cache_cleanup(&cache);
+	printf("%s() ok\n", __FUNCTION__);
+	return 1;
+err:
+	x509_trust_store_cleanup(&store);
+	x509_trust_store_cleanup(&store2);
+	x509_verify_cache_cleanup(&cache);
+	return -1;
+}
+
+static int test_x509_certs_bulk_verify(void)
+{
+	SM2_KEY ca_key[2];
+	SM2_KEY unknown_key;
+	SM2_KEY entity_key;
+	uint8_t cacerts[2048];
+	uint8_t *p = cacerts;
+	size_t cacertslen = 0;
+	uint8_t certs[64 * 1024];
+	size_t certslen = 0;
+	uint8_t revoked_certs[256];
+	size_t revoked_certs_len = 0;
+	uint8_t crl[1024];
+	size_t crl_len = 0;
+	uint8_t issuer[256];
+	size_t issuer_len;
+	X509_TRUST_STORE store;
+	X509_CRL_INDEX crl_index;
+	X509_BULK_VERIFY_ITEM items[40];
+	int status[40];
+	size_t items_cnt = 0;
+	X509_CERT_VIEW view;
+	time_t now;
+	size_t i;
+
+	memset(&store, 0, sizeof(store));
+	memset(&crl_index, 0, sizeof(crl_index));
+
+	if (sm2_key_generate(&ca_key[0]) != 1
+		|| sm2_key_generate(&ca_key[1]) != 1
+		|| sm2_key_generate(&unknown_key) != 1
+		|| sm2_key_generate(&entity_key) != 1
+		|| issue_cert("CA 0", &ca_key[0], 1, NULL, NULL, &p, &cacertslen) != 1
+		|| issue_cert("CA 1", &ca_key[1], 1, NULL, NULL, &p, &cacertslen) != 1) {
+		error_print();
+		return -1;
+	}
+
+	// interleaved issuers, every 8th cert is revoked by CA 0, every 7th has a bad signature
+	p = certs;
+	for (i = 0; i < 32; i++) {
+		uint8_t *cert = p;
+		size_t len = certslen;
+
+		if (issue_cert("Entity", &entity_key, 0, (i % 2) ? "CA 1" : "CA 0", &ca_key[i % 2], &p, &certslen) != 1) {
+			error_print();
+			return -1;
+		}
+		items[items_cnt].cert = cert;
+		items[items_cnt].certlen = certslen - len;
+		status[items_cnt] = X509_BULK_VERIFY_OK;
+
+		if (i % 8 == 0) {
+			status[items_cnt] = X509_BULK_VERIFY_REVOKED;
+		} else if (i % 7 == 0) {
+			cert[certslen - len - 1] ^= 1;
+			status[items_cnt] = X509_BULK_VERIFY_BAD_SIGNATURE;
+		}
+		items_cnt++;
+	}
+	items[items_cnt].cert = p;
+	if (issue_cert("Entity", &entity_key, 0, "CA 2", &unknown_key, &p, &certslen) != 1) {
+		error_print();
+		return -1;
+	}
+	items[items_cnt].certlen = p - items[items_cnt].cert;
+	status[items_cnt++] = X509_BULK_VERIFY_UNKNOWN_ISSUER;
+	items[items_cnt].cert = certs;
+	items[items_cnt].certlen = 10;
+	status[items_cnt++] = X509_BULK_VERIFY_PARSE_ERROR;
+
+	// CRL of CA 0, now is not before any notBefore
+	now = time(NULL);
+	p = revoked_certs;
+	for (i = 0; i < 32; i += 8) {
+		if (x509_cert_view_init(&view, items[i].cert, items[i].certlen) != 1
+			|| x509_revoked_cert_to_der_ex(view.serial_number, view.serial_number_len, now,
+				X509_cr_key_compromise, -1, NULL, 0, &p, &revoked_certs_len) != 1) {
+			error_print();
+			return -1;
+		}
+	}
+	p = crl;
+	if (x509_name_set(issuer, &issuer_len, sizeof(issuer), "CN", "Beijing", "Haidian", "PKU", "CS", "CA 0") != 1
+		|| x509_crl_sign_to_der(X509_version_v2, OID_sm2sign_with_sm3,
+			issuer, issuer_len, now, now + 86400,
+			revoked_certs, revoked_certs_len,
+			NULL, 0,
+			&ca_key[0], SM2_DEFAULT_ID, SM2_DEFAULT_ID_LENGTH,
+			&p, &crl_len) != 1) {
+		error_print();
+		return -1;
+	}
+
+	if (x509_trust_store_init(&store, cacerts, cacertslen) != 1
+		|| x509_crl_index_build(&crl_index, crl, crl_len) != 1) {
+		error_print();
+		goto err;
+	}
+
+	if (x509_certs_bulk_verify(&store, &crl_index, 1, now, items, items_cnt) != 1) {
+		error_print();
+		goto err;
+	}
+	for (i = 0; i < items_cnt; i++) {
+		if (items[i].status != status[i]) {
+			error_print();
+			goto err;
+		}
+	}
+	if (items[0].revoke_reason != X509_cr_key_compromise || items[1].revoke_date != -1) {
+		error_print();
+		goto err;
+	}
+
+	// expired a year later, revocation is checked before the validity
+	if (x509_certs_bulk_verify(&store, &crl_index, 1, now + 400 * 86400, items, items_cnt) != 1
+		|| items[1].status != X509_BULK_VERIFY_EXPIRED
+		|| items[8].status != X509_BULK_VERIFY_REVOKED) {
+		error_print();
+		goto err;
+	}
+
+#ifdef ENABLE_PTHREAD
+	if (x509_certs_bulk_verify_threads(&store, &crl_index, 1, now, items, items_cnt, 4) != 1) {
+		error_print();
+		goto err;
+	}
+	for (i = 0; i < items_cnt; i++) {
+		if (items[i].status != status[i]) {
+			error_print();
+			goto err;
+		}
+	}
+#endif
+
+	x509_crl_index_cleanup(&crl_index);
+	x509_trust_store_cleanup(&store);
+	printf("%s() ok\n", __FUNCTION__);
+	return 1;
+err:
+	x509_crl_index_cleanup(&crl_index);
+	x509_trust_store_cleanup(&store);
+	return -1;
+}
+
+int main(void)
+{
+	if (test_x509_trust_store() != 1) goto err;
+	if (test_x509_verify_cache() != 1) goto err;
+	if (test_x509_certs_bulk_verify() != 1) goto err;
+	printf("%s all tests passed\n", __FILE__);
+	return 0;
+err:
+	error_print();
+	return -1;
+}
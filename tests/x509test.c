@@ -383,6 +383,237 @@ static int test_x509_cert(void)
 	return 0;
 }
 
+static int test_x509_cert_view(void)
+{
+	uint8_t serial[20] = { 0x01, 0x00 };
+	uint8_t name[256];
+	size_t namelen = 0;
+	time_t not_before, not_after;
+	time_t view_not_before, view_not_after;
+	SM2_KEY sm2_key;
+	SM2_KEY public_key;
+	uint8_t cert[1024];
+	uint8_t *p = cert;
+	const uint8_t *cp = cert;
+	size_t certlen = 0;
+	X509_CERT_VIEW view;
+	const uint8_t *issuer;
+	size_t issuer_len;
+	const uint8_t *serial_number;
+	size_t serial_number_len;
+	uint8_t bad_cert[1024];
+	X509_CERT_VIEW bad_view;
+	int path_len_constraint;
+
+	set_x509_name(name, &namelen, sizeof(name));
+	time(&not_before);
+	x509_validity_add_days(&not_after, not_before, 365);
+	sm2_key_generate(&sm2_key);
+
+	if (x509_cert_sign_to_der(
+		X509_version_v3,
+		serial, sizeof(serial),
+		OID_sm2sign_with_sm3,
+		name, namelen,
+		not_before, not_after,
+		name, namelen,
+		&sm2_key,
+		NULL, 0,
+		NULL, 0,
+		NULL, 0,
+		&sm2_key, SM2_DEFAULT_ID, strlen(SM2_DEFAULT_ID),
+		&p, &certlen) != 1) {
+		error_print();
+		return -1;
+	}
+
+	if (x509_cert_view_from_der(&view, &cp, &certlen) != 1
+		|| certlen != 0) {
+		error_print();
+		return -1;
+	}
+	if (x509_cert_get_issuer_and_serial_number(cert, view.cert_len,
+		&issuer, &issuer_len, &serial_number, &serial_number_len) != 1) {
+		error_print();
+		return -1;
+	}
+	if (view.cert != cert
+		|| view.version != X509_version_v3
+		|| view.issuer != issuer || view.issuer_len != issuer_len
+		|| view.serial_number != serial_number || view.serial_number_len != serial_number_len
+		|| view.subject_len != issuer_len
+		|| memcmp(view.subject, issuer, issuer_len) != 0
+		|| view.inner_signature_algor != OID_sm2sign_with_sm3
+		|| view.signature_algor != OID_sm2sign_with_sm3) {
+		error_print();
+		return -1;
+	}
+
+	if (x509_cert_view_get_validity(&view, &view_not_before, &view_not_after) != 1
+		|| view_not_before != not_before
+		|| view_not_after != not_after) {
+		error_print();
+		return -1;
+	}
+	if (x509_cert_view_get_subject_public_key(&view, &public_key) != 1
+		|| sm2_public_key_equ(&public_key, &sm2_key) != 1) {
+		error_print();
+		return -1;
+	}
+
+	// self-signed
+	if (x509_cert_view_verify_by_ca_view(&view, &view, SM2_DEFAULT_ID, SM2_DEFAULT_ID_LENGTH) != 1) {
+		error_print();
+		return -1;
+	}
+
+	// an off-curve subject public key fails the check
+	if (x509_cert_view_check(&view, X509_cert_server_auth, &path_len_constraint) != 1) {
+		error_print();
+		return -1;
+	}
+	memcpy(bad_cert, cert, view.cert_len);
+	bad_cert[view.subject_public_key_info - cert + view.subject_public_key_info_len - 1] ^= 1;
+	if (x509_cert_view_init(&bad_view, bad_cert, view.cert_len) != 1
+		|| x509_cert_view_check(&bad_view, X509_cert_server_auth, &path_len_constraint) == 1) {
+		error_print();
+		return -1;
+	}
+
+	cert[view.cert_len - 1] ^= 1;
+	if (x509_cert_view_verify(&view, &public_key, SM2_DEFAULT_ID, SM2_DEFAULT_ID_LENGTH) == 1) {
+		error_print();
+		return -1;
+	}
+
+	printf("%s() ok\n", __FUNCTION__);
+	return 0;
+}
+
+static int test_x509_cert_sign_new(void)
+{
+	uint8_t serial[20] = { 0x01, 0x00 };
+	uint8_t name[256];
+	size_t namelen = 0;
+	time_t not_before, not_after;
+	SM2_KEY sm2_key;
+	uint8_t cert[1024];
+	uint8_t *p = cert;
+	size_t certlen = 0;
+	uint8_t *new_cert = NULL;
+	size_t new_certlen;
+	const uint8_t *tbs, *new_tbs;
+	size_t tbslen, new_tbslen;
+	int sig_alg;
+	const uint8_t *sig;
+	size_t siglen;
+	const uint8_t *cp;
+	size_t len;
+	ASN1_WRITER w;
+	int i;
+
+	set_x509_name(name, &namelen, sizeof(name));
+	time(&not_before);
+	x509_validity_add_days(&not_after, not_before, 365);
+	sm2_key_generate(&sm2_key);
+
+	if (x509_cert_sign_to_der(
+		X509_version_v3,
+		serial, sizeof(serial),
+		OID_sm2sign_with_sm3,
+		name, namelen,
+		not_before, not_after,
+		name, namelen,
+		&sm2_key,
+		NULL, 0,
+		NULL, 0,
+		NULL, 0,
+		&sm2_key, SM2_DEFAULT_ID, strlen(SM2_DEFAULT_ID),
+		&p, &certlen) != 1
+		|| x509_cert_sign_new(&new_cert, &new_certlen,
+		X509_version_v3,
+		serial, sizeof(serial),
+		OID_sm2sign_with_sm3,
+		name, namelen,
+		not_before, not_after,
+		name, namelen,
+		&sm2_key,
+		NULL, 0,
+		NULL, 0,
+		NULL, 0,
+		&sm2_key, SM2_DEFAULT_ID, strlen(SM2_DEFAULT_ID)) != 1) {
+		error_print();
+		return -1;
+	}
+
+	// same TBSCertificate, the signatures are randomized
+	cp = cert;
+	len = certlen;
+	if (x509_signed_from_der(&tbs, &tbslen, &sig_alg, &sig, &siglen, &cp, &len) != 1) {
+		error_print();
+		return -1;
+	}
+	cp = new_cert;
+	len = new_certlen;
+	if (new_certlen != certlen
+		|| x509_signed_from_der(&new_tbs, &new_tbslen, &sig_alg, &sig, &siglen, &cp, &len) != 1
+		|| len != 0
+		|| new_tbslen != tbslen
+		|| memcmp(new_tbs, tbs, tbslen) != 0
+		|| x509_signed_verify(new_cert, new_certlen, &sm2_key, SM2_DEFAULT_ID, strlen(SM2_DEFAULT_ID)) != 1) {
+		free(new_cert);
+		error_print();
+		return -1;
+	}
+	free(new_cert);
+
+	// append to a writer with a small buffer
+	if (asn1_writer_init(&w, 16) != 1) {
+		error_print();
+		return -1;
+	}
+	for (i = 0; i < 3; i++) {
+		if (x509_cert_sign_to_writer(
+			X509_version_v3,
+			serial, sizeof(serial),
+			OID_sm2sign_with_sm3,
+			name, namelen,
+			not_before, not_after,
+			name, namelen,
+			&sm2_key,
+			NULL, 0,
+			NULL, 0,
+			NULL, 0,
+			&sm2_key, SM2_DEFAULT_ID, strlen(SM2_DEFAULT_ID),
+			&w) != 1) {
+			asn1_writer_cleanup(&w);
+			error_print();
+			return -1;
+		}
+	}
+	cp = w.buf;
+	len = w.len;
+	for (i = 0; i < 3; i++) {
+		const uint8_t *a;
+		size_t alen;
+		if (x509_cert_from_der(&a, &alen, &cp, &len) != 1
+			|| alen != certlen
+			|| x509_signed_verify(a, alen, &sm2_key, SM2_DEFAULT_ID, strlen(SM2_DEFAULT_ID)) != 1) {
+			asn1_writer_cleanup(&w);
+			error_print();
+			return -1;
+		}
+	}
+	asn1_writer_cleanup(&w);
+	if (len != 0) {
+		error_print();
+		return -1;
+	}
+
+	printf("%s() ok\n", __FUNCTION__);
+	return 0;
+}
+
 int main(void)
 {
 	int err = 0;
@@ -394,5 +625,7 @@ int main(void)
 	err += test_x509_public_key_info();
 	err += test_x509_tbs_cert();
 	err += test_x509_cert();
+	err += test_x509_cert_view();
+	err += test_x509_cert_sign_new();
 	return err;
 }
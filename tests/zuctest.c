@@ -282,6 +282,190 @@ static int test_zuc_eia(void)
 	return 1;
 }
 
+static int test_zuc_eia_word(void)
+{
+	ZUC_UINT32 K0 = 0x12345678;
+	ZUC_UINT32 K1 = 0x9abcdef0;
+	ZUC_UINT32 M = 0x80000001;
+	int i, j;
+
+	for (i = 0; i < 100; i++) {
+		ZUC_UINT32 k0 = K0, k1 = K1, m = M;
+		ZUC_UINT32 T = 0;
+
+		for (j = 0; j < 32; j++) {
+			if (m & 0x80000000) {
+				T ^= k0;
+			}
+			m <<= 1;
+			k0 = (k0 << 1) | (k1 >> 31);
+			k1 <<= 1;
+		}
+		if (zuc_eia_word(K0, K1, M) != T) {
+			error_print();
+			return -1;
+		}
+
+		K0 = K0 * 0x9e3779b9 + i;
+		K1 = K1 * 0x85ebca6b + K0;
+		M = M * 0xc2b2ae35 + K1;
+	}
+
+	printf("%s() ok\n", __FUNCTION__);
+	return 1;
+}
+
+static int test_zuc_eea_eia_encrypt(void)
+{
+	uint8_t eea_key[16];
+	uint8_t eia_key[16];
+	ZUC_UINT32 in[40];
+	ZUC_UINT32 out[40];
+	ZUC_UINT32 buf[40];
+	size_t nbits[] = { 0, 1, 31, 32, 33, 511, 512, 1000, 1280 };
+	size_t i;
+
+	for (i = 0; i < 16; i++) {
+		eea_key[i] = (uint8_t)(i * 3 + 1);
+		eia_key[i] = (uint8_t)(i * 5 + 2);
+	}
+	for (i = 0; i < sizeof(in)/sizeof(in[0]); i++) {
+		in[i] = (ZUC_UINT32)(i * 0x9e3779b9 + 7);
+	}
+
+	for (i = 0; i < sizeof(nbits)/sizeof(nbits[0]); i++) {
+		ZUC_UINT32 mac;
+
+		mac = zuc_eea_eia_encrypt(in, out, nbits[i], eea_key, eia_key, 0x12345, 3, 1);
+		zuc_eea_encrypt(in, buf, nbits[i], eea_key, 0x12345, 3, 1);
+		if (memcmp(out, buf, ZUC_EEA_ENCRYPT_NBYTES(nbits[i])) != 0) {
+			error_print();
+			return -1;
+		}
+		if (mac != zuc_eia_generate_mac(in, nbits[i], eia_key, 0x12345, 3, 1)) {
+			error_print();
+			return -1;
+		}
+
+		mac = zuc_eea_eia_decrypt(out, buf, nbits[i], eea_key, eia_key, 0x12345, 3, 1);
+		if (mac != zuc_eia_generate_mac(buf, nbits[i], eia_key, 0x12345, 3, 1)) {
+			error_print();
+			return -1;
+		}
+	}
+
+	printf("%s() ok\n", __FUNCTION__);
+	return 1;
+}
+
+static int test_zuc_x8(void)
+{
+	uint8_t key[ZUC_X8_LANES][16];
+	uint8_t iv[ZUC_X8_LANES][16];
+	const uint8_t *keys[ZUC_X8_LANES];
+	const uint8_t *ivs[ZUC_X8_LANES];
+	ZUC_X8_STATE x8_state;
+	ZUC_STATE zuc_state;
+	ZUC_UINT32 words[40][ZUC_X8_LANES];
+	ZUC_UINT32 buf[40];
+	int i, j;
+
+	for (j = 0; j < ZUC_X8_LANES; j++) {
+		for (i = 0; i < 16; i++) {
+			key[j][i] = (uint8_t)(j * 37 + i * 11 + 1);
+			iv[j][i] = (uint8_t)(j * 59 + i * 7 + 3);
+		}
+		keys[j] = key[j];
+		ivs[j] = iv[j];
+	}
+
+	// init all lanes, then re-init the odd lanes in the middle of the keystream
+	zuc_x8_init(&x8_state, 0xff, keys, ivs);
+	zuc_x8_generate_keystream(&x8_state, 7, words);
+	zuc_x8_init(&x8_state, 0xaa, keys, ivs);
+	zuc_x8_generate_keystream(&x8_state, 33, words + 7);
+
+	for (j = 0; j < ZUC_X8_LANES; j++) {
+		zuc_init(&zuc_state, key[j], iv[j]);
+		if (j % 2) {
+			zuc_generate_keystream(&zuc_state, 7, buf);
+			for (i = 0; i < 7; i++) {
+				if (words[i][j] != buf[i]) {
+					error_print();
+					return -1;
+				}
+			}
+			zuc_init(&zuc_state, key[j], iv[j]);
+			zuc_generate_keystream(&zuc_state, 33, buf + 7);
+		} else {
+			zuc_generate_keystream(&zuc_state, 40, buf);
+		}
+		for (i = 0; i < 40; i++) {
+			if (words[i][j] != buf[i]) {
+				error_print();
+				return -1;
+			}
+		}
+	}
+
+	printf("%s() ok\n", __FUNCTION__);
+	return 1;
+}
+
+static int test_zuc_process_jobs(void)
+{
+	uint8_t key[16];
+	ZUC_UINT32 in[64];
+	ZUC_UINT32 out[37][64];
+	ZUC_UINT32 buf[64];
+	ZUC_JOB jobs[37];
+	size_t i;
+
+	for (i = 0; i < sizeof(key); i++) {
+		key[i] = (uint8_t)(i * 13 + 5);
+	}
+	for (i = 0; i < sizeof(in)/sizeof(in[0]); i++) {
+		in[i] = (ZUC_UINT32)(i * 0x9e3779b9);
+	}
+
+	// mixed EEA3/EIA3 jobs of different lengths, including empty messages
+	for (i = 0; i < sizeof(jobs)/sizeof(jobs[0]); i++) {
+		jobs[i].type = (i % 3) ? ZUC_JOB_EEA3 : ZUC_JOB_EIA3;
+		jobs[i].key = key;
+		jobs[i].count = (ZUC_UINT32)(0x12345678 + i);
+		jobs[i].bearer = i % 32;
+		jobs[i].direction = i % 2;
+		jobs[i].in = in;
+		jobs[i].nbits = (i * 211) % (sizeof(in) * 8);
+		jobs[i].out = out[i];
+		jobs[i].mac = 0;
+	}
+
+	if (zuc_process_jobs(jobs, sizeof(jobs)/sizeof(jobs[0])) != 1) {
+		error_print();
+		return -1;
+	}
+
+	for (i = 0; i < sizeof(jobs)/sizeof(jobs[0]); i++) {
+		if (jobs[i].type == ZUC_JOB_EEA3) {
+			zuc_eea_encrypt(in, buf, jobs[i].nbits, key, jobs[i].count, jobs[i].bearer, jobs[i].direction);
+			if (memcmp(out[i], buf, ZUC_EEA_ENCRYPT_NBYTES(jobs[i].nbits)) != 0) {
+				error_print();
+				return -1;
+			}
+		} else {
+			if (jobs[i].mac != zuc_eia_generate_mac(in, jobs[i].nbits, key,
+				jobs[i].count, jobs[i].bearer, jobs[i].direction)) {
+				error_print();
+				return -1;
+			}
+		}
+	}
+
+	printf("%s() ok\n", __FUNCTION__);
+	return 1;
+}
+
 /* from ZUC256 draft */
 static int test_zuc256(void)
 {
@@ -522,16 +706,84 @@ static int speed_zuc_encrypt(void)
 	return 1;
 }
 
+static int speed_zuc_mac_update(void)
+{
+	ZUC_MAC_CTX ctx;
+	uint8_t key[16] = {0};
+	uint8_t iv[16] = {0};
+	uint32_t align_buf[1024];
+	uint8_t *buf = (uint8_t *)align_buf;
+	uint8_t mac[4];
+	clock_t begin, end;
+	double seconds;
+	int i;
+
+	memset(align_buf, 0x5a, sizeof(align_buf));
+
+	zuc_mac_init(&ctx, key, iv);
+	begin = clock();
+	for (i = 0; i < 4096; i++) {
+		zuc_mac_update(&ctx, buf, 4096);
+	}
+	end = clock();
+	zuc_mac_finish(&ctx, NULL, 0, mac);
+
+	seconds = (double)(end - begin)/CLOCKS_PER_SEC;
+	fprintf(stderr, "%s: %f-MiB per second\n", __FUNCTION__, 16/seconds);
+
+	return 1;
+}
+
+static int speed_zuc_process_jobs(void)
+{
+	uint8_t key[16] = {0};
+	uint32_t in[375]; // 1500-byte packets
+	uint32_t out[64][375];
+	ZUC_JOB jobs[64];
+	clock_t begin, end;
+	double seconds;
+	int i;
+
+	memset(in, 0, sizeof(in));
+	for (i = 0; i < 64; i++) {
+		jobs[i].type = ZUC_JOB_EEA3;
+		jobs[i].key = key;
+		jobs[i].count = i;
+		jobs[i].bearer = 0;
+		jobs[i].direction = 0;
+		jobs[i].in = in;
+		jobs[i].nbits = sizeof(in) * 8;
+		jobs[i].out = out[i];
+	}
+
+	begin = clock();
+	for (i = 0; i < 1024; i++) {
+		zuc_process_jobs(jobs, 64);
+	}
+	end = clock();
+
+	seconds = (double)(end - begin)/CLOCKS_PER_SEC;
+	fprintf(stderr, "%s: %f packets per second\n", __FUNCTION__, 64*1024/seconds);
+
+	return 1;
+}
+
 int main(void)
 {
 	if (test_zuc() != 1) goto err;
 	if (test_zuc_eea() != 1) goto err;
 	if (test_zuc_eia() != 1) goto err;
+	if (test_zuc_eia_word() != 1) goto err;
+	if (test_zuc_eea_eia_encrypt() != 1) goto err;
+	if (test_zuc_x8() != 1) goto err;
+	if (test_zuc_process_jobs() != 1) goto err;
 	if (test_zuc256() != 1) goto err;
 	if (test_zuc256_mac() != 1) goto err;
 #if ENABLE_TEST_SPEED
 	if (speed_zuc_generate_keystream() != 1) goto err;
 	if (speed_zuc_encrypt() != 1) goto err;
+	if (speed_zuc_mac_update() != 1) goto err;
+	if (speed_zuc_process_jobs() != 1) goto err;
 #endif
 	printf("%s all tests passed\n", __FILE__);
 	return 0;
@@ -0,0 +1,517 @@
+/*
+ *  Copyright 2014-2024 The GmSSL Project. All Rights Reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the License); you may
+ *  not use this file except in compliance with the License.
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+
+#include <stdio.h>
+#include <errno.h>
+#include <string.h>
+#include <stdlib.h>
+#include <time.h>
+#include <gmssl/pem.h>
+#include <gmssl/file.h>
+#include <gmssl/x509.h>
+#include <gmssl/x509_crl.h>
+#include <gmssl/x509_store.h>
+#include <gmssl/error.h>
+#ifndef WIN32
+#include <dirent.h>
+#include <sys/stat.h>
+#endif
+
+
+static const char *usage =
+	" (-in file | -indir dir) ... -cacert pem [-crl der] ..."
+#ifdef ENABLE_PTHREAD
+	" [-threads num]"
+#endif
+	" [-quiet] [-out file]"
+	"\n";
+
+static const char *options =
+"Options\n"
+"\n"
+"    -in file            Certificates to be verified, PEM or DER concatenation, can be used more than once\n"
+"    -indir dir          Verify the certificate files in dir, can be used more than once\n"
+"    -cacert pem         CA certificates of the issuers\n"
+"    -crl der            CRL of an issuer in -cacert, can be used more than once\n"
+#ifdef ENABLE_PTHREAD
+"    -threads num        Number of verify threads, default 1\n"
+#endif
+"    -quiet              Only output the certificates not verified\n"
+"    -out file           Output file of the results, default stdout\n"
+"\n"
+"    Every certificate is verified by its issuer in -cacert, the results are\n"
+"    output one line per certificate as `source:number serialNumber status [reason]`\n"
+"    and the statistics are printed to stderr.\n"
+"\n"
+"Examples\n"
+"\n"
+"    $ gmssl certbulkverify -indir archive -cacert cacerts.pem -crl ca.crl -threads 8 -quiet\n"
+"\n";
+
+#define CERTBULKVERIFY_BATCH_SIZE	4096
+#define CERTBULKVERIFY_BUF_SIZE		(4096 * 1024)
+#define CERTBULKVERIFY_MAX_CERT_SIZE	(64 * 1024)
+#define CERTBULKVERIFY_MAX_CRLS		64
+
+typedef struct {
+	const X509_TRUST_STORE *store;
+	const X509_CRL_INDEX *crl_indexes;
+	size_t crl_indexes_cnt;
+	time_t verify_time;
+	int nthreads;
+	int quiet;
+	FILE *outfp;
+
+	// current batch
+	uint8_t *buf;
+	size_t buflen;
+	X509_BULK_VERIFY_ITEM items[CERTBULKVERIFY_BATCH_SIZE];
+	const char *sources[CERTBULKVERIFY_BATCH_SIZE];
+	size_t numbers[CERTBULKVERIFY_BATCH_SIZE];
+	size_t items_cnt;
+	// paths of the -indir files in the batch, the last one may be in reading
+	char *paths[CERTBULKVERIFY_BATCH_SIZE];
+	size_t paths_cnt;
+
+	uint64_t total;
+	uint64_t status_cnt[X509_BULK_VERIFY_STATUS_CNT];
+} CERTBULKVERIFY_CTX;
+
+// verify and output the current batch
+static int certbulkverify_flush(CERTBULKVERIFY_CTX *ctx, const char *reading_path)
+{
+	size_t i, j;
+
+#ifdef ENABLE_PTHREAD
+	if (x509_certs_bulk_verify_threads(ctx->store, ctx->crl_indexes, ctx->crl_indexes_cnt,
+		ctx->verify_time, ctx->items, ctx->items_cnt, ctx->nthreads) != 1) {
+		error_print();
+		return -1;
+	}
+#else
+	if (x509_certs_bulk_verify(ctx->store, ctx->crl_indexes, ctx->crl_indexes_cnt,
+		ctx->verify_time, ctx->items, ctx->items_cnt) != 1) {
+		error_print();
+		return -1;
+	}
+#endif
+
+	for (i = 0; i < ctx->items_cnt; i++) {
+		const X509_BULK_VERIFY_ITEM *item = &ctx->items[i];
+		const uint8_t *serial;
+		size_t serial_len;
+
+		ctx->status_cnt[item->status]++;
+		if (ctx->quiet && item->status == X509_BULK_VERIFY_OK) {
+			continue;
+		}
+		fprintf(ctx->outfp, "%s:%zu ", ctx->sources[i], ctx->numbers[i]);
+		if (item->status != X509_BULK_VERIFY_PARSE_ERROR
+			&& x509_cert_get_issuer_and_serial_number(item->cert, item->certlen,
+				NULL, NULL, &serial, &serial_len) == 1) {
+			for (j = 0; j < serial_len; j++) {
+				fprintf(ctx->outfp, "%02X", serial[j]);
+			}
+		} else {
+			fprintf(ctx->outfp, "-");
+		}
+		fprintf(ctx->outfp, " %s", x509_bulk_verify_status_name(item->status));
+		if (item->status == X509_BULK_VERIFY_REVOKED && item->revoke_reason >= 0) {
+			fprintf(ctx->outfp, " %s", x509_crl_reason_name(item->revoke_reason));
+		}
+		fprintf(ctx->outfp, "\n");
+	}
+	ctx->total += ctx->items_cnt;
+	ctx->items_cnt = 0;
+	ctx->buflen = 0;
+
+	for (i = 0; i < ctx->paths_cnt; i++) {
+		if (ctx->paths[i] != reading_path) {
+			free(ctx->paths[i]);
+		}
+	}
+	ctx->paths_cnt = 0;
+	if (reading_path) {
+		ctx->paths[ctx->paths_cnt++] = (char *)reading_path;
+	}
+	return 1;
+}
+
+// read one DER certificate without parsing it, return 0 at the end of file
+static int certbulkverify_read_der(FILE *fp, uint8_t *buf, size_t *len, size_t maxlen)
+{
+	size_t hdrlen = 2;
+	size_t vlen = 0;
+	int c, n;
+
+	if ((c = fgetc(fp)) == EOF) {
+		if (ferror(fp)) {
+			error_print();
+			return -1;
+		}
+		return 0;
+	}
+	buf[0] = (uint8_t)c;
+	if (c != 0x30 || (c = fgetc(fp)) == EOF) {
+		error_print();
+		return -1;
+	}
+	buf[1] = (uint8_t)c;
+
+	if (c < 0x80) {
+		vlen = c;
+	} else {
+		n = c & 0x7f;
+		if (n < 1 || n > 4) {
+			error_print();
+			return -1;
+		}
+		while (n--) {
+			if ((c = fgetc(fp)) == EOF) {
+				error_print();
+				return -1;
+			}
+			buf[hdrlen++] = (uint8_t)c;
+			vlen = (vlen << 8) | (size_t)c;
+		}
+	}
+	if (vlen > maxlen - hdrlen) {
+		error_print();
+		return -1;
+	}
+	if (fread(buf + hdrlen, 1, vlen, fp) != vlen) {
+		error_print();
+		return -1;
+	}
+	*len = hdrlen + vlen;
+	return 1;
+}
+
+// add the PEM or DER certificates in fp to the batch, full batches are verified
+static int certbulkverify_fp(CERTBULKVERIFY_CTX *ctx, FILE *fp, const char *source, const char *reading_path)
+{
+	size_t number = 0;
+	int der;
+	int c;
+	int rv;
+
+	if ((c = fgetc(fp)) == EOF) {
+		return ferror(fp) ? -1 : 1;
+	}
+	der = (c == 0x30);
+	ungetc(c, fp);
+
+	for (;;) {
+		uint8_t *cert;
+		size_t certlen;
+
+		if (ctx->items_cnt == CERTBULKVERIFY_BATCH_SIZE
+			|| CERTBULKVERIFY_BUF_SIZE - ctx->buflen < CERTBULKVERIFY_MAX_CERT_SIZE) {
+			if (certbulkverify_flush(ctx, reading_path) != 1) {
+				error_print();
+				return -1;
+			}
+		}
+		cert = ctx->buf + ctx->buflen;
+
+		if (der) {
+			rv = certbulkverify_read_der(fp, cert, &certlen, CERTBULKVERIFY_MAX_CERT_SIZE);
+		} else {
+			rv = pem_read(fp, "CERTIFICATE", cert, &certlen, CERTBULKVERIFY_MAX_CERT_SIZE);
+		}
+		if (rv < 0) {
+			fprintf(stderr, "certbulkverify: read '%s' certificate %zu failure\n", source, number + 1);
+			return -1;
+		}
+		if (rv == 0) {
+			break;
+		}
+
+		ctx->items[ctx->items_cnt].cert = cert;
+		ctx->items[ctx->items_cnt].certlen = certlen;
+		ctx->sources[ctx->items_cnt] = source;
+		ctx->numbers[ctx->items_cnt] = ++number;
+		ctx->items_cnt++;
+		ctx->buflen += certlen;
+	}
+	return 1;
+}
+
+static int certbulkverify_file(CERTBULKVERIFY_CTX *ctx, const char *file)
+{
+	FILE *fp;
+	int ret;
+
+	if (!(fp = fopen(file, "rb"))) {
+		fprintf(stderr, "certbulkverify: open '%s' failure : %s\n", file, strerror(errno));
+		return -1;
+	}
+	ret = certbulkverify_fp(ctx, fp, file, NULL);
+	fclose(fp);
+	return ret;
+}
+
+static int certbulkverify_dir(CERTBULKVERIFY_CTX *ctx, const char *dir)
+{
+#ifdef WIN32
+	fprintf(stderr, "certbulkverify: -indir not supported on this platform\n");
+	return -1;
+#else
+	DIR *dp;
+	struct dirent *entry;
+	struct stat st;
+	int ret = -1;
+
+	if (!(dp = opendir(dir))) {
+		fprintf(stderr, "certbulkverify: open '%s' failure : %s\n", dir, strerror(errno));
+		return -1;
+	}
+	while ((entry = readdir(dp)) != NULL) {
+		size_t pathlen = strlen(dir) + strlen(entry->d_name) + 2;
+		char *path;
+		FILE *fp;
+
+		if (ctx->paths_cnt == CERTBULKVERIFY_BATCH_SIZE) {
+			if (certbulkverify_flush(ctx, NULL) != 1) {
+				error_print();
+				goto end;
+			}
+		}
+		if (!(path = (char *)malloc(pathlen))) {
+			error_print();
+			goto end;
+		}
+		snprintf(path, pathlen, "%s/%s", dir, entry->d_name);
+		if (stat(path, &st) != 0 || !S_ISREG(st.st_mode)) {
+			free(path);
+			continue;
+		}
+		ctx->paths[ctx->paths_cnt++] = path;
+
+		if (!(fp = fopen(path, "rb"))) {
+			fprintf(stderr, "certbulkverify: open '%s' failure : %s\n", path, strerror(errno));
+			goto end;
+		}
+		if (certbulkverify_fp(ctx, fp, path, path) != 1) {
+			fclose(fp);
+			goto end;
+		}
+		fclose(fp);
+	}
+	ret = 1;
+end:
+	closedir(dp);
+	return ret;
+#endif
+}
+
+// the CRL is verified by its issuer in the trust store before it is indexed
+static int certbulkverify_load_crl(const X509_TRUST_STORE *store, const char *file, time_t now,
+	X509_CRL_INDEX *crl_index)
+{
+	uint8_t *crl = NULL;
+	size_t crl_len;
+	const uint8_t *issuer;
+	size_t issuer_len;
+	const X509_TRUST_ANCHOR *anchor;
+	int ret = -1;
+
+	memset(crl_index, 0, sizeof(*crl_index));
+
+	if (file_read_all(file, &crl, &crl_len) != 1) {
+		fprintf(stderr, "certbulkverify: read '%s' failure : %s\n", file, strerror(errno));
+		return -1;
+	}
+	if (x509_crl_check(crl, crl_len, now) != 1
+		|| x509_crl_index_build(crl_index, crl, crl_len) != 1
+		|| x509_crl_index_get_issuer(crl_index, &issuer, &issuer_len) != 1) {
+		fprintf(stderr, "certbulkverify: invalid CRL '%s'\n", file);
+		goto end;
+	}
+	if (x509_trust_store_get_by_subject(store, issuer, issuer_len, &anchor) != 1) {
+		fprintf(stderr, "certbulkverify: issuer of CRL '%s' not in -cacert\n", file);
+		goto end;
+	}
+	if (x509_crl_verify_by_ca_cert(crl, crl_len, anchor->view.cert, anchor->view.cert_len,
+		SM2_DEFAULT_ID, SM2_DEFAULT_ID_LENGTH) != 1) {
+		fprintf(stderr, "certbulkverify: CRL '%s' verification failure\n", file);
+		goto end;
+	}
+	ret = 1;
+end:
+	if (ret != 1) x509_crl_index_cleanup(crl_index);
+	free(crl);
+	return ret;
+}
+
+int certbulkverify_main(int argc, char **argv)
+{
+	int ret = 1;
+	char *prog = argv[0];
+	char **inputs = NULL;
+	int *input_is_dir = NULL;
+	int inputs_cnt = 0;
+	char *cacertfile = NULL;
+	char *crlfiles[CERTBULKVERIFY_MAX_CRLS];
+	size_t crlfiles_cnt = 0;
+	char *outfile = NULL;
+	X509_TRUST_STORE store;
+	X509_CRL_INDEX crl_indexes[CERTBULKVERIFY_MAX_CRLS];
+	size_t crl_indexes_cnt = 0;
+	CERTBULKVERIFY_CTX *ctx = NULL;
+	time_t start;
+	double seconds;
+	size_t i;
+
+	memset(&store, 0, sizeof(store));
+
+	argc--;
+	argv++;
+
+	if (argc < 1) {
+		fprintf(stderr, "usage: %s %s\n", prog, usage);
+		return 1;
+	}
+	if (!(inputs = (char **)malloc(sizeof(char *) * argc))
+		|| !(input_is_dir = (int *)malloc(sizeof(int) * argc))
+		|| !(ctx = (CERTBULKVERIFY_CTX *)calloc(1, sizeof(*ctx)))) {
+		error_print();
+		goto end;
+	}
+	ctx->nthreads = 1;
+	ctx->outfp = stdout;
+
+	while (argc > 0) {
+		if (!strcmp(*argv, "-help")) {
+			printf("usage: %s %s\n", prog, usage);
+			printf("%s\n", options);
+			ret = 0;
+			goto end;
+		} else if (!strcmp(*argv, "-in") || !strcmp(*argv, "-indir")) {
+			input_is_dir[inputs_cnt] = !strcmp(*argv, "-indir");
+			if (--argc < 1) goto bad;
+			inputs[inputs_cnt++] = *(++argv);
+		} else if (!strcmp(*argv, "-cacert")) {
+			if (--argc < 1) goto bad;
+			cacertfile = *(++argv);
+		} else if (!strcmp(*argv, "-crl")) {
+			if (--argc < 1) goto bad;
+			if (crlfiles_cnt >= CERTBULKVERIFY_MAX_CRLS) {
+				fprintf(stderr, "%s: too many `-crl`, at most %d\n", prog, CERTBULKVERIFY_MAX_CRLS);
+				goto end;
+			}
+			crlfiles[crlfiles_cnt++] = *(++argv);
+#ifdef ENABLE_PTHREAD
+		} else if (!strcmp(*argv, "-threads")) {
+			if (--argc < 1) goto bad;
+			ctx->nthreads = atoi(*(++argv));
+			if (ctx->nthreads < 1 || ctx->nthreads > X509_BULK_VERIFY_MAX_THREADS) {
+				fprintf(stderr, "%s: invalid `-threads` value, should be in [1, %d]\n",
+					prog, X509_BULK_VERIFY_MAX_THREADS);
+				goto end;
+			}
+#endif
+		} else if (!strcmp(*argv, "-quiet")) {
+			ctx->quiet = 1;
+		} else if (!strcmp(*argv, "-out")) {
+			if (--argc < 1) goto bad;
+			outfile = *(++argv);
+			if (!(ctx->outfp = fopen(outfile, "wb"))) {
+				fprintf(stderr, "%s: open '%s' failure : %s\n", prog, outfile, strerror(errno));
+				goto end;
+			}
+		} else {
+			fprintf(stderr, "%s: illegal option `%s`\n", prog, *argv);
+			goto end;
+bad:
+			fprintf(stderr, "%s: `%s` option value missing\n", prog, *argv);
+			goto end;
+		}
+
+		argc--;
+		argv++;
+	}
+
+	if (!inputs_cnt) {
+		fprintf(stderr, "%s: `-in` or `-indir` option required\n", prog);
+		goto end;
+	}
+	if (!cacertfile) {
+		fprintf(stderr, "%s: `-cacert` option required\n", prog);
+		goto end;
+	}
+
+	ctx->verify_time = time(NULL);
+	if (x509_trust_store_init_from_file(&store, cacertfile) != 1) {
+		fprintf(stderr, "%s: load CA certificates '%s' failure\n", prog, cacertfile);
+		goto end;
+	}
+	for (i = 0; i < crlfiles_cnt; i++) {
+		if (certbulkverify_load_crl(&store, crlfiles[i], ctx->verify_time,
+			&crl_indexes[crl_indexes_cnt]) != 1) {
+			goto end;
+		}
+		crl_indexes_cnt++;
+	}
+	ctx->store = &store;
+	ctx->crl_indexes = crl_indexes;
+	ctx->crl_indexes_cnt = crl_indexes_cnt;
+	if (!(ctx->buf = (uint8_t *)malloc(CERTBULKVERIFY_BUF_SIZE))) {
+		error_print();
+		goto end;
+	}
+
+	start = time(NULL);
+	for (i = 0; i < (size_t)inputs_cnt; i++) {
+		if (input_is_dir[i]) {
+			if (certbulkverify_dir(ctx, inputs[i]) != 1) {
+				goto end;
+			}
+		} else {
+			if (certbulkverify_file(ctx, inputs[i]) != 1) {
+				goto end;
+			}
+		}
+	}
+	if (ctx->items_cnt && certbulkverify_flush(ctx, NULL) != 1) {
+		error_print();
+		goto end;
+	}
+	seconds = difftime(time(NULL), start);
+
+	fprintf(stderr, "certificates: %llu\n", (unsigned long long)ctx->total);
+	for (i = 0; i < X509_BULK_VERIFY_STATUS_CNT; i++) {
+		fprintf(stderr, "    %-16s%llu\n", x509_bulk_verify_status_name((int)i),
+			(unsigned long long)ctx->status_cnt[i]);
+	}
+	fprintf(stderr, "seconds: %.0f\n", seconds);
+	if (seconds > 0) {
+		fprintf(stderr, "certificates/second: %.0f\n", (double)ctx->total / seconds);
+	}
+
+	ret = ctx->status_cnt[X509_BULK_VERIFY_OK] == ctx->total ? 0 : 2;
+
+end:
+	if (ctx) {
+		for (i = 0; i < ctx->paths_cnt; i++) {
+			free(ctx->paths[i]);
+		}
+		if (ctx->buf) free(ctx->buf);
+		if (outfile && ctx->outfp) fclose(ctx->outfp);
+		free(ctx);
+	}
+	for (i = 0; i < crl_indexes_cnt; i++) {
+		x509_crl_index_cleanup(&crl_indexes[i]);
+	}
+	x509_trust_store_cleanup(&store);
+	if (inputs) free(inputs);
+	if (input_is_dir) free(input_is_dir);
+	return ret;
+}
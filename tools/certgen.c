@@ -162,7 +162,6 @@ int certgen_main(int argc, char **argv)
 	size_t certlen = 0;
 	FILE *outfp = stdout;
 	char *outfile = NULL;
-	uint8_t *p;
 
 	// Extensions
 	uint8_t exts[4096];
@@ -500,7 +499,7 @@ bad:
 		}
 	}
 
-	if (x509_cert_sign_to_der(
+	if (x509_cert_sign_new(&cert, &certlen,
 		X509_version_v3,
 		serial, serial_len,
 		OID_sm2sign_with_sm3,
@@ -511,30 +510,7 @@ bad:
 		NULL, 0,
 		NULL, 0,
 		exts, extslen,
-		&sm2_key, signer_id, signer_id_len,
-		NULL, &certlen) != 1) {
-		fprintf(stderr, "%s: certificate generation failure\n", prog);
-		goto end;
-	}
-	if (!(cert = malloc(certlen))) {
-		fprintf(stderr, "%s: malloc failure\n", prog);
-		goto end;
-	}
-	p = cert;
-	certlen = 0;
-	if (x509_cert_sign_to_der(
-		X509_version_v3,
-		serial, serial_len,
-		OID_sm2sign_with_sm3,
-		name, namelen,
-		not_before, not_after,
-		name, namelen,
-		&sm2_key,
-		NULL, 0,
-		NULL, 0,
-		exts, extslen,
-		&sm2_key, signer_id, signer_id_len,
-		&p, &certlen) != 1) {
+		&sm2_key, signer_id, signer_id_len) != 1) {
 		fprintf(stderr, "%s: certificate generation failure\n", prog);
 		goto end;
 	}
@@ -0,0 +1,508 @@
+/*
+ *  Copyright 2014-2024 The GmSSL Project. All Rights Reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the License); you may
+ *  not use this file except in compliance with the License.
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+
+#include <stdio.h>
+#include <errno.h>
+#include <string.h>
+#include <stdlib.h>
+#include <gmssl/hex.h>
+#include <gmssl/mem.h>
+#include <gmssl/pem.h>
+#include <gmssl/x509.h>
+#include <gmssl/x509_ext.h>
+#include <gmssl/x509_req.h>
+#include <gmssl/x509_issue.h>
+
+
+static const char *options =
+	" [-in pem]"
+	" [-req_sm2_id str | -req_sm2_id_hex hex]"
+	" [-serial_len num]"
+	" -days num"
+	" -cacert pem -key file -pass pass"
+	" [-sm2_id str | -sm2_id_hex hex]"
+	" [-gen_authority_key_id]"
+	" [-gen_subject_key_id]"
+	" [-key_usage str]*"
+	" [-ca -path_len_constraint num]"
+	" [-ext_key_usage str]*"
+	" [-crl_http_uri uri] [-crl_ldap_uri uri]"
+	" [-ca_issuers_uri uri] [-ocsp_uri uri uri]"
+	" [-batch num]"
+#ifdef ENABLE_PTHREAD
+	" [-threads num]"
+#endif
+	" [-out pem]";
+
+static char *usage =
+"Options\n"
+"\n"
+"    -in pem | stdin              Input CSRs in PEM format, one after another\n"
+"    -req_sm2_id str              CSR Owners' ID in SM2 signature algorithm\n"
+"    -req_sm2_id_hex hex          CSR Owners' ID in hex format\n"
+"                                 If neither `-req_sm2_id` nor `-req_sm2_id_hex` is specified,\n"
+"                                   the default string '1234567812345678' is used\n"
+"    -serial_len num              Serial number length in bytes, 8 to 20, default 12\n"
+"    -days num                    Validity peroid in days\n"
+"    -cacert pem                  Issuer CA certificate\n"
+"    -key pem                     Issuer private key file in PEM format\n"
+"    -pass pass                   Password for decrypting private key file\n"
+"    -sm2_id str                  Authority's ID in SM2 signature algorithm\n"
+"    -sm2_id_hex hex              Authority's ID in hex format\n"
+"                                 If neither `-sm2_id` nor `-sm2_id_hex` is specified,\n"
+"                                   the default string '1234567812345678' is used\n"
+"    -batch num                   Number of CSRs read and issued at a time, default 1024\n"
+#ifdef ENABLE_PTHREAD
+"    -threads num                 Number of signing threads, default 1\n"
+#endif
+"    -out pem                     Output certificates in PEM format, in the order of the CSRs\n"
+"\n"
+"  Extension options, same for all the certificates\n"
+"\n"
+"    -gen_authority_key_id        Generate AuthorityKeyIdentifier extension use SM3\n"
+"    -gen_subject_key_id          Generate SubjectKeyIdentifier extension of each CSR's key use SM3\n"
+"    -key_usage str               Add KeyUsage extension, see `gmssl reqsign -help`\n"
+"    -ca                          Set cA of BasicConstaints extension\n"
+"    -path_len_constraint num     Set pathLenConstaint of BasicConstaints extension\n"
+"    -ext_key_usage str           Set ExtKeyUsage extension, see `gmssl reqsign -help`\n"
+"    -crl_http_uri uri            Set HTTP URI of CRL of CRLDistributionPoints extension\n"
+"    -crl_ldap_uri uri            Set LDAP URI of CRL of CRLDistributionPoints extension\n"
+"    -ca_issuers_uri uri          Set URI of the CA certificate of AuthorityInfoAccess extension\n"
+"    -ocsp_uri uri                Set OCSP URI of AuthorityInfoAccess extension\n"
+"\n"
+"  CSRs not issued are reported to stderr with their index in the input, the\n"
+"  exit status is non-zero if any CSR is not issued.\n"
+"\n"
+"Examples\n"
+"\n"
+"    $ cat *.csr | gmssl certissue -days 365 -cacert cacert.pem -key cakey.pem -pass P@ssw0rd \\\n"
+"          -gen_authority_key_id -gen_subject_key_id -key_usage digitalSignature \\\n"
+"          -threads 8 -out certs.pem\n"
+"\n";
+
+#define CERTISSUE_DEFAULT_BATCH_SIZE	1024
+#define CERTISSUE_MAX_BATCH_SIZE	(1024 * 1024)
+#define CERTISSUE_MAX_REQ_SIZE		4096
+
+static int ext_key_usage_set(int *usages, const char *usage_name)
+{
+	int flag = 0;
+	if (x509_key_usage_from_name(&flag, usage_name) != 1) {
+		return -1;
+	}
+	*usages |= flag;
+	return 1;
+}
+
+int certissue_main(int argc, char **argv)
+{
+	int ret = 1;
+	char *prog = argv[0];
+	char *str;
+
+	// Input CSRs
+	char *infile = NULL;
+	FILE *infp = stdin;
+	char req_id[SM2_MAX_ID_LENGTH + 1] = {0};
+	size_t req_id_len = 0;
+	uint8_t req[CERTISSUE_MAX_REQ_SIZE];
+	size_t reqlen;
+
+	int serial_len = 12;
+	int days = 0;
+	time_t not_before;
+	time_t not_after;
+
+	// CA certficate and Private Key
+	uint8_t *cacert = NULL;
+	size_t cacertlen;
+	FILE *keyfp = NULL;
+	char *pass = NULL;
+	SM2_KEY sm2_key;
+	SM2_KEY issuer_public_key;
+	char signer_id[SM2_MAX_ID_LENGTH + 1] = {0};
+	size_t signer_id_len = 0;
+
+	// Output
+	char *outfile = NULL;
+	FILE *outfp = stdout;
+
+	// Extensions
+	uint8_t exts[4096];
+	size_t extslen = 0;
+	int gen_authority_key_id = 0;
+	int gen_subject_key_id = 0;
+	int key_usage = 0;
+	int ca = -1;
+	int path_len_constraint = -1;
+	int ext_key_usages[12];
+	size_t ext_key_usages_cnt = 0;
+	char *crl_http_uri = NULL;
+	char *crl_ldap_uri = NULL;
+	char *ca_issuers_uri = NULL;
+	char *ocsp_uri = NULL;
+
+	// Issuance
+	X509_ISSUE_CTX ctx;
+	X509_ISSUE_ITEM *items = NULL;
+	size_t batch = CERTISSUE_DEFAULT_BATCH_SIZE;
+	size_t items_cnt = 0;
+	size_t total = 0;
+	size_t failed = 0;
+	int nthreads = 1;
+	int eof = 0;
+	int rv;
+	size_t i;
+
+	memset(&sm2_key, 0, sizeof(sm2_key));
+	memset(&ctx, 0, sizeof(ctx));
+
+	argc--;
+	argv++;
+
+	if (argc < 1) {
+		fprintf(stderr, "usage: %s %s\n", prog, options);
+		return 1;
+	}
+
+	while (argc >= 1) {
+		if (!strcmp(*argv, "-help")) {
+			printf("usage: gmssl %s %s\n\n", prog, options);
+			printf("%s\n", usage);
+			ret = 0;
+			goto end;
+		} else if (!strcmp(*argv, "-in")) {
+			if (--argc < 1) goto bad;
+			infile = *(++argv);
+			if (!(infp = fopen(infile, "rb"))) {
+				fprintf(stderr, "%s: open '%s' failure : %s\n", prog, infile, strerror(errno));
+				goto end;
+			}
+		} else if (!strcmp(*argv, "-req_sm2_id")) {
+			if (--argc < 1) goto bad;
+			str = *(++argv);
+			if (strlen(str) > sizeof(req_id) - 1) {
+				fprintf(stderr, "%s: invalid `-req_sm2_id` length\n", prog);
+				goto end;
+			}
+			strncpy(req_id, str, sizeof(req_id));
+			req_id_len = strlen(str);
+		} else if (!strcmp(*argv, "-req_sm2_id_hex")) {
+			if (--argc < 1) goto bad;
+			str = *(++argv);
+			if (strlen(str) > (sizeof(req_id) - 1) * 2) {
+				fprintf(stderr, "%s: invalid `-req_sm2_id_hex` length\n", prog);
+				goto end;
+			}
+			if (hex_to_bytes(str, strlen(str), (uint8_t *)req_id, &req_id_len) != 1) {
+				fprintf(stderr, "%s: invalid `-req_sm2_id_hex` value\n", prog);
+				goto end;
+			}
+		} else if (!strcmp(*argv, "-out")) {
+			if (--argc < 1) goto bad;
+			outfile = *(++argv);
+			if (!(outfp = fopen(outfile, "wb"))) {
+				fprintf(stderr, "%s: open '%s' failure : %s\n", prog, outfile, strerror(errno));
+				goto end;
+			}
+		} else if (!strcmp(*argv, "-serial_len")) {
+			if (--argc < 1) goto bad;
+			serial_len = atoi(*(++argv));
+			if (serial_len < X509_ISSUE_MIN_SERIAL_SIZE || serial_len > X509_ISSUE_MAX_SERIAL_SIZE) {
+				fprintf(stderr, "%s: invalid `-serial_len` value, need a number from %d to %d\n",
+					prog, X509_ISSUE_MIN_SERIAL_SIZE, X509_ISSUE_MAX_SERIAL_SIZE);
+				goto end;
+			}
+		} else if (!strcmp(*argv, "-days")) {
+			if (--argc < 1) goto bad;
+			days = atoi(*(++argv));
+			if (days <= 0) {
+				fprintf(stderr, "%s: invalid `-days` value, need a positive number\n", prog);
+				goto end;
+			}
+		} else if (!strcmp(*argv, "-cacert")) {
+			if (--argc < 1) goto bad;
+			str = *(++argv);
+			if (x509_cert_new_from_file(&cacert, &cacertlen, str) != 1) {
+				fprintf(stderr, "%s: load ca certificate '%s' failure\n", prog, str);
+				goto end;
+			}
+		} else if (!strcmp(*argv, "-key")) {
+			if (--argc < 1) goto bad;
+			str = *(++argv);
+			if (!(keyfp = fopen(str, "rb"))) {
+				fprintf(stderr, "%s: open '%s' failure : %s\n", prog, str, strerror(errno));
+				goto end;
+			}
+		} else if (!strcmp(*argv, "-pass")) {
+			if (--argc < 1) goto bad;
+			pass = *(++argv);
+		} else if (!strcmp(*argv, "-sm2_id")) {
+			if (--argc < 1) goto bad;
+			str = *(++argv);
+			if (strlen(str) > sizeof(signer_id) - 1) {
+				fprintf(stderr, "%s: invalid `-sm2_id` length\n", prog);
+				goto end;
+			}
+			strncpy(signer_id, str, sizeof(signer_id));
+			signer_id_len = strlen(str);
+		} else if (!strcmp(*argv, "-sm2_id_hex")) {
+			if (--argc < 1) goto bad;
+			str = *(++argv);
+			if (strlen(str) > (sizeof(signer_id) - 1) * 2) {
+				fprintf(stderr, "%s: invalid `-sm2_id_hex` length\n", prog);
+				goto end;
+			}
+			if (hex_to_bytes(str, strlen(str), (uint8_t *)signer_id, &signer_id_len) != 1) {
+				fprintf(stderr, "%s: invalid `-sm2_id_hex` value\n", prog);
+				goto end;
+			}
+		} else if (!strcmp(*argv, "-batch")) {
+			if (--argc < 1) goto bad;
+			rv = atoi(*(++argv));
+			if (rv < 1 || rv > CERTISSUE_MAX_BATCH_SIZE) {
+				fprintf(stderr, "%s: invalid `-batch` value, should be in [1, %d]\n",
+					prog, CERTISSUE_MAX_BATCH_SIZE);
+				goto end;
+			}
+			batch = (size_t)rv;
+#ifdef ENABLE_PTHREAD
+		} else if (!strcmp(*argv, "-threads")) {
+			if (--argc < 1) goto bad;
+			nthreads = atoi(*(++argv));
+			if (nthreads < 1 || nthreads > X509_ISSUE_MAX_THREADS) {
+				fprintf(stderr, "%s: invalid `-threads` value, should be in [1, %d]\n",
+					prog, X509_ISSUE_MAX_THREADS);
+				goto end;
+			}
+#endif
+		} else if (!strcmp(*argv, "-gen_authority_key_id")) {
+			gen_authority_key_id = 1;
+		} else if (!strcmp(*argv, "-gen_subject_key_id")) {
+			gen_subject_key_id = 1;
+		} else if (!strcmp(*argv, "-key_usage")) {
+			if (--argc < 1) goto bad;
+			str = *(++argv);
+			if (ext_key_usage_set(&key_usage, str) != 1) {
+				fprintf(stderr, "%s: invalid `-key_usage` value '%s'\n", prog, str);
+				goto end;
+			}
+		} else if (!strcmp(*argv, "-ca")) {
+			ca = 1;
+		} else if (!strcmp(*argv, "-path_len_constraint")) {
+			if (--argc < 1) goto bad;
+			path_len_constraint = atoi(*(++argv));
+			if (path_len_constraint < 0) {
+				fprintf(stderr, "%s: invalid `-path_len_constraint` value\n", prog);
+				goto end;
+			}
+		} else if (!strcmp(*argv, "-ext_key_usage")) {
+			if (--argc < 1) goto bad;
+			str = *(++argv);
+			if (x509_key_purpose_from_name(str) <= 0) {
+				fprintf(stderr, "%s: invalid `-ext_key_usage` value '%s'\n", prog, str);
+				goto end;
+			}
+			if (ext_key_usages_cnt >= sizeof(ext_key_usages)/sizeof(ext_key_usages[0])) {
+				fprintf(stderr, "%s: too much `-ext_key_usage` options\n", prog);
+				goto end;
+			}
+			ext_key_usages[ext_key_usages_cnt++] = x509_key_purpose_from_name(str);
+		} else if (!strcmp(*argv, "-crl_http_uri")) {
+			if (--argc < 1) goto bad;
+			crl_http_uri = *(++argv);
+		} else if (!strcmp(*argv, "-crl_ldap_uri")) {
+			if (--argc < 1) goto bad;
+			crl_ldap_uri = *(++argv);
+		} else if (!strcmp(*argv, "-ca_issuers_uri")) {
+			if (--argc < 1) goto bad;
+			ca_issuers_uri = *(++argv);
+		} else if (!strcmp(*argv, "-ocsp_uri")) {
+			if (--argc < 1) goto bad;
+			ocsp_uri = *(++argv);
+		} else {
+			fprintf(stderr, "%s: illegal option '%s'\n", prog, *argv);
+			goto end;
+bad:
+			fprintf(stderr, "%s: '%s' option value missing\n", prog, *argv);
+			goto end;
+		}
+
+		argc--;
+		argv++;
+	}
+
+	if (!days) {
+		fprintf(stderr, "%s: '-days' option required\n", prog);
+		goto end;
+	}
+	if (!cacert) {
+		fprintf(stderr, "%s: '-cacert' option required\n", prog);
+		goto end;
+	}
+	if (!keyfp) {
+		fprintf(stderr, "%s: '-key' option required\n", prog);
+		goto end;
+	}
+	if (!pass) {
+		fprintf(stderr, "%s: '-pass' option required\n", prog);
+		goto end;
+	}
+
+	if (sm2_private_key_info_decrypt_from_pem(&sm2_key, pass, keyfp) != 1) {
+		fprintf(stderr, "%s: load private key failure\n", prog);
+		goto end;
+	}
+	if (x509_cert_get_subject_public_key(cacert, cacertlen, &issuer_public_key) != 1) {
+		fprintf(stderr, "%s: parse CA certificate failure\n", prog);
+		goto end;
+	}
+	if (sm2_public_key_equ(&sm2_key, &issuer_public_key) != 1) {
+		fprintf(stderr, "%s: private key and CA certificate not match\n", prog);
+		goto end;
+	}
+
+	time(&not_before);
+	if (x509_validity_add_days(&not_after, not_before, days) != 1) {
+		fprintf(stderr, "%s: set Validity failure\n", prog);
+		goto end;
+	}
+
+	// the SubjectKeyIdentifier is added by the issuance engine
+	if (gen_authority_key_id) {
+		if (x509_exts_add_default_authority_key_identifier(exts, &extslen, sizeof(exts), &sm2_key) != 1) {
+			fprintf(stderr, "%s: set AuthorityKeyIdentifier extension failure\n", prog);
+			goto end;
+		}
+	}
+	if (key_usage) {
+		if (x509_exts_add_key_usage(exts, &extslen, sizeof(exts), X509_critical, key_usage) != 1) {
+			fprintf(stderr, "%s: set KeyUsage extension failure\n", prog);
+			goto end;
+		}
+	}
+	if (ca >= 0 || path_len_constraint >= 0) {
+		if (x509_exts_add_basic_constraints(exts, &extslen, sizeof(exts),
+			X509_critical, ca, path_len_constraint) != 1) {
+			fprintf(stderr, "%s: set BasicConstraints extension failure\n", prog);
+			goto end;
+		}
+	}
+	if (ext_key_usages_cnt) {
+		if (x509_exts_add_ext_key_usage(exts, &extslen, sizeof(exts),
+			-1, ext_key_usages, ext_key_usages_cnt) != 1) {
+			fprintf(stderr, "%s: set ExtKeyUsage extension failure\n", prog);
+			goto end;
+		}
+	}
+	if (crl_http_uri || crl_ldap_uri) {
+		if (x509_exts_add_crl_distribution_points(exts, &extslen, sizeof(exts),
+			-1,
+			crl_http_uri, crl_http_uri ? strlen(crl_http_uri) : 0,
+			crl_ldap_uri, crl_ldap_uri ? strlen(crl_ldap_uri) : 0) != 1) {
+			fprintf(stderr, "%s: set CRLDistributionPoints extension failure\n", prog);
+			goto end;
+		}
+	}
+	if (ca_issuers_uri || ocsp_uri) {
+		if (x509_exts_add_authority_info_access(exts, &extslen, sizeof(exts), 0,
+			ca_issuers_uri, ca_issuers_uri ? strlen(ca_issuers_uri) : 0,
+			ocsp_uri, ocsp_uri ? strlen(ocsp_uri) : 0) != 1) {
+			fprintf(stderr, "%s: set AuthorityInfoAccess extension failure\n",  prog);
+			goto end;
+		}
+	}
+
+	if (x509_issue_ctx_init(&ctx, cacert, cacertlen,
+		&sm2_key, signer_id_len ? signer_id : NULL, signer_id_len,
+		req_id_len ? req_id : NULL, req_id_len,
+		not_before, not_after, exts, extslen, gen_subject_key_id, serial_len) != 1) {
+		fprintf(stderr, "%s: init certificate issuing failure\n", prog);
+		goto end;
+	}
+	gmssl_secure_clear(&sm2_key, sizeof(SM2_KEY));
+
+	if (!(items = (X509_ISSUE_ITEM *)calloc(batch, sizeof(X509_ISSUE_ITEM)))) {
+		fprintf(stderr, "%s: malloc failure\n", prog);
+		goto end;
+	}
+
+	while (!eof) {
+		// read a batch of CSRs, the DER encodings are kept in the items
+		for (items_cnt = 0; items_cnt < batch; items_cnt++) {
+			if ((rv = pem_read(infp, "CERTIFICATE REQUEST", req, &reqlen, sizeof(req))) < 0) {
+				fprintf(stderr, "%s: read CSR #%zu failure\n", prog, total + items_cnt);
+				goto end;
+			}
+			if (!rv) {
+				eof = 1;
+				break;
+			}
+			if (!(items[items_cnt].req = (uint8_t *)malloc(reqlen))) {
+				fprintf(stderr, "%s: malloc failure\n", prog);
+				goto end;
+			}
+			memcpy((uint8_t *)items[items_cnt].req, req, reqlen);
+			items[items_cnt].reqlen = reqlen;
+		}
+		if (!items_cnt) {
+			break;
+		}
+
+#ifdef ENABLE_PTHREAD
+		if (x509_certs_issue_threads(&ctx, items, items_cnt, nthreads) != 1) {
+			fprintf(stderr, "%s: inner error\n", prog);
+			goto end;
+		}
+#else
+		if (x509_certs_issue(&ctx, items, items_cnt) != 1) {
+			fprintf(stderr, "%s: inner error\n", prog);
+			goto end;
+		}
+#endif
+
+		for (i = 0; i < items_cnt; i++) {
+			if (items[i].status != X509_ISSUE_OK) {
+				fprintf(stderr, "%s: CSR #%zu not issued: %s\n", prog, total + i,
+					x509_issue_status_name(items[i].status));
+				failed++;
+				continue;
+			}
+			if (x509_cert_to_pem(items[i].cert, items[i].certlen, outfp) != 1) {
+				fprintf(stderr, "%s: output certificate failed\n", prog);
+				goto end;
+			}
+		}
+		x509_issue_items_cleanup(items, items_cnt);
+		for (i = 0; i < items_cnt; i++) {
+			free((uint8_t *)items[i].req);
+			items[i].req = NULL;
+		}
+		total += items_cnt;
+		items_cnt = 0;
+	}
+
+	ret = failed ? 1 : 0;
+end:
+	gmssl_secure_clear(&sm2_key, sizeof(SM2_KEY));
+	x509_issue_ctx_cleanup(&ctx);
+	if (items) {
+		x509_issue_items_cleanup(items, batch);
+		for (i = 0; i < batch; i++) {
+			if (items[i].req) free((uint8_t *)items[i].req);
+		}
+		free(items);
+	}
+	if (cacert) free(cacert);
+	if (keyfp) fclose(keyfp);
+	if (infile && infp) fclose(infp);
+	if (outfile && outfp) fclose(outfp);
+	return ret;
+}
@@ -15,10 +15,12 @@
 #include <gmssl/file.h>
 #include <gmssl/x509.h>
 #include <gmssl/cms.h>
+#include <gmssl/pem.h>
+#include <gmssl/mem.h>
 
 
 
-static const char *options = "-key file -pass str -cert file -in file [-out file]";
+static const char *options = "-key file -pass str -cert file [-in file] [-out file]";
 
 int cmsdecrypt_main(int argc, char **argv)
 {
@@ -31,22 +33,18 @@ int cmsdecrypt_main(int argc, char **argv)
 	char *outfile = NULL;
 	FILE *keyfp = NULL;
 	FILE *certfp = NULL;
-	FILE *infp = NULL;
+	FILE *infp = stdin;
 	FILE *outfp = stdout;
 	uint8_t cert[1024];
 	size_t certlen;
-	size_t inlen;
-	uint8_t *cms = NULL;
-	size_t cmslen, cms_maxlen;
+	uint8_t buf[16384];
+	size_t len;
 	SM2_KEY key;
-	int content_type;
 	uint8_t *content = NULL;
 	size_t content_len;
-	const uint8_t *rcpt_infos;
-	size_t rcpt_infos_len;
-	const uint8_t *shared_info1;
-	const uint8_t *shared_info2;
-	size_t shared_info1_len, shared_info2_len;
+	CMS_DEENVELOP_CTX *deenvelop_ctx = NULL;
+	PEM_CTX pem_ctx;
+	int rv;
 
 	argc--;
 	argv++;
@@ -56,7 +54,7 @@ int cmsdecrypt_main(int argc, char **argv)
 		return 1;
 	}
 
-	while (argc > 1) {
+	while (argc > 0) {
 		if (!strcmp(*argv, "-help")) {
 			printf("usage: %s %s\n", prog, options);
 			ret = 0;
@@ -116,10 +114,6 @@ bad:
 		fprintf(stderr, "%s: '-cert' option required\n", prog);
 		goto end;
 	}
-	if (!infile) {
-		fprintf(stderr, "%s: '-in' option required\n", prog);
-		goto end;
-	}
 
 	if (sm2_private_key_info_decrypt_from_pem(&key, pass, keyfp) != 1) {
 		fprintf(stderr, "%s: private key decryption failure\n", prog);
@@ -130,39 +124,34 @@ bad:
 		goto end;
 	}
 
-	if (file_size(infp, &inlen) != 1) {
-		fprintf(stderr, "%s: get input length failed\n", prog);
-		goto end;
-	}
-	cms_maxlen = (inlen * 3)/4 + 1;
-	if (!(cms = malloc(cms_maxlen))) {
+	if (!(deenvelop_ctx = malloc(sizeof(CMS_DEENVELOP_CTX)))
+		|| !(content = malloc(sizeof(buf) + SM4_BLOCK_SIZE))) {
 		fprintf(stderr, "%s: malloc failure\n", prog);
 		goto end;
 	}
-	if (cms_from_pem(cms, &cmslen, cms_maxlen, infp) != 1) {
+	if (pem_read_init(&pem_ctx, infp, PEM_CMS) != 1
+		|| cms_deenvelop_init(deenvelop_ctx, &key, cert, certlen) != 1) {
 		fprintf(stderr, "%s: read CMS failure\n", prog);
 		goto end;
 	}
-
-	if (!(content = malloc(cmslen))) {
-		fprintf(stderr, "%s: malloc failure\n", prog);
-		goto end;
+	while ((rv = pem_read_update(&pem_ctx, buf, &len, sizeof(buf))) == 1) {
+		if (cms_deenvelop_update(deenvelop_ctx, buf, len, content, &content_len) != 1) {
+			fprintf(stderr, "%s: decryption failure\n", prog);
+			goto end;
+		}
+		if (fwrite(content, 1, content_len, outfp) != content_len) {
+			fprintf(stderr, "%s: output failure : %s\n", prog, strerror(errno));
+			goto end;
+		}
 	}
-
-	if (cms_deenvelop(cms, cmslen,
-		&key, cert, certlen,
-		&content_type, content, &content_len,
-		&rcpt_infos, &rcpt_infos_len,
-		&shared_info1, &shared_info1_len,
-		&shared_info2, &shared_info2_len) != 1) {
-		fprintf(stderr, "%s: decryption failure\n", prog);
+	if (rv < 0) {
+		fprintf(stderr, "%s: read CMS failure\n", prog);
 		goto end;
 	}
-	if (content_type != OID_cms_data) {
-		fprintf(stderr, "%s: invalid CMS content type: %s\n", prog, cms_content_type_name(content_type));
+	if (cms_deenvelop_finish(deenvelop_ctx, content, &content_len) != 1) {
+		fprintf(stderr, "%s: decryption failure\n", prog);
 		goto end;
 	}
-
 	if (fwrite(content, 1, content_len, outfp) != content_len) {
 		fprintf(stderr, "%s: output failure : %s\n", prog, strerror(errno));
 		goto end;
@@ -174,7 +163,11 @@ end:
 	if (infile && infp) fclose(infp);
 	if (outfile && outfp) fclose(outfp);
 	if (keyfile && keyfp) fclose(keyfp);
-	if (cms) free(cms);
+	gmssl_secure_clear(&key, sizeof(key));
+	if (deenvelop_ctx) {
+		gmssl_secure_clear(deenvelop_ctx, sizeof(CMS_DEENVELOP_CTX));
+		free(deenvelop_ctx);
+	}
 	if (content) free(content);
 	return ret;
 }
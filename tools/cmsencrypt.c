@@ -14,11 +14,13 @@
 #include <stdlib.h>
 #include <gmssl/file.h>
 #include <gmssl/cms.h>
+#include <gmssl/pem.h>
+#include <gmssl/mem.h>
 #include <gmssl/x509.h>
 #include <gmssl/rand.h>
 
 
-static const char *options = "-encrypt (-rcptcert pem)* -in file -out file";
+static const char *options = "(-rcptcert pem)* [-in file] [-out file]";
 
 
 static int get_files_size(int argc, char **argv, const char *option, size_t *len)
@@ -64,7 +66,6 @@ int cmsencrypt_main(int argc, char **argv)
 {
 	int ret = 1;
 	char *prog = argv[0];
-	int op = 0;
 	char *infile = NULL;
 	char *outfile = NULL;
 	FILE *infp = stdin;
@@ -73,11 +74,15 @@ int cmsencrypt_main(int argc, char **argv)
 	size_t rcpt_certs_len;
 	uint8_t key[16];
 	uint8_t iv[16];
-	uint8_t *inbuf = NULL;
-	size_t inlen;
+	FILE_READER reader = {0};
+	const uint8_t *in;
+	size_t len;
+	int rv;
 	uint8_t *cms = NULL;
-	size_t cmslen;
+	size_t cmslen, cms_maxlen = CMS_STREAM_UPDATE_MAX_OUTLEN(FILE_IO_BLOCK_SIZE);
 	uint8_t *cert;
+	CMS_ENVELOP_CTX envelop_ctx;
+	PEM_CTX pem_ctx;
 
 	if (argc < 2) {
 		fprintf(stderr, "usage: %s %s\n", prog, options);
@@ -99,22 +104,10 @@ int cmsencrypt_main(int argc, char **argv)
 	}
 	cert = rcpt_certs;
 
-	if (get_files_size(argc, argv, "-in", &inlen) != 1) {
-		goto end;
-	}
-	if (inlen <= 0) {
-		fprintf(stderr, "%s: invalid input length\n", prog);
-		goto end;
-	}
-	if (!(inbuf = malloc(inlen))) {
-		fprintf(stderr, "%s: %s\n", prog, strerror(errno));
-		goto end;
-	}
-
 	argc--;
 	argv++;
 
-	while (argc > 1) {
+	while (argc > 0) {
 		if (!strcmp(*argv, "-help")) {
 			printf("usage: %s %s\n", prog, options);
 			ret = 0;
@@ -129,7 +122,7 @@ int cmsencrypt_main(int argc, char **argv)
 				fprintf(stderr, "%s: open '%s' failure : %s\n", prog, certfile, strerror(errno));
 				goto end;
 			}
-			if (x509_cert_from_pem(cert, &certlen, rcpt_certs_len, certfp) != 1) {
+			if (x509_cert_from_pem(cert, &certlen, rcpt_certs_len - (cert - rcpt_certs), certfp) != 1) {
 				fprintf(stderr, "%s: error\n", prog);
 				fclose(certfp);
 				goto end;
@@ -143,10 +136,6 @@ int cmsencrypt_main(int argc, char **argv)
 				fprintf(stderr, "%s: open '%s' failure : %s\n", prog, infile, strerror(errno));
 				goto end;
 			}
-			if ((inlen = fread(inbuf, 1, inlen, infp)) <= 0) {
-				fprintf(stderr, "%s: read data error: %s\n", prog, strerror(errno));
-				goto end;
-			}
 		} else if (!strcmp(*argv, "-out")) {
 			if (--argc < 1) goto bad;
 			outfile = *(++argv);
@@ -167,26 +156,48 @@ bad:
 	}
 
 	rcpt_certs_len = cert - rcpt_certs;
+	if (!rcpt_certs_len) {
+		fprintf(stderr, "%s: '-rcptcert' option required\n", prog);
+		goto end;
+	}
 
+	// the RecipientInfos are in the header, the content is encrypted in a single pass
 	if (rand_bytes(key, sizeof(key)) != 1
 		|| rand_bytes(iv, sizeof(iv)) != 1
-		|| cms_envelop(NULL, &cmslen, rcpt_certs, rcpt_certs_len,
-			OID_sm4_cbc, key, sizeof(key), iv, sizeof(iv),
-			OID_cms_data, inbuf, inlen, NULL, 0, NULL, 0) != 1) {
+		|| cms_envelop_init(&envelop_ctx, rcpt_certs, rcpt_certs_len,
+			OID_sm4_cbc, key, sizeof(key), iv, sizeof(iv), NULL, &cmslen) != 1) {
 		fprintf(stderr, "%s: inner error\n", prog);
 		goto end;
 	}
-	if (!(cms = malloc(cmslen))) {
+	if (cmslen > cms_maxlen) {
+		cms_maxlen = cmslen;
+	}
+	if (file_reader_init(&reader, infp) != 1
+		|| !(cms = malloc(cms_maxlen))) {
 		fprintf(stderr, "%s: malloc failure\n", prog);
 		goto end;
 	}
-	if (cms_envelop(cms, &cmslen, rcpt_certs, rcpt_certs_len,
-		OID_sm4_cbc, key, sizeof(key), iv, sizeof(iv),
-		OID_cms_data, inbuf, inlen, NULL, 0, NULL, 0) != 1) {
+	if (cms_envelop_init(&envelop_ctx, rcpt_certs, rcpt_certs_len,
+			OID_sm4_cbc, key, sizeof(key), iv, sizeof(iv), cms, &cmslen) != 1
+		|| pem_write_init(&pem_ctx, outfp, PEM_CMS) != 1
+		|| pem_write_update(&pem_ctx, cms, cmslen) != 1) {
 		fprintf(stderr, "%s: inner error\n", prog);
 		goto end;
 	}
-	if (cms_to_pem(cms, cmslen, outfp) != 1) {
+	while ((rv = file_reader_read(&reader, &in, &len)) == 1) {
+		if (cms_envelop_update(&envelop_ctx, in, len, cms, &cmslen) != 1
+			|| pem_write_update(&pem_ctx, cms, cmslen) != 1) {
+			fprintf(stderr, "%s: inner error\n", prog);
+			goto end;
+		}
+	}
+	if (rv < 0) {
+		fprintf(stderr, "%s: read data error : %s\n", prog, strerror(errno));
+		goto end;
+	}
+	if (cms_envelop_finish(&envelop_ctx, cms, &cmslen) != 1
+		|| pem_write_update(&pem_ctx, cms, cmslen) != 1
+		|| pem_write_finish(&pem_ctx) != 1) {
 		fprintf(stderr, "%s: output CMS failure\n", prog);
 		goto end;
 	}
@@ -194,10 +205,12 @@ bad:
 	ret = 0;
 
 end:
+	gmssl_secure_clear(key, sizeof(key));
+	gmssl_secure_clear(&envelop_ctx, sizeof(envelop_ctx));
+	file_reader_cleanup(&reader);
 	if (infile && infp) fclose(infp);
 	if (outfile && outfp) fclose(outfp);
 	if (rcpt_certs) free(rcpt_certs);
-	if (inbuf) free(inbuf);
 	if (cms) free(cms);
 	return ret;
 }
@@ -15,6 +15,8 @@
 #include <gmssl/file.h>
 #include <gmssl/x509.h>
 #include <gmssl/cms.h>
+#include <gmssl/pem.h>
+#include <gmssl/mem.h>
 #include <gmssl/error.h>
 
 
@@ -28,7 +30,7 @@
 
 */
 
-static const char *options = "-key file -pass str -cert file -in file [-out file]";
+static const char *options = "-key file -pass str -cert file [-in file] [-detach] [-out file]";
 
 int cmssign_main(int argc, char **argv)
 {
@@ -41,16 +43,21 @@ int cmssign_main(int argc, char **argv)
 	char *outfile = NULL;
 	FILE *keyfp = NULL;
 	FILE *certfp = NULL;
-	FILE *infp = NULL;
+	FILE *infp = stdin;
 	FILE *outfp = stdout;
+	int detach = 0;
 	SM2_KEY key;
 	uint8_t cert[1024];
 	size_t certlen;
-	uint8_t *in = NULL;
-	size_t inlen;
+	FILE_READER reader = {0};
+	const uint8_t *in;
+	size_t len;
+	int rv;
 	uint8_t *cms = NULL;
-	size_t cmslen, cms_maxlen;
+	size_t cmslen, cms_maxlen = CMS_STREAM_UPDATE_MAX_OUTLEN(FILE_IO_BLOCK_SIZE);
 	CMS_CERTS_AND_KEY cert_and_key;
+	CMS_SIGN_CTX sign_ctx;
+	PEM_CTX pem_ctx;
 
 	argc--;
 	argv++;
@@ -60,7 +67,7 @@ int cmssign_main(int argc, char **argv)
 		return 1;
 	}
 
-	while (argc > 1) {
+	while (argc > 0) {
 		if (!strcmp(*argv, "-help")) {
 			printf("usage: %s %s\n", prog, options);
 			ret = 0;
@@ -89,6 +96,8 @@ int cmssign_main(int argc, char **argv)
 				fprintf(stderr, "%s: open '%s' failure : %s\n", prog, infile, strerror(errno));
 				goto end;
 			}
+		} else if (!strcmp(*argv, "-detach")) {
+			detach = 1;
 		} else if (!strcmp(*argv, "-out")) {
 			if (--argc < 1) goto bad;
 			outfile = *(++argv);
@@ -120,10 +129,6 @@ bad:
 		fprintf(stderr, "%s: '-cert' option required\n", prog);
 		goto end;
 	}
-	if (!infile) {
-		fprintf(stderr, "%s: '-in' option required\n", prog);
-		goto end;
-	}
 
 	if (sm2_private_key_info_decrypt_from_pem(&key, pass, keyfp) != 1) {
 		fprintf(stderr, "%s: private key decryption failure\n", prog);
@@ -149,42 +154,46 @@ bad:
 	cert_and_key.certs_len = certlen;
 	cert_and_key.sign_key = &key;
 
-	if (file_size(infp, &inlen) != 1) {
-		fprintf(stderr, "%s: get input length failed\n", prog);
-		goto end;
-	}
-	if (!(in = malloc(inlen))) {
+	// the content is signed in a single pass, the output is indefinite-length BER
+	if (file_reader_init(&reader, infp) != 1
+		|| !(cms = malloc(cms_maxlen))) {
 		fprintf(stderr, "%s: malloc failure\n", prog);
 		goto end;
 	}
-	if (fread(in, 1, inlen, infp) != inlen) {
-		fprintf(stderr, "%s: read file error : %s\n",  prog, strerror(errno));
+	if (cms_sign_init(&sign_ctx, &cert_and_key, 1, detach, cms, &cmslen) != 1
+		|| pem_write_init(&pem_ctx, outfp, PEM_CMS) != 1
+		|| pem_write_update(&pem_ctx, cms, cmslen) != 1) {
+		fprintf(stderr, "%s: sign failure\n", prog);
 		goto end;
 	}
-
-	cms_maxlen = (inlen * 4)/3 + 4096; // SignerInfos decide DN length		
-	if (!(cms = malloc(cms_maxlen))) {
-		fprintf(stderr, "%s: malloc failure\n", prog);
-		goto end;
+	while ((rv = file_reader_read(&reader, &in, &len)) == 1) {
+		if (cms_sign_update(&sign_ctx, in, len, cms, &cmslen) != 1
+			|| pem_write_update(&pem_ctx, cms, cmslen) != 1) {
+			fprintf(stderr, "%s: sign failure\n", prog);
+			goto end;
+		}
 	}
-
-	if (cms_sign(cms, &cmslen, &cert_and_key, 1, OID_cms_data, in, inlen, NULL, 0) != 1) {
-		fprintf(stderr, "%s: sign failure\n", prog);
+	if (rv < 0) {
+		fprintf(stderr, "%s: read input error : %s\n", prog, strerror(errno));
 		goto end;
 	}
-
-	if (cms_to_pem(cms, cmslen, outfp) != 1) {
-		fprintf(stderr, "%s: output failure\n", prog);
+	if (cms_sign_finish(&sign_ctx, NULL, &cmslen) != 1
+		|| cmslen > cms_maxlen
+		|| cms_sign_finish(&sign_ctx, cms, &cmslen) != 1
+		|| pem_write_update(&pem_ctx, cms, cmslen) != 1
+		|| pem_write_finish(&pem_ctx) != 1) {
+		fprintf(stderr, "%s: sign failure\n", prog);
 		goto end;
 	}
 
 	ret = 0;
 
 end:
+	file_reader_cleanup(&reader);
 	if (infile && infp) fclose(infp);
 	if (outfile && outfp) fclose(outfp);
 	if (keyfile && keyfp) fclose(keyfp);
+	gmssl_secure_clear(&key, sizeof(key));
 	if (cms) free(cms);
-	if (in) free(in);
 	return ret;
 }
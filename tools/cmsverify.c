@@ -14,44 +14,39 @@
 #include <stdlib.h>
 #include <gmssl/file.h>
 #include <gmssl/cms.h>
+#include <gmssl/pem.h>
 #include <gmssl/x509.h>
 #include <gmssl/rand.h>
 
 
 
-static const char *options = "-in file [-out file]";
+static const char *options = "[-in file] [-content file] [-out file]";
 
 int cmsverify_main(int argc, char **argv)
 {
 	int ret = 1;
 	char *prog = argv[0];
 	char *infile = NULL;
+	char *contentfile = NULL;
 	char *outfile = NULL;
-	FILE *infp = NULL;
+	char *tmpname = NULL;
+	FILE *infp = stdin;
+	FILE *contentfp = NULL;
 	FILE *outfp = NULL;
-	size_t inlen;
-	uint8_t *cms = NULL;
-	size_t cmslen, cms_maxlen;
-	int content_type;
-	const uint8_t *content;
+	uint8_t buf[16384];
+	size_t len;
+	uint8_t *content = NULL;
 	size_t content_len;
-	const uint8_t *certs;
-	size_t certslen;
-	const uint8_t *crls;
-	size_t crlslen;
-	const uint8_t *signer_infos;
-	size_t signer_infos_len;
+	CMS_VERIFY_CTX *verify_ctx = NULL;
+	PEM_CTX pem_ctx;
+	FILE_READER reader = {0};
+	const uint8_t *data;
 	int rv;
 
 	argc--;
 	argv++;
 
-	if (argc < 1) {
-		fprintf(stderr, "usage: %s %s\n", prog, options);
-		return 1;
-	}
-
-	while (argc > 1) {
+	while (argc > 0) {
 		if (!strcmp(*argv, "-help")) {
 			printf("usage: %s %s\n", prog, options);
 			ret = 0;
@@ -63,13 +58,16 @@ int cmsverify_main(int argc, char **argv)
 				fprintf(stderr, "%s: open '%s' failure : %s\n", prog, infile, strerror(errno));
 				goto end;
 			}
-		} else if (!strcmp(*argv, "-out")) {
+		} else if (!strcmp(*argv, "-content")) {
 			if (--argc < 1) goto bad;
-			outfile = *(++argv);
-			if (!(outfp = fopen(outfile, "wb"))) {
-				fprintf(stderr, "%s: open '%s' failure : %s\n", prog, outfile, strerror(errno));
+			contentfile = *(++argv);
+			if (!(contentfp = fopen(contentfile, "rb"))) {
+				fprintf(stderr, "%s: open '%s' failure : %s\n", prog, contentfile, strerror(errno));
 				goto end;
 			}
+		} else if (!strcmp(*argv, "-out")) {
+			if (--argc < 1) goto bad;
+			outfile = *(++argv);
 		} else {
 			fprintf(stderr, "%s: illegal option '%s'\n", prog, *argv);
 			goto end;
@@ -82,60 +80,99 @@ bad:
 		argv++;
 	}
 
-	if (!infile) {
-		fprintf(stderr, "%s: '-in' option required\n", prog);
-		goto end;
-	}
-	if (file_size(infp, &inlen) != 1) {
-		fprintf(stderr, "%s: get input length failed\n", prog);
-		goto end;
-	}
-	cms_maxlen = (inlen * 3)/4 + 1;
-	if (!(cms = malloc(cms_maxlen))) {
+	if (!(verify_ctx = malloc(sizeof(CMS_VERIFY_CTX)))
+		|| !(content = malloc(sizeof(buf)))) {
 		fprintf(stderr, "%s: malloc failure\n", prog);
 		goto end;
 	}
-	if (cms_from_pem(cms, &cmslen, cms_maxlen, infp) != 1) {
+
+	// the attached content is streamed to a temporary file, which is renamed
+	// to the output file only when the signatures are verified
+	if (outfile) {
+		if (!(tmpname = malloc(strlen(outfile) + sizeof(".tmp")))) {
+			fprintf(stderr, "%s: malloc failure\n", prog);
+			goto end;
+		}
+		strcpy(tmpname, outfile);
+		strcat(tmpname, ".tmp");
+		if (!(outfp = fopen(tmpname, "wb"))) {
+			fprintf(stderr, "%s: open '%s' failure : %s\n", prog, tmpname, strerror(errno));
+			goto end;
+		}
+	}
+
+	if (pem_read_init(&pem_ctx, infp, PEM_CMS) != 1
+		|| cms_verify_init(verify_ctx) != 1) {
 		fprintf(stderr, "%s: read CMS failure\n", prog);
 		goto end;
 	}
-
-	if ((rv = cms_verify(cms, cmslen, NULL, 0, NULL, 0,
-		&content_type, &content, &content_len,
-		&certs, &certslen, &crls, &crlslen,
-		&signer_infos, &signer_infos_len)) < 0) {
-		fprintf(stderr, "%s: verify error\n", prog);
+	while ((rv = pem_read_update(&pem_ctx, buf, &len, sizeof(buf))) == 1) {
+		if (cms_verify_update(verify_ctx, buf, len, outfp ? content : NULL, &content_len) != 1) {
+			fprintf(stderr, "%s: invalid CMS\n", prog);
+			goto end;
+		}
+		if (content_len && fwrite(content, 1, content_len, outfp) != content_len) {
+			fprintf(stderr, "%s: output error : %s\n", prog, strerror(errno));
+			goto end;
+		}
+	}
+	if (rv < 0) {
+		fprintf(stderr, "%s: read CMS failure\n", prog);
 		goto end;
 	}
-	printf("verify %s\n", rv ? "success" : "failure");
-	ret = rv ? 0 : 1;
-
-	if (outfile) {
-		const uint8_t *p;
-		size_t len;
-
-		if (content_type == OID_cms_data) {
-			if (asn1_octet_string_from_der(&p, &len, &content, &content_len) != 1
-				|| asn1_length_is_zero(content_len) != 1) {
-				fprintf(stderr, "%s: invalid CMS\n", prog);
-				goto end;
-			}
-			if (len != fwrite(p, 1, len, outfp)) {
-				fprintf(stderr, "%s: output error : %s\n", prog, strerror(errno));
+	if (contentfp) {
+		if (file_reader_init(&reader, contentfp) != 1) {
+			fprintf(stderr, "%s: malloc failure\n", prog);
+			goto end;
+		}
+		while ((rv = file_reader_read(&reader, &data, &len)) == 1) {
+			if (cms_verify_detached_update(verify_ctx, data, len) != 1) {
+				fprintf(stderr, "%s: CMS has attached content\n", prog);
 				goto end;
 			}
-		} else {
-			fprintf(stderr, "%s: error\n", prog);
+		}
+		if (rv < 0) {
+			fprintf(stderr, "%s: read content error : %s\n", prog, strerror(errno));
 			goto end;
 		}
-
+	} else if (verify_ctx->detached) {
+		fprintf(stderr, "%s: '-content' option required for detached signature\n", prog);
+		goto end;
 	}
 
-
+	rv = cms_verify_finish(verify_ctx);
+	printf("verify %s\n", rv == 1 ? "success" : "failure");
+	if (rv != 1) {
+		goto end;
+	}
+	if (outfp) {
+		if (fclose(outfp) != 0) {
+			outfp = NULL;
+			fprintf(stderr, "%s: output error : %s\n", prog, strerror(errno));
+			goto end;
+		}
+		outfp = NULL;
+		(void)remove(outfile);
+		if (rename(tmpname, outfile) != 0) {
+			fprintf(stderr, "%s: rename '%s' failure : %s\n", prog, tmpname, strerror(errno));
+			goto end;
+		}
+		free(tmpname);
+		tmpname = NULL;
+	}
+	ret = 0;
 
 end:
+	file_reader_cleanup(&reader);
 	if (infile && infp) fclose(infp);
-	if (outfile && outfp) fclose(outfp);
-	if (cms) free(cms);
+	if (contentfp) fclose(contentfp);
+	if (outfp) fclose(outfp);
+	if (tmpname) {
+		// never leave unverified content behind
+		(void)remove(tmpname);
+		free(tmpname);
+	}
+	if (verify_ctx) free(verify_ctx);
+	if (content) free(content);
 	return ret;
 }
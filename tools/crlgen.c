@@ -68,7 +68,6 @@ int crlgen_main(int argc, char **argv)
 	char *outfile = NULL;
 	FILE *outfp = stdout;
 	uint8_t *outbuf = NULL;
-	uint8_t *out;
 	size_t outlen = 0;
 
 	uint8_t *cacert = NULL;
@@ -280,33 +279,14 @@ bad:
 		}
 	}
 
-	if (x509_crl_sign_to_der(
+	if (x509_crl_sign_new(&outbuf, &outlen,
 		X509_version_v2,
 		OID_sm2sign_with_sm3,
 		issuer, issuer_len,
 		this_update, next_update,
 		revoked_certs, revoked_certs_len,
 		extslen ? exts : NULL, extslen,
-		&sign_key, signer_id, signer_id_len,
-		NULL, &outlen) != 1) {
-		fprintf(stderr, "%s: inner error\n", prog);
-		goto end;
-	}
-	if (!(outbuf = malloc(outlen))) {
-		fprintf(stderr, "%s: malloc failure\n", prog);
-		goto end;
-	}
-	out = outbuf;
-	outlen = 0;
-	if (x509_crl_sign_to_der(
-		X509_version_v2,
-		OID_sm2sign_with_sm3,
-		issuer, issuer_len,
-		this_update, next_update,
-		revoked_certs, revoked_certs_len,
-		extslen ? exts : NULL, extslen,
-		&sign_key, signer_id, signer_id_len,
-		&out, &outlen) != 1) {
+		&sign_key, signer_id, signer_id_len) != 1) {
 		fprintf(stderr, "%s: inner error\n", prog);
 		goto end;
 	}
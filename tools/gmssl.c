@@ -18,6 +18,7 @@ extern int rand_main(int argc, char **argv);
 extern int certgen_main(int argc, char **argv);
 extern int certparse_main(int argc, char **argv);
 extern int certverify_main(int argc, char **argv);
+extern int certbulkverify_main(int argc, char **argv);
 extern int certrevoke_main(int argc, char **argv);
 extern int crlget_main(int argc, char **argv);
 extern int crlgen_main(int argc, char **argv);
@@ -26,6 +27,7 @@ extern int crlverify_main(int argc, char **argv);
 extern int reqgen_main(int argc, char **argv);
 extern int reqparse_main(int argc, char **argv);
 extern int reqsign_main(int argc, char **argv);
+extern int certissue_main(int argc, char **argv);
 extern int sm2keygen_main(int argc, char **argv);
 extern int sm2sign_main(int argc, char **argv);
 extern int sm2verify_main(int argc, char **argv);
@@ -116,6 +118,7 @@ static const char *options =
 	"  sm9decrypt        SM9 decryption\n"
 	"  reqgen            Generate certificate signing request (CSR)\n"
 	"  reqsign           Generate certificate from CSR\n"
+	"  certissue         Generate certificates from a stream of CSRs\n"
 	"  reqparse          Parse and print a CSR\n"
 	"  crlget            Download the CRL of given certificate\n"
 	"  crlgen            Sign a CRL with CA certificate and private key\n"
@@ -124,6 +127,7 @@ static const char *options =
 	"  certgen           Generate a self-signed certificate\n"
 	"  certparse         Parse and print certificates\n"
 	"  certverify        Verify certificate chain\n"
+	"  certbulkverify    Verify many issued certificates with CA certificates and CRLs\n"
 	"  certrevoke        Revoke certificate and output RevokedCertificate record\n"
 	"  cmsparse          Parse CMS (cryptographic message syntax) file\n"
 	"  cmsencrypt        Generate CMS EnvelopedData\n"
@@ -180,6 +184,8 @@ int main(int argc, char **argv)
 			return certparse_main(argc, argv);
 		} else if (!strcmp(*argv, "certverify")) {
 			return certverify_main(argc, argv);
+		} else if (!strcmp(*argv, "certbulkverify")) {
+			return certbulkverify_main(argc, argv);
 		} else if (!strcmp(*argv, "certrevoke")) {
 			return certrevoke_main(argc, argv);
 		} else if (!strcmp(*argv, "crlget")) {
@@ -196,6 +202,8 @@ int main(int argc, char **argv)
 			return reqparse_main(argc, argv);
 		} else if (!strcmp(*argv, "reqsign")) {
 			return reqsign_main(argc, argv);
+		} else if (!strcmp(*argv, "certissue")) {
+			return certissue_main(argc, argv);
 		} else if (!strcmp(*argv, "sm2keygen")) {
 			return sm2keygen_main(argc, argv);
 		} else if (!strcmp(*argv, "sm2sign")) {
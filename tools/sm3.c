@@ -14,6 +14,7 @@
 #include <stdlib.h>
 #include <gmssl/sm2.h>
 #include <gmssl/hex.h>
+#include <gmssl/file.h>
 #include <gmssl/error.h>
 
 
@@ -75,6 +76,7 @@ int sm3_main(int argc, char **argv)
 	uint8_t id_bin[64];
 	size_t id_bin_len;
 	SM3_DIGEST_CTX sm3_ctx;
+	FILE_READER reader = {0};
 	uint8_t dgst[32];
 	int i;
 
@@ -206,15 +208,24 @@ bad:
 		}
 
 	} else {
-		uint8_t buf[4096];
+		const uint8_t *buf;
 		size_t len;
-		while ((len = fread(buf, 1, sizeof(buf), infp)) > 0) {
+		int rv;
+
+		if (file_reader_init(&reader, infp) != 1) {
+			fprintf(stderr, "%s: malloc failure\n", prog);
+			goto end;
+		}
+		while ((rv = file_reader_read(&reader, &buf, &len)) == 1) {
 			if (sm3_digest_update(&sm3_ctx, buf, len) != 1) {
 				fprintf(stderr, "%s: inner error\n", prog);
 				goto end;
 			}
 		}
-		memset(buf, 0, sizeof(buf));
+		if (rv < 0) {
+			fprintf(stderr, "%s: read input failure : %s\n", prog, strerror(errno));
+			goto end;
+		}
 	}
 	if (sm3_digest_finish(&sm3_ctx, dgst) != 1) {
 		fprintf(stderr, "%s: inner error\n", prog);
@@ -235,6 +246,7 @@ bad:
 	}
 	ret = 0;
 end:
+	file_reader_cleanup(&reader);
 	if (pubkeyfp) fclose(pubkeyfp);
 	if (infile && infp) fclose(infp);
 	if (outfile && outfp) fclose(outfp);
@@ -13,6 +13,7 @@
 #include <string.h>
 #include <stdlib.h>
 #include <gmssl/sm4.h>
+#include <gmssl/file.h>
 #include <gmssl/mem.h>
 #include <gmssl/hex.h>
 #include <gmssl/error.h>
@@ -56,7 +57,10 @@ int sm4_cbc_main(int argc, char **argv)
 	FILE *infp = stdin;
 	FILE *outfp = stdout;
 	SM4_CBC_CTX ctx;
-	uint8_t buf[4096];
+	FILE_READER reader = {0};
+	const uint8_t *in;
+	uint8_t *buf = NULL;
+	int rv;
 	size_t inlen;
 	size_t outlen;
 
@@ -159,25 +163,33 @@ bad:
 		}
 	}
 
-	while ((inlen = fread(buf, 1, sizeof(buf), infp)) > 0) {
-
+	if (file_reader_init(&reader, infp) != 1
+		|| !(buf = (uint8_t *)malloc(FILE_IO_BLOCK_SIZE + SM4_BLOCK_SIZE))) {
+		fprintf(stderr, "gmssl %s: malloc failure\n", prog);
+		goto end;
+	}
+	while ((rv = file_reader_read(&reader, &in, &inlen)) == 1) {
 		if (enc) {
-			if (sm4_cbc_encrypt_update(&ctx, buf, inlen, buf, &outlen) != 1) {
+			if (sm4_cbc_encrypt_update(&ctx, in, inlen, buf, &outlen) != 1) {
 				error_print();
 				goto end;
 			}
 		} else {
-			if (sm4_cbc_decrypt_update(&ctx, buf, inlen, buf, &outlen) != 1) {
+			if (sm4_cbc_decrypt_update(&ctx, in, inlen, buf, &outlen) != 1) {
 				error_print();
 				goto end;
 			}
 		}
 
-		if (fwrite(buf, 1, outlen, outfp) != outlen) {
+		if (file_write(outfp, buf, outlen) != 1) {
 			fprintf(stderr, "gmssl %s: output failure : %s\n", prog, strerror(errno));
 			goto end;
 		}
 	}
+	if (rv < 0) {
+		fprintf(stderr, "gmssl %s: read input failure : %s\n", prog, strerror(errno));
+		goto end;
+	}
 
 	if (enc) {
 		if (sm4_cbc_encrypt_finish(&ctx, buf, &outlen) != 1) {
@@ -190,7 +202,7 @@ bad:
 			goto end;
 		}
 	}
-	if (fwrite(buf, 1, outlen, outfp) != outlen) {
+	if (file_write(outfp, buf, outlen) != 1) {
 		fprintf(stderr, "gmssl %s: output failure : %s\n", prog, strerror(errno));
 		goto end;
 	}
@@ -201,7 +213,11 @@ end:
 	gmssl_secure_clear(key, sizeof(key));
 	gmssl_secure_clear(iv, sizeof(iv));
 	gmssl_secure_clear(&ctx, sizeof(ctx));
-	gmssl_secure_clear(buf, sizeof(buf));
+	if (buf) {
+		gmssl_secure_clear(buf, FILE_IO_BLOCK_SIZE + SM4_BLOCK_SIZE);
+		free(buf);
+	}
+	file_reader_cleanup(&reader);
 	if (infile && infp) fclose(infp);
 	if (outfile && outfp) fclose(outfp);
 	return ret;
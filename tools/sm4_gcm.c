@@ -13,12 +13,17 @@
 #include <string.h>
 #include <stdlib.h>
 #include <gmssl/sm4.h>
+#include <gmssl/file.h>
 #include <gmssl/mem.h>
 #include <gmssl/hex.h>
 #include <gmssl/error.h>
 
 
-static const char *usage = "{-encrypt|-decrypt} -key hex -iv hex [-aad str| -aad_hex hex] [-taglen num] [-in file] [-out file]";
+static const char *usage = "{-encrypt|-decrypt} -key hex -iv hex [-aad str| -aad_hex hex] [-taglen num] [-in file] [-out file]"
+#ifdef ENABLE_PTHREAD
+	" [-threads num]"
+#endif
+	;
 
 static const char *options =
 "Options\n"
@@ -32,6 +37,9 @@ static const char *options =
 "    -taglen num         MAC tag length, default 16 bytes\n"
 "    -in file | stdin    Input data\n"
 "    -out file | stdout  Output data\n"
+#ifdef ENABLE_PTHREAD
+"    -threads num        Number of threads, default 1\n"
+#endif
 "\n"
 "Examples\n"
 "\n"
@@ -63,9 +71,15 @@ int sm4_gcm_main(int argc, char **argv)
 	FILE *infp = stdin;
 	FILE *outfp = stdout;
 	SM4_GCM_CTX ctx;
-	uint8_t buf[4096];
+	FILE_READER reader = {0};
+	const uint8_t *in;
+	uint8_t *buf = NULL;
+	int rv;
 	size_t inlen;
 	size_t outlen;
+#ifdef ENABLE_PTHREAD
+	int nthreads = 1;
+#endif
 
 	argc--;
 	argv++;
@@ -153,6 +167,16 @@ int sm4_gcm_main(int argc, char **argv)
 				fprintf(stderr, "gmssl %s: open '%s' failure : %s\n", prog, infile, strerror(errno));
 				goto end;
 			}
+#ifdef ENABLE_PTHREAD
+		} else if (!strcmp(*argv, "-threads")) {
+			if (--argc < 1) goto bad;
+			nthreads = atoi(*(++argv));
+			if (nthreads < 1 || nthreads > SM4_MAX_THREADS) {
+				fprintf(stderr, "gmssl %s: invalid `-threads` value, should be in [1, %d]\n",
+					prog, SM4_MAX_THREADS);
+				goto end;
+			}
+#endif
 		} else if (!strcmp(*argv, "-out")) {
 			if (--argc < 1) goto bad;
 			outfile = *(++argv);
@@ -197,23 +221,40 @@ bad:
 		}
 	}
 
-	while ((inlen = fread(buf, 1, sizeof(buf), infp)) > 0) {
+	if (file_reader_init(&reader, infp) != 1
+		|| !(buf = (uint8_t *)malloc(FILE_IO_BLOCK_SIZE + SM4_BLOCK_SIZE))) {
+		fprintf(stderr, "gmssl %s: malloc failure\n", prog);
+		goto end;
+	}
+	while ((rv = file_reader_read(&reader, &in, &inlen)) == 1) {
 		if (enc) {
-			if (sm4_gcm_encrypt_update(&ctx, buf, inlen, buf, &outlen) != 1) {
+#ifdef ENABLE_PTHREAD
+			if (sm4_gcm_encrypt_update_threads(&ctx, in, inlen, buf, &outlen, nthreads) != 1) {
+#else
+			if (sm4_gcm_encrypt_update(&ctx, in, inlen, buf, &outlen) != 1) {
+#endif
 				error_print();
 				goto end;
 			}
 		} else {
-			if (sm4_gcm_decrypt_update(&ctx, buf, inlen, buf, &outlen) != 1) {
+#ifdef ENABLE_PTHREAD
+			if (sm4_gcm_decrypt_update_threads(&ctx, in, inlen, buf, &outlen, nthreads) != 1) {
+#else
+			if (sm4_gcm_decrypt_update(&ctx, in, inlen, buf, &outlen) != 1) {
+#endif
 				error_print();
 				goto end;
 			}
 		}
-		if (fwrite(buf, 1, outlen, outfp) != outlen) {
+		if (file_write(outfp, buf, outlen) != 1) {
 			fprintf(stderr, "gmssl %s: output failure : %s\n", prog, strerror(errno));
 			goto end;
 		}
 	}
+	if (rv < 0) {
+		fprintf(stderr, "gmssl %s: read input failure : %s\n", prog, strerror(errno));
+		goto end;
+	}
 
 	if (enc) {
 		if (sm4_gcm_encrypt_finish(&ctx, buf, &outlen) != 1) {
@@ -226,7 +267,7 @@ bad:
 			goto end;
 		}
 	}
-	if (fwrite(buf, 1, outlen, outfp) != outlen) {
+	if (file_write(outfp, buf, outlen) != 1) {
 		fprintf(stderr, "gmssl %s: output failure : %s\n", prog, strerror(errno));
 		goto end;
 	}
@@ -237,7 +278,11 @@ end:
 	gmssl_secure_clear(key, sizeof(key));
 	gmssl_secure_clear(iv, sizeof(iv));
 	gmssl_secure_clear(&ctx, sizeof(ctx));
-	gmssl_secure_clear(buf, sizeof(buf));
+	if (buf) {
+		gmssl_secure_clear(buf, FILE_IO_BLOCK_SIZE + SM4_BLOCK_SIZE);
+		free(buf);
+	}
+	file_reader_cleanup(&reader);
 	if (infile && infp) fclose(infp);
 	if (outfile && outfp) fclose(outfp);
 	return ret;
@@ -13,12 +13,17 @@
 #include <string.h>
 #include <stdlib.h>
 #include <gmssl/sm4.h>
+#include <gmssl/file.h>
 #include <gmssl/mem.h>
 #include <gmssl/hex.h>
 #include <gmssl/error.h>
 
 
-static const char *usage = "{-encrypt|-decrypt} -key hex -iv hex -data_unit_size num [-in file] [-out file]";
+static const char *usage = "{-encrypt|-decrypt} -key hex -iv hex -data_unit_size num [-in file] [-out file]"
+#ifdef ENABLE_PTHREAD
+	" [-threads num]"
+#endif
+	;
 
 static const char *options =
 "Options\n"
@@ -30,6 +35,9 @@ static const char *options =
 "    -data_unit_size num   Encrypted disk sector size, typically 512 or 4096 bytes\n"
 "    -in file | stdin      Input data\n"
 "    -out file | stdout    Output data\n"
+#ifdef ENABLE_PTHREAD
+"    -threads num          Number of threads, default 1\n"
+#endif
 "\n"
 "Examples\n"
 "\n"
@@ -57,10 +65,15 @@ int sm4_xts_main(int argc, char **argv)
 	FILE *infp = stdin;
 	FILE *outfp = stdout;
 	SM4_XTS_CTX ctx;
+	FILE_READER reader = {0};
+	const uint8_t *in;
 	uint8_t *buf = NULL;
-	size_t buflen;
+	int rv;
 	size_t inlen;
 	size_t outlen;
+#ifdef ENABLE_PTHREAD
+	int nthreads = 1;
+#endif
 
 	argc--;
 	argv++;
@@ -124,6 +137,16 @@ int sm4_xts_main(int argc, char **argv)
 				fprintf(stderr, "gmssl %s: open '%s' failure : %s\n", prog, infile, strerror(errno));
 				goto end;
 			}
+#ifdef ENABLE_PTHREAD
+		} else if (!strcmp(*argv, "-threads")) {
+			if (--argc < 1) goto bad;
+			nthreads = atoi(*(++argv));
+			if (nthreads < 1 || nthreads > SM4_MAX_THREADS) {
+				fprintf(stderr, "gmssl %s: invalid `-threads` value, should be in [1, %d]\n",
+					prog, SM4_MAX_THREADS);
+				goto end;
+			}
+#endif
 		} else if (!strcmp(*argv, "-out")) {
 			if (--argc < 1) goto bad;
 			outfile = *(++argv);
@@ -168,29 +191,40 @@ bad:
 		}
 	}
 
-	buflen = data_unit_size * 16;
-	if (!(buf = (uint8_t *)malloc(buflen))) {
+	if (file_reader_init(&reader, infp) != 1
+		|| !(buf = (uint8_t *)malloc(FILE_IO_BLOCK_SIZE + data_unit_size))) {
 		fprintf(stderr, "gmssl %s: malloc failure\n", prog);
 		goto end;
 	}
-
-	while ((inlen = fread(buf, 1, buflen, infp)) > 0) {
+	while ((rv = file_reader_read(&reader, &in, &inlen)) == 1) {
 		if (enc) {
-			if (sm4_xts_encrypt_update(&ctx, buf, inlen, buf, &outlen) != 1) {
+#ifdef ENABLE_PTHREAD
+			if (sm4_xts_encrypt_update_threads(&ctx, in, inlen, buf, &outlen, nthreads) != 1) {
+#else
+			if (sm4_xts_encrypt_update(&ctx, in, inlen, buf, &outlen) != 1) {
+#endif
 				error_print();
 				goto end;
 			}
 		} else {
-			if (sm4_xts_decrypt_update(&ctx, buf, inlen, buf, &outlen) != 1) {
+#ifdef ENABLE_PTHREAD
+			if (sm4_xts_decrypt_update_threads(&ctx, in, inlen, buf, &outlen, nthreads) != 1) {
+#else
+			if (sm4_xts_decrypt_update(&ctx, in, inlen, buf, &outlen) != 1) {
+#endif
 				error_print();
 				goto end;
 			}
 		}
-		if (fwrite(buf, 1, outlen, outfp) != outlen) {
+		if (file_write(outfp, buf, outlen) != 1) {
 			fprintf(stderr, "gmssl %s: output failure : %s\n", prog, strerror(errno));
 			goto end;
 		}
 	}
+	if (rv < 0) {
+		fprintf(stderr, "gmssl %s: read input failure : %s\n", prog, strerror(errno));
+		goto end;
+	}
 
 	if (enc) {
 		if (sm4_xts_encrypt_finish(&ctx, buf, &outlen) != 1) {
@@ -203,7 +237,7 @@ bad:
 			goto end;
 		}
 	}
-	if (fwrite(buf, 1, outlen, outfp) != outlen) {
+	if (file_write(outfp, buf, outlen) != 1) {
 		fprintf(stderr, "gmssl %s: output failure : %s\n", prog, strerror(errno));
 		goto end;
 	}
@@ -217,6 +251,10 @@ end:
 	gmssl_secure_clear(&ctx, sizeof(ctx));
 	if (infile && infp) fclose(infp);
 	if (outfile && outfp) fclose(outfp);
-	if (buf) free(buf);
+	if (buf) {
+		gmssl_secure_clear(buf, FILE_IO_BLOCK_SIZE + data_unit_size);
+		free(buf);
+	}
+	file_reader_cleanup(&reader);
 	return ret;
 }
@@ -13,11 +13,15 @@
 #include <stdlib.h>
 #include <gmssl/mem.h>
 #include <gmssl/oid.h>
+#include <gmssl/pem.h>
 #include <gmssl/sm9.h>
 #include <gmssl/error.h>
+#ifdef ENABLE_PTHREAD
+#include <pthread.h>
+#endif
 
 
-static const char *usage = "-alg (sm9sign|sm9encrypt) -in master_key.pem -inpass str -id str [-out pem] -outpass str";
+static const char *usage = "-alg (sm9sign|sm9encrypt) -in master_key.pem -inpass str (-id str | -batch file) [-out pem] -outpass str";
 
 static const char *options =
 "Options\n"
@@ -26,6 +30,11 @@ static const char *options =
 "    -pass pass                  Password to encrypt the master private key\n"
 "    -out pem                    Output password-encrypted master private key in PEM format\n"
 "    -pubout pem                 Output master public key in PEM format\n"
+"    -batch file                 Extract keys for the IDs in file, one ID per line,\n"
+"                                the PEM keys are output in the same order\n"
+#ifdef ENABLE_PTHREAD
+"    -threads num                Number of threads of -batch, default 1\n"
+#endif
 "\n"
 "Examples\n"
 "\n"
@@ -34,8 +43,201 @@ static const char *options =
 "\n"
 "    $ gmssl sm9setup -alg sm9encrypt -pass P@ssw0rd -out sm9enc_msk.pem\n"
 "    $ gmssl sm9keygen -alg sm9encrypt -in sm9enc_msk.pem -inpass P@ssw0rd -id Alice -out sm9enc.pem -outpass 123456\n"
+"\n"
+"    $ gmssl sm9keygen -alg sm9sign -in sm9sign_msk.pem -inpass P@ssw0rd -batch ids.txt -out sm9sign_keys.pem -outpass 123456\n"
 "\n";
 
+#define SM9KEYGEN_BATCH_SIZE	256
+#define SM9KEYGEN_MAX_ID_SIZE	SM2_MAX_ID_LENGTH
+
+typedef struct {
+	const SM9_SIGN_MASTER_KEY *sign_msk;
+	const SM9_ENC_MASTER_KEY *enc_msk;
+	const char *pass;
+	const char **ids;
+	const size_t *idlens;
+	size_t n;
+	uint8_t (*der)[SM9_MAX_ENCED_PRIVATE_KEY_INFO_SIZE];
+	size_t *derlen;
+	int ret;
+} SM9KEYGEN_TASK;
+
+// extract and encrypt the keys of task->ids, the PBKDF2 of the encryption dominates
+static void *sm9keygen_task_routine(void *arg)
+{
+	SM9KEYGEN_TASK *task = (SM9KEYGEN_TASK *)arg;
+	SM9_SIGN_KEY sign_keys[SM9_EXTRACT_BATCH_SIZE];
+	SM9_ENC_KEY enc_keys[SM9_EXTRACT_BATCH_SIZE];
+	size_t i, j, len;
+
+	task->ret = -1;
+
+	for (i = 0; i < task->n; i += len) {
+		len = task->n - i < SM9_EXTRACT_BATCH_SIZE ? task->n - i : SM9_EXTRACT_BATCH_SIZE;
+
+		if (task->sign_msk) {
+			if (sm9_sign_master_key_extract_keys(task->sign_msk, task->ids + i, task->idlens + i, len, sign_keys) != 1) {
+				error_print();
+				goto end;
+			}
+		} else {
+			if (sm9_enc_master_key_extract_keys(task->enc_msk, task->ids + i, task->idlens + i, len, enc_keys) != 1) {
+				error_print();
+				goto end;
+			}
+		}
+		for (j = 0; j < len; j++) {
+			uint8_t *p = task->der[i + j];
+			task->derlen[i + j] = 0;
+
+			if (task->sign_msk) {
+				if (sm9_sign_key_info_encrypt_to_der(&sign_keys[j], task->pass, &p, &task->derlen[i + j]) != 1) {
+					error_print();
+					goto end;
+				}
+			} else {
+				if (sm9_enc_key_info_encrypt_to_der(&enc_keys[j], task->pass, &p, &task->derlen[i + j]) != 1) {
+					error_print();
+					goto end;
+				}
+			}
+		}
+	}
+	task->ret = 1;
+
+end:
+	gmssl_secure_clear(sign_keys, sizeof(sign_keys));
+	gmssl_secure_clear(enc_keys, sizeof(enc_keys));
+	return NULL;
+}
+
+static int sm9keygen_run_tasks(SM9KEYGEN_TASK *tasks, int ntasks)
+{
+	int i;
+#ifdef ENABLE_PTHREAD
+	pthread_t threads[SM9_EXTRACT_MAX_THREADS];
+	int started = 0;
+
+	for (i = 1; i < ntasks; i++) {
+		if (pthread_create(&threads[i], NULL, sm9keygen_task_routine, &tasks[i]) != 0) {
+			error_print();
+			break;
+		}
+		started = i;
+	}
+	sm9keygen_task_routine(&tasks[0]);
+	for (i = 1; i <= started; i++) {
+		pthread_join(threads[i], NULL);
+	}
+	if (started != ntasks - 1) {
+		return -1;
+	}
+#else
+	for (i = 0; i < ntasks; i++) {
+		sm9keygen_task_routine(&tasks[i]);
+	}
+#endif
+	for (i = 0; i < ntasks; i++) {
+		if (tasks[i].ret != 1) {
+			error_print();
+			return -1;
+		}
+	}
+	return 1;
+}
+
+// read up to SM9KEYGEN_BATCH_SIZE IDs at a time, the output is written before reading the next IDs
+static int sm9keygen_batch(const SM9_SIGN_MASTER_KEY *sign_msk, const SM9_ENC_MASTER_KEY *enc_msk,
+	FILE *idfp, const char *pass, FILE *outfp, int nthreads)
+{
+	int ret = -1;
+	const char *pem_name = sign_msk ? PEM_SM9_SIGN_PRIVATE_KEY : PEM_SM9_ENC_PRIVATE_KEY;
+	char (*idbuf)[SM9KEYGEN_MAX_ID_SIZE + 2] = NULL;
+	uint8_t (*der)[SM9_MAX_ENCED_PRIVATE_KEY_INFO_SIZE] = NULL;
+	size_t derlen[SM9KEYGEN_BATCH_SIZE];
+	const char *ids[SM9KEYGEN_BATCH_SIZE];
+	size_t idlens[SM9KEYGEN_BATCH_SIZE];
+	SM9KEYGEN_TASK tasks[SM9_EXTRACT_MAX_THREADS];
+	size_t n, i, offset, per_task;
+	int eof = 0;
+	int ntasks;
+
+	if (!(idbuf = malloc(sizeof(*idbuf) * SM9KEYGEN_BATCH_SIZE))
+		|| !(der = malloc(sizeof(*der) * SM9KEYGEN_BATCH_SIZE))) {
+		error_print();
+		goto end;
+	}
+
+	while (!eof) {
+		for (n = 0; n < SM9KEYGEN_BATCH_SIZE; ) {
+			char *line = idbuf[n];
+			size_t len;
+
+			if (!fgets(line, sizeof(idbuf[n]), idfp)) {
+				eof = 1;
+				break;
+			}
+			len = strlen(line);
+			if (len && line[len - 1] == '\n') {
+				line[--len] = 0;
+			} else if (!feof(idfp)) {
+				fprintf(stderr, "sm9keygen: ID longer than %d bytes\n", SM9KEYGEN_MAX_ID_SIZE);
+				goto end;
+			}
+			if (len && line[len - 1] == '\r') {
+				line[--len] = 0;
+			}
+			if (!len) {
+				continue;
+			}
+			ids[n] = line;
+			idlens[n] = len;
+			n++;
+		}
+		if (!n) {
+			break;
+		}
+
+		ntasks = nthreads < (int)n ? nthreads : (int)n;
+		per_task = (n + ntasks - 1) / ntasks;
+		ntasks = (int)((n + per_task - 1) / per_task);
+		for (i = 0, offset = 0; i < (size_t)ntasks; i++, offset += per_task) {
+			tasks[i].sign_msk = sign_msk;
+			tasks[i].enc_msk = enc_msk;
+			tasks[i].pass = pass;
+			tasks[i].ids = ids + offset;
+			tasks[i].idlens = idlens + offset;
+			tasks[i].n = n - offset < per_task ? n - offset : per_task;
+			tasks[i].der = der + offset;
+			tasks[i].derlen = derlen + offset;
+		}
+		if (sm9keygen_run_tasks(tasks, ntasks) != 1) {
+			error_print();
+			goto end;
+		}
+
+		for (i = 0; i < n; i++) {
+			if (pem_write(outfp, pem_name, der[i], derlen[i]) != 1) {
+				error_print();
+				goto end;
+			}
+		}
+	}
+	if (ferror(idfp)) {
+		error_print();
+		goto end;
+	}
+	ret = 1;
+
+end:
+	if (der) {
+		gmssl_secure_clear(der, sizeof(*der) * SM9KEYGEN_BATCH_SIZE);
+		free(der);
+	}
+	if (idbuf) free(idbuf);
+	return ret;
+}
+
 int sm9keygen_main(int argc, char **argv)
 {
 	int ret = -1;
@@ -44,10 +246,13 @@ int sm9keygen_main(int argc, char **argv)
 	char *infile = NULL;
 	char *inpass = NULL;
 	char *id = NULL;
+	char *batchfile = NULL;
+	int nthreads = 1;
 	char *outfile = NULL;
 	char *outpass = NULL;
 	int oid = 0;
 	FILE *infp = stdin;
+	FILE *batchfp = NULL;
 	FILE *outfp = stdout;
 	SM9_SIGN_MASTER_KEY sign_msk;
 	SM9_ENC_MASTER_KEY enc_msk;
@@ -86,6 +291,22 @@ int sm9keygen_main(int argc, char **argv)
 		} else if (!strcmp(*argv, "-id")) {
 			if (--argc < 1) goto bad;
 			id = *(++argv);
+		} else if (!strcmp(*argv, "-batch")) {
+			if (--argc < 1) goto bad;
+			batchfile = *(++argv);
+			if (!(batchfp = fopen(batchfile, "rb"))) {
+				fprintf(stderr, "%s: open '%s' failure\n", prog, batchfile);
+				goto end;
+			}
+#ifdef ENABLE_PTHREAD
+		} else if (!strcmp(*argv, "-threads")) {
+			if (--argc < 1) goto bad;
+			nthreads = atoi(*(++argv));
+			if (nthreads < 1 || nthreads > SM9_EXTRACT_MAX_THREADS) {
+				fprintf(stderr, "%s: invalid -threads value, should be in [1, %d]\n", prog, SM9_EXTRACT_MAX_THREADS);
+				goto end;
+			}
+#endif
 		} else if (!strcmp(*argv, "-out")) {
 			if (--argc < 1) goto bad;
 			outfile = *(++argv);
@@ -107,8 +328,12 @@ bad:
 		argv++;
 	}
 
-	if (!id) {
-		fprintf(stderr, "%s: option '-id' is required\n", prog);
+	if (!id && !batchfile) {
+		fprintf(stderr, "%s: option '-id' or '-batch' is required\n", prog);
+		goto end;
+	}
+	if (id && batchfile) {
+		fprintf(stderr, "%s: option '-id' and '-batch' should not be used together\n", prog);
 		goto end;
 	}
 	if (!inpass || !outpass) {
@@ -116,10 +341,34 @@ bad:
 		goto end;
 	}
 
+	if (batchfile) {
+		switch (oid) {
+		case OID_sm9sign:
+			if (sm9_sign_master_key_info_decrypt_from_pem(&sign_msk, inpass, infp) != 1
+				|| sm9keygen_batch(&sign_msk, NULL, batchfp, outpass, outfp, nthreads) != 1) {
+				error_print();
+				goto end;
+			}
+			break;
+		case OID_sm9encrypt:
+			if (sm9_enc_master_key_info_decrypt_from_pem(&enc_msk, inpass, infp) != 1
+				|| sm9keygen_batch(NULL, &enc_msk, batchfp, outpass, outfp, nthreads) != 1) {
+				error_print();
+				goto end;
+			}
+			break;
+		default:
+			error_print();
+			goto end;
+		}
+		ret = 0;
+		goto end;
+	}
+
 	switch (oid) {
 	case OID_sm9sign:
 		if (sm9_sign_master_key_info_decrypt_from_pem(&sign_msk, inpass, infp) != 1
-		|| sm9_sign_master_key_extract_key(&sign_msk, id, strlen(id), &sign_key) != 1
+			|| sm9_sign_master_key_extract_key(&sign_msk, id, strlen(id), &sign_key) != 1
 			|| sm9_sign_key_info_encrypt_to_pem(&sign_key, outpass, outfp) != 1) {
 			error_print();
 			goto end;
@@ -144,6 +393,7 @@ end:
 	gmssl_secure_clear(&sign_key, sizeof(sign_key));
 	gmssl_secure_clear(&enc_key, sizeof(enc_key));
 	if (infile && infp) fclose(infp);
+	if (batchfp) fclose(batchfp);
 	if (outfile && outfp) fclose(outfp);
-	return 1;
+	return ret;
 }
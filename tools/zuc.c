@@ -15,6 +15,7 @@
 #include <gmssl/mem.h>
 #include <gmssl/zuc.h>
 #include <gmssl/hex.h>
+#include <gmssl/file.h>
 
 
 static const char *options = "-key hex -iv hex [-in file] [-out file]";
@@ -34,10 +35,12 @@ int zuc_main(int argc, char **argv)
 	FILE *infp = stdin;
 	FILE *outfp = stdout;
 	ZUC_CTX zuc_ctx;
-	uint8_t inbuf[4096];
+	FILE_READER reader = {0};
+	const uint8_t *in;
 	size_t inlen;
-	uint8_t outbuf[4196];
+	uint8_t *outbuf = NULL;
 	size_t outlen;
+	int rv;
 
 	argc--;
 	argv++;
@@ -113,21 +116,30 @@ bad:
 		fprintf(stderr, "%s: inner error\n", prog);
 		goto end;
 	}
-	while ((inlen = fread(inbuf, 1, sizeof(inbuf), infp)) > 0) {
-		if (zuc_encrypt_update(&zuc_ctx, inbuf, inlen, outbuf, &outlen) != 1) {
+	if (file_reader_init(&reader, infp) != 1
+		|| !(outbuf = (uint8_t *)malloc(FILE_IO_BLOCK_SIZE + 4))) { // ZUC_CTX keeps at most 4 bytes
+		fprintf(stderr, "%s: malloc failure\n", prog);
+		goto end;
+	}
+	while ((rv = file_reader_read(&reader, &in, &inlen)) == 1) {
+		if (zuc_encrypt_update(&zuc_ctx, in, inlen, outbuf, &outlen) != 1) {
 			fprintf(stderr, "%s: inner error\n", prog);
 			goto end;
 		}
-		if (fwrite(outbuf, 1, outlen, outfp) != outlen) {
+		if (file_write(outfp, outbuf, outlen) != 1) {
 			fprintf(stderr, "%s: output failure : %s\n", prog, strerror(errno));
 			goto end;
 		}
 	}
+	if (rv < 0) {
+		fprintf(stderr, "%s: read input failure : %s\n", prog, strerror(errno));
+		goto end;
+	}
 	if (zuc_encrypt_finish(&zuc_ctx, outbuf, &outlen) != 1) {
 		fprintf(stderr, "%s: inner error\n", prog);
 		goto end;
 	}
-	if (fwrite(outbuf, 1, outlen, outfp) != outlen) {
+	if (file_write(outfp, outbuf, outlen) != 1) {
 		fprintf(stderr, "%s: output failure : %s\n", prog, strerror(errno));
 		goto end;
 	}
@@ -136,8 +148,11 @@ end:
 	gmssl_secure_clear(&zuc_ctx, sizeof(zuc_ctx));
 	gmssl_secure_clear(key, sizeof(key));
 	gmssl_secure_clear(iv, sizeof(iv));
-	gmssl_secure_clear(inbuf, sizeof(inbuf));
-	gmssl_secure_clear(outbuf, sizeof(outbuf));
+	if (outbuf) {
+		gmssl_secure_clear(outbuf, FILE_IO_BLOCK_SIZE + 4);
+		free(outbuf);
+	}
+	file_reader_cleanup(&reader);
 	if (infile && infp) fclose(infp);
 	if (outfile && outfp) fclose(outfp);
 	return ret;